@@ -16,5 +16,7 @@ class GzipCompressor;
 class GzipDecompressor;
 class ZlibCompressor;
 class ZlibDecompressor;
+class ZstdCompressor;
+class ZstdDecompressor;
 
 }
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCompress/GenericZlib.h>
+#include <LibCompress/Zstd.h>
+
+#include <string.h>
+#include <zstd.h>
+
+namespace Compress {
+
+// https://compression.spec.whatwg.org/#supported-formats
+// The zstd decoder must not use a window larger than 8 MiB.
+static constexpr int max_window_log = 23;
+
+static Error zstd_error(size_t result)
+{
+    auto const* message = ZSTD_getErrorName(result);
+    return Error::from_string_view({ message, strlen(message) });
+}
+
+static int level_from_compression_level(ZstdCompressionLevel compression_level)
+{
+    switch (compression_level) {
+    case ZstdCompressionLevel::Fastest:
+        return 1;
+    case ZstdCompressionLevel::Default:
+        return ZSTD_defaultCLevel();
+    case ZstdCompressionLevel::Best:
+        // The "ultra" levels above 19 use windows larger than a conforming decoder has to accept.
+        return 19;
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+ZstdDecompressor::ZstdDecompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, ZSTD_DCtx* decoder)
+    : m_buffer(move(buffer))
+    , m_stream(move(stream))
+    , m_decoder(decoder)
+{
+}
+
+ErrorOr<NonnullOwnPtr<ZstdDecompressor>> ZstdDecompressor::create(MaybeOwned<Stream> stream)
+{
+    auto buffer = TRY(AK::FixedArray<u8>::create(ZSTD_DStreamInSize()));
+    auto* decoder = ZSTD_createDCtx();
+    if (!decoder)
+        return Error::from_errno(ENOMEM);
+
+    if (auto result = ZSTD_DCtx_setParameter(decoder, ZSTD_d_windowLogMax, max_window_log); ZSTD_isError(result)) {
+        ZSTD_freeDCtx(decoder);
+        return zstd_error(result);
+    }
+
+    return adopt_nonnull_own_or_enomem(new (nothrow) ZstdDecompressor(move(buffer), move(stream), decoder));
+}
+
+ErrorOr<ByteBuffer> ZstdDecompressor::decompress_all(ReadonlyBytes bytes)
+{
+    return ::Compress::decompress_all<ZstdDecompressor>(bytes);
+}
+
+ZstdDecompressor::~ZstdDecompressor()
+{
+    ZSTD_freeDCtx(m_decoder);
+}
+
+ErrorOr<Bytes> ZstdDecompressor::read_some(Bytes bytes)
+{
+    if (bytes.is_empty())
+        return bytes.trim(0);
+
+    if (m_eof) {
+        if (!m_stream->is_eof())
+            return Error::from_string_literal("Zstd stream has trailing data");
+        return bytes.trim(0);
+    }
+
+    if (m_input.is_empty())
+        m_input = TRY(m_stream->read_some(m_buffer.span()));
+
+    auto had_input = !m_input.is_empty();
+
+    ZSTD_inBuffer input { m_input.data(), m_input.size(), 0 };
+    ZSTD_outBuffer output { bytes.data(), bytes.size(), 0 };
+
+    auto result = ZSTD_decompressStream(m_decoder, &output, &input);
+    if (ZSTD_isError(result))
+        return zstd_error(result);
+
+    m_input = m_input.slice(input.pos);
+
+    // A result of zero means that a frame was completely decoded and flushed.
+    if (result == 0) {
+        if (!m_input.is_empty() || !m_stream->is_eof())
+            return Error::from_string_literal("Zstd stream has trailing data");
+
+        m_eof = true;
+        return bytes.trim(output.pos);
+    }
+
+    if (output.pos == 0 && !had_input)
+        return Error::from_string_literal("Zstd stream ended before the end of the frame");
+
+    return bytes.trim(output.pos);
+}
+
+ErrorOr<size_t> ZstdDecompressor::write_some(ReadonlyBytes)
+{
+    return Error::from_errno(EBADF);
+}
+
+bool ZstdDecompressor::is_eof() const
+{
+    return m_eof;
+}
+
+bool ZstdDecompressor::is_open() const
+{
+    return m_stream->is_open();
+}
+
+void ZstdDecompressor::close()
+{
+}
+
+ZstdCompressor::ZstdCompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, ZSTD_CCtx* encoder)
+    : m_buffer(move(buffer))
+    , m_stream(move(stream))
+    , m_encoder(encoder)
+{
+}
+
+ErrorOr<NonnullOwnPtr<ZstdCompressor>> ZstdCompressor::create(MaybeOwned<Stream> stream, ZstdCompressionLevel compression_level)
+{
+    auto buffer = TRY(AK::FixedArray<u8>::create(ZSTD_CStreamOutSize()));
+    auto* encoder = ZSTD_createCCtx();
+    if (!encoder)
+        return Error::from_errno(ENOMEM);
+
+    if (auto result = ZSTD_CCtx_setParameter(encoder, ZSTD_c_compressionLevel, level_from_compression_level(compression_level)); ZSTD_isError(result)) {
+        ZSTD_freeCCtx(encoder);
+        return zstd_error(result);
+    }
+
+    return adopt_nonnull_own_or_enomem(new (nothrow) ZstdCompressor(move(buffer), move(stream), encoder));
+}
+
+ErrorOr<ByteBuffer> ZstdCompressor::compress_all(ReadonlyBytes bytes, ZstdCompressionLevel compression_level)
+{
+    return ::Compress::compress_all<ZstdCompressor>(bytes, compression_level);
+}
+
+ZstdCompressor::~ZstdCompressor()
+{
+    ZSTD_freeCCtx(m_encoder);
+}
+
+ErrorOr<Bytes> ZstdCompressor::read_some(Bytes)
+{
+    return Error::from_errno(EBADF);
+}
+
+ErrorOr<size_t> ZstdCompressor::write_some(ReadonlyBytes bytes)
+{
+    if (m_finished)
+        return Error::from_string_literal("Zstd stream is already finished");
+
+    ZSTD_inBuffer input { bytes.data(), bytes.size(), 0 };
+
+    while (input.pos < input.size) {
+        ZSTD_outBuffer output { m_buffer.data(), m_buffer.size(), 0 };
+
+        auto result = ZSTD_compressStream2(m_encoder, &output, &input, ZSTD_e_continue);
+        if (ZSTD_isError(result))
+            return zstd_error(result);
+
+        TRY(m_stream->write_until_depleted(m_buffer.span().slice(0, output.pos)));
+    }
+
+    return bytes.size();
+}
+
+bool ZstdCompressor::is_eof() const
+{
+    return false;
+}
+
+bool ZstdCompressor::is_open() const
+{
+    return m_stream->is_open();
+}
+
+void ZstdCompressor::close()
+{
+}
+
+ErrorOr<void> ZstdCompressor::finish()
+{
+    if (m_finished)
+        return {};
+
+    ZSTD_inBuffer input { nullptr, 0, 0 };
+
+    while (true) {
+        ZSTD_outBuffer output { m_buffer.data(), m_buffer.size(), 0 };
+
+        auto remaining = ZSTD_compressStream2(m_encoder, &output, &input, ZSTD_e_end);
+        if (ZSTD_isError(remaining))
+            return zstd_error(remaining);
+
+        TRY(m_stream->write_until_depleted(m_buffer.span().slice(0, output.pos)));
+
+        if (remaining == 0)
+            break;
+    }
+
+    m_finished = true;
+    return {};
+}
+
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/FixedArray.h>
+#include <AK/MaybeOwned.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Stream.h>
+
+extern "C" {
+typedef struct ZSTD_DCtx_s ZSTD_DCtx;
+typedef struct ZSTD_CCtx_s ZSTD_CCtx;
+}
+
+namespace Compress {
+
+enum class ZstdCompressionLevel : u8 {
+    Fastest,
+    Default,
+    Best,
+};
+
+class ZstdDecompressor final : public Stream {
+    AK_MAKE_NONCOPYABLE(ZstdDecompressor);
+
+public:
+    static ErrorOr<NonnullOwnPtr<ZstdDecompressor>> create(MaybeOwned<Stream>);
+    static ErrorOr<ByteBuffer> decompress_all(ReadonlyBytes);
+    ~ZstdDecompressor() override;
+
+    virtual ErrorOr<Bytes> read_some(Bytes) override;
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes) override;
+    virtual bool is_eof() const override;
+    virtual bool is_open() const override;
+    virtual void close() override;
+
+private:
+    ZstdDecompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, ZSTD_DCtx*);
+
+    AK::FixedArray<u8> m_buffer;
+    MaybeOwned<Stream> m_stream;
+    ZSTD_DCtx* m_decoder { nullptr };
+    ReadonlyBytes m_input;
+    bool m_eof { false };
+};
+
+class ZstdCompressor final : public Stream {
+    AK_MAKE_NONCOPYABLE(ZstdCompressor);
+
+public:
+    static ErrorOr<NonnullOwnPtr<ZstdCompressor>> create(MaybeOwned<Stream>, ZstdCompressionLevel = ZstdCompressionLevel::Default);
+    static ErrorOr<ByteBuffer> compress_all(ReadonlyBytes, ZstdCompressionLevel = ZstdCompressionLevel::Default);
+    ~ZstdCompressor() override;
+
+    virtual ErrorOr<Bytes> read_some(Bytes) override;
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes) override;
+    virtual bool is_eof() const override;
+    virtual bool is_open() const override;
+    virtual void close() override;
+    ErrorOr<void> finish();
+
+private:
+    ZstdCompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, ZSTD_CCtx*);
+
+    AK::FixedArray<u8> m_buffer;
+    MaybeOwned<Stream> m_stream;
+    ZSTD_CCtx* m_encoder { nullptr };
+    bool m_finished { false };
+};
+
+}
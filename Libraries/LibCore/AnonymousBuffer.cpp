@@ -99,12 +99,54 @@ ErrorOr<AnonymousBuffer> AnonymousBuffer::snapshot(Sealability sealability) cons
     return copy;
 }
 
+ErrorOr<void> AnonymousBuffer::seal_size()
+{
+#if defined(F_ADD_SEALS) && defined(F_SEAL_GROW) && defined(F_SEAL_SHRINK) && defined(F_SEAL_SEAL)
+    TRY(Core::System::fcntl(fd(), F_ADD_SEALS, F_SEAL_GROW | F_SEAL_SHRINK | F_SEAL_SEAL));
+#endif
+    return {};
+}
+
+ErrorOr<void> AnonymousBuffer::seal_contents()
+{
+#if defined(F_ADD_SEALS) && defined(F_SEAL_FUTURE_WRITE) && defined(F_SEAL_GROW) && defined(F_SEAL_SHRINK) && defined(F_SEAL_SEAL)
+    TRY(Core::System::fcntl(fd(), F_ADD_SEALS, F_SEAL_FUTURE_WRITE | F_SEAL_GROW | F_SEAL_SHRINK | F_SEAL_SEAL));
+    return {};
+#else
+    return Error::from_string_literal("Sealing the contents of anonymous buffers is not supported");
+#endif
+}
+
+ErrorOr<void> AnonymousBuffer::validate_sealed_size() const
+{
+    if (!is_valid())
+        return Error::from_string_literal("Anonymous buffer is invalid");
+
+#if defined(F_GET_SEALS) && defined(F_SEAL_GROW) && defined(F_SEAL_SHRINK)
+    auto seals = TRY(Core::System::fcntl(fd(), F_GET_SEALS, static_cast<uintptr_t>(0)));
+    if ((seals & (F_SEAL_GROW | F_SEAL_SHRINK)) != (F_SEAL_GROW | F_SEAL_SHRINK))
+        return Error::from_string_literal("Anonymous buffer size is not sealed");
+#endif
+
+    auto file_status = TRY(Core::System::fstat(fd()));
+    if (file_status.st_size < 0 || static_cast<u64>(file_status.st_size) < size())
+        return Error::from_string_literal("Anonymous buffer is smaller than its claimed size");
+    return {};
+}
+
 ErrorOr<NonnullRefPtr<AnonymousBufferImpl>> AnonymousBufferImpl::create(int fd, size_t size)
 {
+    auto protection = PROT_READ | PROT_WRITE;
+#if defined(F_GET_SEALS) && defined(F_SEAL_WRITE) && defined(F_SEAL_FUTURE_WRITE)
+    // Buffers whose contents have been sealed can only be mapped read-only.
+    if (auto seals = ::fcntl(fd, F_GET_SEALS); seals != -1 && (seals & (F_SEAL_WRITE | F_SEAL_FUTURE_WRITE)) != 0)
+        protection = PROT_READ;
+#endif
+
     void* data = nullptr;
     // POSIX mmap rejects a zero length with EINVAL, so leave m_data null for zero-size buffers.
     if (size > 0) {
-        data = mmap(nullptr, round_up_to_power_of_two(size, PAGE_SIZE), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        data = mmap(nullptr, round_up_to_power_of_two(size, PAGE_SIZE), protection, MAP_SHARED, fd, 0);
         if (data == MAP_FAILED) {
             auto error = Error::from_errno(errno);
             close(fd);
@@ -51,6 +51,19 @@ public:
 
     ErrorOr<AnonymousBuffer> snapshot(Sealability = Sealability::Unsealable) const;
 
+    // Prevents the buffer from ever growing or shrinking. The buffer must have been created as Sealable.
+    ErrorOr<void> seal_size();
+
+    // Fails unless the size of the buffer is sealed and covers the whole mapping. Buffers that were received from another
+    // process must pass this before they are accessed, since the sender could otherwise shrink them underneath us.
+    ErrorOr<void> validate_sealed_size() const;
+
+    // Prevents the contents of the buffer from ever changing again, in addition to sealing its size. Mappings that
+    // already exist stay writable, but every later mapping of the buffer, including those made by the processes it is
+    // sent to, is read-only and can't be made writable. This lets one buffer be shared between processes that must not
+    // be able to affect each other. Fails where this can't be enforced. The buffer must have been created as Sealable.
+    ErrorOr<void> seal_contents();
+
     int fd() const { return m_impl ? m_impl->fd() : -1; }
     size_t size() const { return m_impl ? m_impl->size() : 0; }
 
@@ -78,4 +78,25 @@ ErrorOr<AnonymousBuffer> AnonymousBuffer::snapshot(Sealability sealability) cons
     return copy;
 }
 
+ErrorOr<void> AnonymousBuffer::seal_size()
+{
+    // FIXME: Support sealability on Windows.
+    return {};
+}
+
+ErrorOr<void> AnonymousBuffer::seal_contents()
+{
+    // FIXME: Support sealability on Windows.
+    return Error::from_string_literal("Sealing the contents of anonymous buffers is not supported");
+}
+
+ErrorOr<void> AnonymousBuffer::validate_sealed_size() const
+{
+    if (!is_valid())
+        return Error::from_string_literal("Anonymous buffer is invalid");
+
+    // NB: The size of a file mapping object cannot change after it has been created.
+    return {};
+}
+
 }
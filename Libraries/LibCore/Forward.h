@@ -25,6 +25,7 @@ class File;
 class LocalServer;
 class LocalSocket;
 class MappedFile;
+class MemoryPressureMonitor;
 class MimeData;
 class NetworkJob;
 class Notifier;
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <AK/NeverDestroyed.h>
+#include <AK/NumberFormat.h>
+#include <LibCore/MemoryPressure.h>
+
+#if defined(__GLIBC__)
+#    include <malloc.h>
+#endif
+
+namespace Core::MemoryPressure {
+
+struct RegisteredHandler {
+    StringView name;
+    Handler handler;
+};
+
+static Vector<RegisteredHandler>& handlers()
+{
+    static NeverDestroyed<Vector<RegisteredHandler>> handlers;
+    return *handlers;
+}
+
+StringView level_to_string(Level level)
+{
+    switch (level) {
+    case Level::None:
+        return "none"sv;
+    case Level::Moderate:
+        return "moderate"sv;
+    case Level::Critical:
+        return "critical"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void register_handler(StringView name, Handler handler)
+{
+    handlers().append({ name, move(handler) });
+}
+
+size_t Report::total_bytes_released() const
+{
+    size_t total = 0;
+    for (auto const& result : results)
+        total += result.bytes_released;
+    return total;
+}
+
+Report release_memory(Level level)
+{
+    Report report { .level = level, .results = {} };
+    if (level == Level::None)
+        return report;
+
+    for (auto& [name, handler] : handlers())
+        report.results.append({ name, handler(level) });
+
+#if defined(__GLIBC__)
+    // Memory freed by the handlers may still be held by the allocator's arenas.
+    if (level == Level::Critical)
+        malloc_trim(0);
+#endif
+
+    for (auto const& [name, bytes_released] : report.results)
+        dbgln_if(MEMORY_PRESSURE_DEBUG, "Released {} from {} under {} memory pressure", human_readable_size(bytes_released), name, level_to_string(level));
+
+    return report;
+}
+
+// The share of time in which tasks were stalled on memory, in percent.
+static constexpr double moderate_stall_threshold = 10.0;
+static constexpr double critical_full_stall_threshold = 10.0;
+
+// The share of the cgroup's memory limit in use.
+static constexpr double moderate_cgroup_usage_threshold = 0.85;
+static constexpr double critical_cgroup_usage_threshold = 0.95;
+
+// A line looks like: "some avg10=0.00 avg60=0.00 avg300=0.00 total=0"
+static Optional<double> parse_average_10_seconds(StringView line)
+{
+    for (auto field : line.split_view(' ')) {
+        if (field.starts_with("avg10="sv))
+            return field.substring_view("avg10="sv.length()).to_number<double>();
+    }
+    return {};
+}
+
+Optional<PressureStallInformation> parse_pressure_stall_information(StringView contents)
+{
+    Optional<double> some;
+    Optional<double> full;
+
+    for (auto line : contents.lines()) {
+        if (line.starts_with("some "sv))
+            some = parse_average_10_seconds(line);
+        else if (line.starts_with("full "sv))
+            full = parse_average_10_seconds(line);
+    }
+
+    // Older kernels do not report "full" stalls for the whole system.
+    if (!some.has_value())
+        return {};
+    return PressureStallInformation { .some_average_10_seconds = *some, .full_average_10_seconds = full.value_or(0) };
+}
+
+// The cgroup v2 hierarchy is listed as "0::<path>".
+Optional<StringView> parse_cgroup_path(StringView contents)
+{
+    for (auto line : contents.lines()) {
+        if (line.starts_with("0::"sv))
+            return line.substring_view(3);
+    }
+    return {};
+}
+
+Optional<u64> parse_cgroup_memory_stat_field(StringView contents, StringView field)
+{
+    for (auto line : contents.lines()) {
+        auto parts = line.split_view(' ');
+        if (parts.size() == 2 && parts[0] == field)
+            return parts[1].to_number<u64>();
+    }
+    return {};
+}
+
+Level level_for(Optional<PressureStallInformation> const& pressure_stall_information, Optional<CgroupMemoryUsage> const& cgroup_usage)
+{
+    auto level = Level::None;
+
+    if (pressure_stall_information.has_value()) {
+        if (pressure_stall_information->full_average_10_seconds >= critical_full_stall_threshold)
+            return Level::Critical;
+        if (pressure_stall_information->some_average_10_seconds >= moderate_stall_threshold)
+            level = Level::Moderate;
+    }
+
+    if (cgroup_usage.has_value() && cgroup_usage->limit_bytes > 0) {
+        auto used_bytes = cgroup_usage->current_bytes - min(cgroup_usage->inactive_file_bytes, cgroup_usage->current_bytes);
+        auto usage = static_cast<double>(used_bytes) / static_cast<double>(cgroup_usage->limit_bytes);
+
+        if (usage >= critical_cgroup_usage_threshold)
+            return Level::Critical;
+        if (usage >= moderate_cgroup_usage_threshold)
+            level = Level::Moderate;
+    }
+
+    return level;
+}
+
+}
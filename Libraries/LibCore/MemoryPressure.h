@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+#include <LibCore/Export.h>
+
+// Lets a process give memory back when the system is running low on it. Each subsystem that keeps memory it can do
+// without (caches, pools, free GC blocks) registers a handler, and the browser process tells every helper process
+// when to run them. Handlers run on the main thread, in the order in which they were registered, so handlers that
+// only drop references should be registered before those that actually return memory to the system (e.g. the GC).
+namespace Core::MemoryPressure {
+
+enum class Level : u8 {
+    None,
+
+    // Drop whatever is cheap to rebuild.
+    Moderate,
+
+    // Drop everything that can be rebuilt at all, even at the cost of janky rendering for a while.
+    Critical,
+};
+
+CORE_API StringView level_to_string(Level);
+
+// Returns the number of bytes that were released.
+using Handler = Function<size_t(Level)>;
+
+CORE_API void register_handler(StringView name, Handler);
+
+struct HandlerResult {
+    StringView name;
+    size_t bytes_released { 0 };
+};
+
+struct Report {
+    size_t total_bytes_released() const;
+
+    Level level { Level::None };
+    Vector<HandlerResult> results;
+};
+
+// Runs every registered handler, and reports how much memory each of them released.
+CORE_API Report release_memory(Level);
+
+// The contents of a pressure stall information file, such as /proc/pressure/memory on Linux.
+struct PressureStallInformation {
+    // The percentage of the last 10 seconds in which some, or all, non-idle tasks were stalled waiting for memory.
+    double some_average_10_seconds { 0 };
+    double full_average_10_seconds { 0 };
+};
+
+CORE_API Optional<PressureStallInformation> parse_pressure_stall_information(StringView);
+
+struct CgroupMemoryUsage {
+    u64 current_bytes { 0 };
+    u64 limit_bytes { 0 };
+
+    // Page cache that the kernel can drop without any process noticing, which is not counted towards the pressure.
+    u64 inactive_file_bytes { 0 };
+};
+
+// Returns the cgroup v2 path from the contents of /proc/<pid>/cgroup.
+CORE_API Optional<StringView> parse_cgroup_path(StringView);
+
+// Returns the value of a field from the contents of a cgroup's memory.stat file.
+CORE_API Optional<u64> parse_cgroup_memory_stat_field(StringView, StringView field);
+
+CORE_API Level level_for(Optional<PressureStallInformation> const&, Optional<CgroupMemoryUsage> const&);
+
+}
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/MemoryPressureMonitor.h>
+
+namespace Core {
+
+static constexpr auto renotification_interval = AK::Duration::from_seconds(30);
+
+void MemoryPressureMonitor::did_sample_level(MemoryPressure::Level level, MonotonicTime now)
+{
+    auto previous_level = exchange(m_level, level);
+    if (level == MemoryPressure::Level::None)
+        return;
+
+    if (level <= previous_level && m_last_notification_time.has_value() && now - *m_last_notification_time < renotification_interval)
+        return;
+
+    m_last_notification_time = now;
+    if (on_memory_pressure)
+        on_memory_pressure(level);
+}
+
+}
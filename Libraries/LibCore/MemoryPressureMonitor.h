@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <LibCore/Export.h>
+#include <LibCore/MemoryPressure.h>
+
+namespace Core {
+
+// Watches how much memory pressure the system, or the cgroup that the process is confined to, is under.
+class CORE_API MemoryPressureMonitor {
+    AK_MAKE_NONCOPYABLE(MemoryPressureMonitor);
+
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureMonitor>> create();
+    virtual ~MemoryPressureMonitor() = default;
+
+    // Invoked whenever the pressure rises, and again every so often while it stays elevated, since released caches
+    // fill up again.
+    Function<void(MemoryPressure::Level)> on_memory_pressure;
+
+    MemoryPressure::Level level() const { return m_level; }
+
+protected:
+    MemoryPressureMonitor() = default;
+
+    void did_sample_level(MemoryPressure::Level, MonotonicTime now);
+
+private:
+    MemoryPressure::Level m_level { MemoryPressure::Level::None };
+    Optional<MonotonicTime> m_last_notification_time;
+};
+
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/LexicalPath.h>
+#include <LibCore/File.h>
+#include <LibCore/MemoryPressureMonitor.h>
+#include <LibCore/Timer.h>
+
+namespace Core {
+
+static constexpr int poll_interval_ms = 2000;
+
+static constexpr auto pressure_stall_information_path = "/proc/pressure/memory"sv;
+static constexpr auto cgroup_root = "/sys/fs/cgroup"sv;
+
+static ErrorOr<ByteBuffer> read_file(StringView path)
+{
+    auto file = TRY(File::open(path, File::OpenMode::Read));
+    return file->read_until_eof();
+}
+
+// Finds the closest cgroup, starting at the one that this process belongs to, that has a memory limit.
+static Optional<ByteString> find_cgroup_with_memory_limit()
+{
+    auto cgroups = read_file("/proc/self/cgroup"sv);
+    if (cgroups.is_error())
+        return {};
+
+    auto cgroup_path = MemoryPressure::parse_cgroup_path(cgroups.value());
+    if (!cgroup_path.has_value())
+        return {};
+
+    // The root cgroup has no memory.max file.
+    for (LexicalPath path { *cgroup_path }; path.string() != "/"sv; path = path.parent()) {
+        auto directory = LexicalPath::join(cgroup_root, path.string()).string();
+
+        auto limit = read_file(LexicalPath::join(directory, "memory.max"sv).string());
+        if (!limit.is_error() && StringView { limit.value() }.to_number<u64>().has_value())
+            return directory;
+    }
+
+    return {};
+}
+
+class MemoryPressureMonitorLinux final : public MemoryPressureMonitor {
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureMonitorLinux>> create()
+    {
+        auto has_pressure_stall_information = !read_file(pressure_stall_information_path).is_error();
+        auto cgroup_directory = find_cgroup_with_memory_limit();
+
+        if (!has_pressure_stall_information && !cgroup_directory.has_value())
+            return Error::from_errno(ENOTSUP);
+
+        return adopt_own(*new MemoryPressureMonitorLinux(has_pressure_stall_information, move(cgroup_directory)));
+    }
+
+private:
+    MemoryPressureMonitorLinux(bool has_pressure_stall_information, Optional<ByteString> cgroup_directory)
+        : m_has_pressure_stall_information(has_pressure_stall_information)
+        , m_cgroup_directory(move(cgroup_directory))
+        , m_timer(Timer::create_repeating(poll_interval_ms, [this] { sample(); }))
+    {
+        m_timer->start();
+    }
+
+    void sample()
+    {
+        Optional<MemoryPressure::PressureStallInformation> pressure_stall_information;
+        if (m_has_pressure_stall_information) {
+            if (auto contents = read_file(pressure_stall_information_path); !contents.is_error())
+                pressure_stall_information = MemoryPressure::parse_pressure_stall_information(contents.value());
+        }
+
+        did_sample_level(MemoryPressure::level_for(pressure_stall_information, sample_cgroup_usage()), MonotonicTime::now());
+    }
+
+    Optional<MemoryPressure::CgroupMemoryUsage> sample_cgroup_usage() const
+    {
+        if (!m_cgroup_directory.has_value())
+            return {};
+
+        auto read_number = [&](StringView name) -> Optional<u64> {
+            auto contents = read_file(LexicalPath::join(*m_cgroup_directory, name).string());
+            if (contents.is_error())
+                return {};
+            return StringView { contents.value() }.to_number<u64>();
+        };
+
+        // The limit may have been lifted (i.e. set to "max") since the monitor was created.
+        auto current = read_number("memory.current"sv);
+        auto limit = read_number("memory.max"sv);
+        if (!current.has_value() || !limit.has_value())
+            return {};
+
+        u64 inactive_file = 0;
+        if (auto stat = read_file(LexicalPath::join(*m_cgroup_directory, "memory.stat"sv).string()); !stat.is_error())
+            inactive_file = MemoryPressure::parse_cgroup_memory_stat_field(stat.value(), "inactive_file"sv).value_or(0);
+
+        return MemoryPressure::CgroupMemoryUsage { .current_bytes = *current, .limit_bytes = *limit, .inactive_file_bytes = inactive_file };
+    }
+
+    bool m_has_pressure_stall_information { false };
+    Optional<ByteString> m_cgroup_directory;
+    NonnullRefPtr<Timer> m_timer;
+};
+
+ErrorOr<NonnullOwnPtr<MemoryPressureMonitor>> MemoryPressureMonitor::create()
+{
+    return MemoryPressureMonitorLinux::create();
+}
+
+}
@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/MemoryPressureMonitor.h>
+
+namespace Core {
+
+ErrorOr<NonnullOwnPtr<MemoryPressureMonitor>> MemoryPressureMonitor::create()
+{
+    return Error::from_errno(ENOTSUP);
+}
+
+}
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/StringBuilder.h>
+#include <AK/ThreadID.h>
+#include <AK/Vector.h>
+#include <LibCore/System.h>
+#include <LibCore/Tracing.h>
+#include <LibSync/Mutex.h>
+
+#if !defined(AK_OS_WINDOWS)
+#    include <pthread.h>
+#endif
+
+#if defined(AK_OS_FREEBSD)
+#    include <pthread_np.h>
+#endif
+
+namespace Core::Tracing {
+
+Atomic<bool> g_tracing_enabled { false };
+
+// The number of events that each thread keeps before it starts overwriting its oldest ones.
+static constexpr size_t events_per_thread = 64 * KiB;
+
+struct ThreadBuffer {
+    u64 thread_id { 0 };
+    ByteString thread_name;
+
+    // Only contended while the events are being serialized.
+    Sync::Mutex mutex;
+
+    Vector<Event> events;
+    size_t next_index { 0 };
+
+    // Guarded by thread_buffers_mutex().
+    bool thread_has_exited { false };
+};
+
+static Sync::Mutex& thread_buffers_mutex()
+{
+    static Sync::Mutex mutex;
+    return mutex;
+}
+
+// NB: Buffers outlive their threads until their events have been collected, so that events of threads that have exited
+//     are not lost.
+static Vector<NonnullOwnPtr<ThreadBuffer>>& thread_buffers()
+{
+    static Vector<NonnullOwnPtr<ThreadBuffer>> buffers;
+    return buffers;
+}
+
+static thread_local ThreadBuffer* s_thread_buffer { nullptr };
+
+static void remove_thread_buffer(ThreadBuffer& buffer)
+{
+    thread_buffers().remove_first_matching([&](auto const& entry) { return entry.ptr() == &buffer; });
+}
+
+// Destroyed when its thread exits, which is when the thread's buffer stops being written to.
+struct ThreadBufferOwner {
+    ~ThreadBufferOwner()
+    {
+        if (!s_thread_buffer)
+            return;
+
+        Sync::MutexLocker locker { thread_buffers_mutex() };
+        if (s_thread_buffer->events.is_empty())
+            remove_thread_buffer(*s_thread_buffer);
+        else
+            s_thread_buffer->thread_has_exited = true;
+        s_thread_buffer = nullptr;
+    }
+};
+
+static thread_local ThreadBufferOwner s_thread_buffer_owner;
+
+static ByteString current_thread_name()
+{
+#if !defined(AK_OS_WINDOWS)
+    char thread_name[64] {};
+    if (pthread_getname_np(pthread_self(), thread_name, sizeof(thread_name)) == 0 && thread_name[0] != '\0')
+        return thread_name;
+#endif
+    return {};
+}
+
+static ThreadBuffer& ensure_thread_buffer()
+{
+    if (s_thread_buffer)
+        return *s_thread_buffer;
+
+    auto buffer = make<ThreadBuffer>();
+    buffer->thread_id = ThreadID::current().value();
+    buffer->thread_name = current_thread_name();
+
+    s_thread_buffer = buffer.ptr();
+
+    // Make sure that the owner is constructed, so that its destructor runs when this thread exits.
+    (void)&s_thread_buffer_owner;
+
+    Sync::MutexLocker locker { thread_buffers_mutex() };
+    thread_buffers().append(move(buffer));
+    return *s_thread_buffer;
+}
+
+static void release_events(ThreadBuffer& buffer)
+{
+    // NB: Clear rather than clear_with_capacity(), since a full ring buffer holds on to 64K events.
+    buffer.events.clear();
+    buffer.next_index = 0;
+}
+
+void set_enabled(bool enabled)
+{
+    g_tracing_enabled.store(enabled, AK::memory_order_relaxed);
+
+    // NB: Events that are recorded before tracing is disabled are collected right after, which releases their
+    //     storage. Leftovers of a trace that was never collected are dropped once a new trace starts.
+    if (!enabled)
+        return;
+
+    Sync::MutexLocker locker { thread_buffers_mutex() };
+    thread_buffers().remove_all_matching([](auto const& buffer) { return buffer->thread_has_exited; });
+    for (auto& buffer : thread_buffers()) {
+        Sync::MutexLocker buffer_locker { buffer->mutex };
+        release_events(*buffer);
+    }
+}
+
+void record_event(Event event)
+{
+    auto& buffer = ensure_thread_buffer();
+    Sync::MutexLocker locker { buffer.mutex };
+
+    if (buffer.events.size() < events_per_thread) {
+        buffer.events.append(event);
+        return;
+    }
+
+    buffer.events[buffer.next_index] = event;
+    buffer.next_index = (buffer.next_index + 1) % events_per_thread;
+}
+
+u64 generate_flow_id()
+{
+    static Atomic<u32> s_next_id { 1 };
+
+    // Mix in the process ID, so that flows started by different processes don't get confused with each other.
+    auto process_id = static_cast<u64>(static_cast<u32>(System::getpid()));
+    return (process_id << 32) | s_next_id.fetch_add(1, AK::memory_order_relaxed);
+}
+
+static void append_timestamp(StringBuilder& builder, i64 nanoseconds)
+{
+    builder.appendff("{}.{:03}", nanoseconds / 1000, nanoseconds % 1000);
+}
+
+static char const* phase_for(EventType type)
+{
+    switch (type) {
+    case EventType::Begin:
+        return "B";
+    case EventType::End:
+        return "E";
+    case EventType::Complete:
+        return "X";
+    case EventType::Counter:
+        return "C";
+    case EventType::Instant:
+        return "i";
+    case EventType::FlowStart:
+        return "s";
+    case EventType::FlowEnd:
+        return "f";
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// NB: IDs are written as hexadecimal strings, since JSON parsers may not represent all 64-bit integers exactly.
+static void append_event(StringBuilder& builder, int process_id, u64 thread_id, Event const& event)
+{
+    builder.append("{\"name\":\""sv);
+    builder.append_escaped_for_json(StringView { event.name, strlen(event.name) });
+    builder.append("\",\"cat\":\""sv);
+    builder.append_escaped_for_json(StringView { event.category, strlen(event.category) });
+    builder.appendff("\",\"ph\":\"{}\",\"pid\":{},\"tid\":{},\"ts\":", phase_for(event.type), process_id, thread_id);
+    append_timestamp(builder, event.timestamp_in_nanoseconds);
+
+    switch (event.type) {
+    case EventType::Complete:
+        builder.append(",\"dur\":"sv);
+        append_timestamp(builder, event.value);
+        if (event.id != 0)
+            builder.appendff(",\"args\":{{\"id\":\"{:#x}\"}}", event.id);
+        break;
+    case EventType::Counter:
+        builder.appendff(",\"args\":{{\"value\":{}}}", event.value);
+        break;
+    case EventType::Instant:
+        builder.append(",\"s\":\"t\""sv);
+        break;
+    case EventType::FlowStart:
+        builder.appendff(",\"id\":\"{:#x}\"", event.id);
+        break;
+    case EventType::FlowEnd:
+        // Bind to the slice that encloses the event, rather than to the next slice that begins.
+        builder.appendff(",\"id\":\"{:#x}\",\"bp\":\"e\"", event.id);
+        break;
+    case EventType::Begin:
+    case EventType::End:
+        break;
+    }
+
+    builder.append('}');
+}
+
+static void append_metadata(StringBuilder& builder, StringView name, int process_id, Optional<u64> thread_id, StringView value)
+{
+    builder.appendff("{{\"name\":\"{}\",\"ph\":\"M\",\"pid\":{}", name, process_id);
+    if (thread_id.has_value())
+        builder.appendff(",\"tid\":{}", *thread_id);
+    builder.append(",\"args\":{\"name\":\""sv);
+    builder.append_escaped_for_json(value);
+    builder.append("\"}}"sv);
+}
+
+ErrorOr<ByteBuffer> take_serialized_events(StringView process_name)
+{
+    auto process_id = System::getpid();
+
+    StringBuilder builder;
+    builder.append('[');
+    append_metadata(builder, "process_name"sv, process_id, {}, process_name);
+
+    Sync::MutexLocker locker { thread_buffers_mutex() };
+
+    for (auto& buffer : thread_buffers()) {
+        Sync::MutexLocker buffer_locker { buffer->mutex };
+
+        if (!buffer->thread_name.is_empty()) {
+            builder.append(',');
+            append_metadata(builder, "thread_name"sv, process_id, buffer->thread_id, buffer->thread_name);
+        }
+
+        // Once a ring buffer has wrapped around, its oldest event is the one that would be overwritten next.
+        auto event_count = buffer->events.size();
+        for (size_t i = 0; i < event_count; ++i) {
+            builder.append(',');
+            append_event(builder, process_id, buffer->thread_id, buffer->events[(buffer->next_index + i) % event_count]);
+        }
+
+        release_events(*buffer);
+    }
+
+    thread_buffers().remove_all_matching([](auto const& buffer) { return buffer->thread_has_exited; });
+
+    builder.append(']');
+    return builder.to_byte_buffer();
+}
+
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/ByteBuffer.h>
+#include <AK/Error.h>
+#include <AK/Noncopyable.h>
+#include <AK/StringView.h>
+#include <AK/Time.h>
+#include <LibCore/Export.h>
+
+// Lightweight tracing of what the browser's processes are doing, in a format that chrome://tracing and Perfetto can
+// load. Events are recorded into a ring buffer per thread, so recording never blocks on another thread, and only the
+// most recent events are kept. While tracing is disabled, every entry point returns after checking a single flag.
+//
+// Names and categories must be string literals, since only their addresses are recorded.
+namespace Core::Tracing {
+
+enum class EventType : u8 {
+    Begin,
+    End,
+    Complete,
+    Counter,
+    Instant,
+    FlowStart,
+    FlowEnd,
+};
+
+struct Event {
+    char const* category { nullptr };
+    char const* name { nullptr };
+    EventType type { EventType::Instant };
+    i64 timestamp_in_nanoseconds { 0 };
+
+    // The duration in nanoseconds for complete events, or the value for counter events.
+    i64 value { 0 };
+
+    // Connects flow events across threads and processes.
+    u64 id { 0 };
+};
+
+extern CORE_API Atomic<bool> g_tracing_enabled;
+
+ALWAYS_INLINE bool is_enabled()
+{
+    return g_tracing_enabled.load(AK::memory_order_relaxed);
+}
+
+CORE_API void set_enabled(bool);
+
+CORE_API void record_event(Event);
+
+ALWAYS_INLINE void begin(char const* category, char const* name)
+{
+    if (is_enabled())
+        record_event({ category, name, EventType::Begin, MonotonicTime::now().nanoseconds() });
+}
+
+ALWAYS_INLINE void end(char const* category, char const* name)
+{
+    if (is_enabled())
+        record_event({ category, name, EventType::End, MonotonicTime::now().nanoseconds() });
+}
+
+// Records a slice after the fact, e.g. for work whose start was only known to another thread.
+ALWAYS_INLINE void complete(char const* category, char const* name, MonotonicTime start, AK::Duration duration, u64 id = 0)
+{
+    if (is_enabled())
+        record_event({ category, name, EventType::Complete, start.nanoseconds(), duration.to_nanoseconds(), id });
+}
+
+ALWAYS_INLINE void counter(char const* category, char const* name, i64 value)
+{
+    if (is_enabled())
+        record_event({ category, name, EventType::Counter, MonotonicTime::now().nanoseconds(), value });
+}
+
+ALWAYS_INLINE void instant(char const* category, char const* name)
+{
+    if (is_enabled())
+        record_event({ category, name, EventType::Instant, MonotonicTime::now().nanoseconds() });
+}
+
+// Flow events draw an arrow from the slice that encloses flow_start() to the slice that encloses flow_end() with the
+// same ID, even if those are in different processes.
+ALWAYS_INLINE void flow_start(char const* category, char const* name, u64 id)
+{
+    if (is_enabled() && id != 0)
+        record_event({ category, name, EventType::FlowStart, MonotonicTime::now().nanoseconds(), 0, id });
+}
+
+ALWAYS_INLINE void flow_end(char const* category, char const* name, u64 id)
+{
+    if (is_enabled() && id != 0)
+        record_event({ category, name, EventType::FlowEnd, MonotonicTime::now().nanoseconds(), 0, id });
+}
+
+// Returns an ID that is unique across all processes, for use with flow events. Never returns 0, which means "no ID".
+CORE_API u64 generate_flow_id();
+
+// Traces a slice for the lifetime of the scope. If tracing is enabled while the scope is active, no slice is recorded
+// for it, so that every end event is matched by a begin event.
+class Scope {
+    AK_MAKE_NONCOPYABLE(Scope);
+    AK_MAKE_NONMOVABLE(Scope);
+
+public:
+    ALWAYS_INLINE Scope(char const* category, char const* name)
+        : m_category(category)
+        , m_name(name)
+        , m_is_recording(is_enabled())
+    {
+        if (m_is_recording)
+            record_event({ m_category, m_name, EventType::Begin, MonotonicTime::now().nanoseconds() });
+    }
+
+    ALWAYS_INLINE ~Scope()
+    {
+        if (m_is_recording)
+            record_event({ m_category, m_name, EventType::End, MonotonicTime::now().nanoseconds() });
+    }
+
+private:
+    char const* m_category { nullptr };
+    char const* m_name { nullptr };
+    bool m_is_recording { false };
+};
+
+// Serializes and clears the events recorded by all threads of this process, as a JSON array of trace events.
+// Timestamps are in microseconds of this process's monotonic clock.
+CORE_API ErrorOr<ByteBuffer> take_serialized_events(StringView process_name);
+
+}
@@ -174,6 +174,23 @@ void Database::interrupt()
     sqlite3_interrupt(m_database);
 }
 
+size_t Database::release_memory()
+{
+    auto cache_used = [&] {
+        int current = 0;
+        int highwater = 0;
+        if (sqlite3_db_status(m_database, SQLITE_DBSTATUS_CACHE_USED, &current, &highwater, 0) != SQLITE_OK)
+            return 0;
+        return current;
+    };
+
+    auto cache_used_before = cache_used();
+    sqlite3_db_release_memory(m_database);
+    auto cache_used_after = cache_used();
+
+    return cache_used_before > cache_used_after ? static_cast<size_t>(cache_used_before - cache_used_after) : 0;
+}
+
 ErrorOr<void> Database::try_execute_statement_internal(StatementID statement_id, OnResult on_result)
 {
     auto* statement = prepared_statement(statement_id).statement;
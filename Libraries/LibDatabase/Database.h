@@ -152,6 +152,9 @@ public:
     // until interrupt() returns.
     void interrupt();
 
+    // Releases as much of the page cache as possible, and returns the number of bytes that were released.
+    size_t release_memory();
+
     template<typename ValueType>
     requires(!Detail::is_unsupported_unsigned_sql_integer<ValueType>)
     ValueType result_column(StatementID, int column);
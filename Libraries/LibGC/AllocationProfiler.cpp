@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <AK/TemporaryChange.h>
+#include <LibGC/AllocationProfiler.h>
+#include <LibGC/CellAllocator.h>
+
+#ifdef LIBGC_HAS_CPPTRACE
+#    include <cpptrace/cpptrace.hpp>
+#endif
+
+namespace GC {
+
+// Once the timeline is this long, every other point is dropped, so that it keeps covering the whole session.
+static constexpr size_t MAX_TIMELINE_POINTS = 4096;
+
+// Samples closer together than this don't add a point to the timeline.
+static constexpr auto MIN_TIMELINE_SAMPLE_SPACING = AK::Duration::from_milliseconds(100);
+
+static size_t read_sample_interval_from_environment()
+{
+    auto const* env = getenv("LIBGC_ALLOCATION_SAMPLE_INTERVAL");
+    if (!env || !*env)
+        return 0;
+    return StringView { env, strlen(env) }.to_number<size_t>().value_or(0);
+}
+
+AllocationProfiler::AllocationProfiler()
+{
+    set_sample_interval(read_sample_interval_from_environment());
+}
+
+void AllocationProfiler::set_sample_interval(size_t bytes)
+{
+    m_sample_interval = bytes;
+    m_bytes_until_next_sample = bytes;
+}
+
+void AllocationProfiler::reset()
+{
+    m_bytes_until_next_sample = m_sample_interval;
+    m_sites.clear();
+    m_timeline.clear();
+    m_start_time = MonotonicTime::now();
+}
+
+void AllocationProfiler::record_sample(CellAllocator const& allocator, FlatPtr caller_address, u64 total_allocated_bytes)
+{
+    // The site provider must not allocate cells, but if it does, don't attribute those allocations to themselves.
+    if (m_is_recording_sample)
+        return;
+    TemporaryChange change { m_is_recording_sample, true };
+
+    AllocationSite site {
+        .class_name = allocator.class_name().value_or("generic"sv),
+        .cell_size = allocator.cell_size(),
+    };
+    if (m_site_provider)
+        site.stack = m_site_provider();
+    if (site.stack.is_empty())
+        site.return_address = caller_address;
+
+    ++m_sites.ensure(site).sample_count;
+
+    auto time = MonotonicTime::now() - m_start_time;
+    if (m_timeline.is_empty() || time - m_timeline.last().time >= MIN_TIMELINE_SAMPLE_SPACING)
+        append_timeline_point({ .time = time, .allocated_bytes = total_allocated_bytes, .live_bytes = {} });
+}
+
+void AllocationProfiler::did_collect_garbage(u64 total_allocated_bytes, size_t live_bytes)
+{
+    if (!is_enabled())
+        return;
+    append_timeline_point({ .time = MonotonicTime::now() - m_start_time, .allocated_bytes = total_allocated_bytes, .live_bytes = live_bytes });
+}
+
+void AllocationProfiler::append_timeline_point(TimelinePoint point)
+{
+    if (m_timeline.size() >= MAX_TIMELINE_POINTS) {
+        for (size_t i = 0; i < m_timeline.size() / 2; ++i)
+            m_timeline[i] = m_timeline[i * 2];
+        m_timeline.shrink(m_timeline.size() / 2);
+    }
+    m_timeline.append(point);
+}
+
+static String describe_return_address(FlatPtr return_address)
+{
+#ifdef LIBGC_HAS_CPPTRACE
+    // The return address points after the call, so look up the address before it. Inlined functions are expanded
+    // into their own frames, innermost first.
+    auto resolved = cpptrace::raw_trace { { static_cast<cpptrace::frame_ptr>(return_address) - 1 } }.resolve();
+
+    StringBuilder builder;
+    for (auto const& frame : resolved.frames) {
+        if (frame.symbol.empty())
+            continue;
+        if (!builder.is_empty())
+            builder.append('\n');
+        builder.append(StringView { frame.symbol.c_str(), frame.symbol.length() });
+        if (frame.line.has_value()) {
+            auto filename = StringView { frame.filename.c_str(), frame.filename.length() };
+            if (auto last_slash = filename.find_last('/'); last_slash.has_value())
+                filename = filename.substring_view(*last_slash + 1);
+            builder.appendff(" {}:{}", filename, frame.line.value());
+        }
+    }
+    if (!builder.is_empty())
+        return MUST(builder.to_string());
+#endif
+
+    return MUST(String::formatted("{:p}", return_address));
+}
+
+JsonObject AllocationProfiler::dump() const
+{
+    struct SiteAndCount {
+        AllocationSite const* site { nullptr };
+        u64 sample_count { 0 };
+    };
+    Vector<SiteAndCount> sites;
+    sites.ensure_capacity(m_sites.size());
+    for (auto const& it : m_sites)
+        sites.unchecked_append({ &it.key, it.value.sample_count });
+
+    quick_sort(sites, [](auto const& left, auto const& right) {
+        if (left.sample_count != right.sample_count)
+            return left.sample_count > right.sample_count;
+        return left.site->class_name < right.site->class_name;
+    });
+
+    JsonArray sites_array;
+    for (auto const& [site, sample_count] : sites) {
+        JsonObject site_object;
+        site_object.set("class_name"sv, site->class_name);
+        site_object.set("cell_size"sv, site->cell_size);
+        site_object.set("stack"sv, site->stack.is_empty() ? describe_return_address(site->return_address) : site->stack);
+        site_object.set("is_native"sv, site->stack.is_empty());
+        site_object.set("samples"sv, sample_count);
+        site_object.set("estimated_bytes"sv, sample_count * m_sample_interval);
+        sites_array.must_append(move(site_object));
+    }
+
+    JsonArray timeline_array;
+    for (auto const& point : m_timeline) {
+        JsonObject point_object;
+        point_object.set("time_ms"sv, point.time.to_milliseconds());
+        point_object.set("allocated_bytes"sv, point.allocated_bytes);
+        if (point.live_bytes.has_value())
+            point_object.set("live_bytes"sv, *point.live_bytes);
+        timeline_array.must_append(move(point_object));
+    }
+
+    JsonObject profile;
+    profile.set("sample_interval"sv, m_sample_interval);
+    profile.set("sites"sv, move(sites_array));
+    profile.set("timeline"sv, move(timeline_array));
+    return profile;
+}
+
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibGC/Export.h>
+#include <LibGC/Forward.h>
+
+namespace GC {
+
+struct AllocationSite {
+    StringView class_name;
+    size_t cell_size { 0 };
+
+    // Either the embedder's description of where the allocation came from (e.g. the JavaScript stack), or, if it has
+    // none, the address that the C++ call to Heap::allocate() returns to.
+    String stack;
+    FlatPtr return_address { 0 };
+
+    bool operator==(AllocationSite const&) const = default;
+};
+
+}
+
+template<>
+struct AK::Traits<GC::AllocationSite> : public AK::DefaultTraits<GC::AllocationSite> {
+    static unsigned hash(GC::AllocationSite const& site)
+    {
+        auto hash = pair_int_hash(site.class_name.hash(), ptr_hash(site.return_address));
+        return pair_int_hash(hash, site.stack.hash());
+    }
+};
+
+namespace GC {
+
+// Optional allocation telemetry for finding out which code is behind a large heap, without rebuilding with a sanitizer.
+//
+// Once a sample interval has been set (e.g. with LIBGC_ALLOCATION_SAMPLE_INTERVAL=<bytes>), one cell allocation is
+// sampled every that many bytes, and attributed to its allocation site. Each sample stands for the interval's worth of
+// allocations. The profiler also keeps a timeline of how many bytes have been allocated in total, and how many were
+// live after each collection. While disabled, deciding whether to sample is a single comparison.
+class GC_API AllocationProfiler {
+    AK_MAKE_NONCOPYABLE(AllocationProfiler);
+    AK_MAKE_NONMOVABLE(AllocationProfiler);
+
+public:
+    AllocationProfiler();
+
+    bool is_enabled() const { return m_sample_interval > 0; }
+    size_t sample_interval() const { return m_sample_interval; }
+
+    // Passing 0 disables sampling.
+    void set_sample_interval(size_t bytes);
+
+    // Forgets every sample and the timeline, and restarts the clock of the timeline.
+    void reset();
+
+    // Describes the allocation site from the embedder's point of view. Must not allocate GC cells.
+    void set_site_provider(Function<String()> provider) { m_site_provider = move(provider); }
+
+    ALWAYS_INLINE bool should_sample(size_t size)
+    {
+        if (!is_enabled()) [[likely]]
+            return false;
+        if (size < m_bytes_until_next_sample) {
+            m_bytes_until_next_sample -= size;
+            return false;
+        }
+        m_bytes_until_next_sample = m_sample_interval;
+        return true;
+    }
+
+    void record_sample(CellAllocator const&, FlatPtr caller_address, u64 total_allocated_bytes);
+    void did_collect_garbage(u64 total_allocated_bytes, size_t live_bytes);
+
+    JsonObject dump() const;
+
+private:
+    struct SiteStatistics {
+        u64 sample_count { 0 };
+    };
+
+    struct TimelinePoint {
+        AK::Duration time;
+        u64 allocated_bytes { 0 };
+        Optional<size_t> live_bytes;
+    };
+
+    void append_timeline_point(TimelinePoint);
+
+    size_t m_sample_interval { 0 };
+    size_t m_bytes_until_next_sample { 0 };
+    bool m_is_recording_sample { false };
+
+    Function<String()> m_site_provider;
+    HashMap<AllocationSite, SiteStatistics> m_sites;
+
+    MonotonicTime m_start_time { MonotonicTime::now() };
+    Vector<TimelinePoint> m_timeline;
+};
+
+}
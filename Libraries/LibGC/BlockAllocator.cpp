@@ -259,6 +259,26 @@ void BlockAllocator::wake_decommit_worker_async()
     DecommitWorker::the().kick();
 }
 
+size_t BlockAllocator::decommit_freed_blocks()
+{
+    Vector<void*> to_process;
+    {
+        Sync::MutexLocker locker(m_mutex);
+        to_process = move(m_freshly_freed);
+    }
+
+    for (auto* slot : to_process)
+        madvise_block_for_decommit(slot);
+
+    {
+        Sync::MutexLocker locker(m_mutex);
+        for (auto* slot : to_process)
+            m_blocks.append(slot);
+    }
+
+    return to_process.size() * HeapBlock::BLOCK_SIZE;
+}
+
 BlockAllocator::BlockAllocator()
     : m_worker_cv(m_mutex)
 {
@@ -38,6 +38,10 @@ public:
     // work that's piled up. Call this at the end of a GC sweep.
     static void wake_decommit_worker_async();
 
+    // Decommit every freed slot right away, rather than waiting for the
+    // decommit worker. Returns the number of bytes handed back to the kernel.
+    size_t decommit_freed_blocks();
+
 private:
     friend class DecommitWorker;
 
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/Badge.h>
 #include <AK/BinarySearch.h>
 #include <AK/Checked.h>
@@ -337,6 +338,11 @@ void Heap::will_allocate(size_t size)
         start_idle_gc_timer();
 }
 
+void Heap::record_allocation_sample(CellAllocator const& allocator, FlatPtr caller_address)
+{
+    m_allocation_profiler.record_sample(allocator, caller_address, m_total_allocated_bytes);
+}
+
 void Heap::did_allocate_external_memory(size_t size)
 {
     will_allocate(size);
@@ -357,6 +363,8 @@ void Heap::update_gc_bytes_threshold(size_t live_cell_bytes, size_t live_externa
     Checked<size_t> live_bytes = live_cell_bytes;
     live_bytes += live_external_bytes;
 
+    m_allocation_profiler.did_collect_garbage(m_total_allocated_bytes, live_bytes.has_overflow() ? NumericLimits<size_t>::max() : live_bytes.value());
+
     if (live_bytes.has_overflow()) {
         m_gc_bytes_threshold = NumericLimits<size_t>::max();
         return;
@@ -578,9 +586,77 @@ AK::JsonObject Heap::dump_graph()
         graph.set("stack_frames"sv, move(stack_frames_array));
     }
 
+    if (m_allocation_profiler.is_enabled())
+        graph.set("allocation_profile"sv, dump_allocation_profile());
+
     return graph;
 }
 
+// Buckets blocks by the percentage of their cells that are live, in steps of 10%. The last bucket only holds full
+// blocks, so that nearly-full blocks can be told apart from full ones.
+static constexpr size_t OCCUPANCY_HISTOGRAM_BUCKETS = 11;
+
+size_t Heap::release_free_memory(CollectGarbage collect)
+{
+    if (collect == CollectGarbage::Yes)
+        collect_garbage();
+
+    // Blocks only return to the block allocator once they have been swept, so don't leave any for the timer.
+    finish_pending_incremental_sweep();
+
+    return CellAllocator::shared_block_allocator().decommit_freed_blocks();
+}
+
+AK::JsonObject Heap::dump_allocation_profile()
+{
+    finish_pending_incremental_sweep();
+
+    auto profile = m_allocation_profiler.dump();
+
+    AK::JsonArray allocators_array;
+    for (auto& allocator : m_all_cell_allocators) {
+        size_t block_count = 0;
+        size_t live_cells = 0;
+        size_t total_cells = 0;
+        Array<size_t, OCCUPANCY_HISTOGRAM_BUCKETS> occupancy_histogram {};
+
+        allocator.for_each_block([&](HeapBlock& block) {
+            size_t block_live_cells = 0;
+            block.for_each_cell_in_state<Cell::State::Live>([&](auto*) {
+                ++block_live_cells;
+            });
+
+            ++block_count;
+            live_cells += block_live_cells;
+            total_cells += block.cell_count();
+            ++occupancy_histogram[block_live_cells * (OCCUPANCY_HISTOGRAM_BUCKETS - 1) / block.cell_count()];
+            return IterationDecision::Continue;
+        });
+
+        if (block_count == 0)
+            continue;
+
+        AK::JsonArray histogram_array;
+        for (auto count : occupancy_histogram)
+            histogram_array.must_append(count);
+
+        AK::JsonObject allocator_object;
+        allocator_object.set("class_name"sv, allocator.class_name().value_or("generic"sv));
+        allocator_object.set("cell_size"sv, allocator.cell_size());
+        allocator_object.set("block_count"sv, block_count);
+        allocator_object.set("live_cells"sv, live_cells);
+        allocator_object.set("total_cells"sv, total_cells);
+        allocator_object.set("committed_bytes"sv, block_count * HeapBlock::BLOCK_SIZE);
+        allocator_object.set("wasted_bytes"sv, (total_cells - live_cells) * allocator.cell_size());
+        allocator_object.set("occupancy_histogram"sv, move(histogram_array));
+        allocators_array.must_append(move(allocator_object));
+    }
+
+    profile.set("allocators"sv, move(allocators_array));
+    profile.set("total_allocated_bytes"sv, m_total_allocated_bytes);
+    return profile;
+}
+
 void Heap::run_post_mark_phases(bool report)
 {
     {
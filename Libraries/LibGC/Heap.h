@@ -17,6 +17,7 @@
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
+#include <LibGC/AllocationProfiler.h>
 #include <LibGC/Cell.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/ConservativeHashMap.h>
@@ -85,6 +86,19 @@ public:
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
     AK::JsonObject dump_graph();
 
+    // Sweeps every block and hands the freed blocks back to the kernel right away. With CollectGarbage::Yes, a full
+    // garbage collection runs first. Returns the number of bytes that were decommitted.
+    enum class CollectGarbage {
+        No,
+        Yes,
+    };
+    size_t release_free_memory(CollectGarbage);
+
+    AllocationProfiler& allocation_profiler() { return m_allocation_profiler; }
+
+    // The allocation profile, along with how fragmented the blocks of each cell allocator are.
+    AK::JsonObject dump_allocation_profile();
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     // This is true for any CollectEverything cycle, not only heap teardown.
     bool is_collecting_everything() const { return m_collecting_garbage && m_current_collection_type == CollectionType::CollectEverything; }
@@ -150,18 +164,23 @@ private:
 
     void dump_allocators();
 
+    // NB: Always inlined into allocate(), so that a sample can be attributed to the code that called allocate().
     template<typename T>
-    Cell* allocate_cell()
+    ALWAYS_INLINE Cell* allocate_cell()
     {
         static_assert(requires { T::cell_allocator.for_heap(*this).allocate_cell(*this); }, "GC cell type must declare its own allocator using GC_DECLARE_ALLOCATOR(ClassName)");
         static_assert(IsSame<T, typename decltype(T::cell_allocator)::CellType>,
             "GC cell allocator type mismatch");
 
         will_allocate(sizeof(T));
-        return T::cell_allocator.for_heap(*this).allocate_cell(*this);
+        auto& allocator = T::cell_allocator.for_heap(*this);
+        if (m_allocation_profiler.should_sample(sizeof(T))) [[unlikely]]
+            record_allocation_sample(allocator, reinterpret_cast<FlatPtr>(__builtin_return_address(0)));
+        return allocator.allocate_cell(*this);
     }
 
     void will_allocate(size_t);
+    void record_allocation_sample(CellAllocator const&, FlatPtr caller_address);
     void update_gc_bytes_threshold(size_t live_cell_bytes, size_t live_external_bytes);
 
     enum class IncludeIncomingCrossHeapMembers {
@@ -248,6 +267,8 @@ private:
     RefPtr<Core::Timer> m_idle_gc_timer;
     u64 m_total_allocated_bytes { 0 };
     IdleCollectionPolicy m_idle_collection_policy;
+
+    AllocationProfiler m_allocation_profiler;
 };
 
 inline void Heap::did_create_root(Badge<RootImpl>, RootImpl& impl)
@@ -12,6 +12,7 @@
 #include <AK/Utf16String.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
+#include <LibGfx/Font/ShapingCache.h>
 #include <LibGfx/Font/TypefaceSkia.h>
 #include <LibGfx/TextLayout.h>
 
@@ -200,13 +201,14 @@ SkFont Font::skia_font(float scale) const
     return sk_font;
 }
 
-Font::ShapingCache::~ShapingCache() = default;
+Font::ShapingCache::~ShapingCache()
+{
+    clear();
+}
 
 void Font::ShapingCache::clear()
 {
-    map.clear();
-    for (auto& slot : single_ascii_character_map)
-        slot = nullptr;
+    GlobalShapingCache::the().remove_entries_of(*this);
 }
 
 static bool hb_face_has_table(hb_face_t* face, hb_tag_t tag)
@@ -254,6 +256,65 @@ bool Font::is_emoji_font() const
     return m_is_emoji_font == TriState::True;
 }
 
+static bool lookups_involve_glyph(hb_face_t* face, hb_tag_t table_tag, hb_codepoint_t glyph)
+{
+    auto* lookup_indices = hb_set_create();
+    hb_ot_layout_collect_lookups(face, table_tag, nullptr, nullptr, nullptr, lookup_indices);
+
+    auto* glyphs_before = hb_set_create();
+    auto* glyphs_input = hb_set_create();
+    auto* glyphs_after = hb_set_create();
+    auto* glyphs_output = hb_set_create();
+
+    bool involves_glyph = false;
+    hb_codepoint_t lookup_index = HB_SET_VALUE_INVALID;
+    while (!involves_glyph && hb_set_next(lookup_indices, &lookup_index)) {
+        hb_set_clear(glyphs_before);
+        hb_set_clear(glyphs_input);
+        hb_set_clear(glyphs_after);
+        hb_set_clear(glyphs_output);
+        hb_ot_layout_lookup_collect_glyphs(face, table_tag, lookup_index, glyphs_before, glyphs_input, glyphs_after, glyphs_output);
+        involves_glyph = hb_set_has(glyphs_before, glyph)
+            || hb_set_has(glyphs_input, glyph)
+            || hb_set_has(glyphs_after, glyph)
+            || hb_set_has(glyphs_output, glyph);
+    }
+
+    hb_set_destroy(glyphs_output);
+    hb_set_destroy(glyphs_after);
+    hb_set_destroy(glyphs_input);
+    hb_set_destroy(glyphs_before);
+    hb_set_destroy(lookup_indices);
+    return involves_glyph;
+}
+
+bool Font::has_space_in_ligatures_or_kerning() const
+{
+    if (m_has_space_in_ligatures_or_kerning == TriState::Unknown) {
+        auto* hb_font = harfbuzz_font();
+        hb_face_t* face = hb_font_get_face(hb_font);
+
+        auto has_space = [&] {
+            hb_codepoint_t space_glyph_id = 0;
+            if (!hb_font_get_nominal_glyph(hb_font, ' ', &space_glyph_id))
+                return true;
+
+            // NOTE: Legacy kerning and AAT tables can't be inspected per glyph, so assume the worst for them.
+            if (hb_face_has_table(face, HB_TAG('k', 'e', 'r', 'n'))
+                || hb_face_has_table(face, HB_TAG('k', 'e', 'r', 'x'))
+                || hb_face_has_table(face, HB_TAG('m', 'o', 'r', 'x')))
+                return true;
+
+            return lookups_involve_glyph(face, HB_OT_TAG_GSUB, space_glyph_id)
+                || lookups_involve_glyph(face, HB_OT_TAG_GPOS, space_glyph_id);
+        }();
+
+        m_has_space_in_ligatures_or_kerning = has_space ? TriState::True : TriState::False;
+    }
+
+    return m_has_space_in_ligatures_or_kerning == TriState::True;
+}
+
 }
 
 extern "C" float ladybird_gfx_font_glyph_width(void const* font, u32 code_point)
@@ -13,6 +13,7 @@
 #include <AK/FlyString.h>
 #include <AK/HashMap.h>
 #include <AK/Optional.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
 #include <AK/Utf16String.h>
@@ -27,6 +28,7 @@ struct hb_buffer_t;
 namespace Gfx {
 
 struct ShapedGlyphs;
+struct ShapingCacheEntry;
 
 struct ShapingCacheKey {
     Utf16String text;
@@ -106,9 +108,10 @@ public:
     FontVariationSettings const& variation_settings() const { return m_font_variation_settings; }
     ShapeFeatures const& features() const { return m_shape_features; }
 
+    // Entries are owned here but bounded and evicted by GlobalShapingCache, which must be locked to access them.
     struct ShapingCache {
-        HashMap<ShapingCacheKey, OwnPtr<ShapedGlyphs>> map;
-        OwnPtr<ShapedGlyphs> single_ascii_character_map[128];
+        HashMap<ShapingCacheKey, NonnullOwnPtr<ShapingCacheEntry>> map;
+        RefPtr<ShapedGlyphs const> single_ascii_character_map[128];
 
         ~ShapingCache();
         void clear();
@@ -117,6 +120,10 @@ public:
 
     bool is_emoji_font() const;
 
+    // Whether any GSUB/GPOS lookup (or a legacy kerning table) can involve the space glyph. If not, text can be
+    // shaped word by word and the results concatenated without changing the output.
+    bool has_space_in_ligatures_or_kerning() const;
+
 private:
     u64 m_id { 0 };
 
@@ -136,6 +143,7 @@ private:
     mutable ShapingCache m_shaping_cache;
 
     mutable TriState m_is_emoji_font { TriState::Unknown };
+    mutable TriState m_has_space_in_ligatures_or_kerning { TriState::Unknown };
 
     NonnullRefPtr<Typeface const> m_typeface;
     float m_point_width { 0.0f };
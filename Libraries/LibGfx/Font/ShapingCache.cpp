@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashFunctions.h>
+#include <LibGfx/Font/ShapingCache.h>
+
+namespace Gfx {
+
+ShapingCacheEntry::ShapingCacheEntry(Font::ShapingCache& owner, ShapingCacheKey key, NonnullRefPtr<ShapedGlyphs const> shape)
+    : owner(owner)
+    , key(move(key))
+    , shape(move(shape))
+{
+    byte_size = sizeof(ShapingCacheEntry) + this->key.text.length_in_code_units() * sizeof(char16_t) + this->shape->byte_size();
+}
+
+GlobalShapingCache& GlobalShapingCache::the()
+{
+    // NOTE: This is leaked on purpose, since fonts may outlive static destructors and still need to remove their entries.
+    static GlobalShapingCache& cache = *new GlobalShapingCache;
+    return cache;
+}
+
+RefPtr<ShapedGlyphs const> GlobalShapingCache::find(Font const& font, Utf16View const& text, u8 text_type, u32 letter_spacing_bit_pattern, u32 word_spacing_bit_pattern, bool is_segment)
+{
+    auto key_hash = pair_int_hash(text.hash(), pair_int_hash(text_type, pair_int_hash(letter_spacing_bit_pattern, word_spacing_bit_pattern)));
+
+    Sync::MutexLocker locker(m_lock);
+    auto& map = font.shaping_cache().map;
+    auto it = map.find(key_hash, [&](auto const& candidate) {
+        return candidate.key.text_type == text_type
+            && candidate.key.letter_spacing_bit_pattern == letter_spacing_bit_pattern
+            && candidate.key.word_spacing_bit_pattern == word_spacing_bit_pattern
+            && candidate.key.text == text;
+    });
+
+    if (it == map.end()) {
+        ++(is_segment ? m_statistics.segment_misses : m_statistics.misses);
+        return nullptr;
+    }
+
+    ++(is_segment ? m_statistics.segment_hits : m_statistics.hits);
+
+    // Move the entry to the most recently used end of the list.
+    m_lru_list.append(*it->value);
+    return it->value->shape;
+}
+
+void GlobalShapingCache::insert(Font const& font, ShapingCacheKey key, NonnullRefPtr<ShapedGlyphs const> shape)
+{
+    Sync::MutexLocker locker(m_lock);
+    auto& owner = font.shaping_cache();
+
+    // Another thread may have shaped the same text while we were not holding the lock.
+    if (owner.map.contains(key))
+        return;
+
+    auto entry = make<ShapingCacheEntry>(owner, key, move(shape));
+    m_statistics.byte_size += entry->byte_size;
+    ++m_statistics.entry_count;
+    m_lru_list.append(*entry);
+    owner.map.set(move(key), move(entry));
+
+    evict_until_within_budget();
+}
+
+RefPtr<ShapedGlyphs const> GlobalShapingCache::find_single_ascii_character(Font const& font, u16 code_unit)
+{
+    VERIFY(code_unit < 128);
+
+    Sync::MutexLocker locker(m_lock);
+    auto shape = font.shaping_cache().single_ascii_character_map[code_unit];
+    ++(shape ? m_statistics.hits : m_statistics.misses);
+    return shape;
+}
+
+void GlobalShapingCache::insert_single_ascii_character(Font const& font, u16 code_unit, NonnullRefPtr<ShapedGlyphs const> shape)
+{
+    VERIFY(code_unit < 128);
+
+    // NOTE: These slots are bounded to 128 per font, so they are not part of the LRU list.
+    Sync::MutexLocker locker(m_lock);
+    font.shaping_cache().single_ascii_character_map[code_unit] = move(shape);
+}
+
+void GlobalShapingCache::remove_entries_of(Font::ShapingCache& shaping_cache)
+{
+    Sync::MutexLocker locker(m_lock);
+    for (auto& it : shaping_cache.map) {
+        m_statistics.byte_size -= it.value->byte_size;
+        --m_statistics.entry_count;
+        m_lru_list.remove(*it.value);
+    }
+    shaping_cache.map.clear();
+
+    for (auto& slot : shaping_cache.single_ascii_character_map)
+        slot = nullptr;
+}
+
+size_t GlobalShapingCache::purge(size_t remaining_byte_size)
+{
+    Sync::MutexLocker locker(m_lock);
+    auto byte_size_before = m_statistics.byte_size;
+    while (m_statistics.byte_size > remaining_byte_size && !m_lru_list.is_empty())
+        remove_entry(*m_lru_list.first());
+    return byte_size_before - m_statistics.byte_size;
+}
+
+void GlobalShapingCache::set_byte_budget(size_t byte_budget)
+{
+    Sync::MutexLocker locker(m_lock);
+    m_byte_budget = byte_budget;
+    evict_until_within_budget();
+}
+
+ShapingCacheStatistics GlobalShapingCache::statistics() const
+{
+    Sync::MutexLocker locker(m_lock);
+    auto statistics = m_statistics;
+    statistics.byte_budget = m_byte_budget;
+    return statistics;
+}
+
+void GlobalShapingCache::evict_until_within_budget()
+{
+    while (m_statistics.byte_size > m_byte_budget && !m_lru_list.is_empty()) {
+        remove_entry(*m_lru_list.first());
+        ++m_statistics.evictions;
+    }
+}
+
+void GlobalShapingCache::remove_entry(ShapingCacheEntry& entry)
+{
+    m_statistics.byte_size -= entry.byte_size;
+    --m_statistics.entry_count;
+    m_lru_list.remove(entry);
+
+    // NOTE: This destroys the entry, so the key has to outlive it.
+    auto key = entry.key;
+    entry.owner.map.remove(key);
+}
+
+}
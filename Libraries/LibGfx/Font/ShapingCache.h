@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/IntrusiveList.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefPtr.h>
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/TextLayout.h>
+#include <LibSync/Mutex.h>
+
+namespace Gfx {
+
+struct ShapingCacheEntry {
+    ShapingCacheEntry(Font::ShapingCache& owner, ShapingCacheKey key, NonnullRefPtr<ShapedGlyphs const> shape);
+
+    Font::ShapingCache& owner;
+    ShapingCacheKey key;
+    NonnullRefPtr<ShapedGlyphs const> shape;
+    size_t byte_size { 0 };
+
+    IntrusiveListNode<ShapingCacheEntry> lru_list_node;
+    using List = IntrusiveList<&ShapingCacheEntry::lru_list_node>;
+};
+
+struct ShapingCacheStatistics {
+    u64 hits { 0 };
+    u64 misses { 0 };
+    u64 segment_hits { 0 };
+    u64 segment_misses { 0 };
+    u64 evictions { 0 };
+    size_t entry_count { 0 };
+    size_t byte_size { 0 };
+    size_t byte_budget { 0 };
+};
+
+// Keeps the shaping results of every font in a single least-recently-used order, and evicts the oldest entries once
+// their combined size exceeds the byte budget. The entries themselves still live in each font's own map, so lookups
+// only ever hash against one font's strings.
+class GlobalShapingCache {
+public:
+    static constexpr size_t default_byte_budget = 8 * MiB;
+
+    static GlobalShapingCache& the();
+
+    RefPtr<ShapedGlyphs const> find(Font const&, Utf16View const&, u8 text_type, u32 letter_spacing_bit_pattern, u32 word_spacing_bit_pattern, bool is_segment);
+    void insert(Font const&, ShapingCacheKey, NonnullRefPtr<ShapedGlyphs const>);
+
+    RefPtr<ShapedGlyphs const> find_single_ascii_character(Font const&, u16 code_unit);
+    void insert_single_ascii_character(Font const&, u16 code_unit, NonnullRefPtr<ShapedGlyphs const>);
+
+    void remove_entries_of(Font::ShapingCache&);
+
+    // Evicts the least recently used entries until at most remaining_byte_size bytes are left. Returns the number of
+    // bytes released.
+    size_t purge(size_t remaining_byte_size = 0);
+
+    void set_byte_budget(size_t);
+    ShapingCacheStatistics statistics() const;
+
+private:
+    GlobalShapingCache() = default;
+
+    void evict_until_within_budget();
+    void remove_entry(ShapingCacheEntry&);
+
+    mutable Sync::Mutex m_lock;
+    ShapingCacheEntry::List m_lru_list;
+    size_t m_byte_budget { default_byte_budget };
+    ShapingCacheStatistics m_statistics;
+};
+
+}
@@ -103,7 +103,7 @@ struct [[gnu::packed]] TableRecord {
 };
 static_assert(AssertSize<TableRecord, 16>());
 
-ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes buffer, unsigned int index)
+ErrorOr<Core::AnonymousBuffer> convert_to_ttf(ReadonlyBytes buffer)
 {
     FixedMemoryStream stream(buffer);
     auto header = TRY(stream.read_value<Header>());
@@ -188,7 +188,12 @@ ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes buffer,
     if (header.total_sfnt_size != expected_total_sfnt_size)
         return Error::from_string_literal("Invalid WOFF total sfnt size");
 
-    return TRY(Gfx::Typeface::try_load_from_anonymous_buffer(move(font_buffer), index));
+    return font_buffer;
+}
+
+ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes bytes, unsigned int index)
+{
+    return Gfx::Typeface::try_load_from_anonymous_buffer(TRY(convert_to_ttf(bytes)), index);
 }
 
 }
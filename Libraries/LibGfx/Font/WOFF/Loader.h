@@ -13,6 +13,7 @@
 
 namespace WOFF {
 
+ErrorOr<Core::AnonymousBuffer> convert_to_ttf(ReadonlyBytes);
 ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_resource(Core::Resource const&, unsigned index = 0);
 ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes bytes, unsigned index = 0);
 
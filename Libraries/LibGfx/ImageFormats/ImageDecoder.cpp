@@ -16,6 +16,32 @@
 
 namespace Gfx {
 
+IntSize scaled_size_covering(IntSize natural_size, Optional<IntSize> ideal_size)
+{
+    if (!ideal_size.has_value() || ideal_size->is_empty() || natural_size.is_empty())
+        return natural_size;
+
+    i64 natural_width = natural_size.width();
+    i64 natural_height = natural_size.height();
+    i64 ideal_width = ideal_size->width();
+    i64 ideal_height = ideal_size->height();
+
+    // Whichever dimension needs the larger scale factor decides the size, and the other one is rounded up.
+    i64 width = 0;
+    i64 height = 0;
+    if (ideal_width * natural_height >= ideal_height * natural_width) {
+        width = ideal_width;
+        height = (natural_height * ideal_width + natural_width - 1) / natural_width;
+    } else {
+        height = ideal_height;
+        width = (natural_width * ideal_height + natural_height - 1) / natural_height;
+    }
+
+    if (width >= natural_width || height >= natural_height)
+        return natural_size;
+    return { static_cast<int>(max(width, 1)), static_cast<int>(max(height, 1)) };
+}
+
 static ErrorOr<OwnPtr<ImageDecoderPlugin>> probe_and_sniff_for_appropriate_plugin(ReadonlyBytes bytes)
 {
     struct ImagePluginInitializer {
@@ -43,6 +69,33 @@ static ErrorOr<OwnPtr<ImageDecoderPlugin>> probe_and_sniff_for_appropriate_plugi
     return OwnPtr<ImageDecoderPlugin> {};
 }
 
+ErrorOr<OwnPtr<ProgressiveImageDecoder>> ProgressiveImageDecoder::try_create(ReadonlyBytes initial_bytes, Optional<IntSize> ideal_size)
+{
+    if (JPEGImageDecoderPlugin::sniff(initial_bytes))
+        return TRY(JPEGProgressiveDecoder::create(ideal_size));
+    if (PNGImageDecoderPlugin::sniff(initial_bytes))
+        return TRY(PNGProgressiveDecoder::create(ideal_size));
+    if (WebPProgressiveDecoder::sniff(initial_bytes))
+        return TRY(WebPProgressiveDecoder::create(ideal_size));
+    return OwnPtr<ProgressiveImageDecoder> {};
+}
+
+bool ProgressiveImageDecoder::can_decode_mime_type(StringView mime_type)
+{
+    return mime_type.is_one_of("image/jpeg"sv, "image/png"sv, "image/webp"sv);
+}
+
+ErrorOr<NonnullRefPtr<Bitmap>> ProgressiveImageDecoder::take_snapshot()
+{
+    if (!m_bitmap)
+        return Error::from_string_literal("Nothing has been decoded yet");
+
+    auto snapshot = TRY(m_bitmap->clone());
+    snapshot->set_alpha_type_destructive(AlphaType::Premultiplied);
+    m_has_new_pixels = false;
+    return snapshot;
+}
+
 ErrorOr<ColorSpace> ImageDecoder::color_space()
 {
     auto maybe_cicp = TRY(m_plugin->cicp());
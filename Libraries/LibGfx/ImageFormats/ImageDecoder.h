@@ -59,6 +59,10 @@ enum class NaturalFrameFormat {
     Vector,
 };
 
+// Returns the smallest size with the aspect ratio of natural_size that is at least ideal_size in both dimensions, or
+// natural_size itself if that would not be any smaller.
+IntSize scaled_size_covering(IntSize natural_size, Optional<IntSize> ideal_size);
+
 class ImageDecoderPlugin {
 public:
     virtual ~ImageDecoderPlugin() = default;
@@ -81,6 +85,8 @@ public:
     virtual size_t frame_count() { return 1; }
     virtual size_t first_animated_frame_index() { return 0; }
 
+    // The ideal size is a hint: plugins that can decode directly to a smaller size may return the smallest bitmap that
+    // still covers it (see scaled_size_covering()). size() keeps reporting the natural size either way.
     virtual ErrorOr<ImageFrameDescriptor> frame(size_t index, Optional<IntSize> ideal_size = {}) = 0;
 
     // Returns the duration of a frame in milliseconds without decoding pixel data.
@@ -104,6 +110,46 @@ protected:
     ImageDecoderPlugin() = default;
 };
 
+// Decodes a still image whose encoded data arrives in chunks, so that a partially received image can be shown while
+// the rest is still loading. Only formats with an incremental decoder (JPEG, PNG and WebP) are supported; everything
+// else has to wait for the complete data and go through ImageDecoder.
+class ProgressiveImageDecoder {
+public:
+    static constexpr size_t minimum_bytes_for_sniffing = 12;
+
+    // Returns null if the format of the data can't be decoded progressively.
+    static ErrorOr<OwnPtr<ProgressiveImageDecoder>> try_create(ReadonlyBytes initial_bytes, Optional<IntSize> ideal_size = {});
+
+    // Whether images of this MIME type may be decoded progressively. Others, such as GIF or AVIF, are not worth
+    // sending to the decoder before all of their data has arrived.
+    static bool can_decode_mime_type(StringView);
+
+    virtual ~ProgressiveImageDecoder() = default;
+
+    // Decodes as much as possible of the data received so far, including the given chunk.
+    virtual ErrorOr<void> append(ReadonlyBytes) = 0;
+
+    // Whether any pixels were decoded since the last snapshot.
+    bool has_new_pixels() const { return m_has_new_pixels; }
+
+    // The size of the image itself, once its header has been decoded. Snapshots are smaller if an ideal size was given.
+    IntSize natural_size() const { return m_natural_size; }
+
+    // Returns a premultiplied copy of everything decoded so far. Parts that haven't been received are transparent.
+    ErrorOr<NonnullRefPtr<Bitmap>> take_snapshot();
+
+protected:
+    ProgressiveImageDecoder() = default;
+
+    void did_decode_pixels() { m_has_new_pixels = true; }
+
+    RefPtr<Bitmap> m_bitmap;
+    IntSize m_natural_size;
+
+private:
+    bool m_has_new_pixels { false };
+};
+
 class ImageDecoder : public RefCounted<ImageDecoder> {
 public:
     static ErrorOr<RefPtr<ImageDecoder>> try_create_for_raw_bytes(ReadonlyBytes, Optional<ByteString> mime_type = {});
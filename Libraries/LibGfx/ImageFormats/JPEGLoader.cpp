@@ -15,11 +15,15 @@ struct JPEGLoadingContext {
     enum class State {
         NotDecoded,
         Error,
+        HeaderDecoded,
         Decoded,
     };
 
     State state { State::NotDecoded };
 
+    IntSize natural_size;
+    bool is_cmyk { false };
+
     RefPtr<Gfx::Bitmap> rgb_bitmap;
     RefPtr<Gfx::CMYKBitmap> cmyk_bitmap;
 
@@ -31,26 +35,18 @@ struct JPEGLoadingContext {
     {
     }
 
-    ErrorOr<void> decode();
+    ErrorOr<void> decode_header();
+    ErrorOr<void> decode(Optional<IntSize> ideal_size);
 };
 
 struct JPEGErrorManager : jpeg_error_mgr {
     jmp_buf setjmp_buffer {};
 };
 
-ErrorOr<void> JPEGLoadingContext::decode()
+// NOTE: The caller must have called setjmp() on the error manager's buffer before this, as libjpeg reports errors by
+//       calling error_exit(), which longjmp()s back into it.
+static void create_decompress(jpeg_decompress_struct& cinfo, JPEGErrorManager& jerr, jpeg_source_mgr& source_manager, ReadonlyBytes data)
 {
-    struct jpeg_decompress_struct cinfo;
-    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
-
-    struct JPEGErrorManager jerr;
-    cinfo.err = jpeg_std_error(&jerr);
-
-    jpeg_source_mgr source_manager {};
-
-    if (setjmp(jerr.setjmp_buffer))
-        return Error::from_string_literal("Failed to decode JPEG");
-
     jerr.error_exit = [](j_common_ptr cinfo) {
         char buffer[JMSG_LENGTH_MAX];
         (*cinfo->err->format_message)(cinfo, buffer);
@@ -78,9 +74,78 @@ ErrorOr<void> JPEGLoadingContext::decode()
     cinfo.src = &source_manager;
 
     jpeg_save_markers(&cinfo, JPEG_APP0 + 2, 0xFFFF);
+}
+
+// Lets libjpeg scale in the DCT domain to the smallest output (in eighths of the natural size) that still covers the
+// ideal size, which skips most of the IDCT work and never allocates the full-size bitmap.
+static void set_output_scale_for_ideal_size(jpeg_decompress_struct& cinfo, Optional<IntSize> ideal_size)
+{
+    if (!ideal_size.has_value() || ideal_size->is_empty())
+        return;
+
+    cinfo.scale_denom = 8;
+    for (unsigned int scale_num = 1; scale_num <= 8; ++scale_num) {
+        cinfo.scale_num = scale_num;
+        jpeg_calc_output_dimensions(&cinfo);
+        if (cinfo.output_width >= static_cast<unsigned int>(ideal_size->width()) && cinfo.output_height >= static_cast<unsigned int>(ideal_size->height()))
+            break;
+    }
+}
+
+// Reads only the header, so that the natural size, color format and ICC profile are known before choosing an output
+// size for the actual decode.
+ErrorOr<void> JPEGLoadingContext::decode_header()
+{
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
+
+    struct JPEGErrorManager jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+
+    jpeg_source_mgr source_manager {};
+
+    if (setjmp(jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to decode JPEG header");
+
+    create_decompress(cinfo, jerr, source_manager, data);
+
     if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
         return Error::from_string_literal("Failed to read JPEG header");
 
+    natural_size = { static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height) };
+    is_cmyk = cinfo.jpeg_color_space == JCS_CMYK || cinfo.jpeg_color_space == JCS_YCCK;
+
+    JOCTET* icc_data_ptr = nullptr;
+    unsigned int icc_data_length = 0;
+    if (jpeg_read_icc_profile(&cinfo, &icc_data_ptr, &icc_data_length)) {
+        icc_data.resize(icc_data_length);
+        memcpy(icc_data.data(), icc_data_ptr, icc_data_length);
+        free(icc_data_ptr);
+    }
+
+    return {};
+}
+
+ErrorOr<void> JPEGLoadingContext::decode(Optional<IntSize> ideal_size)
+{
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
+
+    struct JPEGErrorManager jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+
+    jpeg_source_mgr source_manager {};
+
+    if (setjmp(jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to decode JPEG");
+
+    create_decompress(cinfo, jerr, source_manager, data);
+
+    if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
+        return Error::from_string_literal("Failed to read JPEG header");
+
+    natural_size = { static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height) };
+
     if (cinfo.jpeg_color_space == JCS_CMYK) {
         cinfo.out_color_space = JCS_CMYK;
     } else if (cinfo.jpeg_color_space == JCS_YCCK) {
@@ -89,6 +154,8 @@ ErrorOr<void> JPEGLoadingContext::decode()
         cinfo.out_color_space = JCS_EXT_BGRX;
     }
 
+    set_output_scale_for_ideal_size(cinfo, ideal_size);
+
     jpeg_start_decompress(&cinfo);
     bool could_read_all_scanlines = true;
 
@@ -168,12 +235,14 @@ ErrorOr<void> JPEGLoadingContext::decode()
         }
     }
 
-    JOCTET* icc_data_ptr = nullptr;
-    unsigned int icc_data_length = 0;
-    if (jpeg_read_icc_profile(&cinfo, &icc_data_ptr, &icc_data_length)) {
-        icc_data.resize(icc_data_length);
-        memcpy(icc_data.data(), icc_data_ptr, icc_data_length);
-        free(icc_data_ptr);
+    if (icc_data.is_empty()) {
+        JOCTET* icc_data_ptr = nullptr;
+        unsigned int icc_data_length = 0;
+        if (jpeg_read_icc_profile(&cinfo, &icc_data_ptr, &icc_data_length)) {
+            icc_data.resize(icc_data_length);
+            memcpy(icc_data.data(), icc_data_ptr, icc_data_length);
+            free(icc_data_ptr);
+        }
     }
 
     if (could_read_all_scanlines)
@@ -194,18 +263,26 @@ JPEGImageDecoderPlugin::JPEGImageDecoderPlugin(NonnullOwnPtr<JPEGLoadingContext>
 
 JPEGImageDecoderPlugin::~JPEGImageDecoderPlugin() = default;
 
+static void ensure_header_decoded(JPEGLoadingContext& context)
+{
+    if (context.state != JPEGLoadingContext::State::NotDecoded)
+        return;
+
+    if (auto result = context.decode_header(); result.is_error()) {
+        context.state = JPEGLoadingContext::State::Error;
+        return;
+    }
+
+    context.state = JPEGLoadingContext::State::HeaderDecoded;
+}
+
 IntSize JPEGImageDecoderPlugin::size()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)frame(0);
+    ensure_header_decoded(*m_context);
 
     if (m_context->state == JPEGLoadingContext::State::Error)
         return {};
-    if (m_context->rgb_bitmap)
-        return m_context->rgb_bitmap->size();
-    if (m_context->cmyk_bitmap)
-        return m_context->cmyk_bitmap->size();
-    return {};
+    return m_context->natural_size;
 }
 
 bool JPEGImageDecoderPlugin::sniff(ReadonlyBytes data)
@@ -221,7 +298,7 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGImageDecoderPlugin::create(Readon
     return adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data)));
 }
 
-ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index > 0)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Invalid frame index");
@@ -230,7 +307,7 @@ ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Option
         return Error::from_string_literal("JPEGImageDecoderPlugin: Decoding failed");
 
     if (m_context->state < JPEGLoadingContext::State::Decoded) {
-        if (auto result = m_context->decode(); result.is_error()) {
+        if (auto result = m_context->decode(ideal_size); result.is_error()) {
             m_context->state = JPEGLoadingContext::State::Error;
             return result.release_error();
         }
@@ -248,8 +325,7 @@ Optional<Metadata const&> JPEGImageDecoderPlugin::metadata()
 
 ErrorOr<Optional<ReadonlyBytes>> JPEGImageDecoderPlugin::icc_data()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)frame(0);
+    ensure_header_decoded(*m_context);
 
     if (!m_context->icc_data.is_empty())
         return m_context->icc_data;
@@ -258,17 +334,16 @@ ErrorOr<Optional<ReadonlyBytes>> JPEGImageDecoderPlugin::icc_data()
 
 NaturalFrameFormat JPEGImageDecoderPlugin::natural_frame_format() const
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)const_cast<JPEGImageDecoderPlugin&>(*this).frame(0);
+    ensure_header_decoded(*m_context);
 
-    if (m_context->cmyk_bitmap)
+    if (m_context->state != JPEGLoadingContext::State::Error && m_context->is_cmyk)
         return NaturalFrameFormat::CMYK;
     return NaturalFrameFormat::RGB;
 }
 
 ErrorOr<NonnullRefPtr<CMYKBitmap>> JPEGImageDecoderPlugin::cmyk_frame()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
+    if (m_context->state < JPEGLoadingContext::State::Decoded)
         (void)frame(0);
 
     if (m_context->state == JPEGLoadingContext::State::Error)
@@ -278,4 +353,228 @@ ErrorOr<NonnullRefPtr<CMYKBitmap>> JPEGImageDecoderPlugin::cmyk_frame()
     return *m_context->cmyk_bitmap;
 }
 
+struct JPEGProgressiveDecodingContext {
+    enum class Phase {
+        Header,
+        StartDecompress,
+        SequentialScanlines,
+        StartOutputPass,
+        OutputPassScanlines,
+        FinishOutputPass,
+        Done,
+        Unsupported,
+        Error,
+    };
+
+    // A suspending data source: when it runs dry, libjpeg backs up to the last point it can resume from, and we call
+    // back into it once more data has been appended.
+    struct Source : jpeg_source_mgr {
+        JPEGProgressiveDecodingContext* context { nullptr };
+    };
+
+    JPEGProgressiveDecodingContext() = default;
+
+    ~JPEGProgressiveDecodingContext()
+    {
+        jpeg_destroy_decompress(&cinfo);
+    }
+
+    jpeg_decompress_struct cinfo {};
+    JPEGErrorManager jerr;
+    Source source;
+
+    // Everything that libjpeg has not consumed yet. Consumed bytes are dropped on the next append.
+    ByteBuffer unconsumed_data;
+    size_t bytes_to_skip { 0 };
+
+    Phase phase { Phase::Header };
+    Optional<IntSize> ideal_size;
+};
+
+JPEGProgressiveDecoder::JPEGProgressiveDecoder(NonnullOwnPtr<JPEGProgressiveDecodingContext> context)
+    : m_context(move(context))
+{
+}
+
+JPEGProgressiveDecoder::~JPEGProgressiveDecoder() = default;
+
+ErrorOr<NonnullOwnPtr<ProgressiveImageDecoder>> JPEGProgressiveDecoder::create(Optional<IntSize> ideal_size)
+{
+    auto context = TRY(try_make<JPEGProgressiveDecodingContext>());
+    context->ideal_size = ideal_size;
+
+    auto& cinfo = context->cinfo;
+    cinfo.err = jpeg_std_error(&context->jerr);
+    if (setjmp(context->jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to create JPEG decompressor");
+
+    context->jerr.error_exit = [](j_common_ptr cinfo) {
+        char buffer[JMSG_LENGTH_MAX];
+        (*cinfo->err->format_message)(cinfo, buffer);
+        dbgln("JPEG error: {}", buffer);
+        longjmp(static_cast<JPEGErrorManager*>(cinfo->err)->setjmp_buffer, 1);
+    };
+
+    jpeg_create_decompress(&cinfo);
+
+    auto& source = context->source;
+    source.context = context.ptr();
+    source.next_input_byte = nullptr;
+    source.bytes_in_buffer = 0;
+    source.init_source = [](j_decompress_ptr) { };
+    source.fill_input_buffer = [](j_decompress_ptr) -> boolean { return false; };
+    source.skip_input_data = [](j_decompress_ptr cinfo, long num_bytes) {
+        auto& source = *static_cast<JPEGProgressiveDecodingContext::Source*>(cinfo->src);
+        if (num_bytes <= 0)
+            return;
+        if (static_cast<size_t>(num_bytes) > source.bytes_in_buffer) {
+            // Remember the rest, and skip it as soon as it arrives.
+            source.context->bytes_to_skip += num_bytes - source.bytes_in_buffer;
+            source.next_input_byte += source.bytes_in_buffer;
+            source.bytes_in_buffer = 0;
+            return;
+        }
+        source.next_input_byte += num_bytes;
+        source.bytes_in_buffer -= num_bytes;
+    };
+    source.resync_to_restart = jpeg_resync_to_restart;
+    source.term_source = [](j_decompress_ptr) { };
+    cinfo.src = &source;
+
+    return adopt_nonnull_own_or_enomem(new (nothrow) JPEGProgressiveDecoder(move(context)));
+}
+
+ErrorOr<void> JPEGProgressiveDecoder::append(ReadonlyBytes bytes)
+{
+    auto& context = *m_context;
+    if (context.phase == JPEGProgressiveDecodingContext::Phase::Error)
+        return Error::from_string_literal("JPEGProgressiveDecoder: Decoding failed");
+    if (context.phase == JPEGProgressiveDecodingContext::Phase::Done || context.phase == JPEGProgressiveDecodingContext::Phase::Unsupported)
+        return {};
+
+    auto& source = context.source;
+    auto remaining = source.next_input_byte ? ReadonlyBytes { source.next_input_byte, source.bytes_in_buffer } : ReadonlyBytes {};
+
+    ByteBuffer unconsumed_data;
+    TRY(unconsumed_data.try_ensure_capacity(remaining.size() + bytes.size()));
+    unconsumed_data.append(remaining);
+    unconsumed_data.append(bytes);
+
+    auto to_skip = min(context.bytes_to_skip, unconsumed_data.size());
+    context.bytes_to_skip -= to_skip;
+
+    context.unconsumed_data = move(unconsumed_data);
+    source.next_input_byte = context.unconsumed_data.data() + to_skip;
+    source.bytes_in_buffer = context.unconsumed_data.size() - to_skip;
+
+    return decode_available_data();
+}
+
+// Returns false if libjpeg suspended before the end of the output pass.
+bool JPEGProgressiveDecoder::read_available_scanlines()
+{
+    auto& cinfo = m_context->cinfo;
+    while (cinfo.output_scanline < cinfo.output_height) {
+        auto* row_ptr = m_bitmap->scanline_u8(cinfo.output_scanline);
+        if (jpeg_read_scanlines(&cinfo, &row_ptr, 1) == 0)
+            return false;
+        if (!cinfo.buffered_image)
+            did_decode_pixels();
+    }
+    return true;
+}
+
+ErrorOr<void> JPEGProgressiveDecoder::decode_available_data()
+{
+    using Phase = JPEGProgressiveDecodingContext::Phase;
+
+    auto& context = *m_context;
+    auto& cinfo = context.cinfo;
+
+    if (setjmp(context.jerr.setjmp_buffer)) {
+        context.phase = Phase::Error;
+        return Error::from_string_literal("JPEGProgressiveDecoder: Decoding failed");
+    }
+
+    while (true) {
+        switch (context.phase) {
+        case Phase::Header:
+            if (jpeg_read_header(&cinfo, TRUE) == JPEG_SUSPENDED)
+                return {};
+
+            // FIXME: CMYK images need converting after the fact, so they are only shown once fully received.
+            if (cinfo.jpeg_color_space == JCS_CMYK || cinfo.jpeg_color_space == JCS_YCCK) {
+                context.phase = Phase::Unsupported;
+                return {};
+            }
+
+            cinfo.out_color_space = JCS_EXT_BGRA;
+            // Progressive images are decoded in buffered-image mode, where every scan received so far can be
+            // output as a complete (if blurry) image.
+            cinfo.buffered_image = jpeg_has_multiple_scans(&cinfo);
+            set_output_scale_for_ideal_size(cinfo, context.ideal_size);
+            context.phase = Phase::StartDecompress;
+            break;
+
+        case Phase::StartDecompress:
+            if (!jpeg_start_decompress(&cinfo))
+                return {};
+            m_bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Premultiplied, { static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height) }));
+            m_natural_size = { static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height) };
+            context.phase = cinfo.buffered_image ? Phase::StartOutputPass : Phase::SequentialScanlines;
+            break;
+
+        case Phase::SequentialScanlines:
+            if (!read_available_scanlines())
+                return {};
+            context.phase = Phase::Done;
+            return {};
+
+        case Phase::StartOutputPass: {
+            // Absorb all available input first, so that the output pass shows the latest scan rather than every
+            // intermediate one.
+            int status = JPEG_SUSPENDED;
+            do {
+                status = jpeg_consume_input(&cinfo);
+            } while (status != JPEG_SUSPENDED && status != JPEG_REACHED_EOI);
+
+            if (!jpeg_start_output(&cinfo, cinfo.input_scan_number))
+                return {};
+            context.phase = Phase::OutputPassScanlines;
+            break;
+        }
+
+        case Phase::OutputPassScanlines:
+            if (!read_available_scanlines())
+                return {};
+            context.phase = Phase::FinishOutputPass;
+            break;
+
+        case Phase::FinishOutputPass:
+            if (!jpeg_finish_output(&cinfo))
+                return {};
+            did_decode_pixels();
+
+            if (jpeg_input_complete(&cinfo) && cinfo.input_scan_number == cinfo.output_scan_number) {
+                context.phase = Phase::Done;
+                return {};
+            }
+
+            context.phase = Phase::StartOutputPass;
+
+            // Unless the remaining scans have all arrived already, wait for more data before the next output pass.
+            if (!jpeg_input_complete(&cinfo))
+                return {};
+            break;
+
+        case Phase::Done:
+        case Phase::Unsupported:
+            return {};
+
+        case Phase::Error:
+            return Error::from_string_literal("JPEGProgressiveDecoder: Decoding failed");
+        }
+    }
+}
+
 }
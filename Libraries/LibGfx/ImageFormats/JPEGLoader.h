@@ -35,4 +35,23 @@ private:
     NonnullOwnPtr<JPEGLoadingContext> m_context;
 };
 
+struct JPEGProgressiveDecodingContext;
+
+class JPEGProgressiveDecoder final : public ProgressiveImageDecoder {
+public:
+    static ErrorOr<NonnullOwnPtr<ProgressiveImageDecoder>> create(Optional<IntSize> ideal_size);
+
+    virtual ~JPEGProgressiveDecoder() override;
+
+    virtual ErrorOr<void> append(ReadonlyBytes) override;
+
+private:
+    explicit JPEGProgressiveDecoder(NonnullOwnPtr<JPEGProgressiveDecodingContext>);
+
+    ErrorOr<void> decode_available_data();
+    bool read_available_scanlines();
+
+    NonnullOwnPtr<JPEGProgressiveDecodingContext> m_context;
+};
+
 }
@@ -16,6 +16,102 @@
 
 namespace Gfx {
 
+// Averages the rows of a non-interlaced image into a smaller bitmap as they are read, weighting colors by alpha.
+class PNGRowDownsampler {
+public:
+    ErrorOr<void> start(IntSize source_size, IntSize target_size);
+    void clear();
+
+    bool is_active() const { return m_bitmap; }
+    RefPtr<Bitmap> const& bitmap() const { return m_bitmap; }
+    RefPtr<Bitmap> take_bitmap() { return move(m_bitmap); }
+
+    // Takes the next row of BGRA pixels. Returns whether a row of the bitmap was completed.
+    bool add_row(u8 const*);
+
+private:
+    // Blue, green and red weighted by alpha, then alpha and the number of source pixels.
+    static constexpr size_t accumulators_per_pixel = 5;
+
+    void flush_row();
+
+    RefPtr<Bitmap> m_bitmap;
+    IntSize m_source_size;
+    Vector<u64> m_accumulators;
+    i64 m_source_y { 0 };
+    i64 m_output_y { 0 };
+};
+
+ErrorOr<void> PNGRowDownsampler::start(IntSize source_size, IntSize target_size)
+{
+    VERIFY(target_size.width() <= source_size.width() && target_size.height() <= source_size.height());
+
+    m_bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Unpremultiplied, target_size));
+    m_source_size = source_size;
+    TRY(m_accumulators.try_resize(target_size.width() * accumulators_per_pixel));
+    m_accumulators.fill(0);
+    m_source_y = 0;
+    m_output_y = 0;
+    return {};
+}
+
+void PNGRowDownsampler::clear()
+{
+    m_bitmap = nullptr;
+    m_accumulators.clear();
+}
+
+bool PNGRowDownsampler::add_row(u8 const* source_row)
+{
+    i64 source_width = m_source_size.width();
+    i64 source_height = m_source_size.height();
+    i64 target_width = m_bitmap->width();
+    i64 target_height = m_bitmap->height();
+    if (m_source_y >= source_height)
+        return false;
+
+    for (i64 source_x = 0; source_x < source_width; ++source_x) {
+        auto output_x = source_x * target_width / source_width;
+        auto const* source_pixel = &source_row[source_x * 4];
+        auto* accumulator = &m_accumulators[output_x * accumulators_per_pixel];
+        u64 alpha = source_pixel[3];
+        accumulator[0] += source_pixel[0] * alpha;
+        accumulator[1] += source_pixel[1] * alpha;
+        accumulator[2] += source_pixel[2] * alpha;
+        accumulator[3] += alpha;
+        accumulator[4] += 1;
+    }
+
+    ++m_source_y;
+    auto next_output_y = m_source_y * target_height / source_height;
+    if (m_source_y != source_height && next_output_y == m_output_y)
+        return false;
+
+    flush_row();
+    m_output_y = next_output_y;
+    return true;
+}
+
+void PNGRowDownsampler::flush_row()
+{
+    auto* output_row = m_bitmap->scanline_u8(m_output_y);
+    for (i64 output_x = 0; output_x < m_bitmap->width(); ++output_x) {
+        auto* accumulator = &m_accumulators[output_x * accumulators_per_pixel];
+        auto* output_pixel = &output_row[output_x * 4];
+        auto alpha_sum = accumulator[3];
+        auto pixel_count = accumulator[4];
+        if (alpha_sum == 0 || pixel_count == 0) {
+            output_pixel[0] = output_pixel[1] = output_pixel[2] = output_pixel[3] = 0;
+        } else {
+            output_pixel[0] = static_cast<u8>(accumulator[0] / alpha_sum);
+            output_pixel[1] = static_cast<u8>(accumulator[1] / alpha_sum);
+            output_pixel[2] = static_cast<u8>(accumulator[2] / alpha_sum);
+            output_pixel[3] = static_cast<u8>(alpha_sum / pixel_count);
+        }
+    }
+    m_accumulators.fill(0);
+}
+
 struct PNGLoadingContext {
     ~PNGLoadingContext()
     {
@@ -27,6 +123,7 @@ struct PNGLoadingContext {
 
     ReadonlyBytes data;
     IntSize size;
+    bool is_interlaced { false };
     u32 frame_count { 0 };
     u32 loop_count { 0 };
     Vector<ImageFrameDescriptor> frame_descriptors;
@@ -41,6 +138,11 @@ struct PNGLoadingContext {
     RefPtr<Bitmap> in_flight_bitmap;
     RefPtr<Bitmap> output_buffer;
     OwnPtr<Painter> painter;
+    Vector<u8> row_buffer;
+    PNGRowDownsampler downsampler;
+
+    // Set when create() left decoding to the first frame() call, so that the ideal size is known by then.
+    bool has_deferred_decode { false };
 
     void clear_read_frames_working_state()
     {
@@ -48,12 +150,15 @@ struct PNGLoadingContext {
         in_flight_bitmap = nullptr;
         output_buffer = nullptr;
         painter = nullptr;
+        row_buffer.clear();
+        downsampler.clear();
     }
 
     ErrorOr<size_t> read_frames(png_structp, png_infop);
+    ErrorOr<NonnullRefPtr<Bitmap>> read_downsampled_frame(png_structp, IntSize target_size);
     ErrorOr<void> apply_exif_orientation();
 
-    ErrorOr<void> read_all_frames()
+    ErrorOr<void> read_all_frames(Optional<IntSize> ideal_size = {})
     {
         // NOTE: We need to setjmp() here because libpng uses longjmp() for error handling.
         if (auto error_value = setjmp(png_jmpbuf(png_ptr)); error_value) {
@@ -65,7 +170,16 @@ struct PNGLoadingContext {
 
         png_read_update_info(png_ptr, info_ptr);
 
-        frame_count = TRY(read_frames(png_ptr, info_ptr));
+        // Interlaced images have to be fully assembled before any row is final, so only progressive rows of a
+        // single-frame image can be downsampled as they are read.
+        auto target_size = scaled_size_covering(size, ideal_size);
+        if (target_size != size && !is_interlaced && !png_get_valid(png_ptr, info_ptr, PNG_INFO_acTL)) {
+            frame_descriptors.append({ TRY(read_downsampled_frame(png_ptr, target_size)), 0 });
+            frame_count = 1;
+            loop_count = 0;
+        } else {
+            frame_count = TRY(read_frames(png_ptr, info_ptr));
+        }
 
         if (exif_metadata)
             TRY(apply_exif_orientation());
@@ -78,18 +192,32 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> PNGImageDecoderPlugin::create(Readonl
     auto decoder = adopt_own(*new PNGImageDecoderPlugin(bytes));
     TRY(decoder->initialize());
 
-    auto result = decoder->m_context->read_all_frames();
+    // Still images without EXIF orientation are decoded on the first call to frame(), which may ask for a smaller
+    // size. Everything else needs to be decoded up front to know its frame count and final size.
+    auto& context = *decoder->m_context;
+    if (!png_get_valid(context.png_ptr, context.info_ptr, PNG_INFO_acTL) && !context.exif_metadata) {
+        context.has_deferred_decode = true;
+        context.frame_count = 1;
+        return decoder;
+    }
+
+    TRY(decoder->read_all_frames());
+    return decoder;
+}
+
+ErrorOr<void> PNGImageDecoderPlugin::read_all_frames(Optional<IntSize> ideal_size)
+{
+    auto result = m_context->read_all_frames(ideal_size);
     if (result.is_error()) {
         // NOTE: If we didn't fail in initialize(), that means we have size information.
         //       We can create a single-frame bitmap with that size and return it.
         //       This is weird, but kinda matches the behavior of other browsers.
-        auto bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Premultiplied, decoder->m_context->size));
-        decoder->m_context->frame_descriptors.append({ move(bitmap), 0 });
-        decoder->m_context->frame_count = 1;
-        return decoder;
+        auto bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Premultiplied, scaled_size_covering(m_context->size, ideal_size)));
+        m_context->frame_descriptors.clear();
+        m_context->frame_descriptors.append({ move(bitmap), 0 });
+        m_context->frame_count = 1;
     }
-
-    return decoder;
+    return {};
 }
 
 PNGImageDecoderPlugin::PNGImageDecoderPlugin(ReadonlyBytes data)
@@ -130,8 +258,13 @@ int PNGImageDecoderPlugin::frame_duration(size_t index)
     return m_context->frame_descriptors[index].duration;
 }
 
-ErrorOr<ImageFrameDescriptor> PNGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> PNGImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
+    if (m_context->has_deferred_decode) {
+        m_context->has_deferred_decode = false;
+        TRY(read_all_frames(ideal_size));
+    }
+
     if (index >= m_context->frame_descriptors.size())
         return Error::from_errno(EINVAL);
 
@@ -161,6 +294,34 @@ static void log_png_warning(png_structp, char const* warning_message)
     dbgln("libpng warning: {}", warning_message);
 }
 
+// Makes libpng output every image as 8-bit BGRA rows, whatever its color type and bit depth.
+static void set_up_read_transforms(png_structp png_ptr, png_infop info_ptr)
+{
+    int bit_depth = png_get_bit_depth(png_ptr, info_ptr);
+    int color_type = png_get_color_type(png_ptr, info_ptr);
+
+    if (color_type == PNG_COLOR_TYPE_PALETTE)
+        png_set_palette_to_rgb(png_ptr);
+
+    if (color_type == PNG_COLOR_TYPE_GRAY && bit_depth < 8)
+        png_set_expand_gray_1_2_4_to_8(png_ptr);
+
+    if (png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS))
+        png_set_tRNS_to_alpha(png_ptr);
+
+    if (bit_depth == 16)
+        png_set_strip_16(png_ptr);
+
+    if (color_type == PNG_COLOR_TYPE_GRAY || color_type == PNG_COLOR_TYPE_GRAY_ALPHA)
+        png_set_gray_to_rgb(png_ptr);
+
+    if (png_get_interlace_type(png_ptr, info_ptr) != PNG_INTERLACE_NONE)
+        png_set_interlace_handling(png_ptr);
+
+    png_set_filler(png_ptr, 0xFF, PNG_FILLER_AFTER);
+    png_set_bgr(png_ptr);
+}
+
 ErrorOr<void> PNGImageDecoderPlugin::initialize()
 {
     m_context->png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
@@ -197,27 +358,9 @@ ErrorOr<void> PNGImageDecoderPlugin::initialize()
     int interlace_type = 0;
     png_get_IHDR(m_context->png_ptr, m_context->info_ptr, &width, &height, &bit_depth, &color_type, &interlace_type, nullptr, nullptr);
     m_context->size = { static_cast<int>(width), static_cast<int>(height) };
+    m_context->is_interlaced = interlace_type != PNG_INTERLACE_NONE;
 
-    if (color_type == PNG_COLOR_TYPE_PALETTE)
-        png_set_palette_to_rgb(m_context->png_ptr);
-
-    if (color_type == PNG_COLOR_TYPE_GRAY && bit_depth < 8)
-        png_set_expand_gray_1_2_4_to_8(m_context->png_ptr);
-
-    if (png_get_valid(m_context->png_ptr, m_context->info_ptr, PNG_INFO_tRNS))
-        png_set_tRNS_to_alpha(m_context->png_ptr);
-
-    if (bit_depth == 16)
-        png_set_strip_16(m_context->png_ptr);
-
-    if (color_type == PNG_COLOR_TYPE_GRAY || color_type == PNG_COLOR_TYPE_GRAY_ALPHA)
-        png_set_gray_to_rgb(m_context->png_ptr);
-
-    if (interlace_type != PNG_INTERLACE_NONE)
-        png_set_interlace_handling(m_context->png_ptr);
-
-    png_set_filler(m_context->png_ptr, 0xFF, PNG_FILLER_AFTER);
-    png_set_bgr(m_context->png_ptr);
+    set_up_read_transforms(m_context->png_ptr, m_context->info_ptr);
 
     png_byte color_primaries { 0 };
     png_byte transfer_function { 0 };
@@ -391,6 +534,25 @@ ErrorOr<size_t> PNGLoadingContext::read_frames(png_structp png_ptr, png_infop in
     return frame_count;
 }
 
+// Reads the image one row at a time, and folds each row into a single row of accumulators. Every output pixel is the
+// alpha-weighted average of the source pixels it covers, so the full-size image never exists in memory.
+ErrorOr<NonnullRefPtr<Bitmap>> PNGLoadingContext::read_downsampled_frame(png_structp png_ptr, IntSize target_size)
+{
+    // The downsampler is a member — so the bitmap survives a potential libpng longjmp out of png_read_row() below.
+    TRY(downsampler.start(size, target_size));
+    TRY(row_buffer.try_resize(size.width() * 4));
+
+    for (int source_y = 0; source_y < size.height(); ++source_y) {
+        png_read_row(png_ptr, row_buffer.data(), nullptr);
+        downsampler.add_row(row_buffer.data());
+    }
+
+    // Past the longjmp window; hand the bitmap to the caller, and clear the member.
+    auto bitmap = downsampler.take_bitmap().release_nonnull();
+    clear_read_frames_working_state();
+    return bitmap;
+}
+
 PNGImageDecoderPlugin::~PNGImageDecoderPlugin() = default;
 
 bool PNGImageDecoderPlugin::sniff(ReadonlyBytes data)
@@ -408,4 +570,129 @@ Optional<Metadata const&> PNGImageDecoderPlugin::metadata()
     return OptionalNone {};
 }
 
+struct PNGProgressiveDecodingContext {
+    ~PNGProgressiveDecodingContext()
+    {
+        png_destroy_read_struct(&png_ptr, &info_ptr, nullptr);
+    }
+
+    static void did_read_info(png_structp, png_infop);
+    static void did_read_row(png_structp, png_bytep new_row, png_uint_32 row_number, int pass);
+
+    PNGProgressiveDecoder* decoder { nullptr };
+    png_structp png_ptr { nullptr };
+    png_infop info_ptr { nullptr };
+    Optional<IntSize> ideal_size;
+    PNGRowDownsampler downsampler;
+    bool is_unsupported { false };
+    bool has_failed { false };
+};
+
+PNGProgressiveDecoder::PNGProgressiveDecoder(NonnullOwnPtr<PNGProgressiveDecodingContext> context)
+    : m_context(move(context))
+{
+    m_context->decoder = this;
+}
+
+PNGProgressiveDecoder::~PNGProgressiveDecoder() = default;
+
+ErrorOr<NonnullOwnPtr<ProgressiveImageDecoder>> PNGProgressiveDecoder::create(Optional<IntSize> ideal_size)
+{
+    auto context = TRY(try_make<PNGProgressiveDecodingContext>());
+    context->ideal_size = ideal_size;
+
+    context->png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    if (!context->png_ptr)
+        return Error::from_string_view("Failed to allocate read struct"sv);
+
+    context->info_ptr = png_create_info_struct(context->png_ptr);
+    if (!context->info_ptr)
+        return Error::from_string_view("Failed to allocate info struct"sv);
+
+    if (auto error_value = setjmp(png_jmpbuf(context->png_ptr)); error_value)
+        return Error::from_errno(error_value);
+
+    png_set_error_fn(context->png_ptr, nullptr, log_png_error, log_png_warning);
+
+    auto decoder = TRY(adopt_nonnull_own_or_enomem(new (nothrow) PNGProgressiveDecoder(move(context))));
+    auto& decoder_context = *decoder->m_context;
+    png_set_progressive_read_fn(decoder_context.png_ptr, &decoder_context, PNGProgressiveDecodingContext::did_read_info, PNGProgressiveDecodingContext::did_read_row, nullptr);
+    return decoder;
+}
+
+void PNGProgressiveDecodingContext::did_read_info(png_structp png_ptr, png_infop info_ptr)
+{
+    auto& context = *static_cast<PNGProgressiveDecodingContext*>(png_get_progressive_ptr(png_ptr));
+
+    // Animations and EXIF orientation need the whole file, so those images are only shown once they have arrived.
+    u8* exif_data = nullptr;
+    u32 exif_length = 0;
+    if (png_get_valid(png_ptr, info_ptr, PNG_INFO_acTL) || png_get_eXIf_1(png_ptr, info_ptr, &exif_length, &exif_data) > 0) {
+        context.is_unsupported = true;
+        png_process_data_pause(png_ptr, 0);
+        return;
+    }
+
+    set_up_read_transforms(png_ptr, info_ptr);
+    png_start_read_image(png_ptr);
+
+    IntSize size { static_cast<int>(png_get_image_width(png_ptr, info_ptr)), static_cast<int>(png_get_image_height(png_ptr, info_ptr)) };
+    context.decoder->m_natural_size = size;
+
+    // NB: Like the regular decoder, only non-interlaced images are downsampled to the ideal size, so that the partial
+    //     images have the size of the final one.
+    auto target_size = scaled_size_covering(size, context.ideal_size);
+    if (target_size != size && png_get_interlace_type(png_ptr, info_ptr) == PNG_INTERLACE_NONE) {
+        if (context.downsampler.start(size, target_size).is_error()) {
+            png_error(png_ptr, "Failed to allocate bitmap");
+            return;
+        }
+        context.decoder->m_bitmap = context.downsampler.bitmap();
+        return;
+    }
+
+    auto bitmap_or_error = Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Unpremultiplied, size);
+    if (bitmap_or_error.is_error()) {
+        png_error(png_ptr, "Failed to allocate bitmap");
+        return;
+    }
+    context.decoder->m_bitmap = bitmap_or_error.release_value();
+}
+
+void PNGProgressiveDecodingContext::did_read_row(png_structp png_ptr, png_bytep new_row, png_uint_32 row_number, int)
+{
+    auto& context = *static_cast<PNGProgressiveDecodingContext*>(png_get_progressive_ptr(png_ptr));
+    auto& decoder = *context.decoder;
+
+    if (context.downsampler.is_active()) {
+        if (new_row && context.downsampler.add_row(new_row))
+            decoder.did_decode_pixels();
+        return;
+    }
+
+    // NOTE: For interlaced images, libpng calls this for every row of every pass, and passes null for rows that did not
+    //       change. Combining keeps the pixels of the earlier passes that this one does not cover.
+    if (!new_row || !decoder.m_bitmap)
+        return;
+    png_progressive_combine_row(png_ptr, decoder.m_bitmap->scanline_u8(row_number), new_row);
+    decoder.did_decode_pixels();
+}
+
+ErrorOr<void> PNGProgressiveDecoder::append(ReadonlyBytes bytes)
+{
+    auto& context = *m_context;
+    if (context.has_failed)
+        return Error::from_string_literal("PNGProgressiveDecoder: Decoding failed");
+    if (context.is_unsupported)
+        return {};
+
+    if (auto error_value = setjmp(png_jmpbuf(context.png_ptr)); error_value) {
+        context.has_failed = true;
+        return Error::from_string_literal("PNGProgressiveDecoder: Decoding failed");
+    }
+
+    png_process_data(context.png_ptr, context.info_ptr, const_cast<u8*>(bytes.data()), bytes.size());
+    return {};
+}
+
 }
@@ -35,8 +35,27 @@ private:
     explicit PNGImageDecoderPlugin(ReadonlyBytes);
 
     ErrorOr<void> initialize();
+    ErrorOr<void> read_all_frames(Optional<IntSize> ideal_size = {});
 
     OwnPtr<PNGLoadingContext> m_context;
 };
 
+struct PNGProgressiveDecodingContext;
+
+class PNGProgressiveDecoder final : public ProgressiveImageDecoder {
+public:
+    static ErrorOr<NonnullOwnPtr<ProgressiveImageDecoder>> create(Optional<IntSize> ideal_size = {});
+
+    virtual ~PNGProgressiveDecoder() override;
+
+    virtual ErrorOr<void> append(ReadonlyBytes) override;
+
+private:
+    friend struct PNGProgressiveDecodingContext;
+
+    explicit PNGProgressiveDecoder(NonnullOwnPtr<PNGProgressiveDecodingContext>);
+
+    NonnullOwnPtr<PNGProgressiveDecodingContext> m_context;
+};
+
 }
@@ -178,17 +178,40 @@ static ErrorOr<ImageFrameDescriptor> decode_next_webp_animation_frame(WebPLoadin
     return ImageFrameDescriptor { bitmap, duration };
 }
 
-static ErrorOr<void> decode_webp_image(WebPLoadingContext& context)
+static ErrorOr<void> decode_webp_image(WebPLoadingContext& context, Optional<IntSize> ideal_size)
 {
     VERIFY(context.state >= WebPLoadingContext::State::HeaderDecoded);
     VERIFY(!context.has_animation);
 
     auto bitmap_format = context.has_alpha ? BitmapFormat::BGRA8888 : BitmapFormat::BGRx8888;
-    auto bitmap = TRY(Bitmap::create(bitmap_format, Gfx::AlphaType::Unpremultiplied, context.size));
-
-    auto image_data = WebPDecodeBGRAInto(context.data.data(), context.data.size(), bitmap->scanline_u8(0), bitmap->data_size(), bitmap->pitch());
-    if (image_data == nullptr)
-        return Error::from_string_literal("Failed to decode webp image into bitmap");
+    auto target_size = scaled_size_covering(context.size, ideal_size);
+    auto bitmap = TRY(Bitmap::create(bitmap_format, Gfx::AlphaType::Unpremultiplied, target_size));
+
+    if (target_size == context.size) {
+        auto image_data = WebPDecodeBGRAInto(context.data.data(), context.data.size(), bitmap->scanline_u8(0), bitmap->data_size(), bitmap->pitch());
+        if (image_data == nullptr)
+            return Error::from_string_literal("Failed to decode webp image into bitmap");
+    } else {
+        // libwebp rescales each row as it is decoded, so the full-size image is never produced.
+        WebPDecoderConfig config {};
+        if (!WebPInitDecoderConfig(&config))
+            return Error::from_string_literal("Failed to initialize webp decoder config");
+
+        config.options.use_scaling = 1;
+        config.options.scaled_width = target_size.width();
+        config.options.scaled_height = target_size.height();
+        config.options.use_threads = 1;
+        config.output.colorspace = MODE_BGRA;
+        config.output.is_external_memory = 1;
+        config.output.u.RGBA.rgba = bitmap->scanline_u8(0);
+        config.output.u.RGBA.stride = bitmap->pitch();
+        config.output.u.RGBA.size = bitmap->data_size();
+
+        auto status = WebPDecode(context.data.data(), context.data.size(), &config);
+        WebPFreeDecBuffer(&config.output);
+        if (status != VP8_STATUS_OK)
+            return Error::from_string_literal("Failed to decode scaled webp image into bitmap");
+    }
 
     context.frame_descriptors.append(ImageFrameDescriptor { bitmap, 0 });
 
@@ -236,7 +259,7 @@ size_t WebPImageDecoderPlugin::first_animated_frame_index()
     return 0;
 }
 
-ErrorOr<ImageFrameDescriptor> WebPImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> WebPImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index >= frame_count())
         return Error::from_string_literal("WebPImageDecoderPlugin: Invalid frame index");
@@ -259,11 +282,12 @@ ErrorOr<ImageFrameDescriptor> WebPImageDecoderPlugin::frame(size_t index, Option
             (void)TRY(decode_next_webp_animation_frame(*m_context));
 
         // Decode and return the requested frame without caching it.
+        // FIXME: WebPAnimDecoder cannot scale its output, so animations always decode at their natural size.
         return TRY(decode_next_webp_animation_frame(*m_context));
     }
 
     if (m_context->state < WebPLoadingContext::State::BitmapDecoded) {
-        TRY(decode_webp_image(*m_context));
+        TRY(decode_webp_image(*m_context, ideal_size));
         m_context->state = WebPLoadingContext::State::BitmapDecoded;
     }
 
@@ -291,4 +315,146 @@ ErrorOr<Optional<ReadonlyBytes>> WebPImageDecoderPlugin::icc_data()
     return OptionalNone {};
 }
 
+struct WebPProgressiveDecodingContext {
+    ~WebPProgressiveDecodingContext()
+    {
+        if (decoder)
+            WebPIDelete(decoder);
+        WebPFreeDecBuffer(&config.output);
+    }
+
+    enum class State {
+        ReadingFeatures,
+        Decoding,
+        Done,
+        Unsupported,
+        Error,
+    };
+
+    State state { State::ReadingFeatures };
+    Optional<IntSize> ideal_size;
+
+    // Everything received before the features could be read, which is handed to the decoder once it exists.
+    ByteBuffer header_data;
+
+    WebPDecoderConfig config {};
+    WebPIDecoder* decoder { nullptr };
+    int decoded_rows { 0 };
+};
+
+WebPProgressiveDecoder::WebPProgressiveDecoder(NonnullOwnPtr<WebPProgressiveDecodingContext> context)
+    : m_context(move(context))
+{
+}
+
+WebPProgressiveDecoder::~WebPProgressiveDecoder() = default;
+
+bool WebPProgressiveDecoder::sniff(ReadonlyBytes data)
+{
+    // NOTE: The header can't be fully decoded from just the first few bytes, so only check the RIFF container here.
+    return data.size() >= 12 && data.slice(0, 4) == "RIFF"sv.bytes() && data.slice(8, 4) == "WEBP"sv.bytes();
+}
+
+ErrorOr<NonnullOwnPtr<ProgressiveImageDecoder>> WebPProgressiveDecoder::create(Optional<IntSize> ideal_size)
+{
+    auto context = TRY(try_make<WebPProgressiveDecodingContext>());
+    context->ideal_size = ideal_size;
+    if (!WebPInitDecoderConfig(&context->config))
+        return Error::from_string_literal("Failed to initialize webp decoder config");
+    return adopt_nonnull_own_or_enomem(new (nothrow) WebPProgressiveDecoder(move(context)));
+}
+
+ErrorOr<void> WebPProgressiveDecoder::start_decoding()
+{
+    auto& context = *m_context;
+    auto& features = context.config.input;
+
+    // FIXME: Show the first frame of animations while the rest is loading.
+    if (features.has_animation) {
+        context.state = WebPProgressiveDecodingContext::State::Unsupported;
+        return {};
+    }
+
+    IntSize size { features.width, features.height };
+    auto target_size = scaled_size_covering(size, context.ideal_size);
+    auto bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Unpremultiplied, target_size));
+
+    auto& options = context.config.options;
+    if (target_size != size) {
+        options.use_scaling = 1;
+        options.scaled_width = target_size.width();
+        options.scaled_height = target_size.height();
+    }
+
+    // Decode straight into the bitmap, so that every row libwebp finishes is visible in the next snapshot.
+    auto& output = context.config.output;
+    output.colorspace = MODE_BGRA;
+    output.is_external_memory = 1;
+    output.u.RGBA.rgba = bitmap->scanline_u8(0);
+    output.u.RGBA.stride = bitmap->pitch();
+    output.u.RGBA.size = bitmap->data_size();
+
+    context.decoder = WebPIDecode(nullptr, 0, &context.config);
+    if (!context.decoder)
+        return Error::from_string_literal("Failed to create incremental webp decoder");
+
+    m_bitmap = move(bitmap);
+    m_natural_size = size;
+    context.state = WebPProgressiveDecodingContext::State::Decoding;
+    return {};
+}
+
+ErrorOr<void> WebPProgressiveDecoder::append(ReadonlyBytes bytes)
+{
+    using State = WebPProgressiveDecodingContext::State;
+
+    auto& context = *m_context;
+    switch (context.state) {
+    case State::ReadingFeatures: {
+        TRY(context.header_data.try_append(bytes));
+        auto status = WebPGetFeatures(context.header_data.data(), context.header_data.size(), &context.config.input);
+        if (status == VP8_STATUS_NOT_ENOUGH_DATA)
+            return {};
+        if (status != VP8_STATUS_OK) {
+            context.state = State::Error;
+            return Error::from_string_literal("Failed to decode webp header");
+        }
+
+        if (auto result = start_decoding(); result.is_error()) {
+            context.state = State::Error;
+            return result.release_error();
+        }
+        if (context.state != State::Decoding)
+            return {};
+
+        // The decoder keeps its own copy of the data, so the header bytes are no longer needed.
+        auto header_data = move(context.header_data);
+        return append(header_data);
+    }
+    case State::Decoding:
+        break;
+    case State::Done:
+    case State::Unsupported:
+        return {};
+    case State::Error:
+        return Error::from_string_literal("WebPProgressiveDecoder: Decoding failed");
+    }
+
+    auto status = WebPIAppend(context.decoder, bytes.data(), bytes.size());
+    if (status != VP8_STATUS_OK && status != VP8_STATUS_SUSPENDED) {
+        context.state = State::Error;
+        return Error::from_string_literal("Failed to decode webp image incrementally");
+    }
+
+    int last_y = 0;
+    if (WebPIDecGetRGB(context.decoder, &last_y, nullptr, nullptr, nullptr) && last_y > context.decoded_rows) {
+        context.decoded_rows = last_y;
+        did_decode_pixels();
+    }
+
+    if (status == VP8_STATUS_OK)
+        context.state = State::Done;
+    return {};
+}
+
 }
@@ -35,4 +35,23 @@ private:
     OwnPtr<WebPLoadingContext> m_context;
 };
 
+struct WebPProgressiveDecodingContext;
+
+class WebPProgressiveDecoder final : public ProgressiveImageDecoder {
+public:
+    static bool sniff(ReadonlyBytes);
+    static ErrorOr<NonnullOwnPtr<ProgressiveImageDecoder>> create(Optional<IntSize> ideal_size);
+
+    virtual ~WebPProgressiveDecoder() override;
+
+    virtual ErrorOr<void> append(ReadonlyBytes) override;
+
+private:
+    explicit WebPProgressiveDecoder(NonnullOwnPtr<WebPProgressiveDecodingContext>);
+
+    ErrorOr<void> start_decoding();
+
+    NonnullOwnPtr<WebPProgressiveDecodingContext> m_context;
+};
+
 }
@@ -123,6 +123,23 @@ void SkiaBackendContext::perform_post_flush_cleanup()
         context->purgeUnlockedResources(GrPurgeResourceOptions::kScratchResourcesOnly);
 }
 
+size_t SkiaBackendContext::purge_resources(PurgeResources resources)
+{
+    auto* context = sk_context();
+    if (!context)
+        return 0;
+
+    size_t resource_bytes_before = 0;
+    context->getResourceCacheUsage(nullptr, &resource_bytes_before);
+
+    context->performDeferredCleanup(std::chrono::milliseconds(0));
+    context->purgeUnlockedResources(resources == PurgeResources::ScratchOnly ? GrPurgeResourceOptions::kScratchResourcesOnly : GrPurgeResourceOptions::kAllResources);
+
+    size_t resource_bytes_after = 0;
+    context->getResourceCacheUsage(nullptr, &resource_bytes_after);
+    return resource_bytes_before > resource_bytes_after ? resource_bytes_before - resource_bytes_after : 0;
+}
+
 void SkiaBackendContext::initialize_gpu_backend()
 {
     VERIFY(!main_thread_context());
@@ -58,6 +58,13 @@ public:
     void flush_and_submit(SkSurface*);
     void flush_and_submit_async(SkSurface*, Function<void()>&&);
     void check_async_work_completion();
+
+    enum class PurgeResources {
+        ScratchOnly,
+        All,
+    };
+    // Frees GPU resources that are not in use right now, and returns the number of bytes released.
+    size_t purge_resources(PurgeResources);
     virtual GrDirectContext* sk_context() const = 0;
 
     virtual MetalContext& metal_context() = 0;
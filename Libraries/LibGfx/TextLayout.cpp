@@ -9,12 +9,12 @@
 
 #include <AK/Array.h>
 #include <AK/BitCast.h>
-#include <AK/HashFunctions.h>
 #include <AK/Math.h>
 #include <AK/NumericLimits.h>
 #include <AK/Utf16String.h>
 #include <AK/Utf16View.h>
 #include <LibGfx/Font/Font.h>
+#include <LibGfx/Font/ShapingCache.h>
 #include <LibGfx/Font/Typeface.h>
 #include <LibGfx/Point.h>
 #include <LibGfx/TextLayout.h>
@@ -500,7 +500,7 @@ static size_t length_of_trailing_whitespace_run(Utf16View const& string)
     return length;
 }
 
-static NonnullOwnPtr<ShapedGlyphs> build_origin_relative_shape(Utf16View const& string, Font const& font, GlyphRun::TextType text_type, float letter_spacing, float word_spacing)
+static NonnullRefPtr<ShapedGlyphs const> build_origin_relative_shape(Utf16View const& string, Font const& font, GlyphRun::TextType text_type, float letter_spacing, float word_spacing)
 {
     auto const& metrics = font.pixel_metrics();
     auto* buffer = setup_text_shaping(string, font, text_type);
@@ -576,13 +576,94 @@ static NonnullOwnPtr<ShapedGlyphs> build_origin_relative_shape(Utf16View const&
 
     hb_buffer_destroy(buffer);
 
-    return make<ShapedGlyphs>(move(glyphs), point.x(), trailing_whitespace);
+    return adopt_ref(*new ShapedGlyphs(move(glyphs), point.x(), trailing_whitespace));
 }
 
-NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, float word_spacing, Utf16View const& string, Font const& font, GlyphRun::TextType text_type, TrailingWhitespace* out_trailing_whitespace)
+static NonnullRefPtr<ShapedGlyphs const> cached_origin_relative_shape(Utf16View const& string, Font const& font, GlyphRun::TextType text_type, float letter_spacing, float word_spacing, bool is_segment)
+{
+    auto& shaping_cache = GlobalShapingCache::the();
+
+    auto text_type_bits = static_cast<u8>(to_underlying(text_type));
+    auto letter_spacing_bit_pattern = bit_cast<u32>(letter_spacing);
+    auto word_spacing_bit_pattern = bit_cast<u32>(word_spacing);
+
+    if (auto shape = shaping_cache.find(font, string, text_type_bits, letter_spacing_bit_pattern, word_spacing_bit_pattern, is_segment))
+        return shape.release_nonnull();
+
+    auto shape = build_origin_relative_shape(string, font, text_type, letter_spacing, word_spacing);
+    shaping_cache.insert(font, { Utf16String::from_utf16(string), text_type_bits, letter_spacing_bit_pattern, word_spacing_bit_pattern }, shape);
+    return shape;
+}
+
+// Runs shorter than this are cheap enough to cache whole, and rarely share words with other runs.
+static constexpr size_t minimum_length_for_shaping_by_word = 16;
+
+static bool can_shape_by_word(Utf16View const& string, Font const& font)
+{
+    // ASCII text is always shaped as left-to-right Latin, so splitting it at spaces cannot change its itemization or
+    // direction. What remains is whether the font has any lookup that reaches across a space.
+    if (!string.has_ascii_storage() || string.length_in_code_units() < minimum_length_for_shaping_by_word)
+        return false;
+
+    // There must be at least one word boundary, i.e. a space followed by something else.
+    bool has_word_boundary = false;
+    for (size_t i = 1; i < string.length_in_code_units(); ++i) {
+        if (string.code_unit_at(i - 1) == ' ' && string.code_unit_at(i) != ' ') {
+            has_word_boundary = true;
+            break;
+        }
+    }
+    if (!has_word_boundary)
+        return false;
+
+    return !font.has_space_in_ligatures_or_kerning();
+}
+
+// Shapes each word (along with its following spaces) separately through the shaping cache, and concatenates the
+// results. Words reappear across runs far more often than whole runs do, so this keeps relayout of edited or
+// re-wrapped text out of HarfBuzz, and avoids caching every distinct run.
+static NonnullRefPtr<ShapedGlyphs const> shape_by_word(Utf16View const& string, Font const& font, GlyphRun::TextType text_type, float letter_spacing, float word_spacing)
 {
-    auto& shaping_cache = font.shaping_cache();
+    auto length = string.length_in_code_units();
+
+    Vector<DrawGlyph> glyphs;
+    glyphs.ensure_capacity(length);
+    float width = 0;
+
+    size_t segment_start = 0;
+    while (segment_start < length) {
+        auto segment_end = segment_start;
+        while (segment_end < length && string.code_unit_at(segment_end) != ' ')
+            ++segment_end;
+        while (segment_end < length && string.code_unit_at(segment_end) == ' ')
+            ++segment_end;
+
+        auto segment = string.substring_view(segment_start, segment_end - segment_start);
+        auto shape = cached_origin_relative_shape(segment, font, text_type, letter_spacing, word_spacing, true);
+        for (auto glyph : shape->glyphs) {
+            glyph.position.translate_by(width, 0);
+            glyphs.append(glyph);
+        }
+        width += shape->width;
+
+        segment_start = segment_end;
+    }
+
+    // The trailing whitespace may span several segments, so add up the advances of the glyphs it covers.
+    TrailingWhitespace trailing_whitespace { .length_in_code_units = length_of_trailing_whitespace_run(string), .advance = 0 };
+    size_t code_units_from_end = 0;
+    for (auto i = glyphs.size(); i > 0; --i) {
+        code_units_from_end += glyphs[i - 1].length_in_code_units;
+        if (code_units_from_end > trailing_whitespace.length_in_code_units)
+            break;
+        trailing_whitespace.advance += glyphs[i - 1].glyph_width;
+    }
+
+    return adopt_ref(*new ShapedGlyphs(move(glyphs), width, trailing_whitespace));
+}
 
+NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, float word_spacing, Utf16View const& string, Font const& font, GlyphRun::TextType text_type, TrailingWhitespace* out_trailing_whitespace)
+{
     auto build_glyph_run = [&](ShapedGlyphs const& shape) -> NonnullRefPtr<GlyphRun> {
         if (out_trailing_whitespace)
             *out_trailing_whitespace = shape.trailing_whitespace;
@@ -594,36 +675,23 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
         return adopt_ref(*new GlyphRun(move(glyphs), font, text_type, shape.width));
     };
 
-    // FIXME: The cache currently grows unbounded. We should have some limit and LRU mechanism.
     if (string.length_in_code_units() == 1 && letter_spacing == 0.f && word_spacing == 0.f && text_type == GlyphRun::TextType::Common) {
         auto code_unit = string.code_unit_at(0);
         if (code_unit < 128) {
-            auto& cache_slot = shaping_cache.single_ascii_character_map[code_unit];
-            if (!cache_slot)
-                cache_slot = build_origin_relative_shape(string, font, text_type, letter_spacing, word_spacing);
-            return build_glyph_run(*cache_slot);
+            auto& shaping_cache = GlobalShapingCache::the();
+            auto shape = shaping_cache.find_single_ascii_character(font, code_unit);
+            if (!shape) {
+                shape = build_origin_relative_shape(string, font, text_type, letter_spacing, word_spacing);
+                shaping_cache.insert_single_ascii_character(font, code_unit, *shape);
+            }
+            return build_glyph_run(*shape);
         }
     }
 
-    auto text_type_bits = static_cast<u8>(to_underlying(text_type));
-    auto letter_spacing_bit_pattern = bit_cast<u32>(letter_spacing);
-    auto word_spacing_bit_pattern = bit_cast<u32>(word_spacing);
-    auto key_hash = pair_int_hash(string.hash(), pair_int_hash(text_type_bits, pair_int_hash(letter_spacing_bit_pattern, word_spacing_bit_pattern)));
-
-    if (auto it = shaping_cache.map.find(key_hash, [&](auto const& candidate) {
-            return candidate.key.text_type == text_type_bits
-                && candidate.key.letter_spacing_bit_pattern == letter_spacing_bit_pattern
-                && candidate.key.word_spacing_bit_pattern == word_spacing_bit_pattern
-                && candidate.key.text == string;
-        });
-        it != shaping_cache.map.end()) {
-        return build_glyph_run(*it->value);
-    }
+    if (can_shape_by_word(string, font))
+        return build_glyph_run(shape_by_word(string, font, text_type, letter_spacing, word_spacing));
 
-    auto shape = build_origin_relative_shape(string, font, text_type, letter_spacing, word_spacing);
-    auto run = build_glyph_run(*shape);
-    shaping_cache.map.set({ Utf16String::from_utf16(string), text_type_bits, letter_spacing_bit_pattern, word_spacing_bit_pattern }, move(shape));
-    return run;
+    return build_glyph_run(cached_origin_relative_shape(string, font, text_type, letter_spacing, word_spacing, false));
 }
 
 float measure_text_width(Utf16View const& string, Font const& font, float letter_spacing)
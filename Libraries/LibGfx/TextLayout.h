@@ -33,7 +33,16 @@ struct TrailingWhitespace {
     float advance { 0 };
 };
 
-struct ShapedGlyphs {
+struct ShapedGlyphs : public AtomicRefCounted<ShapedGlyphs> {
+    ShapedGlyphs(Vector<DrawGlyph>&& glyphs, float width, TrailingWhitespace trailing_whitespace)
+        : glyphs(move(glyphs))
+        , width(width)
+        , trailing_whitespace(trailing_whitespace)
+    {
+    }
+
+    size_t byte_size() const { return sizeof(ShapedGlyphs) + glyphs.capacity() * sizeof(DrawGlyph); }
+
     Vector<DrawGlyph> glyphs;
     float width { 0 };
     TrailingWhitespace trailing_whitespace;
@@ -397,6 +397,11 @@ void DiskCache::remove_entries_accessed_since(UnixDateTime since)
     });
 }
 
+size_t DiskCache::release_memory()
+{
+    return m_database->release_memory();
+}
+
 void DiskCache::cache_entry_closed(Badge<CacheEntry>, CacheEntry const& cache_entry)
 {
     auto cache_key = cache_entry.cache_key();
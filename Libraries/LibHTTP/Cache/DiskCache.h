@@ -65,6 +65,9 @@ public:
 
     LexicalPath const& cache_directory() const { return m_cache_directory; }
 
+    // Returns the number of bytes released from the index's page cache.
+    size_t release_memory();
+
     void cache_entry_closed(Badge<CacheEntry>, CacheEntry const&);
 
 private:
@@ -83,7 +83,7 @@ Optional<MemoryCache::Entry const&> MemoryCache::open_entry(URL::URL const& url,
     VERIFY_NOT_REACHED();
 }
 
-void MemoryCache::create_entry(URL::URL const& url, StringView method, HeaderList const& request_headers, UnixDateTime request_time, u32 status_code, ByteString reason_phrase, HeaderList const& response_headers, Optional<Core::ImmutableBytes> javascript_bytecode_cache, Optional<u64> javascript_bytecode_cache_vary_key)
+void MemoryCache::create_entry(URL::URL const& url, StringView method, HeaderList const& request_headers, UnixDateTime request_time, u32 status_code, ByteString reason_phrase, HeaderList const& response_headers, Optional<Core::ImmutableBytes> javascript_bytecode_cache, Optional<Core::ImmutableBytes> css_parsed_rules_cache, Optional<u64> disk_cache_vary_key)
 {
     if (!is_cacheable(method, request_headers))
         return;
@@ -108,7 +108,8 @@ void MemoryCache::create_entry(URL::URL const& url, StringView method, HeaderLis
         .response_headers = move(response_headers_copy),
         .response_body = {},
         .javascript_bytecode_cache = move(javascript_bytecode_cache),
-        .javascript_bytecode_cache_vary_key = javascript_bytecode_cache_vary_key,
+        .css_parsed_rules_cache = move(css_parsed_rules_cache),
+        .disk_cache_vary_key = disk_cache_vary_key,
         .request_time = request_time,
         .response_time = UnixDateTime::now(),
     };
@@ -160,14 +161,13 @@ void MemoryCache::update_javascript_bytecode_cache(URL::URL const& url, StringVi
     // Attach the generated bytecode to every cache entry this request would select. Match entries the same way
     // open_entry() does, by re-deriving the vary key from the request and the entry's stored response headers, rather
     // than trusting the supplied vary key (which was computed in another process and can diverge for Vary responses).
-    // The supplied vary key is still kept as javascript_bytecode_cache_vary_key so it can be replayed onto a served
-    // response.
+    // The supplied vary key is still kept as the disk cache vary key so it can be replayed onto a served response.
     auto update_entries = [&](Vector<Entry>& entries) {
         for (auto& entry : entries) {
             if (!entry_matches_request(request_headers, entry))
                 continue;
             entry.javascript_bytecode_cache = javascript_bytecode_cache;
-            entry.javascript_bytecode_cache_vary_key = vary_key;
+            entry.disk_cache_vary_key = vary_key;
         }
     };
 
@@ -178,4 +178,46 @@ void MemoryCache::update_javascript_bytecode_cache(URL::URL const& url, StringVi
         update_entries(*cache_entries);
 }
 
+static size_t entry_size_in_bytes(MemoryCache::Entry const& entry)
+{
+    auto size = entry.response_body.size();
+    if (entry.javascript_bytecode_cache.has_value())
+        size += entry.javascript_bytecode_cache->size();
+    if (entry.css_parsed_rules_cache.has_value())
+        size += entry.css_parsed_rules_cache->size();
+    return size;
+}
+
+size_t MemoryCache::size_in_bytes() const
+{
+    size_t size = 0;
+
+    for (auto const& it : m_complete_entries) {
+        for (auto const& entry : it.value)
+            size += entry_size_in_bytes(entry);
+    }
+
+    return size;
+}
+
+size_t MemoryCache::remove_stale_entries()
+{
+    size_t removed_size = 0;
+
+    for (auto& it : m_complete_entries) {
+        it.value.remove_all_matching([&](auto const& entry) {
+            auto freshness_lifetime = calculate_freshness_lifetime(entry.status_code, entry.response_headers);
+            auto current_age = calculate_age(entry.response_headers, entry.request_time, entry.response_time);
+            if (freshness_lifetime > current_age)
+                return false;
+
+            removed_size += entry_size_in_bytes(entry);
+            return true;
+        });
+    }
+
+    m_complete_entries.remove_all_matching([](auto, auto const& entries) { return entries.is_empty(); });
+    return removed_size;
+}
+
 }
@@ -29,7 +29,8 @@ public:
         NonnullRefPtr<HeaderList> response_headers;
         Core::ImmutableBytes response_body;
         Optional<Core::ImmutableBytes> javascript_bytecode_cache;
-        Optional<u64> javascript_bytecode_cache_vary_key;
+        Optional<Core::ImmutableBytes> css_parsed_rules_cache;
+        Optional<u64> disk_cache_vary_key;
 
         UnixDateTime request_time;
         UnixDateTime response_time;
@@ -39,10 +40,17 @@ public:
 
     Optional<Entry const&> open_entry(URL::URL const&, StringView method, HeaderList const& request_headers, CacheMode);
 
-    void create_entry(URL::URL const&, StringView method, HeaderList const& request_headers, UnixDateTime request_time, u32 status_code, ByteString reason_phrase, HeaderList const& response_headers, Optional<Core::ImmutableBytes> javascript_bytecode_cache = {}, Optional<u64> javascript_bytecode_cache_vary_key = {});
+    void create_entry(URL::URL const&, StringView method, HeaderList const& request_headers, UnixDateTime request_time, u32 status_code, ByteString reason_phrase, HeaderList const& response_headers, Optional<Core::ImmutableBytes> javascript_bytecode_cache = {}, Optional<Core::ImmutableBytes> css_parsed_rules_cache = {}, Optional<u64> disk_cache_vary_key = {});
     void finalize_entry(URL::URL const&, StringView method, HeaderList const& request_headers, u32 status_code, HeaderList const& response_headers, Core::ImmutableBytes response_body);
     void update_javascript_bytecode_cache(URL::URL const&, StringView method, HeaderList const& request_headers, u64 vary_key, Core::ImmutableBytes javascript_bytecode_cache);
 
+    // The size of the response bodies, bytecode caches and parsed style sheet rules held by complete entries.
+    size_t size_in_bytes() const;
+
+    // Removes the complete entries that are no longer fresh, and could only be used after revalidation. Returns the size
+    // of the response bodies, bytecode caches and parsed style sheet rules that were removed.
+    size_t remove_stale_entries();
+
 private:
     HashMap<u64, Vector<Entry>, IdentityHashTraits<u64>> m_pending_entries;
     HashMap<u64, Vector<Entry>, IdentityHashTraits<u64>> m_complete_entries;
@@ -122,6 +122,10 @@ static constexpr StringView cache_entry_associated_data_suffix(CacheEntryAssocia
         return "jsbc"sv;
     case CacheEntryAssociatedData::WebAssemblyCompiledCode:
         return "wasmjit"sv;
+    case CacheEntryAssociatedData::CSSParsedRules:
+        return "cssrules"sv;
+    case CacheEntryAssociatedData::DecodedFont:
+        return "sfnt"sv;
     }
     VERIFY_NOT_REACHED();
 }
@@ -130,6 +134,10 @@ static constexpr Optional<CacheEntryAssociatedData> cache_entry_associated_data_
 {
     if (suffix == "jsbc"sv)
         return CacheEntryAssociatedData::JavaScriptBytecode;
+    if (suffix == "cssrules"sv)
+        return CacheEntryAssociatedData::CSSParsedRules;
+    if (suffix == "sfnt"sv)
+        return CacheEntryAssociatedData::DecodedFont;
     return {};
 }
 
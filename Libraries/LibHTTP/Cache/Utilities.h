@@ -27,10 +27,14 @@ constexpr inline u64 DEFAULT_MAXIMUM_DISK_CACHE_SIZE = 5 * GiB;
 enum class CacheEntryAssociatedData {
     JavaScriptBytecode,
     WebAssemblyCompiledCode,
+    CSSParsedRules,
+    DecodedFont,
 };
 constexpr inline Array CACHE_ENTRY_ASSOCIATED_DATA_TYPES {
     CacheEntryAssociatedData::JavaScriptBytecode,
     CacheEntryAssociatedData::WebAssemblyCompiledCode,
+    CacheEntryAssociatedData::CSSParsedRules,
+    CacheEntryAssociatedData::DecodedFont,
 };
 
 i64 compute_maximum_disk_cache_size(u64 free_bytes, u64 limit_maximum_disk_cache_size = DEFAULT_MAXIMUM_DISK_CACHE_SIZE);
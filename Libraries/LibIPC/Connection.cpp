@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ByteReader.h>
 #include <AK/Vector.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Message.h>
@@ -13,10 +14,12 @@
 
 namespace IPC {
 
-ConnectionBase::ConnectionBase(IPC::Stub& local_stub, NonnullOwnPtr<Transport> transport, u32 local_endpoint_magic)
+ConnectionBase::ConnectionBase(IPC::Stub& local_stub, NonnullOwnPtr<Transport> transport, u32 local_endpoint_magic, MessageStatistics* local_statistics, MessageStatistics* peer_statistics)
     : m_local_stub(local_stub)
     , m_transport(move(transport))
     , m_local_endpoint_magic(local_endpoint_magic)
+    , m_local_statistics(local_statistics)
+    , m_peer_statistics(peer_statistics)
 {
     m_transport->set_up_read_hook([this] {
         NonnullRefPtr protect = *this;
@@ -45,11 +48,37 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer& buffer)
     if (!m_transport->is_open())
         return Error::from_string_literal("Trying to post_message during IPC shutdown");
 
+    // Every message starts with the endpoint magic and message ID, see the generated encode() methods.
+    if (auto const& data = buffer.data(); data.size() >= sizeof(u32) + sizeof(i32)) {
+        auto endpoint_magic = AK::ByteReader::load32(data.data());
+        auto message_id = static_cast<i32>(AK::ByteReader::load32(data.data() + sizeof(u32)));
+        if (auto* statistics = statistics_for_endpoint(endpoint_magic))
+            statistics->record_sent(message_id, data.size(), buffer.attachments().size());
+    }
+
     TRY(buffer.transfer_message(*m_transport));
 
     return {};
 }
 
+MessageStatistics* ConnectionBase::statistics_for_endpoint(u32 endpoint_magic) const
+{
+    if (m_local_statistics && m_local_statistics->magic() == endpoint_magic)
+        return m_local_statistics;
+    if (m_peer_statistics && m_peer_statistics->magic() == endpoint_magic)
+        return m_peer_statistics;
+    return nullptr;
+}
+
+void ConnectionBase::enable_shared_memory_ring([[maybe_unused]] size_t capacity)
+{
+#if !defined(AK_OS_MACOS) && !defined(AK_OS_WINDOWS)
+    // The socket keeps working on its own, so failing to set up the ring only costs performance.
+    if (auto result = m_transport->enable_shared_memory_ring(capacity); result.is_error())
+        dbgln("IPC::ConnectionBase: Failed to enable shared memory ring: {}", result.error());
+#endif
+}
+
 void ConnectionBase::shutdown()
 {
     m_transport->close();
@@ -73,7 +102,16 @@ void ConnectionBase::handle_messages()
         if (!is_open())
             dbgln("Handling message while connection closed: {}", message->message_name());
 
+        MessageTypeStatistics* statistics = m_local_statistics ? m_local_statistics->for_message(message->message_id()) : nullptr;
+        auto start_time = MonotonicTime::now();
+        if (statistics && message->received_time().has_value())
+            statistics->queueing_delay.record(start_time - *message->received_time());
+
         auto handler_result = m_local_stub.handle(move(message));
+
+        if (statistics)
+            statistics->handler_time.record(MonotonicTime::now() - start_time);
+
         if (handler_result.is_error()) {
             dbgln("IPC::ConnectionBase::handle_messages: {}", handler_result.error());
             continue;
@@ -100,7 +138,11 @@ ConnectionBase::PeerEOF ConnectionBase::drain_messages_from_peer()
     bool parse_error = false;
     auto schedule_shutdown = m_transport->read_as_many_messages_as_possible_without_blocking([&](auto&& raw_message) {
         auto bytes = raw_message.bytes.bytes();
+        auto attachment_count = raw_message.attachments.size();
         if (auto message = try_parse_message(bytes, raw_message.attachments)) {
+            if (auto* statistics = statistics_for_endpoint(message->endpoint_magic()))
+                statistics->record_received(message->message_id(), bytes.size(), attachment_count);
+            message->set_received_time(MonotonicTime::now());
             m_unprocessed_messages.append(message.release_nonnull());
         } else {
             dbgln("Failed to parse IPC message {:hex-dump}", bytes);
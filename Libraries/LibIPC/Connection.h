@@ -15,6 +15,7 @@
 #include <LibIPC/Attachment.h>
 #include <LibIPC/Forward.h>
 #include <LibIPC/Message.h>
+#include <LibIPC/MessageStatistics.h>
 #include <LibIPC/Transport.h>
 
 namespace IPC {
@@ -34,8 +35,12 @@ public:
 
     Transport& transport() const { return *m_transport; }
 
+    // Posts messages through a shared memory ring of the given capacity from now on, if the transport supports that.
+    // Worth it for connections that carry many small messages per frame, such as input events or paint commands.
+    void enable_shared_memory_ring(size_t capacity);
+
 protected:
-    explicit ConnectionBase(IPC::Stub&, NonnullOwnPtr<Transport>, u32 local_endpoint_magic);
+    explicit ConnectionBase(IPC::Stub&, NonnullOwnPtr<Transport>, u32 local_endpoint_magic, MessageStatistics* local_statistics = nullptr, MessageStatistics* peer_statistics = nullptr);
 
     virtual void shutdown_with_error(Error const&);
     virtual OwnPtr<Message> try_parse_message(ReadonlyBytes, Queue<Attachment>&) = 0;
@@ -50,6 +55,8 @@ protected:
 
     void handle_messages();
 
+    MessageStatistics* statistics_for_endpoint(u32 endpoint_magic) const;
+
     AK::ThreadID m_owner_thread_id { AK::ThreadID::current() };
 
     IPC::Stub& m_local_stub;
@@ -59,34 +66,50 @@ protected:
     Vector<NonnullOwnPtr<Message>> m_unprocessed_messages;
 
     u32 m_local_endpoint_magic { 0 };
+
+    MessageStatistics* m_local_statistics { nullptr };
+    MessageStatistics* m_peer_statistics { nullptr };
 };
 
 template<typename LocalEndpoint, typename PeerEndpoint>
 class Connection : public ConnectionBase {
 public:
     Connection(IPC::Stub& local_stub, NonnullOwnPtr<Transport> transport)
-        : ConnectionBase(local_stub, move(transport), LocalEndpoint::static_magic())
+        : ConnectionBase(local_stub, move(transport), LocalEndpoint::static_magic(), &LocalEndpoint::statistics(), &PeerEndpoint::statistics())
     {
     }
 
     template<typename RequestType, typename... Args>
     NonnullOwnPtr<typename RequestType::ResponseType> send_sync(Args&&... args)
     {
+        auto start_time = MonotonicTime::now();
         MUST(post_message(RequestType(forward<Args>(args)...)));
         auto response = wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
         VERIFY(response);
+        record_round_trip<RequestType>(start_time);
         return response.release_nonnull();
     }
 
     template<typename RequestType, typename... Args>
     OwnPtr<typename RequestType::ResponseType> send_sync_but_allow_failure(Args&&... args)
     {
+        auto start_time = MonotonicTime::now();
         if (post_message(RequestType(forward<Args>(args)...)).is_error())
             return nullptr;
-        return wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
+        auto response = wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
+        if (response)
+            record_round_trip<RequestType>(start_time);
+        return response;
     }
 
 protected:
+    template<typename RequestType>
+    void record_round_trip(MonotonicTime start_time)
+    {
+        if (auto* statistics = PeerEndpoint::statistics().for_message(RequestType::static_message_id()))
+            statistics->round_trip_time.record(MonotonicTime::now() - start_time);
+    }
+
     template<typename MessageType, typename Endpoint>
     OwnPtr<MessageType> wait_for_specific_endpoint_message()
     {
@@ -8,7 +8,9 @@
 #pragma once
 
 #include <AK/Error.h>
+#include <AK/Optional.h>
 #include <AK/StringView.h>
+#include <AK/Time.h>
 #include <AK/Vector.h>
 #include <LibIPC/Attachment.h>
 #include <LibIPC/Forward.h>
@@ -63,8 +65,15 @@ public:
     virtual StringView message_name() const = 0;
     virtual ErrorOr<MessageBuffer> encode() const = 0;
 
+    // When the message was taken off the transport, if it was received rather than constructed locally.
+    Optional<MonotonicTime> received_time() const { return m_received_time; }
+    void set_received_time(MonotonicTime time) { m_received_time = time; }
+
 protected:
     Message() = default;
+
+private:
+    Optional<MonotonicTime> m_received_time;
 };
 
 }
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BuiltinWrappers.h>
+#include <AK/HashMap.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <LibIPC/MessageStatistics.h>
+#include <LibSync/Mutex.h>
+
+namespace IPC {
+
+void LatencyHistogram::record(AK::Duration duration)
+{
+    auto microseconds = static_cast<u64>(max<i64>(duration.to_microseconds(), 0));
+    size_t bucket = microseconds == 0 ? 0 : min<size_t>(count_required_bits(microseconds), BUCKET_COUNT - 1);
+
+    m_buckets[bucket].fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    m_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    m_total_microseconds.fetch_add(microseconds, AK::MemoryOrder::memory_order_relaxed);
+}
+
+JsonObject LatencyHistogram::to_json() const
+{
+    // Trailing empty buckets are left out to keep snapshots small.
+    JsonArray buckets;
+    size_t used_bucket_count = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        if (m_buckets[i].load(AK::MemoryOrder::memory_order_relaxed) != 0)
+            used_bucket_count = i + 1;
+    }
+    for (size_t i = 0; i < used_bucket_count; ++i)
+        buckets.must_append(m_buckets[i].load(AK::MemoryOrder::memory_order_relaxed));
+
+    JsonObject object;
+    object.set("count"sv, count());
+    object.set("totalMicroseconds"sv, m_total_microseconds.load(AK::MemoryOrder::memory_order_relaxed));
+    object.set("buckets"sv, move(buckets));
+    return object;
+}
+
+struct Registry {
+    Sync::Mutex mutex;
+    HashMap<u32, NonnullOwnPtr<MessageStatistics>> endpoints;
+};
+
+static Registry& registry()
+{
+    static Registry& registry = *new Registry;
+    return registry;
+}
+
+MessageStatistics::MessageStatistics(u32 magic, StringView name, ReadonlySpan<StringView> message_names)
+    : m_magic(magic)
+    , m_name(name)
+    , m_message_names(message_names)
+{
+    m_messages.ensure_capacity(message_names.size());
+    for (size_t i = 0; i < message_names.size(); ++i)
+        m_messages.unchecked_append(make<MessageTypeStatistics>());
+}
+
+MessageStatistics& MessageStatistics::for_endpoint(u32 magic, StringView name, ReadonlySpan<StringView> message_names)
+{
+    auto& registry = IPC::registry();
+    Sync::MutexLocker locker(registry.mutex);
+
+    // NB: Each library that includes a generated endpoint header has its own copy of Endpoint::statistics(), so the
+    //     same endpoint may be asked for more than once.
+    auto& statistics = registry.endpoints.ensure(magic, [&] {
+        return adopt_own(*new MessageStatistics(magic, name, message_names));
+    });
+    return *statistics;
+}
+
+JsonArray MessageStatistics::snapshot()
+{
+    auto& registry = IPC::registry();
+    Sync::MutexLocker locker(registry.mutex);
+
+    JsonArray endpoints;
+    for (auto const& it : registry.endpoints)
+        endpoints.must_append(it.value->to_json());
+    return endpoints;
+}
+
+MessageTypeStatistics* MessageStatistics::for_message(i32 message_id)
+{
+    if (message_id < 1 || static_cast<size_t>(message_id) > m_messages.size())
+        return nullptr;
+    return m_messages[message_id - 1].ptr();
+}
+
+void MessageStatistics::record_sent(i32 message_id, size_t byte_count, size_t attachment_count)
+{
+    auto* message = for_message(message_id);
+    if (!message)
+        return;
+    message->sent_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    message->sent_bytes.fetch_add(byte_count, AK::MemoryOrder::memory_order_relaxed);
+    message->sent_attachment_count.fetch_add(attachment_count, AK::MemoryOrder::memory_order_relaxed);
+}
+
+void MessageStatistics::record_received(i32 message_id, size_t byte_count, size_t attachment_count)
+{
+    auto* message = for_message(message_id);
+    if (!message)
+        return;
+    message->received_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    message->received_bytes.fetch_add(byte_count, AK::MemoryOrder::memory_order_relaxed);
+    message->received_attachment_count.fetch_add(attachment_count, AK::MemoryOrder::memory_order_relaxed);
+}
+
+JsonObject MessageStatistics::to_json() const
+{
+    JsonArray messages;
+    for (size_t i = 0; i < m_messages.size(); ++i) {
+        auto const& message = *m_messages[i];
+        auto sent_count = message.sent_count.load(AK::MemoryOrder::memory_order_relaxed);
+        auto received_count = message.received_count.load(AK::MemoryOrder::memory_order_relaxed);
+        if (sent_count == 0 && received_count == 0)
+            continue;
+
+        JsonObject object;
+        object.set("name"sv, m_message_names[i]);
+        object.set("sentCount"sv, sent_count);
+        object.set("sentBytes"sv, message.sent_bytes.load(AK::MemoryOrder::memory_order_relaxed));
+        object.set("sentAttachments"sv, message.sent_attachment_count.load(AK::MemoryOrder::memory_order_relaxed));
+        object.set("receivedCount"sv, received_count);
+        object.set("receivedBytes"sv, message.received_bytes.load(AK::MemoryOrder::memory_order_relaxed));
+        object.set("receivedAttachments"sv, message.received_attachment_count.load(AK::MemoryOrder::memory_order_relaxed));
+        object.set("queueingDelay"sv, message.queueing_delay.to_json());
+        object.set("handlerTime"sv, message.handler_time.to_json());
+        if (message.round_trip_time.count() != 0)
+            object.set("roundTripTime"sv, message.round_trip_time.to_json());
+        messages.must_append(move(object));
+    }
+
+    JsonObject object;
+    object.set("endpoint"sv, m_name);
+    object.set("messages"sv, move(messages));
+    return object;
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/Forward.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Noncopyable.h>
+#include <AK/StringView.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+
+namespace IPC {
+
+// Counts durations in power-of-two buckets of microseconds: Bucket 0 holds everything under a microsecond, bucket i
+// holds [2^(i-1), 2^i) microseconds, and the last bucket also holds everything longer.
+class LatencyHistogram {
+    AK_MAKE_NONCOPYABLE(LatencyHistogram);
+    AK_MAKE_NONMOVABLE(LatencyHistogram);
+
+public:
+    static constexpr size_t BUCKET_COUNT = 24;
+
+    LatencyHistogram() = default;
+
+    void record(AK::Duration);
+
+    u64 count() const { return m_count.load(AK::MemoryOrder::memory_order_relaxed); }
+    JsonObject to_json() const;
+
+private:
+    Array<Atomic<u64>, BUCKET_COUNT> m_buckets {};
+    Atomic<u64> m_count { 0 };
+    Atomic<u64> m_total_microseconds { 0 };
+};
+
+// The counters of one message type. All of them are updated with relaxed atomics, since messages may be posted from
+// any thread, and a snapshot only needs to be roughly consistent.
+struct MessageTypeStatistics {
+    Atomic<u64> sent_count { 0 };
+    Atomic<u64> sent_bytes { 0 };
+    Atomic<u64> sent_attachment_count { 0 };
+
+    Atomic<u64> received_count { 0 };
+    Atomic<u64> received_bytes { 0 };
+    Atomic<u64> received_attachment_count { 0 };
+
+    // From taking the message off the transport until its handler runs.
+    LatencyHistogram queueing_delay;
+    LatencyHistogram handler_time;
+
+    // From posting a synchronous request until its response arrives. Only recorded for requests.
+    LatencyHistogram round_trip_time;
+};
+
+// Per-message-type counters for one endpoint, shared by every connection of this process that uses the endpoint. The
+// IPC compiler registers one of these for every endpoint, see the generated Endpoint::statistics().
+class MessageStatistics {
+    AK_MAKE_NONCOPYABLE(MessageStatistics);
+    AK_MAKE_NONMOVABLE(MessageStatistics);
+
+public:
+    // Returns the statistics of the endpoint with the given magic, creating them on first use. The message names are
+    // indexed by message ID - 1, as that is how the IPC compiler numbers messages.
+    static MessageStatistics& for_endpoint(u32 magic, StringView name, ReadonlySpan<StringView> message_names);
+
+    // Serializes the statistics of every endpoint this process has used.
+    static JsonArray snapshot();
+
+    u32 magic() const { return m_magic; }
+    StringView name() const { return m_name; }
+
+    MessageTypeStatistics* for_message(i32 message_id);
+
+    void record_sent(i32 message_id, size_t byte_count, size_t attachment_count);
+    void record_received(i32 message_id, size_t byte_count, size_t attachment_count);
+
+    JsonObject to_json() const;
+
+private:
+    MessageStatistics(u32 magic, StringView name, ReadonlySpan<StringView> message_names);
+
+    u32 m_magic { 0 };
+    StringView m_name;
+    ReadonlySpan<StringView> m_message_names;
+    Vector<NonnullOwnPtr<MessageTypeStatistics>> m_messages;
+};
+
+}
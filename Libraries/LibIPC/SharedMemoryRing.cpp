@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ScopeGuard.h>
+#include <LibCore/System.h>
+#include <LibIPC/Limits.h>
+#include <LibIPC/SharedMemoryRing.h>
+#include <fcntl.h>
+
+#if defined(AK_OS_LINUX)
+#    include <sys/eventfd.h>
+#endif
+
+namespace IPC {
+
+static_assert(sizeof(Atomic<u64>) == sizeof(u64));
+static_assert(sizeof(SharedMemoryRingHeader) % 8 == 0);
+
+struct RecordHeader {
+    u32 payload_size { 0 };
+    u32 sequence { 0 };
+};
+static_assert(sizeof(RecordHeader) == 8);
+
+// Records are padded so that every record header starts 8-byte aligned. Since the capacity is a power of two, a record
+// header then never wraps around the end of the ring, only its payload can.
+static constexpr size_t RECORD_ALIGNMENT = 8;
+
+static u64 record_size(size_t payload_size)
+{
+    return round_up_to_power_of_two(sizeof(RecordHeader) + payload_size, RECORD_ALIGNMENT);
+}
+
+static void copy_into_ring(u8* data, size_t capacity, u64 position, ReadonlyBytes bytes)
+{
+    auto offset = position & (capacity - 1);
+    auto first_part = min(bytes.size(), capacity - offset);
+    memcpy(data + offset, bytes.data(), first_part);
+    memcpy(data, bytes.data() + first_part, bytes.size() - first_part);
+}
+
+static void copy_out_of_ring(u8 const* data, size_t capacity, u64 position, Bytes bytes)
+{
+    auto offset = position & (capacity - 1);
+    auto first_part = min(bytes.size(), capacity - offset);
+    memcpy(bytes.data(), data + offset, first_part);
+    memcpy(bytes.data() + first_part, data, bytes.size() - first_part);
+}
+
+static bool is_valid_capacity(u64 capacity)
+{
+    return is_power_of_two(capacity) && capacity >= SharedMemoryRingWriter::MIN_CAPACITY && capacity <= SharedMemoryRingWriter::MAX_CAPACITY;
+}
+
+static ErrorOr<Array<int, 2>> create_doorbell()
+{
+#if defined(AK_OS_LINUX)
+    int fd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (fd < 0)
+        return Error::from_syscall("eventfd"sv, errno);
+    auto duplicate = Core::System::dup(fd);
+    if (duplicate.is_error()) {
+        (void)Core::System::close(fd);
+        return duplicate.release_error();
+    }
+    return Array { fd, duplicate.value() };
+#else
+    auto fds = TRY(Core::System::pipe2(O_CLOEXEC | O_NONBLOCK));
+    return Array { fds[1], fds[0] };
+#endif
+}
+
+SharedMemoryRingWriter::SharedMemoryRingWriter(Core::AnonymousBuffer buffer, size_t capacity, NonnullRefPtr<AutoCloseFileDescriptor> doorbell_fd, NonnullRefPtr<AutoCloseFileDescriptor> doorbell_fd_for_reader)
+    : m_buffer(move(buffer))
+    , m_header(new (m_buffer.data<void>()) SharedMemoryRingHeader)
+    , m_data(m_buffer.data<u8>() + sizeof(SharedMemoryRingHeader))
+    , m_capacity(capacity)
+    , m_doorbell_fd(move(doorbell_fd))
+    , m_doorbell_fd_for_reader(move(doorbell_fd_for_reader))
+{
+}
+
+ErrorOr<NonnullOwnPtr<SharedMemoryRingWriter>> SharedMemoryRingWriter::create(size_t capacity)
+{
+    if (!is_valid_capacity(capacity))
+        return Error::from_string_literal("Shared memory ring capacity must be a power of two within the supported range");
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(sizeof(SharedMemoryRingHeader) + capacity, Core::AnonymousBuffer::Sealability::Sealable));
+
+#if defined(F_ADD_SEALS) && defined(F_SEAL_GROW) && defined(F_SEAL_SHRINK) && defined(F_SEAL_SEAL)
+    // The reader refuses buffers whose size is not sealed, since shrinking them would make it crash on access.
+    TRY(Core::System::fcntl(buffer.fd(), F_ADD_SEALS, F_SEAL_GROW | F_SEAL_SHRINK | F_SEAL_SEAL));
+#endif
+
+    auto doorbell_fds = TRY(create_doorbell());
+    auto doorbell_fd = adopt_ref(*new AutoCloseFileDescriptor(doorbell_fds[0]));
+    auto doorbell_fd_for_reader = adopt_ref(*new AutoCloseFileDescriptor(doorbell_fds[1]));
+
+    return adopt_nonnull_own_or_enomem(new (nothrow) SharedMemoryRingWriter(move(buffer), capacity, move(doorbell_fd), move(doorbell_fd_for_reader)));
+}
+
+ErrorOr<Vector<Attachment>> SharedMemoryRingWriter::attachments_for_reader() const
+{
+    Vector<Attachment> attachments;
+    for (auto fd : { m_buffer.fd(), m_doorbell_fd_for_reader->value() }) {
+        auto duplicate = TRY(Core::System::dup(fd));
+        attachments.append(Attachment::from_fd(duplicate));
+        TRY(Core::System::set_close_on_exec(duplicate, true));
+    }
+    return attachments;
+}
+
+bool SharedMemoryRingWriter::try_write(u32 sequence, ReadonlyBytes bytes)
+{
+    auto size = record_size(bytes.size());
+
+    // The read position comes from the peer, so it is only trusted as far as it is consistent with our own.
+    auto read_position = m_header->read_position.load(AK::MemoryOrder::memory_order_acquire);
+    auto used = m_write_position - read_position;
+    if (used > m_capacity || size > m_capacity - used)
+        return false;
+
+    RecordHeader header { .payload_size = static_cast<u32>(bytes.size()), .sequence = sequence };
+    copy_into_ring(m_data, m_capacity, m_write_position, { reinterpret_cast<u8 const*>(&header), sizeof(header) });
+    copy_into_ring(m_data, m_capacity, m_write_position + sizeof(header), bytes);
+    m_write_position += size;
+    m_header->write_position.store(m_write_position, AK::MemoryOrder::memory_order_release);
+
+    // Pairs with the fence in prepare_to_wait(): either the reader sees the new write position before it sleeps, or we
+    // see that it is waiting and wake it up.
+    AK::atomic_thread_fence(AK::MemoryOrder::memory_order_seq_cst);
+    if (m_header->reader_is_waiting.load(AK::MemoryOrder::memory_order_relaxed) != 0
+        && m_header->reader_is_waiting.exchange(0, AK::MemoryOrder::memory_order_acq_rel) != 0)
+        ring_doorbell();
+
+    return true;
+}
+
+void SharedMemoryRingWriter::ring_doorbell()
+{
+    // A full doorbell already has a wakeup pending, so EAGAIN is fine here.
+    u64 value = 1;
+    (void)Core::System::write(m_doorbell_fd->value(), { reinterpret_cast<u8 const*>(&value), sizeof(value) });
+}
+
+SharedMemoryRingReader::SharedMemoryRingReader(Core::AnonymousBuffer buffer, size_t capacity, NonnullRefPtr<AutoCloseFileDescriptor> doorbell_fd)
+    : m_buffer(move(buffer))
+    , m_header(static_cast<SharedMemoryRingHeader*>(m_buffer.data<void>()))
+    , m_data(m_buffer.data<u8>() + sizeof(SharedMemoryRingHeader))
+    , m_capacity(capacity)
+    , m_doorbell_fd(move(doorbell_fd))
+{
+}
+
+ErrorOr<NonnullOwnPtr<SharedMemoryRingReader>> SharedMemoryRingReader::adopt(int buffer_fd, int doorbell_fd, u64 capacity)
+{
+    auto doorbell = adopt_ref(*new AutoCloseFileDescriptor(doorbell_fd));
+    ArmedScopeGuard close_buffer_fd { [&] { (void)Core::System::close(buffer_fd); } };
+
+    if (!is_valid_capacity(capacity))
+        return Error::from_string_literal("Shared memory ring capacity must be a power of two within the supported range");
+    auto size = sizeof(SharedMemoryRingHeader) + capacity;
+
+#if defined(F_GET_SEALS) && defined(F_SEAL_GROW) && defined(F_SEAL_SHRINK)
+    auto seals = TRY(Core::System::fcntl(buffer_fd, F_GET_SEALS, static_cast<uintptr_t>(0)));
+    if ((seals & (F_SEAL_GROW | F_SEAL_SHRINK)) != (F_SEAL_GROW | F_SEAL_SHRINK))
+        return Error::from_string_literal("Shared memory ring buffer size is not sealed");
+#endif
+
+    auto file_status = TRY(Core::System::fstat(buffer_fd));
+    if (file_status.st_size < 0 || static_cast<u64>(file_status.st_size) < size)
+        return Error::from_string_literal("Shared memory ring buffer is smaller than its claimed size");
+
+    // The peer decides how the doorbell was opened, but we must never block reading from it.
+    TRY(Core::System::set_close_on_exec(doorbell->value(), true));
+    auto flags = TRY(Core::System::fcntl(doorbell->value(), F_GETFL, static_cast<uintptr_t>(0)));
+    TRY(Core::System::fcntl(doorbell->value(), F_SETFL, flags | O_NONBLOCK));
+
+    close_buffer_fd.disarm();
+    auto buffer = TRY(Core::AnonymousBuffer::create_from_anon_fd(buffer_fd, size));
+    return adopt_nonnull_own_or_enomem(new (nothrow) SharedMemoryRingReader(move(buffer), capacity, move(doorbell)));
+}
+
+bool SharedMemoryRingReader::has_data() const
+{
+    return m_header->write_position.load(AK::MemoryOrder::memory_order_acquire) != m_read_position;
+}
+
+ErrorOr<void> SharedMemoryRingReader::read_available(size_t max_message_count, Function<void(u32 sequence, Vector<u8>&&)> const& callback)
+{
+    auto write_position = m_header->write_position.load(AK::MemoryOrder::memory_order_acquire);
+    auto available = write_position - m_read_position;
+    if (available > m_capacity || available % RECORD_ALIGNMENT != 0)
+        return Error::from_string_literal("Shared memory ring write position is inconsistent");
+
+    for (size_t message_count = 0; message_count < max_message_count && m_read_position != write_position; ++message_count) {
+        RecordHeader header;
+        copy_out_of_ring(m_data, m_capacity, m_read_position, { reinterpret_cast<u8*>(&header), sizeof(header) });
+        if (header.payload_size > MAX_MESSAGE_PAYLOAD_SIZE)
+            return Error::from_string_literal("Shared memory ring record exceeds the message size limit");
+
+        auto size = record_size(header.payload_size);
+        if (size > write_position - m_read_position)
+            return Error::from_string_literal("Shared memory ring record extends past the write position");
+
+        Vector<u8> payload;
+        TRY(payload.try_resize(header.payload_size));
+        copy_out_of_ring(m_data, m_capacity, m_read_position + sizeof(header), payload.span());
+
+        m_read_position += size;
+        m_header->read_position.store(m_read_position, AK::MemoryOrder::memory_order_release);
+
+        callback(header.sequence, move(payload));
+    }
+    return {};
+}
+
+bool SharedMemoryRingReader::prepare_to_wait()
+{
+    m_header->reader_is_waiting.store(1, AK::MemoryOrder::memory_order_relaxed);
+    AK::atomic_thread_fence(AK::MemoryOrder::memory_order_seq_cst);
+    if (!has_data())
+        return true;
+    m_header->reader_is_waiting.store(0, AK::MemoryOrder::memory_order_relaxed);
+    return false;
+}
+
+void SharedMemoryRingReader::finish_wait()
+{
+    m_header->reader_is_waiting.store(0, AK::MemoryOrder::memory_order_relaxed);
+}
+
+void SharedMemoryRingReader::clear_doorbell()
+{
+    // The doorbell is non-blocking, so EAGAIN is expected if we were woken up by something else.
+    u8 buffer[64];
+    (void)Core::System::read(m_doorbell_fd->value(), { buffer, sizeof(buffer) });
+}
+
+}
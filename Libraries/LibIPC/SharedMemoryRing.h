@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Error.h>
+#include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibIPC/Attachment.h>
+#include <LibIPC/AutoCloseFileDescriptor.h>
+
+namespace IPC {
+
+// A single-producer, single-consumer ring of variable-sized messages in memory shared between two processes. Each
+// side keeps its own position privately and only publishes it through the shared header, so that a misbehaving peer
+// can at worst corrupt the messages it sends itself.
+//
+// The reader sleeps on a doorbell (an eventfd where available, a pipe elsewhere) which the writer only rings when the
+// reader has announced that it is about to sleep. A burst of messages therefore costs at most one wakeup.
+struct SharedMemoryRingHeader {
+    alignas(64) Atomic<u64> write_position { 0 };
+    alignas(64) Atomic<u64> read_position { 0 };
+    alignas(64) Atomic<u32> reader_is_waiting { 0 };
+};
+
+class SharedMemoryRingWriter {
+    AK_MAKE_NONCOPYABLE(SharedMemoryRingWriter);
+    AK_MAKE_NONMOVABLE(SharedMemoryRingWriter);
+
+public:
+    static constexpr size_t MIN_CAPACITY = 4 * KiB;
+    static constexpr size_t MAX_CAPACITY = 16 * MiB;
+
+    static ErrorOr<NonnullOwnPtr<SharedMemoryRingWriter>> create(size_t capacity);
+
+    size_t capacity() const { return m_capacity; }
+
+    // The shared buffer and the reading end of the doorbell, to be sent to the peer.
+    ErrorOr<Vector<Attachment>> attachments_for_reader() const;
+
+    // Returns false if the message does not fit into the free part of the ring, in which case it has to be sent some
+    // other way.
+    [[nodiscard]] bool try_write(u32 sequence, ReadonlyBytes);
+
+private:
+    SharedMemoryRingWriter(Core::AnonymousBuffer, size_t capacity, NonnullRefPtr<AutoCloseFileDescriptor> doorbell_fd, NonnullRefPtr<AutoCloseFileDescriptor> doorbell_fd_for_reader);
+
+    void ring_doorbell();
+
+    Core::AnonymousBuffer m_buffer;
+    SharedMemoryRingHeader* m_header { nullptr };
+    u8* m_data { nullptr };
+    size_t m_capacity { 0 };
+    u64 m_write_position { 0 };
+
+    NonnullRefPtr<AutoCloseFileDescriptor> m_doorbell_fd;
+    NonnullRefPtr<AutoCloseFileDescriptor> m_doorbell_fd_for_reader;
+};
+
+class SharedMemoryRingReader {
+    AK_MAKE_NONCOPYABLE(SharedMemoryRingReader);
+    AK_MAKE_NONMOVABLE(SharedMemoryRingReader);
+
+public:
+    // Takes ownership of both file descriptors, even if adopting them fails.
+    static ErrorOr<NonnullOwnPtr<SharedMemoryRingReader>> adopt(int buffer_fd, int doorbell_fd, u64 capacity);
+
+    int doorbell_fd() const { return m_doorbell_fd->value(); }
+
+    bool has_data() const;
+
+    // Copies up to max_message_count of the messages the writer has published so far out of the ring. An error means
+    // the peer corrupted the ring, which should be treated like it hanging up.
+    ErrorOr<void> read_available(size_t max_message_count, Function<void(u32 sequence, Vector<u8>&&)> const&);
+
+    // Announces that the reader is about to sleep on the doorbell. Returns false if there is something to read
+    // already, in which case the reader should not sleep.
+    [[nodiscard]] bool prepare_to_wait();
+    void finish_wait();
+
+    // Consumes the wakeups that were delivered through the doorbell.
+    void clear_doorbell();
+
+private:
+    SharedMemoryRingReader(Core::AnonymousBuffer, size_t capacity, NonnullRefPtr<AutoCloseFileDescriptor> doorbell_fd);
+
+    Core::AnonymousBuffer m_buffer;
+    SharedMemoryRingHeader* m_header { nullptr };
+    u8 const* m_data { nullptr };
+    size_t m_capacity { 0 };
+    u64 m_read_position { 0 };
+
+    NonnullRefPtr<AutoCloseFileDescriptor> m_doorbell_fd;
+};
+
+}
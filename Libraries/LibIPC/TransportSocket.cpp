@@ -21,6 +21,12 @@
 
 namespace IPC {
 
+struct SharedMemoryRingSetupPayload {
+    u64 capacity { 0 };
+    // The sequence number of the first message the sender posts after setting up the ring.
+    u32 next_sequence { 0 };
+};
+
 Atomic<u32> TransportSocket::s_eof_drain_window_for_test_ms { 0 };
 Atomic<bool> TransportSocket::s_skip_inloop_read_for_test { false };
 
@@ -178,7 +184,7 @@ TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
 
 intptr_t TransportSocket::io_thread_loop()
 {
-    Array<struct pollfd, 2> pollfds;
+    Array<struct pollfd, 3> pollfds;
     for (;;) {
         auto want_to_write = [&] {
             auto [bytes, fds] = m_send_queue->peek(1);
@@ -199,10 +205,28 @@ intptr_t TransportSocket::io_thread_loop()
         pollfds[0] = { .fd = m_socket->fd().value(), .events = events, .revents = 0 };
         pollfds[1] = { .fd = m_wakeup_io_thread_read_fd->value(), .events = POLLIN, .revents = 0 };
 
+        // The peer only rings the doorbell of the shared memory ring if it sees us waiting on it, so that a burst of
+        // messages costs a single wakeup. If something arrived before we announced that, don't wait at all.
+        size_t pollfd_count = 2;
+        int timeout = -1;
+        bool const is_waiting_on_ring = can_read_from_shared_memory_ring();
+        if (is_waiting_on_ring) {
+            pollfds[2] = { .fd = m_incoming_ring->doorbell_fd(), .events = POLLIN, .revents = 0 };
+            pollfd_count = 3;
+            if (!m_incoming_ring->prepare_to_wait())
+                timeout = 0;
+        }
+
         ErrorOr<int> result { 0 };
         do {
-            result = Core::System::poll(pollfds, -1);
+            result = Core::System::poll(pollfds.span().trim(pollfd_count), timeout);
         } while (result.is_error() && result.error().code() == EINTR);
+
+        if (is_waiting_on_ring) {
+            m_incoming_ring->finish_wait();
+            if (pollfds[2].revents & POLLIN)
+                m_incoming_ring->clear_doorbell();
+        }
         if (result.is_error()) {
             dbgln("TransportSocket poll error: {}", result.error());
             m_io_thread_state = IOThreadState::Stopped;
@@ -217,6 +241,8 @@ intptr_t TransportSocket::io_thread_loop()
 
         if ((pollfds[0].revents & POLLIN) && !s_skip_inloop_read_for_test.load(AK::MemoryOrder::memory_order_relaxed))
             read_incoming_messages();
+        else if (can_read_from_shared_memory_ring() && m_incoming_ring->has_data())
+            read_incoming_messages(IncomingSource::SharedMemoryRing);
 
         if (pollfds[0].revents & POLLHUP) {
             m_io_thread_state = IOThreadState::Stopped;
@@ -248,8 +274,13 @@ intptr_t TransportSocket::io_thread_loop()
         // transform stream's "error") is actually delivered — rather than discarded.
         read_incoming_messages();
 
-        Sync::MutexLocker locker(m_incoming_mutex);
+        // Messages that are still waiting for an earlier one won't get it anymore.
         m_peer_eof = true;
+        Vector<NonnullOwnPtr<Message>> batch;
+        take_incoming_messages_in_sequence(batch);
+
+        Sync::MutexLocker locker(m_incoming_mutex);
+        m_incoming_messages.extend(move(batch));
         m_incoming_eof = true;
         m_incoming_cv.broadcast();
         notify_read_available();
@@ -340,29 +371,76 @@ static constexpr size_t MAX_UNPROCESSED_BUFFER_SIZE = 128 * MiB;
 // Maximum number of accumulated unprocessed file descriptors before we disconnect the peer
 static constexpr size_t MAX_UNPROCESSED_FDS = 512;
 
+// Maximum number of messages from the socket that may wait for an earlier one from the shared memory ring before we
+// disconnect the peer
+static constexpr size_t MAX_PENDING_SOCKET_MESSAGES = 65536;
+
+// Maximum number of messages from the shared memory ring that may wait for an earlier one from the socket. Beyond that,
+// we leave them in the ring, which makes the peer fall back to the socket once the ring is full.
+static constexpr size_t MAX_PENDING_RING_MESSAGES = 4096;
+
+Vector<int> TransportSocket::retain_fds_until_received_by_peer(Vector<Attachment>& attachments)
+{
+    Vector<int> raw_fds;
+    if (attachments.is_empty())
+        return raw_fds;
+
+    raw_fds.ensure_capacity(attachments.size());
+    Sync::MutexLocker locker(m_fds_retained_until_received_by_peer_mutex);
+    for (auto& attachment : attachments) {
+        int fd = attachment.to_fd();
+        auto auto_fd = adopt_ref(*new AutoCloseFileDescriptor(fd));
+        raw_fds.unchecked_append(auto_fd->value());
+        m_fds_retained_until_received_by_peer.enqueue(move(auto_fd));
+    }
+    return raw_fds;
+}
+
 ErrorOr<void> TransportSocket::post_message(MessageDataType bytes_to_write, Vector<Attachment>& attachments)
 {
-    auto num_fds_to_transfer = attachments.size();
+    Sync::MutexLocker locker(m_send_mutex);
+    auto sequence = m_next_outgoing_sequence++;
+
+    // File descriptors can only be passed through the socket, but everything else takes the shared memory ring if it
+    // has room. The peer then picks the message up without us having to wake our IO thread.
+    if (m_outgoing_ring && attachments.is_empty() && m_outgoing_ring->try_write(sequence, bytes_to_write))
+        return {};
 
     SocketMessageHeader header {
         .type = SocketMessageHeader::Type::Payload,
         .payload_size = static_cast<u32>(bytes_to_write.size()),
-        .fd_count = static_cast<u32>(num_fds_to_transfer),
+        .fd_count = static_cast<u32>(attachments.size()),
+        .sequence = sequence,
     };
 
-    auto raw_fds = Vector<int, 1> {};
-    if (num_fds_to_transfer > 0) {
-        raw_fds.ensure_capacity(num_fds_to_transfer);
-        Sync::MutexLocker locker(m_fds_retained_until_received_by_peer_mutex);
-        for (auto& attachment : attachments) {
-            int fd = attachment.to_fd();
-            auto auto_fd = adopt_ref(*new AutoCloseFileDescriptor(fd));
-            raw_fds.unchecked_append(auto_fd->value());
-            m_fds_retained_until_received_by_peer.enqueue(move(auto_fd));
-        }
-    }
+    m_send_queue->enqueue_message(header, move(bytes_to_write), retain_fds_until_received_by_peer(attachments));
+    wake_io_thread();
+    return {};
+}
+
+ErrorOr<void> TransportSocket::enable_shared_memory_ring(size_t capacity)
+{
+    Sync::MutexLocker locker(m_send_mutex);
+    if (m_outgoing_ring)
+        return Error::from_string_literal("Shared memory ring is already enabled");
+
+    auto ring = TRY(SharedMemoryRingWriter::create(capacity));
+    auto attachments = TRY(ring->attachments_for_reader());
+
+    SharedMemoryRingSetupPayload setup { .capacity = ring->capacity(), .next_sequence = m_next_outgoing_sequence };
+    MessageDataType payload;
+    payload.append(reinterpret_cast<u8 const*>(&setup), sizeof(setup));
+
+    SocketMessageHeader header {
+        .type = SocketMessageHeader::Type::SharedMemoryRingSetup,
+        .payload_size = static_cast<u32>(payload.size()),
+        .fd_count = static_cast<u32>(attachments.size()),
+    };
 
-    m_send_queue->enqueue_message(header, move(bytes_to_write), move(raw_fds));
+    // NB: Messages may be written to the ring before the peer has even received this. The peer will find them once it
+    //     has mapped the ring, and knows from here on which message comes next.
+    m_send_queue->enqueue_message(header, move(payload), retain_fds_until_received_by_peer(attachments));
+    m_outgoing_ring = move(ring);
     wake_io_thread();
     return {};
 }
@@ -416,10 +494,10 @@ TransportSocket::TransferState TransportSocket::transfer_data(ReadonlyBytes& byt
     return TransferState::Continue;
 }
 
-void TransportSocket::read_incoming_messages()
+void TransportSocket::read_incoming_messages(IncomingSource source)
 {
     Vector<NonnullOwnPtr<Message>> batch;
-    while (m_socket->is_open()) {
+    while (source == IncomingSource::SocketAndSharedMemoryRing && m_socket->is_open()) {
         u8 buffer[4096];
         auto received_fds = Vector<int> {};
         auto maybe_bytes_read = m_socket->receive_message({ buffer, 4096 }, MSG_DONTWAIT, received_fds);
@@ -512,7 +590,41 @@ void TransportSocket::read_incoming_messages()
                 break;
             }
             message->bytes = ReceivedMessageBytes::from_vector(move(payload_bytes));
-            batch.append(move(message));
+            // Until the peer sets up a shared memory ring, the socket is the only channel, so its messages are in order.
+            if (!m_incoming_ring) {
+                m_next_incoming_sequence = header.sequence + 1;
+                batch.append(move(message));
+            } else if (m_pending_socket_messages.size() >= MAX_PENDING_SOCKET_MESSAGES) {
+                dbgln("TransportSocket: Pending socket messages would exceed {}, disconnecting peer", MAX_PENDING_SOCKET_MESSAGES);
+                m_peer_eof = true;
+                break;
+            } else {
+                m_pending_socket_messages.enqueue(SequencedMessage { header.sequence, move(message) });
+            }
+        } else if (header.type == SocketMessageHeader::Type::SharedMemoryRingSetup) {
+            if (m_incoming_ring || header.payload_size != sizeof(SharedMemoryRingSetupPayload) || header.fd_count != 2) {
+                dbgln("TransportSocket: Rejecting malformed SharedMemoryRingSetup");
+                m_peer_eof = true;
+                break;
+            }
+            if (sizeof(SocketMessageHeader) + sizeof(SharedMemoryRingSetupPayload) > m_unprocessed_bytes.size() - index)
+                break;
+            if (header.fd_count > m_unprocessed_attachments.size())
+                break;
+            received_fd_count += header.fd_count;
+
+            SharedMemoryRingSetupPayload setup;
+            memcpy(&setup, m_unprocessed_bytes.data() + index + sizeof(SocketMessageHeader), sizeof(setup));
+            auto buffer_fd = m_unprocessed_attachments.dequeue().to_fd();
+            auto doorbell_fd = m_unprocessed_attachments.dequeue().to_fd();
+            auto ring = SharedMemoryRingReader::adopt(buffer_fd, doorbell_fd, setup.capacity);
+            if (ring.is_error()) {
+                dbgln("TransportSocket: Failed to map the peer's shared memory ring: {}", ring.error());
+                m_peer_eof = true;
+                break;
+            }
+            m_incoming_ring = ring.release_value();
+            m_next_incoming_sequence = setup.next_sequence;
         } else if (header.type == SocketMessageHeader::Type::FileDescriptorAcknowledgement) {
             if (header.payload_size != 0) {
                 dbgln("TransportSocket: FileDescriptorAcknowledgement with non-zero payload_size {}", header.payload_size);
@@ -572,6 +684,9 @@ void TransportSocket::read_incoming_messages()
         m_unprocessed_bytes.clear();
     }
 
+    read_from_shared_memory_ring();
+    take_incoming_messages_in_sequence(batch);
+
     bool const peer_eof = m_peer_eof;
     if (!batch.is_empty() || peer_eof) {
         Sync::MutexLocker locker(m_incoming_mutex);
@@ -586,6 +701,67 @@ void TransportSocket::read_incoming_messages()
     }
 }
 
+bool TransportSocket::can_read_from_shared_memory_ring() const
+{
+    return m_incoming_ring && m_pending_ring_messages.size() < MAX_PENDING_RING_MESSAGES;
+}
+
+void TransportSocket::read_from_shared_memory_ring()
+{
+    if (!can_read_from_shared_memory_ring())
+        return;
+
+    auto result = m_incoming_ring->read_available(MAX_PENDING_RING_MESSAGES - m_pending_ring_messages.size(), [&](u32 sequence, Vector<u8>&& bytes) {
+        auto message = make<Message>();
+        message->bytes = ReceivedMessageBytes::from_vector(move(bytes));
+        m_pending_ring_messages.enqueue(SequencedMessage { sequence, move(message) });
+    });
+    if (result.is_error()) {
+        dbgln("TransportSocket: Failed to read from the peer's shared memory ring: {}", result.error());
+        m_peer_eof = true;
+    }
+}
+
+void TransportSocket::take_incoming_messages_in_sequence(Vector<NonnullOwnPtr<Message>>& batch)
+{
+    auto take_next = [&](Queue<SequencedMessage>& queue) {
+        auto pending = queue.dequeue();
+        m_next_incoming_sequence = pending.sequence + 1;
+        batch.append(move(pending.message));
+    };
+    auto is_next = [&](Queue<SequencedMessage> const& queue) {
+        return !queue.is_empty() && queue.head().sequence == m_next_incoming_sequence;
+    };
+
+    for (;;) {
+        if (is_next(m_pending_socket_messages))
+            take_next(m_pending_socket_messages);
+        else if (is_next(m_pending_ring_messages))
+            take_next(m_pending_ring_messages);
+        else
+            break;
+    }
+
+    // Each channel delivers its own messages in order, so the next message can only be missing from one of them.
+    if (!m_pending_socket_messages.is_empty() && !m_pending_ring_messages.is_empty()) {
+        dbgln("TransportSocket: Peer sent messages out of sequence, disconnecting peer");
+        m_peer_eof = true;
+    }
+
+    // Nothing is going to fill the gaps after EOF, so whatever did arrive is delivered in the order it was sent.
+    if (m_peer_eof) {
+        auto distance = [&](Queue<SequencedMessage> const& queue) { return queue.head().sequence - m_next_incoming_sequence; };
+        while (!m_pending_socket_messages.is_empty() || !m_pending_ring_messages.is_empty()) {
+            if (m_pending_ring_messages.is_empty())
+                take_next(m_pending_socket_messages);
+            else if (m_pending_socket_messages.is_empty() || distance(m_pending_ring_messages) < distance(m_pending_socket_messages))
+                take_next(m_pending_ring_messages);
+            else
+                take_next(m_pending_socket_messages);
+        }
+    }
+}
+
 TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possible_without_blocking(Function<void(Message&&)>&& callback)
 {
     Vector<NonnullOwnPtr<Message>> messages;
@@ -602,9 +778,18 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
 
 ErrorOr<TransportHandle> TransportSocket::release_for_transfer()
 {
+    // The shared memory rings belong to this transport, and there is no way to hand them over with the socket.
+    {
+        Sync::MutexLocker locker(m_send_mutex);
+        if (m_outgoing_ring)
+            return Error::from_string_literal("Cannot transfer a transport that sends through a shared memory ring");
+    }
+
     m_is_being_transferred.store(true, AK::MemoryOrder::memory_order_release);
     m_socket_is_open.store(false, AK::MemoryOrder::memory_order_relaxed);
     stop_io_thread(IOThreadState::SendPendingMessagesAndStop);
+    if (m_incoming_ring)
+        return Error::from_string_literal("Cannot transfer a transport that receives through a shared memory ring");
     auto fd = TRY(m_socket->release_fd());
     return TransportHandle { File::adopt_fd(fd) };
 }
@@ -16,6 +16,7 @@
 #include <LibIPC/AutoCloseFileDescriptor.h>
 #include <LibIPC/Forward.h>
 #include <LibIPC/ReceivedMessageBytes.h>
+#include <LibIPC/SharedMemoryRing.h>
 #include <LibIPC/TransportHandle.h>
 #include <LibSync/ConditionVariable.h>
 #include <LibSync/Mutex.h>
@@ -27,10 +28,14 @@ struct SocketMessageHeader {
     enum class Type : u8 {
         Payload = 0,
         FileDescriptorAcknowledgement = 1,
+        SharedMemoryRingSetup = 2,
     };
     Type type { Type::Payload };
     u32 payload_size { 0 };
     u32 fd_count { 0 };
+    // Payloads are numbered, so that the ones sent through the shared memory ring can be put back in order with the
+    // ones sent through the socket.
+    u32 sequence { 0 };
 };
 
 class SendQueue : public AtomicRefCounted<SendQueue> {
@@ -86,6 +91,11 @@ public:
 
     ErrorOr<void> post_message(MessageDataType, Vector<Attachment>& attachments);
 
+    // From now on, posts messages without attachments through a shared memory ring of the given capacity whenever
+    // they fit, which spares both sides the socket syscalls and usually the IO thread hops. Messages that do not fit
+    // still go through the socket. The peer maps the ring once it receives the setup message.
+    ErrorOr<void> enable_shared_memory_ring(size_t capacity);
+
     enum class ShouldShutdown {
         No,
         Yes,
@@ -126,7 +136,16 @@ private:
     intptr_t io_thread_loop();
     void stop_io_thread(IOThreadState desired_state);
     void wake_io_thread();
-    void read_incoming_messages();
+    Vector<int> retain_fds_until_received_by_peer(Vector<Attachment>&);
+
+    enum class IncomingSource {
+        SocketAndSharedMemoryRing,
+        SharedMemoryRing,
+    };
+    void read_incoming_messages(IncomingSource = IncomingSource::SocketAndSharedMemoryRing);
+    bool can_read_from_shared_memory_ring() const;
+    void read_from_shared_memory_ring();
+    void take_incoming_messages_in_sequence(Vector<NonnullOwnPtr<Message>>& batch);
     void notify_read_available();
 
     NonnullOwnPtr<Core::LocalSocket> m_socket;
@@ -140,11 +159,29 @@ private:
 
     RefPtr<Threading::Thread> m_io_thread;
     RefPtr<SendQueue> m_send_queue;
+
+    // Held while a message is numbered and queued, so that messages are queued in the order of their sequence numbers.
+    Sync::Mutex m_send_mutex;
+    u32 m_next_outgoing_sequence { 0 };
+    OwnPtr<SharedMemoryRingWriter> m_outgoing_ring;
+
     Atomic<IOThreadState> m_io_thread_state { IOThreadState::Running };
     Atomic<bool> m_is_being_transferred { false };
     Atomic<bool> m_peer_eof { false };
     ByteBuffer m_unprocessed_bytes;
     Queue<Attachment> m_unprocessed_attachments;
+
+    // Messages that were received out of order, which only happens while messages arrive through both the socket and
+    // the shared memory ring. These are only touched by the IO thread.
+    struct SequencedMessage {
+        u32 sequence { 0 };
+        NonnullOwnPtr<Message> message;
+    };
+    OwnPtr<SharedMemoryRingReader> m_incoming_ring;
+    Queue<SequencedMessage> m_pending_socket_messages;
+    Queue<SequencedMessage> m_pending_ring_messages;
+    u32 m_next_incoming_sequence { 0 };
+
     Sync::Mutex m_incoming_mutex;
     Sync::ConditionVariable m_incoming_cv { m_incoming_mutex };
     Vector<NonnullOwnPtr<Message>> m_incoming_messages;
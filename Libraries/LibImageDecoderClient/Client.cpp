@@ -17,6 +17,7 @@ Client::Client(NonnullOwnPtr<IPC::Transport> transport)
 void Client::die()
 {
     verify_event_loop();
+    m_progressive_decode_buffers.clear();
     auto pending_promises = move(m_token_promises);
 
     for (auto& promise : pending_promises)
@@ -55,7 +56,127 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
     return promise;
 }
 
-void Client::did_decode_image(i64 request_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, i64 session_id)
+Optional<DecodedImage> Client::decode_first_frame_synchronously(ReadonlyBytes encoded_data, Optional<ByteString> mime_type)
+{
+    verify_event_loop();
+    if (encoded_data.is_empty())
+        return {};
+
+    auto encoded_buffer_or_error = Core::AnonymousBuffer::create_with_size(encoded_data.size());
+    if (encoded_buffer_or_error.is_error()) {
+        dbgln("Could not allocate encoded buffer: {}", encoded_buffer_or_error.error());
+        return {};
+    }
+    auto encoded_buffer = encoded_buffer_or_error.release_value();
+    memcpy(encoded_buffer.data<void>(), encoded_data.data(), encoded_data.size());
+
+    auto response = send_sync_but_allow_failure<Messages::ImageDecoderServer::DecodeFirstFrameSynchronously>(encoded_buffer, move(mime_type));
+    if (!response)
+        return {};
+
+    auto bitmaps = response->take_bitmaps();
+    if (!bitmaps.has_value() || bitmaps->bitmaps.size() != 1 || !bitmaps->bitmaps.first())
+        return {};
+
+    auto bitmap = bitmaps->bitmaps.first().release_nonnull();
+    DecodedImage image;
+    image.natural_size = bitmap->size();
+    image.frame_count = 1;
+    image.color_space = response->take_color_profile();
+    image.frames.empend(move(bitmap), 0u);
+    return image;
+}
+
+i64 Client::begin_progressive_decode(Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+{
+    verify_event_loop();
+    i64 request_id = m_next_request_id++;
+    m_progressive_decode_buffers.set(request_id, {});
+    async_begin_progressive_decode(ideal_size, move(mime_type), request_id);
+    return request_id;
+}
+
+// Encoded images are usually larger than a network chunk, so the shared buffer starts out with room for several.
+static constexpr size_t MINIMUM_PROGRESSIVE_DECODE_BUFFER_SIZE = 64 * KiB;
+
+void Client::append_progressive_decode_data(i64 request_id, ReadonlyBytes encoded_data)
+{
+    verify_event_loop();
+    if (encoded_data.is_empty())
+        return;
+
+    auto it = m_progressive_decode_buffers.find(request_id);
+    if (it == m_progressive_decode_buffers.end())
+        return;
+    auto& progressive_decode_buffer = it->value;
+
+    // NB: A full buffer is replaced by one twice the size, so the data is only copied a logarithmic number of times
+    //     rather than sent in a new buffer for every chunk.
+    Optional<Core::AnonymousBuffer> new_buffer;
+    auto required_size = progressive_decode_buffer.size + encoded_data.size();
+    if (required_size > progressive_decode_buffer.buffer.size()) {
+        auto new_size = max(max(progressive_decode_buffer.buffer.size() * 2, MINIMUM_PROGRESSIVE_DECODE_BUFFER_SIZE), required_size);
+        auto buffer_or_error = [&] -> ErrorOr<Core::AnonymousBuffer> {
+            auto buffer = TRY(Core::AnonymousBuffer::create_with_size(new_size, Core::AnonymousBuffer::Sealability::Sealable));
+            TRY(buffer.seal_size());
+            return buffer;
+        }();
+        if (buffer_or_error.is_error()) {
+            dbgln("Could not allocate encoded buffer: {}", buffer_or_error.error());
+            return;
+        }
+
+        auto buffer = buffer_or_error.release_value();
+        if (progressive_decode_buffer.size > 0)
+            memcpy(buffer.data<void>(), progressive_decode_buffer.buffer.data<void>(), progressive_decode_buffer.size);
+        progressive_decode_buffer.buffer = buffer;
+        new_buffer = move(buffer);
+    }
+
+    memcpy(progressive_decode_buffer.buffer.data<u8>() + progressive_decode_buffer.size, encoded_data.data(), encoded_data.size());
+    progressive_decode_buffer.size = required_size;
+    async_append_progressive_decode_data(request_id, move(new_buffer), progressive_decode_buffer.size);
+}
+
+NonnullRefPtr<Core::Promise<DecodedImage>> Client::finish_progressive_decode(i64 request_id, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+{
+    verify_event_loop();
+    auto promise = Core::Promise<DecodedImage>::construct();
+    if (on_resolved)
+        promise->on_resolution = move(on_resolved);
+    if (on_rejected)
+        promise->on_rejection = move(on_rejected);
+
+    m_progressive_decode_buffers.remove(request_id);
+    m_token_promises.set(request_id, promise);
+    async_finish_progressive_decode(request_id);
+
+    return promise;
+}
+
+void Client::cancel_progressive_decode(i64 request_id)
+{
+    verify_event_loop();
+    m_progressive_decode_buffers.remove(request_id);
+    m_token_promises.remove(request_id);
+    async_cancel_decoding(request_id);
+}
+
+void Client::did_decode_progressive_frame(i64 request_id, Gfx::IntSize natural_size, Gfx::BitmapSequence bitmap_sequence)
+{
+    verify_event_loop();
+    if (!on_progressive_frame_decoded)
+        return;
+
+    auto& bitmaps = bitmap_sequence.bitmaps;
+    if (bitmaps.size() != 1 || !bitmaps.first()) {
+        dbgln("ImageDecoderClient: Invalid progressive frame for request {}", request_id);
+        return;
+    }
+    on_progressive_frame_decoded(request_id, natural_size, bitmaps.first().release_nonnull());
+}
+
+void Client::did_decode_image(i64 request_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::IntSize natural_size, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, i64 session_id)
 {
     verify_event_loop();
     auto bitmaps = move(bitmap_sequence.bitmaps);
@@ -73,6 +194,7 @@ void Client::did_decode_image(i64 request_id, bool is_animated, u32 loop_count,
     image.is_animated = is_animated;
     image.loop_count = loop_count;
     image.session_id = session_id;
+    image.natural_size = natural_size;
     image.scale = scale;
     image.frames.ensure_capacity(bitmaps.size());
     image.color_space = move(color_space);
@@ -137,6 +259,13 @@ void Client::did_fail_animation_decode(i64 session_id, String error_message)
         on_animation_decode_failed(session_id, move(error_message));
 }
 
+void Client::did_release_memory(Core::MemoryPressure::Level level, u64 bytes_released)
+{
+    verify_event_loop();
+    if (on_memory_released)
+        on_memory_released(level, bytes_released);
+}
+
 void Client::request_animation_frames(i64 session_id, u32 start_frame_index, u32 count)
 {
     verify_event_loop();
@@ -10,6 +10,7 @@
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/MemoryPressure.h>
 #include <LibCore/Promise.h>
 #include <LibGfx/ColorSpace.h>
 #include <LibIPC/ConnectionToServer.h>
@@ -23,6 +24,8 @@ struct Frame {
 
 struct DecodedImage {
     bool is_animated { false };
+    // The size of the image itself. The frames are smaller than this if a smaller ideal size was asked for.
+    Gfx::IntSize natural_size;
     Gfx::FloatPoint scale { 1, 1 };
     u32 loop_count { 0 };
     u32 frame_count { 0 };
@@ -44,26 +47,50 @@ public:
 
     NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {});
 
+    // Decodes the first frame of an image at its natural size, blocking until it has been decoded. This is only for when
+    // the pixels of an image that was decoded to a smaller ideal size are needed right away.
+    Optional<DecodedImage> decode_first_frame_synchronously(ReadonlyBytes, Optional<ByteString> mime_type = {});
+
+    // Starts decoding an image whose data is still being received. Returns the request id to pass to the other
+    // progressive decode functions. Partial images are reported through on_progressive_frame_decoded.
+    i64 begin_progressive_decode(Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {});
+    void append_progressive_decode_data(i64 request_id, ReadonlyBytes);
+    NonnullRefPtr<Core::Promise<DecodedImage>> finish_progressive_decode(i64 request_id, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected);
+    void cancel_progressive_decode(i64 request_id);
+
     void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count);
     void stop_animation_decode(i64 session_id);
 
     Function<void()> on_death;
     Function<void(i64 session_id, Vector<NonnullRefPtr<Gfx::Bitmap>>)> on_animation_frames_decoded;
     Function<void(i64 session_id, String error_message)> on_animation_decode_failed;
+    Function<void(i64 request_id, Gfx::IntSize natural_size, NonnullRefPtr<Gfx::Bitmap>)> on_progressive_frame_decoded;
+    Function<void(Core::MemoryPressure::Level, u64 bytes_released)> on_memory_released;
 
 private:
     void verify_event_loop() const;
     virtual void die() override;
 
-    virtual void did_decode_image(i64 request_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, i64 session_id) override;
+    virtual void did_decode_image(i64 request_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::IntSize natural_size, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, i64 session_id) override;
     virtual void did_fail_to_decode_image(i64 request_id, String error_message) override;
 
+    virtual void did_decode_progressive_frame(i64 request_id, Gfx::IntSize natural_size, Gfx::BitmapSequence bitmaps) override;
+
     virtual void did_decode_animation_frames(i64 session_id, Gfx::BitmapSequence bitmaps) override;
     virtual void did_fail_animation_decode(i64 session_id, String error_message) override;
+    virtual void did_release_memory(Core::MemoryPressure::Level, u64 bytes_released) override;
 
     Core::EventLoop* m_creation_event_loop { &Core::EventLoop::current() };
     i64 m_next_request_id { 0 };
     HashMap<i64, NonnullRefPtr<Core::Promise<DecodedImage>>> m_token_promises;
+
+    // The encoded data of a progressive decode is written to a buffer shared with the server, which only needs to be
+    // told how much of it has been written.
+    struct ProgressiveDecodeBuffer {
+        Core::AnonymousBuffer buffer;
+        size_t size { 0 };
+    };
+    HashMap<i64, ProgressiveDecodeBuffer> m_progressive_decode_buffers;
 };
 
 }
@@ -116,6 +116,62 @@ ErrorOr<void> ArrayBuffer::try_ensure_capacity(size_t new_capacity)
     return {};
 }
 
+ErrorOr<NonnullRefPtr<SharedMemoryBlock>> ArrayBuffer::ensure_shared_memory_block()
+{
+    VERIFY(is_shared_array_buffer());
+
+    if (auto* storage = m_data_block.byte_buffer.get_pointer<DataBlock::SharedMemoryStorage>())
+        return storage->block;
+
+    // NB: External storage, such as the memory of a shared WebAssembly.Memory, is owned elsewhere and keeps being
+    //     written to there. Copying it into a new block would silently split the buffer in two.
+    if (is_external())
+        return Error::from_string_literal("Shared memory with external storage cannot be shared across processes");
+
+    // NB: The GC cage is private to this process, so the bytes have to move out of it. Growable buffers reserve their
+    //     maximum byte length up front, as they do in the cage.
+    auto byte_length = this->byte_length();
+    auto block = TRY(SharedMemoryBlock::create(byte_length, is_fixed_length() ? byte_length : max_byte_length()));
+    m_data_block.copy_to(0, Bytes { block->data(), byte_length });
+
+    set_data_block(DataBlock { DataBlock::SharedMemoryStorage { block }, DataBlock::Shared::Yes });
+    invalidate_cached_typed_array_view_offsets();
+    return block;
+}
+
+RefPtr<SharedMemoryBlock> ArrayBuffer::shared_memory_block() const
+{
+    if (auto const* storage = m_data_block.byte_buffer.get_pointer<DataBlock::SharedMemoryStorage>())
+        return storage->block;
+    return nullptr;
+}
+
+ErrorOr<NonnullRefPtr<TransferableMemoryBlock>> ArrayBuffer::ensure_transferable_memory_block()
+{
+    VERIFY(!is_shared_array_buffer());
+    VERIFY(!is_detached());
+    VERIFY(!is_external());
+
+    if (auto* storage = m_data_block.byte_buffer.get_pointer<DataBlock::TransferableMemoryStorage>())
+        return storage->block;
+
+    // NB: As with SharedArrayBuffers, the bytes have to move out of the GC cage, which is private to this process.
+    auto byte_length = this->byte_length();
+    auto block = TRY(TransferableMemoryBlock::create(byte_length, is_fixed_length() ? byte_length : max_byte_length()));
+    m_data_block.copy_to(0, Bytes { block->data(), byte_length });
+
+    set_data_block(DataBlock { DataBlock::TransferableMemoryStorage { block }, DataBlock::Shared::No });
+    invalidate_cached_typed_array_view_offsets();
+    return block;
+}
+
+RefPtr<TransferableMemoryBlock> ArrayBuffer::transferable_memory_block() const
+{
+    if (auto const* storage = m_data_block.byte_buffer.get_pointer<DataBlock::TransferableMemoryStorage>())
+        return storage->block;
+    return nullptr;
+}
+
 void ArrayBuffer::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
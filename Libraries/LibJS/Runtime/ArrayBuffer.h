@@ -16,6 +16,8 @@
 #include <LibJS/Runtime/Completion.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/SharedMemoryBlock.h>
+#include <LibJS/Runtime/TransferableMemoryBlock.h>
 
 namespace JS {
 
@@ -207,6 +209,19 @@ struct DataBlock {
         GC::Ref<GC::Cell> owner;
     };
 
+    // AD-HOC: A Shared Data Block whose bytes live outside the GC cage, in memory that can be mapped by agents in other
+    //         processes. SharedArrayBuffers move here when they are first shared across a process boundary.
+    struct SharedMemoryStorage {
+        NonnullRefPtr<SharedMemoryBlock> block;
+    };
+
+    // AD-HOC: A Data Block whose bytes live outside the GC cage, in memory that can be handed to another process. Large
+    //         ArrayBuffers move here when they are first transferred across a process boundary, so that transferring
+    //         them passes the mapping along instead of copying their bytes.
+    struct TransferableMemoryStorage {
+        NonnullRefPtr<TransferableMemoryBlock> block;
+    };
+
 private:
     u8* data()
     {
@@ -214,7 +229,9 @@ private:
             [](Empty) -> u8* { VERIFY_NOT_REACHED(); },
             [](OwnedBackingStore& value) -> u8* { return value.data(); },
             [](UnownedFixedLengthByteBuffer& value) -> u8* { return value.buffer->data(); },
-            [](ExternalPrimitiveStorage& value) -> u8* { return value.data(); });
+            [](ExternalPrimitiveStorage& value) -> u8* { return value.data(); },
+            [](SharedMemoryStorage& value) -> u8* { return value.block->data(); },
+            [](TransferableMemoryStorage& value) -> u8* { return value.block->data(); });
     }
     u8 const* data() const { return const_cast<DataBlock*>(this)->data(); }
 
@@ -231,7 +248,9 @@ public:
                 return GC::PrimitiveStorage::the().data(value.handle(), byte_offset);
             },
             [byte_offset](UnownedFixedLengthByteBuffer& value) -> u8* { return value.buffer->data() + byte_offset; },
-            [byte_offset](ExternalPrimitiveStorage& value) -> u8* { return GC::PrimitiveStorage::the().data(value.handle, byte_offset); });
+            [byte_offset](ExternalPrimitiveStorage& value) -> u8* { return GC::PrimitiveStorage::the().data(value.handle, byte_offset); },
+            [byte_offset](SharedMemoryStorage& value) -> u8* { return value.block->data() + byte_offset; },
+            [byte_offset](TransferableMemoryStorage& value) -> u8* { return value.block->data() + byte_offset; });
     }
     u8 const* data_at(size_t byte_offset) const { return const_cast<DataBlock*>(this)->data_at(byte_offset); }
 
@@ -382,7 +401,9 @@ public:
             [&](Empty) { VERIFY_NOT_REACHED(); },
             [&](OwnedBackingStore& value) { value.set_size(new_size, zero_fill_new_bytes); },
             [&](UnownedFixedLengthByteBuffer& value) { value.buffer->set_size(new_size, byte_buffer_zero_fill); },
-            [&](ExternalPrimitiveStorage&) { VERIFY_NOT_REACHED(); });
+            [&](ExternalPrimitiveStorage&) { VERIFY_NOT_REACHED(); },
+            [&](SharedMemoryStorage&) { VERIFY_NOT_REACHED(); },
+            [&](TransferableMemoryStorage& value) { MUST(resize_transferable_memory(value, new_size, zero_fill_new_bytes)); });
     }
 
     ErrorOr<void> try_resize(size_t new_size, ZeroFillNewBytes zero_fill_new_bytes = ZeroFillNewBytes::No)
@@ -394,7 +415,9 @@ public:
             [&](Empty) -> ErrorOr<void> { VERIFY_NOT_REACHED(); },
             [&](OwnedBackingStore& value) { return value.try_resize(new_size, zero_fill_new_bytes); },
             [&](UnownedFixedLengthByteBuffer& value) { return value.buffer->try_resize(new_size, byte_buffer_zero_fill); },
-            [&](ExternalPrimitiveStorage&) -> ErrorOr<void> { VERIFY_NOT_REACHED(); });
+            [&](ExternalPrimitiveStorage&) -> ErrorOr<void> { VERIFY_NOT_REACHED(); },
+            [&](SharedMemoryStorage&) -> ErrorOr<void> { VERIFY_NOT_REACHED(); },
+            [&](TransferableMemoryStorage& value) { return resize_transferable_memory(value, new_size, zero_fill_new_bytes); });
     }
 
     ErrorOr<void> try_ensure_capacity(size_t new_capacity)
@@ -403,7 +426,13 @@ public:
             [&](Empty) -> ErrorOr<void> { VERIFY_NOT_REACHED(); },
             [&](OwnedBackingStore& value) { return value.try_ensure_capacity(new_capacity); },
             [&](UnownedFixedLengthByteBuffer& value) { return value.buffer->try_ensure_capacity(new_capacity); },
-            [&](ExternalPrimitiveStorage&) -> ErrorOr<void> { VERIFY_NOT_REACHED(); });
+            [&](ExternalPrimitiveStorage&) -> ErrorOr<void> { VERIFY_NOT_REACHED(); },
+            [&](SharedMemoryStorage&) -> ErrorOr<void> { VERIFY_NOT_REACHED(); },
+            [&](TransferableMemoryStorage& value) -> ErrorOr<void> {
+                if (new_capacity > value.block->capacity())
+                    return Error::from_errno(ENOMEM);
+                return {};
+            });
     }
 
     size_t size() const
@@ -412,7 +441,9 @@ public:
             [](Empty) -> size_t { return 0u; },
             [](OwnedBackingStore const& buffer) { return buffer.size(); },
             [](UnownedFixedLengthByteBuffer const& value) { return value.size; },
-            [](ExternalPrimitiveStorage const& value) { return value.byte_length(); });
+            [](ExternalPrimitiveStorage const& value) { return value.byte_length(); },
+            [](SharedMemoryStorage const& value) { return value.block->byte_length(); },
+            [](TransferableMemoryStorage const& value) { return value.block->byte_length(); });
     }
 
     size_t capacity() const
@@ -421,7 +452,9 @@ public:
             [](Empty) -> size_t { return 0; },
             [](OwnedBackingStore const& buffer) { return buffer.capacity(); },
             [](UnownedFixedLengthByteBuffer const& value) { return value.size; },
-            [](ExternalPrimitiveStorage const& value) { return value.capacity(); });
+            [](ExternalPrimitiveStorage const& value) { return value.capacity(); },
+            [](SharedMemoryStorage const& value) { return value.block->max_byte_length(); },
+            [](TransferableMemoryStorage const& value) { return value.block->capacity(); });
     }
 
     size_t offset() const
@@ -430,7 +463,9 @@ public:
             [](Empty) -> size_t { return GC::PrimitiveStorage::invalid_offset; },
             [](OwnedBackingStore const& buffer) { return buffer.offset(); },
             [](UnownedFixedLengthByteBuffer const&) { return GC::PrimitiveStorage::invalid_offset; },
-            [](ExternalPrimitiveStorage const& value) { return value.offset(); });
+            [](ExternalPrimitiveStorage const& value) { return value.offset(); },
+            [](SharedMemoryStorage const&) { return GC::PrimitiveStorage::invalid_offset; },
+            [](TransferableMemoryStorage const&) { return GC::PrimitiveStorage::invalid_offset; });
     }
 
     bool is_caged() const
@@ -439,7 +474,9 @@ public:
             [](Empty) { return false; },
             [](OwnedBackingStore const& buffer) { return buffer.handle().is_valid() || buffer.size() == 0; },
             [](UnownedFixedLengthByteBuffer const&) { return false; },
-            [](ExternalPrimitiveStorage const& value) { return value.handle.is_valid(); });
+            [](ExternalPrimitiveStorage const& value) { return value.handle.is_valid(); },
+            [](SharedMemoryStorage const&) { return false; },
+            [](TransferableMemoryStorage const&) { return false; });
     }
 
     size_t external_memory_size() const
@@ -448,7 +485,9 @@ public:
             [](Empty) -> size_t { return 0; },
             [](OwnedBackingStore const& buffer) { return buffer.capacity(); },
             [](UnownedFixedLengthByteBuffer const&) -> size_t { return 0; },
-            [](ExternalPrimitiveStorage const&) -> size_t { return 0; });
+            [](ExternalPrimitiveStorage const&) -> size_t { return 0; },
+            [](SharedMemoryStorage const&) -> size_t { return 0; },
+            [](TransferableMemoryStorage const& value) { return value.block->capacity(); });
     }
 
     bool is_external() const { return byte_buffer.has<ExternalPrimitiveStorage>(); }
@@ -460,8 +499,18 @@ public:
         return data() == other.data();
     }
 
-    Variant<Empty, OwnedBackingStore, UnownedFixedLengthByteBuffer, ExternalPrimitiveStorage> byte_buffer;
+    Variant<Empty, OwnedBackingStore, UnownedFixedLengthByteBuffer, ExternalPrimitiveStorage, SharedMemoryStorage, TransferableMemoryStorage> byte_buffer;
     Shared is_shared = { Shared::No };
+
+private:
+    static ErrorOr<void> resize_transferable_memory(TransferableMemoryStorage& storage, size_t new_size, ZeroFillNewBytes zero_fill_new_bytes)
+    {
+        auto old_size = storage.block->byte_length();
+        TRY(storage.block->try_set_byte_length(new_size));
+        if (zero_fill_new_bytes == ZeroFillNewBytes::Yes && new_size > old_size)
+            __builtin_memset(storage.block->data() + old_size, 0, new_size - old_size);
+        return {};
+    }
 };
 
 class JS_API ArrayBuffer final : public Object {
@@ -496,6 +545,16 @@ public:
     bool shares_storage_with(ArrayBuffer const& other) const { return m_data_block.shares_storage_with(other.m_data_block); }
     size_t data_offset() const { return m_data_block.offset(); }
 
+    // Returns the memory that backs this SharedArrayBuffer, after moving its bytes there if it has not been shared with
+    // another process before.
+    ErrorOr<NonnullRefPtr<SharedMemoryBlock>> ensure_shared_memory_block();
+    RefPtr<SharedMemoryBlock> shared_memory_block() const;
+
+    // Returns the memory that backs this ArrayBuffer, after moving its bytes there if it has not been transferred to
+    // another process before. The caller is expected to detach the ArrayBuffer afterwards.
+    ErrorOr<NonnullRefPtr<TransferableMemoryBlock>> ensure_transferable_memory_block();
+    RefPtr<TransferableMemoryBlock> transferable_memory_block() const;
+
     // Detaches this ArrayBuffer and returns its underlying DataBlock for use in a TransferArrayBuffer-like operation.
     // If detach fails, the underlying storage is left untouched.
     ThrowCompletionOr<DataBlock> detach_and_take_data_block(VM&);
@@ -704,9 +763,29 @@ static Value raw_bytes_to_numeric(VM& vm, Bytes raw_value, bool is_little_endian
     }
 }
 
+// Shared Data Blocks may be accessed by agents on other threads and in other processes at the same time. Elements that
+// are naturally aligned are read and written with single atomic instructions, so that other agents never see them torn.
+template<typename T>
+using SharedElementStorageType = Conditional<sizeof(T) == 1, u8, Conditional<sizeof(T) == 2, u16, Conditional<sizeof(T) == 4, u32, u64>>>;
+
+template<typename T>
+static u8* shared_element_address(DataBlock& block, size_t byte_index)
+{
+    if constexpr (sizeof(T) > sizeof(u64)) {
+        return nullptr;
+    } else {
+        if (block.contiguous_bytes_from(byte_index, sizeof(T)) != sizeof(T))
+            return nullptr;
+        auto* address = block.data_at(byte_index);
+        if (reinterpret_cast<FlatPtr>(address) % sizeof(T) != 0)
+            return nullptr;
+        return address;
+    }
+}
+
 // 25.1.3.16 GetValueFromBuffer ( arrayBuffer, byteIndex, type, isTypedArray, order [ , isLittleEndian ] ), https://tc39.es/ecma262/#sec-getvaluefrombuffer
 template<typename T>
-Value ArrayBuffer::get_value(size_t byte_index, [[maybe_unused]] bool is_typed_array, Order, bool is_little_endian)
+Value ArrayBuffer::get_value(size_t byte_index, [[maybe_unused]] bool is_typed_array, Order order, bool is_little_endian)
 {
     auto& vm = this->vm();
     // 1. Assert: IsDetachedBuffer(arrayBuffer) is false.
@@ -722,8 +801,14 @@ Value ArrayBuffer::get_value(size_t byte_index, [[maybe_unused]] bool is_typed_a
 
     AK::Array<u8, sizeof(T)> raw_value {};
 
-    // FIXME: 5. If IsSharedArrayBuffer(arrayBuffer) is true, then
-    if (false) {
+    // 5. If IsSharedArrayBuffer(arrayBuffer) is true, then
+    auto* shared_address = is_shared_array_buffer() ? shared_element_address<T>(m_data_block, byte_index) : nullptr;
+    if (shared_address) {
+        // NB: Steps a-h describe the memory model. What they boil down to is a read instruction that does not tear.
+        using StorageType = SharedElementStorageType<T>;
+        auto value = AK::atomic_load(reinterpret_cast<StorageType*>(shared_address), order == Order::SeqCst ? AK::memory_order_seq_cst : AK::memory_order_relaxed);
+        __builtin_memcpy(raw_value.data(), &value, sizeof(StorageType));
+
         // FIXME: a. Let execution be the [[CandidateExecution]] field of the surrounding agent's Agent Record.
         // FIXME: b. Let eventsRecord be the Agent Events Record of execution.[[EventsRecords]] whose [[AgentSignifier]] is AgentSignifier().
         // FIXME: c. If isTypedArray is true and IsNoTearConfiguration(type, order) is true, let noTear be true; otherwise let noTear be false.
@@ -822,7 +907,7 @@ static void numeric_to_raw_bytes(VM& vm, Value value, bool is_little_endian, Byt
 
 // 25.1.3.18 SetValueInBuffer ( arrayBuffer, byteIndex, type, value, isTypedArray, order [ , isLittleEndian ] ), https://tc39.es/ecma262/#sec-setvalueinbuffer
 template<typename T>
-void ArrayBuffer::set_value(size_t byte_index, Value value, [[maybe_unused]] bool is_typed_array, Order, bool is_little_endian)
+void ArrayBuffer::set_value(size_t byte_index, Value value, [[maybe_unused]] bool is_typed_array, Order order, bool is_little_endian)
 {
     auto& vm = this->vm();
 
@@ -848,8 +933,15 @@ void ArrayBuffer::set_value(size_t byte_index, Value value, [[maybe_unused]] boo
     AK::Array<u8, sizeof(T)> raw_bytes;
     numeric_to_raw_bytes<T>(vm, value, is_little_endian, raw_bytes);
 
-    // FIXME: 8. If IsSharedArrayBuffer(arrayBuffer) is true, then
-    if (false) {
+    // 8. If IsSharedArrayBuffer(arrayBuffer) is true, then
+    auto* shared_address = is_shared_array_buffer() ? shared_element_address<T>(m_data_block, byte_index) : nullptr;
+    if (shared_address) {
+        // NB: Steps a-d describe the memory model. What they boil down to is a write instruction that does not tear.
+        using StorageType = SharedElementStorageType<T>;
+        StorageType value;
+        __builtin_memcpy(&value, raw_bytes.data(), sizeof(StorageType));
+        AK::atomic_store(reinterpret_cast<StorageType*>(shared_address), value, order == Order::SeqCst ? AK::memory_order_seq_cst : AK::memory_order_relaxed);
+
         // FIXME: a. Let execution be the [[CandidateExecution]] field of the surrounding agent's Agent Record.
         // FIXME: b. Let eventsRecord be the Agent Events Record of execution.[[EventsRecords]] whose [[AgentSignifier]] is AgentSignifier().
         // FIXME: c. If isTypedArray is true and IsNoTearConfiguration(type, order) is true, let noTear be true; otherwise let noTear be false.
@@ -873,9 +965,28 @@ Value ArrayBuffer::get_modify_set_value(size_t byte_index, Value value, ReadWrit
     auto raw_bytes = MUST(ByteBuffer::create_uninitialized(sizeof(T)));
     numeric_to_raw_bytes<T>(vm, value, is_little_endian, raw_bytes);
 
-    // FIXME: Check for shared buffer
-
     auto raw_bytes_read = MUST(ByteBuffer::create_uninitialized(sizeof(T)));
+
+    // If IsSharedArrayBuffer(arrayBuffer) is true, the read and the write form a single indivisible event.
+    auto* shared_address = is_shared_array_buffer() ? shared_element_address<T>(m_data_block, byte_index) : nullptr;
+    if (shared_address) {
+        using StorageType = SharedElementStorageType<T>;
+        auto* element = reinterpret_cast<StorageType*>(shared_address);
+
+        auto expected = AK::atomic_load(element, AK::memory_order_relaxed);
+        while (true) {
+            __builtin_memcpy(raw_bytes_read.data(), &expected, sizeof(StorageType));
+            auto raw_bytes_modified = operation(raw_bytes_read, raw_bytes);
+
+            StorageType desired;
+            __builtin_memcpy(&desired, raw_bytes_modified.data(), sizeof(StorageType));
+            if (AK::atomic_compare_exchange_strong(element, expected, desired))
+                break;
+        }
+
+        return raw_bytes_to_numeric<T>(vm, raw_bytes_read, is_little_endian);
+    }
+
     m_data_block.copy_to(byte_index, raw_bytes_read);
     auto raw_bytes_modified = operation(raw_bytes_read, raw_bytes);
     m_data_block.overwrite(byte_index, raw_bytes_modified.data(), raw_bytes_modified.size());
@@ -153,6 +153,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayBufferPrototype::resize)
     if (host_handled == HandledByHost::Handled)
         return js_undefined();
 
+    // AD-HOC: Buffers that live in a transferable mapping have their maximum byte length mapped already, so they are
+    //         resized in place and keep their mapping for the next transfer.
+    if (array_buffer_object->transferable_memory_block()) {
+        MUST(array_buffer_object->try_resize(new_byte_length, DataBlock::ZeroFillNewBytes::Yes));
+        return js_undefined();
+    }
+
     // 9. Let oldBlock be O.[[ArrayBufferData]].
     // NOTE: oldBlock is read directly in step 12.
 
@@ -171,12 +171,65 @@ static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& t
     if (mode == WaitMode::Sync && !agent_can_suspend(vm))
         return vm.throw_completion<TypeError>(ErrorType::AgentCannotSuspend);
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)byte_index_in_buffer;
-    (void)value;
-    (void)timeout;
+    // FIXME: Implement Atomics.waitAsync(), which needs the waiter list to resolve promises on this agent's event loop.
+    if (mode == WaitMode::Async)
+        return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "Atomics.waitAsync"sv);
+
+    // 11. Let block be buffer.[[ArrayBufferData]].
+    // NB: The waiter list lives next to the bytes of the block, so that agents in other processes share it as well.
+    // FIXME: Support waiting on shared memory with external storage, such as that of a shared WebAssembly.Memory.
+    if (buffer->is_external())
+        return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "Atomics.wait on external shared memory"sv);
+    auto block_or_error = buffer->ensure_shared_memory_block();
+    if (block_or_error.is_error())
+        return vm.throw_completion<RangeError>(ErrorType::NotEnoughMemoryToAllocate, buffer->byte_length());
+    auto block = block_or_error.release_value();
+
+    // 12. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    // 13. If mode is sync, then
+    //     a. Let promiseCapability be blocking.
+    //     b. Let resultObject be undefined.
+    // 15. Perform EnterCriticalSection(WL).
+    // 16. Let elementType be TypedArrayElementType(typedArray).
+    // 17. Let w be GetValueFromBuffer(buffer, byteIndexInBuffer, elementType, true, seq-cst).
+    // 18. If v ≠ w, then
+    //     a. Perform LeaveCriticalSection(WL).
+    //     b. If mode is sync, return "not-equal".
+    auto value_is_expected = [&] {
+        auto current_value = typed_array.get_value_from_buffer(byte_index_in_buffer, ArrayBuffer::Order::SeqCst, true);
+        if (current_value.is_bigint())
+            return MUST(current_value.to_bigint_int64(vm)) == value;
+        return current_value.as_i32() == value;
+    };
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 20. Let thisAgent be AgentSignifier().
+    // 21. Let now be the time value (UTC) identifying the current time.
+    // 22. Let additionalTimeout be an implementation-defined non-negative mathematical value.
+    // 23. Let timeoutTime be ℝ(now) + t + additionalTimeout.
+    // 24. NOTE: When t is +∞, timeoutTime is also +∞.
+    // 25. Let waiterRecord be a new Waiter Record { [[AgentSignifier]]: thisAgent, [[PromiseCapability]]: promiseCapability, [[TimeoutTime]]: timeoutTime, [[Result]]: "ok" }.
+    // 26. Perform AddWaiter(WL, waiterRecord).
+    // 27. If mode is sync, then
+    //     a. Perform SuspendThisAgent(WL, waiterRecord).
+    // 29. Perform LeaveCriticalSection(WL).
+    Optional<AK::Duration> timeout_duration;
+    if (!isinf(timeout))
+        timeout_duration = AK::Duration::from_nanoseconds(static_cast<i64>(min(timeout * 1'000'000.0, static_cast<double>(NumericLimits<i64>::max()))));
+
+    auto result = block->wait(byte_index_in_buffer, move(value_is_expected), timeout_duration);
+    if (result.is_error())
+        return vm.throw_completion<InternalError>(Utf16String::formatted("{}", result.error()));
+
+    // 30. If mode is sync, return waiterRecord.[[Result]].
+    switch (result.value()) {
+    case SharedMemoryBlock::WaitResult::NotEqual:
+        return PrimitiveString::create(vm, "not-equal"_utf16_fly_string);
+    case SharedMemoryBlock::WaitResult::TimedOut:
+        return PrimitiveString::create(vm, "timed-out"_utf16_fly_string);
+    case SharedMemoryBlock::WaitResult::Ok:
+        return PrimitiveString::create(vm, "ok"_utf16_fly_string);
+    }
+    VERIFY_NOT_REACHED();
 }
 
 // 25.4.3.17 AtomicReadModifyWrite ( typedArray, index, value, op ), https://tc39.es/ecma262/#sec-atomicreadmodifywrite
@@ -339,17 +392,15 @@ static ThrowCompletionOr<Value> atomic_compare_exchange_impl(VM& vm, TypedArrayB
     auto replacement_bytes = MUST(ByteBuffer::create_uninitialized(sizeof(T)));
     numeric_to_raw_bytes<T>(vm, replacement, is_little_endian, replacement_bytes);
 
-    // FIXME: Implement SharedArrayBuffer case.
     // 12. If IsSharedArrayBuffer(buffer) is true, then
     //     a. Let rawBytesRead be AtomicCompareExchangeInSharedBlock(block, byteIndexInBuffer, elementSize, expectedBytes, replacementBytes).
     // 13. Else,
-
-    // a. Let rawBytesRead be a List of length elementSize whose elements are the sequence of elementSize bytes starting with block[byteIndexInBuffer].
+    //     a. Let rawBytesRead be a List of length elementSize whose elements are the sequence of elementSize bytes starting with block[byteIndexInBuffer].
+    //     b. If ByteListEqual(rawBytesRead, expectedBytes) is true, then
+    //        i. Store the individual bytes of replacementBytes into block, starting at block[byteIndexInBuffer].
+    // NB: Both cases are a single compare-and-exchange instruction, so that another agent cannot write to the element
+    //     between the read and the store. It leaves the bytes that it read in expectedBytes.
     auto raw_bytes_read = MUST(ByteBuffer::create_uninitialized(sizeof(T)));
-    buffer->copy_to(byte_index_in_buffer, raw_bytes_read);
-
-    // b. If ByteListEqual(rawBytesRead, expectedBytes) is true, then
-    //    i. Store the individual bytes of replacementBytes into block, starting at block[byteIndexInBuffer].
     if constexpr (IsFloatingPoint<T>) {
         VERIFY_NOT_REACHED();
     } else {
@@ -359,6 +410,7 @@ static ThrowCompletionOr<Value> atomic_compare_exchange_impl(VM& vm, TypedArrayB
         auto* e = reinterpret_cast<U*>(expected_bytes.data());
         auto* r = reinterpret_cast<U*>(replacement_bytes.data());
         (void)AK::atomic_compare_exchange_strong(v, *e, *r);
+        raw_bytes_read.overwrite(0, e, sizeof(U));
     }
 
     // 14. Return RawBytesToNumeric(elementType, rawBytesRead, isLittleEndian).
@@ -463,11 +515,23 @@ JS_DEFINE_NATIVE_FUNCTION(AtomicsObject::notify)
     if (!buffer->is_shared_array_buffer())
         return Value { 0 };
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)byte_index_in_buffer;
-    (void)count;
+    // 7. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    // NB: Only buffers that have been waited on, or shared with another process, carry a waiter list. Nobody can be
+    //     waiting on any other buffer.
+    auto block = buffer->shared_memory_block();
+    if (!block)
+        return Value { 0 };
+
+    // 8. Perform EnterCriticalSection(WL).
+    // 9. Let S be RemoveWaiters(WL, c).
+    // 10. For each element W of S, do
+    //     a. Perform NotifyWaiter(WL, W).
+    // 11. Perform LeaveCriticalSection(WL).
+    // 12. Let n be the number of elements in S.
+    auto n = block->notify(byte_index_in_buffer, static_cast<u32>(min(count, static_cast<double>(NumericLimits<u32>::max()))));
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 13. Return 𝔽(n).
+    return Value { n };
 }
 
 // 25.4.11 Atomics.or ( typedArray, index, value ), https://tc39.es/ecma262/#sec-atomics.or
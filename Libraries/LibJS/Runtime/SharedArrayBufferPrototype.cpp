@@ -77,6 +77,44 @@ JS_DEFINE_NATIVE_FUNCTION(SharedArrayBufferPrototype::grow)
     if (host_handled == HandledByHost::Handled)
         return js_undefined();
 
+    // NB: Once the buffer is shared with other processes, its byte length lives in the shared memory, next to its bytes.
+    //     Other agents may grow it concurrently, so steps 7-12 are implemented as written.
+    if (auto block = array_buffer_object->shared_memory_block()) {
+        // 7. Let AR be the Agent Record of the surrounding agent.
+        // 8. Let isLittleEndian be AR.[[LittleEndian]].
+        // 9. Let byteLengthBlock be O.[[ArrayBufferByteLengthData]].
+        // 10. Let currentByteLengthRawBytes be GetRawBytesFromSharedBlock(byteLengthBlock, 0, biguint64, true, seq-cst).
+        auto current_byte_length = block->byte_length();
+
+        // 11. Let newByteLengthRawBytes be NumericToRawBytes(biguint64, ℤ(newByteLength), isLittleEndian).
+        // 12. Repeat,
+        while (true) {
+            // a. NOTE: This is a compare-and-exchange loop to ensure that parallel, racing grows of the same buffer are totally ordered, are not lost, and do not silently do nothing. The loop exits if it was able to attempt to grow uncontended.
+            // b. Let currentByteLength be ℝ(RawBytesToNumeric(biguint64, currentByteLengthRawBytes, isLittleEndian)).
+
+            // c. If newByteLength = currentByteLength, return undefined.
+            if (new_byte_length == current_byte_length)
+                return js_undefined();
+
+            // d. If newByteLength < currentByteLength or newByteLength > O.[[ArrayBufferMaxByteLength]], throw a RangeError exception.
+            if (new_byte_length < current_byte_length)
+                return vm.throw_completion<RangeError>(ErrorType::ByteLengthLessThanPreviousByteLength, new_byte_length, current_byte_length);
+            if (new_byte_length > array_buffer_object->max_byte_length())
+                return vm.throw_completion<RangeError>(ErrorType::ByteLengthExceedsMaxByteLength, new_byte_length, array_buffer_object->max_byte_length());
+
+            // e. Let byteLengthDelta be newByteLength - currentByteLength.
+            // f. If it is impossible to create a new Shared Data Block value consisting of byteLengthDelta bytes, throw a RangeError exception.
+            // g. NOTE: No new Shared Data Block is constructed and used here. The observable behaviour of growable SharedArrayBuffers is specified by allocating a max-sized Shared Data Block at construction time, and this step captures the requirement that implementations that run out of memory must throw a RangeError.
+            // NB: The shared memory is mapped for the maximum byte length, and new pages are zero-filled by the kernel.
+
+            // h. Let readByteLengthRawBytes be AtomicCompareExchangeInSharedBlock(byteLengthBlock, 0, 8, currentByteLengthRawBytes, newByteLengthRawBytes).
+            // i. If ByteListEqual(readByteLengthRawBytes, currentByteLengthRawBytes) is true, return undefined.
+            // j. Set currentByteLengthRawBytes to readByteLengthRawBytes.
+            if (block->compare_exchange_byte_length(current_byte_length, new_byte_length))
+                return js_undefined();
+        }
+    }
+
     // FIXME: 7. Let AR be the Agent Record of the surrounding agent.
     // FIXME: 8. Let isLittleEndian be AR.[[LittleEndian]].
     // FIXME: 9. Let byteLengthBlock be O.[[ArrayBufferByteLengthData]].
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Checked.h>
+#include <AK/StdLibExtras.h>
+#include <LibCore/System.h>
+#include <LibJS/Runtime/SharedMemoryBlock.h>
+#include <LibSync/Futex.h>
+
+namespace JS {
+
+struct SharedMemoryBlock::Header {
+    static constexpr size_t max_waiters = 128;
+
+    enum WaiterState : u32 {
+        Free = 0,
+        Waiting = 1,
+        Notified = 2,
+    };
+
+    struct Waiter {
+        // The futex word that the waiting agent sleeps on.
+        Atomic<u32> state { Free };
+        Atomic<u32> ticket { 0 };
+        Atomic<u64> byte_index { 0 };
+
+        // The process of the waiting agent, so that its slot can be reclaimed if the process exits while it waits.
+        Atomic<i32> owner_pid { 0 };
+    };
+
+    alignas(64) Atomic<u64> byte_length { 0 };
+
+    // 0 when unlocked, 1 when locked, 2 when locked and other agents may be sleeping on it.
+    alignas(64) Atomic<u32> waiter_list_lock { 0 };
+    Atomic<u32> next_ticket { 0 };
+    Waiter waiters[max_waiters];
+};
+
+// Keep the data suitably aligned for every TypedArray element type, and out of the header's cache lines.
+static constexpr size_t data_offset = round_up_to_power_of_two(sizeof(SharedMemoryBlock::Header), 64);
+
+static u32 const* futex_address(Atomic<u32>& value)
+{
+    return const_cast<u32 const*>(value.ptr());
+}
+
+static bool process_has_exited(i32 pid)
+{
+#if defined(AK_OS_WINDOWS)
+    // FIXME: Reclaim the waiter slots of exited processes on Windows as well.
+    (void)pid;
+    return false;
+#else
+    auto result = Core::System::kill(pid, 0);
+    return result.is_error() && result.error().code() == ESRCH;
+#endif
+}
+
+ErrorOr<NonnullRefPtr<SharedMemoryBlock>> SharedMemoryBlock::create(size_t byte_length, size_t max_byte_length)
+{
+    VERIFY(byte_length <= max_byte_length);
+
+    Checked<size_t> size = data_offset;
+    size += max_byte_length;
+    if (size.has_overflow())
+        return Error::from_errno(ENOMEM);
+
+    // NB: The byte length can only grow within the mapping, so the whole maximum byte length is mapped up front. Pages
+    //     are only committed once they are touched.
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(size.value(), Core::AnonymousBuffer::Sealability::Sealable));
+
+    // Other processes refuse buffers whose size is not sealed, since shrinking them would make them crash on access.
+    TRY(buffer.seal_size());
+
+    auto* header = new (buffer.data<void>()) Header;
+    header->byte_length.store(byte_length, AK::memory_order_release);
+
+    return adopt_nonnull_ref_or_enomem(new (nothrow) SharedMemoryBlock(move(buffer), max_byte_length));
+}
+
+ErrorOr<NonnullRefPtr<SharedMemoryBlock>> SharedMemoryBlock::create_from_anonymous_buffer(Core::AnonymousBuffer buffer)
+{
+    if (!buffer.is_valid() || buffer.size() < data_offset)
+        return Error::from_string_literal("Shared memory block is too small");
+
+    TRY(buffer.validate_sealed_size());
+
+    auto max_byte_length = buffer.size() - data_offset;
+    return adopt_nonnull_ref_or_enomem(new (nothrow) SharedMemoryBlock(move(buffer), max_byte_length));
+}
+
+SharedMemoryBlock::SharedMemoryBlock(Core::AnonymousBuffer buffer, size_t max_byte_length)
+    : m_buffer(move(buffer))
+    , m_data(m_buffer.data<u8>() + data_offset)
+    , m_max_byte_length(max_byte_length)
+{
+    (void)byte_length();
+}
+
+SharedMemoryBlock::~SharedMemoryBlock() = default;
+
+size_t SharedMemoryBlock::byte_length() const
+{
+    auto byte_length = static_cast<size_t>(min<u64>(header().byte_length.load(AK::memory_order_seq_cst), m_max_byte_length));
+
+    auto observed_byte_length = m_observed_byte_length.load(AK::memory_order_relaxed);
+    while (byte_length > observed_byte_length) {
+        if (m_observed_byte_length.compare_exchange_strong(observed_byte_length, byte_length, AK::memory_order_relaxed))
+            return byte_length;
+    }
+    return observed_byte_length;
+}
+
+bool SharedMemoryBlock::compare_exchange_byte_length(size_t& expected_byte_length, size_t new_byte_length)
+{
+    VERIFY(expected_byte_length <= new_byte_length);
+    VERIFY(new_byte_length <= m_max_byte_length);
+
+    u64 expected = expected_byte_length;
+    if (header().byte_length.compare_exchange_strong(expected, new_byte_length, AK::memory_order_seq_cst)) {
+        (void)byte_length();
+        return true;
+    }
+
+    expected_byte_length = byte_length();
+    return false;
+}
+
+void SharedMemoryBlock::lock_waiter_list()
+{
+    auto& lock = header().waiter_list_lock;
+
+    u32 state = 0;
+    if (lock.compare_exchange_strong(state, 1, AK::memory_order_acquire))
+        return;
+
+    if (state != 2)
+        state = lock.exchange(2, AK::memory_order_acquire);
+    while (state != 0) {
+        (void)Sync::futex_wait(futex_address(lock), 2);
+        state = lock.exchange(2, AK::memory_order_acquire);
+    }
+}
+
+void SharedMemoryBlock::unlock_waiter_list()
+{
+    auto& lock = header().waiter_list_lock;
+    if (lock.fetch_sub(1, AK::memory_order_release) != 1) {
+        lock.store(0, AK::memory_order_release);
+        Sync::futex_wake(futex_address(lock), 1);
+    }
+}
+
+ErrorOr<SharedMemoryBlock::WaitResult> SharedMemoryBlock::wait(size_t byte_index, Function<bool()> const& value_is_expected, Optional<AK::Duration> timeout)
+{
+    auto& header = this->header();
+
+    lock_waiter_list();
+
+    if (!value_is_expected()) {
+        unlock_waiter_list();
+        return WaitResult::NotEqual;
+    }
+
+    auto find_free_waiter = [&]() -> Header::Waiter* {
+        for (auto& candidate : header.waiters) {
+            if (candidate.state.load(AK::memory_order_relaxed) == Header::Free)
+                return &candidate;
+        }
+        return nullptr;
+    };
+
+    auto* waiter = find_free_waiter();
+    if (!waiter && reclaim_waiters_of_exited_processes() > 0)
+        waiter = find_free_waiter();
+
+    if (!waiter) {
+        unlock_waiter_list();
+        return Error::from_string_literal("Too many agents are waiting on this SharedArrayBuffer");
+    }
+
+    waiter->byte_index.store(byte_index, AK::memory_order_relaxed);
+    waiter->owner_pid.store(Core::System::getpid(), AK::memory_order_relaxed);
+    waiter->ticket.store(header.next_ticket.fetch_add(1, AK::memory_order_relaxed), AK::memory_order_relaxed);
+    waiter->state.store(Header::Waiting, AK::memory_order_release);
+
+    unlock_waiter_list();
+
+    auto deadline = timeout.map([](auto timeout) { return MonotonicTime::now() + timeout; });
+
+    while (waiter->state.load(AK::memory_order_acquire) == Header::Waiting) {
+        Optional<AK::Duration> remaining;
+        if (deadline.has_value()) {
+            remaining = *deadline - MonotonicTime::now();
+            if (*remaining <= AK::Duration::zero()) {
+                // A notification may still arrive while we leave the waiter list, in which case it counts.
+                lock_waiter_list();
+                auto state = waiter->state.load(AK::memory_order_acquire);
+                waiter->state.store(Header::Free, AK::memory_order_release);
+                unlock_waiter_list();
+                return state == Header::Notified ? WaitResult::Ok : WaitResult::TimedOut;
+            }
+        }
+
+        (void)Sync::futex_wait(futex_address(waiter->state), Header::Waiting, remaining);
+    }
+
+    waiter->state.store(Header::Free, AK::memory_order_release);
+    return WaitResult::Ok;
+}
+
+size_t SharedMemoryBlock::reclaim_waiters_of_exited_processes()
+{
+    auto own_pid = Core::System::getpid();
+
+    size_t reclaimed_count = 0;
+    for (auto& waiter : header().waiters) {
+        if (waiter.state.load(AK::memory_order_relaxed) == Header::Free)
+            continue;
+
+        // NB: A process that crashed or was killed while waiting never frees its slot, so it would be lost forever.
+        auto pid = waiter.owner_pid.load(AK::memory_order_relaxed);
+        if (pid == own_pid || !process_has_exited(pid))
+            continue;
+
+        waiter.state.store(Header::Free, AK::memory_order_release);
+        ++reclaimed_count;
+    }
+    return reclaimed_count;
+}
+
+u32 SharedMemoryBlock::notify(size_t byte_index, u32 count)
+{
+    auto& header = this->header();
+
+    lock_waiter_list();
+
+    u32 notified_count = 0;
+    while (notified_count < count) {
+        // Wake the agent that has been waiting the longest first. Tickets wrap around, so compare them by distance.
+        Header::Waiter* next_waiter = nullptr;
+        for (auto& waiter : header.waiters) {
+            if (waiter.state.load(AK::memory_order_relaxed) != Header::Waiting)
+                continue;
+            if (waiter.byte_index.load(AK::memory_order_relaxed) != byte_index)
+                continue;
+            if (!next_waiter || static_cast<i32>(waiter.ticket.load(AK::memory_order_relaxed) - next_waiter->ticket.load(AK::memory_order_relaxed)) < 0)
+                next_waiter = &waiter;
+        }
+
+        if (!next_waiter)
+            break;
+
+        next_waiter->state.store(Header::Notified, AK::memory_order_release);
+        Sync::futex_wake(futex_address(next_waiter->state), 1);
+        ++notified_count;
+    }
+
+    unlock_waiter_list();
+    return notified_count;
+}
+
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/Error.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibJS/Export.h>
+
+namespace JS {
+
+// The bytes of a Shared Data Block, in memory that agents in other processes can map as well. The mapping is sized for
+// the block's maximum byte length, and starts with a header that every agent reads and updates atomically:
+//   - the current byte length, so that growing a SharedArrayBuffer is observed by all agents that share it, and
+//   - the waiter list that Atomics.wait() and Atomics.notify() operate on.
+class JS_API SharedMemoryBlock final : public AtomicRefCounted<SharedMemoryBlock> {
+public:
+    static ErrorOr<NonnullRefPtr<SharedMemoryBlock>> create(size_t byte_length, size_t max_byte_length);
+    static ErrorOr<NonnullRefPtr<SharedMemoryBlock>> create_from_anonymous_buffer(Core::AnonymousBuffer);
+
+    ~SharedMemoryBlock();
+
+    Core::AnonymousBuffer const& anonymous_buffer() const { return m_buffer; }
+
+    u8* data() { return m_data; }
+    u8 const* data() const { return m_data; }
+
+    size_t byte_length() const;
+    size_t max_byte_length() const { return m_max_byte_length; }
+
+    // Sets the byte length to new_byte_length if it is still expected_byte_length. Otherwise, sets expected_byte_length
+    // to the current byte length and returns false.
+    bool compare_exchange_byte_length(size_t& expected_byte_length, size_t new_byte_length);
+
+    enum class WaitResult {
+        NotEqual,
+        TimedOut,
+        Ok,
+    };
+
+    // Suspends the calling agent until another agent notifies byte_index, or until the timeout elapses. Checking the
+    // value and joining the waiter list happen in one critical section, so a notification cannot get lost in between.
+    ErrorOr<WaitResult> wait(size_t byte_index, Function<bool()> const& value_is_expected, Optional<AK::Duration> timeout);
+
+    // Wakes up to count agents that wait on byte_index, in the order in which they started waiting. Returns the number
+    // of agents that were woken up.
+    u32 notify(size_t byte_index, u32 count);
+
+private:
+    struct Header;
+
+    SharedMemoryBlock(Core::AnonymousBuffer, size_t max_byte_length);
+
+    Header& header() { return *reinterpret_cast<Header*>(m_buffer.data<void>()); }
+    Header const& header() const { return *reinterpret_cast<Header const*>(m_buffer.data<void>()); }
+
+    void lock_waiter_list();
+    void unlock_waiter_list();
+
+    // Frees the waiter list slots of agents whose process has exited. Must be called with the waiter list locked.
+    size_t reclaim_waiters_of_exited_processes();
+
+    Core::AnonymousBuffer m_buffer;
+    u8* m_data { nullptr };
+    size_t m_max_byte_length { 0 };
+
+    // The header is writable by other processes. A SharedArrayBuffer never shrinks, so we never report less than what
+    // we have seen before, even if another process corrupts the header.
+    mutable Atomic<size_t> m_observed_byte_length { 0 };
+};
+
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/TransferableMemoryBlock.h>
+
+namespace JS {
+
+ErrorOr<NonnullRefPtr<TransferableMemoryBlock>> TransferableMemoryBlock::create(size_t byte_length, size_t capacity)
+{
+    VERIFY(byte_length <= capacity);
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(capacity, Core::AnonymousBuffer::Sealability::Sealable));
+    TRY(buffer.seal_size());
+
+    return adopt_nonnull_ref_or_enomem(new (nothrow) TransferableMemoryBlock(move(buffer), byte_length));
+}
+
+ErrorOr<NonnullRefPtr<TransferableMemoryBlock>> TransferableMemoryBlock::create_from_anonymous_buffer(Core::AnonymousBuffer buffer, size_t byte_length)
+{
+    TRY(buffer.validate_sealed_size());
+    if (byte_length > buffer.size())
+        return Error::from_string_literal("Transferred memory block is smaller than its byte length");
+
+    return adopt_nonnull_ref_or_enomem(new (nothrow) TransferableMemoryBlock(move(buffer), byte_length));
+}
+
+TransferableMemoryBlock::TransferableMemoryBlock(Core::AnonymousBuffer buffer, size_t byte_length)
+    : m_buffer(move(buffer))
+    , m_byte_length(byte_length)
+{
+}
+
+TransferableMemoryBlock::~TransferableMemoryBlock() = default;
+
+ErrorOr<void> TransferableMemoryBlock::try_set_byte_length(size_t byte_length)
+{
+    if (byte_length > capacity())
+        return Error::from_errno(ENOMEM);
+
+    m_byte_length = byte_length;
+    return {};
+}
+
+}
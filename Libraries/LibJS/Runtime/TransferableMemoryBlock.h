@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibJS/Export.h>
+
+namespace JS {
+
+// The bytes of a (non-shared) Data Block, in memory that can be handed to another process as a whole. Transferring an
+// ArrayBuffer passes this mapping along, so neither the sender nor the receiver has to copy its bytes. Unlike a
+// SharedMemoryBlock, only one agent ever uses the memory at a time: the sender detaches its ArrayBuffer on transfer.
+class JS_API TransferableMemoryBlock final : public RefCounted<TransferableMemoryBlock> {
+public:
+    static ErrorOr<NonnullRefPtr<TransferableMemoryBlock>> create(size_t byte_length, size_t capacity);
+    static ErrorOr<NonnullRefPtr<TransferableMemoryBlock>> create_from_anonymous_buffer(Core::AnonymousBuffer, size_t byte_length);
+
+    ~TransferableMemoryBlock();
+
+    Core::AnonymousBuffer const& anonymous_buffer() const { return m_buffer; }
+
+    u8* data() { return m_buffer.data<u8>(); }
+    u8 const* data() const { return m_buffer.data<u8>(); }
+
+    size_t byte_length() const { return m_byte_length; }
+    size_t capacity() const { return m_buffer.size(); }
+
+    // The byte length can only change within the capacity. The mapping itself never changes size, since the receiving
+    // process relies on its size being sealed.
+    ErrorOr<void> try_set_byte_length(size_t);
+
+private:
+    TransferableMemoryBlock(Core::AnonymousBuffer, size_t byte_length);
+
+    Core::AnonymousBuffer m_buffer;
+    size_t m_byte_length { 0 };
+};
+
+}
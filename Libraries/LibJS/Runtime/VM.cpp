@@ -78,6 +78,35 @@ static constexpr auto make_single_ascii_character_strings(IndexSequence<code_poi
 }
 
 static constexpr auto single_ascii_character_strings = make_single_ascii_character_strings(MakeIndexSequence<128>());
+
+// Only the innermost frames of the JavaScript stack are used to attribute sampled heap allocations, so that allocations
+// from the same code are grouped together regardless of how it was reached.
+static constexpr size_t MAX_ALLOCATION_SITE_FRAMES = 8;
+
+static String describe_allocation_site(VM const& vm)
+{
+    StringBuilder builder;
+    size_t frame_count = 0;
+    vm.for_each_execution_context_top_to_bottom([&](ExecutionContext const& context) {
+        auto function_name = context.function ? context.function->name_for_call_stack() : Utf16String {};
+        if (!context.executable && function_name.is_empty())
+            return true;
+
+        if (!builder.is_empty())
+            builder.append('\n');
+        builder.appendff("{}", function_name.is_empty() ? "<anonymous>"_utf16 : function_name);
+
+        if (context.executable) {
+            auto source_range = context.executable->get_source_range(context.program_counter);
+            if (!source_range.filename().is_empty())
+                builder.appendff(" ({}:{}:{})", source_range.filename(), source_range.start.line, source_range.start.column);
+        }
+
+        return ++frame_count < MAX_ALLOCATION_SITE_FRAMES;
+    });
+    return builder.to_string_without_validation();
+}
+
 VM::VM(ErrorMessages error_messages)
     : m_heap([this](HashMap<GC::Cell*, GC::HeapRoot>& roots) {
         gather_roots(roots);
@@ -93,6 +122,10 @@ VM::VM(ErrorMessages error_messages)
         Bytecode::StaticPropertyLookupCache::sweep_all();
     });
 
+    m_heap.allocation_profiler().set_site_provider([this] {
+        return describe_allocation_site(*this);
+    });
+
     m_empty_string = m_heap.allocate<PrimitiveString>(Utf16String {});
 
     cached_strings = {
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibMedia/AudioDecodeWorker.h>
+#include <LibMedia/DecoderRegistry.h>
+
+namespace Media {
+
+DecoderErrorOr<NonnullRefPtr<AudioDecodeWorker>> AudioDecodeWorker::try_create(Core::EventLoop& main_thread_event_loop, CodecID codec_id, Audio::SampleSpecification const& sample_specification, ReadonlyBytes codec_initialization_data)
+{
+    auto decoder = TRY(create_audio_decoder(codec_id, sample_specification, codec_initialization_data));
+    auto worker = DECODER_TRY_ALLOC(adopt_nonnull_ref_or_enomem(new (nothrow) AudioDecodeWorker(main_thread_event_loop, move(decoder))));
+    TRY(worker->start_thread("Audio Decode Worker"sv));
+    return worker;
+}
+
+AudioDecodeWorker::AudioDecodeWorker(Core::EventLoop& main_thread_event_loop, NonnullOwnPtr<AudioDecoder> decoder)
+    : DecodeWorker(main_thread_event_loop)
+    , m_decoder(move(decoder))
+{
+}
+
+void AudioDecodeWorker::set_output_handler(OutputHandler handler)
+{
+    m_output_handler = move(handler);
+}
+
+void AudioDecodeWorker::clear_output_handler()
+{
+    m_output_handler = nullptr;
+}
+
+DecoderErrorOr<void> AudioDecodeWorker::decode_on_thread(CodedFrame const& frame)
+{
+    auto result = m_decoder->receive_coded_data(frame);
+    if (result.is_error() && result.error().category() == DecoderErrorCategory::NeedsMoreInput) {
+        // NB: The decoder reports that its output must be retrieved before it can accept more input this way.
+        TRY(output_decoded_blocks_on_thread());
+        result = m_decoder->receive_coded_data(frame);
+    }
+    TRY(result);
+    return output_decoded_blocks_on_thread();
+}
+
+DecoderErrorOr<void> AudioDecodeWorker::drain_on_thread()
+{
+    m_decoder->signal_end_of_stream();
+    auto result = output_decoded_blocks_on_thread();
+    // The decoder stops accepting input once it has been drained, so get it ready for the frames after the flush.
+    m_decoder->flush();
+    if (result.is_error() && result.error().category() == DecoderErrorCategory::EndOfStream)
+        return {};
+    return result;
+}
+
+void AudioDecodeWorker::reset_decoder_on_thread()
+{
+    m_decoder->flush();
+}
+
+DecoderErrorOr<void> AudioDecodeWorker::output_decoded_blocks_on_thread()
+{
+    while (true) {
+        auto block = DECODER_TRY_ALLOC(try_make<AudioBlock>());
+        auto result = m_decoder->write_next_block(*block);
+        if (result.is_error()) {
+            if (result.error().category() == DecoderErrorCategory::NeedsMoreInput)
+                return {};
+            return result.release_error();
+        }
+        if (block->is_empty())
+            continue;
+
+        post_to_main_thread([this, block = move(block)] mutable {
+            if (m_output_handler)
+                m_output_handler(move(block));
+        });
+    }
+}
+
+}
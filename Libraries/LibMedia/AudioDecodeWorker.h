@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <LibMedia/Audio/SampleSpecification.h>
+#include <LibMedia/AudioBlock.h>
+#include <LibMedia/AudioDecoder.h>
+#include <LibMedia/DecodeWorker.h>
+#include <LibMedia/Forward.h>
+
+namespace Media {
+
+// Decodes audio on a dedicated thread into blocks of planar samples.
+class MEDIA_API AudioDecodeWorker final : public DecodeWorker {
+public:
+    using OutputHandler = Function<void(NonnullOwnPtr<AudioBlock>)>;
+
+    static DecoderErrorOr<NonnullRefPtr<AudioDecodeWorker>> try_create(Core::EventLoop& main_thread_event_loop, CodecID, Audio::SampleSpecification const&, ReadonlyBytes codec_initialization_data);
+
+    void set_output_handler(OutputHandler);
+
+private:
+    AudioDecodeWorker(Core::EventLoop& main_thread_event_loop, NonnullOwnPtr<AudioDecoder>);
+
+    virtual DecoderErrorOr<void> decode_on_thread(CodedFrame const&) override;
+    virtual DecoderErrorOr<void> drain_on_thread() override;
+    virtual void reset_decoder_on_thread() override;
+    virtual void clear_output_handler() override;
+
+    DecoderErrorOr<void> output_decoded_blocks_on_thread();
+
+    NonnullOwnPtr<AudioDecoder> m_decoder;
+    OutputHandler m_output_handler;
+};
+
+}
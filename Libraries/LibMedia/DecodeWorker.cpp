@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/EventLoop.h>
+#include <LibMedia/DecodeWorker.h>
+#include <LibThreading/Thread.h>
+
+namespace Media {
+
+DecodeWorker::DecodeWorker(Core::EventLoop& main_thread_event_loop)
+    : m_main_thread_event_loop(main_thread_event_loop)
+    , m_wait_state(make_ref_counted<WaitState>())
+{
+}
+
+DecodeWorker::~DecodeWorker() = default;
+
+DecoderErrorOr<void> DecodeWorker::start_thread(StringView name)
+{
+    auto thread = DECODER_TRY_ALLOC(Threading::Thread::try_create(name, [self = NonnullRefPtr(*this)] {
+        return self->decode_thread_main();
+    }));
+    thread->start();
+    thread->detach();
+    return {};
+}
+
+void DecodeWorker::set_chunk_consumed_handler(ChunkConsumedHandler handler)
+{
+    m_chunk_consumed_handler = move(handler);
+}
+
+void DecodeWorker::set_flush_completed_handler(FlushCompletedHandler handler)
+{
+    m_flush_completed_handler = move(handler);
+}
+
+void DecodeWorker::set_error_handler(ErrorHandler handler)
+{
+    m_error_handler = move(handler);
+}
+
+void DecodeWorker::decode(CodedFrame&& frame)
+{
+    Sync::MutexLocker locker { m_wait_state->mutex };
+    m_work_queue.enqueue({ move(frame), m_generation.load() });
+    m_wait_state->condition.broadcast();
+}
+
+void DecodeWorker::flush(u64 flush_id)
+{
+    Sync::MutexLocker locker { m_wait_state->mutex };
+    m_work_queue.enqueue({ FlushRequest { flush_id }, m_generation.load() });
+    m_wait_state->condition.broadcast();
+}
+
+void DecodeWorker::reset()
+{
+    // Drop the queued frames after unlocking, since their destruction does not need to hold up the decode thread.
+    Queue<WorkItem> discarded_work;
+    {
+        Sync::MutexLocker locker { m_wait_state->mutex };
+        m_generation.fetch_add(1);
+        swap(discarded_work, m_work_queue);
+        m_wait_state->condition.broadcast();
+    }
+}
+
+void DecodeWorker::stop()
+{
+    Queue<WorkItem> discarded_work;
+    {
+        Sync::MutexLocker locker { m_wait_state->mutex };
+        m_generation.fetch_add(1);
+        m_should_exit = true;
+        swap(discarded_work, m_work_queue);
+        m_wait_state->condition.broadcast();
+    }
+
+    m_chunk_consumed_handler = nullptr;
+    m_flush_completed_handler = nullptr;
+    m_error_handler = nullptr;
+    clear_output_handler();
+}
+
+void DecodeWorker::post_to_main_thread(Function<void()> callback)
+{
+    VERIFY(is_decode_thread());
+    m_main_thread_event_loop.deferred_invoke([self = NonnullRefPtr(*this), generation = m_processing_generation, callback = move(callback)] {
+        if (self->m_generation.load() != generation)
+            return;
+        callback();
+    });
+}
+
+bool DecodeWorker::is_abandoned_while_locked() const
+{
+    return m_should_exit || m_generation.load() != m_processing_generation;
+}
+
+bool DecodeWorker::wait_on_decode_thread_until(Function<bool()> const& predicate)
+{
+    VERIFY(is_decode_thread());
+    Sync::MutexLocker locker { m_wait_state->mutex };
+    while (true) {
+        if (is_abandoned_while_locked())
+            return false;
+        if (predicate())
+            return true;
+        m_wait_state->condition.wait();
+    }
+}
+
+Function<void()> DecodeWorker::create_decode_thread_waker() const
+{
+    return [wait_state = m_wait_state] {
+        Sync::MutexLocker locker { wait_state->mutex };
+        wait_state->condition.broadcast();
+    };
+}
+
+intptr_t DecodeWorker::decode_thread_main()
+{
+    {
+        Sync::MutexLocker locker { m_wait_state->mutex };
+        m_decode_thread_id = AK::ThreadID::current();
+    }
+
+    while (true) {
+        Optional<WorkItem> item;
+        {
+            Sync::MutexLocker locker { m_wait_state->mutex };
+            m_wait_state->condition.wait_while([&] { return m_work_queue.is_empty() && !m_should_exit; });
+            if (m_should_exit)
+                break;
+            item = m_work_queue.dequeue();
+        }
+
+        m_processing_generation = item->generation;
+        if (m_decoder_generation != m_processing_generation) {
+            reset_decoder_on_thread();
+            m_decoder_generation = m_processing_generation;
+        }
+
+        auto result = item->work.visit(
+            [&](CodedFrame const& frame) -> DecoderErrorOr<void> {
+                post_to_main_thread([this] {
+                    if (m_chunk_consumed_handler)
+                        m_chunk_consumed_handler();
+                });
+                return decode_on_thread(frame);
+            },
+            [&](FlushRequest const& request) -> DecoderErrorOr<void> {
+                TRY(drain_on_thread());
+                post_to_main_thread([this, flush_id = request.id] {
+                    if (m_flush_completed_handler)
+                        m_flush_completed_handler(flush_id);
+                });
+                return {};
+            });
+
+        if (result.is_error() && result.error().category() != DecoderErrorCategory::Aborted) {
+            post_to_main_thread([this, error = result.release_error()] mutable {
+                if (m_error_handler)
+                    m_error_handler(move(error));
+            });
+        }
+    }
+
+    return 0;
+}
+
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/Function.h>
+#include <AK/Queue.h>
+#include <AK/ThreadID.h>
+#include <AK/Variant.h>
+#include <LibCore/Forward.h>
+#include <LibMedia/CodedFrame.h>
+#include <LibMedia/DecoderError.h>
+#include <LibMedia/Export.h>
+#include <LibSync/ConditionVariable.h>
+#include <LibSync/Mutex.h>
+
+namespace Media {
+
+// Decodes coded frames submitted by a client that does its own demuxing on a dedicated thread. Work is processed in
+// submission order, and every handler is invoked on the event loop that created the worker.
+class MEDIA_API DecodeWorker : public AtomicRefCounted<DecodeWorker> {
+public:
+    using ChunkConsumedHandler = Function<void()>;
+    using FlushCompletedHandler = Function<void(u64 flush_id)>;
+    using ErrorHandler = Function<void(DecoderError&&)>;
+
+    virtual ~DecodeWorker();
+
+    // Invoked once for each coded frame when the decode thread takes it off the queue.
+    void set_chunk_consumed_handler(ChunkConsumedHandler);
+    void set_flush_completed_handler(FlushCompletedHandler);
+    void set_error_handler(ErrorHandler);
+
+    void decode(CodedFrame&&);
+    // Outputs everything decoded from the coded frames submitted so far, then invokes the flush completion handler.
+    void flush(u64 flush_id);
+    // Discards all pending work. Outputs and completions of that work that have not been delivered yet are dropped.
+    void reset();
+    // Discards all pending work, clears the handlers and exits the decode thread.
+    void stop();
+
+protected:
+    explicit DecodeWorker(Core::EventLoop& main_thread_event_loop);
+
+    DecoderErrorOr<void> start_thread(StringView name);
+
+    // These are called on the decode thread.
+    virtual DecoderErrorOr<void> decode_on_thread(CodedFrame const&) = 0;
+    virtual DecoderErrorOr<void> drain_on_thread() = 0;
+    virtual void reset_decoder_on_thread() = 0;
+
+    // Called on the main thread when the worker is stopped.
+    virtual void clear_output_handler() = 0;
+
+    bool is_decode_thread() const { return m_decode_thread_id.is_current_thread(); }
+
+    // Runs the callback on the main thread unless the work being processed is reset before it gets to run.
+    void post_to_main_thread(Function<void()>);
+
+    // Blocks the decode thread until the predicate holds. Returns false if the work being processed was reset in the
+    // meantime, in which case it should be abandoned.
+    bool wait_on_decode_thread_until(Function<bool()> const& predicate);
+    // Creates a callback that wakes the decode thread from wait_on_decode_thread_until(). It may be invoked from any
+    // thread, even after the worker is gone, but never while the decode thread holds the worker's lock.
+    Function<void()> create_decode_thread_waker() const;
+
+private:
+    struct FlushRequest {
+        u64 id { 0 };
+    };
+    struct WorkItem {
+        Variant<CodedFrame, FlushRequest> work;
+        u64 generation { 0 };
+    };
+
+    intptr_t decode_thread_main();
+    bool is_abandoned_while_locked() const;
+
+    Core::EventLoop& m_main_thread_event_loop;
+
+    // The wait state outlives the worker, so that buffers released after the worker is gone can still signal it.
+    struct WaitState : public AtomicRefCounted<WaitState> {
+        Sync::Mutex mutex;
+        Sync::ConditionVariable condition { mutex };
+    };
+    NonnullRefPtr<WaitState> m_wait_state;
+
+    // Guarded by the wait state's mutex.
+    Queue<WorkItem> m_work_queue;
+    bool m_should_exit { false };
+
+    // Incremented on the main thread whenever pending work is discarded. Work items and posted callbacks are tagged
+    // with the generation they belong to, so that anything from an earlier generation can be dropped.
+    Atomic<u64> m_generation { 0 };
+
+    // Only accessed on the decode thread.
+    u64 m_processing_generation { 0 };
+    u64 m_decoder_generation { 0 };
+
+    AK::ThreadID m_decode_thread_id;
+
+    ChunkConsumedHandler m_chunk_consumed_handler;
+    FlushCompletedHandler m_flush_completed_handler;
+    ErrorHandler m_error_handler;
+};
+
+}
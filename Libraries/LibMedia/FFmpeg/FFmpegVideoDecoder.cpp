@@ -71,7 +71,8 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
 
     codec_context->get_format = negotiate_output_format;
     codec_context->time_base = { 1, 1'000'000 };
-    codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), 4));
+    // NB: Frame threading adds a frame of latency per thread, so the thread count stays bounded even on large machines.
+    codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), 8));
 
     if (!codec_initialization_data.is_empty()) {
         if (codec_initialization_data.size() > NumericLimits<int>::max())
@@ -133,6 +134,10 @@ DecoderErrorOr<void> FFmpegVideoDecoder::receive_coded_data(CodedFrame const& co
     auto result = avcodec_send_packet(m_codec_context, m_packet);
     switch (result) {
     case 0:
+        // NB: Frames without a timestamp can't be matched to the frames coming out of the decoder, so they are left
+        //     out of the discarded frame count.
+        if (m_packet->pts != AV_NOPTS_VALUE)
+            m_pending_timestamps.insert(m_packet->pts, m_packet->pts);
         return {};
     case AVERROR(EAGAIN):
         return DecoderError::with_description(DecoderErrorCategory::NeedsMoreInput, "FFmpeg decoder cannot decode any more data until frames have been retrieved"sv);
@@ -166,6 +171,8 @@ DecoderErrorOr<VideoFrameMetadata> FFmpegVideoDecoder::peek_next_output(CodingIn
         switch (result) {
         case 0:
             m_has_pending_frame = true;
+            if (auto timestamp = m_frame->pts != AV_NOPTS_VALUE ? m_frame->pts : m_frame->best_effort_timestamp; timestamp != AV_NOPTS_VALUE)
+                count_discarded_frames_before(timestamp);
             break;
         case AVERROR(EAGAIN):
             return DecoderError::with_description(DecoderErrorCategory::NeedsMoreInput, "FFmpeg decoder has no frames available, send more input"sv);
@@ -287,10 +294,49 @@ DecoderErrorOr<void> FFmpegVideoDecoder::take_next_output_into(Gfx::YUVData& yuv
     return {};
 }
 
+void FFmpegVideoDecoder::discard_next_output()
+{
+    VERIFY(m_has_pending_frame);
+    m_has_pending_frame = false;
+}
+
 void FFmpegVideoDecoder::flush()
 {
     avcodec_flush_buffers(m_codec_context);
     m_has_pending_frame = false;
+    m_pending_timestamps.clear();
+}
+
+void FFmpegVideoDecoder::set_frame_skip_level(FrameSkipLevel level)
+{
+    switch (level) {
+    case FrameSkipLevel::None:
+        m_codec_context->skip_frame = AVDISCARD_DEFAULT;
+        m_codec_context->skip_loop_filter = AVDISCARD_DEFAULT;
+        break;
+    case FrameSkipLevel::NonReferenceFrames:
+        m_codec_context->skip_frame = AVDISCARD_NONREF;
+        m_codec_context->skip_loop_filter = AVDISCARD_DEFAULT;
+        break;
+    case FrameSkipLevel::NonReferenceFramesAndLoopFilter:
+        m_codec_context->skip_frame = AVDISCARD_NONREF;
+        m_codec_context->skip_loop_filter = AVDISCARD_ALL;
+        break;
+    case FrameSkipLevel::NonKeyFrames:
+        m_codec_context->skip_frame = AVDISCARD_NONKEY;
+        m_codec_context->skip_loop_filter = AVDISCARD_ALL;
+        break;
+    }
+}
+
+void FFmpegVideoDecoder::count_discarded_frames_before(i64 output_timestamp)
+{
+    while (!m_pending_timestamps.is_empty() && m_pending_timestamps.peek_min_key() < output_timestamp) {
+        m_pending_timestamps.pop_min();
+        m_discarded_frame_count++;
+    }
+    if (!m_pending_timestamps.is_empty() && m_pending_timestamps.peek_min_key() == output_timestamp)
+        m_pending_timestamps.pop_min();
 }
 
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/BinaryHeap.h>
 #include <LibMedia/CodecID.h>
 #include <LibMedia/CodecParameters.h>
 #include <LibMedia/DecoderCapabilities.h>
@@ -27,14 +28,25 @@ public:
     virtual void signal_end_of_stream() override;
     virtual DecoderErrorOr<VideoFrameMetadata> peek_next_output(CodingIndependentCodePoints const& container_cicp) override;
     virtual DecoderErrorOr<void> take_next_output_into(Gfx::YUVData&) override;
+    virtual void discard_next_output() override;
 
     virtual void flush() override;
 
+    virtual void set_frame_skip_level(FrameSkipLevel) override;
+    virtual u64 discarded_frame_count() const override { return m_discarded_frame_count; }
+
 private:
+    void count_discarded_frames_before(i64 output_timestamp);
+
     AVCodecContext* m_codec_context;
     AVPacket* m_packet;
     AVFrame* m_frame;
     bool m_has_pending_frame { false };
+
+    // Frames come out of the decoder in presentation order, so any timestamp still pending below that of an output
+    // frame belongs to a frame that the decoder discarded.
+    BinaryHeap<i64, i64, 16> m_pending_timestamps;
+    u64 m_discarded_frame_count { 0 };
 };
 
 }
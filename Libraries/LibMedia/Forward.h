@@ -9,6 +9,8 @@
 
 namespace Media {
 
+class AudioBlock;
+class AudioDecodeWorker;
 class AudioDecoder;
 class AudioMixer;
 class AudioPlaybackSink;
@@ -18,6 +20,7 @@ class CodedFrame;
 class ContainerNavigator;
 class DecodedAudioProducer;
 class DecodedVideoProducer;
+class DecodeWorker;
 class DecoderError;
 class Demuxer;
 class DisplayingVideoSink;
@@ -30,9 +33,12 @@ class PlaybackManager;
 class ReadonlyBytesCursor;
 class AudioTimeStretchProcessor;
 class Track;
+class VideoDecodeWorker;
 class VideoDecoder;
 class VideoFrame;
 class VideoProducer;
 class VideoSink;
 
+struct VideoPlaybackQuality;
+
 }
@@ -399,6 +399,7 @@ void PlaybackManager::set_clock(NonnullRefPtr<MediaClock> const& clock)
     m_clock = clock;
     m_time_reader = clock->time_reader();
     for (auto& track_data : m_video_track_datas) {
+        track_data.producer->set_time_reader(m_time_reader);
         if (!track_data.video_sink)
             continue;
         track_data.video_sink->set_time_reader(m_time_reader);
@@ -433,6 +434,7 @@ void PlaybackManager::attach_video_sink(VideoTrackData& track_data, NonnullRefPt
         if (track_data.on_resize)
             track_data.on_resize(size);
     });
+    track_data.producer->set_time_reader(m_time_reader);
     MUST(video_sink->connect_input(track_data.producer));
     track_data.video_sink = move(video_sink);
     update_pipeline_state();
@@ -640,6 +642,17 @@ TimeRanges PlaybackManager::buffered_time_ranges() const
     return intersection;
 }
 
+VideoPlaybackQuality PlaybackManager::video_playback_quality() const
+{
+    VideoPlaybackQuality quality;
+    for (auto const& track_data : m_video_track_datas) {
+        auto track_quality = track_data.producer->playback_quality();
+        quality.total_frame_count += track_quality.total_frame_count;
+        quality.dropped_frame_count += track_quality.dropped_frame_count;
+    }
+    return quality;
+}
+
 bool PlaybackManager::is_enabled_supported_track(Track const& track) const
 {
     if (track.type() == TrackType::Video) {
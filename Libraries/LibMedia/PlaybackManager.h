@@ -26,6 +26,7 @@
 #include <LibMedia/Sinks/RemoteVideoSink.h>
 #include <LibMedia/TimeRanges.h>
 #include <LibMedia/Track.h>
+#include <LibMedia/VideoDecodeQuality.h>
 #include <LibMedia/VideoSinkHandle.h>
 #include <LibSync/Mutex.h>
 
@@ -88,6 +89,7 @@ public:
     PlaybackState state();
     AvailableData available_data();
     TimeRanges buffered_time_ranges() const;
+    VideoPlaybackQuality video_playback_quality() const;
 
     void set_volume(double);
     void set_playback_rate(float);
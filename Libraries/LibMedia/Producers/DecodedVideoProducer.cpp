@@ -74,6 +74,16 @@ void DecodedVideoProducer::set_read_blocked_change_handler(ReadBlockedChangeHand
     m_thread_data->set_read_blocked_change_handler(move(handler));
 }
 
+void DecodedVideoProducer::set_time_reader(MediaTimeReader time_reader)
+{
+    m_thread_data->set_time_reader(move(time_reader));
+}
+
+VideoPlaybackQuality DecodedVideoProducer::playback_quality() const
+{
+    return m_thread_data->playback_quality();
+}
+
 void DecodedVideoProducer::start()
 {
     m_thread_data->start();
@@ -149,6 +159,31 @@ void DecodedVideoProducer::ThreadData::set_wake_handler(PipelineWakeHandler hand
     m_wake_handler = move(handler);
 }
 
+void DecodedVideoProducer::ThreadData::set_time_reader(MediaTimeReader time_reader)
+{
+    auto locker = take_lock();
+    m_time_reader = move(time_reader);
+}
+
+VideoPlaybackQuality DecodedVideoProducer::ThreadData::playback_quality() const
+{
+    return {
+        .total_frame_count = m_total_frame_count.load(AK::MemoryOrder::memory_order_relaxed),
+        .dropped_frame_count = m_dropped_frame_count.load(AK::MemoryOrder::memory_order_relaxed),
+    };
+}
+
+Optional<AK::Duration> DecodedVideoProducer::ThreadData::media_time_while_advancing() const
+{
+    auto locker = take_lock();
+    if (!m_time_reader.has_value())
+        return {};
+    auto time_state = m_time_reader->time_state(MonotonicTime::now());
+    if (!time_state.is_advancing)
+        return {};
+    return time_state.time;
+}
+
 void DecodedVideoProducer::ThreadData::dispatch_wake_if_needed_while_locked()
 {
     if (!m_downstream_needs_wake)
@@ -191,6 +226,8 @@ DecoderErrorOr<void> DecodedVideoProducer::ThreadData::create_decoder_for_frame(
         return DecoderError::with_description(DecoderErrorCategory::Corrupted, "Coded frame starting a decode sequence carries no codec configuration"sv);
     m_decoder = TRY(create_video_decoder(frame.codec_id(), *codec_initialization_data));
     m_decoder_codec_id = frame.codec_id();
+    m_applied_frame_skip_level = FrameSkipLevel::None;
+    m_decoder_discarded_frame_count = 0;
     return {};
 }
 
@@ -425,6 +462,9 @@ bool DecodedVideoProducer::ThreadData::handle_seek()
     AK::Duration timestamp;
     bool moved_position = false;
 
+    // Seeks must land on the exact target frame, so nothing is skipped until playback continues.
+    reset_frame_skip_level_for_seek();
+
     auto handle_error = [&](DecoderError&& error) {
         auto locker = take_lock();
         if (moved_position)
@@ -657,6 +697,7 @@ void DecodedVideoProducer::ThreadData::push_data_and_decode_some_frames()
         }
     } else {
         auto coded_frame = sample_result.release_value();
+        apply_frame_skip_level_before(coded_frame);
         auto decode_result = receive_coded_frame(coded_frame);
         if (decode_result.is_error()) {
             set_halting_status_and_wait_for_seek(PipelineStatus::Error, decode_result.release_error());
@@ -686,6 +727,17 @@ void DecodedVideoProducer::ThreadData::push_data_and_decode_some_frames()
         }
         auto metadata = metadata_result.release_value();
 
+        account_for_discarded_frames();
+        m_total_frame_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+        if (auto media_time = media_time_while_advancing(); media_time.has_value()) {
+            auto presentation = m_quality_controller.record_decoded_frame(metadata.timestamp, metadata.duration, *media_time);
+            if (presentation == VideoDecodeQualityController::Presentation::Drop) {
+                m_decoder->discard_next_output();
+                m_dropped_frame_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+                continue;
+            }
+        }
+
         if (auto pool_result = ensure_frame_pool(); pool_result.is_error()) {
             set_halting_status_and_wait_for_seek(PipelineStatus::Error, pool_result.release_error());
             break;
@@ -726,4 +778,42 @@ void DecodedVideoProducer::ThreadData::push_data_and_decode_some_frames()
     }
 }
 
+void DecodedVideoProducer::ThreadData::apply_frame_skip_level_before(CodedFrame const& frame)
+{
+    VERIFY(m_decode_thread_id.is_current_thread());
+    if (m_decoder == nullptr)
+        return;
+    auto level = m_quality_controller.frame_skip_level();
+    if (level == m_applied_frame_skip_level)
+        return;
+    // Frames following a skipped non-key frame may reference it, so decoding them resumes at the next keyframe.
+    if (m_applied_frame_skip_level == FrameSkipLevel::NonKeyFrames && !frame.is_keyframe())
+        return;
+    dbgln_if(PLAYBACK_MANAGER_DEBUG, "Decoded Video Producer: Changing frame skip level from {} to {}", to_underlying(m_applied_frame_skip_level), to_underlying(level));
+    m_decoder->set_frame_skip_level(level);
+    m_applied_frame_skip_level = level;
+}
+
+void DecodedVideoProducer::ThreadData::reset_frame_skip_level_for_seek()
+{
+    VERIFY(m_decode_thread_id.is_current_thread());
+    m_quality_controller.reset_lateness_tracking();
+    if (m_decoder == nullptr || m_applied_frame_skip_level == FrameSkipLevel::None)
+        return;
+    m_decoder->set_frame_skip_level(FrameSkipLevel::None);
+    m_applied_frame_skip_level = FrameSkipLevel::None;
+}
+
+void DecodedVideoProducer::ThreadData::account_for_discarded_frames()
+{
+    VERIFY(m_decode_thread_id.is_current_thread());
+    auto discarded_frame_count = m_decoder->discarded_frame_count();
+    auto newly_discarded_frame_count = discarded_frame_count - m_decoder_discarded_frame_count;
+    m_decoder_discarded_frame_count = discarded_frame_count;
+    if (newly_discarded_frame_count == 0)
+        return;
+    m_total_frame_count.fetch_add(newly_discarded_frame_count, AK::MemoryOrder::memory_order_relaxed);
+    m_dropped_frame_count.fetch_add(newly_discarded_frame_count, AK::MemoryOrder::memory_order_relaxed);
+}
+
 }
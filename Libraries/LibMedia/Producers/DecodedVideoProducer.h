@@ -20,10 +20,12 @@
 #include <LibMedia/Export.h>
 #include <LibMedia/Forward.h>
 #include <LibMedia/IncrementallyPopulatedStream.h>
+#include <LibMedia/MediaTime.h>
 #include <LibMedia/Producers/VideoProducer.h>
 #include <LibMedia/SeekMode.h>
 #include <LibMedia/TimeRanges.h>
 #include <LibMedia/Track.h>
+#include <LibMedia/VideoDecodeQuality.h>
 #include <LibMedia/VideoDecoder.h>
 #include <LibMedia/VideoFramePool.h>
 #include <LibSync/ConditionVariable.h>
@@ -52,6 +54,10 @@ public:
 
     void set_error_handler(ErrorHandler&&);
     void set_read_blocked_change_handler(ReadBlockedChangeHandler);
+    // The clock that decoded frames are measured against to decide how much decoding work to skip.
+    void set_time_reader(MediaTimeReader);
+
+    VideoPlaybackQuality playback_quality() const;
 
     virtual void start() override;
 
@@ -71,6 +77,9 @@ private:
         void set_error_handler(ErrorHandler&&);
         void set_read_blocked_change_handler(ReadBlockedChangeHandler);
         void set_wake_handler(PipelineWakeHandler);
+        void set_time_reader(MediaTimeReader);
+
+        VideoPlaybackQuality playback_quality() const;
 
         void start();
         DecoderErrorOr<void> create_decoder_for_frame(CodedFrame const&);
@@ -102,6 +111,10 @@ private:
         DecoderErrorOr<void> ensure_frame_pool();
         DecoderErrorOr<NonnullRefPtr<VideoFrame>> take_frame_into_acquired_slot(VideoFrameMetadata const&, VideoFramePool::AcquiredSlot const&);
         void push_data_and_decode_some_frames();
+        void apply_frame_skip_level_before(CodedFrame const&);
+        void reset_frame_skip_level_for_seek();
+        void account_for_discarded_frames();
+        Optional<AK::Duration> media_time_while_advancing() const;
 
         void enter_halting_state(PipelineStatus, Optional<DecoderError>);
 
@@ -142,6 +155,13 @@ private:
         bool m_decoder_needs_keyframe_next_seek { false };
         bool m_decoder_needs_codec_configuration_next_seek { true };
 
+        Optional<MediaTimeReader> m_time_reader;
+        VideoDecodeQualityController m_quality_controller;
+        FrameSkipLevel m_applied_frame_skip_level { FrameSkipLevel::None };
+        u64 m_decoder_discarded_frame_count { 0 };
+        Atomic<u64> m_total_frame_count { 0 };
+        Atomic<u64> m_dropped_frame_count { 0 };
+
         FrameQueue m_queue;
         AK::Duration m_earliest_available_timestamp;
         AK::Duration m_latest_available_timestamp;
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibMedia/VideoDecodeQuality.h>
+
+namespace Media {
+
+VideoDecodeQualityController::Presentation VideoDecodeQualityController::record_decoded_frame(AK::Duration frame_timestamp, AK::Duration frame_duration, AK::Duration media_time)
+{
+    auto lateness = media_time - frame_timestamp;
+
+    if (lateness > AK::Duration::zero()) {
+        m_early_since_timestamp.clear();
+        if (++m_consecutive_late_frame_count >= LATE_FRAMES_BEFORE_ESCALATING) {
+            m_consecutive_late_frame_count = 0;
+            if (m_frame_skip_level != FrameSkipLevel::NonKeyFrames)
+                m_frame_skip_level = static_cast<FrameSkipLevel>(to_underlying(m_frame_skip_level) + 1);
+        }
+    } else {
+        m_consecutive_late_frame_count = 0;
+        if (frame_timestamp - media_time < RECOVERY_HEADROOM) {
+            m_early_since_timestamp.clear();
+        } else if (!m_early_since_timestamp.has_value() || frame_timestamp < *m_early_since_timestamp) {
+            m_early_since_timestamp = frame_timestamp;
+        } else if (frame_timestamp - *m_early_since_timestamp >= RECOVERY_PERIOD) {
+            // NB: Restarting the period here gives the decoder time to prove it can keep up at the new level.
+            m_early_since_timestamp = frame_timestamp;
+            if (m_frame_skip_level != FrameSkipLevel::None)
+                m_frame_skip_level = static_cast<FrameSkipLevel>(to_underlying(m_frame_skip_level) - 1);
+        }
+    }
+
+    // NB: This matches the point at which DisplayingVideoSink would skip the frame anyway, so dropping it here only
+    //     saves copying it out of the decoder and sending it across to the sink.
+    auto is_past_presentation = frame_duration > AK::Duration::zero() && lateness > frame_duration.scaled_by(3, 2);
+    if (is_past_presentation && m_consecutive_dropped_frame_count < MAX_CONSECUTIVE_DROPPED_FRAMES) {
+        m_consecutive_dropped_frame_count++;
+        return Presentation::Drop;
+    }
+    m_consecutive_dropped_frame_count = 0;
+    return Presentation::Present;
+}
+
+void VideoDecodeQualityController::reset_lateness_tracking()
+{
+    m_consecutive_late_frame_count = 0;
+    m_early_since_timestamp.clear();
+    m_consecutive_dropped_frame_count = 0;
+}
+
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <AK/Types.h>
+#include <LibMedia/Export.h>
+
+namespace Media {
+
+// How much decoding work a video decoder may skip to keep up with playback, from least to most visible.
+enum class FrameSkipLevel : u8 {
+    None,
+    NonReferenceFrames,
+    NonReferenceFramesAndLoopFilter,
+    NonKeyFrames,
+};
+
+struct VideoPlaybackQuality {
+    u64 total_frame_count { 0 };
+    u64 dropped_frame_count { 0 };
+};
+
+// Adapts the frame skip level of a video decoder to how late its frames are relative to the media clock. Frames that
+// keep arriving late escalate the level one step at a time, and a decoder that stays comfortably ahead of the clock
+// steps back down.
+class MEDIA_API VideoDecodeQualityController {
+public:
+    // Consecutive late frames that escalate the skip level. Each escalation restarts the count, which gives the
+    // decoder's internal queue time to drain frames decoded at the previous level.
+    static constexpr u32 LATE_FRAMES_BEFORE_ESCALATING = 4;
+    // How much media time the decoder must spend with every frame at least RECOVERY_HEADROOM ahead of the clock before
+    // the skip level is lowered. This is measured in media time rather than in frames, since the higher skip levels
+    // only let a fraction of the frames through.
+    static constexpr AK::Duration RECOVERY_PERIOD = AK::Duration::from_seconds(2);
+    static constexpr AK::Duration RECOVERY_HEADROOM = AK::Duration::from_milliseconds(50);
+    // Late frames are still presented once this many in a row have been dropped, so that the picture keeps moving
+    // even when the decoder cannot catch up at all.
+    static constexpr u32 MAX_CONSECUTIVE_DROPPED_FRAMES = 8;
+
+    enum class Presentation : u8 {
+        Present,
+        Drop,
+    };
+
+    // Records a decoded frame, given the media time when it became available. Frames that the clock has already moved
+    // past are dropped instead of presented.
+    Presentation record_decoded_frame(AK::Duration frame_timestamp, AK::Duration frame_duration, AK::Duration media_time);
+
+    // A seek discards the frames in flight, so their lateness says nothing about the frames to come.
+    void reset_lateness_tracking();
+
+    FrameSkipLevel frame_skip_level() const { return m_frame_skip_level; }
+
+private:
+    FrameSkipLevel m_frame_skip_level { FrameSkipLevel::None };
+    u32 m_consecutive_late_frame_count { 0 };
+    // The timestamp of the first of the frames that have all been decoded comfortably ahead of the clock.
+    Optional<AK::Duration> m_early_since_timestamp;
+    u32 m_consecutive_dropped_frame_count { 0 };
+};
+
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/YUVData.h>
+#include <LibMedia/DecoderRegistry.h>
+#include <LibMedia/VideoDecodeWorker.h>
+#include <LibMedia/VideoFrameHandle.h>
+
+namespace Media {
+
+DecoderErrorOr<NonnullRefPtr<VideoDecodeWorker>> VideoDecodeWorker::try_create(Core::EventLoop& main_thread_event_loop, CodecID codec_id, ReadonlyBytes codec_initialization_data)
+{
+    auto decoder = TRY(create_video_decoder(codec_id, codec_initialization_data));
+    auto worker = DECODER_TRY_ALLOC(adopt_nonnull_ref_or_enomem(new (nothrow) VideoDecodeWorker(main_thread_event_loop, move(decoder))));
+
+    auto pool_result = VideoFramePool::create(worker->create_decode_thread_waker());
+    if (pool_result.is_error())
+        return DecoderError::format(DecoderErrorCategory::Memory, "Failed to create a video frame pool: {}", pool_result.release_error());
+    worker->m_frame_pool = pool_result.release_value();
+
+    TRY(worker->start_thread("Video Decode Worker"sv));
+    return worker;
+}
+
+VideoDecodeWorker::VideoDecodeWorker(Core::EventLoop& main_thread_event_loop, NonnullOwnPtr<VideoDecoder> decoder)
+    : DecodeWorker(main_thread_event_loop)
+    , m_decoder(move(decoder))
+{
+}
+
+void VideoDecodeWorker::set_output_handler(OutputHandler handler)
+{
+    m_output_handler = move(handler);
+}
+
+void VideoDecodeWorker::clear_output_handler()
+{
+    m_output_handler = nullptr;
+}
+
+DecoderErrorOr<void> VideoDecodeWorker::decode_on_thread(CodedFrame const& frame)
+{
+    auto result = m_decoder->receive_coded_data(frame);
+    if (result.is_error() && result.error().category() == DecoderErrorCategory::NeedsMoreInput) {
+        // NB: The decoder reports that its output must be retrieved before it can accept more input this way.
+        TRY(output_decoded_frames_on_thread());
+        result = m_decoder->receive_coded_data(frame);
+    }
+    TRY(result);
+    return output_decoded_frames_on_thread();
+}
+
+DecoderErrorOr<void> VideoDecodeWorker::drain_on_thread()
+{
+    m_decoder->signal_end_of_stream();
+    auto result = output_decoded_frames_on_thread();
+    // The decoder stops accepting input once it has been drained, so get it ready for the frames after the flush.
+    m_decoder->flush();
+    if (result.is_error() && result.error().category() == DecoderErrorCategory::EndOfStream)
+        return {};
+    return result;
+}
+
+void VideoDecodeWorker::reset_decoder_on_thread()
+{
+    m_decoder->flush();
+}
+
+DecoderErrorOr<void> VideoDecodeWorker::output_decoded_frames_on_thread()
+{
+    while (true) {
+        auto metadata_result = m_decoder->peek_next_output({});
+        if (metadata_result.is_error()) {
+            if (metadata_result.error().category() == DecoderErrorCategory::NeedsMoreInput)
+                return {};
+            return metadata_result.release_error();
+        }
+
+        auto frame = TRY(take_next_output_on_thread(metadata_result.value()));
+        post_to_main_thread([this, frame = move(frame)] {
+            if (m_output_handler)
+                m_output_handler(frame);
+        });
+    }
+}
+
+DecoderErrorOr<NonnullRefPtr<VideoFrame>> VideoDecodeWorker::take_next_output_on_thread(VideoFrameMetadata const& metadata)
+{
+    auto layout_result = frame_plane_layout(metadata.size, metadata.bit_depth, metadata.subsampling);
+    if (layout_result.is_error())
+        return DecoderError::format(DecoderErrorCategory::Invalid, "Failed to compute video frame plane layout: {}", layout_result.release_error());
+    auto layout = layout_result.release_value();
+
+    Optional<VideoFramePool::AcquiredSlot> acquired_slot;
+    auto acquired = wait_on_decode_thread_until([&] {
+        acquired_slot = m_frame_pool->try_acquire(layout.total_byte_count);
+        return acquired_slot.has_value();
+    });
+    if (!acquired)
+        return DecoderError::with_description(DecoderErrorCategory::Aborted, "Decoding was reset while waiting for a free frame buffer"sv);
+
+    auto pool_slot_result = m_frame_pool->try_adopt_acquired_slot(*acquired_slot);
+    if (pool_slot_result.is_error())
+        return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate a pooled frame slot reference"sv);
+
+    auto y_data = acquired_slot->bytes.slice(0, layout.y_size);
+    auto u_data = acquired_slot->bytes.slice(layout.u_offset, layout.u_size);
+    auto v_data = acquired_slot->bytes.slice(layout.v_offset, layout.v_size);
+    auto yuv_data = DECODER_TRY_ALLOC(Gfx::YUVData::create(metadata.size, metadata.bit_depth, metadata.subsampling, metadata.cicp, y_data, u_data, v_data));
+    TRY(m_decoder->take_next_output_into(yuv_data));
+
+    return DECODER_TRY_ALLOC(try_make_ref_counted<VideoFrame>(metadata.timestamp, metadata.duration, metadata.size.to_type<u32>(), metadata.bit_depth, yuv_data, pool_slot_result.release_value()));
+}
+
+}
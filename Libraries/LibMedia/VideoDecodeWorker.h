@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <LibMedia/DecodeWorker.h>
+#include <LibMedia/Forward.h>
+#include <LibMedia/VideoDecoder.h>
+#include <LibMedia/VideoFrame.h>
+#include <LibMedia/VideoFramePool.h>
+
+namespace Media {
+
+// Decodes video on a dedicated thread into frames backed by a VideoFramePool. Once every slot in the pool is held by
+// an output frame, decoding stalls until one of them is released, so clients that hold on to frames see their queue of
+// coded frames grow instead of the worker allocating without bound.
+class MEDIA_API VideoDecodeWorker final : public DecodeWorker {
+public:
+    using OutputHandler = Function<void(NonnullRefPtr<VideoFrame>)>;
+
+    static DecoderErrorOr<NonnullRefPtr<VideoDecodeWorker>> try_create(Core::EventLoop& main_thread_event_loop, CodecID, ReadonlyBytes codec_initialization_data);
+
+    void set_output_handler(OutputHandler);
+
+private:
+    VideoDecodeWorker(Core::EventLoop& main_thread_event_loop, NonnullOwnPtr<VideoDecoder>);
+
+    virtual DecoderErrorOr<void> decode_on_thread(CodedFrame const&) override;
+    virtual DecoderErrorOr<void> drain_on_thread() override;
+    virtual void reset_decoder_on_thread() override;
+    virtual void clear_output_handler() override;
+
+    DecoderErrorOr<void> output_decoded_frames_on_thread();
+    DecoderErrorOr<NonnullRefPtr<VideoFrame>> take_next_output_on_thread(VideoFrameMetadata const&);
+
+    NonnullOwnPtr<VideoDecoder> m_decoder;
+    RefPtr<VideoFramePool> m_frame_pool;
+    OutputHandler m_output_handler;
+};
+
+}
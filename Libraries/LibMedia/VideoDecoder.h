@@ -12,6 +12,7 @@
 #include <LibGfx/Size.h>
 #include <LibMedia/Color/CodingIndependentCodePoints.h>
 #include <LibMedia/Subsampling.h>
+#include <LibMedia/VideoDecodeQuality.h>
 
 #include "DecoderError.h"
 
@@ -35,8 +36,15 @@ public:
 
     virtual DecoderErrorOr<VideoFrameMetadata> peek_next_output(CodingIndependentCodePoints const& container_cicp) = 0;
     virtual DecoderErrorOr<void> take_next_output_into(Gfx::YUVData&) = 0;
+    // Drops the output returned by peek_next_output() without copying it out.
+    virtual void discard_next_output() = 0;
 
     virtual void flush() = 0;
+
+    // Lets the decoder skip work to keep up with playback. Decoders that cannot skip anything ignore this.
+    virtual void set_frame_skip_level(FrameSkipLevel) { }
+    // The number of frames received as coded data that the decoder discarded instead of outputting.
+    virtual u64 discarded_frame_count() const { return 0; }
 };
 
 }
@@ -7,6 +7,7 @@
 #include <AK/Atomic.h>
 #include <AK/Checked.h>
 #include <AK/Debug.h>
+#include <AK/HashTable.h>
 #include <LibGfx/YUVData.h>
 #include <LibMedia/VideoFrame.h>
 
@@ -43,6 +44,19 @@ SlotHeader const& slot_header(Core::AnonymousBuffer const& buffer)
     return *reinterpret_cast<SlotHeader const*>(buffer.data<u8 const>());
 }
 
+Sync::Mutex& live_pools_mutex()
+{
+    static Sync::Mutex mutex;
+    return mutex;
+}
+
+// NB: Pools may be destroyed on any thread, so they remove themselves from here before any of their members go away.
+HashTable<VideoFramePool*>& live_pools()
+{
+    static HashTable<VideoFramePool*> pools;
+    return pools;
+}
+
 }
 
 ErrorOr<NonnullRefPtr<VideoFramePool>> VideoFramePool::create(Function<void()> slot_freed_callback, size_t byte_budget)
@@ -55,6 +69,27 @@ VideoFramePool::VideoFramePool(Function<void()> slot_freed_callback, size_t byte
     , m_slot_freed_callback(move(slot_freed_callback))
     , m_byte_budget(byte_budget)
 {
+    Sync::MutexLocker locker { live_pools_mutex() };
+    live_pools().set(this);
+}
+
+VideoFramePool::~VideoFramePool()
+{
+    Sync::MutexLocker locker { live_pools_mutex() };
+    live_pools().remove(this);
+}
+
+size_t VideoFramePool::shed_all_buffers()
+{
+    Sync::MutexLocker locker { live_pools_mutex() };
+
+    size_t freed_bytes = 0;
+    for (auto* pool : live_pools()) {
+        auto allocated_bytes_before = pool->allocated_byte_count();
+        pool->shed_buffers();
+        freed_bytes += allocated_bytes_before - pool->allocated_byte_count();
+    }
+    return freed_bytes;
 }
 
 Optional<VideoFramePool::AcquiredSlot> VideoFramePool::try_acquire(size_t byte_count)
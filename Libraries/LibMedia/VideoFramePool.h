@@ -57,6 +57,12 @@ public:
 
     size_t allocated_byte_count() const;
 
+    // Sheds the buffers of every pool in this process, and returns the number of bytes that were freed right away.
+    // Buffers that are still held are freed once they are released.
+    static size_t shed_all_buffers();
+
+    ~VideoFramePool();
+
 private:
     VideoFramePool(Function<void()> slot_freed_callback, size_t byte_budget);
 
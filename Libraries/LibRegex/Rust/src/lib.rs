@@ -12,6 +12,8 @@ pub mod ast;
 pub mod bytecode;
 pub mod compiler;
 pub mod ffi;
+mod linear;
 pub mod parser;
+mod prefilter;
 pub mod regex;
 pub mod vm;
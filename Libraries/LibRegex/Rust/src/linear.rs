@@ -0,0 +1,997 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+//! Linear-time matching for patterns that never need to backtrack.
+//!
+//! Patterns without backreferences, lookaround or modifier groups describe a
+//! regular language, so their bytecode can be simulated as an NFA instead of
+//! being backtracked through. An NFA position is an instruction plus the
+//! iteration counts of the counted loops it is inside of. Two simulations are
+//! provided:
+//!
+//! - A lazily built DFA answers whether there is a match at all. Its states are
+//!   sets of NFA positions, built on demand while scanning the input and cached
+//!   for later searches, so each input code unit costs a table lookup once the
+//!   states it needs exist.
+//! - A Pike VM runs the NFA with capture registers per thread, ordered by
+//!   leftmost-first priority, so it reports the same match and captures as the
+//!   backtracking VM in O(input length * program size) time.
+//!
+//! Only non-Unicode patterns qualify, so that the alphabet is the set of UTF-16
+//! code units and every consuming instruction consumes exactly one of them.
+//!
+//! Spec:
+//! - <https://tc39.es/ecma262/#sec-pattern-semantics>
+use crate::bytecode::*;
+use crate::vm;
+use crate::vm::Input;
+use std::cell::RefCell;
+use std::collections::HashMap;
+use std::collections::HashSet;
+
+/// Largest iteration count tracked for a counted loop. Larger bounds multiply
+/// the number of NFA positions too much, so such patterns are left to the
+/// backtracking VM.
+const MAX_TRACKED_REPETITION: u32 = 100;
+
+/// Upper bound on the number of distinct NFA positions of a program.
+const MAX_NFA_POSITIONS: usize = 1 << 16;
+
+/// Number of DFA states that are cached before the cache is flushed.
+const MAX_DFA_STATES: usize = 1024;
+
+/// Number of cache flushes a single DFA search may cause before the search is
+/// finished by the Pike VM instead.
+const MAX_CACHE_FLUSHES_PER_SEARCH: u32 = 8;
+
+/// Transitions on ASCII code units are stored in a table, followed by the
+/// transition taken at the end of the input.
+const ASCII_TRANSITION_COUNT: usize = 128;
+const END_OF_INPUT_TRANSITION: usize = ASCII_TRANSITION_COUNT;
+
+const UNKNOWN_STATE: u32 = u32::MAX;
+/// A match ends before the code unit that was looked up.
+const MATCHED_STATE: u32 = u32::MAX - 1;
+/// No match is possible anymore.
+const DEAD_STATE: u32 = u32::MAX - 2;
+
+// What the closure of a DFA state knows about the code unit before it.
+const AT_INPUT_START: u8 = 1 << 0;
+const AFTER_LINE_TERMINATOR: u8 = 1 << 1;
+const AFTER_WORD_CHARACTER: u8 = 1 << 2;
+// Whether a new match attempt starts at every position.
+const UNANCHORED: u8 = 1 << 3;
+
+/// Position-dependent facts the epsilon closure needs to resolve assertions.
+#[derive(Clone, Copy)]
+struct Context {
+    pos: usize,
+    flags: u8,
+    next: Option<u16>,
+}
+
+impl Context {
+    fn at<I: Input>(input: I, pos: usize) -> Self {
+        Self {
+            pos,
+            flags: context_flags_at(input, pos),
+            next: (pos < input.len()).then(|| input.code_unit(pos)),
+        }
+    }
+
+    fn at_line_start(&self, multiline: bool) -> bool {
+        self.flags & AT_INPUT_START != 0 || (multiline && self.flags & AFTER_LINE_TERMINATOR != 0)
+    }
+
+    fn at_line_end(&self, multiline: bool) -> bool {
+        match self.next {
+            None => true,
+            Some(code_unit) => multiline && vm::is_line_terminator(code_unit as u32),
+        }
+    }
+
+    fn at_word_boundary(&self) -> bool {
+        let before = self.flags & AFTER_WORD_CHARACTER != 0;
+        let after = self.next.is_some_and(|code_unit| vm::is_word_char(code_unit as u32));
+        before != after
+    }
+}
+
+fn context_flags_at<I: Input>(input: I, pos: usize) -> u8 {
+    if pos == 0 {
+        return AT_INPUT_START;
+    }
+    context_flags_after(input.code_unit(pos - 1))
+}
+
+fn context_flags_after(code_unit: u16) -> u8 {
+    let mut flags = 0;
+    if vm::is_line_terminator(code_unit as u32) {
+        flags |= AFTER_LINE_TERMINATOR;
+    }
+    if vm::is_word_char(code_unit as u32) {
+        flags |= AFTER_WORD_CHARACTER;
+    }
+    flags
+}
+
+/// Per-thread state carried through the epsilon closure.
+trait Thread: Clone {
+    fn save(&mut self, _register: u32, _pos: usize) {}
+    fn clear_register(&mut self, _register: u32) {}
+
+    /// Implements `ProgressCheck`: returns false if the quantifier body that
+    /// saved `register` matched the empty string.
+    fn check_progress(&mut self, _register: u32, _pos: usize) -> bool {
+        true
+    }
+
+    /// Which of the `ProgressCheck` registers were saved at `pos`. Threads at the
+    /// same NFA position only behave the same if these agree.
+    fn progress_key(&self, _progress_registers: &[u32], _pos: usize) -> u64 {
+        0
+    }
+}
+
+/// The DFA only tracks whether some thread reaches `Match`. Letting zero-width
+/// quantifier iterations through does not change that, since the same thread
+/// could have skipped the iteration.
+impl Thread for () {}
+
+#[derive(Clone)]
+struct Registers(Vec<i32>);
+
+impl Thread for Registers {
+    fn save(&mut self, register: u32, pos: usize) {
+        if let Some(slot) = self.0.get_mut(register as usize) {
+            *slot = pos as i32;
+        }
+    }
+
+    fn clear_register(&mut self, register: u32) {
+        if let Some(slot) = self.0.get_mut(register as usize) {
+            *slot = -1;
+        }
+    }
+
+    fn check_progress(&mut self, register: u32, pos: usize) -> bool {
+        let pos = pos as i32;
+        if self.0[register as usize] == pos {
+            return false;
+        }
+        self.0[register as usize] = pos;
+        true
+    }
+
+    fn progress_key(&self, progress_registers: &[u32], pos: usize) -> u64 {
+        let mut key = 0u64;
+        for (index, register) in progress_registers.iter().enumerate() {
+            if self.0[*register as usize] == pos as i32 {
+                key |= 1 << index;
+            }
+        }
+        key
+    }
+}
+
+enum Frame<T> {
+    /// Follow the epsilon transitions out of an NFA position.
+    Explore(u32, T),
+    /// Emit a position that consumes the next code unit.
+    Consume(u32, T),
+}
+
+/// Interned NFA positions. Programs without counted loops use the instruction
+/// index as the position ID.
+#[derive(Default)]
+struct NfaPositions {
+    slot_count: usize,
+    pcs: Vec<u32>,
+    counters: Vec<u16>,
+    ids: HashMap<Vec<u16>, u32>,
+    key: Vec<u16>,
+}
+
+impl NfaPositions {
+    fn new(slot_count: usize) -> Self {
+        Self {
+            slot_count,
+            ..Self::default()
+        }
+    }
+
+    fn pc(&self, id: u32) -> u32 {
+        if self.slot_count == 0 {
+            id
+        } else {
+            self.pcs[id as usize]
+        }
+    }
+
+    fn counter(&self, id: u32, slot: usize) -> u32 {
+        self.counters[id as usize * self.slot_count + slot] as u32
+    }
+
+    fn start(&mut self) -> u32 {
+        if self.slot_count == 0 {
+            return 0;
+        }
+        self.key.clear();
+        self.key.extend_from_slice(&[0, 0]);
+        self.key.resize(2 + self.slot_count, 0);
+        self.intern_key()
+    }
+
+    /// The position at `pc` with the counters of `id`, optionally with one counter replaced.
+    fn successor(&mut self, id: u32, pc: u32, counter_update: Option<(usize, u32)>) -> u32 {
+        if self.slot_count == 0 {
+            return pc;
+        }
+        let counters_start = id as usize * self.slot_count;
+        self.key.clear();
+        self.key.extend_from_slice(&[pc as u16, (pc >> 16) as u16]);
+        self.key
+            .extend_from_slice(&self.counters[counters_start..counters_start + self.slot_count]);
+        if let Some((slot, value)) = counter_update {
+            self.key[2 + slot] = value as u16;
+        }
+        self.intern_key()
+    }
+
+    fn intern_key(&mut self) -> u32 {
+        if let Some(id) = self.ids.get(self.key.as_slice()) {
+            return *id;
+        }
+        let id = self.pcs.len() as u32;
+        self.pcs.push(self.key[0] as u32 | ((self.key[1] as u32) << 16));
+        self.counters.extend_from_slice(&self.key[2..]);
+        self.ids.insert(self.key.clone(), id);
+        id
+    }
+}
+
+/// NFA positions visited during one epsilon closure.
+#[derive(Default)]
+struct Visited {
+    stamps: Vec<u32>,
+    generation: u32,
+    with_progress: HashSet<(u32, u64)>,
+}
+
+impl Visited {
+    fn clear(&mut self) {
+        self.generation = self.generation.wrapping_add(1);
+        if self.generation == 0 {
+            self.stamps.fill(0);
+            self.generation = 1;
+        }
+        self.with_progress.clear();
+    }
+
+    fn insert(&mut self, id: u32, progress_key: u64) -> bool {
+        if progress_key != 0 {
+            return self.with_progress.insert((id, progress_key));
+        }
+        let index = id as usize;
+        if index >= self.stamps.len() {
+            self.stamps.resize(index + 1, 0);
+        }
+        if self.stamps[index] == self.generation {
+            return false;
+        }
+        self.stamps[index] = self.generation;
+        true
+    }
+}
+
+struct DfaState {
+    /// NFA positions reached by consuming the previous code unit.
+    kernel: Box<[u32]>,
+    flags: u8,
+    transitions: Box<[u32; ASCII_TRANSITION_COUNT + 1]>,
+    non_ascii_transitions: HashMap<u16, u32>,
+}
+
+#[derive(Default)]
+struct DfaStates {
+    states: Vec<DfaState>,
+    /// Keyed by the kernel followed by the flags.
+    ids: HashMap<Box<[u32]>, u32>,
+    /// Incremented whenever the cache is flushed, which invalidates all state IDs.
+    generation: u32,
+    flushes_during_search: u32,
+}
+
+impl DfaStates {
+    fn intern(&mut self, kernel_and_flags: &[u32]) -> u32 {
+        if let Some(id) = self.ids.get(kernel_and_flags) {
+            return *id;
+        }
+        if self.states.len() >= MAX_DFA_STATES {
+            self.states.clear();
+            self.ids.clear();
+            self.generation = self.generation.wrapping_add(1);
+            self.flushes_during_search += 1;
+        }
+        let (flags, kernel) = kernel_and_flags.split_last().expect("DFA state key includes flags");
+        let id = self.states.len() as u32;
+        self.states.push(DfaState {
+            kernel: kernel.into(),
+            flags: *flags as u8,
+            transitions: Box::new([UNKNOWN_STATE; ASCII_TRANSITION_COUNT + 1]),
+            non_ascii_transitions: HashMap::new(),
+        });
+        self.ids.insert(kernel_and_flags.into(), id);
+        id
+    }
+
+    fn cached_transition(&self, state: u32, next: Option<u16>) -> u32 {
+        let state = &self.states[state as usize];
+        match next {
+            None => state.transitions[END_OF_INPUT_TRANSITION],
+            Some(code_unit) if (code_unit as usize) < ASCII_TRANSITION_COUNT => state.transitions[code_unit as usize],
+            Some(code_unit) => state
+                .non_ascii_transitions
+                .get(&code_unit)
+                .copied()
+                .unwrap_or(UNKNOWN_STATE),
+        }
+    }
+
+    fn cache_transition(&mut self, state: u32, next: Option<u16>, target: u32) {
+        let state = &mut self.states[state as usize];
+        match next {
+            None => state.transitions[END_OF_INPUT_TRANSITION] = target,
+            Some(code_unit) if (code_unit as usize) < ASCII_TRANSITION_COUNT => {
+                state.transitions[code_unit as usize] = target
+            }
+            Some(code_unit) => {
+                state.non_ascii_transitions.insert(code_unit, target);
+            }
+        }
+    }
+}
+
+#[derive(Default)]
+struct Cache {
+    nfa: NfaPositions,
+    dfa: DfaStates,
+    visited: Visited,
+    dfa_stack: Vec<Frame<()>>,
+    dfa_consuming: Vec<(u32, ())>,
+    kernel: Vec<u32>,
+    pike_stack: Vec<Frame<Registers>>,
+    pike_current: Vec<(u32, Registers)>,
+    pike_next: Vec<(u32, Registers)>,
+    pike_consuming: Vec<(u32, Registers)>,
+}
+
+/// Linear-time matcher for a program that qualifies, see [`LinearMatcher::new`].
+pub(crate) struct LinearMatcher {
+    /// Counter registers of `RepeatStart`/`RepeatCheck`, indexed by their slot
+    /// in an NFA position.
+    counter_registers: Vec<u32>,
+    /// Slot holding the iteration count of the `GreedyLoop` or `LazyLoop` an
+    /// NFA position is at.
+    loop_slot: usize,
+    /// Registers checked by `ProgressCheck` instructions.
+    progress_registers: Vec<u32>,
+    /// The context flags that some assertion in the program depends on.
+    context_mask: u8,
+    cache: RefCell<Cache>,
+}
+
+impl LinearMatcher {
+    /// Returns a matcher if the program can be run without backtracking: it must
+    /// be a non-Unicode pattern without backreferences, lookaround, modifier
+    /// groups or string properties, whose counted loops have small bounds.
+    pub(crate) fn new(program: &Program) -> Option<Self> {
+        if program.unicode || program.unicode_sets {
+            return None;
+        }
+
+        let mut counter_registers = Vec::new();
+        let mut progress_registers = Vec::new();
+        let mut context_mask = 0;
+        let mut has_loops = false;
+        let mut largest_loop_count = 0;
+        let mut position_count = program.instructions.len().max(1);
+
+        for instruction in &program.instructions {
+            match instruction {
+                Instruction::Char(_)
+                | Instruction::CharNoCase(..)
+                | Instruction::AnyChar { .. }
+                | Instruction::CharClass { .. }
+                | Instruction::BuiltinClass(_)
+                | Instruction::UnicodeProperty(_)
+                | Instruction::Jump(_)
+                | Instruction::Split { .. }
+                | Instruction::Save(_)
+                | Instruction::ClearRegister(_)
+                | Instruction::AssertEnd { .. }
+                | Instruction::Match
+                | Instruction::Fail
+                | Instruction::Nop
+                | Instruction::RepeatStart { .. } => {}
+                Instruction::AssertStart { multiline } => {
+                    context_mask |= AT_INPUT_START;
+                    if *multiline || program.multiline {
+                        context_mask |= AFTER_LINE_TERMINATOR;
+                    }
+                }
+                Instruction::AssertWordBoundary | Instruction::AssertNonWordBoundary => {
+                    context_mask |= AFTER_WORD_CHARACTER;
+                }
+                Instruction::RepeatCheck {
+                    counter_reg, min, max, ..
+                } => {
+                    let max = (*max)?;
+                    if max > MAX_TRACKED_REPETITION || *min > max {
+                        return None;
+                    }
+                    if !counter_registers.contains(counter_reg) {
+                        counter_registers.push(*counter_reg);
+                        position_count = position_count.saturating_mul(max as usize + 1);
+                    }
+                }
+                Instruction::GreedyLoop { min, max, .. } | Instruction::LazyLoop { min, max, .. } => {
+                    let largest_count = max.unwrap_or(*min);
+                    if largest_count > MAX_TRACKED_REPETITION {
+                        return None;
+                    }
+                    has_loops = true;
+                    largest_loop_count = largest_loop_count.max(largest_count);
+                }
+                Instruction::ProgressCheck { reg, .. } => {
+                    if !progress_registers.contains(reg) {
+                        progress_registers.push(*reg);
+                    }
+                }
+                Instruction::Backref(_)
+                | Instruction::BackrefNamed(_)
+                | Instruction::LookStart { .. }
+                | Instruction::LookEnd
+                | Instruction::PushModifiers { .. }
+                | Instruction::PopModifiers
+                | Instruction::StringPropertyMatch { .. } => return None,
+            }
+        }
+
+        if progress_registers.len() > u64::BITS as usize {
+            return None;
+        }
+        if has_loops {
+            position_count = position_count.saturating_mul(largest_loop_count as usize + 1);
+        }
+        if position_count > MAX_NFA_POSITIONS {
+            return None;
+        }
+
+        let loop_slot = counter_registers.len();
+        let slot_count = if has_loops || !counter_registers.is_empty() {
+            loop_slot + 1
+        } else {
+            0
+        };
+
+        Some(Self {
+            counter_registers,
+            loop_slot,
+            progress_registers,
+            context_mask,
+            cache: RefCell::new(Cache {
+                nfa: NfaPositions::new(slot_count),
+                ..Cache::default()
+            }),
+        })
+    }
+
+    /// Whether the program matches anywhere at or after `start`, or only at
+    /// `start` if `anchored`.
+    pub(crate) fn is_match<I: Input>(
+        &self,
+        program: &Program,
+        input: I,
+        start: usize,
+        anchored: bool,
+        hints: &vm::PatternHints,
+    ) -> bool {
+        if start > input.len() || vm::fails_literal_hints(input, start, hints) {
+            return false;
+        }
+
+        let cache = &mut *self.cache.borrow_mut();
+        cache.dfa.flushes_during_search = 0;
+
+        let mut pos = start;
+        let mut state = self.start_state(cache, input, pos, anchored);
+        loop {
+            if !anchored && cache.dfa.states[state as usize].kernel.is_empty() {
+                // No match attempt is in progress, so skip ahead to where the next one can start.
+                match vm::next_match_candidate(program, input, hints, pos) {
+                    None => return false,
+                    Some(candidate_pos) if candidate_pos > pos => {
+                        pos = candidate_pos;
+                        state = self.start_state(cache, input, pos, false);
+                    }
+                    Some(_) => {}
+                }
+            }
+
+            let next = (pos < input.len()).then(|| input.code_unit(pos));
+            let mut target = cache.dfa.cached_transition(state, next);
+            if target == UNKNOWN_STATE {
+                target = self.compute_transition(program, cache, state, next);
+            }
+            match target {
+                MATCHED_STATE => return true,
+                DEAD_STATE => return false,
+                _ => {}
+            }
+            if cache.dfa.flushes_during_search > MAX_CACHE_FLUSHES_PER_SEARCH {
+                // The input keeps producing new states, so the cache is not paying off.
+                let mut out = [-1i32; 2];
+                return self.pike_search(program, cache, input, start, anchored, hints, &mut out);
+            }
+            state = target;
+            pos += 1;
+        }
+    }
+
+    /// Find the leftmost-first match at or after `start`, or only at `start` if
+    /// `anchored`, and write its captures into `out`.
+    pub(crate) fn find_into<I: Input>(
+        &self,
+        program: &Program,
+        input: I,
+        start: usize,
+        anchored: bool,
+        hints: &vm::PatternHints,
+        out: &mut [i32],
+    ) -> bool {
+        if start > input.len() || vm::fails_literal_hints(input, start, hints) {
+            return false;
+        }
+        let cache = &mut *self.cache.borrow_mut();
+        self.pike_search(program, cache, input, start, anchored, hints, out)
+    }
+
+    /// Find all non-overlapping matches starting from `start`, writing
+    /// (match_start, match_end) pairs into `result_buf`. Returns the number of
+    /// matches, or -1 if the buffer is too small.
+    pub(crate) fn find_all_into<I: Input>(
+        &self,
+        program: &Program,
+        input: I,
+        start: usize,
+        hints: &vm::PatternHints,
+        result_buf: &mut [i32],
+    ) -> i32 {
+        let cache = &mut *self.cache.borrow_mut();
+        let mut count = 0i32;
+        let mut pos = start;
+        let mut out = [-1i32; 2];
+        while pos <= input.len() && !vm::fails_literal_hints(input, pos, hints) {
+            if !self.pike_search(program, cache, input, pos, false, hints, &mut out) {
+                break;
+            }
+            let idx = count as usize * 2;
+            if idx + 1 >= result_buf.len() {
+                return -1;
+            }
+            result_buf[idx] = out[0];
+            result_buf[idx + 1] = out[1];
+            count += 1;
+            pos = if out[1] == out[0] {
+                out[1] as usize + 1
+            } else {
+                out[1] as usize
+            };
+        }
+        count
+    }
+
+    fn start_state<I: Input>(&self, cache: &mut Cache, input: I, pos: usize, anchored: bool) -> u32 {
+        cache.kernel.clear();
+        if anchored {
+            let start = cache.nfa.start();
+            cache.kernel.push(start);
+        }
+        let mut flags = context_flags_at(input, pos) & self.context_mask;
+        if !anchored {
+            flags |= UNANCHORED;
+        }
+        cache.kernel.push(flags as u32);
+        cache.dfa.intern(&cache.kernel)
+    }
+
+    fn compute_transition(&self, program: &Program, cache: &mut Cache, state: u32, next: Option<u16>) -> u32 {
+        let Cache {
+            nfa,
+            dfa,
+            visited,
+            dfa_stack,
+            dfa_consuming,
+            kernel,
+            ..
+        } = cache;
+
+        let generation = dfa.generation;
+        let flags = dfa.states[state as usize].flags;
+        let context = Context { pos: 0, flags, next };
+
+        visited.clear();
+        dfa_consuming.clear();
+        let mut matched = false;
+        for &id in dfa.states[state as usize].kernel.iter() {
+            if self
+                .closure(program, nfa, visited, dfa_stack, id, (), context, dfa_consuming)
+                .is_some()
+            {
+                matched = true;
+                break;
+            }
+        }
+        if !matched && flags & UNANCHORED != 0 {
+            let start = nfa.start();
+            matched = self
+                .closure(program, nfa, visited, dfa_stack, start, (), context, dfa_consuming)
+                .is_some();
+        }
+
+        let target = if matched {
+            MATCHED_STATE
+        } else if let Some(code_unit) = next {
+            kernel.clear();
+            for &(id, ()) in dfa_consuming.iter() {
+                if let Some(successor) = self.step(program, nfa, id, code_unit) {
+                    kernel.push(successor);
+                }
+            }
+            kernel.sort_unstable();
+            kernel.dedup();
+            if kernel.is_empty() && flags & UNANCHORED == 0 {
+                DEAD_STATE
+            } else {
+                let next_flags = (context_flags_after(code_unit) & self.context_mask) | (flags & UNANCHORED);
+                kernel.push(next_flags as u32);
+                dfa.intern(kernel)
+            }
+        } else {
+            DEAD_STATE
+        };
+
+        // Interning the target may have flushed the cache, in which case `state` is gone.
+        if dfa.generation == generation {
+            dfa.cache_transition(state, next, target);
+        }
+        target
+    }
+
+    #[allow(clippy::too_many_arguments)]
+    fn pike_search<I: Input>(
+        &self,
+        program: &Program,
+        cache: &mut Cache,
+        input: I,
+        start: usize,
+        anchored: bool,
+        hints: &vm::PatternHints,
+        out: &mut [i32],
+    ) -> bool {
+        let Cache {
+            nfa,
+            visited,
+            pike_stack,
+            pike_current,
+            pike_next,
+            pike_consuming,
+            ..
+        } = cache;
+
+        let register_count = program.register_count as usize;
+        let start_id = nfa.start();
+        pike_current.clear();
+
+        let mut best: Option<Registers> = None;
+        let mut pos = start;
+        loop {
+            if pike_current.is_empty() && best.is_none() && !anchored {
+                // No thread is alive, so skip ahead to where the next match attempt can start.
+                match vm::next_match_candidate(program, input, hints, pos) {
+                    Some(candidate_pos) => pos = candidate_pos,
+                    None => break,
+                }
+            }
+
+            let context = Context::at(input, pos);
+            visited.clear();
+            pike_consuming.clear();
+
+            // Threads are in priority order, so a match cuts off all threads after it.
+            let mut matched = false;
+            for (id, thread) in pike_current.drain(..) {
+                if let Some(registers) =
+                    self.closure(program, nfa, visited, pike_stack, id, thread, context, pike_consuming)
+                {
+                    best = Some(registers);
+                    matched = true;
+                    break;
+                }
+            }
+            if !matched && best.is_none() && (pos == start || !anchored) {
+                let thread = Registers(vec![-1; register_count]);
+                if let Some(registers) = self.closure(
+                    program,
+                    nfa,
+                    visited,
+                    pike_stack,
+                    start_id,
+                    thread,
+                    context,
+                    pike_consuming,
+                ) {
+                    best = Some(registers);
+                }
+            }
+            pike_current.clear();
+
+            if pos >= input.len() {
+                break;
+            }
+            let code_unit = input.code_unit(pos);
+            for (id, thread) in pike_consuming.drain(..) {
+                if let Some(successor) = self.step(program, nfa, id, code_unit) {
+                    pike_next.push((successor, thread));
+                }
+            }
+            std::mem::swap(pike_current, pike_next);
+            pos += 1;
+
+            if pike_current.is_empty() && (best.is_some() || anchored) {
+                break;
+            }
+        }
+        pike_current.clear();
+        pike_next.clear();
+
+        let Some(Registers(registers)) = best else {
+            return false;
+        };
+        let slots = ((program.capture_count as usize + 1) * 2).min(out.len());
+        out[..slots].copy_from_slice(&registers[..slots]);
+        true
+    }
+
+    /// Follow the epsilon transitions from `seed` in priority order, appending
+    /// the consuming positions that are reached to `consuming`. Returns the
+    /// thread that reached `Match` first, if any, at which point the closure
+    /// stops since lower priority threads can no longer win.
+    #[allow(clippy::too_many_arguments)]
+    fn closure<T: Thread>(
+        &self,
+        program: &Program,
+        nfa: &mut NfaPositions,
+        visited: &mut Visited,
+        stack: &mut Vec<Frame<T>>,
+        seed: u32,
+        thread: T,
+        context: Context,
+        consuming: &mut Vec<(u32, T)>,
+    ) -> Option<T> {
+        stack.clear();
+        stack.push(Frame::Explore(seed, thread));
+
+        while let Some(frame) = stack.pop() {
+            let (id, mut thread) = match frame {
+                Frame::Explore(id, thread) => (id, thread),
+                Frame::Consume(id, thread) => {
+                    consuming.push((id, thread));
+                    continue;
+                }
+            };
+            if !visited.insert(id, thread.progress_key(&self.progress_registers, context.pos)) {
+                continue;
+            }
+
+            let pc = nfa.pc(id);
+            // Falling off the end of the program fails the thread.
+            let Some(instruction) = program.instructions.get(pc as usize) else {
+                continue;
+            };
+            match instruction {
+                Instruction::Char(_)
+                | Instruction::CharNoCase(..)
+                | Instruction::AnyChar { .. }
+                | Instruction::CharClass { .. }
+                | Instruction::BuiltinClass(_)
+                | Instruction::UnicodeProperty(_) => consuming.push((id, thread)),
+
+                Instruction::Jump(target) => stack.push(Frame::Explore(nfa.successor(id, *target, None), thread)),
+
+                Instruction::Split { prefer, other } => {
+                    let other = nfa.successor(id, *other, None);
+                    let prefer = nfa.successor(id, *prefer, None);
+                    stack.push(Frame::Explore(other, thread.clone()));
+                    stack.push(Frame::Explore(prefer, thread));
+                }
+
+                Instruction::Save(register) => {
+                    thread.save(*register, context.pos);
+                    stack.push(Frame::Explore(nfa.successor(id, pc + 1, None), thread));
+                }
+
+                Instruction::ClearRegister(register) => {
+                    thread.clear_register(*register);
+                    stack.push(Frame::Explore(nfa.successor(id, pc + 1, None), thread));
+                }
+
+                Instruction::Nop => stack.push(Frame::Explore(nfa.successor(id, pc + 1, None), thread)),
+
+                Instruction::AssertStart { multiline } => {
+                    if context.at_line_start(*multiline || program.multiline) {
+                        stack.push(Frame::Explore(nfa.successor(id, pc + 1, None), thread));
+                    }
+                }
+
+                Instruction::AssertEnd { multiline } => {
+                    if context.at_line_end(*multiline || program.multiline) {
+                        stack.push(Frame::Explore(nfa.successor(id, pc + 1, None), thread));
+                    }
+                }
+
+                Instruction::AssertWordBoundary | Instruction::AssertNonWordBoundary => {
+                    let should_match_boundary = matches!(instruction, Instruction::AssertWordBoundary);
+                    if context.at_word_boundary() == should_match_boundary {
+                        stack.push(Frame::Explore(nfa.successor(id, pc + 1, None), thread));
+                    }
+                }
+
+                Instruction::Match => return Some(thread),
+
+                Instruction::RepeatStart { counter_reg } => {
+                    let slot = self.counter_slot(*counter_reg);
+                    stack.push(Frame::Explore(nfa.successor(id, pc + 1, Some((slot, 0))), thread));
+                }
+
+                Instruction::RepeatCheck {
+                    counter_reg,
+                    min,
+                    max,
+                    body,
+                    greedy,
+                } => {
+                    let slot = self.counter_slot(*counter_reg);
+                    let count = nfa.counter(id, slot);
+                    // The counter is only read by this instruction, so it is reset on exit to keep
+                    // the number of distinct positions down.
+                    let exit = nfa.successor(id, pc + 1, Some((slot, 0)));
+                    if count < *min {
+                        let enter = nfa.successor(id, *body, Some((slot, count + 1)));
+                        stack.push(Frame::Explore(enter, thread));
+                    } else if max.is_some_and(|max| count >= max) {
+                        stack.push(Frame::Explore(exit, thread));
+                    } else {
+                        let enter = nfa.successor(id, *body, Some((slot, count + 1)));
+                        if *greedy {
+                            stack.push(Frame::Explore(exit, thread.clone()));
+                            stack.push(Frame::Explore(enter, thread));
+                        } else {
+                            stack.push(Frame::Explore(enter, thread.clone()));
+                            stack.push(Frame::Explore(exit, thread));
+                        }
+                    }
+                }
+
+                Instruction::ProgressCheck { reg, .. } => {
+                    if thread.check_progress(*reg, context.pos) {
+                        stack.push(Frame::Explore(nfa.successor(id, pc + 1, None), thread));
+                    }
+                }
+
+                Instruction::GreedyLoop { min, max, .. } | Instruction::LazyLoop { min, max, .. } => {
+                    let count = nfa.counter(id, self.loop_slot);
+                    let can_exit = count >= *min;
+                    let can_consume = max.is_none_or(|max| count < max);
+                    let greedy = matches!(instruction, Instruction::GreedyLoop { .. });
+                    let exit = can_exit.then(|| nfa.successor(id, pc + 1, Some((self.loop_slot, 0))));
+
+                    match (exit, can_consume) {
+                        (Some(exit), true) if greedy => {
+                            stack.push(Frame::Explore(exit, thread.clone()));
+                            consuming.push((id, thread));
+                        }
+                        (Some(exit), true) => {
+                            stack.push(Frame::Consume(id, thread.clone()));
+                            stack.push(Frame::Explore(exit, thread));
+                        }
+                        (Some(exit), false) => stack.push(Frame::Explore(exit, thread)),
+                        (None, true) => consuming.push((id, thread)),
+                        (None, false) => {}
+                    }
+                }
+
+                Instruction::Fail => {}
+
+                // Rejected by LinearMatcher::new().
+                Instruction::Backref(_)
+                | Instruction::BackrefNamed(_)
+                | Instruction::LookStart { .. }
+                | Instruction::LookEnd
+                | Instruction::PushModifiers { .. }
+                | Instruction::PopModifiers
+                | Instruction::StringPropertyMatch { .. } => {}
+            }
+        }
+        None
+    }
+
+    /// The position reached by consuming `code_unit` at the consuming position `id`.
+    fn step(&self, program: &Program, nfa: &mut NfaPositions, id: u32, code_unit: u16) -> Option<u32> {
+        let pc = nfa.pc(id);
+        let cp = code_unit as u32;
+        let matches = match &program.instructions[pc as usize] {
+            Instruction::GreedyLoop { matcher, min, max } | Instruction::LazyLoop { matcher, min, max } => {
+                if !match_simple(program, matcher, cp) {
+                    return None;
+                }
+                // Unbounded loops only need to know whether `min` was reached.
+                let count = (nfa.counter(id, self.loop_slot) + 1).min(max.unwrap_or(*min));
+                return Some(nfa.successor(id, pc, Some((self.loop_slot, count))));
+            }
+            Instruction::Char(c) => {
+                if program.ignore_case {
+                    vm::case_fold_eq(cp, *c, false)
+                } else {
+                    cp == *c
+                }
+            }
+            Instruction::CharNoCase(lo, _hi) => vm::case_fold_eq(cp, *lo, false),
+            Instruction::AnyChar { dot_all } => *dot_all || program.dot_all || !vm::is_line_terminator(cp),
+            Instruction::CharClass { ranges, negated } => {
+                vm::match_char_class(cp, ranges, program.ignore_case, false, false) != *negated
+            }
+            Instruction::BuiltinClass(class) => vm::match_builtin_class(cp, *class, false),
+            Instruction::UnicodeProperty(data) => match_unicode_property(data, cp),
+            _ => false,
+        };
+        matches.then(|| nfa.successor(id, pc + 1, None))
+    }
+
+    fn counter_slot(&self, counter_register: u32) -> usize {
+        self.counter_registers
+            .iter()
+            .position(|register| *register == counter_register)
+            .expect("counter register was collected by LinearMatcher::new()")
+    }
+}
+
+/// Non-Unicode counterpart of the backtracking VM's simple matcher.
+fn match_simple(program: &Program, matcher: &SimpleMatch, cp: u32) -> bool {
+    match matcher {
+        SimpleMatch::AnyChar { dot_all } => *dot_all || program.dot_all || !vm::is_line_terminator(cp),
+        SimpleMatch::Char(c) => {
+            if program.ignore_case {
+                vm::case_fold_eq(cp, *c, false)
+            } else {
+                cp == *c
+            }
+        }
+        SimpleMatch::CharNoCase(lo, _hi) => vm::case_fold_eq(cp, *lo, false),
+        SimpleMatch::CharClass { ranges, negated } => {
+            vm::match_char_class(cp, ranges, program.ignore_case, false, false) != *negated
+        }
+        SimpleMatch::BuiltinClass(class) => vm::match_builtin_class(cp, *class, false),
+        SimpleMatch::UnicodeProperty(data) => match_unicode_property(data, cp),
+        SimpleMatch::Union(lhs, rhs) => match_simple(program, lhs, cp) || match_simple(program, rhs, cp),
+    }
+}
+
+fn match_unicode_property(data: &UnicodePropertyData, cp: u32) -> bool {
+    let matched = vm::match_unicode_property_resolved(cp, &data.name, data.value.as_deref(), data.resolved.as_ref());
+    matched != data.negated
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+//! Vectorizable scans for literal prefilters.
+//!
+//! These back the literal fast paths and the start-position and required
+//! literal hints. Each scan first tests a whole block of code units without
+//! exiting early, which LLVM lowers to packed compares on every target we build
+//! for, and only then locates the hit inside the block. This keeps the scans
+//! portable, without any target-specific intrinsics.
+
+/// Number of code units tested per block. 32 code units fill two 256-bit (or
+/// four 128-bit) vector registers for UTF-16 input.
+const BLOCK_SIZE: usize = 32;
+
+/// Find the first code unit in `haystack` that satisfies `predicate`.
+#[inline(always)]
+fn find_by<T: Copy>(haystack: &[T], predicate: impl Fn(T) -> bool) -> Option<usize> {
+    let mut blocks = haystack.chunks_exact(BLOCK_SIZE);
+    let mut offset = 0;
+    for block in &mut blocks {
+        if block
+            .iter()
+            .fold(false, |found, &code_unit| found | predicate(code_unit))
+        {
+            return block
+                .iter()
+                .position(|&code_unit| predicate(code_unit))
+                .map(|index| offset + index);
+        }
+        offset += BLOCK_SIZE;
+    }
+    blocks
+        .remainder()
+        .iter()
+        .position(|&code_unit| predicate(code_unit))
+        .map(|index| offset + index)
+}
+
+/// Find the first occurrence of `needle` in `haystack`.
+#[inline(always)]
+pub(crate) fn find<T: Copy + Eq>(haystack: &[T], needle: T) -> Option<usize> {
+    find_by(haystack, |code_unit| code_unit == needle)
+}
+
+/// Find the first occurrence of any of `needles` in `haystack`.
+/// Sets of up to three code units are tested with one vectorized pass.
+#[inline(always)]
+pub(crate) fn find_any<T: Copy + Eq>(haystack: &[T], needles: &[T]) -> Option<usize> {
+    match *needles {
+        [] => None,
+        [a] => find(haystack, a),
+        [a, b] => find_by(haystack, |code_unit| (code_unit == a) | (code_unit == b)),
+        [a, b, c] => find_by(haystack, |code_unit| {
+            (code_unit == a) | (code_unit == b) | (code_unit == c)
+        }),
+        _ => haystack.iter().position(|code_unit| needles.contains(code_unit)),
+    }
+}
+
+/// Find the first occurrence of `needle` in `haystack`.
+///
+/// Candidates are found by comparing the first and last code unit of the
+/// needle against a block of positions at once, which rejects most positions
+/// without looking at the rest of the needle.
+pub(crate) fn find_subslice<T: Copy + Eq>(haystack: &[T], needle: &[T]) -> Option<usize> {
+    match needle.len() {
+        0 => return Some(0),
+        1 => return find(haystack, needle[0]),
+        _ => {}
+    }
+    if needle.len() > haystack.len() {
+        return None;
+    }
+
+    let first = needle[0];
+    let last_offset = needle.len() - 1;
+    let last = needle[last_offset];
+    let candidate_count = haystack.len() - last_offset;
+
+    let mut pos = 0;
+    while pos + BLOCK_SIZE <= candidate_count {
+        let firsts = &haystack[pos..pos + BLOCK_SIZE];
+        let lasts = &haystack[pos + last_offset..pos + last_offset + BLOCK_SIZE];
+        let mut mask = 0u32;
+        for index in 0..BLOCK_SIZE {
+            mask |= (((firsts[index] == first) & (lasts[index] == last)) as u32) << index;
+        }
+        while mask != 0 {
+            let candidate = pos + mask.trailing_zeros() as usize;
+            if haystack[candidate + 1..candidate + last_offset] == needle[1..last_offset] {
+                return Some(candidate);
+            }
+            mask &= mask - 1;
+        }
+        pos += BLOCK_SIZE;
+    }
+
+    while pos < candidate_count {
+        if haystack[pos] == first
+            && haystack[pos + last_offset] == last
+            && haystack[pos + 1..pos + last_offset] == needle[1..last_offset]
+        {
+            return Some(pos);
+        }
+        pos += 1;
+    }
+    None
+}
+
+/// Collect the distinct leading code units of `literals`, or `None` if there
+/// are more than `limit` of them.
+pub(crate) fn distinct_first_code_units(literals: &[Vec<u16>], limit: usize) -> Option<Vec<u16>> {
+    let mut code_units = Vec::new();
+    for literal in literals {
+        let first = *literal.first()?;
+        if !code_units.contains(&first) {
+            if code_units.len() == limit {
+                return None;
+            }
+            code_units.push(first);
+        }
+    }
+    Some(code_units)
+}
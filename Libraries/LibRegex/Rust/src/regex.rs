@@ -17,7 +17,9 @@ use crate::bytecode::Instruction;
 use crate::bytecode::NamedGroupEntry;
 use crate::bytecode::append_code_point_wtf16;
 use crate::compiler;
+use crate::linear::LinearMatcher;
 use crate::parser;
+use crate::prefilter;
 use crate::vm;
 use std::cell::RefCell;
 use std::collections::HashSet;
@@ -35,6 +37,10 @@ pub struct Regex {
     /// Pre-computed u16 alternatives for fast literal alternation matching.
     /// Alternatives stay in source order to preserve leftmost-first semantics.
     literal_alt_u16: Option<Vec<Vec<u16>>>,
+    /// Matcher without backtracking, for patterns that don't need it.
+    /// Answers `test()` in linear time, and finishes searches for which the
+    /// backtracking VM hits its step limit.
+    linear: Option<LinearMatcher>,
     /// Cached VM scratch space for reuse across exec calls.
     scratch: RefCell<vm::VmScratch>,
 }
@@ -60,6 +66,7 @@ impl Regex {
         let literal_u16 = extract_literal_u16(&parsed, flags);
         let word_boundary_literal_u16 = extract_word_boundary_literal_u16(&parsed, flags);
         let literal_alt_u16 = extract_literal_alternatives_u16(&parsed, flags);
+        let linear = LinearMatcher::new(&program);
 
         Ok(Self {
             program,
@@ -68,6 +75,7 @@ impl Regex {
             literal_u16,
             word_boundary_literal_u16,
             literal_alt_u16,
+            linear,
             scratch: RefCell::new(vm::VmScratch::new()),
         })
     }
@@ -86,8 +94,11 @@ impl Regex {
 
     pub(crate) fn exec_into_input<I: vm::Input>(&self, input: I, start: usize, out: &mut [i32]) -> vm::VmResult {
         if self.flags.sticky {
-            let scratch = &mut *self.scratch.borrow_mut();
-            return vm::execute_anchored_into_with_scratch(&self.program, input, start, &self.hints, out, scratch);
+            let result = {
+                let scratch = &mut *self.scratch.borrow_mut();
+                vm::execute_anchored_into_with_scratch(&self.program, input, start, &self.hints, out, scratch)
+            };
+            return self.finish_linear_if_limit_exceeded(result, input, start, true, out);
         }
 
         // Fast path for literal patterns: use fast substring search.
@@ -114,8 +125,46 @@ impl Regex {
                 vm::VmResult::NoMatch
             };
         }
-        let scratch = &mut *self.scratch.borrow_mut();
-        vm::execute_into_with_scratch(&self.program, input, start, &self.hints, out, scratch)
+        // Rule out inputs without any match in linear time before backtracking,
+        // since that is where backtracking is slowest.
+        if let Some(ref linear) = self.linear
+            && !self.hints.has_simple_scan()
+            && !linear.is_match(&self.program, input, start, false, &self.hints)
+        {
+            return vm::VmResult::NoMatch;
+        }
+        let result = {
+            let scratch = &mut *self.scratch.borrow_mut();
+            if self.linear.is_some() {
+                vm::execute_leftmost_into_with_scratch(&self.program, input, start, &self.hints, out, scratch)
+            } else {
+                vm::execute_into_with_scratch(&self.program, input, start, &self.hints, out, scratch)
+            }
+        };
+        self.finish_linear_if_limit_exceeded(result, input, start, false, out)
+    }
+
+    /// Redo a search that exceeded the backtracking VM's step limit without
+    /// backtracking, if the pattern allows it.
+    fn finish_linear_if_limit_exceeded<I: vm::Input>(
+        &self,
+        result: vm::VmResult,
+        input: I,
+        start: usize,
+        anchored: bool,
+        out: &mut [i32],
+    ) -> vm::VmResult {
+        let Some(ref linear) = self.linear else {
+            return result;
+        };
+        if result != vm::VmResult::LimitExceeded {
+            return result;
+        }
+        if linear.find_into(&self.program, input, start, anchored, &self.hints, out) {
+            vm::VmResult::Match
+        } else {
+            vm::VmResult::NoMatch
+        }
     }
 
     /// Test whether the regex matches anywhere in the input.
@@ -128,6 +177,16 @@ impl Regex {
     }
 
     pub(crate) fn test_input<I: vm::Input>(&self, input: I, start: usize) -> vm::VmResult {
+        if let Some(ref linear) = self.linear
+            && (self.flags.sticky || !(self.has_literal_fast_path() || self.hints.has_simple_scan()))
+        {
+            return if linear.is_match(&self.program, input, start, self.flags.sticky, &self.hints) {
+                vm::VmResult::Match
+            } else {
+                vm::VmResult::NoMatch
+            };
+        }
+
         if self.flags.sticky {
             let mut out = [-1i32; 2];
             let scratch = &mut *self.scratch.borrow_mut();
@@ -162,6 +221,10 @@ impl Regex {
         vm::execute_into_with_scratch(&self.program, input, start, &self.hints, &mut out, scratch)
     }
 
+    fn has_literal_fast_path(&self) -> bool {
+        self.literal_u16.is_some() || self.word_boundary_literal_u16.is_some() || self.literal_alt_u16.is_some()
+    }
+
     /// Fast literal substring search for whole-pattern literal fast paths.
     fn literal_search<I: vm::Input>(input: I, start: usize, needle: &[u16], flags: &Flags, out: &mut [i32]) -> bool {
         if needle.is_empty() {
@@ -224,31 +287,15 @@ impl Regex {
             return false;
         }
 
-        // Case-sensitive: use fast first-character scan + verify.
-        let first = needle[0];
-        let needle_len = needle.len();
-        if start + needle_len > input.len() {
+        // Case-sensitive: vectorized substring search.
+        let Some(pos) = input.find_u16_subslice(start, needle) else {
             return false;
+        };
+        if out.len() >= 2 {
+            out[0] = pos as i32;
+            out[1] = (pos + needle.len()) as i32;
         }
-        let mut pos = start;
-        let end = input.len() - needle_len + 1;
-        while pos < end {
-            // Bulk scan for first character.
-            match input.find_code_unit(pos, end, first) {
-                Some(candidate_pos) => pos = candidate_pos,
-                None => return false,
-            }
-            // Verify rest of needle.
-            if input.matches_u16_at(pos, needle) {
-                if out.len() >= 2 {
-                    out[0] = pos as i32;
-                    out[1] = (pos + needle_len) as i32;
-                }
-                return true;
-            }
-            pos += 1;
-        }
-        false
+        true
     }
 
     /// Fast literal test (no captures needed).
@@ -306,7 +353,17 @@ impl Regex {
             return Self::literal_alt_search_ascii_ignore_case(input, start, alts, out);
         }
 
-        for pos in start..input.len() {
+        // Scan for the alternatives' first code units in one pass when there are
+        // few enough of them, otherwise test every position.
+        let first_code_units = prefilter::distinct_first_code_units(alts, MAX_PREFILTER_CODE_UNITS);
+        let mut pos = start;
+        while pos < input.len() {
+            if let Some(ref first_code_units) = first_code_units {
+                match input.find_any_code_unit(pos, input.len(), first_code_units) {
+                    Some(candidate_pos) => pos = candidate_pos,
+                    None => return false,
+                }
+            }
             let first_ch = input.code_unit(pos);
             for alt in alts {
                 if alt[0] != first_ch {
@@ -324,6 +381,7 @@ impl Regex {
                     return true;
                 }
             }
+            pos += 1;
         }
         false
     }
@@ -340,14 +398,26 @@ impl Regex {
         }
 
         let mut first_code_units = [false; 128];
+        let mut first_code_unit_variants = Vec::new();
         for alt in alts {
             first_code_units[fold_ascii_for_compare(alt[0]) as usize] = true;
+            for &variant in vm::ascii_case_variants(alt[0]).as_slice() {
+                if !first_code_unit_variants.contains(&variant) {
+                    first_code_unit_variants.push(variant);
+                }
+            }
         }
+        let scan_for_variants = first_code_unit_variants.len() <= MAX_PREFILTER_CODE_UNITS;
 
         let mut pos = start;
         let end = input.len() - min_alt_len + 1;
         while pos < end {
-            match find_ascii_case_insensitive_code_unit_in_set(input, pos, end, &first_code_units) {
+            let next = if scan_for_variants {
+                input.find_any_code_unit(pos, end, &first_code_unit_variants)
+            } else {
+                find_ascii_case_insensitive_code_unit_in_set(input, pos, end, &first_code_units)
+            };
+            match next {
                 Some(candidate_pos) => pos = candidate_pos,
                 None => return false,
             }
@@ -556,12 +626,30 @@ impl Regex {
         if let Some(ref alts) = self.literal_alt_u16 {
             return Self::literal_alt_find_all(input, start, alts, &self.flags, result_buf);
         }
+        if let Some(ref linear) = self.linear
+            && !self.hints.has_simple_scan()
+            && !linear.is_match(&self.program, input, start, false, &self.hints)
+        {
+            return 0;
+        }
         // Use the VM-internal find_all loop which reuses a single VM across matches.
-        let scratch = &mut *self.scratch.borrow_mut();
-        vm::find_all_with_scratch(&self.program, input, start, &self.hints, result_buf, scratch)
+        let count = {
+            let scratch = &mut *self.scratch.borrow_mut();
+            vm::find_all_with_scratch(&self.program, input, start, &self.hints, result_buf, scratch)
+        };
+        match self.linear {
+            Some(ref linear) if count == -2 => {
+                linear.find_all_into(&self.program, input, start, &self.hints, result_buf)
+            }
+            _ => count,
+        }
     }
 }
 
+/// Largest set of code units searched for with a single vectorized scan, see
+/// `prefilter::find_any()`.
+const MAX_PREFILTER_CODE_UNITS: usize = 3;
+
 #[inline(always)]
 fn is_ascii_alpha(ch: u16) -> bool {
     matches!(ch, 0x41..=0x5A | 0x61..=0x7A)
@@ -587,16 +675,7 @@ fn find_ascii_case_insensitive_code_unit<I: vm::Input>(
     end: usize,
     needle: u16,
 ) -> Option<usize> {
-    let folded_needle = fold_ascii_for_compare(needle);
-    let mut pos = start;
-    while pos < end {
-        let code_unit = input.code_unit(pos);
-        if code_unit <= 0x7F && fold_ascii_for_compare(code_unit) == folded_needle {
-            return Some(pos);
-        }
-        pos += 1;
-    }
-    None
+    input.find_any_code_unit(start, end, vm::ascii_case_variants(needle).as_slice())
 }
 
 #[inline(always)]
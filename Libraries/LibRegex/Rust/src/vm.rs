@@ -13,6 +13,7 @@
 //! - <https://tc39.es/ecma262/#sec-pattern-semantics>
 //! - <https://tc39.es/ecma262/#sec-regexpbuiltinexec>
 use crate::bytecode::*;
+use crate::prefilter;
 
 /// Maximum number of steps before aborting (prevents ReDoS).
 const MATCH_LIMIT: u64 = 10_000_000;
@@ -46,6 +47,37 @@ pub trait Input: Copy {
         None
     }
 
+    #[inline(always)]
+    fn find_any_code_unit(self, start: usize, end: usize, code_units: &[u16]) -> Option<usize> {
+        let mut pos = start;
+        while pos < end {
+            if code_units.contains(&self.code_unit(pos)) {
+                return Some(pos);
+            }
+            pos += 1;
+        }
+        None
+    }
+
+    #[inline(always)]
+    fn find_u16_subslice(self, start: usize, needle: &[u16]) -> Option<usize> {
+        if needle.is_empty() {
+            return (start <= self.len()).then_some(start);
+        }
+        if start + needle.len() > self.len() {
+            return None;
+        }
+        let end = self.len() - needle.len() + 1;
+        let mut pos = start;
+        while let Some(candidate_pos) = self.find_code_unit(pos, end, needle[0]) {
+            if self.matches_u16_at(candidate_pos, needle) {
+                return Some(candidate_pos);
+            }
+            pos = candidate_pos + 1;
+        }
+        None
+    }
+
     #[inline(always)]
     fn next_literal_start(self, start_pos: usize, ch16: u16) -> Option<usize> {
         self.find_code_unit(start_pos, self.len(), ch16)
@@ -99,7 +131,19 @@ impl Input for &[u16] {
 
     #[inline(always)]
     fn find_code_unit(self, start: usize, end: usize, ch16: u16) -> Option<usize> {
-        let offset = self.get(start..end)?.iter().position(|&c| c == ch16)?;
+        let offset = prefilter::find(self.get(start..end)?, ch16)?;
+        Some(start + offset)
+    }
+
+    #[inline(always)]
+    fn find_any_code_unit(self, start: usize, end: usize, code_units: &[u16]) -> Option<usize> {
+        let offset = prefilter::find_any(self.get(start..end)?, code_units)?;
+        Some(start + offset)
+    }
+
+    #[inline(always)]
+    fn find_u16_subslice(self, start: usize, needle: &[u16]) -> Option<usize> {
+        let offset = prefilter::find_subslice(self.get(start..)?, needle)?;
         Some(start + offset)
     }
 
@@ -136,7 +180,55 @@ impl Input for &[u8] {
         if byte > 0x7F {
             return None;
         }
-        let offset = self.get(start..end)?.iter().position(|&c| c == byte)?;
+        let offset = prefilter::find(self.get(start..end)?, byte)?;
+        Some(start + offset)
+    }
+
+    #[inline(always)]
+    fn find_any_code_unit(self, start: usize, end: usize, code_units: &[u16]) -> Option<usize> {
+        let mut bytes = [0u8; 3];
+        let mut byte_count = 0;
+        for &code_unit in code_units {
+            if code_unit > 0x7F {
+                continue;
+            }
+            if byte_count == bytes.len() {
+                return self
+                    .get(start..end)?
+                    .iter()
+                    .position(|&c| code_units.contains(&(c as u16)))
+                    .map(|offset| start + offset);
+            }
+            bytes[byte_count] = code_unit as u8;
+            byte_count += 1;
+        }
+        let offset = prefilter::find_any(self.get(start..end)?, &bytes[..byte_count])?;
+        Some(start + offset)
+    }
+
+    #[inline(always)]
+    fn find_u16_subslice(self, start: usize, needle: &[u16]) -> Option<usize> {
+        // ASCII input can only contain ASCII needles, which are narrowed to bytes for the scan.
+        let mut bytes = [0u8; 64];
+        if needle.len() > bytes.len() {
+            return self
+                .get(start..)?
+                .windows(needle.len())
+                .position(|window| {
+                    window
+                        .iter()
+                        .zip(needle.iter())
+                        .all(|(actual, expected)| *actual as u16 == *expected)
+                })
+                .map(|offset| start + offset);
+        }
+        for (byte, &code_unit) in bytes.iter_mut().zip(needle.iter()) {
+            if code_unit > 0x7F {
+                return None;
+            }
+            *byte = code_unit as u8;
+        }
+        let offset = prefilter::find_subslice(self.get(start..)?, &bytes[..needle.len()])?;
         Some(start + offset)
     }
 
@@ -289,27 +381,7 @@ fn contains_u16_from<I: Input>(input: I, start: usize, needle: &[u16]) -> bool {
         return true;
     }
 
-    if needle.len() == 1 {
-        return input.find_code_unit(start, input.len(), needle[0]).is_some();
-    }
-
-    if start + needle.len() > input.len() {
-        return false;
-    }
-
-    let mut pos = start;
-    let end = input.len() - needle.len() + 1;
-    while pos < end {
-        match input.find_code_unit(pos, end, needle[0]) {
-            Some(candidate_pos) => pos = candidate_pos,
-            None => return false,
-        }
-        if input.matches_u16_at(pos, needle) {
-            return true;
-        }
-        pos += 1;
-    }
-    false
+    input.find_u16_subslice(start, needle).is_some()
 }
 
 #[inline(always)]
@@ -331,19 +403,13 @@ fn contains_ascii_case_insensitive_u16_from<I: Input>(input: I, start: usize, ne
         return false;
     }
 
-    let folded_first = fold_ascii_for_compare(needle[0]);
+    let first_variants = ascii_case_variants(needle[0]);
     let mut pos = start;
     let end = input.len() - needle_len + 1;
     while pos < end {
-        while pos < end {
-            let code_unit = input.code_unit(pos);
-            if code_unit <= 0x7F && fold_ascii_for_compare(code_unit) == folded_first {
-                break;
-            }
-            pos += 1;
-        }
-        if pos >= end {
-            return false;
+        match input.find_any_code_unit(pos, end, first_variants.as_slice()) {
+            Some(candidate_pos) => pos = candidate_pos,
+            None => return false,
         }
         if matches_ascii_case_insensitive_u16_at(input, pos, needle) {
             return true;
@@ -353,6 +419,37 @@ fn contains_ascii_case_insensitive_u16_from<I: Input>(input: I, start: usize, ne
     false
 }
 
+/// The code units that compare equal to `ch` under ASCII case folding.
+pub(crate) struct AsciiCaseVariants {
+    code_units: [u16; 2],
+    count: usize,
+}
+
+impl AsciiCaseVariants {
+    #[inline(always)]
+    pub(crate) fn as_slice(&self) -> &[u16] {
+        &self.code_units[..self.count]
+    }
+}
+
+#[inline(always)]
+pub(crate) fn ascii_case_variants(ch: u16) -> AsciiCaseVariants {
+    match ch {
+        0x41..=0x5A => AsciiCaseVariants {
+            code_units: [ch, ch + 32],
+            count: 2,
+        },
+        0x61..=0x7A => AsciiCaseVariants {
+            code_units: [ch - 32, ch],
+            count: 2,
+        },
+        _ => AsciiCaseVariants {
+            code_units: [ch, ch],
+            count: 1,
+        },
+    }
+}
+
 #[inline(always)]
 fn matches_ascii_case_insensitive_u16_at<I: Input>(input: I, pos: usize, needle: &[u16]) -> bool {
     if pos + needle.len() > input.len() {
@@ -486,6 +583,34 @@ fn next_candidate_start<I: Input>(program: &Program, input: I, hints: &PatternHi
     None
 }
 
+/// Whether the literal hints rule out any match starting at or after `start_pos`.
+#[inline(always)]
+pub(crate) fn fails_literal_hints<I: Input>(input: I, start_pos: usize, hints: &PatternHints) -> bool {
+    fails_trailing_literal_hint(input, hints) || fails_required_literal_hint(input, start_pos, hints)
+}
+
+/// Find the next position at or after `pos` where a match may start, using the
+/// same start-position filters as the backtracking search loop.
+#[inline(always)]
+pub(crate) fn next_match_candidate<I: Input>(
+    program: &Program,
+    input: I,
+    hints: &PatternHints,
+    pos: usize,
+) -> Option<usize> {
+    if !program.unicode {
+        if let Some(ref start_hint) = hints.start_position_hint {
+            return next_literal_start_from_hint(input, pos, start_hint);
+        }
+        if let Some((ch, false)) = hints.first_char
+            && ch <= 0xFFFF
+        {
+            return input.next_literal_start(pos, ch as u16);
+        }
+    }
+    next_candidate_start(program, input, hints, pos)
+}
+
 /// Execute the program, reusing a provided VmScratch to avoid per-call allocation.
 pub fn execute_into_with_scratch<I: Input>(
     program: &Program,
@@ -495,7 +620,22 @@ pub fn execute_into_with_scratch<I: Input>(
     out: &mut [i32],
     scratch: &mut VmScratch,
 ) -> VmResult {
-    execute_into_impl(program, input, start_pos, hints, out, scratch)
+    execute_into_impl(program, input, start_pos, hints, out, scratch, false)
+}
+
+/// Execute the program like `execute_into_with_scratch`, but give up at the
+/// first start position that exceeds the step limit. Later positions may still
+/// match, but such a match would not be the leftmost one, so callers that can
+/// redo the search another way use this to keep leftmost-first semantics.
+pub fn execute_leftmost_into_with_scratch<I: Input>(
+    program: &Program,
+    input: I,
+    start_pos: usize,
+    hints: &PatternHints,
+    out: &mut [i32],
+    scratch: &mut VmScratch,
+) -> VmResult {
+    execute_into_impl(program, input, start_pos, hints, out, scratch, true)
 }
 
 /// Execute the program at exactly `start_pos`.
@@ -695,6 +835,7 @@ fn execute_into_impl<I: Input>(
     hints: &PatternHints,
     out: &mut [i32],
     scratch: &mut VmScratch,
+    stop_at_limit: bool,
 ) -> VmResult {
     if fails_trailing_literal_hint(input, hints) {
         return VmResult::NoMatch;
@@ -738,6 +879,7 @@ fn execute_into_impl<I: Input>(
                     copy_captures_to_out(vm.registers, program.capture_count, out);
                     return VmResult::Match;
                 }
+                VmResult::LimitExceeded if stop_at_limit => return VmResult::LimitExceeded,
                 VmResult::LimitExceeded => hit_limit = true,
                 VmResult::NoMatch => {}
             }
@@ -765,6 +907,7 @@ fn execute_into_impl<I: Input>(
                     copy_captures_to_out(vm.registers, program.capture_count, out);
                     return VmResult::Match;
                 }
+                VmResult::LimitExceeded if stop_at_limit => return VmResult::LimitExceeded,
                 VmResult::LimitExceeded => hit_limit = true,
                 VmResult::NoMatch => {}
             }
@@ -787,6 +930,7 @@ fn execute_into_impl<I: Input>(
                 copy_captures_to_out(vm.registers, program.capture_count, out);
                 return VmResult::Match;
             }
+            VmResult::LimitExceeded if stop_at_limit => return VmResult::LimitExceeded,
             VmResult::LimitExceeded => hit_limit = true,
             VmResult::NoMatch => {}
         }
@@ -989,11 +1133,21 @@ pub struct PatternHints {
     can_match_empty: bool,
 }
 
+impl PatternHints {
+    /// Whether the pattern is a single matcher that is searched for without the VM.
+    pub(crate) fn has_simple_scan(&self) -> bool {
+        self.simple_scan.is_some()
+    }
+}
+
 pub(crate) struct RequiredLiteralHint {
     pub literal: Vec<u16>,
     pub ascii_case_insensitive: bool,
 }
 
+/// Largest set of leading literal code units tracked by a start position hint.
+const MAX_START_POSITION_HINT_LITERALS: usize = 3;
+
 struct StartPositionHint {
     includes_input_start: bool,
     literal_code_units: Vec<u16>,
@@ -1112,10 +1266,12 @@ fn analyze_start_position_hint(instructions: &[Instruction], start: usize) -> Op
         }
     }
 
-    // Keep this hint narrowly scoped to `(^|literal)` prefixes. Wider literal
-    // sets require a single-pass scanner; repeated `find_code_unit()` probes
-    // per literal turn miss-heavy inputs quadratic.
-    if hint.includes_input_start && hint.literal_code_units.len() == 1 {
+    // Only keep literal sets that find_any_code_unit() can scan for in a single
+    // vectorized pass; repeated `find_code_unit()` probes per literal would turn
+    // miss-heavy inputs quadratic.
+    if (1..=MAX_START_POSITION_HINT_LITERALS).contains(&hint.literal_code_units.len())
+        && (hint.includes_input_start || hint.literal_code_units.len() > 1)
+    {
         Some(hint)
     } else {
         None
@@ -1124,15 +1280,14 @@ fn analyze_start_position_hint(instructions: &[Instruction], start: usize) -> Op
 
 #[inline(always)]
 fn next_literal_start_from_hint<I: Input>(input: I, start: usize, hint: &StartPositionHint) -> Option<usize> {
-    let [literal] = hint.literal_code_units.as_slice() else {
-        return None;
-    };
-
     if hint.includes_input_start && start == 0 {
         return Some(0);
     }
 
-    input.next_literal_start(start, *literal)
+    match hint.literal_code_units.as_slice() {
+        [literal] => input.next_literal_start(start, *literal),
+        literals => input.find_any_code_unit(start, input.len(), literals),
+    }
 }
 
 /// Analyze the program to extract optimization hints.
@@ -3449,7 +3604,7 @@ pub(crate) fn case_fold_eq(a: u32, b: u32, unicode_mode: bool) -> bool {
 }
 
 #[inline(always)]
-fn is_word_char(cp: u32) -> bool {
+pub(crate) fn is_word_char(cp: u32) -> bool {
     matches!(cp, 0x30..=0x39 | 0x41..=0x5A | 0x61..=0x7A | 0x5F)
 }
 
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Variant.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibCore/ImmutableBytes.h>
+#include <LibHTTP/Cache/Utilities.h>
+
+namespace Requests {
+
+// Data that was stored next to a response in the disk cache, and which RequestServer sends along with the response.
+// Decoded fonts arrive as the sealed buffer that RequestServer shares with every process that renders them.
+struct CachedAssociatedData {
+    HTTP::CacheEntryAssociatedData type;
+    Variant<Core::ImmutableBytes, Core::AnonymousBuffer> data;
+};
+
+}
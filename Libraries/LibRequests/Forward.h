@@ -12,6 +12,7 @@ class Request;
 class RequestClient;
 class ResponseData;
 class WebSocket;
+struct CachedAssociatedData;
 struct RequestTimingInfo;
 
 }
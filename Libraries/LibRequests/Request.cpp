@@ -193,12 +193,12 @@ void Request::set_buffered_request_finished_callback(BufferedRequestFinished on_
 
     m_internal_buffered_data = make<InternalBufferedData>();
 
-    on_headers_received = [this](auto headers, auto response_code, auto const& reason_phrase, auto javascript_bytecode, auto javascript_bytecode_cache_vary_key, auto came_from_cache) {
+    on_headers_received = [this](auto headers, auto response_code, auto const& reason_phrase, auto associated_data, auto disk_cache_vary_key, auto came_from_cache) {
         m_internal_buffered_data->response_headers = move(headers);
         m_internal_buffered_data->response_code = move(response_code);
         m_internal_buffered_data->reason_phrase = reason_phrase;
-        m_internal_buffered_data->javascript_bytecode = move(javascript_bytecode);
-        m_internal_buffered_data->javascript_bytecode_cache_vary_key = javascript_bytecode_cache_vary_key;
+        m_internal_buffered_data->associated_data = move(associated_data);
+        m_internal_buffered_data->disk_cache_vary_key = disk_cache_vary_key;
         m_internal_buffered_data->came_from_cache = came_from_cache;
     };
 
@@ -219,8 +219,8 @@ void Request::set_buffered_request_finished_callback(BufferedRequestFinished on_
             m_internal_buffered_data->response_headers,
             m_internal_buffered_data->response_code,
             m_internal_buffered_data->reason_phrase,
-            move(m_internal_buffered_data->javascript_bytecode),
-            m_internal_buffered_data->javascript_bytecode_cache_vary_key,
+            move(m_internal_buffered_data->associated_data),
+            m_internal_buffered_data->disk_cache_vary_key,
             m_internal_buffered_data->came_from_cache,
             move(payload));
     };
@@ -255,10 +255,10 @@ void Request::did_finish(Badge<RequestClient>, u64 total_size, RequestTimingInfo
         on_finish(total_size, timing_info, effective_network_error);
 }
 
-void Request::did_receive_headers(Badge<RequestClient>, NonnullRefPtr<HTTP::HeaderList> response_headers, Optional<u32> response_code, Optional<String> const& reason_phrase, Optional<Core::ImmutableBytes> javascript_bytecode, Optional<u64> javascript_bytecode_cache_vary_key, CameFromCache came_from_cache)
+void Request::did_receive_headers(Badge<RequestClient>, NonnullRefPtr<HTTP::HeaderList> response_headers, Optional<u32> response_code, Optional<String> const& reason_phrase, Optional<CachedAssociatedData> associated_data, Optional<u64> disk_cache_vary_key, CameFromCache came_from_cache)
 {
     if (on_headers_received)
-        on_headers_received(move(response_headers), response_code, reason_phrase, move(javascript_bytecode), javascript_bytecode_cache_vary_key, came_from_cache);
+        on_headers_received(move(response_headers), response_code, reason_phrase, move(associated_data), disk_cache_vary_key, came_from_cache);
 }
 
 void Request::did_request_certificates(Badge<RequestClient>)
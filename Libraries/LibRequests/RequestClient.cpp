@@ -13,27 +13,48 @@
 
 namespace Requests {
 
-static Optional<Core::ImmutableBytes> map_javascript_bytecode_file(int fd, u64 size)
+static Optional<Core::ImmutableBytes> map_associated_data_file(int fd, u64 size)
 {
     ArmedScopeGuard close_fd = [fd] {
         (void)Core::System::close(fd);
     };
 
     if (!AK::is_within_range<size_t>(size)) {
-        dbgln("RequestClient: Received JavaScript bytecode cache file outside mappable range");
+        dbgln("RequestClient: Received cache associated data file outside mappable range");
         return {};
     }
 
     close_fd.disarm();
-    auto payload = Core::ImmutableBytes::map_from_fd_range_and_close(fd, "javascript bytecode cache"sv, 0, static_cast<size_t>(size));
+    auto payload = Core::ImmutableBytes::map_from_fd_range_and_close(fd, "cache associated data"sv, 0, static_cast<size_t>(size));
     if (payload.is_error()) {
-        dbgln("RequestClient: Failed to map JavaScript bytecode cache file: {}", payload.error());
+        dbgln("RequestClient: Failed to map cache associated data file: {}", payload.error());
         return {};
     }
 
     return payload.release_value();
 }
 
+static Optional<Core::AnonymousBuffer> map_shared_associated_data_file(int fd, u64 size)
+{
+    if (!AK::is_within_range<size_t>(size)) {
+        (void)Core::System::close(fd);
+        dbgln("RequestClient: Received shared cache associated data outside mappable range");
+        return {};
+    }
+
+    auto buffer = Core::AnonymousBuffer::create_from_anon_fd(fd, static_cast<size_t>(size));
+    if (buffer.is_error()) {
+        dbgln("RequestClient: Failed to map shared cache associated data: {}", buffer.error());
+        return {};
+    }
+    if (auto result = buffer.value().validate_sealed_size(); result.is_error()) {
+        dbgln("RequestClient: Ignoring shared cache associated data: {}", result.error());
+        return {};
+    }
+
+    return buffer.release_value();
+}
+
 RequestClient::RequestClient(NonnullOwnPtr<IPC::Transport> transport)
     : IPC::ConnectionToServer<RequestClientEndpoint, RequestServerEndpoint>(*this, move(transport))
 {
@@ -187,6 +208,12 @@ void RequestClient::removed_cache_entries(u64 clear_cache_request_id)
         (*promise)->resolve({});
 }
 
+void RequestClient::did_release_memory(Core::MemoryPressure::Level level, u64 bytes_released)
+{
+    if (on_memory_released)
+        on_memory_released(level, bytes_released);
+}
+
 void RequestClient::request_started(u64 request_id, IPC::File response_file)
 {
     auto request = m_requests.get(request_id);
@@ -231,14 +258,19 @@ void RequestClient::request_finished(u64 request_id, u64 total_size, RequestTimi
     }
 }
 
-void RequestClient::headers_became_available(u64 request_id, Vector<HTTP::Header> response_headers, Optional<u32> status_code, Optional<String> reason_phrase, Optional<IPC::File> javascript_bytecode_file, u64 javascript_bytecode_size, Optional<u64> javascript_bytecode_cache_vary_key, CameFromCache came_from_cache)
+void RequestClient::headers_became_available(u64 request_id, Vector<HTTP::Header> response_headers, Optional<u32> status_code, Optional<String> reason_phrase, Optional<IPC::File> associated_data_file, u64 associated_data_size, HTTP::CacheEntryAssociatedData associated_data_type, Optional<u64> disk_cache_vary_key, CameFromCache came_from_cache)
 {
-    Optional<Core::ImmutableBytes> javascript_bytecode;
-    if (javascript_bytecode_file.has_value())
-        javascript_bytecode = map_javascript_bytecode_file(javascript_bytecode_file->take_fd(), javascript_bytecode_size);
+    Optional<CachedAssociatedData> associated_data;
+    if (associated_data_file.has_value() && associated_data_type == HTTP::CacheEntryAssociatedData::DecodedFont) {
+        if (auto data = map_shared_associated_data_file(associated_data_file->take_fd(), associated_data_size); data.has_value())
+            associated_data = CachedAssociatedData { .type = associated_data_type, .data = data.release_value() };
+    } else if (associated_data_file.has_value()) {
+        if (auto data = map_associated_data_file(associated_data_file->take_fd(), associated_data_size); data.has_value())
+            associated_data = CachedAssociatedData { .type = associated_data_type, .data = data.release_value() };
+    }
 
     if (auto request = m_requests.get(request_id); request.has_value())
-        (*request)->did_receive_headers({}, HTTP::HeaderList::create(move(response_headers)), status_code, reason_phrase, move(javascript_bytecode), javascript_bytecode_cache_vary_key, came_from_cache);
+        (*request)->did_receive_headers({}, HTTP::HeaderList::create(move(response_headers)), status_code, reason_phrase, move(associated_data), disk_cache_vary_key, came_from_cache);
     else
         warnln("Received headers for non-existent request {}", request_id);
 }
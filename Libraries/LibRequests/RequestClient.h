@@ -8,6 +8,7 @@
 
 #include <AK/HashMap.h>
 #include <LibCore/AnonymousBuffer.h>
+#include <LibCore/MemoryPressure.h>
 #include <LibHTTP/Cache/CacheMode.h>
 #include <LibHTTP/Cache/Utilities.h>
 #include <LibHTTP/Cookie/IncludeCredentials.h>
@@ -64,6 +65,7 @@ public:
 
     Function<String(URL::URL const&, RequestServer::IsPrivate)> on_retrieve_http_cookie;
     Function<void()> on_request_server_died;
+    Function<void(Core::MemoryPressure::Level, u64 bytes_released)> on_memory_released;
 
 private:
     virtual void die() override;
@@ -72,7 +74,7 @@ private:
     virtual void request_body_file_available(u64 request_id, IPC::File, u64 offset, u64 size) override;
     virtual void request_cached_body_file_available(u64 request_id, IPC::File, u64 offset, u64 size) override;
     virtual void request_finished(u64 request_id, u64, RequestTimingInfo, Optional<NetworkError>) override;
-    virtual void headers_became_available(u64 request_id, Vector<HTTP::Header>, Optional<u32>, Optional<String>, Optional<IPC::File>, u64 javascript_bytecode_size, Optional<u64>, CameFromCache) override;
+    virtual void headers_became_available(u64 request_id, Vector<HTTP::Header>, Optional<u32>, Optional<String>, Optional<IPC::File>, u64 associated_data_size, HTTP::CacheEntryAssociatedData, Optional<u64>, CameFromCache) override;
     virtual void request_transferred(u64 request_id) override;
 
     virtual void retrieve_http_cookie(int client_id, u64 request_id, RequestServer::RequestType request_type, URL::URL url, RequestServer::IsPrivate) override;
@@ -89,6 +91,7 @@ private:
 
     virtual void estimated_cache_size(u64 cache_size_estimation_id, CacheSizes sizes) override;
     virtual void removed_cache_entries(u64 clear_cache_request_id) override;
+    virtual void did_release_memory(Core::MemoryPressure::Level, u64 bytes_released) override;
 
     HashMap<u64, RefPtr<Request>> m_requests;
     u64 m_next_request_id { 0 };
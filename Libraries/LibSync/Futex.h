@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <AK/Types.h>
+#include <LibSync/Export.h>
+
+namespace Sync {
+
+enum class FutexWaitResult {
+    // The value at the address changed, or we were woken up. Wakeups may be spurious, so callers have to check their
+    // condition again.
+    Woken,
+    TimedOut,
+};
+
+// Blocks the calling thread while the 32-bit value at address equals expected, until it is woken by futex_wake() or
+// the timeout elapses. The address may be in memory that is shared with other processes.
+SYNC_API FutexWaitResult futex_wait(u32 const* address, u32 expected, Optional<AK::Duration> timeout = {});
+
+// Wakes up to count threads that wait on address, in this or in any other process that maps the same memory.
+SYNC_API void futex_wake(u32 const* address, u32 count);
+
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Platform.h>
+#include <LibSync/Futex.h>
+#include <errno.h>
+#include <time.h>
+
+#if defined(AK_OS_LINUX)
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#elif defined(AK_OS_MACOS) && __has_include(<os/os_sync_wait_on_address.h>)
+#    include <os/os_sync_wait_on_address.h>
+#    define HAVE_OS_SYNC_WAIT_ON_ADDRESS
+#endif
+
+namespace Sync {
+
+// Used where the platform cannot sleep on an address that is shared between processes. The waiter checks the value
+// again every millisecond, so a wakeup is noticed late, but never lost.
+[[maybe_unused]] static FutexWaitResult poll_for_change(u32 const* address, u32 expected, Optional<AK::Duration> timeout)
+{
+    static constexpr auto poll_interval = AK::Duration::from_milliseconds(1);
+
+    auto deadline = timeout.map([](auto timeout) { return MonotonicTime::now() + timeout; });
+    while (AK::atomic_load(address, AK::memory_order_acquire) == expected) {
+        auto interval = poll_interval;
+        if (deadline.has_value()) {
+            auto now = MonotonicTime::now();
+            if (now >= *deadline)
+                return FutexWaitResult::TimedOut;
+            interval = min(interval, *deadline - now);
+        }
+
+        auto sleep_time = interval.to_timespec();
+        nanosleep(&sleep_time, nullptr);
+    }
+    return FutexWaitResult::Woken;
+}
+
+FutexWaitResult futex_wait(u32 const* address, u32 expected, Optional<AK::Duration> timeout)
+{
+#if defined(AK_OS_LINUX)
+    // NB: Not FUTEX_WAIT_PRIVATE, the memory may be mapped by other processes.
+    timespec timeout_spec {};
+    if (timeout.has_value())
+        timeout_spec = timeout->to_timespec();
+
+    auto rc = syscall(SYS_futex, address, FUTEX_WAIT, expected, timeout.has_value() ? &timeout_spec : nullptr, nullptr, 0);
+    if (rc < 0 && errno == ETIMEDOUT)
+        return FutexWaitResult::TimedOut;
+    return FutexWaitResult::Woken;
+#elif defined(HAVE_OS_SYNC_WAIT_ON_ADDRESS)
+    if (__builtin_available(macOS 14.4, *)) {
+        auto* mutable_address = const_cast<u32*>(address);
+        int rc = 0;
+        if (timeout.has_value()) {
+            auto timeout_ns = static_cast<u64>(max<i64>(timeout->to_nanoseconds(), 1));
+            rc = os_sync_wait_on_address_with_timeout(mutable_address, expected, sizeof(u32), OS_SYNC_WAIT_ON_ADDRESS_SHARED, OS_CLOCK_MACH_ABSOLUTE_TIME, timeout_ns);
+        } else {
+            rc = os_sync_wait_on_address(mutable_address, expected, sizeof(u32), OS_SYNC_WAIT_ON_ADDRESS_SHARED);
+        }
+        if (rc < 0 && errno == ETIMEDOUT)
+            return FutexWaitResult::TimedOut;
+        return FutexWaitResult::Woken;
+    }
+    return poll_for_change(address, expected, timeout);
+#else
+    return poll_for_change(address, expected, timeout);
+#endif
+}
+
+void futex_wake(u32 const* address, u32 count)
+{
+    if (count == 0)
+        return;
+
+#if defined(AK_OS_LINUX)
+    auto wake_count = static_cast<int>(min<u32>(count, NumericLimits<int>::max()));
+    (void)syscall(SYS_futex, address, FUTEX_WAKE, wake_count, nullptr, nullptr, 0);
+#elif defined(HAVE_OS_SYNC_WAIT_ON_ADDRESS)
+    if (__builtin_available(macOS 14.4, *)) {
+        auto* mutable_address = const_cast<u32*>(address);
+        if (count == NumericLimits<u32>::max()) {
+            (void)os_sync_wake_by_address_all(mutable_address, sizeof(u32), OS_SYNC_WAKE_BY_ADDRESS_SHARED);
+            return;
+        }
+        for (u32 i = 0; i < count; ++i) {
+            if (os_sync_wake_by_address_any(mutable_address, sizeof(u32), OS_SYNC_WAKE_BY_ADDRESS_SHARED) < 0)
+                break;
+        }
+    }
+#else
+    // Pollers notice the change on their own.
+    (void)address;
+#endif
+}
+
+}
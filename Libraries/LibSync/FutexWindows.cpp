@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Windows.h>
+#include <LibSync/Futex.h>
+
+namespace Sync {
+
+// WaitOnAddress() only works between threads of the same process, so waiters check the value again every millisecond
+// instead. A wakeup is noticed late, but never lost.
+FutexWaitResult futex_wait(u32 const* address, u32 expected, Optional<AK::Duration> timeout)
+{
+    auto deadline = timeout.map([](auto timeout) { return MonotonicTime::now() + timeout; });
+    while (AK::atomic_load(address, AK::memory_order_acquire) == expected) {
+        if (deadline.has_value() && MonotonicTime::now() >= *deadline)
+            return FutexWaitResult::TimedOut;
+        Sleep(1);
+    }
+    return FutexWaitResult::Woken;
+}
+
+void futex_wake(u32 const*, u32)
+{
+}
+
+}
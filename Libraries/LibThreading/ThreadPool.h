@@ -8,7 +8,9 @@
 
 #include <AK/Function.h>
 #include <AK/Queue.h>
+#include <AK/StdLibExtras.h>
 #include <AK/Vector.h>
+#include <LibCore/EventLoop.h>
 #include <LibSync/ConditionVariable.h>
 #include <LibSync/Mutex.h>
 #include <LibThreading/Thread.h>
@@ -21,6 +23,24 @@ public:
 
     void submit(Function<void()>);
 
+    // Runs the work on a pool thread, and then hands its result to on_complete on the event loop of the calling thread.
+    // NB: on_complete is also destroyed on that event loop, so that any GC roots that it captures never leave its thread.
+    template<typename Work>
+    void submit(Work work, Function<void(InvokeResult<Work>)> on_complete)
+    {
+        using Result = InvokeResult<Work>;
+
+        auto* callback = new Function<void(Result)>(move(on_complete));
+        auto& origin_event_loop = Core::EventLoop::current();
+
+        submit([work = move(work), callback, &origin_event_loop]() mutable {
+            origin_event_loop.deferred_invoke([callback, result = work()]() mutable {
+                (*callback)(move(result));
+                delete callback;
+            });
+        });
+    }
+
 private:
     ThreadPool();
 
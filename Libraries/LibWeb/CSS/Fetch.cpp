@@ -169,6 +169,8 @@ GC::Ptr<HTML::SharedResourceRequest> fetch_an_external_image_for_a_stylesheet(St
 
     if (shared_resource_request->needs_fetching())
         shared_resource_request->fetch_resource(*request);
+    else
+        shared_resource_request->add_consumer_ideal_size({});
 
     return shared_resource_request;
 }
@@ -182,4 +184,10 @@ void apply_request_modifiers_from_url_value(URL const& url, GC::Ref<Fetch::Infra
         request_url_modifier.modify_request(request);
 }
 
+ByteString const& style_resource_request_method()
+{
+    static ByteString const method = "GET"sv;
+    return method;
+}
+
 }
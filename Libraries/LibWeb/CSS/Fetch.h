@@ -48,4 +48,8 @@ GC::Ptr<HTML::SharedResourceRequest> fetch_an_external_image_for_a_stylesheet(St
 // https://drafts.csswg.org/css-values-5/#apply-request-modifiers-from-url-value
 void apply_request_modifiers_from_url_value(URL const&, GC::Ref<Fetch::Infrastructure::Request>);
 
+// NB: Style sheets and fonts are only ever fetched with GET, and without any headers that would keep them from being
+//     cached, so this is the method with which data stored next to them in the disk cache is looked up.
+ByteString const& style_resource_request_method();
+
 }
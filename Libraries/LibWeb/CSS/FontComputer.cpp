@@ -14,6 +14,7 @@
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/TypefaceSkia.h>
+#include <LibRequests/RequestClient.h>
 #include <LibWeb/CSS/CSSFontFaceRule.h>
 #include <LibWeb/CSS/CSSFontFeatureValuesRule.h>
 #include <LibWeb/CSS/CSSGroupingRule.h>
@@ -31,7 +32,9 @@
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/MIME.h>
+#include <LibWeb/Fetch/Infrastructure/URL.h>
 #include <LibWeb/Fetch/Response.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/MimeSniff/Resource.h>
 #include <LibWeb/Platform/FontPlugin.h>
 
@@ -134,6 +137,42 @@ RefPtr<Gfx::Font const> FontLoader::font_with_point_size(float point_size, Gfx::
     return m_typeface->font(point_size, variations, shape_features);
 }
 
+// A compressed font response that RequestServer has in its disk cache, next to which the decoded font can be stored.
+struct DecodedFontDiskCacheEntry {
+    ::URL::URL url;
+    u64 vary_key { 0 };
+
+    // The decoded font that RequestServer sent along with the response, if it had stored one.
+    Optional<Core::AnonymousBuffer> decoded_font;
+};
+
+static Optional<DecodedFontDiskCacheEntry> decoded_font_disk_cache_entry_for_response(Fetch::Infrastructure::Response& response, ByteBuffer const& bytes, Optional<ByteString> const& mime_type_essence)
+{
+    if (!is_compressed_vector_font(bytes, mime_type_essence))
+        return {};
+
+    auto unsafe_response = response.unsafe_response();
+    auto url = unsafe_response->url();
+    if (!url.has_value() || !Fetch::Infrastructure::is_http_or_https_scheme(url->scheme()))
+        return {};
+
+    if (!ResourceLoader::is_initialized() || !ResourceLoader::the().request_client())
+        return {};
+
+    // NB: RequestServer reports the vary key of every response that it read from or wrote to its disk cache, whether or
+    //     not the response is a script.
+    auto vary_key = unsafe_response->disk_cache_vary_key();
+    if (!vary_key.has_value())
+        return {};
+
+    return DecodedFontDiskCacheEntry { .url = url.release_value(), .vary_key = *vary_key, .decoded_font = unsafe_response->decoded_font_cache() };
+}
+
+static void store_decoded_font_in_disk_cache(DecodedFontDiskCacheEntry const& entry, ReadonlyBytes encoded_font)
+{
+    (void)ResourceLoader::the().request_client()->store_cache_associated_data(entry.url, style_resource_request_method(), OptionalNone {}, entry.vary_key, HTTP::CacheEntryAssociatedData::DecodedFont, encoded_font);
+}
+
 void FontLoader::start_loading_next_url()
 {
     // A loader that has settled must not consume another URL: its typeface is final, and fetching a
@@ -171,7 +210,14 @@ void FontLoader::start_loading_next_url()
             auto bytes = immutable_bytes->copy_to_byte_buffer().release_value_but_fixme_should_propagate_errors();
 
             auto mime_type_essence = loader->try_load_font_mime_type_essence(response, bytes);
-            if (!requires_off_thread_vector_font_preparation(bytes, mime_type_essence)) {
+
+            // If another load of this font already decoded it, RequestServer sent the decoded font that it stored in the
+            // disk cache along with the response. Checking that it belongs to this font happens on the thread pool.
+            auto disk_cache_entry = decoded_font_disk_cache_entry_for_response(response, bytes, mime_type_essence);
+
+            // NB: WOFF fonts are otherwise loaded on the main thread, but are decoded on the thread pool like WOFF2 fonts
+            //     whenever the decoded font will be stored in the disk cache.
+            if (!disk_cache_entry.has_value() && !requires_off_thread_vector_font_preparation(bytes, mime_type_essence)) {
                 auto maybe_typeface = try_load_vector_font(bytes, mime_type_essence);
                 if (maybe_typeface.is_error()) {
                     if (loader->m_urls.is_empty()) {
@@ -188,7 +234,9 @@ void FontLoader::start_loading_next_url()
             }
 
             auto loader_handle = GC::make_root(GC::Ref(*loader));
-            prepare_vector_font_data_off_thread(move(bytes), [loader = move(loader_handle)](auto prepared_font_data) mutable {
+            auto use_disk_cache = disk_cache_entry.has_value() ? UseDecodedFontDiskCache::Yes : UseDecodedFontDiskCache::No;
+            auto decoded_font = disk_cache_entry.has_value() ? disk_cache_entry->decoded_font : OptionalNone {};
+            prepare_vector_font_data_off_thread(move(bytes), use_disk_cache, move(decoded_font), [loader = move(loader_handle), disk_cache_entry = move(disk_cache_entry)](auto prepared_font_data) mutable {
                 if (prepared_font_data.is_error()) {
                     // NB: If we have other sources available, try the next one.
                     if (loader->m_urls.is_empty()) {
@@ -201,7 +249,7 @@ void FontLoader::start_loading_next_url()
                 }
 
                 auto prepared = prepared_font_data.release_value();
-                auto maybe_typeface = Gfx::Typeface::try_load_from_anonymous_buffer(move(prepared));
+                auto maybe_typeface = Gfx::Typeface::try_load_from_anonymous_buffer(prepared.sfnt_data);
                 if (maybe_typeface.is_error()) {
                     if (loader->m_urls.is_empty()) {
                         loader->font_did_load_or_fail(nullptr);
@@ -212,6 +260,9 @@ void FontLoader::start_loading_next_url()
                     return;
                 }
 
+                if (disk_cache_entry.has_value() && prepared.disk_cache_data.has_value())
+                    store_decoded_font_in_disk_cache(*disk_cache_entry, *prepared.disk_cache_data);
+
                 loader->font_did_load_or_fail(maybe_typeface.release_value()); });
         });
 
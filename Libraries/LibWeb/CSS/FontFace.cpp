@@ -109,14 +109,14 @@ static NonnullRefPtr<Core::Promise<NonnullRefPtr<Gfx::Typeface const>>> load_vec
         return promise;
     }
 
-    prepare_vector_font_data_off_thread(move(data), [promise](auto prepared_font_data) {
+    prepare_vector_font_data_off_thread(move(data), UseDecodedFontDiskCache::No, {}, [promise](auto prepared_font_data) {
         if (prepared_font_data.is_error()) {
             promise->reject(prepared_font_data.release_error());
             return;
         }
 
         auto prepared = prepared_font_data.release_value();
-        auto result = Gfx::Typeface::try_load_from_anonymous_buffer(move(prepared));
+        auto result = Gfx::Typeface::try_load_from_anonymous_buffer(move(prepared.sfnt_data));
         if (result.is_error()) {
             promise->reject(result.release_error());
             return;
@@ -5,7 +5,7 @@
  */
 
 #include <AK/Endian.h>
-#include <LibCore/EventLoop.h>
+#include <AK/Span.h>
 #include <LibGfx/Font/WOFF/Loader.h>
 #include <LibGfx/Font/WOFF2/Loader.h>
 #include <LibThreading/ThreadPool.h>
@@ -13,16 +13,29 @@
 
 namespace Web::CSS {
 
+static constexpr u32 woff_signature = 0x774F4646;
 static constexpr u32 woff2_signature = 0x774F4632;
 
+static Optional<u32> vector_font_signature(ByteBuffer const& data)
+{
+    if (data.size() < sizeof(u32))
+        return {};
+    return *bit_cast<BigEndian<u32> const*>(data.data());
+}
+
 bool requires_off_thread_vector_font_preparation(ByteBuffer const& data, Optional<ByteString> const& mime_type_essence)
 {
     if (mime_type_essence == "font/woff2"sv || mime_type_essence == "application/font-woff2"sv)
         return true;
-    if (data.size() < sizeof(u32))
-        return false;
-    auto signature = *bit_cast<BigEndian<u32> const*>(data.data());
-    return signature == woff2_signature;
+    return vector_font_signature(data) == woff2_signature;
+}
+
+bool is_compressed_vector_font(ByteBuffer const& data, Optional<ByteString> const& mime_type_essence)
+{
+    if (mime_type_essence.has_value())
+        return mime_type_essence->is_one_of("font/woff"sv, "application/font-woff"sv, "font/x-woff"sv, "font/woff2"sv, "application/font-woff2"sv);
+    auto signature = vector_font_signature(data);
+    return signature == woff_signature || signature == woff2_signature;
 }
 
 ErrorOr<NonnullRefPtr<Gfx::Typeface const>> try_load_vector_font(ByteBuffer const& data, Optional<ByteString> const& mime_type_essence)
@@ -59,22 +72,81 @@ ErrorOr<NonnullRefPtr<Gfx::Typeface const>> try_load_vector_font(ByteBuffer cons
     return Error::from_string_literal("Automatic format detection failed");
 }
 
-void prepare_vector_font_data_off_thread(ByteBuffer data, Function<void(ErrorOr<Core::AnonymousBuffer>)>&& on_complete)
+void prepare_vector_font_data_off_thread(ByteBuffer data, UseDecodedFontDiskCache use_disk_cache, Optional<Core::AnonymousBuffer> decoded_font_from_disk_cache, Function<void(ErrorOr<PreparedVectorFontData>)>&& on_complete)
 {
-    // Keep the callback on the origin thread so any GC roots it captures are
-    // also destroyed there.
-    auto* callback = new Function<void(ErrorOr<Core::AnonymousBuffer>)>(move(on_complete));
-    auto& origin_event_loop = Core::EventLoop::current();
-
     Threading::ThreadPool::the().submit(
-        [data = move(data), callback, &origin_event_loop]() mutable {
-            auto result = WOFF2::convert_to_ttf(data);
-
-            origin_event_loop.deferred_invoke([callback, result = move(result)]() mutable {
-                (*callback)(move(result));
-                delete callback;
-            });
-        });
+        [data = move(data), use_disk_cache, decoded_font_from_disk_cache = move(decoded_font_from_disk_cache)]() mutable -> ErrorOr<PreparedVectorFontData> {
+            auto decode = [&] {
+                return vector_font_signature(data) == woff_signature ? WOFF::convert_to_ttf(data) : WOFF2::convert_to_ttf(data);
+            };
+            if (use_disk_cache == UseDecodedFontDiskCache::No)
+                return PreparedVectorFontData { .sfnt_data = TRY(decode()), .disk_cache_data = {} };
+
+            auto source_hash = hash_vector_font_source(data);
+            if (decoded_font_from_disk_cache.has_value()) {
+                auto result = validate_decoded_vector_font_from_disk_cache(decoded_font_from_disk_cache->bytes(), source_hash);
+                if (!result.is_error())
+                    return PreparedVectorFontData { .sfnt_data = decoded_font_from_disk_cache.release_value(), .disk_cache_data = {} };
+                dbgln("Ignoring cached decoded font: {}", result.error());
+            }
+
+            auto sfnt_data = TRY(decode());
+            auto disk_cache_data = encode_decoded_vector_font_for_disk_cache(sfnt_data.bytes(), source_hash);
+            if (disk_cache_data.is_error())
+                return PreparedVectorFontData { .sfnt_data = move(sfnt_data), .disk_cache_data = {} };
+            return PreparedVectorFontData { .sfnt_data = move(sfnt_data), .disk_cache_data = disk_cache_data.release_value() };
+        },
+        move(on_complete));
+}
+
+// The trailer goes after the sfnt data rather than in front of it, so that the sfnt starts at the beginning of the buffer
+// that RequestServer shares, which can then be handed to a typeface without copying it.
+static constexpr u32 decoded_vector_font_magic = 0x4C444654; // "LDFT"
+static constexpr u32 decoded_vector_font_version = 1;
+
+struct [[gnu::packed]] DecodedVectorFontTrailer {
+    u8 source_hash[VectorFontSourceHash::Size];
+    LittleEndian<u64> sfnt_size;
+    LittleEndian<u32> version;
+    BigEndian<u32> magic;
+};
+
+VectorFontSourceHash hash_vector_font_source(ReadonlyBytes data)
+{
+    return ::Crypto::Hash::SHA256::hash(data.data(), data.size());
+}
+
+ErrorOr<ByteBuffer> encode_decoded_vector_font_for_disk_cache(ReadonlyBytes sfnt_data, VectorFontSourceHash const& source_hash)
+{
+    DecodedVectorFontTrailer trailer {};
+    source_hash.bytes().copy_to({ trailer.source_hash, sizeof(trailer.source_hash) });
+    trailer.sfnt_size = sfnt_data.size();
+    trailer.version = decoded_vector_font_version;
+    trailer.magic = decoded_vector_font_magic;
+
+    auto encoded = TRY(ByteBuffer::create_uninitialized(sfnt_data.size() + sizeof(trailer)));
+    sfnt_data.copy_to(encoded);
+    ReadonlyBytes { reinterpret_cast<u8 const*>(&trailer), sizeof(trailer) }.copy_to(encoded.bytes().slice(sfnt_data.size()));
+    return encoded;
+}
+
+ErrorOr<void> validate_decoded_vector_font_from_disk_cache(ReadonlyBytes data, VectorFontSourceHash const& source_hash)
+{
+    if (data.size() < sizeof(DecodedVectorFontTrailer))
+        return Error::from_string_literal("Decoded font is too short");
+
+    DecodedVectorFontTrailer trailer;
+    data.slice(data.size() - sizeof(trailer)).copy_to({ reinterpret_cast<u8*>(&trailer), sizeof(trailer) });
+
+    if (trailer.magic != decoded_vector_font_magic)
+        return Error::from_string_literal("Decoded font has an invalid magic number");
+    if (trailer.version != decoded_vector_font_version)
+        return Error::from_string_literal("Decoded font was encoded by a different version");
+    if (trailer.sfnt_size != data.size() - sizeof(trailer))
+        return Error::from_string_literal("Decoded font has an invalid size");
+    if (ReadonlyBytes { trailer.source_hash, sizeof(trailer.source_hash) } != source_hash.bytes())
+        return Error::from_string_literal("Decoded font was decoded from a different font");
+    return {};
 }
 
 }
@@ -11,12 +11,45 @@
 #include <AK/Function.h>
 #include <AK/Optional.h>
 #include <LibCore/AnonymousBuffer.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibGfx/Font/Typeface.h>
+#include <LibWeb/Export.h>
 
 namespace Web::CSS {
 
 bool requires_off_thread_vector_font_preparation(ByteBuffer const&, Optional<ByteString> const& mime_type_essence = {});
 ErrorOr<NonnullRefPtr<Gfx::Typeface const>> try_load_vector_font(ByteBuffer const&, Optional<ByteString> const& mime_type_essence = {});
-void prepare_vector_font_data_off_thread(ByteBuffer, Function<void(ErrorOr<Core::AnonymousBuffer>)>&&);
+
+// Returns whether the font is a WOFF or WOFF2 font, which has to be decoded into sfnt data before it can be used.
+WEB_API bool is_compressed_vector_font(ByteBuffer const&, Optional<ByteString> const& mime_type_essence = {});
+
+// Decoded fonts are stored next to the compressed fonts they were decoded from in the HTTP disk cache, followed by the
+// hash of the compressed font. RequestServer hands the same decoded font out to every process that asks for it, so
+// that they all map one read-only copy of it.
+using VectorFontSourceHash = ::Crypto::Hash::Digest<::Crypto::Hash::SHA256::DigestSize * 8>;
+
+struct PreparedVectorFontData {
+    Core::AnonymousBuffer sfnt_data;
+
+    // The decoded font encoded for the disk cache, if it was decoded here and the disk cache is used.
+    Optional<ByteBuffer> disk_cache_data;
+};
+
+enum class UseDecodedFontDiskCache {
+    No,
+    Yes,
+};
+
+// Decodes a WOFF or WOFF2 font into sfnt data on the thread pool. When the disk cache is used, a decoded font that
+// RequestServer delivered along with the compressed font is used instead, if it was decoded from that font. Hashing the
+// compressed font to check that happens on the thread pool as well.
+void prepare_vector_font_data_off_thread(ByteBuffer, UseDecodedFontDiskCache, Optional<Core::AnonymousBuffer> decoded_font_from_disk_cache, Function<void(ErrorOr<PreparedVectorFontData>)>&&);
+
+WEB_API VectorFontSourceHash hash_vector_font_source(ReadonlyBytes);
+WEB_API ErrorOr<ByteBuffer> encode_decoded_vector_font_for_disk_cache(ReadonlyBytes sfnt_data, VectorFontSourceHash const&);
+
+// Fails unless the data was encoded from the font with the given hash, by this version of the encoding. The data can be
+// loaded as a typeface as is, since font parsers ignore anything that follows the tables of an sfnt.
+WEB_API ErrorOr<void> validate_decoded_vector_font_from_disk_cache(ReadonlyBytes, VectorFontSourceHash const&);
 
 }
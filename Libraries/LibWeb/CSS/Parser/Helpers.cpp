@@ -11,6 +11,7 @@
 
 #include <LibGC/Heap.h>
 #include <LibTextCodec/Decoder.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/Bindings/HostDefined.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -78,6 +79,28 @@ GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams cons
     return style_sheet;
 }
 
+// OPTIMIZATION: Every document in this process that loads the same style sheet text shares the rules it was parsed
+//               into, and only interprets those into its own CSSOM. So neither tokenizing nor parsing the rules has to
+//               happen again for an iframe or tab that uses the same style sheet.
+static NonnullRefPtr<CSS::Parser::StyleSheetContents const> parse_shared_style_sheet_contents(CSS::Parser::ParsingParams const& context, Utf16String const& source_text, Function<Vector<CSS::Parser::Token>()> const& tokenize)
+{
+    auto& cache = CSS::Parser::StyleSheetContentsCache::the();
+    if (auto contents = cache.get(source_text))
+        return contents.release_nonnull();
+
+    auto contents = CSS::Parser::Parser::create(context, tokenize()).parse_as_shareable_style_sheet_rules();
+    cache.set(source_text, contents);
+    return contents;
+}
+
+static GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet_sharing_contents(CSS::Parser::ParsingParams const& context, Utf16String source_text, Function<Vector<CSS::Parser::Token>()> const& tokenize, Optional<::URL::URL> location, GC::Ptr<CSS::MediaList> media_list)
+{
+    auto contents = parse_shared_style_sheet_contents(context, source_text, tokenize);
+    auto style_sheet = CSS::Parser::Parser::create(context, Vector<CSS::Parser::Token> {}).convert_to_css_stylesheet(*contents, move(location), move(media_list));
+    style_sheet->set_source_text(move(source_text));
+    return style_sheet;
+}
+
 GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams const& context, Utf16View css, Optional<::URL::URL> location, GC::Ptr<CSS::MediaList> media_list)
 {
     if (css.is_empty()) {
@@ -88,11 +111,42 @@ GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams cons
         style_sheet->set_source_text({});
         return style_sheet;
     }
-    auto style_sheet = CSS::Parser::Parser::create(context, css).parse_as_css_stylesheet(location, move(media_list));
-    style_sheet->set_source_text(Utf16String::from_utf16(css));
+    return parse_css_stylesheet_sharing_contents(
+        context, Utf16String::from_utf16(css), [&] { return CSS::Parser::Tokenizer::tokenize(css); }, move(location), move(media_list));
+}
+
+GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams const& context, TokenizedCSSStyleSheet tokenized_style_sheet, Optional<::URL::URL> location, GC::Ptr<CSS::MediaList> media_list)
+{
+    if (tokenized_style_sheet.source_text.is_empty())
+        return parse_css_stylesheet(context, ""sv, move(location), move(media_list));
+
+    return parse_css_stylesheet_sharing_contents(
+        context, move(tokenized_style_sheet.source_text), [&] { return CSS::Parser::RustTokenizer::attach(move(tokenized_style_sheet.tokens)); }, move(location), move(media_list));
+}
+
+GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams const& context, PreparsedCSSStyleSheet preparsed_style_sheet, Optional<::URL::URL> location, GC::Ptr<CSS::MediaList> media_list)
+{
+    // NB: Contents that came from elsewhere, such as the HTTP disk cache, can be shared with later loads too.
+    CSS::Parser::StyleSheetContentsCache::the().set(preparsed_style_sheet.source_text, preparsed_style_sheet.contents);
+
+    auto style_sheet = CSS::Parser::Parser::create(context, Vector<CSS::Parser::Token> {}).convert_to_css_stylesheet(*preparsed_style_sheet.contents, move(location), move(media_list));
+    style_sheet->set_source_text(move(preparsed_style_sheet.source_text));
     return style_sheet;
 }
 
+PreparsedCSSStyleSheet parse_css_stylesheet_contents(CSS::Parser::ParsingParams const& context, Variant<Utf16String, TokenizedCSSStyleSheet> css)
+{
+    return css.visit(
+        [&](Utf16String& source_text) {
+            auto contents = parse_shared_style_sheet_contents(context, source_text, [&] { return CSS::Parser::Tokenizer::tokenize(source_text.utf16_view()); });
+            return PreparsedCSSStyleSheet { .source_text = move(source_text), .contents = move(contents) };
+        },
+        [&](TokenizedCSSStyleSheet& tokenized_style_sheet) {
+            auto contents = parse_shared_style_sheet_contents(context, tokenized_style_sheet.source_text, [&] { return CSS::Parser::RustTokenizer::attach(move(tokenized_style_sheet.tokens)); });
+            return PreparsedCSSStyleSheet { .source_text = move(tokenized_style_sheet.source_text), .contents = move(contents) };
+        });
+}
+
 CSS::Parser::Parser::PropertiesAndCustomProperties parse_css_property_declaration_block(CSS::Parser::ParsingParams const& context, Utf16View css)
 {
     if (css.is_empty())
@@ -273,6 +327,29 @@ ErrorOr<Utf16String> css_decode_bytes(Optional<StringView> const& environment_en
     return TextCodec::convert_input_to_utf16_using_given_decoder_unless_there_is_a_byte_order_mark(*decoder, encoded_string);
 }
 
+// NB: This only decodes and tokenizes, and doesn't create any GC objects or interned strings, so it may be called from
+//     any thread.
+ErrorOr<TokenizedCSSStyleSheet> css_decode_and_tokenize_bytes(Optional<StringView> const& environment_encoding, Optional<StringView> mime_type_charset, ReadonlyBytes encoded_string)
+{
+    auto source_text = TRY(css_decode_bytes(environment_encoding, mime_type_charset, encoded_string));
+    auto tokens = CSS::Parser::RustTokenizer::tokenize_detached(source_text);
+    return TokenizedCSSStyleSheet { move(source_text), move(tokens) };
+}
+
+void css_decode_and_tokenize_bytes_off_thread(Optional<String> environment_encoding, Optional<String> mime_type_charset, ByteBuffer encoded_string, Function<void(ErrorOr<TokenizedCSSStyleSheet>)>&& on_complete)
+{
+    Threading::ThreadPool::the().submit(
+        [environment_encoding = move(environment_encoding), mime_type_charset = move(mime_type_charset), encoded_string = move(encoded_string)] {
+            auto to_view = [](Optional<String> const& string) -> Optional<StringView> {
+                if (!string.has_value())
+                    return {};
+                return string->bytes_as_string_view();
+            };
+            return css_decode_and_tokenize_bytes(to_view(environment_encoding), to_view(mime_type_charset), encoded_string);
+        },
+        move(on_complete));
+}
+
 // https://drafts.csswg.org/css-values-4/#identifier-value
 bool is_valid_custom_ident(Utf16View ident, ReadonlySpan<Utf16View> const& blacklist)
 {
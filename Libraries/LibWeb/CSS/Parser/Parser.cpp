@@ -74,6 +74,11 @@ Parser Parser::create(ParsingParams const& context, Utf16View input)
     return Parser { context, move(tokens) };
 }
 
+Parser Parser::create(ParsingParams const& context, Vector<Token> tokens)
+{
+    return Parser { context, move(tokens) };
+}
+
 Parser::Parser(ParsingParams const& context, Vector<Token> tokens)
     : m_document(context.document)
     , m_parsing_mode(context.mode)
@@ -190,6 +195,21 @@ GC::Ref<CSS::CSSStyleSheet> Parser::parse_as_css_stylesheet(Optional<::URL::URL>
     return CSSStyleSheet::create(rule_list, *media_list, move(location));
 }
 
+// AD-HOC: The two halves of parse_as_css_stylesheet(), so that the document-independent first half can be shared.
+NonnullRefPtr<StyleSheetContents const> Parser::parse_as_shareable_style_sheet_rules()
+{
+    auto style_sheet = parse_a_stylesheet(m_token_stream, {});
+    return StyleSheetContents::create(move(style_sheet.rules));
+}
+
+GC::Ref<CSS::CSSStyleSheet> Parser::convert_to_css_stylesheet(StyleSheetContents const& contents, Optional<::URL::URL> location, GC::Ptr<MediaList> media_list)
+{
+    auto rule_list = CSSRuleList::create(convert_rules(contents.rules()));
+    if (!media_list)
+        media_list = MediaList::create({});
+    return CSSStyleSheet::create(rule_list, *media_list, move(location));
+}
+
 RefPtr<Supports> Parser::parse_as_supports()
 {
     return parse_a_supports(m_token_stream);
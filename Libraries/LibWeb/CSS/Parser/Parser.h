@@ -25,6 +25,8 @@
 #include <LibWeb/CSS/Parser/ComponentValue.h>
 #include <LibWeb/CSS/Parser/GeneratedValueTypesParsing.h>
 #include <LibWeb/CSS/Parser/RuleContext.h>
+#include <LibWeb/CSS/Parser/RustTokenizer.h>
+#include <LibWeb/CSS/Parser/StyleSheetContentsCache.h>
 #include <LibWeb/CSS/Parser/TokenStream.h>
 #include <LibWeb/CSS/Parser/Tokenizer.h>
 #include <LibWeb/CSS/Parser/Types.h>
@@ -135,9 +137,12 @@ class Parser {
 public:
     static Parser create(ParsingParams const&, StringView input, StringView encoding = "utf-8"sv);
     static Parser create(ParsingParams const&, Utf16View input);
+    static Parser create(ParsingParams const&, Vector<Token>);
 
     GC::RootVector<GC::Ref<CSSRule>> convert_rules(Vector<Rule> const& raw_rules);
     GC::Ref<CSS::CSSStyleSheet> parse_as_css_stylesheet(Optional<::URL::URL> location, GC::Ptr<MediaList> = {});
+    NonnullRefPtr<StyleSheetContents const> parse_as_shareable_style_sheet_rules();
+    GC::Ref<CSS::CSSStyleSheet> convert_to_css_stylesheet(StyleSheetContents const&, Optional<::URL::URL> location, GC::Ptr<MediaList> = {});
 
     struct PropertiesAndCustomProperties {
         Vector<StyleProperty> properties;
@@ -705,8 +710,25 @@ Vector<Percentage> parse_keyframe_selectors(ParsingParams const&, Utf16View);
 
 namespace Web {
 
+// A style sheet that has been decoded and tokenized, but not parsed yet. Neither of these steps depend on the document,
+// so they can happen on another thread.
+struct TokenizedCSSStyleSheet {
+    Utf16String source_text;
+    CSS::Parser::DetachedTokens tokens;
+};
+
+// A style sheet whose rules CSS Syntax has already built, possibly in another process, and which only has to be
+// interpreted into the CSSOM.
+struct PreparsedCSSStyleSheet {
+    Utf16String source_text;
+    NonnullRefPtr<CSS::Parser::StyleSheetContents const> contents;
+};
+
 GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams const&, StringView, Optional<::URL::URL> location = {}, GC::Ptr<CSS::MediaList> media_list = {});
 GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams const&, Utf16View, Optional<::URL::URL> location = {}, GC::Ptr<CSS::MediaList> media_list = {});
+GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams const&, TokenizedCSSStyleSheet, Optional<::URL::URL> location = {}, GC::Ptr<CSS::MediaList> media_list = {});
+GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams const&, PreparsedCSSStyleSheet, Optional<::URL::URL> location = {}, GC::Ptr<CSS::MediaList> media_list = {});
+PreparsedCSSStyleSheet parse_css_stylesheet_contents(CSS::Parser::ParsingParams const&, Variant<Utf16String, TokenizedCSSStyleSheet>);
 CSS::Parser::Parser::PropertiesAndCustomProperties parse_css_property_declaration_block(CSS::Parser::ParsingParams const&, Utf16View);
 Vector<CSS::Descriptor> parse_css_descriptor_declaration_block(CSS::Parser::ParsingParams const&, CSS::AtRuleID, Utf16View);
 RefPtr<CSS::StyleValue const> parse_css_value(CSS::Parser::ParsingParams const&, StringView, CSS::PropertyID);
@@ -724,6 +746,8 @@ RefPtr<CSS::Supports> parse_css_supports(CSS::Parser::ParsingParams const&, Utf1
 Vector<CSS::Parser::ComponentValue> parse_component_values_list(CSS::Parser::ParsingParams const&, Utf16View);
 GC::Ref<JS::Realm> internal_css_realm();
 ErrorOr<Utf16String> css_decode_bytes(Optional<StringView> const& environment_encoding, Optional<StringView> mime_type_charset, ReadonlyBytes encoded_string);
+ErrorOr<TokenizedCSSStyleSheet> css_decode_and_tokenize_bytes(Optional<StringView> const& environment_encoding, Optional<StringView> mime_type_charset, ReadonlyBytes encoded_string);
+void css_decode_and_tokenize_bytes_off_thread(Optional<String> environment_encoding, Optional<String> mime_type_charset, ByteBuffer encoded_string, Function<void(ErrorOr<TokenizedCSSStyleSheet>)>&& on_complete);
 bool is_valid_custom_ident(Utf16View, ReadonlySpan<Utf16View> const& blacklist);
 
 }
@@ -4,7 +4,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/FFIHelpers.h>
 #include <AK/StringBuilder.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
@@ -110,101 +109,126 @@ static SourcePosition position_from_ffi(size_t line, size_t column)
     return { static_cast<u32>(line), static_cast<u32>(column) };
 }
 
-Token RustTokenizer::token_from_ffi(FFI::CssToken const& ffi_token)
+DetachedTokens::DetachedToken RustTokenizer::detached_token_from_ffi(FFI::CssToken const& ffi_token, ReadonlyBytes filtered_input)
 {
-    auto original_source_text = ffi_string(ffi_token.original_source_ptr, ffi_token.original_source_len);
-    auto payload = ffi_token.value_len == 0
+    // NB: The original source text points into the filtered input, so we only need to remember where it is.
+    size_t original_source_offset = 0;
+    if (ffi_token.original_source_len != 0) {
+        VERIFY(ffi_token.original_source_ptr >= filtered_input.data());
+        original_source_offset = static_cast<size_t>(ffi_token.original_source_ptr - filtered_input.data());
+        VERIFY(original_source_offset + ffi_token.original_source_len <= filtered_input.size());
+    }
+
+    return {
+        .type = static_cast<Token::Type>(ffi_token.token_type),
+        .hash_type = static_cast<Token::HashType>(ffi_token.hash_type),
+        .number = Number { css_number_type_from_ffi(ffi_token.number_type), ffi_token.number_value },
+        .delim = ffi_token.delim,
+        .value = ffi_token.value_len == 0
+            ? Utf16String {}
+            : Utf16String::from_utf16(Utf16View { reinterpret_cast<char16_t const*>(ffi_token.value_ptr), ffi_token.value_len }),
+        .original_source_offset = original_source_offset,
+        .original_source_length = ffi_token.original_source_len,
+        .start = position_from_ffi(ffi_token.start_line, ffi_token.start_column),
+        .end = position_from_ffi(ffi_token.end_line, ffi_token.end_column),
+    };
+}
+
+Token RustTokenizer::token_from_detached(DetachedTokens::DetachedToken const& detached_token, StringView filtered_input)
+{
+    auto original_source_text = String::from_utf8_without_validation(filtered_input.substring_view(detached_token.original_source_offset, detached_token.original_source_length).bytes());
+    auto payload = detached_token.value.is_empty()
         ? Utf16FlyString {}
-        : Utf16FlyString::from_utf16(Utf16View { reinterpret_cast<char16_t const*>(ffi_token.value_ptr), ffi_token.value_len });
+        : Utf16FlyString { detached_token.value };
 
     Token token;
-    switch (ffi_token.token_type) {
-    case FFI::CssTokenType::Invalid:
+    switch (detached_token.type) {
+    case Token::Type::Invalid:
         VERIFY_NOT_REACHED();
-    case FFI::CssTokenType::EndOfFile:
+    case Token::Type::EndOfFile:
         token = Token::create(Token::Type::EndOfFile, move(original_source_text));
         break;
-    case FFI::CssTokenType::Ident:
+    case Token::Type::Ident:
         token = Token::create_ident(move(payload), move(original_source_text));
         break;
-    case FFI::CssTokenType::Function:
+    case Token::Type::Function:
         token = Token::create_function(move(payload), move(original_source_text));
         break;
-    case FFI::CssTokenType::AtKeyword:
+    case Token::Type::AtKeyword:
         token = Token::create_at_keyword(move(payload), move(original_source_text));
         break;
-    case FFI::CssTokenType::Hash:
+    case Token::Type::Hash:
         token = Token::create_hash(
             move(payload),
-            ffi_token.hash_type == FFI::CssHashType::Id ? Token::HashType::Id : Token::HashType::Unrestricted,
+            detached_token.hash_type,
             move(original_source_text));
         break;
-    case FFI::CssTokenType::String:
+    case Token::Type::String:
         token = Token::create_string(move(payload), move(original_source_text));
         break;
-    case FFI::CssTokenType::BadString:
+    case Token::Type::BadString:
         token = Token::create(Token::Type::BadString, move(original_source_text));
         break;
-    case FFI::CssTokenType::Url:
+    case Token::Type::Url:
         token = Token::create_url(move(payload), move(original_source_text));
         break;
-    case FFI::CssTokenType::BadUrl:
+    case Token::Type::BadUrl:
         token = Token::create(Token::Type::BadUrl, move(original_source_text));
         break;
-    case FFI::CssTokenType::Delim:
-        token = Token::create_delim(ffi_token.delim, move(original_source_text));
+    case Token::Type::Delim:
+        token = Token::create_delim(detached_token.delim, move(original_source_text));
         break;
-    case FFI::CssTokenType::Number:
-        token = Token::create_number(Number { css_number_type_from_ffi(ffi_token.number_type), ffi_token.number_value }, move(original_source_text));
+    case Token::Type::Number:
+        token = Token::create_number(detached_token.number, move(original_source_text));
         break;
-    case FFI::CssTokenType::Percentage:
-        token = Token::create_percentage(Number { css_number_type_from_ffi(ffi_token.number_type), ffi_token.number_value }, move(original_source_text));
+    case Token::Type::Percentage:
+        token = Token::create_percentage(detached_token.number, move(original_source_text));
         break;
-    case FFI::CssTokenType::Dimension:
+    case Token::Type::Dimension:
         token = Token::create_dimension(
-            Number { css_number_type_from_ffi(ffi_token.number_type), ffi_token.number_value },
+            detached_token.number,
             move(payload),
             move(original_source_text));
         break;
-    case FFI::CssTokenType::Whitespace:
+    case Token::Type::Whitespace:
         token = Token::create_whitespace(move(original_source_text));
         break;
-    case FFI::CssTokenType::CDO:
+    case Token::Type::CDO:
         token = Token::create(Token::Type::CDO, move(original_source_text));
         break;
-    case FFI::CssTokenType::CDC:
+    case Token::Type::CDC:
         token = Token::create(Token::Type::CDC, move(original_source_text));
         break;
-    case FFI::CssTokenType::Colon:
+    case Token::Type::Colon:
         token = Token::create(Token::Type::Colon, move(original_source_text));
         break;
-    case FFI::CssTokenType::Semicolon:
+    case Token::Type::Semicolon:
         token = Token::create(Token::Type::Semicolon, move(original_source_text));
         break;
-    case FFI::CssTokenType::Comma:
+    case Token::Type::Comma:
         token = Token::create(Token::Type::Comma, move(original_source_text));
         break;
-    case FFI::CssTokenType::OpenSquare:
+    case Token::Type::OpenSquare:
         token = Token::create(Token::Type::OpenSquare, move(original_source_text));
         break;
-    case FFI::CssTokenType::CloseSquare:
+    case Token::Type::CloseSquare:
         token = Token::create(Token::Type::CloseSquare, move(original_source_text));
         break;
-    case FFI::CssTokenType::OpenParen:
+    case Token::Type::OpenParen:
         token = Token::create(Token::Type::OpenParen, move(original_source_text));
         break;
-    case FFI::CssTokenType::CloseParen:
+    case Token::Type::CloseParen:
         token = Token::create(Token::Type::CloseParen, move(original_source_text));
         break;
-    case FFI::CssTokenType::OpenCurly:
+    case Token::Type::OpenCurly:
         token = Token::create(Token::Type::OpenCurly, move(original_source_text));
         break;
-    case FFI::CssTokenType::CloseCurly:
+    case Token::Type::CloseCurly:
         token = Token::create(Token::Type::CloseCurly, move(original_source_text));
         break;
     }
 
-    token.set_position_range(Badge<RustTokenizer> {}, position_from_ffi(ffi_token.start_line, ffi_token.start_column), position_from_ffi(ffi_token.end_line, ffi_token.end_column));
+    token.set_position_range(Badge<RustTokenizer> {}, detached_token.start, detached_token.end);
     return token;
 }
 
@@ -241,14 +265,24 @@ static_assert(static_cast<u8>(FFI::CssNumberType::IntegerWithExplicitSign) == st
 static_assert(static_cast<u8>(FFI::CssNumberType::Integer) == static_cast<u8>(Number::Type::Integer));
 
 Vector<Token> RustTokenizer::tokenize(StringView input, StringView encoding, TokenizerInput tokenizer_input)
+{
+    return attach(tokenize_filtered(decode_and_filter_code_points(input, encoding, tokenizer_input)));
+}
+
+DetachedTokens RustTokenizer::tokenize_detached(Utf16View input)
+{
+    return tokenize_filtered(Tokenizer::filter_code_points(input));
+}
+
+DetachedTokens RustTokenizer::tokenize_filtered(String filtered_input)
 {
     struct CallbackContext {
-        Vector<Token> tokens;
+        ReadonlyBytes filtered_input;
+        Vector<DetachedTokens::DetachedToken> tokens;
     };
 
-    auto filtered_input = decode_and_filter_code_points(input, encoding, tokenizer_input);
     auto filtered_input_bytes = filtered_input.bytes();
-    CallbackContext context;
+    CallbackContext context { .filtered_input = filtered_input_bytes, .tokens = {} };
     context.tokens.ensure_capacity((filtered_input_bytes.size() / 2) + 1);
     FFI::rust_css_tokenize(
         filtered_input_bytes.data(),
@@ -256,10 +290,24 @@ Vector<Token> RustTokenizer::tokenize(StringView input, StringView encoding, Tok
         &context,
         [](void* raw_context, FFI::CssToken const* ffi_token) {
             auto& context = *static_cast<CallbackContext*>(raw_context);
-            context.tokens.append(token_from_ffi(*ffi_token));
+            context.tokens.append(detached_token_from_ffi(*ffi_token, context.filtered_input));
         });
 
-    return move(context.tokens);
+    DetachedTokens detached_tokens;
+    detached_tokens.m_filtered_input = move(filtered_input);
+    detached_tokens.m_tokens = move(context.tokens);
+    return detached_tokens;
+}
+
+Vector<Token> RustTokenizer::attach(DetachedTokens detached_tokens)
+{
+    auto filtered_input = detached_tokens.m_filtered_input.bytes_as_string_view();
+
+    Vector<Token> tokens;
+    tokens.ensure_capacity(detached_tokens.m_tokens.size());
+    for (auto const& detached_token : detached_tokens.m_tokens)
+        tokens.unchecked_append(token_from_detached(detached_token, filtered_input));
+    return tokens;
 }
 
 }
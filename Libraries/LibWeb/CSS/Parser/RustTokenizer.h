@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <AK/Noncopyable.h>
+#include <AK/String.h>
 #include <AK/StringView.h>
+#include <AK/Utf16String.h>
 #include <AK/Vector.h>
 #include <LibWeb/CSS/Parser/Token.h>
 #include <LibWeb/CSS/Parser/Tokenizer.h>
@@ -20,12 +23,48 @@ struct CssToken;
 
 namespace Web::CSS::Parser {
 
+// Tokens that don't reference any interned strings yet. Unlike a Vector<Token>, these can be produced on any thread, and
+// then be handed over to the thread that parses them.
+class WEB_API DetachedTokens {
+    AK_MAKE_NONCOPYABLE(DetachedTokens);
+    AK_MAKE_DEFAULT_MOVABLE(DetachedTokens);
+
+public:
+    DetachedTokens() = default;
+
+    size_t size() const { return m_tokens.size(); }
+
+private:
+    friend class RustTokenizer;
+
+    struct DetachedToken {
+        Token::Type type { Token::Type::Invalid };
+        Token::HashType hash_type { Token::HashType::Id };
+        Number number;
+        u32 delim { 0 };
+        Utf16String value;
+        size_t original_source_offset { 0 };
+        size_t original_source_length { 0 };
+        SourcePosition start;
+        SourcePosition end;
+    };
+
+    String m_filtered_input;
+    Vector<DetachedToken> m_tokens;
+};
+
 class WEB_API RustTokenizer {
 public:
     static Vector<Token> tokenize(StringView input, StringView encoding, TokenizerInput = TokenizerInput::DecodedText);
 
+    // May be called from any thread. The result must be attached on the thread that is going to parse it.
+    static DetachedTokens tokenize_detached(Utf16View input);
+    static Vector<Token> attach(DetachedTokens);
+
 private:
-    static Token token_from_ffi(FFI::CssToken const&);
+    static DetachedTokens tokenize_filtered(String filtered_input);
+    static DetachedTokens::DetachedToken detached_token_from_ffi(FFI::CssToken const&, ReadonlyBytes filtered_input);
+    static Token token_from_detached(DetachedTokens::DetachedToken const&, StringView filtered_input);
 };
 
 }
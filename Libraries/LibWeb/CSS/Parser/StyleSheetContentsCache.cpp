@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/CSS/Parser/StyleSheetContentsCache.h>
+
+namespace Web::CSS::Parser {
+
+static size_t estimated_size_in_bytes(Vector<ComponentValue> const&);
+static size_t estimated_size_in_bytes(Vector<RuleOrListOfDeclarations> const&);
+
+static size_t estimated_size_in_bytes(ComponentValue const& component_value)
+{
+    size_t size = sizeof(ComponentValue);
+    if (component_value.is_token())
+        size += component_value.token().original_source_text().bytes().size();
+    else if (component_value.is_function())
+        size += estimated_size_in_bytes(component_value.function().value);
+    else if (component_value.is_block())
+        size += estimated_size_in_bytes(component_value.block().value);
+    return size;
+}
+
+static size_t estimated_size_in_bytes(Vector<ComponentValue> const& component_values)
+{
+    size_t size = 0;
+    for (auto const& component_value : component_values)
+        size += estimated_size_in_bytes(component_value);
+    return size;
+}
+
+static size_t estimated_size_in_bytes(Declaration const& declaration)
+{
+    auto size = sizeof(Declaration) + estimated_size_in_bytes(declaration.value);
+    if (declaration.original_value_text.has_value())
+        size += declaration.original_value_text->bytes().size();
+    if (declaration.original_full_text.has_value())
+        size += declaration.original_full_text->length_in_code_units() * sizeof(char16_t);
+    return size;
+}
+
+static size_t estimated_size_in_bytes(Rule const& rule)
+{
+    return sizeof(Rule) + rule.visit(
+        [](AtRule const& at_rule) {
+            return estimated_size_in_bytes(at_rule.prelude) + estimated_size_in_bytes(at_rule.child_rules_and_lists_of_declarations);
+        },
+        [](QualifiedRule const& qualified_rule) {
+            auto size = estimated_size_in_bytes(qualified_rule.prelude) + estimated_size_in_bytes(qualified_rule.child_rules);
+            for (auto const& declaration : qualified_rule.declarations)
+                size += estimated_size_in_bytes(declaration);
+            return size;
+        });
+}
+
+static size_t estimated_size_in_bytes(Vector<RuleOrListOfDeclarations> const& rules_and_lists_of_declarations)
+{
+    size_t size = 0;
+    for (auto const& rule_or_list_of_declarations : rules_and_lists_of_declarations) {
+        size += rule_or_list_of_declarations.visit(
+            [](Rule const& rule) { return estimated_size_in_bytes(rule); },
+            [](Vector<Declaration, 0> const& declarations) {
+                size_t declarations_size = 0;
+                for (auto const& declaration : declarations)
+                    declarations_size += estimated_size_in_bytes(declaration);
+                return declarations_size;
+            });
+    }
+    return size;
+}
+
+StyleSheetContents::StyleSheetContents(Vector<Rule> rules)
+    : m_rules(move(rules))
+{
+    m_estimated_size_in_bytes = sizeof(StyleSheetContents);
+    for (auto const& rule : m_rules)
+        m_estimated_size_in_bytes += estimated_size_in_bytes(rule);
+}
+
+StyleSheetContentsCache& StyleSheetContentsCache::the()
+{
+    static StyleSheetContentsCache cache;
+    return cache;
+}
+
+RefPtr<StyleSheetContents const> StyleSheetContentsCache::get(Utf16String const& source_text)
+{
+    auto it = m_entries.find(source_text);
+    if (it == m_entries.end())
+        return {};
+
+    it->value.last_used = ++m_use_counter;
+    if (!it->value.has_been_shared) {
+        it->value.has_been_shared = true;
+        m_unshared_size_in_bytes -= it->value.size_in_bytes;
+    }
+    ++m_hit_count;
+    return it->value.contents;
+}
+
+void StyleSheetContentsCache::set(Utf16String const& source_text, NonnullRefPtr<StyleSheetContents const> contents)
+{
+    auto source_length = source_text.length_in_code_units();
+    if (source_length < minimum_source_length)
+        return;
+
+    // NB: The rules usually take up several times as much memory as the text they were parsed from.
+    auto size_in_bytes = source_length * sizeof(char16_t) + contents->estimated_size_in_bytes();
+    if (size_in_bytes > maximum_unshared_size_in_bytes)
+        return;
+
+    // NB: Contents that replace an entry for the same text are still shared, since that text was loaded again.
+    bool has_been_shared = false;
+    if (auto it = m_entries.find(source_text); it != m_entries.end()) {
+        has_been_shared = true;
+        remove_entry(it);
+    }
+
+    if (!has_been_shared) {
+        while (m_unshared_size_in_bytes + size_in_bytes > maximum_unshared_size_in_bytes)
+            evict_least_recently_used_entry(OnlyUnshared::Yes);
+    }
+    while (m_total_size_in_bytes + size_in_bytes > maximum_total_size_in_bytes)
+        evict_least_recently_used_entry();
+
+    m_entries.set(source_text, { .contents = move(contents), .size_in_bytes = size_in_bytes, .last_used = ++m_use_counter, .has_been_shared = has_been_shared });
+    m_total_size_in_bytes += size_in_bytes;
+    if (!has_been_shared)
+        m_unshared_size_in_bytes += size_in_bytes;
+}
+
+void StyleSheetContentsCache::evict_least_recently_used_entry(OnlyUnshared only_unshared)
+{
+    Optional<HashMap<Utf16String, Entry>::IteratorType> least_recently_used;
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (only_unshared == OnlyUnshared::Yes && it->value.has_been_shared)
+            continue;
+        if (!least_recently_used.has_value() || it->value.last_used < (*least_recently_used)->value.last_used)
+            least_recently_used = it;
+    }
+
+    VERIFY(least_recently_used.has_value());
+    remove_entry(*least_recently_used);
+}
+
+void StyleSheetContentsCache::remove_entry(HashMap<Utf16String, Entry>::IteratorType it)
+{
+    m_total_size_in_bytes -= it->value.size_in_bytes;
+    if (!it->value.has_been_shared)
+        m_unshared_size_in_bytes -= it->value.size_in_bytes;
+    m_entries.remove(it);
+}
+
+size_t StyleSheetContentsCache::purge(size_t remaining_size_in_bytes)
+{
+    auto total_size_in_bytes_before = m_total_size_in_bytes;
+    while (m_total_size_in_bytes > remaining_size_in_bytes)
+        evict_least_recently_used_entry();
+    return total_size_in_bytes_before - m_total_size_in_bytes;
+}
+
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/RefCounted.h>
+#include <AK/Utf16String.h>
+#include <AK/Vector.h>
+#include <LibWeb/CSS/Parser/ComponentValue.h>
+#include <LibWeb/CSS/Parser/Types.h>
+#include <LibWeb/Export.h>
+
+namespace Web::CSS::Parser {
+
+// The rules of a style sheet as CSS Syntax produces them, before any of them have been interpreted. Nothing in them
+// depends on the document, the base URL or the quirks mode, so every document that loads the same style sheet text can
+// build its own CSSOM from the same contents.
+class WEB_API StyleSheetContents : public RefCounted<StyleSheetContents> {
+public:
+    static NonnullRefPtr<StyleSheetContents> create(Vector<Rule> rules) { return adopt_ref(*new StyleSheetContents(move(rules))); }
+
+    Vector<Rule> const& rules() const { return m_rules; }
+
+    // Roughly how much memory the rules and the component values in them take up.
+    size_t estimated_size_in_bytes() const { return m_estimated_size_in_bytes; }
+
+private:
+    explicit StyleSheetContents(Vector<Rule> rules);
+
+    Vector<Rule> m_rules;
+    size_t m_estimated_size_in_bytes { 0 };
+};
+
+// A per-process cache of StyleSheetContents, keyed by the full style sheet text. Only the CSSOM is per-document, so
+// CSSOM mutations never reach the cached contents.
+//
+// Contents that only one style sheet has used so far are pure overhead, since that style sheet already has its own
+// CSSOM. So the cache only keeps a few megabytes of those around, in case another document loads the same text soon,
+// and keeps contents for longer once they have been shared.
+class WEB_API StyleSheetContentsCache {
+    AK_MAKE_NONCOPYABLE(StyleSheetContentsCache);
+    AK_MAKE_NONMOVABLE(StyleSheetContentsCache);
+
+public:
+    static StyleSheetContentsCache& the();
+
+    // Style sheets shorter than this are cheap enough to parse that they aren't worth keeping around.
+    static constexpr size_t minimum_source_length = 1024;
+
+    // The cache evicts its least recently used entries once they take up more than this in total, going by the size of
+    // their style sheet text and the estimated size of their contents.
+    static constexpr size_t maximum_total_size_in_bytes = 24 * MiB;
+
+    // Of that, entries that haven't been shared yet may only take up this much, and are evicted first to stay below it.
+    static constexpr size_t maximum_unshared_size_in_bytes = 4 * MiB;
+
+    RefPtr<StyleSheetContents const> get(Utf16String const& source_text);
+    void set(Utf16String const& source_text, NonnullRefPtr<StyleSheetContents const>);
+
+    // Evicts the least recently used entries until they take up at most remaining_size_in_bytes in total. Returns
+    // roughly how many bytes were released.
+    size_t purge(size_t remaining_size_in_bytes = 0);
+
+    u64 hit_count() const { return m_hit_count; }
+
+private:
+    StyleSheetContentsCache() = default;
+
+    struct Entry {
+        NonnullRefPtr<StyleSheetContents const> contents;
+        size_t size_in_bytes { 0 };
+        u64 last_used { 0 };
+        bool has_been_shared { false };
+    };
+
+    enum class OnlyUnshared {
+        No,
+        Yes,
+    };
+    void evict_least_recently_used_entry(OnlyUnshared = OnlyUnshared::No);
+    void remove_entry(HashMap<Utf16String, Entry>::IteratorType);
+
+    HashMap<Utf16String, Entry> m_entries;
+    size_t m_total_size_in_bytes { 0 };
+    size_t m_unshared_size_in_bytes { 0 };
+    u64 m_use_counter { 0 };
+    u64 m_hit_count { 0 };
+};
+
+}
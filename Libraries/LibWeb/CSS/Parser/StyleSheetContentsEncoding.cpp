@@ -0,0 +1,568 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Endian.h>
+#include <AK/TemporaryChange.h>
+#include <LibWeb/CSS/Parser/ComponentValue.h>
+#include <LibWeb/CSS/Parser/StyleSheetContentsEncoding.h>
+
+namespace Web::CSS::Parser {
+
+static constexpr u32 magic = 0x5353434c; // "LCSS"
+
+// Computed by the build from the sources of the CSS tokenizer and parser, so that encodings made by a build that might
+// have built different rules are rejected even if the version wasn't bumped.
+#ifndef LIBWEB_CSS_PARSER_FINGERPRINT
+#    define LIBWEB_CSS_PARSER_FINGERPRINT ""
+#endif
+static constexpr StringView parser_fingerprint { LIBWEB_CSS_PARSER_FINGERPRINT };
+
+// Rules and component values nest, so this bounds how deep decoding a malformed encoding can recurse.
+static constexpr size_t maximum_nesting_depth = 512;
+
+enum class RuleTag : u8 {
+    AtRule,
+    QualifiedRule,
+};
+
+enum class RuleOrListOfDeclarationsTag : u8 {
+    Rule,
+    ListOfDeclarations,
+};
+
+enum class ComponentValueTag : u8 {
+    Token,
+    Function,
+    SimpleBlock,
+    GuaranteedInvalidValue,
+};
+
+ErrorOr<ByteBuffer> StyleSheetContentsEncoder::encode(StyleSheetContents const& contents, ReadonlyBytes source_hash)
+{
+    StyleSheetContentsEncoder encoder;
+    TRY(encoder.encode_u32(magic));
+    TRY(encoder.encode_u32(version));
+    TRY(encoder.encode_string(parser_fingerprint));
+    TRY(encoder.encode_bytes(source_hash));
+
+    TRY(encoder.encode_u32(contents.rules().size()));
+    for (auto const& rule : contents.rules())
+        TRY(encoder.encode_rule(rule));
+
+    return move(encoder.m_buffer);
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_u8(u8 value)
+{
+    return m_buffer.try_append(value);
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_u32(u32 value)
+{
+    LittleEndian<u32> little_endian_value { value };
+    return m_buffer.try_append(&little_endian_value, sizeof(little_endian_value));
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_double(double value)
+{
+    LittleEndian<u64> little_endian_value { bit_cast<u64>(value) };
+    return m_buffer.try_append(&little_endian_value, sizeof(little_endian_value));
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_bytes(ReadonlyBytes bytes)
+{
+    TRY(encode_u32(bytes.size()));
+    return m_buffer.try_append(bytes);
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_string(StringView string)
+{
+    return encode_bytes(string.bytes());
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_source_position(SourcePosition const& position)
+{
+    TRY(encode_u32(position.line));
+    return encode_u32(position.column);
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_optional_source_position(Optional<SourcePosition> const& position)
+{
+    TRY(encode_u8(position.has_value()));
+    if (position.has_value())
+        TRY(encode_source_position(*position));
+    return {};
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_rule(Rule const& rule)
+{
+    return rule.visit(
+        [&](AtRule const& at_rule) -> ErrorOr<void> {
+            TRY(encode_u8(to_underlying(RuleTag::AtRule)));
+            TRY(encode_string(at_rule.name.to_utf8()));
+            TRY(encode_component_values(at_rule.prelude));
+            TRY(encode_u32(at_rule.child_rules_and_lists_of_declarations.size()));
+            for (auto const& child : at_rule.child_rules_and_lists_of_declarations)
+                TRY(encode_rule_or_list_of_declarations(child));
+            return encode_u8(at_rule.is_block_rule);
+        },
+        [&](QualifiedRule const& qualified_rule) -> ErrorOr<void> {
+            TRY(encode_u8(to_underlying(RuleTag::QualifiedRule)));
+            TRY(encode_component_values(qualified_rule.prelude));
+            TRY(encode_u32(qualified_rule.declarations.size()));
+            for (auto const& declaration : qualified_rule.declarations)
+                TRY(encode_declaration(declaration));
+            TRY(encode_u32(qualified_rule.child_rules.size()));
+            for (auto const& child : qualified_rule.child_rules)
+                TRY(encode_rule_or_list_of_declarations(child));
+            return encode_optional_source_position(qualified_rule.source_position);
+        });
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_rule_or_list_of_declarations(RuleOrListOfDeclarations const& rule_or_list_of_declarations)
+{
+    return rule_or_list_of_declarations.visit(
+        [&](Rule const& rule) -> ErrorOr<void> {
+            TRY(encode_u8(to_underlying(RuleOrListOfDeclarationsTag::Rule)));
+            return encode_rule(rule);
+        },
+        [&](Vector<Declaration> const& declarations) -> ErrorOr<void> {
+            TRY(encode_u8(to_underlying(RuleOrListOfDeclarationsTag::ListOfDeclarations)));
+            TRY(encode_u32(declarations.size()));
+            for (auto const& declaration : declarations)
+                TRY(encode_declaration(declaration));
+            return {};
+        });
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_declaration(Declaration const& declaration)
+{
+    TRY(encode_string(declaration.name.to_utf8()));
+    TRY(encode_component_values(declaration.value));
+    TRY(encode_u8(to_underlying(declaration.important)));
+
+    TRY(encode_u8(declaration.original_value_text.has_value()));
+    if (declaration.original_value_text.has_value())
+        TRY(encode_string(*declaration.original_value_text));
+
+    TRY(encode_u8(declaration.original_full_text.has_value()));
+    if (declaration.original_full_text.has_value())
+        TRY(encode_string(declaration.original_full_text->to_utf8()));
+
+    return encode_optional_source_position(declaration.source_position);
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_component_values(Vector<ComponentValue> const& component_values)
+{
+    TRY(encode_u32(component_values.size()));
+    for (auto const& component_value : component_values)
+        TRY(encode_component_value(component_value));
+    return {};
+}
+
+// NB: Only substituting attr() taints component values, which never happens to the rules of a style sheet, so there is
+//     no taint to encode.
+ErrorOr<void> StyleSheetContentsEncoder::encode_component_value(ComponentValue const& component_value)
+{
+    if (component_value.is_token()) {
+        TRY(encode_u8(to_underlying(ComponentValueTag::Token)));
+        return encode_token(component_value.token());
+    }
+
+    if (component_value.is_function()) {
+        auto const& function = component_value.function();
+        TRY(encode_u8(to_underlying(ComponentValueTag::Function)));
+        TRY(encode_string(function.name.to_utf8()));
+        TRY(encode_component_values(function.value));
+        TRY(encode_component_value_token(function.name_token));
+        return encode_component_value_token(function.end_token);
+    }
+
+    if (component_value.is_block()) {
+        auto const& block = component_value.block();
+        TRY(encode_u8(to_underlying(ComponentValueTag::SimpleBlock)));
+        TRY(encode_component_value_token(block.token));
+        TRY(encode_component_values(block.value));
+        return encode_component_value_token(block.end_token);
+    }
+
+    VERIFY(component_value.is_guaranteed_invalid());
+    return encode_u8(to_underlying(ComponentValueTag::GuaranteedInvalidValue));
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_component_value_token(ComponentValueToken const& token)
+{
+    TRY(encode_u8(to_underlying(token.type())));
+    TRY(encode_string(token.original_source_text()));
+    TRY(encode_source_position(token.start_position()));
+    return encode_source_position(token.end_position());
+}
+
+ErrorOr<void> StyleSheetContentsEncoder::encode_token(Token const& token)
+{
+    TRY(encode_u8(to_underlying(token.type())));
+
+    auto encode_number = [&](Number const& number) -> ErrorOr<void> {
+        TRY(encode_u8(to_underlying(number.type())));
+        return encode_double(number.value());
+    };
+
+    switch (token.type()) {
+    case Token::Type::Ident:
+        TRY(encode_string(token.ident().to_utf8()));
+        break;
+    case Token::Type::Function:
+        TRY(encode_string(token.function().to_utf8()));
+        break;
+    case Token::Type::AtKeyword:
+        TRY(encode_string(token.at_keyword().to_utf8()));
+        break;
+    case Token::Type::Hash:
+        TRY(encode_string(token.hash_value().to_utf8()));
+        TRY(encode_u8(to_underlying(token.hash_type())));
+        break;
+    case Token::Type::String:
+        TRY(encode_string(token.string().to_utf8()));
+        break;
+    case Token::Type::Url:
+        TRY(encode_string(token.url().to_utf8()));
+        break;
+    case Token::Type::Delim:
+        TRY(encode_u32(token.delim()));
+        break;
+    case Token::Type::Number:
+    case Token::Type::Percentage:
+        TRY(encode_number(token.number()));
+        break;
+    case Token::Type::Dimension:
+        TRY(encode_number(token.number()));
+        TRY(encode_string(token.dimension_unit().to_utf8()));
+        break;
+    default:
+        break;
+    }
+
+    TRY(encode_string(token.original_source_text()));
+    TRY(encode_source_position(token.start_position()));
+    return encode_source_position(token.end_position());
+}
+
+StyleSheetContentsDecoder::StyleSheetContentsDecoder(ReadonlyBytes bytes)
+    : m_stream(bytes)
+{
+}
+
+ErrorOr<NonnullRefPtr<StyleSheetContents const>> StyleSheetContentsDecoder::decode(ReadonlyBytes bytes, ReadonlyBytes source_hash)
+{
+    StyleSheetContentsDecoder decoder { bytes };
+    if (TRY(decoder.decode_u32()) != magic)
+        return Error::from_string_literal("Not an encoding of style sheet contents");
+    if (TRY(decoder.decode_u32()) != StyleSheetContentsEncoder::version)
+        return Error::from_string_literal("Style sheet contents were encoded by a different version");
+    if (TRY(decoder.decode_string()) != parser_fingerprint)
+        return Error::from_string_literal("Style sheet contents were encoded by a different build");
+
+    auto hash_length = TRY(decoder.decode_count());
+    auto hash = TRY(ByteBuffer::create_uninitialized(hash_length));
+    TRY(decoder.m_stream.read_until_filled(hash));
+    if (hash.bytes() != source_hash)
+        return Error::from_string_literal("Style sheet contents were encoded from a different source");
+
+    auto rule_count = TRY(decoder.decode_count());
+    Vector<Rule> rules;
+    TRY(rules.try_ensure_capacity(rule_count));
+    for (size_t i = 0; i < rule_count; ++i)
+        rules.unchecked_append(TRY(decoder.decode_rule()));
+
+    if (!decoder.m_stream.is_eof())
+        return Error::from_string_literal("Unexpected data after the encoded style sheet contents");
+
+    return StyleSheetContents::create(move(rules));
+}
+
+ErrorOr<u8> StyleSheetContentsDecoder::decode_u8()
+{
+    return m_stream.read_value<u8>();
+}
+
+ErrorOr<u32> StyleSheetContentsDecoder::decode_u32()
+{
+    return TRY(m_stream.read_value<LittleEndian<u32>>());
+}
+
+ErrorOr<double> StyleSheetContentsDecoder::decode_double()
+{
+    u64 bits = TRY(m_stream.read_value<LittleEndian<u64>>());
+    return bit_cast<double>(bits);
+}
+
+ErrorOr<bool> StyleSheetContentsDecoder::decode_bool()
+{
+    auto value = TRY(decode_u8());
+    if (value > 1)
+        return Error::from_string_literal("Invalid boolean in encoded style sheet contents");
+    return value == 1;
+}
+
+// Everything that is counted takes up at least a byte, so a count can never be larger than what's left to decode. This
+// keeps a malformed count from making us allocate more than the encoding itself could possibly describe.
+ErrorOr<size_t> StyleSheetContentsDecoder::decode_count()
+{
+    auto count = TRY(decode_u32());
+    if (count > m_stream.remaining())
+        return Error::from_string_literal("Count exceeds the size of the encoded style sheet contents");
+    return count;
+}
+
+ErrorOr<String> StyleSheetContentsDecoder::decode_string()
+{
+    auto length = TRY(decode_count());
+    auto bytes = TRY(ByteBuffer::create_uninitialized(length));
+    TRY(m_stream.read_until_filled(bytes));
+    return String::from_utf8(StringView { bytes });
+}
+
+ErrorOr<Utf16FlyString> StyleSheetContentsDecoder::decode_fly_string()
+{
+    return Utf16FlyString::from_utf8(TRY(decode_string()));
+}
+
+ErrorOr<SourcePosition> StyleSheetContentsDecoder::decode_source_position()
+{
+    SourcePosition position;
+    position.line = TRY(decode_u32());
+    position.column = TRY(decode_u32());
+    return position;
+}
+
+ErrorOr<Optional<SourcePosition>> StyleSheetContentsDecoder::decode_optional_source_position()
+{
+    if (!TRY(decode_bool()))
+        return Optional<SourcePosition> {};
+    return TRY(decode_source_position());
+}
+
+ErrorOr<Rule> StyleSheetContentsDecoder::decode_rule()
+{
+    TemporaryChange depth_change { m_depth, m_depth + 1 };
+    if (m_depth > maximum_nesting_depth)
+        return Error::from_string_literal("Encoded style sheet contents are nested too deeply");
+
+    switch (static_cast<RuleTag>(TRY(decode_u8()))) {
+    case RuleTag::AtRule: {
+        AtRule at_rule;
+        at_rule.name = TRY(decode_fly_string());
+        at_rule.prelude = TRY(decode_component_values());
+        auto child_count = TRY(decode_count());
+        TRY(at_rule.child_rules_and_lists_of_declarations.try_ensure_capacity(child_count));
+        for (size_t i = 0; i < child_count; ++i)
+            at_rule.child_rules_and_lists_of_declarations.unchecked_append(TRY(decode_rule_or_list_of_declarations()));
+        at_rule.is_block_rule = TRY(decode_bool());
+        return at_rule;
+    }
+    case RuleTag::QualifiedRule: {
+        QualifiedRule qualified_rule;
+        qualified_rule.prelude = TRY(decode_component_values());
+        qualified_rule.declarations = TRY(decode_declarations());
+        auto child_count = TRY(decode_count());
+        TRY(qualified_rule.child_rules.try_ensure_capacity(child_count));
+        for (size_t i = 0; i < child_count; ++i)
+            qualified_rule.child_rules.unchecked_append(TRY(decode_rule_or_list_of_declarations()));
+        qualified_rule.source_position = TRY(decode_optional_source_position());
+        return qualified_rule;
+    }
+    }
+    return Error::from_string_literal("Invalid rule in encoded style sheet contents");
+}
+
+ErrorOr<RuleOrListOfDeclarations> StyleSheetContentsDecoder::decode_rule_or_list_of_declarations()
+{
+    switch (static_cast<RuleOrListOfDeclarationsTag>(TRY(decode_u8()))) {
+    case RuleOrListOfDeclarationsTag::Rule:
+        return TRY(decode_rule());
+    case RuleOrListOfDeclarationsTag::ListOfDeclarations:
+        return TRY(decode_declarations());
+    }
+    return Error::from_string_literal("Invalid child rule in encoded style sheet contents");
+}
+
+ErrorOr<Declaration> StyleSheetContentsDecoder::decode_declaration()
+{
+    Declaration declaration;
+    declaration.name = TRY(decode_fly_string());
+    declaration.value = TRY(decode_component_values());
+
+    switch (static_cast<Important>(TRY(decode_u8()))) {
+    case Important::No:
+        declaration.important = Important::No;
+        break;
+    case Important::Yes:
+        declaration.important = Important::Yes;
+        break;
+    default:
+        return Error::from_string_literal("Invalid importance in encoded style sheet contents");
+    }
+
+    if (TRY(decode_bool()))
+        declaration.original_value_text = TRY(decode_string());
+    if (TRY(decode_bool()))
+        declaration.original_full_text = Utf16String::from_utf8(TRY(decode_string()));
+
+    declaration.source_position = TRY(decode_optional_source_position());
+    return declaration;
+}
+
+ErrorOr<Vector<Declaration>> StyleSheetContentsDecoder::decode_declarations()
+{
+    auto count = TRY(decode_count());
+    Vector<Declaration> declarations;
+    TRY(declarations.try_ensure_capacity(count));
+    for (size_t i = 0; i < count; ++i)
+        declarations.unchecked_append(TRY(decode_declaration()));
+    return declarations;
+}
+
+ErrorOr<Vector<ComponentValue>> StyleSheetContentsDecoder::decode_component_values()
+{
+    auto count = TRY(decode_count());
+    Vector<ComponentValue> component_values;
+    TRY(component_values.try_ensure_capacity(count));
+    for (size_t i = 0; i < count; ++i)
+        component_values.unchecked_append(TRY(decode_component_value()));
+    return component_values;
+}
+
+ErrorOr<ComponentValue> StyleSheetContentsDecoder::decode_component_value()
+{
+    TemporaryChange depth_change { m_depth, m_depth + 1 };
+    if (m_depth > maximum_nesting_depth)
+        return Error::from_string_literal("Encoded style sheet contents are nested too deeply");
+
+    switch (static_cast<ComponentValueTag>(TRY(decode_u8()))) {
+    case ComponentValueTag::Token:
+        return ComponentValue { TRY(decode_token()) };
+    case ComponentValueTag::Function: {
+        Function function;
+        function.name = TRY(decode_fly_string());
+        function.value = TRY(decode_component_values());
+        function.name_token = TRY(decode_component_value_token());
+        function.end_token = TRY(decode_component_value_token());
+        return ComponentValue { move(function) };
+    }
+    case ComponentValueTag::SimpleBlock: {
+        SimpleBlock block;
+        block.token = TRY(decode_component_value_token());
+        block.value = TRY(decode_component_values());
+        block.end_token = TRY(decode_component_value_token());
+        return ComponentValue { move(block) };
+    }
+    case ComponentValueTag::GuaranteedInvalidValue:
+        return ComponentValue { GuaranteedInvalidValue {} };
+    }
+    return Error::from_string_literal("Invalid component value in encoded style sheet contents");
+}
+
+static ErrorOr<Token::Type> token_type_from_u8(u8 value)
+{
+    if (value > to_underlying(Token::Type::CloseCurly))
+        return Error::from_string_literal("Invalid token type in encoded style sheet contents");
+    return static_cast<Token::Type>(value);
+}
+
+ErrorOr<ComponentValueToken> StyleSheetContentsDecoder::decode_component_value_token()
+{
+    auto type = TRY(token_type_from_u8(TRY(decode_u8())));
+    auto original_source_text = TRY(decode_string());
+    auto start_position = TRY(decode_source_position());
+    auto end_position = TRY(decode_source_position());
+    return ComponentValueToken { type, move(original_source_text), start_position, end_position };
+}
+
+ErrorOr<Token> StyleSheetContentsDecoder::decode_token()
+{
+    auto type = TRY(token_type_from_u8(TRY(decode_u8())));
+
+    auto decode_number = [&]() -> ErrorOr<Number> {
+        auto number_type = TRY(decode_u8());
+        if (number_type > to_underlying(Number::Type::Integer))
+            return Error::from_string_literal("Invalid number type in encoded style sheet contents");
+        return Number { static_cast<Number::Type>(number_type), TRY(decode_double()) };
+    };
+
+    // NB: The original source text comes after the value, so each branch decodes the value first.
+    Token token;
+    switch (type) {
+    case Token::Type::Invalid:
+        return Error::from_string_literal("Invalid token in encoded style sheet contents");
+    case Token::Type::Ident: {
+        auto ident = TRY(decode_fly_string());
+        token = Token::create_ident(move(ident), TRY(decode_string()));
+        break;
+    }
+    case Token::Type::Function: {
+        auto name = TRY(decode_fly_string());
+        token = Token::create_function(move(name), TRY(decode_string()));
+        break;
+    }
+    case Token::Type::AtKeyword: {
+        auto name = TRY(decode_fly_string());
+        token = Token::create_at_keyword(move(name), TRY(decode_string()));
+        break;
+    }
+    case Token::Type::Hash: {
+        auto value = TRY(decode_fly_string());
+        auto hash_type = TRY(decode_u8());
+        if (hash_type > to_underlying(Token::HashType::Unrestricted))
+            return Error::from_string_literal("Invalid hash type in encoded style sheet contents");
+        token = Token::create_hash(move(value), static_cast<Token::HashType>(hash_type), TRY(decode_string()));
+        break;
+    }
+    case Token::Type::String: {
+        auto value = TRY(decode_fly_string());
+        token = Token::create_string(move(value), TRY(decode_string()));
+        break;
+    }
+    case Token::Type::Url: {
+        auto url = TRY(decode_fly_string());
+        token = Token::create_url(move(url), TRY(decode_string()));
+        break;
+    }
+    case Token::Type::Delim: {
+        auto delim = TRY(decode_u32());
+        token = Token::create_delim(delim, TRY(decode_string()));
+        break;
+    }
+    case Token::Type::Number: {
+        auto number = TRY(decode_number());
+        token = Token::create_number(number, TRY(decode_string()));
+        break;
+    }
+    case Token::Type::Percentage: {
+        auto number = TRY(decode_number());
+        token = Token::create_percentage(number, TRY(decode_string()));
+        break;
+    }
+    case Token::Type::Dimension: {
+        auto number = TRY(decode_number());
+        auto unit = TRY(decode_fly_string());
+        token = Token::create_dimension(number, move(unit), TRY(decode_string()));
+        break;
+    }
+    case Token::Type::Whitespace:
+        token = Token::create_whitespace(TRY(decode_string()));
+        break;
+    default:
+        token = Token::create(type, TRY(decode_string()));
+        break;
+    }
+
+    auto start_position = TRY(decode_source_position());
+    auto end_position = TRY(decode_source_position());
+    token.set_position_range({}, start_position, end_position);
+    return token;
+}
+
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Error.h>
+#include <AK/MemoryStream.h>
+#include <AK/NonnullRefPtr.h>
+#include <LibWeb/CSS/Parser/StyleSheetContentsCache.h>
+#include <LibWeb/Export.h>
+
+namespace Web::CSS::Parser {
+
+// A binary encoding of StyleSheetContents, which is stored next to a style sheet in the HTTP disk cache so that later
+// loads of it, in any process, don't have to tokenize it and build its rules again. Every string is stored inline and
+// every list is prefixed with its length, so nothing in the encoding depends on where anything was in memory.
+//
+// An encoding starts with the version of the format, a fingerprint of the CSS parser that built the rules, and the hash
+// of the source it was made from. Decoding rejects an encoding for which any of these doesn't match, or which is
+// malformed in any way, instead of building rules from it.
+class WEB_API StyleSheetContentsEncoder {
+public:
+    // Bump this whenever the encoding changes. Changes to the tokenizer or parser change the parser fingerprint instead,
+    // but it doesn't hurt to bump this for them as well.
+    static constexpr u32 version = 2;
+
+    static ErrorOr<ByteBuffer> encode(StyleSheetContents const&, ReadonlyBytes source_hash);
+
+private:
+    StyleSheetContentsEncoder() = default;
+
+    ErrorOr<void> encode_u8(u8);
+    ErrorOr<void> encode_u32(u32);
+    ErrorOr<void> encode_double(double);
+    ErrorOr<void> encode_bytes(ReadonlyBytes);
+    ErrorOr<void> encode_string(StringView);
+    ErrorOr<void> encode_source_position(SourcePosition const&);
+    ErrorOr<void> encode_optional_source_position(Optional<SourcePosition> const&);
+
+    ErrorOr<void> encode_rule(Rule const&);
+    ErrorOr<void> encode_rule_or_list_of_declarations(RuleOrListOfDeclarations const&);
+    ErrorOr<void> encode_declaration(Declaration const&);
+    ErrorOr<void> encode_component_values(Vector<ComponentValue> const&);
+    ErrorOr<void> encode_component_value(ComponentValue const&);
+    ErrorOr<void> encode_component_value_token(ComponentValueToken const&);
+    ErrorOr<void> encode_token(Token const&);
+
+    ByteBuffer m_buffer;
+};
+
+class WEB_API StyleSheetContentsDecoder {
+public:
+    static ErrorOr<NonnullRefPtr<StyleSheetContents const>> decode(ReadonlyBytes, ReadonlyBytes source_hash);
+
+private:
+    explicit StyleSheetContentsDecoder(ReadonlyBytes);
+
+    ErrorOr<u8> decode_u8();
+    ErrorOr<u32> decode_u32();
+    ErrorOr<double> decode_double();
+    ErrorOr<bool> decode_bool();
+    ErrorOr<size_t> decode_count();
+    ErrorOr<String> decode_string();
+    ErrorOr<Utf16FlyString> decode_fly_string();
+    ErrorOr<SourcePosition> decode_source_position();
+    ErrorOr<Optional<SourcePosition>> decode_optional_source_position();
+
+    ErrorOr<Rule> decode_rule();
+    ErrorOr<RuleOrListOfDeclarations> decode_rule_or_list_of_declarations();
+    ErrorOr<Declaration> decode_declaration();
+    ErrorOr<Vector<Declaration>> decode_declarations();
+    ErrorOr<Vector<ComponentValue>> decode_component_values();
+    ErrorOr<ComponentValue> decode_component_value();
+    ErrorOr<ComponentValueToken> decode_component_value_token();
+    ErrorOr<Token> decode_token();
+
+    FixedMemoryStream m_stream;
+    size_t m_depth { 0 };
+};
+
+}
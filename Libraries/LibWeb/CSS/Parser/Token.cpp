@@ -451,7 +451,7 @@ StringView Token::bracket_mirror_string() const
     return ""sv;
 }
 
-void Token::set_position_range(Badge<Tokenizer, RustTokenizer>, SourcePosition start, SourcePosition end)
+void Token::set_position_range(Badge<Tokenizer, RustTokenizer, StyleSheetContentsDecoder>, SourcePosition start, SourcePosition end)
 {
     m_start_position = start;
     m_end_position = end;
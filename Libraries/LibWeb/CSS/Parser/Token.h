@@ -167,6 +167,13 @@ public:
     }
     i32 dimension_value_int() const { return m_value.get<DimensionValue>().number.integer_value(); }
 
+    // The unclamped number of a number, percentage or dimension token, including its type.
+    Number const& number() const
+    {
+        VERIFY(m_type == Type::Number || m_type == Type::Dimension || m_type == Type::Percentage);
+        return number_value_for_type();
+    }
+
     double percentage() const
     {
         VERIFY(m_type == Type::Percentage);
@@ -184,7 +191,7 @@ public:
     String const& original_source_text() const { return m_original_source_text; }
     SourcePosition const& start_position() const { return m_start_position; }
     SourcePosition const& end_position() const { return m_end_position; }
-    void set_position_range(Badge<Tokenizer, RustTokenizer>, SourcePosition start, SourcePosition end);
+    void set_position_range(Badge<Tokenizer, RustTokenizer, StyleSheetContentsDecoder>, SourcePosition start, SourcePosition end);
 
     bool operator==(Token const& other) const
     {
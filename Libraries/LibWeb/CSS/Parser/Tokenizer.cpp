@@ -234,6 +234,13 @@ Vector<Token> Tokenizer::tokenize(StringView input, StringView encoding, Tokeniz
 }
 
 Vector<Token> Tokenizer::tokenize(Utf16View input)
+{
+    Tokenizer tokenizer { filter_code_points(input) };
+    return tokenizer.tokenize();
+}
+
+// https://www.w3.org/TR/css-syntax-3/#css-filter-code-points
+String Tokenizer::filter_code_points(Utf16View input)
 {
     StringBuilder builder { input.length_in_code_units() };
     bool last_was_carriage_return = false;
@@ -267,8 +274,7 @@ Vector<Token> Tokenizer::tokenize(Utf16View input)
     if (last_was_carriage_return)
         builder.append('\n');
 
-    Tokenizer tokenizer { builder.to_string_without_validation() };
-    return tokenizer.tokenize();
+    return builder.to_string_without_validation();
 }
 
 Tokenizer::Tokenizer(String decoded_input)
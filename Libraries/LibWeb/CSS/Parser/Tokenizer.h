@@ -69,6 +69,9 @@ public:
     static Vector<Token> tokenize(StringView input, StringView encoding, TokenizerInput = TokenizerInput::DecodedText);
     static Vector<Token> tokenize(Utf16View input);
 
+    // Does not touch any interned strings, so this may be called from any thread.
+    [[nodiscard]] static String filter_code_points(Utf16View input);
+
     [[nodiscard]] static Token create_eof_token();
 
 private:
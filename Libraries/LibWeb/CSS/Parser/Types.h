@@ -75,6 +75,13 @@ class ComponentValueToken {
 public:
     ComponentValueToken() = default;
     ComponentValueToken(Token const&);
+    ComponentValueToken(Token::Type type, String original_source_text, SourcePosition start_position, SourcePosition end_position)
+        : m_type(type)
+        , m_original_source_text(move(original_source_text))
+        , m_start_position(start_position)
+        , m_end_position(end_position)
+    {
+    }
 
     bool is(Token::Type type) const { return m_type == type; }
     Token::Type type() const { return m_type; }
@@ -71,21 +71,40 @@ GC::Ref<CSSStyleSheet> StyleSheetList::create_a_css_style_sheet(Utf16View css_te
     // 1. Create a new CSS style sheet object and set its properties as specified.
     // AD-HOC: The spec never tells us when to parse this style sheet, but the most logical place is here.
     auto sheet = parse_css_stylesheet(Parser::ParsingParams { document() }, css_text, location);
+    initialize_and_add_css_style_sheet(*sheet, owner_node, media, move(title), alternate, origin_clean, parent_style_sheet, owner_rule, style_engine_update);
+    return sheet;
+}
 
-    sheet->set_parent_css_style_sheet(parent_style_sheet);
-    sheet->set_owner_css_rule(owner_rule);
-    sheet->set_owner_node(owner_node);
-    sheet->set_media(move(media));
-    sheet->set_title(move(title));
-    sheet->set_alternate(alternate == Alternate::Yes);
-    sheet->set_origin_clean(origin_clean == OriginClean::Yes);
-
-    // 2. Then run the add a CSS style sheet steps for the newly created CSS style sheet.
-    add_a_css_style_sheet(*sheet, style_engine_update);
+// AD-HOC: Same as above, for a style sheet that has already been decoded and tokenized, possibly on another thread.
+GC::Ref<CSSStyleSheet> StyleSheetList::create_a_css_style_sheet(TokenizedCSSStyleSheet tokenized_style_sheet, DOM::Element* owner_node, Utf16View media, Utf16String title, Alternate alternate, OriginClean origin_clean, Optional<::URL::URL> location, CSSStyleSheet* parent_style_sheet, CSSRule* owner_rule, StyleEngineUpdate style_engine_update)
+{
+    auto sheet = parse_css_stylesheet(Parser::ParsingParams { document() }, move(tokenized_style_sheet), location);
+    initialize_and_add_css_style_sheet(*sheet, owner_node, media, move(title), alternate, origin_clean, parent_style_sheet, owner_rule, style_engine_update);
+    return sheet;
+}
 
+// AD-HOC: Same as above, for a style sheet whose rules have already been built.
+GC::Ref<CSSStyleSheet> StyleSheetList::create_a_css_style_sheet(PreparsedCSSStyleSheet preparsed_style_sheet, DOM::Element* owner_node, Utf16View media, Utf16String title, Alternate alternate, OriginClean origin_clean, Optional<::URL::URL> location, CSSStyleSheet* parent_style_sheet, CSSRule* owner_rule, StyleEngineUpdate style_engine_update)
+{
+    auto sheet = parse_css_stylesheet(Parser::ParsingParams { document() }, move(preparsed_style_sheet), location);
+    initialize_and_add_css_style_sheet(*sheet, owner_node, media, move(title), alternate, origin_clean, parent_style_sheet, owner_rule, style_engine_update);
     return sheet;
 }
 
+void StyleSheetList::initialize_and_add_css_style_sheet(CSSStyleSheet& sheet, DOM::Element* owner_node, Utf16View media, Utf16String title, Alternate alternate, OriginClean origin_clean, CSSStyleSheet* parent_style_sheet, CSSRule* owner_rule, StyleEngineUpdate style_engine_update)
+{
+    sheet.set_parent_css_style_sheet(parent_style_sheet);
+    sheet.set_owner_css_rule(owner_rule);
+    sheet.set_owner_node(owner_node);
+    sheet.set_media(move(media));
+    sheet.set_title(move(title));
+    sheet.set_alternate(alternate == Alternate::Yes);
+    sheet.set_origin_clean(origin_clean == OriginClean::Yes);
+
+    // 2. Then run the add a CSS style sheet steps for the newly created CSS style sheet.
+    add_a_css_style_sheet(sheet, style_engine_update);
+}
+
 void StyleSheetList::add_sheet(CSSStyleSheet& sheet, StyleEngineUpdate style_engine_update)
 {
     sheet.add_owning_document_or_shadow_root(document_or_shadow_root());
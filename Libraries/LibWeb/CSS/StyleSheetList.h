@@ -40,6 +40,8 @@ public:
         Yes,
     };
     GC::Ref<CSSStyleSheet> create_a_css_style_sheet(Utf16View css_text, DOM::Element* owner_node, Utf16View media, Utf16String title, Alternate, OriginClean, Optional<::URL::URL> location, CSSStyleSheet* parent_style_sheet, CSSRule* owner_rule, StyleEngineUpdate = StyleEngineUpdate::Record);
+    GC::Ref<CSSStyleSheet> create_a_css_style_sheet(TokenizedCSSStyleSheet, DOM::Element* owner_node, Utf16View media, Utf16String title, Alternate, OriginClean, Optional<::URL::URL> location, CSSStyleSheet* parent_style_sheet, CSSRule* owner_rule, StyleEngineUpdate = StyleEngineUpdate::Record);
+    GC::Ref<CSSStyleSheet> create_a_css_style_sheet(PreparsedCSSStyleSheet, DOM::Element* owner_node, Utf16View media, Utf16String title, Alternate, OriginClean, Optional<::URL::URL> location, CSSStyleSheet* parent_style_sheet, CSSRule* owner_rule, StyleEngineUpdate = StyleEngineUpdate::Record);
 
     Vector<GC::Ref<CSSStyleSheet>> const& sheets() const { return m_sheets; }
     Vector<GC::Ref<CSSStyleSheet>>& sheets() { return m_sheets; }
@@ -64,6 +66,7 @@ private:
 
     virtual void visit_edges(GC::Cell::Visitor&) override;
 
+    void initialize_and_add_css_style_sheet(CSSStyleSheet&, DOM::Element* owner_node, Utf16View media, Utf16String title, Alternate, OriginClean, CSSStyleSheet* parent_style_sheet, CSSRule* owner_rule, StyleEngineUpdate);
     void add_sheet(CSSStyleSheet&, StyleEngineUpdate);
     void remove_sheet(CSSStyleSheet&, StyleEngineUpdate);
     void insert_sheet_in_tree_order(CSSStyleSheet&);
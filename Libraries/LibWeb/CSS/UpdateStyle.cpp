@@ -22,6 +22,7 @@
 #include <LibWeb/HTML/LocalNavigable.h>
 #include <LibWeb/HTML/NavigableContainer.h>
 #include <LibWeb/Layout/Box.h>
+#include <LibWeb/Page/Page.h>
 
 namespace Web::CSS {
 
@@ -843,6 +844,7 @@ namespace Web::DOM {
 
 void Document::update_style()
 {
+    PageLoadPhaseTimer timer { page(), PageLoadPhase::Style };
     CSS::update_style(*this);
 }
 
@@ -144,7 +144,8 @@ static void write_blobs_and_option_to_clipboard(JS::Realm& realm, ReadonlySpan<G
 
         // 3. Let payload be the result of UTF-8 decoding item’s underlying byte sequence.
         auto decoder = TextCodec::decoder_for("UTF-8"sv);
-        auto payload = MUST(TextCodec::convert_input_to_utf8_using_given_decoder_unless_there_is_a_byte_order_mark(*decoder, item->raw_bytes()));
+        auto item_bytes = MUST(item->raw_bytes());
+        auto payload = MUST(TextCodec::convert_input_to_utf8_using_given_decoder_unless_there_is_a_byte_order_mark(*decoder, item_bytes.bytes()));
 
         // 4. Insert payload and presentationStyle into the system clipboard using formatString as the native clipboard format.
         representations.empend(payload.to_byte_string(), move(format_string));
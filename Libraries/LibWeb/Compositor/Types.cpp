@@ -82,4 +82,21 @@ ErrorOr<Web::Compositor::AsyncScrollEnqueueResult> decode(Decoder& decoder)
     };
 }
 
+template<>
+ErrorOr<void> encode(Encoder& encoder, Web::Compositor::PresentTimings const& timings)
+{
+    TRY(encoder.encode(timings.raster_time));
+    TRY(encoder.encode(timings.present_latency));
+    return {};
+}
+
+template<>
+ErrorOr<Web::Compositor::PresentTimings> decode(Decoder& decoder)
+{
+    return Web::Compositor::PresentTimings {
+        .raster_time = TRY(decoder.decode<AK::Duration>()),
+        .present_latency = TRY(decoder.decode<AK::Duration>()),
+    };
+}
+
 }
@@ -10,6 +10,7 @@
 #include <AK/DistinctNumeric.h>
 #include <AK/EnumBits.h>
 #include <AK/Optional.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibIPC/Forward.h>
@@ -52,6 +53,14 @@ enum class AsyncScrollOperationTracking {
     Yes,
 };
 
+struct PresentTimings {
+    // The time spent rasterizing the frame's display list, including waiting for the GPU to finish with it.
+    AK::Duration raster_time;
+
+    // The time from the first request to present the frame until it was ready to be shown.
+    AK::Duration present_latency;
+};
+
 }
 
 namespace IPC {
@@ -76,4 +85,9 @@ WEB_API ErrorOr<void> encode(Encoder&, Web::Compositor::AsyncScrollEnqueueResult
 template<>
 WEB_API ErrorOr<Web::Compositor::AsyncScrollEnqueueResult> decode(Decoder&);
 
+template<>
+WEB_API ErrorOr<void> encode(Encoder&, Web::Compositor::PresentTimings const&);
+template<>
+WEB_API ErrorOr<Web::Compositor::PresentTimings> decode(Decoder&);
+
 }
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/EventLoop.h>
+#include <LibGC/Heap.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/Error.h>
+#include <LibJS/Runtime/TypedArray.h>
+#include <LibThreading/ThreadPool.h>
+#include <LibWeb/Compression/CodecTransform.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/Streams/TransformStream.h>
+#include <LibWeb/Streams/TransformStreamOperations.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/ExceptionOrUtils.h>
+
+namespace Web::Compression {
+
+GC_DEFINE_ALLOCATOR(CodecTransform);
+
+NonnullRefPtr<CodecWorker> CodecWorker::create(Codec codec)
+{
+    return adopt_ref(*new CodecWorker(move(codec)));
+}
+
+CodecWorker::CodecWorker(Codec codec)
+    : m_origin_event_loop(Core::EventLoop::current())
+    , m_codec(move(codec))
+{
+}
+
+CodecWorker::~CodecWorker() = default;
+
+void CodecWorker::set_result_handler(ResultHandler handler)
+{
+    m_result_handler = move(handler);
+}
+
+void CodecWorker::submit(ByteBuffer input, Finish finish)
+{
+    Sync::MutexLocker locker { m_mutex };
+    if (m_is_stopped)
+        return;
+
+    m_jobs.enqueue({ move(input), finish });
+    start_running_jobs();
+}
+
+void CodecWorker::resume()
+{
+    Sync::MutexLocker locker { m_mutex };
+    if (m_is_stopped)
+        return;
+
+    m_is_paused = false;
+    start_running_jobs();
+}
+
+void CodecWorker::start_running_jobs()
+{
+    if (m_is_running || m_is_paused)
+        return;
+
+    m_is_running = true;
+    Threading::ThreadPool::the().submit([self = NonnullRefPtr(*this)] {
+        self->run_jobs();
+    });
+}
+
+void CodecWorker::stop()
+{
+    m_result_handler = nullptr;
+
+    // Drop the queued input after unlocking, the job that is currently running will finish on its own.
+    Queue<Job> discarded_jobs;
+    {
+        Sync::MutexLocker locker { m_mutex };
+        m_is_stopped = true;
+        m_continuation.clear();
+        swap(discarded_jobs, m_jobs);
+    }
+}
+
+void CodecWorker::run_jobs()
+{
+    while (true) {
+        Job job;
+        {
+            Sync::MutexLocker locker { m_mutex };
+            if (m_is_stopped || m_is_paused || (!m_continuation.has_value() && m_jobs.is_empty())) {
+                m_is_running = false;
+                return;
+            }
+            if (m_continuation.has_value())
+                job.finish = m_continuation.release_value();
+            else
+                job = m_jobs.dequeue();
+        }
+
+        auto result = m_codec(job.input, job.finish);
+
+        // NB: The rest of the output is produced once the origin thread has made room for it, see resume().
+        if (!result.is_error() && result.value().has_more) {
+            Sync::MutexLocker locker { m_mutex };
+            m_continuation = job.finish;
+            m_is_paused = true;
+        }
+
+        m_origin_event_loop.deferred_invoke([self = NonnullRefPtr(*this), result = move(result), finish = job.finish] mutable {
+            if (self->m_result_handler)
+                self->m_result_handler(move(result), finish);
+        });
+    }
+}
+
+GC::Ref<CodecTransform> CodecTransform::create(JS::Realm& realm, GC::Ref<Streams::TransformStream> transform, Operation operation, CodecWorker::Codec codec)
+{
+    return GC::Heap::the().allocate<CodecTransform>(realm, transform, operation, CodecWorker::create(move(codec)));
+}
+
+CodecTransform::CodecTransform(JS::Realm& realm, GC::Ref<Streams::TransformStream> transform, Operation operation, NonnullRefPtr<CodecWorker> worker)
+    : m_realm(realm)
+    , m_transform(transform)
+    , m_operation(operation)
+    , m_worker(move(worker))
+{
+    m_worker->set_result_handler([this](ErrorOr<CodecOutput> result, Finish finish) {
+        HTML::queue_global_task(HTML::Task::Source::Unspecified, m_realm->global_object(), GC::create_function(GC::Heap::the(), [self = GC::Ref { *this }, result = move(result), finish] mutable {
+            self->handle_result(move(result), finish);
+        }));
+    });
+}
+
+CodecTransform::~CodecTransform() = default;
+
+void CodecTransform::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_realm);
+    visitor.visit(m_transform);
+    visitor.visit(m_pending_transform_promise);
+    visitor.visit(m_pending_flush_promise);
+    if (m_error.has_value())
+        visitor.visit(*m_error);
+}
+
+void CodecTransform::finalize()
+{
+    Base::finalize();
+    m_worker->stop();
+}
+
+static StringView operation_name(CodecTransform::Operation operation)
+{
+    switch (operation) {
+    case CodecTransform::Operation::Compress:
+        return "compress"sv;
+    case CodecTransform::Operation::Decompress:
+        return "decompress"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// https://compression.spec.whatwg.org/#compress-and-enqueue-a-chunk
+// https://compression.spec.whatwg.org/#decompress-and-enqueue-a-chunk
+GC::Ref<WebIDL::Promise> CodecTransform::transform(JS::Value chunk)
+{
+    auto& realm = *m_realm;
+
+    // 1. If chunk is not a BufferSource type, then throw a TypeError.
+    if (!WebIDL::is_buffer_source_type(chunk))
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"_utf16 });
+
+    if (m_error.has_value())
+        return WebIDL::create_rejected_promise(realm, *m_error);
+
+    // NB: The chunk is copied now, since script may modify its buffer while the worker is busy with it.
+    auto chunk_buffer = WebIDL::get_buffer_source_copy(chunk.as_object());
+    if (chunk_buffer.is_error())
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("Unable to {} chunk: {}", operation_name(m_operation), chunk_buffer.error()) });
+
+    // 2. Let buffer be the result of (de)compressing chunk with the stream's format and context.
+    // NB: The remaining steps run once the worker has finished with the chunk, see handle_result().
+    submit(chunk_buffer.release_value(), Finish::No);
+
+    // NB: The transform stream does not hand over another chunk until this promise resolves. Resolving it while the
+    //     worker still has room lets the next chunk be copied and queued while this one is being processed, and
+    //     holding it back otherwise keeps backpressure on the writable side.
+    auto promise = WebIDL::create_promise(realm);
+    if (m_jobs_in_flight < max_chunks_in_flight)
+        WebIDL::resolve_promise(realm, promise, JS::js_undefined());
+    else
+        m_pending_transform_promise = promise;
+    return promise;
+}
+
+// https://compression.spec.whatwg.org/#compress-flush-and-enqueue
+// https://compression.spec.whatwg.org/#decompress-flush-and-enqueue
+GC::Ref<WebIDL::Promise> CodecTransform::flush()
+{
+    auto& realm = *m_realm;
+
+    if (m_error.has_value())
+        return WebIDL::create_rejected_promise(realm, *m_error);
+
+    // 1. Let buffer be the result of (de)compressing an empty input with the stream's format and context, with the
+    //    finish flag.
+    // NB: The worker runs jobs in order, so this also waits for every chunk that is still in flight.
+    submit({}, Finish::Yes);
+
+    m_pending_flush_promise = WebIDL::create_promise(realm);
+    return *m_pending_flush_promise;
+}
+
+void CodecTransform::cancel()
+{
+    m_worker->stop();
+    m_jobs_in_flight = 0;
+    m_pending_transform_promise = nullptr;
+    m_pending_flush_promise = nullptr;
+    update_activity_root();
+}
+
+void CodecTransform::submit(ByteBuffer input, Finish finish)
+{
+    m_jobs_in_flight++;
+    m_worker->submit(move(input), finish);
+    update_activity_root();
+}
+
+void CodecTransform::handle_result(ErrorOr<CodecOutput> result, Finish finish)
+{
+    if (m_jobs_in_flight == 0 || m_error.has_value())
+        return;
+
+    // NB: A job stays in flight until the last piece of its output has arrived.
+    auto has_more = !result.is_error() && result.value().has_more;
+    if (!has_more) {
+        m_jobs_in_flight--;
+        update_activity_root();
+    }
+
+    auto& realm = *m_realm;
+    HTML::TemporaryExecutionContext context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+
+    // If this results in an error, then throw a TypeError.
+    if (result.is_error()) {
+        auto step = finish == Finish::Yes ? "flush"sv : "chunk"sv;
+        fail(JS::TypeError::create(realm, Utf16String::formatted("Unable to {} {}: {}", operation_name(m_operation), step, result.error())));
+        return;
+    }
+
+    // FIXME: If the end of the compressed input has not been reached when flushing a decompression stream, then throw
+    //        a TypeError. LibCompress already fails in that case.
+
+    auto buffer = move(result.value().data);
+
+    // If buffer is empty, return.
+    if (!buffer.is_empty()) {
+        // Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+        auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
+        auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+
+        // For each Uint8Array array, enqueue array in the stream's transform.
+        if (auto enqueue_result = Streams::transform_stream_default_controller_enqueue(*m_transform->controller(), array); enqueue_result.is_error()) {
+            fail(WebIDL::exception_to_throw_completion(realm.vm(), realm, enqueue_result.release_error()).value());
+            return;
+        }
+    }
+
+    if (has_more) {
+        resume_after_backpressure();
+        return;
+    }
+
+    if (finish == Finish::Yes) {
+        if (auto promise = m_pending_flush_promise) {
+            m_pending_flush_promise = nullptr;
+            WebIDL::resolve_promise(realm, *promise, JS::js_undefined());
+        }
+        return;
+    }
+
+    if (m_pending_transform_promise && m_jobs_in_flight < max_chunks_in_flight) {
+        auto promise = m_pending_transform_promise;
+        m_pending_transform_promise = nullptr;
+        WebIDL::resolve_promise(realm, *promise, JS::js_undefined());
+    }
+}
+
+// NB: The rest of a job's output is only produced once the readable side has room for it, so a small chunk that
+//     (de)compresses to a lot of data is not held in memory all at once.
+void CodecTransform::resume_after_backpressure()
+{
+    if (m_transform->backpressure() != true) {
+        m_worker->resume();
+        return;
+    }
+
+    auto backpressure_change_promise = m_transform->backpressure_change_promise();
+    VERIFY(backpressure_change_promise);
+    WebIDL::upon_fulfillment(*backpressure_change_promise, GC::create_function(GC::Heap::the(), [self = GC::Ref { *this }](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
+        if (!self->m_error.has_value() && self->m_jobs_in_flight > 0)
+            self->resume_after_backpressure();
+        return JS::js_undefined();
+    }));
+}
+
+void CodecTransform::fail(JS::Value error)
+{
+    m_error = error;
+    m_worker->stop();
+    m_jobs_in_flight = 0;
+    update_activity_root();
+
+    auto pending_transform_promise = m_pending_transform_promise;
+    auto pending_flush_promise = m_pending_flush_promise;
+    m_pending_transform_promise = nullptr;
+    m_pending_flush_promise = nullptr;
+
+    // NB: The promise of the chunk that failed may already have been resolved, so error the stream directly as well.
+    Streams::transform_stream_default_controller_error(*m_transform->controller(), error);
+
+    if (pending_transform_promise)
+        WebIDL::reject_promise(*m_realm, *pending_transform_promise, error);
+    if (pending_flush_promise)
+        WebIDL::reject_promise(*m_realm, *pending_flush_promise, error);
+}
+
+void CodecTransform::update_activity_root()
+{
+    if (m_jobs_in_flight > 0)
+        m_activity_root.take(*this);
+    else
+        m_activity_root.release();
+}
+
+}
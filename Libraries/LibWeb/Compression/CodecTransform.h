@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/ByteBuffer.h>
+#include <AK/Function.h>
+#include <AK/Queue.h>
+#include <LibCore/Forward.h>
+#include <LibGC/ActivityRoot.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibSync/Mutex.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::Compression {
+
+enum class Finish {
+    No,
+    Yes,
+};
+
+struct CodecOutput {
+    ByteBuffer data;
+
+    // Set when the codec stopped at its output limit. It is called again without input to produce the rest, once
+    // there is room for it, see CodecWorker::resume().
+    bool has_more { false };
+};
+
+// Runs the (de)compression context of one stream on the shared thread pool. Jobs run one at a time, in the order
+// they were submitted, and their results are handed back to the thread that created the worker.
+class CodecWorker final : public AtomicRefCounted<CodecWorker> {
+public:
+    using Codec = Function<ErrorOr<CodecOutput>(ReadonlyBytes, Finish)>;
+    using ResultHandler = Function<void(ErrorOr<CodecOutput>, Finish)>;
+
+    static NonnullRefPtr<CodecWorker> create(Codec);
+    ~CodecWorker();
+
+    void set_result_handler(ResultHandler);
+    void submit(ByteBuffer, Finish);
+    void stop();
+
+    // No jobs run after one whose output has more to come, until this is called to continue it.
+    void resume();
+
+private:
+    explicit CodecWorker(Codec);
+
+    struct Job {
+        ByteBuffer input;
+        Finish finish { Finish::No };
+    };
+
+    void start_running_jobs();
+    void run_jobs();
+
+    Core::EventLoop& m_origin_event_loop;
+
+    // Only touched by the thread currently running jobs.
+    Codec m_codec;
+
+    Sync::Mutex m_mutex;
+    Queue<Job> m_jobs;
+    Optional<Finish> m_continuation;
+    bool m_is_running { false };
+    bool m_is_paused { false };
+    bool m_is_stopped { false };
+
+    // Only touched on the origin thread.
+    ResultHandler m_result_handler;
+};
+
+// Drives a TransformStream from a CodecWorker. Chunks are handed to the worker as they arrive, and the transform
+// algorithm's promise resolves as soon as there is room for another chunk, so the JS thread never waits on the codec
+// while the stream's backpressure still propagates to the writable side.
+class CodecTransform final : public JS::Cell {
+    GC_CELL(CodecTransform, JS::Cell);
+    GC_DECLARE_ALLOCATOR(CodecTransform);
+
+public:
+    static constexpr bool OVERRIDES_FINALIZE = true;
+
+    enum class Operation {
+        Compress,
+        Decompress,
+    };
+
+    static GC::Ref<CodecTransform> create(JS::Realm&, GC::Ref<Streams::TransformStream>, Operation, CodecWorker::Codec);
+    virtual ~CodecTransform() override;
+
+    GC::Ref<WebIDL::Promise> transform(JS::Value chunk);
+    GC::Ref<WebIDL::Promise> flush();
+    void cancel();
+
+private:
+    CodecTransform(JS::Realm&, GC::Ref<Streams::TransformStream>, Operation, NonnullRefPtr<CodecWorker>);
+
+    virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
+
+    void submit(ByteBuffer, Finish);
+    void handle_result(ErrorOr<CodecOutput>, Finish);
+    void resume_after_backpressure();
+    void fail(JS::Value error);
+    void update_activity_root();
+
+    // The number of chunks that may be handed to the worker before the transform algorithm waits for one of them.
+    static constexpr size_t max_chunks_in_flight = 2;
+
+    GC::Ref<JS::Realm> m_realm;
+    GC::Ref<Streams::TransformStream> m_transform;
+    Operation m_operation;
+    NonnullRefPtr<CodecWorker> m_worker;
+
+    size_t m_jobs_in_flight { 0 };
+    GC::Ptr<WebIDL::Promise> m_pending_transform_promise;
+    GC::Ptr<WebIDL::Promise> m_pending_flush_promise;
+    Optional<JS::Value> m_error;
+
+    GC::ActivityRoot m_activity_root;
+};
+
+}
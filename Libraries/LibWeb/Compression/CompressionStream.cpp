@@ -9,18 +9,14 @@
 #include <LibCompress/Deflate.h>
 #include <LibCompress/Gzip.h>
 #include <LibCompress/Zlib.h>
+#include <LibCompress/Zstd.h>
 #include <LibGC/Heap.h>
-#include <LibJS/Runtime/ArrayBuffer.h>
-#include <LibJS/Runtime/TypedArray.h>
 #include <LibWeb/Bindings/CompressionStream.h>
 #include <LibWeb/Bindings/Wrappable.h>
 #include <LibWeb/Compression/CompressionStream.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
-#include <LibWeb/Streams/ReadableStream.h>
 #include <LibWeb/Streams/TransformStream.h>
-#include <LibWeb/Streams/TransformStreamOperations.h>
-#include <LibWeb/Streams/WritableStream.h>
-#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::Compression {
 
@@ -38,6 +34,8 @@ static ErrorOr<Compressor> create_compressor(Bindings::CompressionFormat format,
         return TRY(Compress::DeflateCompressor::create(move(stream)));
     case Bindings::CompressionFormat::Gzip:
         return TRY(Compress::GzipCompressor::create(move(stream)));
+    case Bindings::CompressionFormat::Zstd:
+        return TRY(Compress::ZstdCompressor::create(move(stream)));
     }
 
     VERIFY_NOT_REACHED();
@@ -56,42 +54,59 @@ WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::create_for_co
 }
 
 // https://compression.spec.whatwg.org/#dom-compressionstream-compressionstream
-WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::create(JS::Object& relevant_global_object, Compressor compressor, NonnullOwnPtr<AllocatingMemoryStream> input_stream)
+WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::create(JS::Object& relevant_global_object, Compressor compressor, NonnullOwnPtr<AllocatingMemoryStream> output_stream)
 {
     auto& realm = HTML::relevant_realm(relevant_global_object);
 
     // 5. Set this's transform to a new TransformStream.
     // NOTE: We do this first so that we may store it as nonnull in the GenericTransformStream.
     auto transform_stream = GC::Heap::the().allocate<Streams::TransformStream>();
-    auto stream = GC::Heap::the().allocate<CompressionStream>(transform_stream, move(compressor), move(input_stream));
+    auto stream = GC::Heap::the().allocate<CompressionStream>(transform_stream);
+
+    // NB: This runs on a worker thread. It produces the buffer of the compress and enqueue a chunk and compress flush
+    //     and enqueue algorithms, and the steps that follow run on the JS thread once it is done.
+    auto compress = [compressor = move(compressor), output_stream = move(output_stream)](ReadonlyBytes bytes, Finish finish) mutable -> ErrorOr<CodecOutput> {
+        TRY(compressor.visit([&](auto const& compressor) {
+            return compressor->write_until_depleted(bytes);
+        }));
+
+        if (finish == Finish::Yes) {
+            TRY(compressor.visit([](auto const& compressor) {
+                return compressor->finish();
+            }));
+        }
+
+        auto buffer = TRY(ByteBuffer::create_uninitialized(output_stream->used_buffer_size()));
+        TRY(output_stream->read_until_filled(buffer.bytes()));
+        return CodecOutput { move(buffer) };
+    };
+    stream->m_codec_transform = CodecTransform::create(realm, transform_stream, CodecTransform::Operation::Compress, move(compress));
 
     // 3. Let transformAlgorithm be an algorithm which takes a chunk argument and runs the compress and enqueue a chunk
     //    algorithm with this and chunk.
-    auto transform_algorithm = GC::create_function(GC::Heap::the(), [stream, realm = GC::Ref(realm)](JS::Value chunk) -> GC::Ref<WebIDL::Promise> {
-        if (auto result = stream->compress_and_enqueue_chunk(realm, chunk); result.is_error())
-            return WebIDL::create_rejected_promise_from_exception(realm, result.release_error());
-
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    auto transform_algorithm = GC::create_function(GC::Heap::the(), [stream](JS::Value chunk) -> GC::Ref<WebIDL::Promise> {
+        return stream->m_codec_transform->transform(chunk);
     });
 
     // 4. Let flushAlgorithm be an algorithm which takes no argument and runs the compress flush and enqueue algorithm with this.
-    auto flush_algorithm = GC::create_function(GC::Heap::the(), [stream, realm = GC::Ref(realm)]() -> GC::Ref<WebIDL::Promise> {
-        if (auto result = stream->compress_flush_and_enqueue(realm); result.is_error())
-            return WebIDL::create_rejected_promise_from_exception(realm, result.release_error());
+    auto flush_algorithm = GC::create_function(GC::Heap::the(), [stream]() -> GC::Ref<WebIDL::Promise> {
+        return stream->m_codec_transform->flush();
+    });
 
+    // NB: Cancelling the stream only needs to release the compression context.
+    auto cancel_algorithm = GC::create_function(GC::Heap::the(), [stream, realm = GC::Ref(realm)](JS::Value) -> GC::Ref<WebIDL::Promise> {
+        stream->m_codec_transform->cancel();
         return WebIDL::create_resolved_promise(realm, JS::js_undefined());
     });
 
     // 6. Set up this's transform with transformAlgorithm set to transformAlgorithm and flushAlgorithm set to flushAlgorithm.
-    stream->m_transform->set_up(realm, transform_algorithm, flush_algorithm);
+    stream->m_transform->set_up(realm, transform_algorithm, flush_algorithm, cancel_algorithm);
 
     return stream;
 }
 
-CompressionStream::CompressionStream(GC::Ref<Streams::TransformStream> transform, Compressor compressor, NonnullOwnPtr<AllocatingMemoryStream> input_stream)
+CompressionStream::CompressionStream(GC::Ref<Streams::TransformStream> transform)
     : Streams::GenericTransformStreamMixin(transform)
-    , m_compressor(move(compressor))
-    , m_output_stream(move(input_stream))
 {
 }
 
@@ -101,77 +116,7 @@ void CompressionStream::visit_edges(GC::Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     Streams::GenericTransformStreamMixin::visit_edges(visitor);
-}
-
-// https://compression.spec.whatwg.org/#compress-and-enqueue-a-chunk
-WebIDL::ExceptionOr<void> CompressionStream::compress_and_enqueue_chunk(JS::Realm& realm, JS::Value chunk)
-{
-    // 1. If chunk is not a BufferSource type, then throw a TypeError.
-    if (!WebIDL::is_buffer_source_type(chunk))
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"_utf16 };
-
-    // 2. Let buffer be the result of compressing chunk with cs's format and context.
-    auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
-        auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
-        return compress(chunk_buffer, Finish::No);
-    }();
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("Unable to compress chunk: {}", maybe_buffer.error()) };
-
-    auto buffer = maybe_buffer.release_value();
-
-    // 3. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
-
-    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
-
-    // 5. For each Uint8Array array, enqueue array in cs's transform.
-    TRY(Streams::transform_stream_default_controller_enqueue(*m_transform->controller(), array));
-    return {};
-}
-
-// https://compression.spec.whatwg.org/#compress-flush-and-enqueue
-WebIDL::ExceptionOr<void> CompressionStream::compress_flush_and_enqueue(JS::Realm& realm)
-{
-    // 1. Let buffer be the result of compressing an empty input with cs's format and context, with the finish flag.
-    auto maybe_buffer = compress({}, Finish::Yes);
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("Unable to compress flush: {}", maybe_buffer.error()) };
-
-    auto buffer = maybe_buffer.release_value();
-
-    // 2. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
-
-    // 3. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
-
-    // 4. For each Uint8Array array, enqueue array in cs's transform.
-    TRY(Streams::transform_stream_default_controller_enqueue(*m_transform->controller(), array));
-    return {};
-}
-
-ErrorOr<ByteBuffer> CompressionStream::compress(ReadonlyBytes bytes, Finish finish)
-{
-    TRY(m_compressor.visit([&](auto const& compressor) {
-        return compressor->write_until_depleted(bytes);
-    }));
-
-    if (finish == Finish::Yes) {
-        TRY(m_compressor.visit([](auto const& compressor) {
-            return compressor->finish();
-        }));
-    }
-
-    auto buffer = TRY(ByteBuffer::create_uninitialized(m_output_stream->used_buffer_size()));
-    TRY(m_output_stream->read_until_filled(buffer.bytes()));
-
-    return buffer;
+    visitor.visit(m_codec_transform);
 }
 
 }
@@ -13,6 +13,7 @@
 #include <LibGC/Ptr.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/Bindings/Wrappable.h>
+#include <LibWeb/Compression/CodecTransform.h>
 #include <LibWeb/Streams/GenericTransformStream.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
@@ -28,7 +29,8 @@ using Compressor = Variant<
     NonnullOwnPtr<Compress::BrotliCompressor>,
     NonnullOwnPtr<Compress::ZlibCompressor>,
     NonnullOwnPtr<Compress::DeflateCompressor>,
-    NonnullOwnPtr<Compress::GzipCompressor>>;
+    NonnullOwnPtr<Compress::GzipCompressor>,
+    NonnullOwnPtr<Compress::ZstdCompressor>>;
 
 // https://compression.spec.whatwg.org/#compressionstream
 class CompressionStream final
@@ -43,21 +45,12 @@ public:
     virtual ~CompressionStream() override;
 
 private:
-    CompressionStream(GC::Ref<Streams::TransformStream>, Compressor, NonnullOwnPtr<AllocatingMemoryStream>);
+    explicit CompressionStream(GC::Ref<Streams::TransformStream>);
 
     virtual void visit_edges(GC::Cell::Visitor&) override;
 
-    WebIDL::ExceptionOr<void> compress_and_enqueue_chunk(JS::Realm&, JS::Value);
-    WebIDL::ExceptionOr<void> compress_flush_and_enqueue(JS::Realm&);
-
-    enum class Finish {
-        No,
-        Yes,
-    };
-    ErrorOr<ByteBuffer> compress(ReadonlyBytes, Finish);
-
-    Compressor m_compressor;
-    NonnullOwnPtr<AllocatingMemoryStream> m_output_stream;
+    // NB: The compression context lives on a worker thread, see CodecTransform.
+    GC::Ptr<CodecTransform> m_codec_transform;
 };
 
 }
@@ -9,17 +9,14 @@
 #include <LibCompress/Deflate.h>
 #include <LibCompress/Gzip.h>
 #include <LibCompress/Zlib.h>
+#include <LibCompress/Zstd.h>
 #include <LibGC/Heap.h>
-#include <LibJS/Runtime/ArrayBuffer.h>
-#include <LibJS/Runtime/TypedArray.h>
 #include <LibWeb/Bindings/CompressionStream.h>
 #include <LibWeb/Bindings/Wrappable.h>
 #include <LibWeb/Compression/DecompressionStream.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
-#include <LibWeb/Streams/ReadableStream.h>
 #include <LibWeb/Streams/TransformStream.h>
-#include <LibWeb/Streams/WritableStream.h>
-#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::Compression {
 
@@ -37,6 +34,8 @@ static ErrorOr<Decompressor> create_decompressor(Bindings::CompressionFormat for
         return TRY(Compress::DeflateDecompressor::create(move(stream)));
     case Bindings::CompressionFormat::Gzip:
         return TRY(Compress::GzipDecompressor::create(move(stream)));
+    case Bindings::CompressionFormat::Zstd:
+        return TRY(Compress::ZstdDecompressor::create(move(stream)));
     }
 
     VERIFY_NOT_REACHED();
@@ -54,6 +53,45 @@ WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::create_fo
     return create(relevant_global_object, decompressor.release_value(), move(input_stream));
 }
 
+// NB: A small chunk may decompress to a huge amount of data. Output is produced in pieces of at most this size, and
+//     the next piece only once the stream's reader has room for it.
+static constexpr size_t max_output_size_per_step = 1 * MiB;
+
+static ErrorOr<CodecOutput> decompress(Decompressor& decompressor, AllocatingMemoryStream& input_stream, ReadonlyBytes bytes, Finish finish)
+{
+    TRY(input_stream.write_until_depleted(bytes));
+
+    // NB: Unless finishing, decompression only continues while there is unread input. Whatever the decompressor holds
+    //     back after that comes out with the next chunk, or with the flush at the latest.
+    static constexpr size_t output_block_size = 16 * KiB;
+    CodecOutput output;
+    while (true) {
+        if (output.data.size() >= max_output_size_per_step) {
+            output.has_more = true;
+            break;
+        }
+        if (finish == Finish::No && input_stream.is_eof())
+            break;
+        if (finish == Finish::Yes && decompressor.visit([](auto const& decompressor) { return decompressor->is_eof(); }))
+            break;
+
+        auto unread_input = input_stream.used_buffer_size();
+        auto block_size = min(output_block_size, max_output_size_per_step - output.data.size());
+        auto block = TRY(output.data.get_bytes_for_writing(block_size));
+        auto decompressed = TRY(decompressor.visit([&](auto const& decompressor) {
+            return decompressor->read_some(block);
+        }));
+        output.data.resize(output.data.size() - block_size + decompressed.size());
+
+        if (decompressed.is_empty() && input_stream.used_buffer_size() == unread_input) {
+            if (finish == Finish::Yes)
+                return Error::from_string_literal("Compressed data ended unexpectedly");
+            break;
+        }
+    }
+    return output;
+}
+
 // https://compression.spec.whatwg.org/#dom-decompressionstream-decompressionstream
 WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::create(JS::Object& relevant_global_object, Decompressor decompressor, NonnullOwnPtr<AllocatingMemoryStream> input_stream)
 {
@@ -62,35 +100,40 @@ WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::create(JS
     // 5. Set this's transform to a new TransformStream.
     // NOTE: We do this first so that we may store it as nonnull in the GenericTransformStream.
     auto transform_stream = GC::Heap::the().allocate<Streams::TransformStream>();
-    auto stream = GC::Heap::the().allocate<DecompressionStream>(transform_stream, move(decompressor), move(input_stream));
+    auto stream = GC::Heap::the().allocate<DecompressionStream>(transform_stream);
+
+    // NB: This runs on a worker thread. It produces the buffer of the decompress and enqueue a chunk and decompress
+    //     flush and enqueue algorithms, and the steps that follow run on the JS thread once it is done.
+    auto decompress_on_worker = [decompressor = move(decompressor), input_stream = move(input_stream)](ReadonlyBytes bytes, Finish finish) mutable {
+        return decompress(decompressor, *input_stream, bytes, finish);
+    };
+    stream->m_codec_transform = CodecTransform::create(realm, transform_stream, CodecTransform::Operation::Decompress, move(decompress_on_worker));
 
     // 3. Let transformAlgorithm be an algorithm which takes a chunk argument and runs the decompress and enqueue a chunk
     //    algorithm with this and chunk.
-    auto transform_algorithm = GC::create_function(GC::Heap::the(), [stream, realm = GC::Ref(realm)](JS::Value chunk) -> GC::Ref<WebIDL::Promise> {
-        if (auto result = stream->decompress_and_enqueue_chunk(realm, chunk); result.is_error())
-            return WebIDL::create_rejected_promise_from_exception(realm, result.release_error());
-
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    auto transform_algorithm = GC::create_function(GC::Heap::the(), [stream](JS::Value chunk) -> GC::Ref<WebIDL::Promise> {
+        return stream->m_codec_transform->transform(chunk);
     });
 
     // 4. Let flushAlgorithm be an algorithm which takes no argument and runs the decompress flush and enqueue algorithm with this.
-    auto flush_algorithm = GC::create_function(GC::Heap::the(), [stream, realm = GC::Ref(realm)]() -> GC::Ref<WebIDL::Promise> {
-        if (auto result = stream->decompress_flush_and_enqueue(realm); result.is_error())
-            return WebIDL::create_rejected_promise_from_exception(realm, result.release_error());
+    auto flush_algorithm = GC::create_function(GC::Heap::the(), [stream]() -> GC::Ref<WebIDL::Promise> {
+        return stream->m_codec_transform->flush();
+    });
 
+    // NB: Cancelling the stream only needs to release the decompression context.
+    auto cancel_algorithm = GC::create_function(GC::Heap::the(), [stream, realm = GC::Ref(realm)](JS::Value) -> GC::Ref<WebIDL::Promise> {
+        stream->m_codec_transform->cancel();
         return WebIDL::create_resolved_promise(realm, JS::js_undefined());
     });
 
     // 6. Set up this's transform with transformAlgorithm set to transformAlgorithm and flushAlgorithm set to flushAlgorithm.
-    stream->m_transform->set_up(realm, transform_algorithm, flush_algorithm);
+    stream->m_transform->set_up(realm, transform_algorithm, flush_algorithm, cancel_algorithm);
 
     return stream;
 }
 
-DecompressionStream::DecompressionStream(GC::Ref<Streams::TransformStream> transform, Decompressor decompressor, NonnullOwnPtr<AllocatingMemoryStream> input_stream)
+DecompressionStream::DecompressionStream(GC::Ref<Streams::TransformStream> transform)
     : Streams::GenericTransformStreamMixin(transform)
-    , m_decompressor(move(decompressor))
-    , m_input_stream(move(input_stream))
 {
 }
 
@@ -100,72 +143,7 @@ void DecompressionStream::visit_edges(GC::Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     Streams::GenericTransformStreamMixin::visit_edges(visitor);
-}
-
-// https://compression.spec.whatwg.org/#decompress-and-enqueue-a-chunk
-WebIDL::ExceptionOr<void> DecompressionStream::decompress_and_enqueue_chunk(JS::Realm& realm, JS::Value chunk)
-{
-    // 1. If chunk is not a BufferSource type, then throw a TypeError.
-    if (!WebIDL::is_buffer_source_type(chunk))
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"_utf16 };
-
-    // 2. Let buffer be the result of decompressing chunk with ds's format and context. If this results in an error,
-    //    then throw a TypeError.
-    auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
-        auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
-        TRY(m_input_stream->write_until_depleted(move(chunk_buffer)));
-
-        auto decompressed = TRY(ByteBuffer::create_uninitialized(4096));
-        auto size = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<size_t> {
-            return TRY(decompressor->read_some(decompressed.bytes())).size();
-        }));
-        return decompressed.slice(0, size);
-    }();
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("Unable to decompress chunk: {}", maybe_buffer.error()) };
-
-    auto buffer = maybe_buffer.release_value();
-
-    // 3. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
-
-    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
-
-    // 5. For each Uint8Array array, enqueue array in ds's transform.
-    m_transform->enqueue(array);
-    return {};
-}
-
-// https://compression.spec.whatwg.org/#decompress-flush-and-enqueue
-WebIDL::ExceptionOr<void> DecompressionStream::decompress_flush_and_enqueue(JS::Realm& realm)
-{
-    // 1. Let buffer be the result of decompressing an empty input with ds's format and context, with the finish flag.
-    auto maybe_buffer = m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<ByteBuffer> {
-        return TRY(decompressor->read_until_eof());
-    });
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("Unable to decompress flush: {}", maybe_buffer.error()) };
-
-    auto buffer = maybe_buffer.release_value();
-
-    // Note: LibCompress already throws an error if we call read_until_eof and no more progress can be made
-    // 2. If the end of the compressed input has not been reached, then throw a TypeError.
-    VERIFY(m_decompressor.visit([](auto const& decompressor) { return decompressor->is_eof(); }));
-
-    // 3. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
-
-    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
-
-    // 5. For each Uint8Array array, enqueue array in ds's transform.
-    m_transform->enqueue(array);
-    return {};
+    visitor.visit(m_codec_transform);
 }
 
 }
@@ -13,6 +13,7 @@
 #include <LibGC/Ptr.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/Bindings/Wrappable.h>
+#include <LibWeb/Compression/CodecTransform.h>
 #include <LibWeb/Compression/CompressionStream.h>
 #include <LibWeb/Streams/GenericTransformStream.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -23,7 +24,8 @@ using Decompressor = Variant<
     NonnullOwnPtr<Compress::BrotliDecompressor>,
     NonnullOwnPtr<Compress::ZlibDecompressor>,
     NonnullOwnPtr<Compress::DeflateDecompressor>,
-    NonnullOwnPtr<Compress::GzipDecompressor>>;
+    NonnullOwnPtr<Compress::GzipDecompressor>,
+    NonnullOwnPtr<Compress::ZstdDecompressor>>;
 
 // https://compression.spec.whatwg.org/#decompressionstream
 class DecompressionStream final
@@ -38,15 +40,12 @@ public:
     virtual ~DecompressionStream() override;
 
 private:
-    DecompressionStream(GC::Ref<Streams::TransformStream>, Decompressor, NonnullOwnPtr<AllocatingMemoryStream>);
+    explicit DecompressionStream(GC::Ref<Streams::TransformStream>);
 
     virtual void visit_edges(GC::Cell::Visitor&) override;
 
-    WebIDL::ExceptionOr<void> decompress_and_enqueue_chunk(JS::Realm&, JS::Value);
-    WebIDL::ExceptionOr<void> decompress_flush_and_enqueue(JS::Realm&);
-
-    Decompressor m_decompressor;
-    NonnullOwnPtr<AllocatingMemoryStream> m_input_stream;
+    // NB: The decompression context lives on a worker thread, see CodecTransform.
+    GC::Ptr<CodecTransform> m_codec_transform;
 };
 
 }
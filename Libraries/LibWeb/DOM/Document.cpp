@@ -2195,6 +2195,8 @@ void Document::update_layout(UpdateLayoutReason reason)
         page().client().flush_pending_dom_mutations();
     };
 
+    PageLoadPhaseTimer timer { page(), PageLoadPhase::Layout };
+
     begin_style_stabilization_epoch();
     ScopeGuard end_stabilization_epoch = [&] {
         end_style_stabilization_epoch();
@@ -4846,6 +4848,7 @@ void Document::update_the_visibility_state(HTML::VisibilityState visibility_stat
 
     // 2. Set document's visibility state to visibilityState.
     m_visibility_state = visibility_state;
+    update_hidden_since();
 
     // FIXME: 3. Queue a new VisibilityStateEntry whose visibility state is visibilityState and whose timestamp is the current
     //    high resolution time given document's relevant global object.
@@ -4869,8 +4872,21 @@ void Document::update_the_visibility_state(HTML::VisibilityState visibility_stat
     event->set_bubbles(true);
     dispatch_event(event);
 
-    if (m_visibility_state == HTML::VisibilityState::Visible)
+    if (m_visibility_state == HTML::VisibilityState::Visible) {
         page().client().request_frame();
+
+        // AD-HOC: Timers were throttled while the document was hidden, let them run on their regular schedule again.
+        if (m_window)
+            m_window->reschedule_throttled_timers();
+    }
+}
+
+void Document::update_hidden_since()
+{
+    if (m_visibility_state == HTML::VisibilityState::Hidden)
+        m_hidden_since = MonotonicTime::now();
+    else
+        m_hidden_since.clear();
 }
 
 // https://drafts.csswg.org/cssom-view/#document-run-the-resize-steps
@@ -6355,6 +6371,7 @@ void Document::set_initial_visibility_state(HTML::VisibilityState visibility_sta
 {
     // 1. Set document's visibility state to visibility state.
     m_visibility_state = visibility_state;
+    update_hidden_since();
 
     // TODO: 2. Queue a new VisibilityStateEntry whose visibility state is document's visibility state and whose timestamp is 0.
 
@@ -7159,9 +7176,11 @@ void Document::remove_css_image_resource_if_unused(URL::URL const& url)
 
 void Document::prune_image_resource_caches()
 {
-    static constexpr size_t decoded_image_resource_cache_limit = 8 * MiB;
-    static constexpr size_t decoded_image_resource_cache_count_limit = 96;
+    (void)prune_image_resource_caches_to_limits(decoded_image_resource_cache_limit, decoded_image_resource_cache_count_limit);
+}
 
+size_t Document::prune_image_resource_caches_to_limits(size_t decoded_image_resource_cache_limit, size_t decoded_image_resource_cache_count_limit)
+{
     auto is_used_by_css_image_resource = [&](URL::URL const& url, HTML::SharedResourceRequest const& request) {
         auto* css_image_resource = this->css_image_resource(url);
         return css_image_resource && css_image_resource->decoded_image_data() == request.image_data();
@@ -7192,6 +7211,7 @@ void Document::prune_image_resource_caches()
     };
 
     auto size = cache_size();
+    auto initial_decoded_image_size = size.decoded_image_size;
     while (size.decoded_image_size > decoded_image_resource_cache_limit || size.decoded_image_count > decoded_image_resource_cache_count_limit) {
         Optional<URL::URL> least_recently_used_url;
         u64 least_recently_used_serial = NumericLimits<u64>::max();
@@ -7219,7 +7239,9 @@ void Document::prune_image_resource_caches()
         size = new_size;
     }
 
-    m_list_of_available_images->prune_to_limits(decoded_image_resource_cache_limit, decoded_image_resource_cache_count_limit);
+    auto pruned_size = initial_decoded_image_size - size.decoded_image_size;
+    pruned_size += m_list_of_available_images->prune_to_limits(decoded_image_resource_cache_limit, decoded_image_resource_cache_count_limit);
+    return pruned_size;
 }
 
 // https://www.w3.org/TR/web-animations-1/#dom-document-timeline
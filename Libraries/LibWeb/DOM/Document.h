@@ -18,6 +18,7 @@
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
+#include <AK/Time.h>
 #include <AK/Utf16FlyString.h>
 #include <AK/Utf16String.h>
 #include <AK/Utf16View.h>
@@ -745,6 +746,14 @@ public:
     Utf16FlyString visibility_state() const;
     HTML::VisibilityState visibility_state_value() const { return m_visibility_state; }
 
+    // The time at which the document's visibility state last became "hidden", while it remains hidden.
+    Optional<MonotonicTime> hidden_since() const { return m_hidden_since; }
+    void set_hidden_since_for_testing(MonotonicTime hidden_since)
+    {
+        if (m_hidden_since.has_value())
+            m_hidden_since = hidden_since;
+    }
+
     // https://html.spec.whatwg.org/multipage/interaction.html#update-the-visibility-state
     void update_the_visibility_state(HTML::VisibilityState);
 
@@ -990,8 +999,16 @@ public:
     CSS::ImageStyleValueResource const* css_image_resource(URL::URL const&) const;
     CSS::ImageStyleValueResource& create_css_image_resource(GC::Ref<HTML::SharedResourceRequest>);
     void remove_css_image_resource_if_unused(URL::URL const&);
+    // The decoded images that no element uses are kept around up to these limits.
+    static constexpr size_t decoded_image_resource_cache_limit = 8 * MiB;
+    static constexpr size_t decoded_image_resource_cache_count_limit = 96;
+
     void prune_image_resource_caches();
 
+    // Returns the size of the decoded images that were dropped from the caches. They are freed by the next garbage
+    // collection, unless something else still holds on to them.
+    size_t prune_image_resource_caches_to_limits(size_t external_memory_limit, size_t count_limit);
+
     void restore_the_history_object_state(NonnullRefPtr<HTML::SessionHistoryEntry> entry);
 
     GC::Ref<Animations::DocumentTimeline> timeline();
@@ -1443,6 +1460,7 @@ private:
     void process_pending_top_layer_layout_changes();
 
     void update_active_element();
+    void update_hidden_since();
     void collect_boxes_with_auto_content_visibility();
     bool needs_style_update_after_layout();
     bool any_anchor_names_are_registered() const;
@@ -1737,6 +1755,7 @@ private:
 
     // https://html.spec.whatwg.org/multipage/interaction.html#visibility-state
     HTML::VisibilityState m_visibility_state { HTML::VisibilityState::Hidden };
+    Optional<MonotonicTime> m_hidden_since;
 
     // https://html.spec.whatwg.org/multipage/dom.html#load-timing-info
     DocumentLoadTimingInfo m_load_timing_info;
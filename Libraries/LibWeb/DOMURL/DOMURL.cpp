@@ -462,7 +462,7 @@ Optional<URL::URL> parse_from_byte_string(StringView input, Optional<URL::URL co
                 [](GC::Ref<FileAPI::Blob> const& blob) -> URL::BlobURLEntry::Object {
                     return URL::BlobURLEntry::Blob {
                         .type = blob->type().to_utf8(),
-                        .data = MUST(ByteBuffer::copy(blob->raw_bytes())),
+                        .data = MUST(blob->data().copy_to_byte_buffer()),
                     };
                 },
                 [](GC::Ref<MediaSourceExtensions::MediaSource> const&) -> URL::BlobURLEntry::Object { return URL::BlobURLEntry::MediaSource {}; }),
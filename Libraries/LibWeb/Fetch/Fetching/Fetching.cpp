@@ -108,9 +108,22 @@ public:
         return cache;
     }
 
-    void clear_cache()
+    size_t clear_cache()
     {
+        size_t size = 0;
+        for (auto const& it : m_cache)
+            size += it.value->size_in_bytes();
+
         m_cache.clear();
+        return size;
+    }
+
+    size_t remove_stale_entries()
+    {
+        size_t size = 0;
+        for (auto const& it : m_cache)
+            size += it.value->remove_stale_entries();
+        return size;
     }
 
 private:
@@ -148,7 +161,8 @@ static GC::Ptr<Infrastructure::Response> select_response_from_cache(JS::Realm& r
     response->set_status_message(cache_entry->reason_phrase);
     response->set_header_list(cache_entry->response_headers);
     response->set_javascript_bytecode_cache(cache_entry->javascript_bytecode_cache);
-    response->set_javascript_bytecode_cache_vary_key(cache_entry->javascript_bytecode_cache_vary_key);
+    response->set_css_parsed_rules_cache(cache_entry->css_parsed_rules_cache);
+    response->set_disk_cache_vary_key(cache_entry->disk_cache_vary_key);
     response->set_javascript_bytecode_cache_memory_cache_request_headers(HTTP::HeaderList::create(cache_entry->request_headers->headers()));
 
     auto [response_body, _] = safely_extract_body(realm, cache_entry->response_body.bytes());
@@ -165,7 +179,7 @@ static void store_response_in_cache(HTTP::MemoryCache& http_cache, Infrastructur
         return;
 
     response.set_javascript_bytecode_cache_memory_cache_request_headers(HTTP::HeaderList::create(request.header_list()->headers()));
-    http_cache.create_entry(request.current_url(), request.method(), request.header_list(), request.request_time(), response.status(), response.status_message(), response.header_list(), response.javascript_bytecode_cache(), response.javascript_bytecode_cache_vary_key());
+    http_cache.create_entry(request.current_url(), request.method(), request.header_list(), request.request_time(), response.status(), response.status_message(), response.header_list(), response.javascript_bytecode_cache(), response.css_parsed_rules_cache(), response.disk_cache_vary_key());
 }
 
 // https://fetch.spec.whatwg.org/#concept-fetch
@@ -1077,7 +1091,7 @@ GC::Ref<PendingResponse> scheme_fetch(JS::Realm& realm, Infrastructure::FetchPar
         // 13. If request’s header list does not contain `Range`:
         if (!request->header_list()->contains("Range"sv)) {
             // 1. Let bodyWithType be the result of safely extracting blob.
-            auto body_with_type = safely_extract_body(realm, blob->raw_bytes());
+            auto body_with_type = safely_extract_body(realm, blob);
 
             // 2. Set response’s status message to `OK`.
             response->set_status_message("OK"sv);
@@ -1135,7 +1149,7 @@ GC::Ref<PendingResponse> scheme_fetch(JS::Realm& realm, Infrastructure::FetchPar
             auto sliced_blob = MUST(blob->slice_blob(*range_start, *range_end + 1, type));
 
             // 9. Let slicedBodyWithType be the result of safely extracting slicedBlob.
-            auto sliced_body_with_type = safely_extract_body(realm, sliced_blob->raw_bytes());
+            auto sliced_body_with_type = safely_extract_body(realm, sliced_blob);
 
             // 10. Set response’s body to slicedBodyWithType’s body.
             response->set_body(sliced_body_with_type.body);
@@ -2194,7 +2208,7 @@ GC::Ref<PendingResponse> nonstandard_resource_loader_file_or_http_network_fetch(
                 load_request.set_body(MUST(bytes.copy_to_byte_buffer()));
             },
             [&](GC::Ref<FileAPI::Blob> const& blob) {
-                load_request.set_body(MUST(ByteBuffer::copy(blob->raw_bytes())));
+                load_request.set_body(MUST(blob->data().copy_to_byte_buffer()));
             },
             [](Empty) {
             });
@@ -2239,7 +2253,7 @@ GC::Ref<PendingResponse> nonstandard_resource_loader_file_or_http_network_fetch(
     // 13. Set up stream with byte reading support with pullAlgorithm set to pullAlgorithm, cancelAlgorithm set to cancelAlgorithm.
     stream->set_up_with_byte_reading_support(realm, pull_algorithm, cancel_algorithm);
 
-    auto on_headers_received = GC::create_function(GC::Heap::the(), [pending_response, stream, request, fetched_data_receiver](Requests::Request* request_server_request, HTTP::HeaderList const& response_headers, Optional<u32> status_code, Optional<String> const& reason_phrase, Optional<Core::ImmutableBytes> javascript_bytecode, Optional<u64> javascript_bytecode_cache_vary_key, Requests::CameFromCache) {
+    auto on_headers_received = GC::create_function(GC::Heap::the(), [pending_response, stream, request, fetched_data_receiver](Requests::Request* request_server_request, HTTP::HeaderList const& response_headers, Optional<u32> status_code, Optional<String> const& reason_phrase, Optional<Requests::CachedAssociatedData> associated_data, Optional<u64> disk_cache_vary_key, Requests::CameFromCache) {
         if (pending_response->is_resolved()) {
             // RequestServer will send us the response headers twice, the second time being for HTTP trailers. This
             // fetch algorithm is not interested in trailers, so just drop them here.
@@ -2251,8 +2265,27 @@ GC::Ref<PendingResponse> nonstandard_resource_loader_file_or_http_network_fetch(
 
         if (reason_phrase.has_value())
             response->set_status_message(reason_phrase->to_byte_string());
-        response->set_javascript_bytecode_cache(move(javascript_bytecode));
-        response->set_javascript_bytecode_cache_vary_key(javascript_bytecode_cache_vary_key);
+        if (associated_data.has_value()) {
+            switch (associated_data->type) {
+            case HTTP::CacheEntryAssociatedData::JavaScriptBytecode:
+                if (auto* data = associated_data->data.get_pointer<Core::ImmutableBytes>())
+                    response->set_javascript_bytecode_cache(move(*data));
+                break;
+            case HTTP::CacheEntryAssociatedData::CSSParsedRules:
+                if (auto* data = associated_data->data.get_pointer<Core::ImmutableBytes>())
+                    response->set_css_parsed_rules_cache(move(*data));
+                break;
+            case HTTP::CacheEntryAssociatedData::DecodedFont:
+                // NB: Decoded fonts are not kept in the HTTP memory cache, which would keep them mapped for as long as
+                //     the compressed font is cached. A font that is served from the memory cache is decoded again.
+                if (auto* data = associated_data->data.get_pointer<Core::AnonymousBuffer>())
+                    response->set_decoded_font_cache(move(*data));
+                break;
+            case HTTP::CacheEntryAssociatedData::WebAssemblyCompiledCode:
+                break;
+            }
+        }
+        response->set_disk_cache_vary_key(disk_cache_vary_key);
         if (request_server_request) {
             response->set_request_server_request({
                 .client_id = request_server_request->request_server_client_id(),
@@ -2642,9 +2675,14 @@ bool http_memory_cache_enabled()
     return g_http_memory_cache_enabled;
 }
 
-void clear_http_memory_cache()
+size_t clear_http_memory_cache()
+{
+    return HTTPCache::the().clear_cache();
+}
+
+size_t remove_stale_entries_from_http_memory_cache()
 {
-    HTTPCache::the().clear_cache();
+    return HTTPCache::the().remove_stale_entries();
 }
 
 void update_javascript_bytecode_cache_in_http_memory_cache(Infrastructure::NetworkPartitionKey const& partition_key, URL::URL const& url, ByteString const& method, HTTP::HeaderList const& request_headers, u64 vary_key, Core::ImmutableBytes javascript_bytecode_cache)
@@ -101,8 +101,9 @@ Optional<ReadonlyBytes> Body::sniff_bytes_if_available() const
     }
 
     if (m_source.has<GC::Ref<FileAPI::Blob>>()) {
-        auto raw = m_source.get<GC::Ref<FileAPI::Blob>>()->raw_bytes();
-        return raw.slice(0, min(raw.size(), MAX_SNIFF_BYTES));
+        if (!m_blob_sniff_bytes.has_value())
+            m_blob_sniff_bytes = m_source.get<GC::Ref<FileAPI::Blob>>()->data().leading_bytes(MAX_SNIFF_BYTES).release_value_but_fixme_should_propagate_errors();
+        return m_blob_sniff_bytes->bytes();
     }
 
     // Streaming body: bytes captured during fetch
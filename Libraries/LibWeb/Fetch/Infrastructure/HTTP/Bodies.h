@@ -94,6 +94,9 @@ private:
     // Non-standard: Captured "resource header" bytes for MIME type sniffing.
     ByteBuffer m_sniff_bytes;
     bool m_sniff_bytes_complete { false };
+
+    // NB: The leading bytes of a Blob source may have been copied out of several of its chunks, so they are kept here.
+    mutable Optional<FileAPI::BlobData::Chunk> m_blob_sniff_bytes;
     GC::Ptr<GC::Function<void(ReadonlyBytes)>> m_sniff_bytes_callback;
 };
 
@@ -211,7 +211,9 @@ GC::Ref<Response> Response::clone(JS::Realm& realm) const
     new_response->set_timing_allow_passed(m_timing_allow_passed);
     new_response->set_body_info(m_body_info);
     new_response->set_javascript_bytecode_cache(m_javascript_bytecode_cache);
-    new_response->set_javascript_bytecode_cache_vary_key(m_javascript_bytecode_cache_vary_key);
+    new_response->set_css_parsed_rules_cache(m_css_parsed_rules_cache);
+    new_response->set_decoded_font_cache(m_decoded_font_cache);
+    new_response->set_disk_cache_vary_key(m_disk_cache_vary_key);
     if (m_request_server_request.has_value())
         new_response->set_request_server_request(*m_request_server_request);
     if (m_javascript_bytecode_cache_memory_cache_request_headers.has_value())
@@ -13,6 +13,7 @@
 #include <AK/Time.h>
 #include <AK/Utf16String.h>
 #include <AK/Vector.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibCore/ImmutableBytes.h>
 #include <LibGC/Ptr.h>
 #include <LibHTTP/HeaderList.h>
@@ -120,8 +121,12 @@ public:
 
     [[nodiscard]] Optional<Core::ImmutableBytes> const& javascript_bytecode_cache() const { return m_javascript_bytecode_cache; }
     void set_javascript_bytecode_cache(Optional<Core::ImmutableBytes> javascript_bytecode_cache) { m_javascript_bytecode_cache = move(javascript_bytecode_cache); }
-    [[nodiscard]] Optional<u64> javascript_bytecode_cache_vary_key() const { return m_javascript_bytecode_cache_vary_key; }
-    void set_javascript_bytecode_cache_vary_key(Optional<u64> javascript_bytecode_cache_vary_key) { m_javascript_bytecode_cache_vary_key = javascript_bytecode_cache_vary_key; }
+    [[nodiscard]] Optional<Core::ImmutableBytes> const& css_parsed_rules_cache() const { return m_css_parsed_rules_cache; }
+    void set_css_parsed_rules_cache(Optional<Core::ImmutableBytes> css_parsed_rules_cache) { m_css_parsed_rules_cache = move(css_parsed_rules_cache); }
+    [[nodiscard]] Optional<Core::AnonymousBuffer> const& decoded_font_cache() const { return m_decoded_font_cache; }
+    void set_decoded_font_cache(Optional<Core::AnonymousBuffer> decoded_font_cache) { m_decoded_font_cache = move(decoded_font_cache); }
+    [[nodiscard]] Optional<u64> disk_cache_vary_key() const { return m_disk_cache_vary_key; }
+    void set_disk_cache_vary_key(Optional<u64> disk_cache_vary_key) { m_disk_cache_vary_key = disk_cache_vary_key; }
     [[nodiscard]] Optional<NonnullRefPtr<HTTP::HeaderList>> const& javascript_bytecode_cache_memory_cache_request_headers() const { return m_javascript_bytecode_cache_memory_cache_request_headers; }
     void set_javascript_bytecode_cache_memory_cache_request_headers(Optional<NonnullRefPtr<HTTP::HeaderList>> request_headers) { m_javascript_bytecode_cache_memory_cache_request_headers = move(request_headers); }
 
@@ -221,7 +226,9 @@ private:
 
     Optional<String> m_network_error_message;
     Optional<Core::ImmutableBytes> m_javascript_bytecode_cache;
-    Optional<u64> m_javascript_bytecode_cache_vary_key;
+    Optional<Core::ImmutableBytes> m_css_parsed_rules_cache;
+    Optional<Core::AnonymousBuffer> m_decoded_font_cache;
+    Optional<u64> m_disk_cache_vary_key;
     Optional<NonnullRefPtr<HTTP::HeaderList>> m_javascript_bytecode_cache_memory_cache_request_headers;
     Optional<RequestServerRequest> m_request_server_request;
 
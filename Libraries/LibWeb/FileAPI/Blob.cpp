@@ -29,9 +29,17 @@ namespace Web::FileAPI {
 
 GC_DEFINE_ALLOCATOR(Blob);
 
+// Large blobs are streamed in pieces of at most this size, so that reading them never needs one huge ArrayBuffer.
+static constexpr size_t max_stream_chunk_size = 1 * MiB;
+
 GC::Ref<Blob> Blob::create(ByteBuffer byte_buffer, Utf16String type)
 {
-    return GC::Heap::the().allocate<Blob>(move(byte_buffer), move(type));
+    return create(BlobData::create(move(byte_buffer)), move(type));
+}
+
+GC::Ref<Blob> Blob::create(BlobData data, Utf16String type)
+{
+    return GC::Heap::the().allocate<Blob>(move(data), move(type));
 }
 
 // https://w3c.github.io/FileAPI/#convert-line-endings-to-native
@@ -90,10 +98,18 @@ ErrorOr<Utf16String> convert_line_endings_to_native(Utf16View string)
 }
 
 // https://w3c.github.io/FileAPI/#process-blob-parts
-ErrorOr<ByteBuffer> process_blob_parts(BlobParts const& blob_parts, Optional<BlobPropertyBag> const& options)
+ErrorOr<BlobData> process_blob_parts(BlobParts const& blob_parts, Optional<BlobPropertyBag> const& options)
 {
     // 1. Let bytes be an empty sequence of bytes.
-    ByteBuffer bytes {};
+    BlobData bytes {};
+
+    // NOTE: Consecutive strings and buffer sources are gathered into one chunk, while blobs contribute their chunks as-is.
+    ByteBuffer pending_bytes {};
+    auto flush_pending_bytes = [&]() -> ErrorOr<void> {
+        if (pending_bytes.is_empty())
+            return {};
+        return bytes.append(move(pending_bytes));
+    };
 
     // 2. For each element in parts:
     for (auto const& blob_part : blob_parts) {
@@ -109,18 +125,25 @@ ErrorOr<ByteBuffer> process_blob_parts(BlobParts const& blob_parts, Optional<Blo
 
                 // 3. Append the result of UTF-8 encoding s to bytes.
                 auto encoded_string = TRY(s.to_utf8());
-                return bytes.try_append(encoded_string.bytes());
+                return pending_bytes.try_append(encoded_string.bytes());
             },
             // 2. If element is a BufferSource, get a copy of the bytes held by the buffer source, and append those bytes to bytes.
             [&](WebIDL::BufferSourceVariant buffer_source) -> ErrorOr<void> {
                 auto data_buffer = TRY(WebIDL::get_buffer_source_copy(buffer_source));
-                return bytes.try_append(data_buffer.bytes());
+                if (pending_bytes.is_empty()) {
+                    pending_bytes = move(data_buffer);
+                    return {};
+                }
+                return pending_bytes.try_append(data_buffer.bytes());
             },
             // 3. If element is a Blob, append the bytes it represents to bytes.
             [&](GC::Ref<Blob> const& blob) -> ErrorOr<void> {
-                return bytes.try_append(blob->raw_bytes());
+                TRY(flush_pending_bytes());
+                return bytes.append(blob->data());
             }));
     }
+    TRY(flush_pending_bytes());
+
     // 3. Return bytes.
     return bytes;
 }
@@ -138,14 +161,14 @@ Blob::Blob()
 {
 }
 
-Blob::Blob(ByteBuffer byte_buffer, Utf16String type)
-    : m_byte_buffer(move(byte_buffer))
+Blob::Blob(BlobData data, Utf16String type)
+    : m_data(move(data))
     , m_type(move(type))
 {
 }
 
-Blob::Blob(ByteBuffer byte_buffer)
-    : m_byte_buffer(move(byte_buffer))
+Blob::Blob(BlobData data)
+    : m_data(move(data))
 {
 }
 
@@ -160,7 +183,7 @@ WebIDL::ExceptionOr<void> Blob::serialization_steps(HTML::StructuredSerializeWri
     serialized.encode(m_type);
 
     // 2. Set serialized.[[ByteSequence]] to value’s underlying byte sequence.
-    serialized.encode(m_byte_buffer);
+    serialized.encode_gathered_bytes(TRY_OR_THROW_OOM(JS::VM::the(), m_data.chunk_bytes()));
 
     return {};
 }
@@ -174,7 +197,7 @@ WebIDL::ExceptionOr<void> Blob::deserialization_steps(JS::Realm& realm, HTML::St
     m_type = TRY(HTML::decode_or_throw_data_clone_error<Utf16String>(realm, serialized));
 
     // 2. Set value’s underlying byte sequence to serialized.[[ByteSequence]].
-    m_byte_buffer = TRY(HTML::decode_or_throw_data_clone_error<ByteBuffer>(realm, serialized));
+    m_data = BlobData::create(TRY(HTML::decode_or_throw_data_clone_error<ByteBuffer>(realm, serialized)));
 
     return {};
 }
@@ -186,15 +209,15 @@ GC::Ref<Blob> Blob::create(Optional<BlobPartsOrByteBuffer> const& blob_parts_or_
     if (!blob_parts_or_byte_buffer.has_value() && !options.has_value())
         return GC::Heap::the().allocate<Blob>();
 
-    ByteBuffer byte_buffer {};
+    BlobData data {};
     // 2. Let bytes be the result of processing blob parts given blobParts and options.
     if (blob_parts_or_byte_buffer.has_value()) {
-        byte_buffer = blob_parts_or_byte_buffer->visit(
+        data = blob_parts_or_byte_buffer->visit(
             [&](BlobParts const& blob_parts) {
                 return MUST(process_blob_parts(blob_parts, options));
             },
             [](ByteBuffer const& byte_buffer) {
-                return byte_buffer;
+                return BlobData::create(byte_buffer);
             });
     }
 
@@ -214,7 +237,7 @@ GC::Ref<Blob> Blob::create(Optional<BlobPartsOrByteBuffer> const& blob_parts_or_
     }
 
     // 4. Return a Blob object referring to bytes as its associated byte sequence, with its size set to the length of bytes, and its type set to the value of t from the substeps above.
-    return GC::Heap::the().allocate<Blob>(move(byte_buffer), move(type));
+    return GC::Heap::the().allocate<Blob>(move(data), move(type));
 }
 
 WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::construct_impl(Optional<BlobParts> const& blob_parts, Optional<BlobPropertyBag> const& options)
@@ -305,8 +328,8 @@ ErrorOr<GC::Ref<Blob>> Blob::slice_blob(Optional<i64> start, Optional<i64> end,
     // a. S refers to span consecutive bytes from blob’s associated byte sequence, beginning with the byte at byte-order position relativeStart.
     // b. S.size = span.
     // c. S.type = relativeContentType.
-    auto byte_buffer = TRY(m_byte_buffer.slice(relative_start, span));
-    return create(move(byte_buffer), move(relative_content_type));
+    auto data = TRY(m_data.slice(relative_start, span));
+    return create(move(data), move(relative_content_type));
 }
 
 // https://w3c.github.io/FileAPI/#dom-blob-stream
@@ -327,37 +350,55 @@ GC::Ref<Streams::ReadableStream> Blob::get_stream(JS::Realm& realm)
 
     // FIXME: 3. Run the following steps in parallel:
     {
-        // 1. While not all bytes of blob have been read:
-        //    NOTE: for simplicity the chunk is the entire buffer for now.
-        {
-            // 1. Let bytes be the byte sequence that results from reading a chunk from blob, or failure if a chunk cannot be read.
-            auto bytes = m_byte_buffer;
-
-            // 2. Queue a global task on the file reading task source given blob’s relevant global object to perform the following steps:
-            HTML::queue_global_task(HTML::Task::Source::FileReading, realm.global_object(), GC::create_function(GC::Heap::the(), [&realm, stream, bytes = move(bytes)]() {
-                HTML::TemporaryExecutionContext const execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
-
-                // 1. If bytes is failure, then error stream with a failure reason and abort these steps.
-                // 2. Let chunk be a new Uint8Array wrapping an ArrayBuffer containing bytes. If creating the ArrayBuffer throws an exception, then error stream with that exception and abort these steps.
-                auto array_buffer = JS::ArrayBuffer::create(realm, bytes);
-                auto chunk = JS::Uint8Array::create(realm, bytes.size(), *array_buffer);
-
-                // 3. Enqueue chunk in stream.
-                auto maybe_error = WebIDL::throw_dom_exception_if_needed(realm.vm(), realm, [&]() {
-                    return stream->enqueue(chunk);
-                });
-
-                if (maybe_error.is_error()) {
-                    Streams::readable_stream_error(*stream, maybe_error.release_error().value());
-                    return;
+        // NOTE: The blob's chunks are shared rather than copied here, and each one is read as it is enqueued.
+        //       Chunks larger than max_stream_chunk_size are read in several pieces.
+        HTML::queue_global_task(HTML::Task::Source::FileReading, realm.global_object(), GC::create_function(GC::Heap::the(), [&realm, stream, data = m_data]() {
+            HTML::TemporaryExecutionContext const execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+
+            // 1. While not all bytes of blob have been read:
+            bool failed = false;
+            data.for_each_chunk([&](ReadonlyBytes blob_chunk) {
+                for (size_t offset = 0; offset < blob_chunk.size(); offset += max_stream_chunk_size) {
+                    // 1. Let bytes be the byte sequence that results from reading a chunk from blob, or failure if a chunk cannot be read.
+                    auto bytes = blob_chunk.slice(offset, min(max_stream_chunk_size, blob_chunk.size() - offset));
+
+                    // 2. Queue a global task on the file reading task source given blob’s relevant global object to perform the following steps:
+                    //    NOTE: All chunks are enqueued from the one task queued above.
+
+                    // 1. If bytes is failure, then error stream with a failure reason and abort these steps.
+                    // 2. Let chunk be a new Uint8Array wrapping an ArrayBuffer containing bytes. If creating the ArrayBuffer throws an exception, then error stream with that exception and abort these steps.
+                    auto array_buffer_or_error = JS::ArrayBuffer::create(realm, bytes.size());
+                    if (array_buffer_or_error.is_error()) {
+                        Streams::readable_stream_error(*stream, array_buffer_or_error.release_error().value());
+                        failed = true;
+                        return IterationDecision::Break;
+                    }
+                    auto array_buffer = array_buffer_or_error.release_value();
+                    array_buffer->overwrite(0, bytes.data(), bytes.size());
+
+                    // 3. Enqueue chunk in stream.
+                    auto chunk = JS::Uint8Array::create(realm, bytes.size(), *array_buffer);
+                    auto maybe_error = WebIDL::throw_dom_exception_if_needed(realm.vm(), realm, [&]() {
+                        return stream->enqueue(chunk);
+                    });
+
+                    if (maybe_error.is_error()) {
+                        Streams::readable_stream_error(*stream, maybe_error.release_error().value());
+                        failed = true;
+                        return IterationDecision::Break;
+                    }
                 }
+                return IterationDecision::Continue;
+            });
 
-                // FIXME: Spec bug: https://github.com/w3c/FileAPI/issues/206
-                //
-                // We need to close the stream so that the stream will finish reading.
-                stream->close();
-            }));
-        }
+            if (failed)
+                return;
+
+            // FIXME: Spec bug: https://github.com/w3c/FileAPI/issues/206
+            //
+            // We need to close the stream so that the stream will finish reading.
+            stream->close();
+        }));
     }
 
     // 4. Return stream.
@@ -13,6 +13,7 @@
 #include <LibWeb/Bindings/Serializable.h>
 #include <LibWeb/Bindings/Wrappable.h>
 #include <LibWeb/Export.h>
+#include <LibWeb/FileAPI/BlobData.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/WebIDL/Buffers.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -26,7 +27,7 @@ using EndingType = Bindings::EndingType;
 using BlobPropertyBag = Bindings::BlobPropertyBag;
 
 [[nodiscard]] ErrorOr<Utf16String> convert_line_endings_to_native(Utf16View string);
-[[nodiscard]] ErrorOr<ByteBuffer> process_blob_parts(BlobParts const& blob_parts, Optional<BlobPropertyBag> const& options = {});
+[[nodiscard]] ErrorOr<BlobData> process_blob_parts(BlobParts const& blob_parts, Optional<BlobPropertyBag> const& options = {});
 [[nodiscard]] bool is_basic_latin(Utf16View view);
 
 class WEB_API Blob
@@ -39,12 +40,13 @@ public:
     virtual ~Blob() override;
 
     [[nodiscard]] static GC::Ref<Blob> create(ByteBuffer, Utf16String type);
+    [[nodiscard]] static GC::Ref<Blob> create(BlobData, Utf16String type);
     [[nodiscard]] static GC::Ref<Blob> create(ByteBuffer bytes, String type) { return create(move(bytes), Utf16String::from_utf8(type)); }
     [[nodiscard]] static GC::Ref<Blob> create(Optional<BlobPartsOrByteBuffer> const& blob_parts_or_byte_buffer = {}, Optional<BlobPropertyBag> const& options = {});
     [[nodiscard]] static WebIDL::ExceptionOr<GC::Ref<Blob>> construct_impl(Optional<BlobParts> const& blob_parts, Optional<BlobPropertyBag> const& options);
 
     // https://w3c.github.io/FileAPI/#dfn-size
-    u64 size() const { return m_byte_buffer.size(); }
+    u64 size() const { return m_data.size(); }
     // https://w3c.github.io/FileAPI/#dfn-type
     Utf16String const& type() const { return m_type; }
 
@@ -55,7 +57,8 @@ public:
     GC::Ref<WebIDL::Promise> text(JS::Object const& relevant_global_object);
     GC::Ref<WebIDL::Promise> array_buffer(JS::Object const& relevant_global_object);
     GC::Ref<WebIDL::Promise> bytes(JS::Object const& relevant_global_object);
-    ReadonlyBytes raw_bytes() const LIFETIME_BOUND { return m_byte_buffer.bytes(); }
+    ErrorOr<BlobData::Chunk> raw_bytes() const { return m_data.contiguous_bytes(); }
+    BlobData const& data() const { return m_data; }
 
     GC::Ref<Streams::ReadableStream> get_stream(JS::Realm&);
 
@@ -63,10 +66,10 @@ public:
     virtual WebIDL::ExceptionOr<void> deserialization_steps(JS::Realm&, HTML::StructuredSerializeReader&, HTML::DeserializationMemory&) override;
 
 protected:
-    Blob(ByteBuffer, Utf16String type);
-    Blob(ByteBuffer);
+    Blob(BlobData, Utf16String type);
+    Blob(BlobData);
 
-    ByteBuffer m_byte_buffer {};
+    BlobData m_data {};
     Utf16String m_type {};
 
 private:
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/ScopeGuard.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
+#include <LibWeb/FileAPI/BlobData.h>
+
+namespace Web::FileAPI {
+
+static ErrorOr<Core::ImmutableBytes> store_in_temporary_file(ReadonlyBytes bytes)
+{
+    auto pattern = ByteString::formatted("{}/ladybird-blob-XXXXXX", Core::StandardPaths::tempfile_directory());
+    auto path_buffer = TRY(ByteBuffer::copy(pattern.bytes()));
+    TRY(path_buffer.try_append('\0'));
+
+    auto fd = TRY(Core::System::mkstemp(Span<char> { reinterpret_cast<char*>(path_buffer.data()), path_buffer.size() }));
+    auto close_fd = ArmedScopeGuard([&] { (void)Core::System::close(fd); });
+
+    // The file only needs to live as long as our mapping of it.
+    StringView path { path_buffer.data(), path_buffer.size() - 1 };
+    TRY(Core::System::unlink(path));
+
+    for (auto remaining = bytes; !remaining.is_empty();)
+        remaining = remaining.slice(TRY(Core::System::write(fd, remaining)));
+
+    close_fd.disarm();
+    return Core::ImmutableBytes::map_from_fd_range_and_close(fd, path, 0, bytes.size());
+}
+
+Core::ImmutableBytes BlobData::store(ByteBuffer bytes)
+{
+    // NOTE: Falling back to keeping the bytes where they are is always possible, so storing never fails.
+    if (bytes.size() >= temporary_file_threshold) {
+        if (auto stored = store_in_temporary_file(bytes); !stored.is_error())
+            return stored.release_value();
+    }
+    if (bytes.size() >= readonly_mapping_threshold) {
+        if (auto stored = Core::ImmutableBytes::copy_to_readonly_mapping(bytes); !stored.is_error())
+            return stored.release_value();
+    }
+    return Core::ImmutableBytes::adopt(move(bytes));
+}
+
+BlobData BlobData::create(ByteBuffer bytes)
+{
+    BlobData data;
+    MUST(data.append(move(bytes)));
+    return data;
+}
+
+ErrorOr<void> BlobData::append_chunk(Chunk chunk)
+{
+    if (chunk.m_length == 0)
+        return {};
+    m_size += chunk.m_length;
+    return m_chunks.try_append(move(chunk));
+}
+
+ErrorOr<void> BlobData::append(BlobData const& other)
+{
+    TRY(m_chunks.try_ensure_capacity(m_chunks.size() + other.m_chunks.size()));
+    for (auto const& chunk : other.m_chunks)
+        TRY(append_chunk(chunk));
+    return {};
+}
+
+ErrorOr<void> BlobData::append(ByteBuffer bytes)
+{
+    auto length = bytes.size();
+    return append_chunk({ store(move(bytes)), 0, length });
+}
+
+ErrorOr<BlobData> BlobData::slice(u64 start, u64 length) const
+{
+    VERIFY(start + length <= m_size);
+
+    BlobData result;
+    u64 chunk_start = 0;
+    for (auto const& chunk : m_chunks) {
+        if (length == 0)
+            break;
+
+        u64 chunk_end = chunk_start + chunk.m_length;
+        if (start < chunk_end) {
+            auto offset_in_chunk = static_cast<size_t>(start - chunk_start);
+            auto length_in_chunk = static_cast<size_t>(min<u64>(length, chunk.m_length - offset_in_chunk));
+            TRY(result.append_chunk({ chunk.m_storage, chunk.m_offset + offset_in_chunk, length_in_chunk }));
+            start += length_in_chunk;
+            length -= length_in_chunk;
+        }
+        chunk_start = chunk_end;
+    }
+    return result;
+}
+
+ErrorOr<BlobData::Chunk> BlobData::contiguous_bytes() const
+{
+    if (m_chunks.is_empty())
+        return Chunk { {}, 0, 0 };
+    if (m_chunks.size() == 1)
+        return m_chunks.first();
+
+    // NB: The blob itself is left alone, so views handed out from its chunks stay valid.
+    auto merged = TRY(copy_to_byte_buffer());
+    return Chunk { store(move(merged)), 0, static_cast<size_t>(m_size) };
+}
+
+ErrorOr<BlobData::Chunk> BlobData::leading_bytes(size_t count) const
+{
+    count = min<u64>(count, m_size);
+    if (count == 0)
+        return Chunk { {}, 0, 0 };
+
+    auto const& first_chunk = m_chunks.first();
+    if (first_chunk.m_length >= count)
+        return Chunk { first_chunk.m_storage, first_chunk.m_offset, count };
+
+    auto buffer = TRY(ByteBuffer::create_uninitialized(count));
+    size_t offset = 0;
+    for_each_chunk([&](ReadonlyBytes chunk) {
+        offset += chunk.trim(count - offset).copy_to(buffer.bytes().slice(offset));
+        return offset == count ? IterationDecision::Break : IterationDecision::Continue;
+    });
+    return Chunk { Core::ImmutableBytes::adopt(move(buffer)), 0, count };
+}
+
+ErrorOr<ByteBuffer> BlobData::copy_to_byte_buffer() const
+{
+    auto buffer = TRY(ByteBuffer::create_uninitialized(m_size));
+    size_t offset = 0;
+    for (auto const& chunk : m_chunks) {
+        auto bytes = chunk.bytes();
+        bytes.copy_to(buffer.bytes().slice(offset));
+        offset += bytes.size();
+    }
+    return buffer;
+}
+
+ErrorOr<Vector<ReadonlyBytes, 1>> BlobData::chunk_bytes() const
+{
+    Vector<ReadonlyBytes, 1> chunks;
+    TRY(chunks.try_ensure_capacity(m_chunks.size()));
+    for (auto const& chunk : m_chunks)
+        chunks.unchecked_append(chunk.bytes());
+    return chunks;
+}
+
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/IterationDecision.h>
+#include <AK/Vector.h>
+#include <LibCore/ImmutableBytes.h>
+#include <LibWeb/Export.h>
+
+namespace Web::FileAPI {
+
+// The byte sequence of a Blob. It is made of immutable, shared chunks, so building a blob out of other blobs or slicing
+// one only references the existing chunks instead of copying their bytes. Large chunks are kept outside the malloc
+// heap, in a read-only anonymous mapping or, past a further threshold, in an unlinked temporary file.
+class WEB_API BlobData {
+public:
+    static constexpr size_t readonly_mapping_threshold = 1 * MiB;
+    static constexpr size_t temporary_file_threshold = 64 * MiB;
+
+    // A contiguous run of a blob's bytes. It holds a reference to the storage it points into, so its bytes stay valid
+    // for as long as it is kept around, independently of the blob it came from.
+    class Chunk {
+    public:
+        ReadonlyBytes bytes() const LIFETIME_BOUND { return m_storage.bytes().slice(m_offset, m_length); }
+        size_t size() const { return m_length; }
+
+    private:
+        friend class BlobData;
+
+        Chunk(Core::ImmutableBytes storage, size_t offset, size_t length)
+            : m_storage(move(storage))
+            , m_offset(offset)
+            , m_length(length)
+        {
+        }
+
+        Core::ImmutableBytes m_storage;
+        size_t m_offset { 0 };
+        size_t m_length { 0 };
+    };
+
+    static BlobData create(ByteBuffer);
+
+    BlobData() = default;
+
+    u64 size() const { return m_size; }
+    bool is_empty() const { return m_size == 0; }
+    size_t chunk_count() const { return m_chunks.size(); }
+
+    ErrorOr<void> append(BlobData const&);
+    ErrorOr<void> append(ByteBuffer);
+
+    // Returns a view of the given range that shares this blob's chunks.
+    ErrorOr<BlobData> slice(u64 start, u64 length) const;
+
+    // Returns the bytes as one contiguous chunk. If they are spread over several chunks, the returned chunk owns a copy
+    // of them; callers that can work on the chunks one at a time should use for_each_chunk() instead.
+    ErrorOr<Chunk> contiguous_bytes() const;
+
+    // Returns up to the given number of bytes from the start of the blob. Only those bytes are copied, and only if the
+    // first chunk does not hold all of them.
+    ErrorOr<Chunk> leading_bytes(size_t) const;
+
+    ErrorOr<ByteBuffer> copy_to_byte_buffer() const;
+
+    // Returns views of the chunks, in order. They stay valid for as long as this blob does.
+    ErrorOr<Vector<ReadonlyBytes, 1>> chunk_bytes() const LIFETIME_BOUND;
+
+    template<typename Callback>
+    void for_each_chunk(Callback callback) const
+    {
+        for (auto const& chunk : m_chunks) {
+            if (callback(chunk.bytes()) == IterationDecision::Break)
+                return;
+        }
+    }
+
+private:
+    static Core::ImmutableBytes store(ByteBuffer);
+
+    ErrorOr<void> append_chunk(Chunk);
+
+    Vector<Chunk, 1> m_chunks;
+    u64 m_size { 0 };
+};
+
+}
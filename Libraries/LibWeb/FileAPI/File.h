@@ -34,7 +34,7 @@ public:
     virtual WebIDL::ExceptionOr<void> deserialization_steps(JS::Realm&, HTML::StructuredSerializeReader&, HTML::DeserializationMemory&) override;
 
 private:
-    File(ByteBuffer, Utf16String file_name, Utf16String type, i64 last_modified);
+    File(BlobData, Utf16String file_name, Utf16String type, i64 last_modified);
     File();
 
     Utf16String m_name;
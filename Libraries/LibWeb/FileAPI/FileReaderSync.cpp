@@ -37,7 +37,7 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> FileReaderSync::read_as_array_buff
 // https://w3c.github.io/FileAPI/#dfn-readAsArrayBufferSync
 WebIDL::ExceptionOr<ByteBuffer> FileReaderSync::read_as_array_buffer_impl(Blob& blob)
 {
-    return MUST(ByteBuffer::copy(blob.raw_bytes()));
+    return MUST(blob.data().copy_to_byte_buffer());
 }
 
 // https://w3c.github.io/FileAPI/#dfn-readAsBinaryStringSync
@@ -62,7 +62,7 @@ template<typename Result>
 WebIDL::ExceptionOr<Result> FileReaderSync::read_as(Blob& blob, FileReader::Type type, Optional<Utf16String> const& encoding)
 {
     auto blob_type = blob.type();
-    auto result = TRY(FileReader::blob_package_data(MUST(ByteBuffer::copy(blob.raw_bytes())), type, blob_type, encoding));
+    auto result = TRY(FileReader::blob_package_data(MUST(blob.data().copy_to_byte_buffer()), type, blob_type, encoding));
     return result.get<Result>();
 }
 
@@ -39,6 +39,8 @@ enum class TraversalDecision;
 
 struct AsyncScrollOperation;
 struct InitiatorSourceSnapshot;
+struct PreparsedCSSStyleSheet;
+struct TokenizedCSSStyleSheet;
 
 AK_TYPEDEF_DISTINCT_NUMERIC_GENERAL(i64, UniqueNodeID, Comparison, Increment, CastToUnderlying);
 
@@ -540,6 +542,7 @@ class ComponentValue;
 class GuardedSubstitutionContexts;
 class Parser;
 class RustTokenizer;
+class StyleSheetContentsDecoder;
 class SyntaxNode;
 class Token;
 class Tokenizer;
@@ -1034,6 +1037,12 @@ class MediaCapabilities;
 
 }
 
+namespace Web::MediaPlaybackQuality {
+
+class VideoPlaybackQuality;
+
+}
+
 namespace Web::MediaSourceExtensions {
 
 class BufferedChangeEvent;
@@ -1094,6 +1103,7 @@ class PermissionStatus;
 namespace Web::Platform {
 
 class Timer;
+struct DecodedImage;
 
 }
 
@@ -1334,6 +1344,7 @@ class AudioScheduledSourceNode;
 class BaseAudioContext;
 class BiquadFilterNode;
 class ControlMessageQueue;
+class ConvolverNode;
 class DynamicsCompressorNode;
 class GainNode;
 class OfflineAudioCompletionEvent;
@@ -1344,6 +1355,18 @@ class PeriodicWave;
 
 }
 
+namespace Web::WebCodecs {
+
+class AudioData;
+class AudioDecoder;
+class DecoderBase;
+class EncodedAudioChunk;
+class EncodedVideoChunk;
+class VideoDecoder;
+class VideoFrame;
+
+}
+
 namespace Web::WebGL {
 
 class RemoteWebGLTransport;
@@ -14,55 +14,117 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(BitmapDecodedImageData);
 
-ErrorOr<GC::Ref<BitmapDecodedImageData>> BitmapDecodedImageData::create(Vector<Frame>&& frames, size_t loop_count, bool animated)
+ErrorOr<GC::Ref<BitmapDecodedImageData>> BitmapDecodedImageData::create(Vector<Frame>&& frames, size_t loop_count, bool animated, Gfx::IntSize natural_size)
 {
     (void)loop_count;
     (void)animated;
     if (frames.is_empty())
         return Error::from_string_literal("Bitmap image has no frames");
-    return GC::Heap::the().allocate<BitmapDecodedImageData>(move(frames[0].frame));
+    if (natural_size.is_empty())
+        natural_size = frames[0].frame.size();
+    return GC::Heap::the().allocate<BitmapDecodedImageData>(move(frames[0].frame), natural_size);
 }
 
-BitmapDecodedImageData::BitmapDecodedImageData(Gfx::DecodedImageFrame&& frame)
+BitmapDecodedImageData::BitmapDecodedImageData(Gfx::DecodedImageFrame&& frame, Gfx::IntSize natural_size)
     : m_frame(move(frame))
+    , m_natural_size(natural_size)
 {
 }
 
 BitmapDecodedImageData::~BitmapDecodedImageData() = default;
 
+void BitmapDecodedImageData::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_on_natural_size_frame_needed);
+    visitor.visit(m_on_natural_size_frame_needed_now);
+}
+
+void BitmapDecodedImageData::set_on_natural_size_frame_needed(GC::Ptr<GC::Function<void()>> callback)
+{
+    m_on_natural_size_frame_needed = callback;
+}
+
+void BitmapDecodedImageData::set_on_natural_size_frame_needed_now(GC::Ptr<GC::Function<void()>> callback)
+{
+    m_on_natural_size_frame_needed_now = callback;
+}
+
+void BitmapDecodedImageData::set_frame(Gfx::DecodedImageFrame&& frame, Gfx::IntSize natural_size)
+{
+    m_frame = move(frame);
+    m_natural_size = natural_size.is_empty() ? m_frame.size() : natural_size;
+    m_on_natural_size_frame_needed = nullptr;
+    m_on_natural_size_frame_needed_now = nullptr;
+    notify_clients_did_update();
+}
+
+void BitmapDecodedImageData::request_natural_size_frame() const
+{
+    if (auto callback = m_on_natural_size_frame_needed) {
+        m_on_natural_size_frame_needed = nullptr;
+        callback->function()();
+    }
+}
+
+Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::frame_for_size(Gfx::IntSize size) const
+{
+    if (!is_decoded_below_natural_size())
+        return m_frame;
+    if (!size.is_empty() && size.width() <= m_frame.width() && size.height() <= m_frame.height())
+        return m_frame;
+
+    // NB: Callers of this treat the frame as the image's pixels at its natural size (e.g. canvas source rects are in
+    //     image pixels), so it has to be decoded at that size before returning.
+    if (auto callback = m_on_natural_size_frame_needed_now) {
+        m_on_natural_size_frame_needed_now = nullptr;
+        callback->function()();
+    }
+    if (is_decoded_below_natural_size())
+        return {};
+    return m_frame;
+}
+
 size_t BitmapDecodedImageData::external_memory_size() const
 {
     return m_frame.bitmap().data_size();
 }
 
-Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::current_frame(Gfx::IntSize) const
+Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::current_frame(Gfx::IntSize size) const
 {
-    return m_frame;
+    return frame_for_size(size);
 }
 
-Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::default_frame(Gfx::IntSize) const
+Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::default_frame(Gfx::IntSize size) const
 {
-    return m_frame;
+    return frame_for_size(size);
 }
 
 Optional<CSSPixels> BitmapDecodedImageData::intrinsic_width() const
 {
-    return m_frame.width();
+    return m_natural_size.width();
 }
 
 Optional<CSSPixels> BitmapDecodedImageData::intrinsic_height() const
 {
-    return m_frame.height();
+    return m_natural_size.height();
 }
 
 Optional<CSSPixelFraction> BitmapDecodedImageData::intrinsic_aspect_ratio() const
 {
-    return CSSPixels(m_frame.width()) / CSSPixels(m_frame.height());
+    return CSSPixels(m_natural_size.width()) / CSSPixels(m_natural_size.height());
 }
 
-Optional<Painting::ImagePaint> BitmapDecodedImageData::image_paint(Painting::ImagePaintRequest const&) const
+Optional<Painting::ImagePaint> BitmapDecodedImageData::image_paint(Painting::ImagePaintRequest const& request) const
 {
-    return Painting::ImagePaint { Painting::ImagePaint::DecodedFrame { .frame = m_frame, .natural_size = m_frame.size() } };
+    if (is_decoded_below_natural_size()) {
+        // NB: The frame covers the size the image was expected to be displayed at. Allow for a pixel of rounding.
+        auto device_width = request.dest_rect.width() * (request.accumulated_scale.width() > 0 ? request.accumulated_scale.width() : 1);
+        auto device_height = request.dest_rect.height() * (request.accumulated_scale.height() > 0 ? request.accumulated_scale.height() : 1);
+        if (device_width > m_frame.width() + 1 || device_height > m_frame.height() + 1)
+            request_natural_size_frame();
+    }
+    return Painting::ImagePaint { Painting::ImagePaint::DecodedFrame { .frame = m_frame, .natural_size = m_natural_size } };
 }
 
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <LibGC/Function.h>
 #include <LibGfx/DecodedImageFrame.h>
 #include <LibGfx/Forward.h>
 #include <LibWeb/HTML/DecodedImageData.h>
@@ -22,9 +23,26 @@ public:
         int duration { 0 };
     };
 
-    static ErrorOr<GC::Ref<BitmapDecodedImageData>> create(Vector<Frame>&&, size_t loop_count, bool animated);
+    // The natural size defaults to the size of the first frame. It is larger if the image was decoded to a smaller
+    // ideal size, see Platform::ImageCodecPlugin::decode_image().
+    static ErrorOr<GC::Ref<BitmapDecodedImageData>> create(Vector<Frame>&&, size_t loop_count, bool animated, Gfx::IntSize natural_size = {});
     virtual ~BitmapDecodedImageData() override;
 
+    bool is_decoded_below_natural_size() const { return m_frame.size() != m_natural_size; }
+    Gfx::IntSize frame_size() const { return m_frame.size(); }
+
+    // Called once when an image decoded below its natural size is painted larger than its frame. The callback should
+    // arrange for a natural size frame to be passed to set_frame() later on. Until then, the smaller frame is painted.
+    void set_on_natural_size_frame_needed(GC::Ptr<GC::Function<void()>>);
+
+    // Called once when the pixels of an image decoded below its natural size are read, e.g. by a canvas. The callback
+    // should pass a natural size frame to set_frame() before returning. If it does not, there are no pixels to read,
+    // since a scaled up copy of the smaller frame would not be the image's pixels.
+    void set_on_natural_size_frame_needed_now(GC::Ptr<GC::Function<void()>>);
+
+    // Replaces the frame, e.g. when more of a partially loaded image has been decoded.
+    void set_frame(Gfx::DecodedImageFrame&&, Gfx::IntSize natural_size);
+
     virtual Optional<Gfx::DecodedImageFrame> default_frame(Gfx::IntSize = {}) const override;
     virtual Optional<Gfx::DecodedImageFrame> current_frame(Gfx::IntSize = {}) const override;
 
@@ -35,11 +53,18 @@ public:
     virtual Optional<Painting::ImagePaint> image_paint(Painting::ImagePaintRequest const&) const override;
 
 private:
-    BitmapDecodedImageData(Gfx::DecodedImageFrame&& frame);
+    BitmapDecodedImageData(Gfx::DecodedImageFrame&& frame, Gfx::IntSize natural_size);
 
+    virtual void visit_edges(Cell::Visitor&) override;
     virtual size_t external_memory_size() const override;
 
+    Optional<Gfx::DecodedImageFrame> frame_for_size(Gfx::IntSize) const;
+    void request_natural_size_frame() const;
+
     Gfx::DecodedImageFrame m_frame;
+    Gfx::IntSize m_natural_size;
+    mutable GC::Ptr<GC::Function<void()>> m_on_natural_size_frame_needed;
+    mutable GC::Ptr<GC::Function<void()>> m_on_natural_size_frame_needed_now;
 };
 
 }
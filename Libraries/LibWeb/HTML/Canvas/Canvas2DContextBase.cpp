@@ -51,6 +51,7 @@
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/Canvas2DCommandStream.h>
 #include <LibWeb/SVG/SVGImageElement.h>
+#include <LibWeb/WebCodecs/VideoFrame.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::HTML {
@@ -1079,7 +1080,7 @@ WebIDL::ExceptionOr<CanvasImageSourceUsability> check_usability_of_image(CanvasI
 
             // If image is not fully decodable, or has an intrinsic width or intrinsic height
             // (or both) equal to zero, then return bad.
-            if (!image_provider_is_usable_for_canvas(*image_element))
+            if (image_element->current_request().state() == HTML::ImageRequest::State::PartiallyAvailable || !image_provider_is_usable_for_canvas(*image_element))
                 return { CanvasImageSourceUsability::Bad };
             return Optional<CanvasImageSourceUsability> {};
         },
@@ -1118,11 +1119,18 @@ WebIDL::ExceptionOr<CanvasImageSourceUsability> check_usability_of_image(CanvasI
         },
 
         // ImageBitmap
-        // FIXME: VideoFrame
         [](GC::Ref<ImageBitmap> image_bitmap) -> WebIDL::ExceptionOr<Optional<CanvasImageSourceUsability>> {
+            // If image's [[Detached]] internal slot value is set to true, then throw an "InvalidStateError" DOMException.
             if (image_bitmap->is_detached())
                 return WebIDL::InvalidStateError::create("Image bitmap is detached"_utf16);
             return Optional<CanvasImageSourceUsability> {};
+        },
+        // VideoFrame
+        [](GC::Ref<WebCodecs::VideoFrame> video_frame) -> WebIDL::ExceptionOr<Optional<CanvasImageSourceUsability>> {
+            // If image's [[Detached]] internal slot value is set to true, then throw an "InvalidStateError" DOMException.
+            if (video_frame->is_detached())
+                return WebIDL::InvalidStateError::create("Video frame is detached"_utf16);
+            return Optional<CanvasImageSourceUsability> {};
         }));
     if (usability.has_value())
         return usability.release_value();
@@ -1153,6 +1161,10 @@ bool image_is_not_origin_clean(CanvasImageSource const& image)
         [](OneOf<GC::Ref<HTMLCanvasElement>, GC::Ref<ImageBitmap>, GC::Ref<OffscreenCanvas>> auto const&) {
             // FIXME: image's bitmap's origin-clean flag is false.
             return false;
+        },
+        // NB: VideoFrames can only be created from decoded chunks, which are never cross-origin.
+        [](GC::Ref<WebCodecs::VideoFrame>) {
+            return false;
         });
 }
 
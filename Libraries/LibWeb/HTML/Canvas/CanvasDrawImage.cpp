@@ -11,6 +11,7 @@
 #include <LibWeb/HTML/DecodedImageData.h>
 #include <LibWeb/HTML/ImageBitmap.h>
 #include <LibWeb/SVG/SVGAnimatedLength.h>
+#include <LibWeb/WebCodecs/VideoFrame.h>
 
 namespace Web::HTML {
 
@@ -60,6 +61,10 @@ Gfx::IntSize canvas_image_source_dimensions(CanvasImageSource const& image)
         },
         [](GC::Ref<HTMLVideoElement> source) -> Gfx::IntSize {
             return { source->video_width(), source->video_height() };
+        },
+        [](GC::Ref<WebCodecs::VideoFrame> source) -> Gfx::IntSize {
+            // FIXME: Scale the frame to its display size when drawing, rather than drawing its coded size.
+            return { source->coded_width(), source->coded_height() };
         });
 }
 
@@ -94,6 +99,9 @@ Optional<Gfx::DecodedImageFrame> canvas_image_source_frame(CanvasImageSource con
         },
         [](GC::Ref<HTMLVideoElement> const& source) -> Optional<Gfx::DecodedImageFrame> {
             return source->current_decoded_image_frame();
+        },
+        [](GC::Ref<WebCodecs::VideoFrame> const& source) -> Optional<Gfx::DecodedImageFrame> {
+            return source->decoded_image_frame();
         });
 }
 
@@ -97,7 +97,7 @@ GC::Ptr<DataTransferItem> DataTransferItemList::add(GC::Ref<FileAPI::File> file)
         .kind = HTML::DragDataStoreItem::Kind::File,
         .type_string = file->type().to_ascii_lowercase(),
         .data = {},
-        .file_data = MUST(ByteBuffer::copy(file->raw_bytes())),
+        .file_data = MUST(file->data().copy_to_byte_buffer()),
         .file_name = file->name(),
     });
 
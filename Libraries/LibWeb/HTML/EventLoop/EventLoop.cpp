@@ -8,6 +8,7 @@
 #include <AK/Debug.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/Tracing.h>
 #include <LibGC/Heap.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Animations/ScrollTimeline.h>
@@ -151,6 +152,8 @@ void EventLoop::process()
         // 5. Set the event loop's currently running task to oldestTask.
         m_currently_running_task = oldest_task.ptr();
 
+        Core::Tracing::Scope trace_scope { "html", "RunTask" };
+
         // 6. Perform oldestTask's steps.
         oldest_task->execute();
 
@@ -214,7 +217,8 @@ void EventLoop::queue_task_to_update_the_rendering()
     for (auto& navigable : all_local_navigables()) {
         if (!navigable->is_traversable())
             continue;
-        if (!navigable->has_a_rendering_opportunity())
+        // NB: Input events are processed by the rendering task, so keep delivering them to pages that aren't rendered.
+        if (!navigable->has_a_rendering_opportunity() && navigable->page().client().input_event_queue().is_empty())
             continue;
 
         auto document = navigable->active_document();
@@ -319,6 +323,8 @@ void EventLoop::update_the_rendering()
         m_running_rendering_task = false;
     };
 
+    Core::Tracing::Scope trace_scope { "html", "UpdateTheRendering" };
+
     process_input_events();
 
     // 1. Let frameTimestamp be eventLoop's last render opportunity time.
@@ -103,6 +103,9 @@ public:
         // https://storage.spec.whatwg.org/#task-source
         Storage,
 
+        // https://w3c.github.io/webcodecs/#codec-task-source
+        Codec,
+
         // !!! IMPORTANT: Keep this field last!
         // This serves as the base value of all unique task sources.
         // Some elements, such as the HTMLMediaElement, must have a unique task source per instance.
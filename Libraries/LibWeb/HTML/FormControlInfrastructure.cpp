@@ -352,7 +352,8 @@ ErrorOr<SerializedFormData> serialize_to_multipart_form_data(GC::ConservativeVec
                 } else {
                     TRY(builder.try_append("Content-Type: application/octet-stream\r\n\r\n"sv));
                 }
-                TRY(builder.try_append(file->raw_bytes()));
+                for (auto chunk : TRY(file->data().chunk_bytes()))
+                    TRY(builder.try_append(chunk));
                 TRY(builder.try_append("\r\n"sv));
                 return {};
             },
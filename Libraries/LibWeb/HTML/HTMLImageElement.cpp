@@ -47,6 +47,7 @@
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Namespace.h>
+#include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/BoxViews.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
@@ -726,6 +727,42 @@ bool HTMLImageElement::uses_srcset_or_picture() const
     return has_attribute(HTML::AttributeNames::srcset) || (parent() && is<HTMLPictureElement>(*parent()));
 }
 
+static Optional<CSSPixels> dimension_attribute_value_in_pixels(Optional<Utf16String> const& value)
+{
+    if (!value.has_value())
+        return {};
+    auto parsed_value = parse_dimension_value(*value);
+    if (!parsed_value || !parsed_value->is_length())
+        return {};
+    return parsed_value->as_length().length().absolute_length_to_px();
+}
+
+Optional<Gfx::IntSize> HTMLImageElement::ideal_decode_size() const
+{
+    // NB: This is only a hint for the image decoder. If the image ends up displayed larger, or script reads its
+    //     pixels, it is decoded again at its natural size.
+    Optional<CSSPixelSize> size;
+    auto const* layout_node = this->layout_node();
+    if (layout_node && layout_node->kind() == Layout::RustFFI::NodeKind::ImageBox && Painting::has_committed_box(*layout_node)
+        && !image_element_dimensions_may_depend_on_intrinsic_size(static_cast<Layout::Box const&>(*layout_node))) {
+        size = CSSPixelSize { Painting::content_width(*layout_node), Painting::content_height(*layout_node) };
+    } else {
+        auto const& source = dimension_attribute_source();
+        auto width = dimension_attribute_value_in_pixels(source.attribute(HTML::AttributeNames::width));
+        auto height = dimension_attribute_value_in_pixels(source.attribute(HTML::AttributeNames::height));
+        if (width.has_value() && height.has_value())
+            size = CSSPixelSize { *width, *height };
+    }
+    if (!size.has_value() || size->is_empty())
+        return {};
+
+    auto device_pixels_per_css_pixel = document().page().client().device_pixels_per_css_pixel();
+    return Gfx::IntSize {
+        static_cast<int>(ceil(size->width().to_double() * device_pixels_per_css_pixel)),
+        static_cast<int>(ceil(size->height().to_double() * device_pixels_per_css_pixel)),
+    };
+}
+
 // https://html.spec.whatwg.org/multipage/images.html#update-the-image-data
 void HTMLImageElement::update_the_image_data(bool restart_animations, bool maybe_omit_events)
 {
@@ -1115,8 +1152,8 @@ after_step_7:
         // 25. If the will lazy load element steps given the img return true, then:
         if (will_lazy_load_element()) {
             // 1. Set the img's lazy load resumption steps to the rest of this algorithm starting with the step labeled fetch the image.
-            set_lazy_load_resumption_steps([request, image_request]() {
-                image_request->fetch_image(request);
+            set_lazy_load_resumption_steps([this, request, image_request]() {
+                image_request->fetch_image(request, ideal_decode_size());
             });
 
             // 2. Start intersection-observing a lazy loading element for the img element.
@@ -1126,7 +1163,7 @@ after_step_7:
             return;
         }
 
-        image_request->fetch_image(request);
+        image_request->fetch_image(request, ideal_decode_size());
     }));
 }
 
@@ -1238,6 +1275,19 @@ void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> imag
                 dispatch_event(create_event_for_element(*this, HTML::EventNames::error));
 
             m_load_event_delayer.clear();
+        },
+        [this, image_request]() {
+            // AD-HOC: Show what has been decoded of the current request while the rest is loading. A pending request
+            //         only replaces the current request once it is completely available.
+            if (!document().is_fully_active() || image_request->was_aborted() || image_request != m_current_request)
+                return;
+            if (image_request->state() != ImageRequest::State::Unavailable)
+                return;
+
+            image_request->set_image_data(image_request->shared_resource_request()->image_data());
+            register_with_decoded_image_data_if_needed();
+            image_request->set_state(ImageRequest::State::PartiallyAvailable);
+            set_needs_layout_update_or_repaint_after_image_data_change(DOM::SetNeedsLayoutReason::HTMLImageElementUpdateTheImageData);
         });
 }
 
@@ -1410,7 +1460,7 @@ void HTMLImageElement::react_to_changes_in_the_environment()
             });
 
         // 5. Let response be the result of fetching request.
-        image_request->fetch_image(request);
+        image_request->fetch_image(request, ideal_decode_size());
     }
 }
 
@@ -124,6 +124,9 @@ private:
 
     void update_the_image_data_impl(bool restart_the_animations, bool maybe_omit_events, u64 update_the_image_data_count);
 
+    // The size in device pixels this image is expected to be displayed at, if it is known without decoding it.
+    Optional<Gfx::IntSize> ideal_decode_size() const;
+
     virtual bool is_html_image_element() const override { return true; }
 
     virtual void initialize_element() override;
@@ -1855,9 +1855,10 @@ WebIDL::ExceptionOr<void> HTMLInputElement::handle_src_attribute(Utf16View value
             set_needs_layout_tree_update(true, DOM::SetNeedsLayoutTreeUpdateReason::HTMLInputElementSrcAttribute);
         });
 
-    if (m_resource_request->needs_fetching()) {
+    if (m_resource_request->needs_fetching())
         m_resource_request->fetch_resource(request);
-    }
+    else
+        m_resource_request->add_consumer_ideal_size({});
     update_image_button_alt_text_shadow_tree();
 
     // Fetching the image must delay the load event of the element's node document until the task that is queued by the
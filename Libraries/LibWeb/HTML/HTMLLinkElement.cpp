@@ -10,13 +10,18 @@
 #include <AK/ByteBuffer.h>
 #include <AK/Debug.h>
 #include <LibCore/ImmutableBytes.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/DecodedImageFrame.h>
+#include <LibRequests/RequestClient.h>
 #include <LibTextCodec/Decoder.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibURL/URL.h>
 #include <LibWeb/CSS/CSSStyleSheet.h>
+#include <LibWeb/CSS/Fetch.h>
 #include <LibWeb/CSS/Parser/Parser.h>
+#include <LibWeb/CSS/Parser/StyleSheetContentsEncoding.h>
 #include <LibWeb/CSS/StyleSheetList.h>
 #include <LibWeb/DOM/DOMTokenList.h>
 #include <LibWeb/DOM/Document.h>
@@ -30,6 +35,7 @@
 #include <LibWeb/Fetch/Infrastructure/HTTP/MIME.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/Fetch/Infrastructure/URL.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/EventNames.h>
 #include <LibWeb/HTML/HTMLLinkElement.h>
@@ -95,6 +101,8 @@ void HTMLLinkElement::removed_from(IsSubtreeRoot is_subtree_root, Node* old_ance
 {
     Base::removed_from(is_subtree_root, old_ancestor, old_root);
 
+    abandon_processing_stylesheet_resource_off_thread();
+
     if (m_loaded_style_sheet) {
         // NB: We can't use `old_root` here. When this link element is nested
         //     inside a shadow tree within a larger removed subtree, `old_root`
@@ -435,6 +443,10 @@ GC::Ptr<Fetch::Infrastructure::Request> HTMLLinkElement::create_link_request(HTM
 // https://html.spec.whatwg.org/multipage/semantics.html#fetch-and-process-the-linked-resource
 void HTMLLinkElement::fetch_and_process_linked_resource()
 {
+    // NB: This also runs when the disabled attribute changes, so a disabled link element never gets the style sheet
+    //     that was still being decoded for it.
+    abandon_processing_stylesheet_resource_off_thread();
+
     auto fetch_generation = ++m_current_fetch_generation;
 
     if (m_fetch_controller) {
@@ -848,6 +860,97 @@ void HTMLLinkElement::process_icon_resource(bool success, Fetch::Infrastructure:
     document().check_favicon_after_loading_link_resource();
 }
 
+// Style sheets at least this large are decoded and tokenized on the thread pool, rather than on the main thread.
+static constexpr size_t off_thread_style_sheet_tokenization_threshold = 16 * KiB;
+
+using StyleSheetSourceHash = ::Crypto::Hash::Digest<::Crypto::Hash::SHA256::DigestSize * 8>;
+
+// A style sheet response that RequestServer has in its disk cache, next to which the style sheet's rules can be stored.
+struct StyleSheetDiskCacheEntry {
+    URL::URL url;
+    u64 vary_key { 0 };
+};
+
+static Optional<StyleSheetDiskCacheEntry> style_sheet_disk_cache_entry_for_response(Fetch::Infrastructure::Response const& response, ReadonlyBytes body_bytes)
+{
+    if (body_bytes.size() < CSS::Parser::StyleSheetContentsCache::minimum_source_length)
+        return {};
+
+    auto url = response.url();
+    if (!url.has_value() || !Fetch::Infrastructure::is_http_or_https_scheme(url->scheme()))
+        return {};
+
+    if (!ResourceLoader::is_initialized() || !ResourceLoader::the().request_client())
+        return {};
+
+    auto vary_key = response.disk_cache_vary_key();
+    if (!vary_key.has_value())
+        return {};
+
+    return StyleSheetDiskCacheEntry { .url = url.release_value(), .vary_key = *vary_key };
+}
+
+using StyleSheetSource = Variant<Utf16String, TokenizedCSSStyleSheet>;
+
+// The body of a style sheet that has a disk cache entry, as the thread pool hands it back to the main thread.
+struct HashedStyleSheetSource {
+    StyleSheetSourceHash source_hash;
+    ErrorOr<StyleSheetSource> source;
+};
+
+// Hashes and decodes the body of a style sheet on the thread pool. It is only tokenized as well if there are no rules in
+// the disk cache to use instead, since then the tokens would go to waste.
+static void hash_and_decode_style_sheet_off_thread(Optional<String> environment_encoding, Optional<String> mime_type_charset, ByteBuffer body, bool tokenize, Function<void(HashedStyleSheetSource)>&& on_complete)
+{
+    Threading::ThreadPool::the().submit(
+        [environment_encoding = move(environment_encoding), mime_type_charset = move(mime_type_charset), body = move(body), tokenize] {
+            auto to_view = [](Optional<String> const& string) -> Optional<StringView> {
+                if (!string.has_value())
+                    return {};
+                return string->bytes_as_string_view();
+            };
+
+            // The encodings go into the hash as well, since they decide which text, and so which rules, the body turns into.
+            auto hasher = ::Crypto::Hash::SHA256::create();
+            hasher->update(body);
+            hasher->update(to_view(environment_encoding).value_or(""sv));
+            hasher->update(";"sv);
+            hasher->update(to_view(mime_type_charset).value_or(""sv));
+
+            auto source = [&]() -> ErrorOr<StyleSheetSource> {
+                if (tokenize)
+                    return StyleSheetSource { TRY(css_decode_and_tokenize_bytes(to_view(environment_encoding), to_view(mime_type_charset), body)) };
+                return StyleSheetSource { TRY(css_decode_bytes(to_view(environment_encoding), to_view(mime_type_charset), body)) };
+            }();
+
+            return HashedStyleSheetSource { .source_hash = hasher->digest(), .source = move(source) };
+        },
+        move(on_complete));
+}
+
+// NB: Decoding creates interned strings, so unlike hashing, it has to happen on the main thread.
+static RefPtr<CSS::Parser::StyleSheetContents const> decode_style_sheet_contents_from_disk_cache(StyleSheetDiskCacheEntry const& entry, Core::ImmutableBytes const& data, StyleSheetSourceHash const& source_hash)
+{
+    auto contents = CSS::Parser::StyleSheetContentsDecoder::decode(data.bytes(), source_hash.bytes());
+    if (contents.is_error()) {
+        dbgln("Ignoring cached rules of style sheet {}: {}", entry.url, contents.error());
+        return {};
+    }
+    return contents.release_value();
+}
+
+// Builds the rules of a style sheet, and stores them next to it in the disk cache, for the next time it is loaded.
+static PreparsedCSSStyleSheet parse_style_sheet_contents_for_disk_cache(DOM::Document const& document, StyleSheetDiskCacheEntry const& entry, StyleSheetSourceHash const& source_hash, StyleSheetSource css)
+{
+    auto preparsed_style_sheet = parse_css_stylesheet_contents(CSS::Parser::ParsingParams { document }, move(css));
+
+    auto encoded_contents = CSS::Parser::StyleSheetContentsEncoder::encode(*preparsed_style_sheet.contents, source_hash.bytes());
+    if (!encoded_contents.is_error())
+        (void)ResourceLoader::the().request_client()->store_cache_associated_data(entry.url, CSS::style_resource_request_method(), OptionalNone {}, entry.vary_key, HTTP::CacheEntryAssociatedData::CSSParsedRules, encoded_contents.value().bytes());
+
+    return preparsed_style_sheet;
+}
+
 // https://html.spec.whatwg.org/multipage/links.html#link-type-stylesheet:process-the-linked-resource
 void HTMLLinkElement::process_stylesheet_resource(bool success, Fetch::Infrastructure::Response const& response, ReadonlyBytes body_bytes)
 {
@@ -914,34 +1017,101 @@ void HTMLLinkElement::process_stylesheet_resource(bool success, Fetch::Infrastru
         if (!environment_encoding.has_value() && document().encoding().has_value())
             environment_encoding = TextCodec::get_standardized_encoding(document().encoding().value());
 
+        auto to_string = [](Optional<StringView> view) -> Optional<String> {
+            if (!view.has_value())
+                return {};
+            return MUST(String::from_utf8(*view));
+        };
+
+        // OPTIMIZATION: If an earlier load stored the rules of this style sheet next to it in the HTTP disk cache,
+        //               RequestServer sends them along with the response. Then the style sheet only has to be decoded,
+        //               and those rules interpreted into the CSSOM, without tokenizing or parsing anything. The body is
+        //               hashed to check that the rules belong to it, and that happens on the thread pool along with
+        //               decoding it, so the main thread gets on with other work in the meantime.
+        if (auto disk_cache_entry = style_sheet_disk_cache_entry_for_response(response, body_bytes); disk_cache_entry.has_value()) {
+            auto css_parsed_rules = response.css_parsed_rules_cache();
+            m_is_processing_stylesheet_resource_off_thread = true;
+            hash_and_decode_style_sheet_off_thread(
+                to_string(environment_encoding),
+                to_string(mime_type_charset),
+                MUST(ByteBuffer::copy(body_bytes)),
+                !css_parsed_rules.has_value(),
+                [self = GC::make_root(*this), response = GC::make_root(response), fetch_generation = m_current_fetch_generation, disk_cache_entry = disk_cache_entry.release_value(), css_parsed_rules = move(css_parsed_rules)](HashedStyleSheetSource result) mutable {
+                    // NB: If the link element was removed, or the resource disabled or fetched again in the meantime,
+                    //     abandon_processing_stylesheet_resource_off_thread() already took care of everything.
+                    if (fetch_generation != self->m_current_fetch_generation)
+                        return;
+                    self->m_is_processing_stylesheet_resource_off_thread = false;
+
+                    // NB: A document that is no longer fully active gets no new style sheet, but the link element must
+                    //     still stop blocking its scripts and rendering.
+                    if (!self->document().is_fully_active()) {
+                        self->finish_processing_stylesheet_resource();
+                        return;
+                    }
+
+                    if (result.source.is_error()) {
+                        dbgln("Failed to decode CSS file: {}", response->url().value_or(URL::URL()));
+                        self->dispatch_event(create_event_for_element(*self, HTML::EventNames::error));
+                        self->finish_processing_stylesheet_resource();
+                        return;
+                    }
+
+                    auto source = result.source.release_value();
+                    RefPtr<CSS::Parser::StyleSheetContents const> contents;
+                    if (css_parsed_rules.has_value())
+                        contents = decode_style_sheet_contents_from_disk_cache(disk_cache_entry, *css_parsed_rules, result.source_hash);
+
+                    // NB: The body is only left untokenized when there are cached rules, so the source is its text here.
+                    if (contents)
+                        self->create_style_sheet_for_resource(*response, PreparsedCSSStyleSheet { .source_text = move(source.get<Utf16String>()), .contents = contents.release_nonnull() });
+                    else
+                        self->create_style_sheet_for_resource(*response, parse_style_sheet_contents_for_disk_cache(self->document(), disk_cache_entry, result.source_hash, move(source)));
+                    self->finish_processing_stylesheet_resource();
+                });
+            return;
+        }
+
+        // OPTIMIZATION: Decoding and tokenizing a large style sheet takes a while, so do that on the thread pool while
+        //               the main thread gets on with other work. Only parsing the tokens into the CSSOM happens back on
+        //               the main thread, and the style sheet keeps blocking scripts and rendering until then.
+        if (body_bytes.size() >= off_thread_style_sheet_tokenization_threshold) {
+            m_is_processing_stylesheet_resource_off_thread = true;
+            css_decode_and_tokenize_bytes_off_thread(
+                to_string(environment_encoding),
+                to_string(mime_type_charset),
+                MUST(ByteBuffer::copy(body_bytes)),
+                [self = GC::make_root(*this), response = GC::make_root(response), fetch_generation = m_current_fetch_generation](ErrorOr<TokenizedCSSStyleSheet> result) mutable {
+                    // NB: If the link element was removed, or the resource disabled or fetched again in the meantime,
+                    //     abandon_processing_stylesheet_resource_off_thread() already took care of everything.
+                    if (fetch_generation != self->m_current_fetch_generation)
+                        return;
+                    self->m_is_processing_stylesheet_resource_off_thread = false;
+
+                    // NB: A document that is no longer fully active gets no new style sheet, but the link element must
+                    //     still stop blocking its scripts and rendering.
+                    if (!self->document().is_fully_active()) {
+                        self->finish_processing_stylesheet_resource();
+                        return;
+                    }
+
+                    if (result.is_error()) {
+                        dbgln("Failed to decode CSS file: {}", response->url().value_or(URL::URL()));
+                        self->dispatch_event(create_event_for_element(*self, HTML::EventNames::error));
+                    } else {
+                        self->create_style_sheet_for_resource(*response, result.release_value());
+                    }
+                    self->finish_processing_stylesheet_resource();
+                });
+            return;
+        }
+
         auto maybe_decoded_string = css_decode_bytes(environment_encoding, mime_type_charset, body_bytes);
         if (maybe_decoded_string.is_error()) {
             dbgln("Failed to decode CSS file: {}", response.url().value_or(URL::URL()));
             dispatch_event(create_event_for_element(*this, HTML::EventNames::error));
         } else {
-            VERIFY(!response.url_list().is_empty());
-            auto media = attribute(HTML::AttributeNames::media);
-            auto media_value = media.has_value() ? media->utf16_view() : u""sv;
-            auto title = in_a_document_tree() ? attribute(HTML::AttributeNames::title) : Optional<Utf16String> {};
-            m_loaded_style_sheet = document_or_shadow_root_style_sheets().create_a_css_style_sheet(
-                maybe_decoded_string.release_value(),
-                this,
-                media_value,
-                title.has_value() ? title.release_value() : Utf16String {},
-                (m_relationship & Relationship::Alternate && !m_explicitly_enabled) ? CSS::StyleSheetList::Alternate::Yes : CSS::StyleSheetList::Alternate::No,
-                CSS::StyleSheetList::OriginClean::Yes,
-                response.url_list().first(),
-                nullptr,
-                nullptr);
-
-            // NB: Removing the disabled attribute explicitly enables the style sheet, regardless of which style sheet
-            //     set is currently preferred. Creating the sheet may have disabled it based on its title, so restore
-            //     the state requested by the link element.
-            if (m_explicitly_enabled)
-                m_loaded_style_sheet->set_disabled(false);
-
-            // 2. Fire an event named load at el.
-            dispatch_event(create_event_for_element(*this, HTML::EventNames::load));
+            create_style_sheet_for_resource(response, maybe_decoded_string.release_value());
         }
     }
     // 5. Otherwise, fire an event named error at el.
@@ -949,6 +1119,45 @@ void HTMLLinkElement::process_stylesheet_resource(bool success, Fetch::Infrastru
         dispatch_event(create_event_for_element(*this, HTML::EventNames::error));
     }
 
+    finish_processing_stylesheet_resource();
+}
+
+void HTMLLinkElement::create_style_sheet_for_resource(Fetch::Infrastructure::Response const& response, Variant<Utf16String, TokenizedCSSStyleSheet, PreparsedCSSStyleSheet> css)
+{
+    VERIFY(!response.url_list().is_empty());
+    auto media = attribute(HTML::AttributeNames::media);
+    auto media_value = media.has_value() ? media->utf16_view() : u""sv;
+    auto title = in_a_document_tree() ? attribute(HTML::AttributeNames::title) : Optional<Utf16String> {};
+    auto create_a_css_style_sheet = [&](auto css_text) {
+        return document_or_shadow_root_style_sheets().create_a_css_style_sheet(
+            move(css_text),
+            this,
+            media_value,
+            title.has_value() ? title.release_value() : Utf16String {},
+            (m_relationship & Relationship::Alternate && !m_explicitly_enabled) ? CSS::StyleSheetList::Alternate::Yes : CSS::StyleSheetList::Alternate::No,
+            CSS::StyleSheetList::OriginClean::Yes,
+            response.url_list().first(),
+            nullptr,
+            nullptr);
+    };
+    m_loaded_style_sheet = css.visit(
+        [&](Utf16String const& decoded_string) { return create_a_css_style_sheet(decoded_string.utf16_view()); },
+        [&](TokenizedCSSStyleSheet& tokenized_style_sheet) { return create_a_css_style_sheet(move(tokenized_style_sheet)); },
+        [&](PreparsedCSSStyleSheet& preparsed_style_sheet) { return create_a_css_style_sheet(move(preparsed_style_sheet)); });
+
+    // NB: Removing the disabled attribute explicitly enables the style sheet, regardless of which style sheet
+    //     set is currently preferred. Creating the sheet may have disabled it based on its title, so restore
+    //     the state requested by the link element.
+    if (m_explicitly_enabled)
+        m_loaded_style_sheet->set_disabled(false);
+
+    // 2. Fire an event named load at el.
+    dispatch_event(create_event_for_element(*this, HTML::EventNames::load));
+}
+
+// https://html.spec.whatwg.org/multipage/links.html#link-type-stylesheet:process-the-linked-resource
+void HTMLLinkElement::finish_processing_stylesheet_resource()
+{
     // 6. If el contributes a script-blocking style sheet, then:
     if (contributes_a_script_blocking_style_sheet()) {
         // 1. Assert: el's node document's script-blocking style sheet set contains el.
@@ -971,6 +1180,22 @@ void HTMLLinkElement::process_stylesheet_resource(bool success, Fetch::Infrastru
     }
 }
 
+// NB: When the link element is removed, or its style sheet is fetched again or disabled, while the previously fetched
+//     style sheet is still being decoded on the thread pool, that style sheet must no longer be created. It must also
+//     stop blocking scripts and rendering, since the link element may no longer contribute a script-blocking style
+//     sheet, and a new fetch (if any) blocks them again by itself.
+void HTMLLinkElement::abandon_processing_stylesheet_resource_off_thread()
+{
+    if (!m_is_processing_stylesheet_resource_off_thread)
+        return;
+    m_is_processing_stylesheet_resource_off_thread = false;
+
+    ++m_current_fetch_generation;
+    document().remove_from_script_blocking_style_sheet_set(*this);
+    unblock_rendering();
+    m_document_load_event_delayer.clear();
+}
+
 static NonnullRefPtr<Core::Promise<NonnullRefPtr<Gfx::Bitmap const>>> decode_favicon(ReadonlyBytes favicon_data, URL::URL const& favicon_url, GC::Ref<DOM::Document> document)
 {
     auto promise = Core::Promise<NonnullRefPtr<Gfx::Bitmap const>>::construct();
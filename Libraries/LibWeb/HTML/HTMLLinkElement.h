@@ -172,6 +172,9 @@ private:
     void process_linked_resource(bool success, Fetch::Infrastructure::Response const&, Core::ImmutableBytes const*);
     void process_icon_resource(bool success, Fetch::Infrastructure::Response const&, ByteBuffer);
     void process_stylesheet_resource(bool success, Fetch::Infrastructure::Response const&, ReadonlyBytes);
+    void create_style_sheet_for_resource(Fetch::Infrastructure::Response const&, Variant<Utf16String, TokenizedCSSStyleSheet, PreparsedCSSStyleSheet>);
+    void finish_processing_stylesheet_resource();
+    void abandon_processing_stylesheet_resource_off_thread();
 
     bool should_fetch_and_process_resource_type() const;
 
@@ -202,6 +205,9 @@ private:
     unsigned m_relationship { 0 };
     u64 m_current_fetch_generation { 0 };
 
+    // Set while the fetched style sheet is decoded on the thread pool, during which it keeps blocking scripts and rendering.
+    bool m_is_processing_stylesheet_resource_off_thread { false };
+
     // https://html.spec.whatwg.org/multipage/semantics.html#explicitly-enabled
     bool m_explicitly_enabled { false };
 
@@ -1777,6 +1777,13 @@ RefPtr<Media::VideoFrame> HTMLMediaElement::current_presented_frame() const
     return Media::PlaybackManager::current_presented_frame(*handle);
 }
 
+Media::VideoPlaybackQuality HTMLMediaElement::video_playback_quality() const
+{
+    if (!m_playback_manager)
+        return {};
+    return m_playback_manager->video_playback_quality();
+}
+
 void HTMLMediaElement::attach_selected_video_track_sink(Media::Track const& track)
 {
     auto previous_handle = video_sink_handle();
@@ -2901,8 +2908,7 @@ void HTMLMediaElement::update_audio_play_state()
         return;
 
     m_is_playing_audio = is_playing_audio;
-    document().page().client().page_did_change_audio_play_state(
-        m_is_playing_audio ? AudioPlayState::Playing : AudioPlayState::Paused);
+    document().page().did_change_audio_play_state(m_is_playing_audio ? AudioPlayState::Playing : AudioPlayState::Paused);
 }
 
 void HTMLMediaElement::set_show_poster(bool show_poster)
@@ -185,6 +185,7 @@ public:
 
     Optional<Media::VideoSinkHandle> video_sink_handle() const;
     RefPtr<Media::VideoFrame> current_presented_frame() const;
+    Media::VideoPlaybackQuality video_playback_quality() const;
 
     Optional<Painting::VideoSinkResourceId> video_sink_resource_id() const;
 
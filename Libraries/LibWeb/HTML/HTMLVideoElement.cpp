@@ -11,6 +11,7 @@
 #include <LibGfx/DecodedImageFrame.h>
 #include <LibGfx/YUVData.h>
 #include <LibMedia/Sinks/DisplayingVideoSink.h>
+#include <LibMedia/VideoDecodeQuality.h>
 #include <LibMedia/VideoFrame.h>
 #include <LibWeb/CSS/StyleValues/DisplayStyleValue.h>
 #include <LibWeb/DOM/Document.h>
@@ -28,6 +29,7 @@
 #include <LibWeb/HTML/VideoTrackList.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/Layout/Box.h>
+#include <LibWeb/MediaPlaybackQuality/VideoPlaybackQuality.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::HTML {
@@ -331,4 +333,24 @@ Optional<Gfx::DecodedImageFrame> HTMLVideoElement::current_decoded_image_frame()
     return Gfx::DecodedImageFrame { NonnullRefPtr<Gfx::Bitmap const> { *bitmap }, move(color_space) };
 }
 
+// https://w3c.github.io/media-playback-quality/#dom-htmlvideoelement-getvideoplaybackquality
+GC::Ref<MediaPlaybackQuality::VideoPlaybackQuality> HTMLVideoElement::get_video_playback_quality() const
+{
+    auto quality = video_playback_quality();
+
+    // 1. Let playbackQuality be a new instance of VideoPlaybackQuality.
+    // 2. Set playbackQuality.creationTime to the value returned by a call to Performance.now().
+    auto creation_time = HighResolutionTime::current_high_resolution_time(relevant_global_object(*this));
+
+    // 3. Set playbackQuality.totalVideoFrames to the current value of the total video frame count.
+    // 4. Set playbackQuality.droppedVideoFrames to the current value of the dropped video frame count.
+    // NB: The counts are clamped to the range of an unsigned long.
+    auto dropped_video_frames = static_cast<WebIDL::UnsignedLong>(min<u64>(quality.dropped_frame_count, NumericLimits<WebIDL::UnsignedLong>::max()));
+    auto total_video_frames = static_cast<WebIDL::UnsignedLong>(min<u64>(quality.total_frame_count, NumericLimits<WebIDL::UnsignedLong>::max()));
+
+    // 5. Set playbackQuality.corruptedVideoFrames to the current value of the corrupted video frame count.
+    // 6. Return playbackQuality.
+    return MediaPlaybackQuality::VideoPlaybackQuality::create(creation_time, dropped_video_frames, total_video_frames);
+}
+
 }
@@ -58,6 +58,8 @@ public:
 
     Optional<Gfx::DecodedImageFrame> current_decoded_image_frame() const;
 
+    GC::Ref<MediaPlaybackQuality::VideoPlaybackQuality> get_video_playback_quality() const;
+
 private:
     HTMLVideoElement(DOM::Document&, DOM::QualifiedName);
     virtual void finalize() override;
@@ -120,17 +120,19 @@ void ImageRequest::prepare_for_presentation(HTMLImageElement&)
     // FIXME: 9. Update req's img element's presentation appropriately.
 }
 
-void ImageRequest::fetch_image(GC::Ref<Fetch::Infrastructure::Request> request)
+void ImageRequest::fetch_image(GC::Ref<Fetch::Infrastructure::Request> request, Optional<Gfx::IntSize> ideal_size)
 {
     VERIFY(m_shared_resource_request);
     if (m_shared_resource_request->needs_fetching())
-        m_shared_resource_request->fetch_resource(request);
+        m_shared_resource_request->fetch_resource(request, ideal_size);
+    else
+        m_shared_resource_request->add_consumer_ideal_size(ideal_size);
 }
 
-void ImageRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail)
+void ImageRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partially_available)
 {
     VERIFY(m_shared_resource_request);
-    m_shared_resource_request->add_callbacks(move(on_finish), move(on_fail));
+    m_shared_resource_request->add_callbacks(move(on_finish), move(on_fail), move(on_partially_available));
 }
 
 }
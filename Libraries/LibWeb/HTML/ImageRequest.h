@@ -56,8 +56,8 @@ public:
     // https://html.spec.whatwg.org/multipage/images.html#prepare-an-image-for-presentation
     void prepare_for_presentation(HTMLImageElement&);
 
-    void fetch_image(GC::Ref<Fetch::Infrastructure::Request>);
-    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
+    void fetch_image(GC::Ref<Fetch::Infrastructure::Request>, Optional<Gfx::IntSize> ideal_size = {});
+    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partially_available = {});
 
     GC::Ptr<SharedResourceRequest const> shared_resource_request() const { return m_shared_resource_request; }
 
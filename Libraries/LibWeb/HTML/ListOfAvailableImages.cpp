@@ -57,7 +57,7 @@ void ListOfAvailableImages::remove(Key const& key)
     m_images.remove(key);
 }
 
-void ListOfAvailableImages::prune_to_limits(size_t external_memory_limit, size_t count_limit)
+size_t ListOfAvailableImages::prune_to_limits(size_t external_memory_limit, size_t count_limit)
 {
     struct CacheSize {
         size_t decoded_image_size { 0 };
@@ -79,6 +79,7 @@ void ListOfAvailableImages::prune_to_limits(size_t external_memory_limit, size_t
     };
 
     auto size = cache_size();
+    auto initial_decoded_image_size = size.decoded_image_size;
     while (size.decoded_image_size > external_memory_limit || size.decoded_image_count > count_limit) {
         Optional<Key> least_recently_used_key;
         u64 least_recently_used_serial = NumericLimits<u64>::max();
@@ -103,6 +104,8 @@ void ListOfAvailableImages::prune_to_limits(size_t external_memory_limit, size_t
             break;
         size = new_size;
     }
+
+    return initial_decoded_image_size - size.decoded_image_size;
 }
 
 ListOfAvailableImages::Entry* ListOfAvailableImages::get(Key const& key)
@@ -54,7 +54,7 @@ public:
 
     void add(Key const&, GC::Ref<DecodedImageData>, bool ignore_higher_layer_caching);
     void remove(Key const&);
-    void prune_to_limits(size_t external_memory_limit, size_t count_limit);
+    size_t prune_to_limits(size_t external_memory_limit, size_t count_limit);
     [[nodiscard]] Entry* get(Key const&);
 
     void visit_edges(JS::Cell::Visitor& visitor) override;
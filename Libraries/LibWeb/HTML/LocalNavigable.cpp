@@ -11,6 +11,7 @@
 #include <AK/Utf16StringBuilder.h>
 #include <AK/Variant.h>
 #include <LibCore/Timer.h>
+#include <LibCore/Tracing.h>
 #include <LibGfx/PaintingSurface.h>
 #include <LibWeb/CSS/ComputedValues.h>
 #include <LibWeb/CSS/PropertyID.h>
@@ -4273,7 +4274,10 @@ bool LocalNavigable::has_a_rendering_opportunity() const
     // or whether its active document's visibility state is "visible".
     // Rendering opportunities typically occur at regular intervals.
 
-    // FIXME: Return `false` here if we're an inactive browser tab.
+    // NB: A hidden document (e.g. one in a background tab) is never presented, so don't wake up to render it. Becoming
+    //     visible again requests a new frame.
+    if (auto document = active_document(); document && document->hidden())
+        return false;
     return true;
 }
 
@@ -4697,6 +4701,29 @@ void LocalNavigable::set_should_show_caret_hit_test_debug_overlay(bool value)
         child_navigable->set_should_show_caret_hit_test_debug_overlay(value);
 }
 
+// https://w3c.github.io/paint-timing/#contentful
+// NB: We look at the recorded commands rather than at the paintables, which also leaves out content that is clipped
+//     away or scrolled out of view.
+static bool display_list_has_contentful_paint(Painting::DisplayList const& display_list)
+{
+    bool has_contentful_paint = false;
+    display_list.for_each_command_header([&](auto const& header, auto) {
+        switch (header.command_type) {
+        case Painting::DisplayListCommandType::DrawGlyphRun:
+        case Painting::DisplayListCommandType::DrawScaledDecodedImageFrame:
+        case Painting::DisplayListCommandType::DrawRepeatedDecodedImageFrame:
+        case Painting::DisplayListCommandType::DrawTiledDecodedImageFrame:
+        case Painting::DisplayListCommandType::DrawCanvas:
+        case Painting::DisplayListCommandType::DrawVideoFrame:
+            has_contentful_paint = true;
+            break;
+        default:
+            break;
+        }
+    });
+    return has_contentful_paint;
+}
+
 bool LocalNavigable::record_display_list_and_scroll_state(PaintConfig paint_config, Gfx::IntRect* damage_rect)
 {
     if (!has_compositor_context())
@@ -4719,9 +4746,14 @@ bool LocalNavigable::record_display_list_and_scroll_state(PaintConfig paint_conf
     Optional<Painting::AccumulatedVisualContextTree> visual_context_tree;
     auto& document_paint_state = document->paint_state();
     if (should_record_display_list) {
-        display_list = document->record_display_list(paint_config, m_display_list_resource_storage, Painting::PaintCommandCacheMode::ReadWrite);
+        {
+            PageLoadPhaseTimer timer { page(), PageLoadPhase::Paint };
+            display_list = document->record_display_list(paint_config, m_display_list_resource_storage, Painting::PaintCommandCacheMode::ReadWrite);
+        }
         if (!display_list)
             return false;
+        if (is_top_level_traversable() && !page().page_load_timings().first_contentful_paint.has_value() && display_list_has_contentful_paint(*display_list))
+            page().did_paint_contentful_frame();
         VERIFY(document->has_committed_viewport_box());
         visual_context_tree = document_paint_state.visual_context_tree(*document);
         if (document_paint_state.display_list_used_as_paint_command_cache_source() == display_list.ptr()) {
@@ -4769,6 +4801,7 @@ bool LocalNavigable::record_display_list_and_scroll_state(PaintConfig paint_conf
         m_compositor_visual_context_tree = *visual_context_tree;
         m_compositor_scroll_state_snapshot = scroll_state_snapshot;
         m_compositor_display_list_visual_context_tree_version = display_list->compatible_visual_context_tree_version();
+        Core::Tracing::instant("web", "UpdateDisplayList");
         compositor_context().update_display_list(*display_list, visual_context_tree.release_value(), move(resource_transaction), move(scroll_state_snapshot));
         document_paint_state.did_update_visual_context_tree_in_compositor();
         m_display_list_resource_storage.retain_only(display_list_resources);
@@ -4808,11 +4841,17 @@ void LocalNavigable::paint_next_frame()
 
     m_needs_repaint = false;
 
+    Core::Tracing::Scope trace_scope { "web", "PaintNextFrame" };
+
     Gfx::IntRect damage_rect;
     if (!record_display_list_and_scroll_state(paint_config, &damage_rect))
         return;
     viewport_rect = page().css_to_device_rect(this->viewport_rect()).to_type<int>();
-    compositor_context().present_frame(viewport_rect, damage_rect);
+
+    // The frame ID connects this frame to its rasterization in the Compositor process in traces.
+    auto frame_id = Core::Tracing::is_enabled() ? Core::Tracing::generate_flow_id() : 0;
+    Core::Tracing::flow_start("frame", "Frame", frame_id);
+    compositor_context().present_frame(viewport_rect, damage_rect, frame_id);
 }
 
 void LocalNavigable::render_screenshot(Gfx::PaintingSurface& painting_surface, PaintConfig paint_config, Function<void()>&& callback)
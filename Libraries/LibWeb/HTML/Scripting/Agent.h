@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/String.h>
 #include <LibGC/Root.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Runtime/Agent.h>
@@ -23,6 +24,11 @@ struct WEB_API Agent : public JS::Agent {
     // And the event loop of a worklet agent is known as a worklet event loop.
     GC::Root<HTML::EventLoop> event_loop;
 
+    // https://tc39.es/ecma262/#sec-agent-clusters
+    // AD-HOC: The agents of an agent cluster can live in different processes, so the cluster is identified by a random
+    //         ID rather than by an object. Dedicated workers take on the ID of their owner's agent.
+    String agent_cluster_id;
+
     virtual void spin_event_loop_until(GC::Root<GC::Function<bool()>> goal_condition) override;
 
 protected:
@@ -709,6 +709,7 @@ SerializedEnvironmentSettingsObject EnvironmentSettingsObject::serialize()
         .cross_origin_isolated_capability = cross_origin_isolated_capability(),
         .time_origin = this->time_origin(),
         .global = move(serialized_global),
+        .agent_cluster_id = relevant_agent(global_object()).agent_cluster_id,
     };
 }
 
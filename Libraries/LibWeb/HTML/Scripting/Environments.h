@@ -138,6 +138,7 @@ public:
 
     GC::Ref<StorageAPI::StorageManager> storage_manager();
     GC::Ref<WebLocks::LockManager> lock_manager();
+    GC::Ptr<WebLocks::LockManager> lock_manager_if_exists() const { return m_lock_manager; }
 
     // https://w3c.github.io/ServiceWorker/#get-the-service-worker-registration-object
     GC::Ref<ServiceWorker::ServiceWorkerRegistration> get_service_worker_registration_object(ServiceWorker::Registration const&);
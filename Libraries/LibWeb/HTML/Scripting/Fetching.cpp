@@ -156,7 +156,7 @@ static Optional<BytecodeCacheContext> bytecode_cache_context_for_request(Fetch::
     if (!ResourceLoader::is_initialized() || !ResourceLoader::the().request_client())
         return {};
 
-    auto vary_key = response.javascript_bytecode_cache_vary_key();
+    auto vary_key = response.disk_cache_vary_key();
     if (!vary_key.has_value())
         return {};
 
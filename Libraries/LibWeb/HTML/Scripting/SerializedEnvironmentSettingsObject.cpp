@@ -62,6 +62,7 @@ ErrorOr<void> encode(Encoder& encoder, Web::HTML::SerializedEnvironmentSettingsO
     TRY(encoder.encode(object.cross_origin_isolated_capability));
     TRY(encoder.encode(object.time_origin));
     TRY(encoder.encode(object.global));
+    TRY(encoder.encode(object.agent_cluster_id));
 
     return {};
 }
@@ -81,6 +82,7 @@ ErrorOr<Web::HTML::SerializedEnvironmentSettingsObject> decode(Decoder& decoder)
         .cross_origin_isolated_capability = TRY(decoder.decode<Web::HTML::CanUseCrossOriginIsolatedAPIs>()),
         .time_origin = TRY(decoder.decode<double>()),
         .global = TRY(decoder.decode<Web::HTML::SerializedGlobal>()),
+        .agent_cluster_id = TRY(decoder.decode<String>()),
     };
 }
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/String.h>
 #include <AK/Utf16String.h>
 #include <LibIPC/Forward.h>
 #include <LibURL/Origin.h>
@@ -54,6 +55,9 @@ struct SerializedEnvironmentSettingsObject {
     CanUseCrossOriginIsolatedAPIs cross_origin_isolated_capability;
     double time_origin;
     SerializedGlobal global;
+
+    // The agent cluster of the settings object's agent, which a dedicated worker created from these settings joins.
+    String agent_cluster_id;
 };
 
 }
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibWeb/Crypto/Crypto.h>
 #include <LibWeb/DOM/MutationObserver.h>
 #include <LibWeb/HTML/HTMLSlotElement.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
@@ -18,6 +19,7 @@ NonnullOwnPtr<SimilarOriginWindowAgent> SimilarOriginWindowAgent::create(GC::Hea
     // See 'creating an agent' step in: https://html.spec.whatwg.org/multipage/webappapis.html#obtain-similar-origin-window-agent
     auto agent = adopt_own(*new SimilarOriginWindowAgent(CanBlock::No));
     agent->event_loop = heap.allocate<HTML::EventLoop>(HTML::EventLoop::Type::Window);
+    agent->agent_cluster_id = Crypto::generate_random_uuid();
     return agent;
 }
 
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibWeb/Crypto/Crypto.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/Scripting/WorkerAgent.h>
 
@@ -13,6 +14,10 @@ NonnullOwnPtr<WorkerAgent> WorkerAgent::create(GC::Heap& heap, CanBlock can_bloc
 {
     auto agent = adopt_own(*new WorkerAgent(can_block));
     agent->event_loop = heap.allocate<HTML::EventLoop>(HTML::EventLoop::Type::Worker);
+
+    // NB: Shared and service workers get a new agent cluster. Dedicated workers join their owner's agent cluster once
+    //     they are started, see WorkerHost::run().
+    agent->agent_cluster_id = Crypto::generate_random_uuid();
     return agent;
 }
 
@@ -23,6 +23,7 @@
 #include <LibWeb/HTML/SharedResourceRequest.h>
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 #include <LibWeb/SVG/SVGDecodedImageData.h>
 
@@ -61,6 +62,9 @@ void SharedResourceRequest::finalize()
     m_callbacks.clear();
     m_load_event_delayer.clear();
     m_image_data = nullptr;
+    m_encoded_image_data.clear();
+    if (m_progressive_decode_id.has_value() && Web::Platform::ImageCodecPlugin::is_initialized())
+        Web::Platform::ImageCodecPlugin::the().cancel_progressive_decode(m_progressive_decode_id.release_value());
     m_fetch_controller = nullptr;
 
     if (m_document) {
@@ -81,6 +85,7 @@ void SharedResourceRequest::visit_edges(JS::Cell::Visitor& visitor)
     for (auto& callback : m_callbacks) {
         visitor.visit(callback.on_finish);
         visitor.visit(callback.on_fail);
+        visitor.visit(callback.on_partially_available);
     }
     visitor.visit(m_image_data);
 }
@@ -95,7 +100,7 @@ bool SharedResourceRequest::can_be_pruned_from_memory_cache() const
     // NB: Pruning an image that still has clients (e.g. a live element displaying it) frees no memory, since the
     //     clients keep the decoded data alive, but it forces a refetch if script recreates an element with the
     //     same URL, e.g. when a framework re-renders the page.
-    return m_image_data && !m_image_data->has_clients();
+    return m_state == State::Finished && m_image_data && !m_image_data->has_clients();
 }
 
 void SharedResourceRequest::touch_memory_cache_entry()
@@ -113,11 +118,13 @@ void SharedResourceRequest::set_fetch_controller(GC::Ptr<Fetch::Infrastructure::
     m_fetch_controller = move(fetch_controller);
 }
 
-void SharedResourceRequest::fetch_resource(GC::Ref<Fetch::Infrastructure::Request> request)
+void SharedResourceRequest::fetch_resource(GC::Ref<Fetch::Infrastructure::Request> request, Optional<Gfx::IntSize> ideal_size)
 {
     auto& realm = HTML::relevant_realm(*m_document);
     VERIFY(needs_fetching());
 
+    m_ideal_size = ideal_size;
+
     if (!ResourceLoader::is_initialized()) {
         handle_failed_fetch();
         return;
@@ -136,15 +143,16 @@ void SharedResourceRequest::fetch_resource(GC::Ref<Fetch::Infrastructure::Reques
         //        https://github.com/whatwg/html/issues/9355
         response = response->unsafe_response();
 
-        auto process_body = GC::create_function(GC::Heap::the(), [weak_this, request, response, image_data_is_cors_cross_origin](ByteBuffer data) {
+        auto extracted_mime_type = Fetch::Infrastructure::extract_mime_type(response->header_list());
+        auto const is_svg_image = extracted_mime_type.has_value()
+            ? extracted_mime_type.value().essence() == "image/svg+xml"sv
+            : request->url().basename().ends_with(".svg"sv);
+
+        auto process_body = GC::create_function(GC::Heap::the(), [weak_this, request, is_svg_image, image_data_is_cors_cross_origin](ByteBuffer data) {
             auto self = weak_this.ptr();
             if (!self)
                 return;
 
-            auto extracted_mime_type = Fetch::Infrastructure::extract_mime_type(response->header_list());
-            auto const is_svg_image = extracted_mime_type.has_value()
-                ? extracted_mime_type.value().essence() == "image/svg+xml"sv
-                : request->url().basename().ends_with(".svg"sv);
             self->handle_successful_fetch(request->url(), is_svg_image ? IsSVGImage::Yes : IsSVGImage::No, move(data), image_data_is_cors_cross_origin);
         });
         auto process_body_error = GC::create_function(GC::Heap::the(), [weak_this](JS::Value) {
@@ -161,6 +169,42 @@ void SharedResourceRequest::fetch_resource(GC::Ref<Fetch::Infrastructure::Reques
             return;
         }
 
+        // Bitmap images are decoded while their data arrives, so that what has been received so far can be shown.
+        if (!is_svg_image && extracted_mime_type.has_value()) {
+            auto progressive_decode_id = Web::Platform::ImageCodecPlugin::the().begin_progressive_decode(extracted_mime_type->essence(), self->m_ideal_size, [weak_this, image_data_is_cors_cross_origin](Gfx::IntSize natural_size, NonnullRefPtr<Gfx::Bitmap> bitmap) {
+                if (auto self = weak_this.ptr())
+                    self->handle_partial_bitmap_decode(natural_size, *bitmap, image_data_is_cors_cross_origin);
+            });
+
+            if (progressive_decode_id.has_value()) {
+                self->m_progressive_decode_id = progressive_decode_id;
+                self->m_retains_encoded_image_data = self->m_ideal_size.has_value();
+
+                auto process_body_chunk = GC::create_function(GC::Heap::the(), [weak_this](ByteBuffer chunk) {
+                    if (auto self = weak_this.ptr())
+                        self->append_progressive_decode_data(move(chunk));
+                });
+                auto process_end_of_body = GC::create_function(GC::Heap::the(), [weak_this, image_data_is_cors_cross_origin] {
+                    if (auto self = weak_this.ptr())
+                        self->finish_progressive_decode(image_data_is_cors_cross_origin);
+                });
+                auto process_progressive_body_error = GC::create_function(GC::Heap::the(), [weak_this](JS::Value) {
+                    auto self = weak_this.ptr();
+                    if (!self)
+                        return;
+
+                    if (self->m_progressive_decode_id.has_value())
+                        Web::Platform::ImageCodecPlugin::the().cancel_progressive_decode(self->m_progressive_decode_id.release_value());
+                    self->m_image_data = nullptr;
+                    self->m_encoded_image_data.clear();
+                    self->handle_failed_fetch();
+                });
+
+                response->body()->incrementally_read(realm, process_body_chunk, process_end_of_body, process_progressive_body_error, GC::Ref { realm.global_object() });
+                return;
+            }
+        }
+
         response->body()->fully_read(realm, process_body, process_body_error, GC::Ref { realm.global_object() });
     };
 
@@ -175,7 +219,22 @@ void SharedResourceRequest::fetch_resource(GC::Ref<Fetch::Infrastructure::Reques
     set_fetch_controller(fetch_controller);
 }
 
-void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail)
+void SharedResourceRequest::add_consumer_ideal_size(Optional<Gfx::IntSize> ideal_size)
+{
+    // NB: An image decoded at its natural size already covers every consumer.
+    if (!m_ideal_size.has_value())
+        return;
+
+    if (ideal_size.has_value())
+        m_ideal_size = Gfx::IntSize { max(m_ideal_size->width(), ideal_size->width()), max(m_ideal_size->height(), ideal_size->height()) };
+    else
+        m_ideal_size.clear();
+
+    if (m_state == State::Finished && !image_covers_ideal_size())
+        decode_image_at_natural_size();
+}
+
+void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partially_available)
 {
     if (m_state == State::Finished) {
         if (on_finish)
@@ -189,11 +248,18 @@ void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<v
         return;
     }
 
+    if (m_image_data && on_partially_available) {
+        on_partially_available();
+        on_partially_available = nullptr;
+    }
+
     Callbacks callbacks;
     if (on_finish)
         callbacks.on_finish = GC::create_function(GC::Heap::the(), move(on_finish));
     if (on_fail)
         callbacks.on_fail = GC::create_function(GC::Heap::the(), move(on_fail));
+    if (on_partially_available)
+        callbacks.on_partially_available = GC::create_function(GC::Heap::the(), move(on_partially_available));
 
     m_callbacks.append(move(callbacks));
 }
@@ -215,47 +281,186 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
         return;
     }
 
-    auto handle_successful_bitmap_decode = [strong_this = GC::Root(*this), image_data_is_cors_cross_origin](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
-        if (result.session_id != 0) {
-            // Streaming animated decode: create AnimatedBitmapDecodedImageData.
-            Vector<NonnullRefPtr<Gfx::Bitmap>> initial_bitmaps;
-            initial_bitmaps.ensure_capacity(result.frames.size());
-            for (auto& frame : result.frames)
-                initial_bitmaps.unchecked_append(*frame.bitmap);
-
-            auto first_bitmap = result.frames.first().bitmap;
-            auto size = first_bitmap->size();
-
-            strong_this->m_image_data = AnimatedBitmapDecodedImageData::create(
-                *strong_this->m_document,
-                result.session_id,
-                result.frame_count,
-                result.loop_count,
-                size,
-                move(result.color_space),
-                move(result.all_durations),
-                move(initial_bitmaps));
-        } else {
-            // Single-shot decode: create BitmapDecodedImageData as before.
-            Vector<BitmapDecodedImageData::Frame> frames;
-            for (auto& frame : result.frames) {
-                frames.append(BitmapDecodedImageData::Frame {
-                    .frame = Gfx::DecodedImageFrame { *frame.bitmap, result.color_space },
-                    .duration = static_cast<int>(frame.duration),
-                });
-            }
-            strong_this->m_image_data = BitmapDecodedImageData::create(move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
-        }
-        strong_this->m_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
-        strong_this->handle_successful_resource_load();
+    auto handle_decoded_image = [strong_this = GC::Root(*this), image_data_is_cors_cross_origin](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
+        strong_this->handle_successful_bitmap_decode(result, image_data_is_cors_cross_origin);
         return {};
     };
 
     auto handle_failed_decode = [strong_this = GC::Root(*this)](Error&) -> void {
+        strong_this->m_encoded_image_data.clear();
         strong_this->handle_failed_fetch();
     };
 
-    (void)Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode));
+    (void)Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes(), move(handle_decoded_image), move(handle_failed_decode), m_ideal_size);
+
+    // NB: The encoded data is only needed again if the image ends up decoded below its natural size.
+    if (m_ideal_size.has_value() && is_fetching())
+        m_encoded_image_data = move(data);
+}
+
+void SharedResourceRequest::handle_successful_bitmap_decode(Web::Platform::DecodedImage& result, bool image_data_is_cors_cross_origin)
+{
+    if (result.session_id != 0) {
+        // Streaming animated decode: create AnimatedBitmapDecodedImageData.
+        Vector<NonnullRefPtr<Gfx::Bitmap>> initial_bitmaps;
+        initial_bitmaps.ensure_capacity(result.frames.size());
+        for (auto& frame : result.frames)
+            initial_bitmaps.unchecked_append(*frame.bitmap);
+
+        auto first_bitmap = result.frames.first().bitmap;
+        auto size = first_bitmap->size();
+
+        m_image_data = AnimatedBitmapDecodedImageData::create(
+            *m_document,
+            result.session_id,
+            result.frame_count,
+            result.loop_count,
+            size,
+            move(result.color_space),
+            move(result.all_durations),
+            move(initial_bitmaps));
+    } else if (auto partial_image_data = as_if<BitmapDecodedImageData>(m_image_data.ptr())) {
+        // The partially loaded image is already being shown, so complete it in place.
+        partial_image_data->set_frame(Gfx::DecodedImageFrame { *result.frames.first().bitmap, result.color_space }, result.natural_size);
+    } else {
+        // Single-shot decode: create BitmapDecodedImageData as before.
+        Vector<BitmapDecodedImageData::Frame> frames;
+        for (auto& frame : result.frames) {
+            frames.append(BitmapDecodedImageData::Frame {
+                .frame = Gfx::DecodedImageFrame { *frame.bitmap, result.color_space },
+                .duration = static_cast<int>(frame.duration),
+            });
+        }
+        m_image_data = BitmapDecodedImageData::create(move(frames), result.loop_count, result.is_animated, result.natural_size).release_value_but_fixme_should_propagate_errors();
+    }
+
+    if (auto image_data = as_if<BitmapDecodedImageData>(m_image_data.ptr()); image_data && image_data->is_decoded_below_natural_size()) {
+        image_data->set_on_natural_size_frame_needed(GC::create_function(GC::Heap::the(), [weak_this = GC::Weak { *this }] {
+            // NB: This is called while painting, so the decode is started afterwards.
+            Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(GC::Heap::the(), [weak_this] {
+                if (auto self = weak_this.ptr())
+                    self->decode_image_at_natural_size();
+            }));
+        }));
+        image_data->set_on_natural_size_frame_needed_now(GC::create_function(GC::Heap::the(), [weak_this = GC::Weak { *this }] {
+            if (auto self = weak_this.ptr())
+                self->decode_image_at_natural_size_now();
+        }));
+
+        // NB: A consumer that needs the image larger may have been added while it was being decoded.
+        if (!image_covers_ideal_size())
+            decode_image_at_natural_size();
+    } else {
+        m_encoded_image_data.clear();
+    }
+
+    m_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
+    handle_successful_resource_load();
+}
+
+void SharedResourceRequest::handle_partial_bitmap_decode(Gfx::IntSize natural_size, Gfx::Bitmap const& bitmap, bool image_data_is_cors_cross_origin)
+{
+    if (m_state != State::Fetching)
+        return;
+
+    if (auto image_data = as_if<BitmapDecodedImageData>(m_image_data.ptr())) {
+        image_data->set_frame(Gfx::DecodedImageFrame { bitmap }, natural_size);
+        return;
+    }
+
+    Vector<BitmapDecodedImageData::Frame> frames;
+    frames.append({ .frame = Gfx::DecodedImageFrame { bitmap } });
+    m_image_data = BitmapDecodedImageData::create(move(frames), 0, false, natural_size).release_value_but_fixme_should_propagate_errors();
+    m_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
+
+    for (auto& callback : m_callbacks) {
+        if (callback.on_partially_available)
+            callback.on_partially_available->function()();
+    }
+}
+
+void SharedResourceRequest::append_progressive_decode_data(ByteBuffer chunk)
+{
+    if (!m_progressive_decode_id.has_value())
+        return;
+
+    Web::Platform::ImageCodecPlugin::the().append_progressive_decode_data(*m_progressive_decode_id, chunk);
+
+    // NB: The encoded data is only needed again if the image ends up decoded below its natural size.
+    if (m_retains_encoded_image_data)
+        m_encoded_image_data.append(chunk);
+}
+
+void SharedResourceRequest::finish_progressive_decode(bool image_data_is_cors_cross_origin)
+{
+    if (!m_progressive_decode_id.has_value())
+        return;
+
+    (void)Web::Platform::ImageCodecPlugin::the().finish_progressive_decode(
+        m_progressive_decode_id.release_value(),
+        [strong_this = GC::Root(*this), image_data_is_cors_cross_origin](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
+            strong_this->handle_successful_bitmap_decode(result, image_data_is_cors_cross_origin);
+            return {};
+        },
+        [strong_this = GC::Root(*this)](Error&) {
+            strong_this->m_image_data = nullptr;
+            strong_this->m_encoded_image_data.clear();
+            strong_this->handle_failed_fetch();
+        });
+}
+
+void SharedResourceRequest::decode_image_at_natural_size()
+{
+    auto image_data = as_if<BitmapDecodedImageData>(m_image_data.ptr());
+    if (!image_data || !image_data->is_decoded_below_natural_size() || m_encoded_image_data.is_empty() || m_is_decoding_image_at_natural_size)
+        return;
+
+    m_is_decoding_image_at_natural_size = true;
+    (void)Web::Platform::ImageCodecPlugin::the().decode_image(
+        m_encoded_image_data.bytes(),
+        [weak_this = GC::Weak { *this }](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
+            if (auto self = weak_this.ptr()) {
+                self->m_is_decoding_image_at_natural_size = false;
+                self->handle_natural_size_bitmap_decode(result);
+            }
+            return {};
+        },
+        [weak_this = GC::Weak { *this }](Error&) {
+            // NB: The smaller frame keeps being painted. Reading the image's pixels tries to decode it again.
+            if (auto self = weak_this.ptr())
+                self->m_is_decoding_image_at_natural_size = false;
+        });
+}
+
+void SharedResourceRequest::decode_image_at_natural_size_now()
+{
+    if (m_encoded_image_data.is_empty())
+        return;
+
+    auto result = Web::Platform::ImageCodecPlugin::the().decode_first_frame_synchronously(m_encoded_image_data.bytes());
+    if (result.has_value())
+        handle_natural_size_bitmap_decode(*result);
+}
+
+void SharedResourceRequest::handle_natural_size_bitmap_decode(Web::Platform::DecodedImage& result)
+{
+    auto image_data = as_if<BitmapDecodedImageData>(m_image_data.ptr());
+    if (!image_data || !image_data->is_decoded_below_natural_size() || result.frames.is_empty() || !result.frames.first().bitmap)
+        return;
+
+    m_encoded_image_data.clear();
+    image_data->set_frame(Gfx::DecodedImageFrame { *result.frames.first().bitmap, move(result.color_space) }, result.natural_size);
+}
+
+bool SharedResourceRequest::image_covers_ideal_size() const
+{
+    auto image_data = as_if<BitmapDecodedImageData>(m_image_data.ptr());
+    if (!image_data || !image_data->is_decoded_below_natural_size())
+        return true;
+    if (!m_ideal_size.has_value())
+        return false;
+    auto frame_size = image_data->frame_size();
+    return frame_size.width() >= m_ideal_size->width() && frame_size.height() >= m_ideal_size->height();
 }
 
 void SharedResourceRequest::handle_failed_fetch()
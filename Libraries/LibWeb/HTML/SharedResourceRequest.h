@@ -8,6 +8,8 @@
 
 #include <LibGC/Function.h>
 #include <LibGC/Ptr.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Size.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibURL/URL.h>
 #include <LibWeb/DOM/DocumentLoadEventDelayer.h>
@@ -36,9 +38,17 @@ public:
     [[nodiscard]] GC::Ptr<Fetch::Infrastructure::FetchController> fetch_controller();
     void set_fetch_controller(GC::Ptr<Fetch::Infrastructure::FetchController>);
 
-    void fetch_resource(GC::Ref<Fetch::Infrastructure::Request>);
+    // The ideal size is the size in device pixels the image is expected to be displayed at, if known. Still images
+    // may then be decoded to that size rather than their natural size, and are decoded again at their natural size
+    // if it turns out to be needed.
+    void fetch_resource(GC::Ref<Fetch::Infrastructure::Request>, Optional<Gfx::IntSize> ideal_size = {});
 
-    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
+    // Called by each further consumer of an already fetched or fetching resource. The image is decoded to the largest
+    // ideal size of all its consumers, or at its natural size if any of them has none.
+    void add_consumer_ideal_size(Optional<Gfx::IntSize>);
+
+    // on_partially_available is called once a partially loaded image can be shown, see image_data().
+    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partially_available = {});
 
     bool is_fetching() const;
     bool needs_fetching() const;
@@ -55,6 +65,14 @@ private:
     };
 
     void handle_successful_fetch(URL::URL const&, IsSVGImage, ByteBuffer data, bool image_data_is_cors_cross_origin);
+    void handle_successful_bitmap_decode(Platform::DecodedImage&, bool image_data_is_cors_cross_origin);
+    void handle_partial_bitmap_decode(Gfx::IntSize natural_size, Gfx::Bitmap const&, bool image_data_is_cors_cross_origin);
+    void append_progressive_decode_data(ByteBuffer);
+    void finish_progressive_decode(bool image_data_is_cors_cross_origin);
+    void decode_image_at_natural_size();
+    void decode_image_at_natural_size_now();
+    void handle_natural_size_bitmap_decode(Platform::DecodedImage&);
+    bool image_covers_ideal_size() const;
     void handle_failed_fetch();
     void handle_successful_resource_load();
 
@@ -72,11 +90,22 @@ private:
     struct Callbacks {
         GC::Ptr<GC::Function<void()>> on_finish;
         GC::Ptr<GC::Function<void()>> on_fail;
+        GC::Ptr<GC::Function<void()>> on_partially_available;
     };
     Vector<Callbacks> m_callbacks;
 
     URL::URL m_url;
+    Optional<Gfx::IntSize> m_ideal_size;
+    Optional<i64> m_progressive_decode_id;
+
+    // While fetching, this is the partially loaded image, if any has been decoded yet.
     GC::Ptr<DecodedImageData> m_image_data;
+
+    // Kept for images decoded below their natural size, until they have been decoded at it.
+    ByteBuffer m_encoded_image_data;
+    bool m_retains_encoded_image_data { false };
+    bool m_is_decoding_image_at_natural_size { false };
+
     GC::Ptr<Fetch::Infrastructure::FetchController> m_fetch_controller;
     u64 m_cache_touch_serial { 0 };
 
@@ -72,6 +72,7 @@
 #include <LibWeb/HTML/ImageBitmap.h>
 #include <LibWeb/HTML/ImageData.h>
 #include <LibWeb/HTML/MessagePort.h>
+#include <LibWeb/HTML/Scripting/Agent.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
@@ -347,6 +348,10 @@ public:
     virtual void encode(Utf16String const&) = 0;
     virtual void encode(ByteBuffer const&) = 0;
     virtual void encode(ReadonlyBytes) = 0;
+    virtual void encode_gathered_bytes(ReadonlySpan<ReadonlyBytes>) = 0;
+
+    // Memory that is shared with the receiving agent rather than copied. Only IPC records can carry it.
+    virtual void encode(Core::AnonymousBuffer const&) { VERIFY_NOT_REACHED(); }
 
     virtual void append(IPCSerializationRecord&&) { VERIFY_NOT_REACHED(); }
     virtual IPCSerializationRecord take_ipc_record() { VERIFY_NOT_REACHED(); }
@@ -372,6 +377,8 @@ public:
     virtual ErrorOr<void> decode(double&) = 0;
     virtual ErrorOr<void> decode(Utf16String&) = 0;
     virtual ErrorOr<void> decode(ByteBuffer&) = 0;
+
+    virtual ErrorOr<void> decode(Core::AnonymousBuffer&) { return Error::from_string_literal("Structured serialize record cannot carry shared memory"); }
 };
 
 class IPCStructuredSerializeDataEncoder final : public StructuredSerializeDataEncoder {
@@ -389,25 +396,34 @@ public:
     virtual void encode(Utf16String const& value) override { MUST(m_encoder.encode(value)); }
     virtual void encode(ByteBuffer const& value) override { MUST(m_encoder.encode(value)); }
     virtual void encode(ReadonlyBytes value) override { MUST(m_encoder.encode(value)); }
+    virtual void encode_gathered_bytes(ReadonlySpan<ReadonlyBytes> parts) override { m_encoder.encode_gathered_bytes(parts); }
+
+    // NB: Shared memory travels next to the data rather than inline, and is decoded in the order it was encoded.
+    virtual void encode(Core::AnonymousBuffer const& value) override { m_shared_memory.append(SerializedSharedMemory { value }); }
 
     virtual void append(IPCSerializationRecord&& record) override
     {
+        m_shared_memory.extend(move(record.shared_memory));
         m_encoder.append(move(record));
     }
 
     virtual IPCSerializationRecord take_ipc_record() override
     {
-        return IPCSerializationRecord { m_encoder.take_buffer().take_data() };
+        IPCSerializationRecord record { m_encoder.take_buffer().take_data() };
+        record.shared_memory = move(m_shared_memory);
+        return record;
     }
 
 private:
     TransferDataEncoder m_encoder;
+    Vector<SerializedSharedMemory> m_shared_memory;
 };
 
 class IPCStructuredSerializeDataDecoder final : public StructuredSerializeDataDecoder {
 public:
     explicit IPCStructuredSerializeDataDecoder(IPCSerializationRecord const& record)
         : m_decoder(record)
+        , m_shared_memory(record.shared_memory)
     {
     }
 
@@ -433,6 +449,14 @@ public:
         return {};
     }
 
+    virtual ErrorOr<void> decode(Core::AnonymousBuffer& value) override
+    {
+        if (m_next_shared_memory_index >= m_shared_memory.size())
+            return Error::from_string_literal("Structured serialize record is missing shared memory");
+        value = TRY(m_shared_memory[m_next_shared_memory_index++].map());
+        return {};
+    }
+
 private:
     template<typename T>
     ErrorOr<void> decode_from_ipc(T& value)
@@ -442,6 +466,8 @@ private:
     }
 
     TransferDataDecoder m_decoder;
+    Vector<SerializedSharedMemory> m_shared_memory;
+    size_t m_next_shared_memory_index { 0 };
 };
 
 class StorageStructuredSerializeDataEncoder final : public StructuredSerializeDataEncoder {
@@ -497,6 +523,16 @@ public:
         m_data.append(bytes.data(), bytes.size());
     }
 
+    virtual void encode_gathered_bytes(ReadonlySpan<ReadonlyBytes> parts) override
+    {
+        u64 size = 0;
+        for (auto part : parts)
+            size += part.size();
+        encode(size);
+        for (auto part : parts)
+            m_data.append(part.data(), part.size());
+    }
+
     virtual StorageSerializationRecord take_storage_record() override
     {
         return StorageSerializationRecord { move(m_data) };
@@ -832,6 +868,11 @@ void StructuredSerializeWriter::encode(T const& value)
     encode_value(*m_encoder, value);
 }
 
+void StructuredSerializeWriter::encode_gathered_bytes(ReadonlySpan<ReadonlyBytes> parts)
+{
+    m_encoder->encode_gathered_bytes(parts);
+}
+
 void StructuredSerializeWriter::append(IPCSerializationRecord&& record)
 {
     m_encoder->append(move(record));
@@ -1173,7 +1214,7 @@ static GC::Ref<WebIDL::DOMException> data_clone_error(Utf16String message)
 }
 
 // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializeinternal
-static WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, StructuredSerializeWriter& data_holder, JS::ArrayBuffer const& array_buffer, bool for_storage)
+static WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, StructuredSerializeWriter& data_holder, JS::ArrayBuffer& array_buffer, bool for_storage)
 {
     // 13. Otherwise, if value has an [[ArrayBufferData]] internal slot, then:
 
@@ -1189,20 +1230,33 @@ static WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, StructuredSe
         if (for_storage)
             return data_clone_error("Cannot serialize SharedArrayBuffer for storage"_utf16);
 
+        // NB: [[ArrayBufferData]] is shared with the receiving agent, which may live in another process. Its bytes and its
+        //     [[ArrayBufferByteLengthData]] are moved into memory that the receiver can map, and that memory is sent
+        //     instead of a copy.
+        auto shared_memory_block = array_buffer.ensure_shared_memory_block();
+        if (shared_memory_block.is_error())
+            return data_clone_error_from_serialization_error(*vm.current_realm(), shared_memory_block.error());
+        auto const& shared_memory = shared_memory_block.value()->anonymous_buffer();
+        auto agent_cluster_id = Utf16String::from_utf8(static_cast<Agent&>(*vm.agent()).agent_cluster_id);
+
+        // NB: [[AgentCluster]] is encoded ahead of [[ArrayBufferData]], so that a receiver outside of the agent cluster can
+        //     refuse the memory without mapping it.
         if (!array_buffer.is_fixed_length()) {
             // 3. If value has an [[ArrayBufferMaxByteLength]] internal slot, then set serialized to { [[Type]]: "GrowableSharedArrayBuffer",
             //           [[ArrayBufferData]]: value.[[ArrayBufferData]], [[ArrayBufferByteLengthData]]: value.[[ArrayBufferByteLengthData]],
             //           [[ArrayBufferMaxByteLength]]: value.[[ArrayBufferMaxByteLength]],
-            //           FIXME: [[AgentCluster]]: the surrounding agent's agent cluster }.
+            //           [[AgentCluster]]: the surrounding agent's agent cluster }.
             data_holder.encode(ValueTag::GrowableSharedArrayBuffer);
-            data_holder.encode(MUST(array_buffer.copy_to_byte_buffer()));
+            data_holder.encode(agent_cluster_id);
+            data_holder.encode(shared_memory);
             data_holder.encode(static_cast<u64>(array_buffer.max_byte_length()));
         } else {
             // 4. Otherwise, set serialized to { [[Type]]: "SharedArrayBuffer", [[ArrayBufferData]]: value.[[ArrayBufferData]],
             //           [[ArrayBufferByteLength]]: value.[[ArrayBufferByteLength]],
-            //           FIXME: [[AgentCluster]]: the surrounding agent's agent cluster }.
+            //           [[AgentCluster]]: the surrounding agent's agent cluster }.
             data_holder.encode(ValueTag::SharedArrayBuffer);
-            data_holder.encode(MUST(array_buffer.copy_to_byte_buffer()));
+            data_holder.encode(agent_cluster_id);
+            data_holder.encode(shared_memory);
         }
     }
     // 2. Otherwise:
@@ -1403,7 +1457,7 @@ public:
             }
 
             // 13. Otherwise, if value has an [[ArrayBufferData]] internal slot, then:
-            else if (auto const* array_buffer = as_if<JS::ArrayBuffer>(*object)) {
+            else if (auto* array_buffer = as_if<JS::ArrayBuffer>(*object)) {
                 TRY(serialize_array_buffer(m_vm, serialized, *array_buffer, m_for_storage));
             }
 
@@ -1677,6 +1731,19 @@ public:
             return JS::BigInt::create(m_vm, TRY(decode_signed_big_integer(m_serialized, realm)));
         };
 
+        auto decode_shared_memory_block = [&]() -> WebIDL::ExceptionOr<NonnullRefPtr<JS::SharedMemoryBlock>> {
+            // 1. If targetRealm's corresponding agent cluster is not serialized.[[AgentCluster]], then throw a "DataCloneError" DOMException.
+            auto agent_cluster_id = TRY(decode<Utf16String>());
+            if (agent_cluster_id != Utf16String::from_utf8(static_cast<Agent&>(*realm.vm().agent()).agent_cluster_id))
+                return data_clone_error("Cannot deserialize SharedArrayBuffer outside of its agent cluster"_utf16);
+
+            auto shared_memory = TRY(decode<Core::AnonymousBuffer>());
+            auto block = JS::SharedMemoryBlock::create_from_anonymous_buffer(move(shared_memory));
+            if (block.is_error())
+                return data_clone_error_from_serialization_error(realm, block.error());
+            return block.release_value();
+        };
+
         switch (tag) {
         // 5. If serialized.[[Type]] is "primitive", then set value to serialized.[[Value]].
         case ValueTag::UndefinedPrimitive:
@@ -1748,26 +1815,30 @@ public:
 
         // 12. Otherwise, if serialized.[[Type]] is "SharedArrayBuffer", then:
         case ValueTag::SharedArrayBuffer: {
-            // FIXME: 1. If targetRealm's corresponding agent cluster is not serialized.[[AgentCluster]], then throw a "DataCloneError" DOMException.
+            // 1. If targetRealm's corresponding agent cluster is not serialized.[[AgentCluster]], then throw a "DataCloneError" DOMException.
+            //    See decode_shared_memory_block().
 
             // 2. Otherwise, set value to a new SharedArrayBuffer object in targetRealm whose [[ArrayBufferData]] internal slot value is serialized.[[ArrayBufferData]]
             //    and whose [[ArrayBufferByteLength]] internal slot value is serialized.[[ArrayBufferByteLength]].
-            auto buffer = TRY(decode<ByteBuffer>());
-            value = JS::ArrayBuffer::create(realm, move(buffer), JS::DataBlock::Shared::Yes);
+            auto block = TRY(decode_shared_memory_block());
+            value = JS::ArrayBuffer::create(realm, JS::DataBlock { JS::DataBlock::SharedMemoryStorage { move(block) }, JS::DataBlock::Shared::Yes });
             break;
         }
 
         // 13. Otherwise, if serialized.[[Type]] is "GrowableSharedArrayBuffer", then:
         case ValueTag::GrowableSharedArrayBuffer: {
-            // FIXME: 1. If targetRealm's corresponding agent cluster is not serialized.[[AgentCluster]], then throw a "DataCloneError" DOMException.
+            // 1. If targetRealm's corresponding agent cluster is not serialized.[[AgentCluster]], then throw a "DataCloneError" DOMException.
+            //    See decode_shared_memory_block().
 
             // 2. Otherwise, set value to a new SharedArrayBuffer object in targetRealm whose [[ArrayBufferData]] internal slot value is serialized.[[ArrayBufferData]],
             //    whose [[ArrayBufferByteLengthData]] internal slot value is serialized.[[ArrayBufferByteLengthData]],
             //    and whose [[ArrayBufferMaxByteLength]] internal slot value is serialized.[[ArrayBufferMaxByteLength]].
-            auto buffer = TRY(decode<ByteBuffer>());
+            auto block = TRY(decode_shared_memory_block());
             auto max_byte_length = TRY(decode<size_t>());
+            if (max_byte_length != block->max_byte_length())
+                return data_clone_error_from_serialization_error(realm, AK::Error::from_string_literal("GrowableSharedArrayBuffer does not match its shared memory"));
 
-            auto data = JS::ArrayBuffer::create(realm, move(buffer), JS::DataBlock::Shared::Yes);
+            auto data = JS::ArrayBuffer::create(realm, JS::DataBlock { JS::DataBlock::SharedMemoryStorage { move(block) }, JS::DataBlock::Shared::Yes });
             data->set_max_byte_length(max_byte_length);
 
             value = data;
@@ -2051,6 +2122,24 @@ private:
     DeserializationMemory& m_memory;
 };
 
+// Copying small buffers is cheaper than creating a mapping for them, and keeps their bytes in the GC cage.
+static constexpr size_t minimum_byte_length_to_transfer_without_copying = 64 * KiB;
+
+static bool should_transfer_array_buffer_without_copying(JS::ArrayBuffer const& array_buffer)
+{
+    // Buffers that live in a mapping already, e.g. because they were received through a transfer themselves, are
+    // passed along as they are.
+    if (array_buffer.transferable_memory_block())
+        return true;
+
+    // NB: Buffers that cannot be detached are left alone, DetachArrayBuffer() throws for them after this anyway. The
+    //     bytes of external buffers are owned by their host object, so they cannot move into a mapping.
+    if (!array_buffer.detach_key().is_undefined() || array_buffer.is_external())
+        return false;
+
+    return array_buffer.byte_length() >= minimum_byte_length_to_transfer_without_copying;
+}
+
 // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializewithtransfer
 WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer(JS::Realm& realm, JS::Value value, ReadonlySpan<GC::Ref<JS::Object>> transfer_list)
 {
@@ -2112,16 +2201,34 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
 
         // 4. If transferable has an [[ArrayBufferData]] internal slot, then:
         if (array_buffer) {
-            // 1. If transferable has an [[ArrayBufferMaxByteLength]] internal slot, then:
-            auto buffer_data = MUST(array_buffer->copy_to_byte_buffer());
+            auto encode_array_buffer_data = [&]() -> WebIDL::ExceptionOr<void> {
+                if (!should_transfer_array_buffer_without_copying(*array_buffer)) {
+                    MUST(data_holder.encode(false));
+                    MUST(data_holder.encode(MUST(array_buffer->copy_to_byte_buffer())));
+                    return {};
+                }
 
+                // NB: The data block is handed over as a mapping that the receiver adopts, instead of being copied into
+                //     the data holder. Detaching the ArrayBuffer below then drops our reference to the mapping.
+                auto block = array_buffer->ensure_transferable_memory_block();
+                if (block.is_error())
+                    return WebIDL::DataCloneError::create(Utf16String::formatted("Unable to transfer buffer: {}", block.error()));
+
+                MUST(data_holder.encode(true));
+                if (auto result = data_holder.encode(block.value()->anonymous_buffer()); result.is_error())
+                    return WebIDL::DataCloneError::create(Utf16String::formatted("Unable to transfer buffer: {}", result.error()));
+                MUST(data_holder.encode(block.value()->byte_length()));
+                return {};
+            };
+
+            // 1. If transferable has an [[ArrayBufferMaxByteLength]] internal slot, then:
             if (!array_buffer->is_fixed_length()) {
                 // 1. Set dataHolder.[[Type]] to "ResizableArrayBuffer".
                 MUST(data_holder.encode(TransferType::ResizableArrayBuffer));
 
                 // 2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
                 // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
-                MUST(data_holder.encode(buffer_data));
+                TRY(encode_array_buffer_data());
 
                 // 4. Set dataHolder.[[ArrayBufferMaxByteLength]] to transferable.[[ArrayBufferMaxByteLength]].
                 MUST(data_holder.encode(array_buffer->max_byte_length()));
@@ -2133,7 +2240,7 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
 
                 // 2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
                 // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
-                MUST(data_holder.encode(buffer_data));
+                TRY(encode_array_buffer_data());
             }
 
             // 3. Perform ? DetachArrayBuffer(transferable).
@@ -2226,6 +2333,24 @@ WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_tran
 
 // AD-HOC: This non-standard overload is meant to extract just one transferrable value from a serialized transfer record.
 //         It's primarily useful for an object's transfer receiving steps to deserialize a nested value.
+static WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> decode_transferred_array_buffer(TransferDataDecoder& decoder, JS::Realm& target_realm)
+{
+    auto is_mapped = TRY(decode_or_throw_data_clone_error<bool>(target_realm, decoder));
+    if (!is_mapped) {
+        auto buffer = TRY(decoder.decode_buffer());
+        return JS::ArrayBuffer::create(target_realm, move(buffer));
+    }
+
+    auto anonymous_buffer = TRY(decode_or_throw_data_clone_error<Core::AnonymousBuffer>(target_realm, decoder));
+    auto byte_length = TRY(decode_or_throw_data_clone_error<size_t>(target_realm, decoder));
+
+    auto block = JS::TransferableMemoryBlock::create_from_anonymous_buffer(move(anonymous_buffer), byte_length);
+    if (block.is_error())
+        return WebIDL::DataCloneError::create(Utf16String::formatted("Invalid transferred buffer: {}", block.error()));
+
+    return JS::ArrayBuffer::create(target_realm, JS::DataBlock { JS::DataBlock::TransferableMemoryStorage { block.release_value() }, JS::DataBlock::Shared::No });
+}
+
 WebIDL::ExceptionOr<JS::Value> structured_deserialize_with_transfer_internal(TransferDataDecoder& decoder, JS::Realm& target_realm)
 {
     auto type = TRY(decode_or_throw_data_clone_error<TransferType>(target_realm, decoder));
@@ -2241,8 +2366,7 @@ WebIDL::ExceptionOr<JS::Value> structured_deserialize_with_transfer_internal(Tra
     //       [[ArrayBufferData]] is instead just getting transferred into the new ArrayBuffer. This could be true, for example,
     //       when both the source and target realms are in the same process.
     if (type == TransferType::ArrayBuffer) {
-        auto buffer = TRY(decoder.decode_buffer());
-        value = JS::ArrayBuffer::create(target_realm, move(buffer));
+        value = TRY(decode_transferred_array_buffer(decoder, target_realm));
     }
 
     // 3. Otherwise, if transferDataHolder.[[Type]] is "ResizableArrayBuffer", then set value to a new ArrayBuffer object
@@ -2251,10 +2375,14 @@ WebIDL::ExceptionOr<JS::Value> structured_deserialize_with_transfer_internal(Tra
     //     [[ArrayBufferMaxByteLength]] internal slot value is transferDataHolder.[[ArrayBufferMaxByteLength]].
     // NOTE: For the same reason as the previous step, this step is also unlikely to throw an exception.
     else if (type == TransferType::ResizableArrayBuffer) {
-        auto buffer = TRY(decoder.decode_buffer());
+        auto data = TRY(decode_transferred_array_buffer(decoder, target_realm));
         auto max_byte_length = TRY(decode_or_throw_data_clone_error<size_t>(target_realm, decoder));
 
-        auto data = JS::ArrayBuffer::create(target_realm, move(buffer));
+        // NB: A mapping cannot grow, so it has to cover the maximum byte length already.
+        if (max_byte_length < data->byte_length())
+            return WebIDL::DataCloneError::create("Invalid transferred buffer"_utf16);
+        if (auto block = data->transferable_memory_block(); block && max_byte_length > block->capacity())
+            return WebIDL::DataCloneError::create("Invalid transferred buffer"_utf16);
         data->set_max_byte_length(max_byte_length);
 
         value = data;
@@ -2374,6 +2502,19 @@ void TransferDataEncoder::encode_unsigned_big_integer(::Crypto::UnsignedBigInteg
     MUST(m_encoder.encode(buffer));
 }
 
+void TransferDataEncoder::encode_gathered_bytes(ReadonlySpan<ReadonlyBytes> parts)
+{
+    VERIFY(!m_buffer_has_been_taken);
+
+    // NB: This matches the wire format of a ByteBuffer, so the parts decode as a single one.
+    size_t size = 0;
+    for (auto part : parts)
+        size += part.size();
+    MUST(m_encoder.encode_size(size));
+    for (auto part : parts)
+        MUST(m_encoder.append(part.data(), part.size()));
+}
+
 void TransferDataEncoder::extend(Vector<TransferDataEncoder> data_holders)
 {
     for (auto& data_holder : data_holders)
@@ -2442,10 +2583,70 @@ WebIDL::ExceptionOr<::Crypto::SignedBigInteger> decode_signed_big_integer(Struct
     return ::Crypto::SignedBigInteger::import_data(buffer);
 }
 
+SerializedSharedMemory::SerializedSharedMemory(Core::AnonymousBuffer buffer)
+    : m_memory(move(buffer))
+{
+}
+
+SerializedSharedMemory::SerializedSharedMemory(IPC::File file, size_t size)
+    : m_memory(adopt_ref(*new ReceivedMemory(move(file), size)))
+{
+}
+
+size_t SerializedSharedMemory::size() const
+{
+    return m_memory.visit(
+        [](Core::AnonymousBuffer const& buffer) { return buffer.size(); },
+        [](NonnullRefPtr<ReceivedMemory> const& memory) { return memory->size; });
+}
+
+int SerializedSharedMemory::fd() const
+{
+    return m_memory.visit(
+        [](Core::AnonymousBuffer const& buffer) { return buffer.fd(); },
+        [](NonnullRefPtr<ReceivedMemory> const& memory) { return memory->file.fd(); });
+}
+
+ErrorOr<Core::AnonymousBuffer> SerializedSharedMemory::map() const
+{
+    return m_memory.visit(
+        [](Core::AnonymousBuffer const& buffer) -> ErrorOr<Core::AnonymousBuffer> { return buffer; },
+        [](NonnullRefPtr<ReceivedMemory> const& memory) -> ErrorOr<Core::AnonymousBuffer> {
+            // NB: A record may be deserialized more than once, so each mapping gets its own file descriptor.
+            auto file = TRY(IPC::File::clone_fd(memory->file.fd()));
+            return Core::AnonymousBuffer::create_from_anon_fd(file.take_fd(), memory->size);
+        });
+}
+
 }
 
 namespace IPC {
 
+// NB: This uses the same encoding as Core::AnonymousBuffer, but the receiver does not map the memory until it is
+//     deserialized.
+template<>
+ErrorOr<void> encode(Encoder& encoder, Web::HTML::SerializedSharedMemory const& memory)
+{
+    TRY(encoder.encode(true));
+    TRY(encoder.encode(static_cast<u64>(memory.size())));
+    TRY(encoder.encode(TRY(IPC::File::clone_fd(memory.fd()))));
+    return {};
+}
+
+template<>
+ErrorOr<Web::HTML::SerializedSharedMemory> decode(Decoder& decoder)
+{
+    if (auto valid = TRY(decoder.decode<bool>()); !valid)
+        return Error::from_string_literal("Structured serialize record has invalid shared memory");
+
+    auto encoded_size = TRY(decoder.decode<u64>());
+    if (!AK::is_within_range<size_t>(encoded_size))
+        return Error::from_string_literal("Shared memory size does not fit on this platform");
+
+    auto file = TRY(decoder.decode<IPC::File>());
+    return Web::HTML::SerializedSharedMemory { move(file), static_cast<size_t>(encoded_size) };
+}
+
 template<>
 ErrorOr<void> encode(Encoder& encoder, Web::HTML::TransferDataEncoder const& data_holder)
 {
@@ -2480,6 +2681,7 @@ template<>
 ErrorOr<void> encode(Encoder& encoder, Web::HTML::IPCSerializationRecord const& record)
 {
     TRY(encoder.encode(record.data));
+    TRY(encoder.encode(record.shared_memory));
     return {};
 }
 
@@ -2487,7 +2689,9 @@ template<>
 ErrorOr<Web::HTML::IPCSerializationRecord> decode(Decoder& decoder)
 {
     auto data = TRY(decoder.decode<MessageDataType>());
-    return Web::HTML::IPCSerializationRecord { move(data) };
+    Web::HTML::IPCSerializationRecord record { move(data) };
+    record.shared_memory = TRY(decoder.decode<Vector<Web::HTML::SerializedSharedMemory>>());
+    return record;
 }
 
 template<>
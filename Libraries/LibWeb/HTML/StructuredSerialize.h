@@ -54,6 +54,7 @@ public:
 
     void append(IPCSerializationRecord&&);
     void extend(Vector<TransferDataEncoder>);
+    void encode_gathered_bytes(ReadonlySpan<ReadonlyBytes>);
     void encode_unsigned_big_integer(::Crypto::UnsignedBigInteger const&);
 
     IPC::MessageBuffer const& buffer() const;
@@ -99,6 +100,9 @@ public:
     template<typename T>
     void encode(T const&);
 
+    // Encodes the concatenation of the given parts without first copying them together. It decodes as one ByteBuffer.
+    void encode_gathered_bytes(ReadonlySpan<ReadonlyBytes>);
+
     void append(IPCSerializationRecord&&);
 
     IPCSerializationRecord take_ipc_record();
@@ -9,8 +9,13 @@
 #include <AK/Array.h>
 #include <AK/ByteBuffer.h>
 #include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/Variant.h>
 #include <AK/Vector.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibGC/Forward.h>
+#include <LibIPC/File.h>
 #include <LibIPC/Forward.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/Export.h>
@@ -20,9 +25,40 @@ namespace Web::HTML {
 using DeserializationMemory = GC::RootVector<JS::Value>;
 using SerializationMemory = HashMap<GC::Root<JS::Value>, u32>;
 
+// The memory of a SharedArrayBuffer in a serialization record. Memory that was received from another process is only
+// mapped once it is deserialized, after the receiving agent has been checked to be in the SharedArrayBuffer's agent
+// cluster.
+class WEB_API SerializedSharedMemory {
+public:
+    explicit SerializedSharedMemory(Core::AnonymousBuffer);
+    SerializedSharedMemory(IPC::File, size_t size);
+
+    size_t size() const;
+    int fd() const;
+
+    ErrorOr<Core::AnonymousBuffer> map() const;
+
+private:
+    struct ReceivedMemory : public RefCounted<ReceivedMemory> {
+        ReceivedMemory(IPC::File file, size_t size)
+            : file(move(file))
+            , size(size)
+        {
+        }
+
+        IPC::File file;
+        size_t size { 0 };
+    };
+
+    Variant<Core::AnonymousBuffer, NonnullRefPtr<ReceivedMemory>> m_memory;
+};
+
 struct IPCSerializationRecord {
     IPC::MessageDataType data;
 
+    // The memory of every SharedArrayBuffer in the record, in the order in which they were serialized.
+    Vector<SerializedSharedMemory> shared_memory;
+
     IPCSerializationRecord() = default;
     explicit IPCSerializationRecord(IPC::MessageDataType data)
         : data(move(data))
@@ -165,6 +201,12 @@ static constexpr bool value_tag_is_decodable(ValueTag tag)
 
 namespace IPC {
 
+template<>
+WEB_API ErrorOr<void> encode(Encoder&, Web::HTML::SerializedSharedMemory const&);
+
+template<>
+WEB_API ErrorOr<Web::HTML::SerializedSharedMemory> decode(Decoder&);
+
 template<>
 WEB_API ErrorOr<void> encode(Encoder&, Web::HTML::IPCSerializationRecord const&);
 
@@ -59,4 +59,9 @@ void Timer::set_interval(i32 milliseconds)
         m_timer->restart(milliseconds);
 }
 
+void Timer::restart(i32 milliseconds)
+{
+    m_timer->restart(milliseconds);
+}
+
 }
@@ -36,6 +36,7 @@ public:
 
     void set_callback(Function<void()>);
     void set_interval(i32 milliseconds);
+    void restart(i32 milliseconds);
 
 private:
     Timer(i32 milliseconds, Function<void()> callback, i32 id, Repeating);
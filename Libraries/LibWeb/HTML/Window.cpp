@@ -94,6 +94,7 @@
 #include <LibWeb/WebIDL/AbstractOperations.h>
 #include <LibWeb/WebIDL/ExceptionOrUtils.h>
 #include <LibWeb/WebIDL/Promise.h>
+#include <LibWeb/WebLocks/LockManager.h>
 
 namespace Web::Bindings {
 
@@ -807,6 +808,33 @@ void Window::consume_user_activation()
     }
 }
 
+// How long a document has to be hidden before its timers are throttled intensively.
+static constexpr auto INTENSIVE_TIMER_THROTTLING_DELAY = AK::Duration::from_seconds(5 * 60);
+
+Window::TimerThrottling Window::timer_throttling() const
+{
+    auto const& document = associated_document();
+    auto hidden_since = document.hidden_since();
+    if (!hidden_since.has_value())
+        return TimerThrottling::None;
+
+    // Pages that are playing audio are still being used, even if nobody can see them.
+    if (page().is_playing_audio())
+        return TimerThrottling::None;
+
+    if (MonotonicTime::now() - *hidden_since < INTENSIVE_TIMER_THROTTLING_DELAY)
+        return TimerThrottling::Aligned;
+
+    // Pages that hold Web Locks or talk to a server over a WebSocket are likely coordinating with someone else, and
+    // must keep responding in time.
+    if (has_connected_web_sockets())
+        return TimerThrottling::Aligned;
+    if (auto lock_manager = relevant_settings_object().lock_manager_if_exists(); lock_manager && !lock_manager->held_lock_set().is_empty())
+        return TimerThrottling::Aligned;
+
+    return TimerThrottling::Intensive;
+}
+
 // https://w3c.github.io/requestidlecallback/#start-an-idle-period-algorithm
 void Window::start_an_idle_period()
 {
@@ -307,6 +307,9 @@ public:
 
     static void for_each_active(Function<IterationDecision(Window&)> callback);
 
+    // ^WindowOrWorkerGlobalScopeMixin
+    virtual TimerThrottling timer_throttling() const override;
+
 private:
     Window();
 
@@ -65,6 +65,7 @@
 #include <LibWeb/TrustedTypes/TrustedTypePolicyFactory.h>
 #include <LibWeb/UserTiming/PerformanceMark.h>
 #include <LibWeb/UserTiming/PerformanceMeasure.h>
+#include <LibWeb/WebCodecs/VideoFrame.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
 #include <LibWeb/WebIDL/DOMException.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -86,6 +87,21 @@ static void resolve_image_bitmap_promise(JS::Realm& realm, WebIDL::Promise& prom
 
 namespace Web::HTML {
 
+// Throttled timers only wake up on multiples of these intervals, so that the timers of all throttled globals share
+// their wake-ups.
+static constexpr auto ALIGNED_TIMER_WAKE_UP_INTERVAL = AK::Duration::from_seconds(1);
+static constexpr auto INTENSIVE_TIMER_WAKE_UP_INTERVAL = AK::Duration::from_seconds(60);
+
+// Timers that have been chained at least this deeply are assumed to be polling, and are throttled the most.
+static constexpr u32 MINIMUM_NESTING_LEVEL_FOR_INTENSIVE_WAKE_UP_INTERVAL = 5;
+
+// While intensively throttled, timer tasks may use 1% of CPU time, and save up a few seconds of it for bursts.
+static constexpr i64 TIMER_BUDGET_REGENERATION_DIVISOR = 100;
+static constexpr auto MAXIMUM_TIMER_BUDGET = AK::Duration::from_seconds(3);
+
+// A long task may overdraw the budget, but only by as much as regenerates within one intensive wake-up interval.
+static constexpr auto MAXIMUM_TIMER_BUDGET_DEBT = AK::Duration::from_milliseconds(60'000 / TIMER_BUDGET_REGENERATION_DIVISOR);
+
 WindowOrWorkerGlobalScopeMixin::~WindowOrWorkerGlobalScopeMixin() = default;
 
 void WindowOrWorkerGlobalScopeMixin::initialize()
@@ -100,6 +116,8 @@ void WindowOrWorkerGlobalScopeMixin::initialize()
         });
     ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES
 #undef __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES
+
+    m_timer_budget = MAXIMUM_TIMER_BUDGET;
 }
 
 void WindowOrWorkerGlobalScopeMixin::visit_edges(JS::Cell::Visitor& visitor)
@@ -336,7 +354,7 @@ void WindowOrWorkerGlobalScopeMixin::create_image_bitmap_impl(JS::Realm& realm,
                 //    object, then queue a global task, using the bitmap task source, to reject promise with an
                 //    "InvalidStateError" DOMException and abort these steps.
                 // FIXME: I guess this is always fine for us as the data is already read.
-                auto const image_data = blob->raw_bytes();
+                auto const image_data = blob->raw_bytes().release_value_but_fixme_should_propagate_errors();
 
                 // FIXME:
                 // 2. Apply the image sniffing rules to determine the file format of imageData, with MIME type of
@@ -385,7 +403,7 @@ void WindowOrWorkerGlobalScopeMixin::create_image_bitmap_impl(JS::Realm& realm,
                     return {};
                 };
 
-                (void)Web::Platform::ImageCodecPlugin::the().decode_image(image_data, move(on_successful_decode), move(on_failed_decode));
+                (void)Web::Platform::ImageCodecPlugin::the().decode_image(image_data.bytes(), move(on_successful_decode), move(on_failed_decode));
             }));
         },
         // -> ImageData
@@ -486,6 +504,31 @@ void WindowOrWorkerGlobalScopeMixin::create_image_bitmap_impl(JS::Realm& realm,
                     TemporaryExecutionContext const context { WebIDL::promise_realm(*p), TemporaryExecutionContext::CallbacksEnabled::Yes };
                     WebIDL::reject_promise(*p, error);
                 },
+                // -> VideoFrame
+                [&](GC::Ref<WebCodecs::VideoFrame> video_frame) {
+                    // 1. Set imageBitmap's bitmap data to a copy of image's visible pixel data, cropped to the source
+                    //    rectangle with formatting.
+                    auto frame = video_frame->decoded_image_frame();
+                    // AD-HOC: Reject promise with an "InvalidStateError" DOMException on allocation failure
+                    // Spec issue: https://github.com/whatwg/html/issues/3323
+                    if (!frame.has_value()) {
+                        WebIDL::reject_promise(*p, WebIDL::InvalidStateError::create("Image size is invalid"_utf16));
+                        return;
+                    }
+                    auto cropped_bitmap_or_error = crop_to_the_source_rectangle_with_formatting(frame->bitmap(), sx, sy, sw, sh, options);
+                    if (cropped_bitmap_or_error.is_error()) {
+                        WebIDL::reject_promise(*p, WebIDL::InvalidStateError::create("Image size is invalid"_utf16));
+                        return;
+                    }
+                    image_bitmap->set_bitmap(cropped_bitmap_or_error.release_value());
+
+                    // 2. Queue a global task, using the bitmap task source, to resolve promise with imageBitmap.
+                    queue_global_task(Task::Source::BitmapTask, realm.global_object(), GC::create_function(GC::Heap::the(), [p, image_bitmap] {
+                        auto& realm = WebIDL::promise_realm(*p);
+                        TemporaryExecutionContext const context { realm, TemporaryExecutionContext::CallbacksEnabled::Yes };
+                        Bindings::resolve_image_bitmap_promise(realm, *p, image_bitmap);
+                    }));
+                },
                 // -> img
                 // -> SVG image
                 [&](auto const& image_element) {
@@ -553,6 +596,7 @@ void WindowOrWorkerGlobalScopeMixin::clear_timeout(i32 id)
         timer.value()->stop();
     m_timers.remove(id);
     m_timer_nesting_levels.remove(id);
+    m_throttled_timer_due_times.remove(id);
 }
 
 // https://html.spec.whatwg.org/multipage/timers-and-user-prompts.html#dom-clearinterval
@@ -562,6 +606,7 @@ void WindowOrWorkerGlobalScopeMixin::clear_interval(i32 id)
         timer.value()->stop();
     m_timers.remove(id);
     m_timer_nesting_levels.remove(id);
+    m_throttled_timer_due_times.remove(id);
 }
 
 void WindowOrWorkerGlobalScopeMixin::clear_map_of_active_timers()
@@ -570,6 +615,87 @@ void WindowOrWorkerGlobalScopeMixin::clear_map_of_active_timers()
         it.value->stop();
     m_timers.clear();
     m_timer_nesting_levels.clear();
+    m_throttled_timer_due_times.clear();
+}
+
+i32 WindowOrWorkerGlobalScopeMixin::throttle_timer_timeout(TimerThrottling throttling, i32 id, i32 timeout, u32 nesting_level)
+{
+    if (throttling == TimerThrottling::None) {
+        m_throttled_timer_due_times.remove(id);
+        return timeout;
+    }
+
+    auto now = MonotonicTime::now();
+    auto due_time = now + AK::Duration::from_milliseconds(timeout);
+    m_throttled_timer_due_times.set(id, due_time);
+
+    auto wake_up_time = due_time;
+    auto wake_up_interval = ALIGNED_TIMER_WAKE_UP_INTERVAL;
+
+    if (throttling == TimerThrottling::Intensive) {
+        // If timer tasks have used up their budget, wait until it has regenerated, but never for longer than the
+        // intensive wake-up interval.
+        regenerate_timer_budget();
+        if (m_timer_budget.is_negative()) {
+            auto time_until_regenerated = AK::Duration::from_nanoseconds(-m_timer_budget.to_nanoseconds() * TIMER_BUDGET_REGENERATION_DIVISOR);
+            auto budget_regenerated_time = now + min(time_until_regenerated, INTENSIVE_TIMER_WAKE_UP_INTERVAL);
+            if (budget_regenerated_time > wake_up_time) {
+                wake_up_time = budget_regenerated_time;
+                ++m_deferred_timer_task_count;
+            }
+        }
+
+        if (nesting_level >= MINIMUM_NESTING_LEVEL_FOR_INTENSIVE_WAKE_UP_INTERVAL)
+            wake_up_interval = INTENSIVE_TIMER_WAKE_UP_INTERVAL;
+    }
+
+    auto interval_in_nanoseconds = wake_up_interval.to_nanoseconds();
+    auto aligned_wake_up_in_nanoseconds = ceil_div(wake_up_time.nanoseconds(), interval_in_nanoseconds) * interval_in_nanoseconds;
+    auto throttled_timeout = AK::Duration::from_nanoseconds(aligned_wake_up_in_nanoseconds - now.nanoseconds()).to_milliseconds();
+
+    if (throttled_timeout <= timeout)
+        return timeout;
+
+    ++m_throttled_timer_count;
+    return static_cast<i32>(min(throttled_timeout, static_cast<i64>(NumericLimits<i32>::max())));
+}
+
+void WindowOrWorkerGlobalScopeMixin::regenerate_timer_budget()
+{
+    auto now = MonotonicTime::now();
+    auto regenerated = AK::Duration::from_nanoseconds((now - m_timer_budget_updated_at).to_nanoseconds() / TIMER_BUDGET_REGENERATION_DIVISOR);
+    m_timer_budget = min(m_timer_budget + regenerated, MAXIMUM_TIMER_BUDGET);
+    m_timer_budget_updated_at = now;
+}
+
+void WindowOrWorkerGlobalScopeMixin::charge_timer_budget(AK::Duration time_spent)
+{
+    m_timer_budget = max(m_timer_budget - time_spent, -MAXIMUM_TIMER_BUDGET_DEBT);
+}
+
+AK::Duration WindowOrWorkerGlobalScopeMixin::timer_budget()
+{
+    regenerate_timer_budget();
+    return m_timer_budget;
+}
+
+void WindowOrWorkerGlobalScopeMixin::set_timer_budget_for_testing(AK::Duration budget)
+{
+    m_timer_budget = clamp(budget, -MAXIMUM_TIMER_BUDGET_DEBT, MAXIMUM_TIMER_BUDGET);
+    m_timer_budget_updated_at = MonotonicTime::now();
+}
+
+void WindowOrWorkerGlobalScopeMixin::reschedule_throttled_timers()
+{
+    auto now = MonotonicTime::now();
+    for (auto const& [id, due_time] : m_throttled_timer_due_times) {
+        auto timer = m_timers.get(id);
+        if (!timer.has_value())
+            continue;
+        auto remaining_time = max(due_time - now, AK::Duration::zero());
+        timer.value()->restart(static_cast<i32>(remaining_time.to_milliseconds()));
+    }
+    m_throttled_timer_due_times.clear();
 }
 
 // https://html.spec.whatwg.org/multipage/timers-and-user-prompts.html#timer-initialisation-steps
@@ -595,6 +721,10 @@ i32 WindowOrWorkerGlobalScopeMixin::run_timer_initialization_steps(TimerHandler
     if (nesting_level > 5 && timeout < 4)
         timeout = 4;
 
+    // AD-HOC: Throttle the timers of globals that nobody can see, to save power. This only affects when the timer
+    //         fires, repeating timers keep using the given timeout.
+    auto throttled_timeout = throttle_timer_timeout(timer_throttling(), id, timeout, nesting_level);
+
     // 6. Let realm be global's relevant realm.
     auto& realm = relevant_realm(*this);
 
@@ -703,6 +833,7 @@ i32 WindowOrWorkerGlobalScopeMixin::run_timer_initialization_steps(TimerHandler
         case Repeat::No:
             m_timers.remove(id);
             m_timer_nesting_levels.remove(id);
+            m_throttled_timer_due_times.remove(id);
             break;
         }
     }));
@@ -717,14 +848,23 @@ i32 WindowOrWorkerGlobalScopeMixin::run_timer_initialization_steps(TimerHandler
     Function<void()> completion_step = [this, task = move(task)]() mutable {
         queue_global_task(Task::Source::TimerTask, relevant_global_object(*this), GC::create_function(GC::Heap::the(), [this, task] {
             HTML::TemporaryExecutionContext execution_context { relevant_settings_object(*this), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+
+            // AD-HOC: Charge the time spent in timer tasks of intensively throttled globals to their timer budget.
+            if (timer_throttling() != TimerThrottling::Intensive) {
+                task->function()();
+                return;
+            }
+            regenerate_timer_budget();
+            auto start_time = MonotonicTime::now();
             task->function()();
+            charge_timer_budget(MonotonicTime::now() - start_time);
         }));
     };
 
     // 13. Set uniqueHandle to the result of running steps after a timeout given global, "setTimeout/setInterval",
     //     timeout, and completionStep.
     //     FIXME: run_steps_after_a_timeout() needs to be updated to return a unique internal value that can be used here.
-    run_steps_after_a_timeout_impl(timeout, move(completion_step), id, repeat);
+    run_steps_after_a_timeout_impl(throttled_timeout, move(completion_step), id, repeat);
 
     // FIXME: 14. Set global's map of setTimeout and setInterval IDs[id] to uniqueHandle.
 
@@ -1123,6 +1263,16 @@ void WindowOrWorkerGlobalScopeMixin::unregister_web_socket(Badge<WebSockets::Web
     m_registered_web_sockets.remove(web_socket);
 }
 
+bool WindowOrWorkerGlobalScopeMixin::has_connected_web_sockets() const
+{
+    for (auto const& web_socket : m_registered_web_sockets) {
+        auto ready_state = web_socket.ready_state();
+        if (ready_state == Requests::WebSocket::ReadyState::Connecting || ready_state == Requests::WebSocket::ReadyState::Open)
+            return true;
+    }
+    return false;
+}
+
 WindowOrWorkerGlobalScopeMixin::AffectedAnyWebSockets WindowOrWorkerGlobalScopeMixin::make_disappear_all_web_sockets()
 {
     auto affected_any_web_sockets = AffectedAnyWebSockets::No;
@@ -10,6 +10,7 @@
 #include <AK/Forward.h>
 #include <AK/HashMap.h>
 #include <AK/IDAllocator.h>
+#include <AK/Time.h>
 #include <AK/Utf16FlyString.h>
 #include <AK/Utf16String.h>
 #include <AK/Utf16View.h>
@@ -50,6 +51,24 @@ public:
     void clear_interval(i32);
     void clear_map_of_active_timers();
 
+    // AD-HOC: Timers that were throttled while nobody could see their global run on their regular schedule again.
+    void reschedule_throttled_timers();
+    u64 throttled_timer_count() const { return m_throttled_timer_count; }
+    u64 deferred_timer_task_count() const { return m_deferred_timer_task_count; }
+
+    enum class TimerThrottling {
+        None,
+        // Timers wake up at most once per second.
+        Aligned,
+        // Chained timers wake up at most once per minute, and timer tasks only get a small share of CPU time.
+        Intensive,
+    };
+    virtual TimerThrottling timer_throttling() const { return TimerThrottling::None; }
+
+    // The CPU time that timer tasks may still use while intensively throttled. It is negative while in debt.
+    AK::Duration timer_budget();
+    void set_timer_budget_for_testing(AK::Duration);
+
     enum class CheckIfPerformanceBufferIsFull {
         No,
         Yes,
@@ -114,6 +133,8 @@ protected:
     void visit_edges(JS::Cell::Visitor&);
     void finalize();
 
+    bool has_connected_web_sockets() const;
+
 private:
     enum class Repeat {
         Yes,
@@ -122,6 +143,10 @@ private:
     i32 run_timer_initialization_steps(TimerHandler handler, i32 timeout, GC::RootVector<JS::Value> arguments, Repeat repeat, Optional<i32> previous_id = {});
     void run_steps_after_a_timeout_impl(i32 timeout, Function<void()> completion_step, Optional<i32> timer_key, Repeat repeat = Repeat::No);
 
+    i32 throttle_timer_timeout(TimerThrottling, i32 id, i32 timeout, u32 nesting_level);
+    void regenerate_timer_budget();
+    void charge_timer_budget(AK::Duration time_spent);
+
     void create_image_bitmap_impl(JS::Realm&, GC::Ref<WebIDL::Promise>, ImageBitmapSource& image, Optional<WebIDL::Long> sx, Optional<WebIDL::Long> sy, Optional<WebIDL::Long> sw, Optional<WebIDL::Long> sh, ImageBitmapOptions options) const;
 
     size_t resource_timing_buffer_current_size();
@@ -135,6 +160,16 @@ private:
     // https://html.spec.whatwg.org/multipage/timers-and-user-prompts.html#timer-nesting-level
     HashMap<i32, u32> m_timer_nesting_levels;
 
+    // When each throttled timer would have fired had it not been throttled.
+    HashMap<i32, MonotonicTime> m_throttled_timer_due_times;
+
+    // The CPU time that timer tasks may still use while intensively throttled. It regenerates over time.
+    AK::Duration m_timer_budget;
+    MonotonicTime m_timer_budget_updated_at { MonotonicTime::now() };
+
+    u64 m_throttled_timer_count { 0 };
+    u64 m_deferred_timer_task_count { 0 };
+
     // https://www.w3.org/TR/performance-timeline/#performance-timeline
     // Each global object has:
     // - a performance observer task queued flag
@@ -38,6 +38,7 @@
 #include <LibWeb/CSS/CSSStyleRule.h>
 #include <LibWeb/CSS/CSSStyleSheet.h>
 #include <LibWeb/CSS/ComputedValues.h>
+#include <LibWeb/CSS/Parser/StyleSheetContentsCache.h>
 #include <LibWeb/CSS/PreferredColorScheme.h>
 #include <LibWeb/CSS/PropertyID.h>
 #include <LibWeb/CSS/PseudoElement.h>
@@ -708,6 +709,54 @@ WebIDL::UnsignedLongLong Internals::accumulated_visual_context_tree_build_count(
     return document.paint_state().accumulated_visual_context_tree_build_count();
 }
 
+WebIDL::UnsignedLongLong Internals::throttled_timer_count()
+{
+    return window().throttled_timer_count();
+}
+
+WebIDL::UnsignedLongLong Internals::deferred_timer_task_count()
+{
+    return window().deferred_timer_task_count();
+}
+
+Utf16String Internals::timer_throttling()
+{
+    switch (window().timer_throttling()) {
+    case HTML::Window::TimerThrottling::None:
+        return "none"_utf16;
+    case HTML::Window::TimerThrottling::Aligned:
+        return "aligned"_utf16;
+    case HTML::Window::TimerThrottling::Intensive:
+        return "intensive"_utf16;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void Internals::simulate_hidden_duration(double milliseconds)
+{
+    window().associated_document().set_hidden_since_for_testing(MonotonicTime::now() - AK::Duration::from_milliseconds(static_cast<i64>(milliseconds)));
+}
+
+void Internals::simulate_audio_playback(bool playing)
+{
+    page().did_change_audio_play_state(playing ? HTML::AudioPlayState::Playing : HTML::AudioPlayState::Paused);
+}
+
+double Internals::timer_budget()
+{
+    return static_cast<double>(window().timer_budget().to_milliseconds());
+}
+
+void Internals::set_timer_budget(double milliseconds)
+{
+    window().set_timer_budget_for_testing(AK::Duration::from_milliseconds(static_cast<i64>(milliseconds)));
+}
+
+WebIDL::UnsignedLongLong Internals::style_sheet_contents_cache_hit_count()
+{
+    return CSS::Parser::StyleSheetContentsCache::the().hit_count();
+}
+
 void Internals::set_autoplay_policy(Utf16String const& policy)
 {
     if (auto parsed = HTML::autoplay_policy_from_string(policy.utf16_view()); parsed.has_value())
@@ -118,6 +118,14 @@ public:
     WebIDL::UnsignedLongLong full_layout_count();
     WebIDL::UnsignedLongLong layout_run_cache_hit_count();
     WebIDL::UnsignedLongLong accumulated_visual_context_tree_build_count();
+    WebIDL::UnsignedLongLong throttled_timer_count();
+    WebIDL::UnsignedLongLong deferred_timer_task_count();
+    Utf16String timer_throttling();
+    void simulate_hidden_duration(double milliseconds);
+    void simulate_audio_playback(bool playing);
+    double timer_budget();
+    void set_timer_budget(double milliseconds);
+    WebIDL::UnsignedLongLong style_sheet_contents_cache_hit_count();
     void set_autoplay_policy(Utf16String const& policy);
 
     Utf16String get_computed_role(DOM::Element& element);
@@ -135,12 +135,14 @@ void Page::navigable_document_destroyed(Badge<DOM::Document>, HTML::LocalNavigab
 
 void Page::load(URL::URL const& url, Bindings::NavigationHistoryBehavior history_handling)
 {
+    start_page_load_timings();
     (void)top_level_traversable()->navigate({ .url = url, .source_document = *top_level_traversable()->active_document(), .history_handling = history_handling, .user_involvement = HTML::UserNavigationInvolvement::BrowserUI });
 }
 
 void Page::load(URL::URL const& url, HTML::DocumentResource document_resource,
     Bindings::NavigationHistoryBehavior history_handling, Optional<HTML::NavigationSourceSnapshot> source_snapshot)
 {
+    start_page_load_timings();
     (void)top_level_traversable()->navigate({
         .url = url,
         .source_document = *top_level_traversable()->active_document(),
@@ -152,6 +154,18 @@ void Page::load(URL::URL const& url, HTML::DocumentResource document_resource,
     });
 }
 
+void Page::start_page_load_timings()
+{
+    m_page_load_timings = {};
+    m_page_load_started_at = MonotonicTime::now();
+}
+
+void Page::did_paint_contentful_frame()
+{
+    if (!m_page_load_timings.first_contentful_paint.has_value())
+        m_page_load_timings.first_contentful_paint = MonotonicTime::now() - m_page_load_started_at;
+}
+
 void Page::load_html(StringView html)
 {
     // FIXME: #23909 Figure out why GC threshold does not stay low when repeatedly loading html from the WebView
@@ -944,6 +958,22 @@ void Page::set_page_mute_state(HTML::MuteState mute_state)
     });
 }
 
+void Page::did_change_audio_play_state(HTML::AudioPlayState play_state)
+{
+    switch (play_state) {
+    case HTML::AudioPlayState::Playing:
+        ++m_audio_playing_element_count;
+        break;
+    case HTML::AudioPlayState::Paused:
+        // NB: An element that started playing in another page's document may stop playing in ours.
+        if (m_audio_playing_element_count > 0)
+            --m_audio_playing_element_count;
+        break;
+    }
+
+    client().page_did_change_audio_play_state(play_state);
+}
+
 GC::Ptr<HTML::HTMLMediaElement> Page::media_context_menu_element()
 {
     if (!m_media_context_menu_element_id.has_value())
@@ -69,6 +69,7 @@
 #include <LibWeb/Loader/FileRequest.h>
 #include <LibWeb/Page/EventResult.h>
 #include <LibWeb/Page/InputEvent.h>
+#include <LibWeb/Page/PageLoadTimings.h>
 #include <LibWeb/Page/ScreenWakeLockHandle.h>
 #include <LibWeb/Page/ViewportIsFullscreen.h>
 #include <LibWeb/Painting/ChromeMetrics.h>
@@ -290,6 +291,9 @@ public:
     HTML::MuteState page_mute_state() const { return m_mute_state; }
     void set_page_mute_state(HTML::MuteState);
 
+    void did_change_audio_play_state(HTML::AudioPlayState);
+    bool is_playing_audio() const { return m_audio_playing_element_count > 0; }
+
     Optional<Utf16String> const& user_style() const { return m_user_style_sheet_source; }
     void set_user_style(Utf16String source);
     void set_content_blocking_enabled(bool);
@@ -333,7 +337,14 @@ public:
     ViewportIsFullscreen viewport_is_fullscreen() const { return m_viewport_is_fullscreen; }
     void set_viewport_is_fullscreen(ViewportIsFullscreen);
 
+    PageLoadTimings const& page_load_timings() const { return m_page_load_timings; }
+    void did_paint_contentful_frame();
+
 private:
+    friend class PageLoadPhaseTimer;
+
+    void start_page_load_timings();
+
     explicit Page(GC::Ref<PageClient>);
     virtual void visit_edges(Visitor&) override;
 
@@ -365,6 +376,10 @@ private:
 
     GC::Ptr<HTML::LocalTraversableNavigable> m_top_level_traversable;
 
+    PageLoadTimings m_page_load_timings;
+    MonotonicTime m_page_load_started_at { MonotonicTime::now() };
+    PageLoadPhaseTimer* m_current_page_load_phase_timer { nullptr };
+
     bool m_is_scripting_enabled { true };
     bool m_should_block_pop_ups { true };
     bool m_enable_autoscroll { true };
@@ -412,6 +427,7 @@ private:
     Optional<UniqueNodeID> m_media_context_menu_element_id;
 
     Web::HTML::MuteState m_mute_state { Web::HTML::MuteState::Unmuted };
+    size_t m_audio_playing_element_count { 0 };
     size_t m_active_screen_wake_lock_count { 0 };
 
     Optional<Utf16String> m_user_style_sheet_source;
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/Page/PageLoadTimings.h>
+
+namespace Web {
+
+static char const* trace_name_for(PageLoadPhase phase)
+{
+    switch (phase) {
+    case PageLoadPhase::Parse:
+        return "Parse";
+    case PageLoadPhase::Style:
+        return "Style";
+    case PageLoadPhase::Layout:
+        return "Layout";
+    case PageLoadPhase::Paint:
+        return "Paint";
+    }
+    VERIFY_NOT_REACHED();
+}
+
+PageLoadPhaseTimer::PageLoadPhaseTimer(Page& page, PageLoadPhase phase)
+    : m_page(page)
+    , m_phase(phase)
+    , m_start(MonotonicTime::now())
+    , m_outer_timer(page.m_current_page_load_phase_timer)
+    , m_trace_scope("page", trace_name_for(phase))
+{
+    m_page.m_current_page_load_phase_timer = this;
+}
+
+PageLoadPhaseTimer::~PageLoadPhaseTimer()
+{
+    VERIFY(m_page.m_current_page_load_phase_timer == this);
+    m_page.m_current_page_load_phase_timer = m_outer_timer;
+
+    auto elapsed_time = MonotonicTime::now() - m_start;
+    if (m_outer_timer)
+        m_outer_timer->m_nested_time += elapsed_time;
+
+    auto& timings = m_page.m_page_load_timings;
+    auto own_time = elapsed_time - m_nested_time;
+
+    switch (m_phase) {
+    case PageLoadPhase::Parse:
+        timings.parse += own_time;
+        break;
+    case PageLoadPhase::Style:
+        timings.style += own_time;
+        break;
+    case PageLoadPhase::Layout:
+        timings.layout += own_time;
+        break;
+    case PageLoadPhase::Paint:
+        timings.paint += own_time;
+        break;
+    }
+}
+
+}
+
+template<>
+WEB_API ErrorOr<void> IPC::encode(Encoder& encoder, Web::PageLoadTimings const& timings)
+{
+    TRY(encoder.encode(timings.parse));
+    TRY(encoder.encode(timings.style));
+    TRY(encoder.encode(timings.layout));
+    TRY(encoder.encode(timings.paint));
+    TRY(encoder.encode(timings.first_contentful_paint));
+    return {};
+}
+
+template<>
+WEB_API ErrorOr<Web::PageLoadTimings> IPC::decode(Decoder& decoder)
+{
+    return Web::PageLoadTimings {
+        .parse = TRY(decoder.decode<AK::Duration>()),
+        .style = TRY(decoder.decode<AK::Duration>()),
+        .layout = TRY(decoder.decode<AK::Duration>()),
+        .paint = TRY(decoder.decode<AK::Duration>()),
+        .first_contentful_paint = TRY(decoder.decode<Optional<AK::Duration>>()),
+    };
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <LibCore/Tracing.h>
+#include <LibIPC/Forward.h>
+#include <LibWeb/Export.h>
+#include <LibWeb/Forward.h>
+
+namespace Web {
+
+// Time that a page spent in each phase of loading and rendering, since the top-level traversable last started a page
+// load. Each phase adds up over all documents in the page, and excludes the time spent in other phases that it caused,
+// e.g. the style update that a script forced while the parser was running is attributed to style, not to parsing.
+struct PageLoadTimings {
+    AK::Duration parse;
+    AK::Duration style;
+    AK::Duration layout;
+    AK::Duration paint;
+
+    // The time from the start of the page load until the first rendering update that painted text, an image, a canvas
+    // or a video into the top-level traversable.
+    Optional<AK::Duration> first_contentful_paint;
+};
+
+enum class PageLoadPhase : u8 {
+    Parse,
+    Style,
+    Layout,
+    Paint,
+};
+
+// Attributes the time until it goes out of scope to a phase of the page's load timings, and traces it as a slice.
+class WEB_API PageLoadPhaseTimer {
+    AK_MAKE_NONCOPYABLE(PageLoadPhaseTimer);
+    AK_MAKE_NONMOVABLE(PageLoadPhaseTimer);
+
+public:
+    PageLoadPhaseTimer(Page&, PageLoadPhase);
+    ~PageLoadPhaseTimer();
+
+private:
+    Page& m_page;
+    PageLoadPhase m_phase;
+    MonotonicTime m_start;
+
+    PageLoadPhaseTimer* m_outer_timer { nullptr };
+    AK::Duration m_nested_time;
+
+    Core::Tracing::Scope m_trace_scope;
+};
+
+}
+
+namespace IPC {
+
+template<>
+WEB_API ErrorOr<void> encode(Encoder&, Web::PageLoadTimings const&);
+
+template<>
+WEB_API ErrorOr<Web::PageLoadTimings> decode(Decoder&);
+
+}
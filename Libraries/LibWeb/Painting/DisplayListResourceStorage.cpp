@@ -370,6 +370,22 @@ void DisplayListResourceStorage::add_cached_nested_display_list_raster(DisplayLi
     resource.rasters.prepend({ rect_in_list_space, move(image) });
 }
 
+size_t DisplayListResourceStorage::purge_cached_rasters()
+{
+    size_t released_bytes = 0;
+
+    for (auto& it : m_display_list_cached_nested_rasters) {
+        released_bytes += it.value->total_byte_size();
+        it.value->rasters.clear();
+    }
+
+    for (auto const& it : m_display_list_cached_skia_images)
+        released_bytes += static_cast<size_t>(it.value->tile_size.width()) * it.value->tile_size.height() * 4;
+    m_display_list_cached_skia_images.clear();
+
+    return released_bytes;
+}
+
 bool DisplayListResourceStorage::should_cache_nested_display_list_raster(DisplayListResourceId id) const
 {
     // Only rasterize a list that has been painted before: content that is re-recorded for every update gets a
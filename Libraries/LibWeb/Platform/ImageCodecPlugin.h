@@ -12,6 +12,7 @@
 #include <LibCore/Promise.h>
 #include <LibGfx/ColorSpace.h>
 #include <LibGfx/Forward.h>
+#include <LibGfx/Size.h>
 #include <LibWeb/Export.h>
 
 namespace Web::Platform {
@@ -23,6 +24,7 @@ struct Frame {
 
 struct DecodedImage {
     bool is_animated { false };
+    Gfx::IntSize natural_size;
     u32 loop_count { 0 };
     u32 frame_count { 0 };
     Vector<Frame> frames;
@@ -39,7 +41,21 @@ public:
 
     virtual ~ImageCodecPlugin();
 
-    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected) = 0;
+    // If an ideal size is given, still images may be decoded to a smaller size that still covers it. The natural size
+    // of the image is reported either way.
+    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}) = 0;
+
+    // Decodes the first frame of an image at its natural size and waits for it. Only for when the pixels of an image
+    // that was decoded to a smaller ideal size are needed right away, see BitmapDecodedImageData.
+    virtual Optional<DecodedImage> decode_first_frame_synchronously(ReadonlyBytes) = 0;
+
+    // Starts decoding a still image whose data is still arriving. Partially decoded images are passed to on_partial_image
+    // until the decode is finished or canceled. Returns the id to pass to the functions below, or nothing if the image
+    // has to be decoded once all of its data has arrived, e.g. because its MIME type can't be decoded progressively.
+    virtual Optional<i64> begin_progressive_decode(StringView mime_type, Optional<Gfx::IntSize> ideal_size, ESCAPING Function<void(Gfx::IntSize natural_size, NonnullRefPtr<Gfx::Bitmap>)> on_partial_image) = 0;
+    virtual void append_progressive_decode_data(i64 id, ReadonlyBytes) = 0;
+    virtual NonnullRefPtr<Core::Promise<DecodedImage>> finish_progressive_decode(i64 id, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected) = 0;
+    virtual void cancel_progressive_decode(i64 id) = 0;
 
     virtual void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count) = 0;
     virtual void stop_animation_decode(i64 session_id) = 0;
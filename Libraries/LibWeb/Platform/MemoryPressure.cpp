@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/MemoryPressure.h>
+#include <LibGC/Heap.h>
+#include <LibGfx/Font/ShapingCache.h>
+#include <LibMedia/VideoFramePool.h>
+#include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/CSS/Parser/StyleSheetContentsCache.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/Platform/MemoryPressure.h>
+
+namespace Web::Platform {
+
+using Level = Core::MemoryPressure::Level;
+
+// Under moderate pressure, caches are only cut down to this fraction of their usual limits, so that pages keep
+// rendering without having to decode, fetch, parse and shape everything again.
+static constexpr size_t moderate_pressure_divisor = 2;
+
+void register_memory_pressure_handlers()
+{
+    Core::MemoryPressure::register_handler("Decoded images"sv, [](Level level) {
+        auto documents = HTML::main_thread_event_loop().documents_in_this_event_loop_matching([](auto&) { return true; });
+
+        size_t size_limit = 0;
+        size_t count_limit = 0;
+        if (level != Level::Critical) {
+            size_limit = DOM::Document::decoded_image_resource_cache_limit / moderate_pressure_divisor;
+            count_limit = DOM::Document::decoded_image_resource_cache_count_limit / moderate_pressure_divisor;
+        }
+
+        size_t released_bytes = 0;
+        for (auto& document : documents)
+            released_bytes += document->prune_image_resource_caches_to_limits(size_limit, count_limit);
+        return released_bytes;
+    });
+
+    Core::MemoryPressure::register_handler("HTTP memory cache"sv, [](Level level) {
+        // Entries that are no longer fresh need a round trip to the server before they can be used again anyway.
+        if (level != Level::Critical)
+            return Fetch::Fetching::remove_stale_entries_from_http_memory_cache();
+        return Fetch::Fetching::clear_http_memory_cache();
+    });
+
+    Core::MemoryPressure::register_handler("Parsed style sheet contents"sv, [](Level level) {
+        size_t remaining_size_in_bytes = 0;
+        if (level != Level::Critical)
+            remaining_size_in_bytes = CSS::Parser::StyleSheetContentsCache::maximum_total_size_in_bytes / moderate_pressure_divisor;
+        return CSS::Parser::StyleSheetContentsCache::the().purge(remaining_size_in_bytes);
+    });
+
+    Core::MemoryPressure::register_handler("Text shaping cache"sv, [](Level level) {
+        size_t remaining_byte_size = 0;
+        if (level != Level::Critical)
+            remaining_byte_size = Gfx::GlobalShapingCache::the().statistics().byte_budget / moderate_pressure_divisor;
+        return Gfx::GlobalShapingCache::the().purge(remaining_byte_size);
+    });
+
+    // NB: Pooled buffers are not in use by any frame, and are cheap to allocate again.
+    Core::MemoryPressure::register_handler("Video frame pools"sv, [](Level) {
+        return Media::VideoFramePool::shed_all_buffers();
+    });
+
+    // A full garbage collection pauses the page, so under moderate pressure only the blocks that are already free are
+    // returned to the system.
+    Core::MemoryPressure::register_handler("GC heap"sv, [](Level level) {
+        auto collect = level == Level::Critical ? GC::Heap::CollectGarbage::Yes : GC::Heap::CollectGarbage::No;
+        return Bindings::main_thread_vm().heap().release_free_memory(collect);
+    });
+}
+
+}
@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Export.h>
+
+namespace Web::Platform {
+
+// Registers the handlers that release LibWeb's caches when the system is under memory pressure. Moderate pressure trims
+// the caches, critical pressure empties them. The garbage collector runs last, and under critical pressure collects
+// right away, so that it also reclaims whatever the other handlers dropped.
+WEB_API void register_memory_pressure_handlers();
+
+}
@@ -105,10 +105,6 @@ fn caret_line_is_better_candidate(
     block_distance < closest_block_distance
 }
 
-fn line_block_middle(rect: CssPixelRect, writing_mode: u8) -> CssPixels {
-    block_axis_start(rect, writing_mode)
-        + (block_axis_end(rect, writing_mode) - block_axis_start(rect, writing_mode)).scaled(0.5)
-}
 #[derive(Clone, Copy, Debug)]
 pub struct ClosestLine {
     pub index: Option<usize>,
@@ -196,8 +192,15 @@ impl HitTestList {
         };
         // Atomic inline boxes are recorded during the background paint phase, while text fragments
         // are recorded during the foreground phase. Other boxes can therefore separate two items
-        // from the same line in the caret item list.
-        for item_index in &self.caret_item_indices {
+        // from the same line in the caret item list, so consider every caret item of the line's
+        // containing block.
+        let Some(containing_block_item_indices) = self
+            .caret_item_indices_by_containing_block
+            .get(&(line.visual_context_index, first_item.containing_block))
+        else {
+            return best_item_index;
+        };
+        for item_index in containing_block_item_indices {
             let item = &self.items[*item_index];
             if !item_is_on_line(item) {
                 continue;
@@ -351,12 +354,17 @@ impl HitTestList {
             block_start_distance < closest_block_start_distance
         };
 
+        // Lines of one visual context share its transform, so map the point into each context only once.
+        let mut local_points_by_visual_context: HashMap<usize, Option<(f32, f32)>> = HashMap::new();
         for line_index in 0..self.caret_lines.len() {
             if scoped && !callbacks.line_in_scope(line_index) {
                 continue;
             }
             let line = self.caret_lines[line_index].clone();
-            let Some(local) = local_float_point(callbacks, line.visual_context_index, point, respect_clip) else {
+            let local = *local_points_by_visual_context
+                .entry(line.visual_context_index)
+                .or_insert_with(|| local_float_point(callbacks, line.visual_context_index, point, respect_clip));
+            let Some(local) = local else {
                 continue;
             };
             let local_point = to_css_point(local);
@@ -474,6 +482,64 @@ impl HitTestList {
         closest_line
     }
 
+    // Walks the lines sorted by block-axis middle outwards from the current line, and returns the first line in the
+    // requested direction that is in scope. Of equally distant lines, the one closest to the inline coordinate wins,
+    // then the one recorded first.
+    #[allow(clippy::too_many_arguments)]
+    fn closest_line_in_block_direction(
+        &self,
+        callbacks: &FfiHitTestQueryCallbacks,
+        lines_by_block_middle: &[usize],
+        current_line_index: usize,
+        writing_mode: u8,
+        current_block_coordinate: CssPixels,
+        physically_after: bool,
+        inline_coordinate: CssPixels,
+    ) -> Option<usize> {
+        let middle = |line_index: usize| line_block_middle(self.caret_lines[line_index].rect, writing_mode);
+        let mut position = if physically_after {
+            lines_by_block_middle.partition_point(|line_index| middle(*line_index) <= current_block_coordinate)
+        } else {
+            lines_by_block_middle.partition_point(|line_index| middle(*line_index) < current_block_coordinate)
+        };
+        loop {
+            let group = if physically_after {
+                let group_middle = middle(*lines_by_block_middle.get(position)?);
+                let group_end = position
+                    + lines_by_block_middle[position..]
+                        .partition_point(|line_index| middle(*line_index) == group_middle);
+                let group = &lines_by_block_middle[position..group_end];
+                position = group_end;
+                group
+            } else {
+                let group_middle = middle(*lines_by_block_middle[..position].last()?);
+                let group_start =
+                    lines_by_block_middle[..position].partition_point(|line_index| middle(*line_index) < group_middle);
+                let group = &lines_by_block_middle[group_start..position];
+                position = group_start;
+                group
+            };
+            let mut closest: Option<(usize, CssPixels)> = None;
+            for &line_index in group {
+                if line_index == current_line_index || !callbacks.line_in_scope(line_index) {
+                    continue;
+                }
+                let line = &self.caret_lines[line_index];
+                let inline_distance = distance_to_range(
+                    inline_coordinate,
+                    inline_axis_start(line.rect, writing_mode),
+                    inline_axis_end(line.rect, writing_mode),
+                );
+                if closest.is_none_or(|(_, closest_inline_distance)| inline_distance < closest_inline_distance) {
+                    closest = Some((line_index, inline_distance));
+                }
+            }
+            if let Some((line_index, _)) = closest {
+                return Some(line_index);
+            }
+        }
+    }
+
     pub fn adjacent_line(
         &self,
         callbacks: &FfiHitTestQueryCallbacks,
@@ -496,47 +562,29 @@ impl HitTestList {
         let current_line_context = current_first_item.paintable;
         let current_block_coordinate = line_block_middle(current_line.rect, writing_mode);
 
-        let mut closest_line_index: Option<usize> = None;
-        let mut closest_line_shares_context = false;
-        let mut closest_block_distance = CssPixels::from_raw(i32::MAX);
-        let mut closest_inline_distance = CssPixels::from_raw(i32::MAX);
-        for line_index in 0..self.caret_lines.len() {
-            let line = &self.caret_lines[line_index];
-            if line_index == current_line_index
-                || line.visual_context_index != current_line.visual_context_index
-                || !callbacks.line_in_scope(line_index)
-            {
-                continue;
-            }
-            let candidate_block_coordinate = line_block_middle(line.rect, writing_mode);
-            if (physically_after && candidate_block_coordinate <= current_block_coordinate)
-                || (!physically_after && candidate_block_coordinate >= current_block_coordinate)
-            {
-                continue;
-            }
-            let block_distance = absolute_difference(candidate_block_coordinate, current_block_coordinate);
-            let inline_distance = distance_to_range(
+        // Prefer lines produced by the same line paintable. Independently painted content, such as a floated first
+        // letter, may occupy the same block-axis neighborhood without being the next line of the current content.
+        let closest_line_in = |index: Option<&CaretLineIndex>| {
+            self.closest_line_in_block_direction(
+                callbacks,
+                index?.lines_by_block_middle(writing_mode),
+                current_line_index,
+                writing_mode,
+                current_block_coordinate,
+                physically_after,
                 inline_coordinate,
-                inline_axis_start(line.rect, writing_mode),
-                inline_axis_end(line.rect, writing_mode),
-            );
-            let candidate_first_item = self.first_item_of_line(line);
-            // Prefer lines produced by the same line paintable. Independently painted content, such as a floated first
-            // letter, may occupy the same block-axis neighborhood without being the next line of the current content.
-            let shares_line_context = candidate_first_item.paintable == current_line_context;
-            if closest_line_index.is_none()
-                || (shares_line_context && !closest_line_shares_context)
-                || (shares_line_context == closest_line_shares_context
-                    && (block_distance < closest_block_distance
-                        || (block_distance == closest_block_distance && inline_distance < closest_inline_distance)))
-            {
-                closest_line_index = Some(line_index);
-                closest_line_shares_context = shares_line_context;
-                closest_block_distance = block_distance;
-                closest_inline_distance = inline_distance;
-            }
-        }
-        let closest_line_index = closest_line_index?;
+            )
+        };
+        let closest_line_index = closest_line_in(
+            self.caret_line_indexes_by_paintable
+                .get(&(current_line.visual_context_index, current_line_context)),
+        )
+        .or_else(|| {
+            closest_line_in(
+                self.caret_line_indexes_by_visual_context
+                    .get(&current_line.visual_context_index),
+            )
+        })?;
         let closest_line = &self.caret_lines[closest_line_index];
         let block_coordinate = line_block_middle(closest_line.rect, writing_mode);
         let point = if writing_mode_is_horizontal(writing_mode) {
@@ -57,10 +57,35 @@ pub struct HitTestItem {
     pub can_produce_caret_position: bool,
 }
 
+// A two-level uniform grid over the items of one visual context. Items are bucketed in the fine grid when they
+// cover few of its cells, and in the coarse grid when they are too large for that, e.g. page-wide containers. Only
+// items that are large even for the coarse grid, empty, or not rect-shaped are tested at every point. Every bucket
+// lists its items in ascending record order, so that walking buckets backwards visits the topmost items first.
 #[derive(Default)]
 pub struct SpatialIndex {
     pub cells: HashMap<u64, Vec<usize>>,
+    pub coarse_cells: HashMap<u64, Vec<usize>>,
     pub unbucketed_items: Vec<usize>,
+    // The item recorded last in this visual context. No item of the context can be above it.
+    pub topmost_item_index: usize,
+}
+
+// The lines of a set of caret lines, sorted by the middle of their block axis range. Lines in one visual context may
+// use different writing modes, so there is one order per physical axis.
+#[derive(Default)]
+pub struct CaretLineIndex {
+    pub by_vertical_middle: Vec<usize>,
+    pub by_horizontal_middle: Vec<usize>,
+}
+
+impl CaretLineIndex {
+    pub fn lines_by_block_middle(&self, writing_mode: u8) -> &[usize] {
+        if writing_mode_is_horizontal(writing_mode) {
+            &self.by_vertical_middle
+        } else {
+            &self.by_horizontal_middle
+        }
+    }
 }
 
 // A visual line assembled from consecutive caret-capable display-list items. Caret lines preserve painted
@@ -75,11 +100,12 @@ pub struct CaretLine {
     pub last_caret_item_index: usize,
 }
 
-const SPATIAL_INDEX_CELL_SIZE: f64 = 128.0;
+pub const SPATIAL_INDEX_CELL_SIZE: f64 = 128.0;
+pub const COARSE_SPATIAL_INDEX_CELL_SIZE: f64 = 2048.0;
 const MAX_BUCKETED_CELLS_PER_ITEM: u64 = 64;
 
-pub fn spatial_index_cell_for(offset: CssPixels) -> i32 {
-    (offset.to_double() / SPATIAL_INDEX_CELL_SIZE).floor() as i32
+pub fn spatial_index_cell_for(offset: CssPixels, cell_size: f64) -> i32 {
+    (offset.to_double() / cell_size).floor() as i32
 }
 
 pub fn spatial_index_cell_key(x: i32, y: i32) -> u64 {
@@ -106,6 +132,14 @@ pub fn block_axis_end(rect: CssPixelRect, writing_mode: u8) -> CssPixels {
     }
 }
 
+fn axis_middle(start: CssPixels, end: CssPixels) -> CssPixels {
+    start + (end - start).scaled(0.5)
+}
+
+pub fn line_block_middle(rect: CssPixelRect, writing_mode: u8) -> CssPixels {
+    axis_middle(block_axis_start(rect, writing_mode), block_axis_end(rect, writing_mode))
+}
+
 pub fn rects_overlap_in_block_axis(a: CssPixelRect, b: CssPixelRect, writing_mode: u8) -> bool {
     block_axis_start(a, writing_mode) < block_axis_end(b, writing_mode)
         && block_axis_start(b, writing_mode) < block_axis_end(a, writing_mode)
@@ -119,7 +153,12 @@ pub struct HitTestList {
     pub caret_item_indices: Vec<usize>,
     pub caret_lines: Vec<CaretLine>,
     pub spatial_indexes: Vec<Option<SpatialIndex>>,
+    // Sorted by descending topmost item, so that queries for the topmost item can stop at the first visual context
+    // whose items are all below the best hit so far.
     pub used_visual_context_indices: Vec<usize>,
+    pub caret_line_indexes_by_visual_context: HashMap<usize, CaretLineIndex>,
+    pub caret_line_indexes_by_paintable: HashMap<(usize, PaintableSlotId), CaretLineIndex>,
+    pub caret_item_indices_by_containing_block: HashMap<(usize, NodeSlotId), Vec<usize>>,
 }
 
 impl HitTestList {
@@ -158,6 +197,49 @@ impl HitTestList {
             }
             self.add_item_to_caret_items(item_index);
         }
+        self.used_visual_context_indices.sort_by_key(|visual_context_index| {
+            std::cmp::Reverse(
+                self.spatial_indexes[*visual_context_index]
+                    .as_ref()
+                    .map_or(0, |spatial_index| spatial_index.topmost_item_index),
+            )
+        });
+        self.build_caret_line_indexes();
+    }
+
+    fn build_caret_line_indexes(&mut self) {
+        for line_index in 0..self.caret_lines.len() {
+            let line = &self.caret_lines[line_index];
+            let paintable = self.items[self.caret_item_indices[line.first_caret_item_index]].paintable;
+            for index in [
+                self.caret_line_indexes_by_visual_context
+                    .entry(line.visual_context_index)
+                    .or_default(),
+                self.caret_line_indexes_by_paintable
+                    .entry((line.visual_context_index, paintable))
+                    .or_default(),
+            ] {
+                index.by_vertical_middle.push(line_index);
+                index.by_horizontal_middle.push(line_index);
+            }
+        }
+
+        // NB: Stable sorts keep lines with equal middles in record order, which ties between them rely on.
+        let caret_lines = &self.caret_lines;
+        let sort_index = |index: &mut CaretLineIndex| {
+            index.by_vertical_middle.sort_by_key(|line_index| {
+                let rect = caret_lines[*line_index].rect;
+                axis_middle(rect.top(), rect.bottom())
+            });
+            index.by_horizontal_middle.sort_by_key(|line_index| {
+                let rect = caret_lines[*line_index].rect;
+                axis_middle(rect.left(), rect.right())
+            });
+        };
+        self.caret_line_indexes_by_visual_context
+            .values_mut()
+            .for_each(sort_index);
+        self.caret_line_indexes_by_paintable.values_mut().for_each(sort_index);
     }
 
     fn spatial_index_for(&mut self, visual_context_index: usize) -> &mut SpatialIndex {
@@ -177,34 +259,50 @@ impl HitTestList {
             (item.kind, item.rect, item.visual_context_index)
         };
         let spatial_index = self.spatial_index_for(visual_context_index);
+        spatial_index.topmost_item_index = item_index;
         if kind == HitTestItemKind::ChromeWidget || rect.is_empty() {
             spatial_index.unbucketed_items.push(item_index);
             return;
         }
-        let min_x = spatial_index_cell_for(rect.left());
-        let max_x = spatial_index_cell_for(rect.right());
-        let min_y = spatial_index_cell_for(rect.top());
-        let max_y = spatial_index_cell_for(rect.bottom());
+        if Self::add_item_to_grid(&mut spatial_index.cells, SPATIAL_INDEX_CELL_SIZE, rect, item_index) {
+            return;
+        }
+        if Self::add_item_to_grid(
+            &mut spatial_index.coarse_cells,
+            COARSE_SPATIAL_INDEX_CELL_SIZE,
+            rect,
+            item_index,
+        ) {
+            return;
+        }
+        spatial_index.unbucketed_items.push(item_index);
+    }
+
+    fn add_item_to_grid(
+        cells: &mut HashMap<u64, Vec<usize>>,
+        cell_size: f64,
+        rect: CssPixelRect,
+        item_index: usize,
+    ) -> bool {
+        let min_x = spatial_index_cell_for(rect.left(), cell_size);
+        let max_x = spatial_index_cell_for(rect.right(), cell_size);
+        let min_y = spatial_index_cell_for(rect.top(), cell_size);
+        let max_y = spatial_index_cell_for(rect.bottom(), cell_size);
         let column_count = i64::from(max_x) - i64::from(min_x) + 1;
         let row_count = i64::from(max_y) - i64::from(min_y) + 1;
         if column_count <= 0 || row_count <= 0 {
-            spatial_index.unbucketed_items.push(item_index);
-            return;
+            return false;
         }
         let cell_count = column_count as u64 * row_count as u64;
         if cell_count > MAX_BUCKETED_CELLS_PER_ITEM {
-            spatial_index.unbucketed_items.push(item_index);
-            return;
+            return false;
         }
         for y in min_y..=max_y {
             for x in min_x..=max_x {
-                spatial_index
-                    .cells
-                    .entry(spatial_index_cell_key(x, y))
-                    .or_default()
-                    .push(item_index);
+                cells.entry(spatial_index_cell_key(x, y)).or_default().push(item_index);
             }
         }
+        true
     }
 
     fn add_item_to_caret_items(&mut self, item_index: usize) {
@@ -214,6 +312,10 @@ impl HitTestList {
         }
         let caret_item_index = self.caret_item_indices.len();
         self.caret_item_indices.push(item_index);
+        self.caret_item_indices_by_containing_block
+            .entry((item.visual_context_index, item.containing_block))
+            .or_default()
+            .push(item_index);
 
         let writing_mode = item.writing_mode;
         let item_line_rect = Self::caret_line_rect_for_item(item);
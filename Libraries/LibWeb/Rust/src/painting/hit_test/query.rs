@@ -15,9 +15,35 @@ pub struct TopmostItem {
     pub local_point: CssPixelPoint,
 }
 
-struct TopmostSearch<'a> {
-    index: &'a mut Option<usize>,
-    caret_capable_only: bool,
+// Yields the candidate items of a point from every level of a spatial index, topmost first. Each item is bucketed in
+// one level only, so merging the ascending per-level lists never yields an item twice.
+struct CandidatesTopmostFirst<'a> {
+    lists: [&'a [usize]; 3],
+}
+
+impl<'a> Iterator for CandidatesTopmostFirst<'a> {
+    type Item = usize;
+
+    fn next(&mut self) -> Option<usize> {
+        let list = self.lists.iter_mut().max_by_key(|list| list.last().copied())?;
+        let current: &'a [usize] = *list;
+        let (item_index, rest) = current.split_last()?;
+        *list = rest;
+        Some(*item_index)
+    }
+}
+
+fn is_at_or_below(item_index: usize, topmost: Option<usize>) -> bool {
+    topmost.is_some_and(|topmost| item_index <= topmost)
+}
+
+fn bucket_at(cells: &HashMap<u64, Vec<usize>>, cell_size: f64, point: CssPixelPoint) -> &[usize] {
+    let x = spatial_index_cell_for(point.x, cell_size);
+    let y = spatial_index_cell_for(point.y, cell_size);
+    cells
+        .get(&spatial_index_cell_key(x, y))
+        .map(Vec::as_slice)
+        .unwrap_or_default()
 }
 
 impl HitTestList {
@@ -62,42 +88,21 @@ impl HitTestList {
         }
     }
 
-    fn find_topmost_item_in_list(
+    fn candidates_topmost_first(
         &self,
-        layout_arena: &LayoutNodeArena,
-        paintables: &PaintableArena,
-        callbacks: &FfiHitTestQueryCallbacks,
-        item_indices: &[usize],
-        local: (f32, f32),
-        search: TopmostSearch<'_>,
-    ) {
-        for item_index in item_indices.iter().rev() {
-            if search.index.is_some_and(|topmost| *item_index <= topmost) {
-                return;
-            }
-            let item = &self.items[*item_index];
-            if search.caret_capable_only && !item.can_produce_caret_position {
-                continue;
-            }
-            if !self.item_contains(layout_arena, paintables, callbacks, item, local) {
-                continue;
-            }
-            *search.index = Some(*item_index);
-            return;
-        }
-    }
-
-    fn candidate_item_lists(&self, visual_context_index: usize, local_point: CssPixelPoint) -> [Option<&[usize]>; 2] {
+        visual_context_index: usize,
+        local_point: CssPixelPoint,
+    ) -> CandidatesTopmostFirst<'_> {
         let spatial_index = self.spatial_indexes[visual_context_index]
             .as_ref()
             .expect("used visual context without spatial index");
-        let x = spatial_index_cell_for(local_point.x);
-        let y = spatial_index_cell_for(local_point.y);
-        let bucket = spatial_index.cells.get(&spatial_index_cell_key(x, y));
-        [
-            Some(spatial_index.unbucketed_items.as_slice()),
-            bucket.map(|bucket| bucket.as_slice()),
-        ]
+        CandidatesTopmostFirst {
+            lists: [
+                spatial_index.unbucketed_items.as_slice(),
+                bucket_at(&spatial_index.coarse_cells, COARSE_SPATIAL_INDEX_CELL_SIZE, local_point),
+                bucket_at(&spatial_index.cells, SPATIAL_INDEX_CELL_SIZE, local_point),
+            ],
+        }
     }
 
     fn find_topmost(
@@ -113,8 +118,18 @@ impl HitTestList {
         let mut topmost_caret: Option<TopmostItem> = None;
         let mut topmost_hit_index: Option<usize> = None;
         let mut topmost_caret_index: Option<usize> = None;
-        for context_position in 0..self.used_visual_context_indices.len() {
-            let visual_context_index = self.used_visual_context_indices[context_position];
+        for &visual_context_index in &self.used_visual_context_indices {
+            // Visual contexts are sorted by their topmost item, so once a context has nothing above the current hits,
+            // neither does any context after it.
+            let context_topmost_item_index = self.spatial_indexes[visual_context_index]
+                .as_ref()
+                .expect("used visual context without spatial index")
+                .topmost_item_index;
+            if is_at_or_below(context_topmost_item_index, topmost_hit_index)
+                && (!with_caret_item || is_at_or_below(context_topmost_item_index, topmost_caret_index))
+            {
+                break;
+            }
             let Some(local) = local_float_point(callbacks, visual_context_index, point, true) else {
                 continue;
             };
@@ -122,34 +137,25 @@ impl HitTestList {
 
             let previous_hit = topmost_hit_index;
             let previous_caret = topmost_caret_index;
-            for candidate_list in self
-                .candidate_item_lists(visual_context_index, local_point)
-                .into_iter()
-                .flatten()
-            {
-                self.find_topmost_item_in_list(
-                    layout_arena,
-                    paintables,
-                    callbacks,
-                    candidate_list,
-                    local,
-                    TopmostSearch {
-                        index: &mut topmost_hit_index,
-                        caret_capable_only: false,
-                    },
-                );
-                if with_caret_item {
-                    self.find_topmost_item_in_list(
-                        layout_arena,
-                        paintables,
-                        callbacks,
-                        candidate_list,
-                        local,
-                        TopmostSearch {
-                            index: &mut topmost_caret_index,
-                            caret_capable_only: true,
-                        },
-                    );
+            for item_index in self.candidates_topmost_first(visual_context_index, local_point) {
+                let hit_search_is_done = is_at_or_below(item_index, topmost_hit_index);
+                let caret_search_is_done = !with_caret_item || is_at_or_below(item_index, topmost_caret_index);
+                if hit_search_is_done && caret_search_is_done {
+                    break;
+                }
+                let item = &self.items[item_index];
+                let is_caret_candidate = !caret_search_is_done && item.can_produce_caret_position;
+                if hit_search_is_done && !is_caret_candidate {
+                    continue;
+                }
+                if !self.item_contains(layout_arena, paintables, callbacks, item, local) {
+                    continue;
+                }
+                if !hit_search_is_done {
+                    topmost_hit_index = Some(item_index);
+                }
+                if is_caret_candidate {
+                    topmost_caret_index = Some(item_index);
                 }
             }
             if topmost_hit_index != previous_hit {
@@ -196,25 +202,19 @@ impl HitTestList {
                 continue;
             };
             let local_point = to_css_point(local);
-            for candidate_list in self
-                .candidate_item_lists(visual_context_index, local_point)
-                .into_iter()
-                .flatten()
-            {
-                for item_index in candidate_list {
-                    if *item_index == winner.index
-                        || !self.item_contains(layout_arena, paintables, callbacks, &self.items[*item_index], local)
-                    {
-                        continue;
-                    }
-                    if self.depth_sort_key(callbacks, point, *item_index)
-                        > self.depth_sort_key(callbacks, point, winner.index)
-                    {
-                        winner = TopmostItem {
-                            index: *item_index,
-                            local_point,
-                        };
-                    }
+            for item_index in self.candidates_topmost_first(visual_context_index, local_point) {
+                if item_index == winner.index
+                    || !self.item_contains(layout_arena, paintables, callbacks, &self.items[item_index], local)
+                {
+                    continue;
+                }
+                if self.depth_sort_key(callbacks, point, item_index)
+                    > self.depth_sort_key(callbacks, point, winner.index)
+                {
+                    winner = TopmostItem {
+                        index: item_index,
+                        local_point,
+                    };
                 }
             }
         }
@@ -255,26 +255,19 @@ impl HitTestList {
     ) -> Vec<usize> {
         debug_assert!(self.derived_structures_built);
         let mut hit_item_indices: Vec<usize> = Vec::new();
-        for context_position in 0..self.used_visual_context_indices.len() {
-            let visual_context_index = self.used_visual_context_indices[context_position];
+        for &visual_context_index in &self.used_visual_context_indices {
             let Some(local) = local_float_point(callbacks, visual_context_index, point, true) else {
                 continue;
             };
             let local_point = to_css_point(local);
-            for candidate_list in self
-                .candidate_item_lists(visual_context_index, local_point)
-                .into_iter()
-                .flatten()
-            {
-                for item_index in candidate_list {
-                    if self.item_contains(layout_arena, paintables, callbacks, &self.items[*item_index], local) {
-                        hit_item_indices.push(*item_index);
-                    }
+            for item_index in self.candidates_topmost_first(visual_context_index, local_point) {
+                if self.item_contains(layout_arena, paintables, callbacks, &self.items[item_index], local) {
+                    hit_item_indices.push(item_index);
                 }
             }
         }
-        hit_item_indices.sort_by(|a, b| b.cmp(a));
-        hit_item_indices.dedup();
+        // Each visual context yields its hits topmost first, and no item is yielded twice.
+        hit_item_indices.sort_unstable_by(|a, b| b.cmp(a));
         self.sort_hits_within_sorting_contexts(callbacks, point, &mut hit_item_indices);
         hit_item_indices
     }
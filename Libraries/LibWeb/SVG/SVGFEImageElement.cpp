@@ -74,6 +74,8 @@ void SVGFEImageElement::process_href(Optional<Utf16String> const& href)
         auto request = HTML::create_potential_CORS_request(*m_href, Fetch::Infrastructure::Request::Destination::Image, HTML::CORSSettingAttribute::NoCORS);
         request->set_client(&document().relevant_settings_object());
         m_resource_request->fetch_resource(request);
+    } else {
+        m_resource_request->add_consumer_ideal_size({});
     }
 }
 
@@ -305,6 +305,8 @@ void SVGUseElement::fetch_the_document(URL::URL const& url)
         auto request = HTML::create_potential_CORS_request(url, Fetch::Infrastructure::Request::Destination::Image, HTML::CORSSettingAttribute::NoCORS);
         request->set_client(&document().relevant_settings_object());
         m_resource_request->fetch_resource(request);
+    } else {
+        m_resource_request->add_consumer_ideal_size({});
     }
 }
 
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGC/Heap.h>
+#include <LibWeb/WebAudio/AudioBuffer.h>
+#include <LibWeb/WebAudio/BaseAudioContext.h>
+#include <LibWeb/WebAudio/ConvolverNode.h>
+#include <LibWeb/WebAudio/Rendering/Convolver.h>
+#include <LibWeb/WebAudio/Rendering/RenderNodes.h>
+
+namespace Web::WebAudio {
+
+GC_DEFINE_ALLOCATOR(ConvolverNode);
+
+ConvolverNode::ConvolverNode(GC::Ref<BaseAudioContext> context)
+    : AudioNode(context)
+{
+}
+
+ConvolverNode::~ConvolverNode() = default;
+
+WebIDL::ExceptionOr<GC::Ref<ConvolverNode>> ConvolverNode::create(GC::Ref<BaseAudioContext> context, ConvolverOptions const& options)
+{
+    auto node = GC::Heap::the().allocate<ConvolverNode>(context);
+
+    // Default options for channel count and interpretation
+    // https://webaudio.github.io/web-audio-api/#ConvolverNode
+    AudioNodeDefaultOptions default_options;
+    default_options.channel_count_mode = ChannelCountMode::ClampedMax;
+    default_options.channel_interpretation = ChannelInterpretation::Speakers;
+    default_options.channel_count = 2;
+    // FIXME: Set tail-time to yes
+
+    TRY(node->initialize_audio_node_options(options, default_options));
+
+    // NB: The render node has to exist before the message that sets its response is queued.
+    node->queue_render_node_creation(make<Rendering::ConvolverRenderNode>(node->node_id(), BaseAudioContext::render_quantum_size()));
+
+    // 1. Set the attributes normalize to the inverse of the value of disableNormalization.
+    node->m_normalize = !options.disable_normalization;
+
+    // 2. If buffer exists, set the buffer attribute to its value.
+    if (GC::Ptr<AudioBuffer> buffer(options.buffer.value_or(nullptr)); buffer)
+        TRY(node->set_buffer(buffer));
+
+    return node;
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-convolvernode-convolvernode
+WebIDL::ExceptionOr<GC::Ref<ConvolverNode>> ConvolverNode::create_for_constructor(GC::Ref<BaseAudioContext> context, ConvolverOptions const& options)
+{
+    return create(context, options);
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-convolvernode-buffer
+WebIDL::ExceptionOr<void> ConvolverNode::set_buffer(GC::Ptr<AudioBuffer> buffer)
+{
+    if (buffer) {
+        // 1. If the buffer number of channels is not 1, 2, 4, or if the sample-rate of the buffer is not the same as
+        //    the sample-rate of its associated BaseAudioContext, a NotSupportedError MUST be thrown.
+        if (!first_is_one_of(buffer->number_of_channels(), 1u, 2u, 4u))
+            return WebIDL::NotSupportedError::create("ConvolverNode buffer must have 1, 2 or 4 channels"_utf16);
+        if (buffer->sample_rate() != context()->sample_rate())
+            return WebIDL::NotSupportedError::create("ConvolverNode buffer must have the same sample rate as its context"_utf16);
+    }
+
+    m_buffer = buffer;
+
+    // 2. Acquire the content of the AudioBuffer.
+    // NB: The response is normalized and transformed here, so the rendering thread only has to swap it in.
+    RefPtr<Rendering::ConvolverResponse> response;
+    if (m_buffer) {
+        if (auto contents = m_buffer->acquire_contents(); contents && contents->length() > 0)
+            response = Rendering::ConvolverResponse::create(*contents, m_normalize, BaseAudioContext::render_quantum_size());
+    }
+    context()->queue_control_message(NodeMessage { SetConvolverResponse { node_id(), move(response) } });
+
+    return {};
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audionode-channelcountmode
+WebIDL::ExceptionOr<void> ConvolverNode::set_channel_count_mode(ChannelCountMode mode)
+{
+    // https://webaudio.github.io/web-audio-api/#audionode-channelcountmode-constraints
+    // The channel count mode cannot be set to "max", and a NotSupportedError exception MUST be thrown for any attempt
+    // to set it to "max".
+    if (mode == ChannelCountMode::Max)
+        return WebIDL::NotSupportedError::create("ConvolverNode does not support 'max' as channelCountMode."_utf16);
+
+    return AudioNode::set_channel_count_mode(mode);
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audionode-channelcount
+WebIDL::ExceptionOr<void> ConvolverNode::set_channel_count(WebIDL::UnsignedLong channel_count)
+{
+    // https://webaudio.github.io/web-audio-api/#audionode-channelcount-constraints
+    // The channel count cannot be greater than two, and a NotSupportedError exception MUST be thrown for any attempt
+    // to change it to a value greater than two.
+    if (channel_count > 2)
+        return WebIDL::NotSupportedError::create("ConvolverNode does not support channel count greater than 2"_utf16);
+
+    return AudioNode::set_channel_count(channel_count);
+}
+
+void ConvolverNode::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_buffer);
+}
+
+}
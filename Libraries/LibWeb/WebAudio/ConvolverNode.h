@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/ConvolverNode.h>
+#include <LibWeb/WebAudio/AudioBuffer.h>
+#include <LibWeb/WebAudio/AudioNode.h>
+
+namespace Web::WebAudio {
+
+using ConvolverOptions = Bindings::ConvolverOptions;
+
+// https://webaudio.github.io/web-audio-api/#ConvolverNode
+class ConvolverNode final : public AudioNode {
+    WEB_WRAPPABLE(ConvolverNode, AudioNode);
+    GC_DECLARE_ALLOCATOR(ConvolverNode);
+
+public:
+    virtual ~ConvolverNode() override;
+
+    static WebIDL::ExceptionOr<GC::Ref<ConvolverNode>> create(GC::Ref<BaseAudioContext>, ConvolverOptions const& = {});
+    static WebIDL::ExceptionOr<GC::Ref<ConvolverNode>> create_for_constructor(GC::Ref<BaseAudioContext>, ConvolverOptions const& = {});
+
+    virtual WebIDL::UnsignedLong number_of_inputs() override { return 1; }
+    virtual WebIDL::UnsignedLong number_of_outputs() override { return 1; }
+
+    virtual WebIDL::ExceptionOr<void> set_channel_count_mode(ChannelCountMode) override;
+    virtual WebIDL::ExceptionOr<void> set_channel_count(WebIDL::UnsignedLong) override;
+
+    WebIDL::ExceptionOr<void> set_buffer(GC::Ptr<AudioBuffer>);
+    GC::Ptr<AudioBuffer> buffer() const { return m_buffer; }
+
+    void set_normalize(bool normalize) { m_normalize = normalize; }
+    bool normalize() const { return m_normalize; }
+
+private:
+    explicit ConvolverNode(GC::Ref<BaseAudioContext>);
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    // https://webaudio.github.io/web-audio-api/#dom-convolvernode-buffer
+    GC::Ptr<AudioBuffer> m_buffer;
+
+    // https://webaudio.github.io/web-audio-api/#dom-convolvernode-normalize
+    bool m_normalize { true };
+};
+
+}
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <LibSync/ConditionVariable.h>
+#include <LibSync/Mutex.h>
+#include <LibThreading/ThreadPool.h>
+#include <LibWeb/WebAudio/Rendering/Convolver.h>
+
+namespace Web::WebAudio::Rendering {
+
+using AK::SIMD::f32x4;
+
+static ConvolverKernel::Partitions partition_impulse_response(ReadonlySpan<float> impulse_response, float scale, size_t block_size)
+{
+    ConvolverKernel::Partitions partitions;
+    partitions.block_size = block_size;
+    partitions.count = max<size_t>(ceil_div(impulse_response.size(), block_size), 1);
+    partitions.real.resize(partitions.count * partitions.bin_count());
+    partitions.imaginary.resize(partitions.count * partitions.bin_count());
+
+    // NB: The inverse transform is unscaled, so its scale factor is folded into the partitions here.
+    FFT fft(block_size * 2);
+    scale /= fft.size();
+
+    Vector<float> real;
+    Vector<float> imaginary;
+    real.resize(fft.size());
+    imaginary.resize(fft.size());
+
+    for (size_t partition = 0; partition < partitions.count; ++partition) {
+        real.fill(0.f);
+        imaginary.fill(0.f);
+        auto samples = impulse_response.slice(min(partition * block_size, impulse_response.size()));
+        for (size_t frame = 0; frame < min(block_size, samples.size()); ++frame)
+            real[frame] = samples[frame] * scale;
+
+        fft.transform(real, imaginary);
+
+        auto offset = partition * partitions.bin_count();
+        for (size_t bin = 0; bin < partitions.bin_count(); ++bin) {
+            partitions.real[offset + bin] = real[bin];
+            partitions.imaginary[offset + bin] = imaginary[bin];
+        }
+    }
+    return partitions;
+}
+
+NonnullRefPtr<ConvolverKernel> ConvolverKernel::create(ReadonlySpan<float> impulse_response, float scale, size_t quantum_size)
+{
+    auto tail_block_size = quantum_size * tail_block_size_in_quanta;
+    auto tail_offset = 2 * tail_block_size;
+
+    auto head = partition_impulse_response(impulse_response.trim(tail_offset), scale, quantum_size);
+    Optional<Partitions> tail;
+    if (impulse_response.size() > tail_offset)
+        tail = partition_impulse_response(impulse_response.slice(tail_offset), scale, tail_block_size);
+
+    return adopt_ref(*new ConvolverKernel(move(head), move(tail)));
+}
+
+// Accumulates the products of two sets of spectra, four bins at a time.
+static void multiply_accumulate(Span<float> accumulator_real, Span<float> accumulator_imaginary, ReadonlySpan<float> a_real, ReadonlySpan<float> a_imaginary, ReadonlySpan<float> b_real, ReadonlySpan<float> b_imaginary)
+{
+    using AK::SIMD::load_unaligned;
+    using AK::SIMD::store_unaligned;
+
+    auto bin_count = accumulator_real.size();
+    size_t bin = 0;
+    for (; bin + 4 <= bin_count; bin += 4) {
+        auto ar = load_unaligned<f32x4>(&a_real[bin]);
+        auto ai = load_unaligned<f32x4>(&a_imaginary[bin]);
+        auto br = load_unaligned<f32x4>(&b_real[bin]);
+        auto bi = load_unaligned<f32x4>(&b_imaginary[bin]);
+        auto real = load_unaligned<f32x4>(&accumulator_real[bin]);
+        auto imaginary = load_unaligned<f32x4>(&accumulator_imaginary[bin]);
+        real += ar * br - ai * bi;
+        imaginary += ar * bi + ai * br;
+        store_unaligned(&accumulator_real[bin], real);
+        store_unaligned(&accumulator_imaginary[bin], imaginary);
+    }
+    for (; bin < bin_count; ++bin) {
+        accumulator_real[bin] += a_real[bin] * b_real[bin] - a_imaginary[bin] * b_imaginary[bin];
+        accumulator_imaginary[bin] += a_real[bin] * b_imaginary[bin] + a_imaginary[bin] * b_real[bin];
+    }
+}
+
+UniformPartitionedConvolver::UniformPartitionedConvolver(ConvolverKernel::Partitions const& partitions)
+    : m_partitions(partitions)
+    , m_fft(partitions.block_size * 2)
+{
+    m_input_window.resize(m_fft.size());
+    m_delay_line_real.resize(partitions.count * partitions.bin_count());
+    m_delay_line_imaginary.resize(partitions.count * partitions.bin_count());
+    m_accumulator_real.resize(partitions.bin_count());
+    m_accumulator_imaginary.resize(partitions.bin_count());
+    m_transform_real.resize(m_fft.size());
+    m_transform_imaginary.resize(m_fft.size());
+}
+
+void UniformPartitionedConvolver::process_block(ReadonlySpan<float> input, Span<float> output)
+{
+    auto block_size = m_partitions.block_size;
+    auto bin_count = m_partitions.bin_count();
+    VERIFY(input.size() == block_size);
+    VERIFY(output.size() == block_size);
+
+    // Slide the input window along by one block and transform it into the newest slot of the delay line.
+    m_input_window.span().slice(block_size).copy_to(m_input_window);
+    input.copy_to(m_input_window.span().slice(block_size));
+    m_input_window.span().copy_to(m_transform_real);
+    m_transform_imaginary.fill(0.f);
+    m_fft.transform(m_transform_real, m_transform_imaginary);
+
+    auto newest_slot = m_delay_line_position * bin_count;
+    m_transform_real.span().trim(bin_count).copy_to(m_delay_line_real.span().slice(newest_slot));
+    m_transform_imaginary.span().trim(bin_count).copy_to(m_delay_line_imaginary.span().slice(newest_slot));
+
+    // Partition p of the response is applied to the input window from p blocks ago.
+    m_accumulator_real.fill(0.f);
+    m_accumulator_imaginary.fill(0.f);
+    for (size_t partition = 0; partition < m_partitions.count; ++partition) {
+        auto slot = ((m_delay_line_position + m_partitions.count - partition) % m_partitions.count) * bin_count;
+        auto offset = partition * bin_count;
+        multiply_accumulate(m_accumulator_real, m_accumulator_imaginary,
+            m_delay_line_real.span().slice(slot, bin_count), m_delay_line_imaginary.span().slice(slot, bin_count),
+            m_partitions.real.span().slice(offset, bin_count), m_partitions.imaginary.span().slice(offset, bin_count));
+    }
+    m_delay_line_position = (m_delay_line_position + 1) % m_partitions.count;
+
+    // Restore the redundant upper half of the spectrum before transforming back.
+    for (size_t bin = 0; bin < bin_count; ++bin) {
+        m_transform_real[bin] = m_accumulator_real[bin];
+        m_transform_imaginary[bin] = m_accumulator_imaginary[bin];
+    }
+    for (size_t bin = 1; bin < block_size; ++bin) {
+        m_transform_real[m_fft.size() - bin] = m_accumulator_real[bin];
+        m_transform_imaginary[m_fft.size() - bin] = -m_accumulator_imaginary[bin];
+    }
+    m_fft.inverse_transform(m_transform_real, m_transform_imaginary);
+
+    // The first half of the result wraps around circularly; only the second half is the linear convolution.
+    m_transform_real.span().slice(block_size).copy_to(output);
+}
+
+// Convolves the input with the tail partitions of a kernel, one tail block at a time, on the thread pool. The rendering
+// thread hands over a block of input once it has been gathered, and picks up the result one tail block later, which is
+// exactly when the first frame of that result is due since the tail starts two tail blocks into the response.
+struct Convolver::TailStage : public AtomicRefCounted<TailStage> {
+    explicit TailStage(NonnullRefPtr<ConvolverKernel const> kernel)
+        : kernel(move(kernel))
+        , convolver(*this->kernel->tail())
+    {
+        input.resize(this->kernel->tail_block_size());
+        output.resize(this->kernel->tail_block_size());
+    }
+
+    void start()
+    {
+        {
+            Sync::MutexLocker locker(mutex);
+            is_busy = true;
+        }
+        Threading::ThreadPool::the().submit([self = NonnullRefPtr(*this)] {
+            self->convolver.process_block(self->input, self->output);
+
+            Sync::MutexLocker locker(self->mutex);
+            self->is_busy = false;
+            self->idle_condition.signal();
+        });
+    }
+
+    void wait_until_idle()
+    {
+        Sync::MutexLocker locker(mutex);
+        while (is_busy)
+            idle_condition.wait();
+    }
+
+    NonnullRefPtr<ConvolverKernel const> kernel;
+    UniformPartitionedConvolver convolver;
+
+    // NB: These are only touched by the rendering thread while the stage is idle.
+    Vector<float> input;
+    Vector<float> output;
+
+    Sync::Mutex mutex;
+    Sync::ConditionVariable idle_condition { mutex };
+    bool is_busy { false };
+};
+
+Convolver::Convolver(NonnullRefPtr<ConvolverKernel const> kernel)
+    : m_kernel(move(kernel))
+    , m_head(m_kernel->head())
+{
+    if (m_kernel->tail().has_value()) {
+        m_tail_stage = adopt_ref(*new TailStage(m_kernel));
+        m_tail_input.resize(m_kernel->tail_block_size());
+        m_tail_output.resize(m_kernel->tail_block_size());
+    }
+}
+
+// NB: A tail block that is still being convolved keeps its stage alive until it is done.
+Convolver::~Convolver() = default;
+
+void Convolver::process(ReadonlySpan<float> input, Span<float> output)
+{
+    m_head.process_block(input, output);
+    if (!m_tail_stage)
+        return;
+
+    input.copy_to(m_tail_input.span().slice(m_tail_position));
+    for (size_t frame = 0; frame < output.size(); ++frame)
+        output[frame] += m_tail_output[m_tail_position + frame];
+
+    m_tail_position += input.size();
+    if (m_tail_position < m_tail_input.size())
+        return;
+    m_tail_position = 0;
+
+    // The previous block has had a whole tail block's worth of render quanta to finish, so this rarely has to wait.
+    m_tail_stage->wait_until_idle();
+    swap(m_tail_output, m_tail_stage->output);
+    swap(m_tail_input, m_tail_stage->input);
+    m_tail_stage->start();
+}
+
+NonnullRefPtr<ConvolverResponse> ConvolverResponse::create(AudioBufferContents const& contents, bool normalize, size_t quantum_size)
+{
+    VERIFY(first_is_one_of(contents.channels.size(), 1u, 2u, 4u));
+
+    auto scale = normalize ? calculate_convolver_normalization_scale(contents) : 1.f;
+
+    auto response = adopt_ref(*new ConvolverResponse);
+    response->impulse_response_channel_count = contents.channels.size();
+    for (auto const& channel : contents.channels) {
+        auto kernel = ConvolverKernel::create(channel, scale, quantum_size);
+        response->convolvers.append(make<Convolver>(kernel));
+        if (contents.channels.size() == 1)
+            response->convolvers.append(make<Convolver>(kernel));
+    }
+    return response;
+}
+
+// https://webaudio.github.io/web-audio-api/#ConvolverNode-normalization
+float calculate_convolver_normalization_scale(AudioBufferContents const& contents)
+{
+    static constexpr double gain_calibration = 0.00125;
+    static constexpr double gain_calibration_sample_rate = 44100;
+    static constexpr double min_power = 0.000125;
+
+    // Normalize by RMS power.
+    double power = 0;
+    for (auto const& channel : contents.channels) {
+        double channel_power = 0;
+        for (auto sample : channel)
+            channel_power += static_cast<double>(sample) * sample;
+        power += channel_power;
+    }
+    power = AK::sqrt(power / (contents.channels.size() * contents.length()));
+
+    // Protect against accidental overload.
+    if (!isfinite(power) || isnan(power) || power < min_power)
+        power = min_power;
+
+    auto scale = 1 / power;
+
+    // Calibrate to make perceived volume same as unprocessed.
+    scale *= gain_calibration;
+
+    // Scale depends on sample-rate.
+    if (contents.sample_rate != 0)
+        scale *= gain_calibration_sample_rate / contents.sample_rate;
+
+    // True-stereo compensation.
+    if (contents.channels.size() == 4)
+        scale *= 0.5;
+
+    return static_cast<float>(scale);
+}
+
+}
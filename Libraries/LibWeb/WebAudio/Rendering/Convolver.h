@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/RefPtr.h>
+#include <AK/Span.h>
+#include <AK/Vector.h>
+#include <LibWeb/Export.h>
+#include <LibWeb/WebAudio/Rendering/AudioData.h>
+#include <LibWeb/WebAudio/Rendering/FFT.h>
+
+namespace Web::WebAudio::Rendering {
+
+// One channel of an impulse response, cut into partitions that are transformed to the frequency domain up front so
+// that convolving with it only takes one forward and one inverse transform per block.
+//
+// The start of the response is cut into partitions of one render quantum, which are convolved on the rendering thread
+// without adding latency. Whatever lies beyond the first two tail blocks is cut into partitions of one tail block each;
+// since those only affect the output a full tail block after the input arrived, they are convolved on a thread pool.
+class WEB_API ConvolverKernel : public AtomicRefCounted<ConvolverKernel> {
+public:
+    static constexpr size_t tail_block_size_in_quanta = 16;
+
+    static NonnullRefPtr<ConvolverKernel> create(ReadonlySpan<float> impulse_response, float scale, size_t quantum_size);
+
+    struct Partitions {
+        size_t block_size { 0 };
+        size_t count { 0 };
+
+        // Each partition only stores the block_size + 1 bins of its spectrum that are not redundant, since the
+        // spectrum of a real signal is conjugate symmetric.
+        Vector<float> real;
+        Vector<float> imaginary;
+
+        size_t bin_count() const { return block_size + 1; }
+    };
+
+    Partitions const& head() const { return m_head; }
+    Optional<Partitions> const& tail() const { return m_tail; }
+
+    // The offset into the impulse response at which the tail partitions start.
+    size_t tail_offset() const { return 2 * tail_block_size(); }
+    size_t tail_block_size() const { return m_head.block_size * tail_block_size_in_quanta; }
+
+private:
+    ConvolverKernel(Partitions head, Optional<Partitions> tail)
+        : m_head(move(head))
+        , m_tail(move(tail))
+    {
+    }
+
+    Partitions m_head;
+    Optional<Partitions> m_tail;
+};
+
+// Uniformly partitioned overlap-save convolution with a frequency-domain delay line. Every call consumes and produces
+// one block of the partitions' block size, and the output already includes the contribution of the block passed in.
+class WEB_API UniformPartitionedConvolver {
+public:
+    explicit UniformPartitionedConvolver(ConvolverKernel::Partitions const&);
+
+    void process_block(ReadonlySpan<float> input, Span<float> output);
+
+private:
+    ConvolverKernel::Partitions const& m_partitions;
+    FFT m_fft;
+
+    // The previous and the current input block, which are transformed together.
+    Vector<float> m_input_window;
+
+    // The spectra of the last m_partitions.count input windows, with the newest one at m_delay_line_position.
+    Vector<float> m_delay_line_real;
+    Vector<float> m_delay_line_imaginary;
+    size_t m_delay_line_position { 0 };
+
+    Vector<float> m_accumulator_real;
+    Vector<float> m_accumulator_imaginary;
+    Vector<float> m_transform_real;
+    Vector<float> m_transform_imaginary;
+};
+
+// Convolves one input channel with a ConvolverKernel, one render quantum at a time.
+class WEB_API Convolver {
+    AK_MAKE_NONCOPYABLE(Convolver);
+    AK_MAKE_NONMOVABLE(Convolver);
+
+public:
+    explicit Convolver(NonnullRefPtr<ConvolverKernel const>);
+    ~Convolver();
+
+    void process(ReadonlySpan<float> input, Span<float> output);
+
+private:
+    struct TailStage;
+
+    NonnullRefPtr<ConvolverKernel const> m_kernel;
+    UniformPartitionedConvolver m_head;
+
+    RefPtr<TailStage> m_tail_stage;
+    Vector<float> m_tail_input;
+    Vector<float> m_tail_output;
+    size_t m_tail_position { 0 };
+};
+
+// The state a ConvolverNode renders with after its buffer was set. It is prepared on the control thread, where the
+// impulse response is normalized and transformed, and then handed over to the rendering thread as a whole.
+// https://webaudio.github.io/web-audio-api/#ConvolverNode
+struct WEB_API ConvolverResponse : public AtomicRefCounted<ConvolverResponse> {
+    static NonnullRefPtr<ConvolverResponse> create(AudioBufferContents const&, bool normalize, size_t quantum_size);
+
+    size_t impulse_response_channel_count { 0 };
+
+    // One convolver per channel of the impulse response. A mono response gets a second convolver using the same kernel,
+    // so that the left and right input channels each have their own state.
+    Vector<NonnullOwnPtr<Convolver>, 4> convolvers;
+};
+
+// https://webaudio.github.io/web-audio-api/#ConvolverNode-normalization
+WEB_API float calculate_convolver_normalization_scale(AudioBufferContents const&);
+
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BuiltinWrappers.h>
+#include <AK/Math.h>
+#include <AK/StdLibExtras.h>
+#include <LibWeb/WebAudio/Rendering/FFT.h>
+
+namespace Web::WebAudio::Rendering {
+
+FFT::FFT(size_t size)
+    : m_size(size)
+{
+    VERIFY(size >= 2 && is_power_of_two(size));
+
+    auto bits = static_cast<size_t>(count_trailing_zeroes(size));
+    m_bit_reversed_indices.resize(size);
+    for (size_t index = 0; index < size; ++index) {
+        u32 reversed = 0;
+        for (size_t bit = 0; bit < bits; ++bit) {
+            if (index & (1u << bit))
+                reversed |= 1u << (bits - 1 - bit);
+        }
+        m_bit_reversed_indices[index] = reversed;
+    }
+
+    m_cosines.resize(size / 2);
+    m_sines.resize(size / 2);
+    for (size_t index = 0; index < size / 2; ++index) {
+        auto angle = -2. * AK::Pi<double> * index / size;
+        m_cosines[index] = static_cast<float>(AK::cos(angle));
+        m_sines[index] = static_cast<float>(AK::sin(angle));
+    }
+}
+
+void FFT::transform(Span<float> real, Span<float> imaginary, bool inverse) const
+{
+    VERIFY(real.size() == m_size);
+    VERIFY(imaginary.size() == m_size);
+
+    for (size_t index = 0; index < m_size; ++index) {
+        auto reversed = m_bit_reversed_indices[index];
+        if (index < reversed) {
+            swap(real[index], real[reversed]);
+            swap(imaginary[index], imaginary[reversed]);
+        }
+    }
+
+    // The inverse transform uses the complex conjugates of the forward twiddle factors.
+    float sine_sign = inverse ? -1.f : 1.f;
+
+    for (size_t half_span = 1; half_span < m_size; half_span *= 2) {
+        auto twiddle_stride = m_size / (half_span * 2);
+        for (size_t start = 0; start < m_size; start += half_span * 2) {
+            for (size_t offset = 0; offset < half_span; ++offset) {
+                auto twiddle_real = m_cosines[offset * twiddle_stride];
+                auto twiddle_imaginary = sine_sign * m_sines[offset * twiddle_stride];
+
+                auto even = start + offset;
+                auto odd = even + half_span;
+                auto odd_real = real[odd] * twiddle_real - imaginary[odd] * twiddle_imaginary;
+                auto odd_imaginary = real[odd] * twiddle_imaginary + imaginary[odd] * twiddle_real;
+
+                real[odd] = real[even] - odd_real;
+                imaginary[odd] = imaginary[even] - odd_imaginary;
+                real[even] += odd_real;
+                imaginary[even] += odd_imaginary;
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Span.h>
+#include <AK/Vector.h>
+#include <LibWeb/Export.h>
+
+namespace Web::WebAudio::Rendering {
+
+// An in-place, iterative radix-2 fast Fourier transform of a fixed power-of-two size. The real and imaginary parts are
+// kept in separate arrays so that callers can operate on the spectra with plain vector arithmetic.
+class WEB_API FFT {
+public:
+    explicit FFT(size_t size);
+
+    size_t size() const { return m_size; }
+
+    void transform(Span<float> real, Span<float> imaginary) const { transform(real, imaginary, false); }
+
+    // Computes the unscaled inverse transform; the result has to be divided by size() to recover the original signal.
+    void inverse_transform(Span<float> real, Span<float> imaginary) const { transform(real, imaginary, true); }
+
+private:
+    void transform(Span<float> real, Span<float> imaginary, bool inverse) const;
+
+    size_t m_size { 0 };
+    Vector<u32> m_bit_reversed_indices;
+    Vector<float> m_cosines;
+    Vector<float> m_sines;
+};
+
+}
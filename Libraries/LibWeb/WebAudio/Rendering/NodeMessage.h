@@ -14,6 +14,7 @@
 #include <LibWeb/Bindings/OscillatorNode.h>
 #include <LibWeb/Bindings/PannerNode.h>
 #include <LibWeb/WebAudio/Rendering/AudioData.h>
+#include <LibWeb/WebAudio/Rendering/Convolver.h>
 #include <LibWeb/WebAudio/Types.h>
 
 namespace Web::WebAudio {
@@ -70,8 +71,14 @@ struct SetPannerParameters {
     double cone_outer_gain { 0 };
 };
 
+// Replaces a ConvolverNode's impulse response with one that was prepared on the control thread, or clears it.
+struct SetConvolverResponse {
+    NodeID node_id { 0 };
+    RefPtr<Rendering::ConvolverResponse> response;
+};
+
 // A control message that updates the state of a single render node.
-using NodeMessage = Variant<StartSource, StopSource, StartBufferSource, SetBufferSourceParameters, SetOscillatorWaveform, SetBiquadFilterType, SetPannerParameters>;
+using NodeMessage = Variant<StartSource, StopSource, StartBufferSource, SetBufferSourceParameters, SetOscillatorWaveform, SetBiquadFilterType, SetPannerParameters, SetConvolverResponse>;
 
 inline NodeID node_message_target(NodeMessage const& message)
 {
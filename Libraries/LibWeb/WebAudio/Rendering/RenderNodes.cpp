@@ -805,6 +805,68 @@ void PannerRenderNode::process(RenderGraph& graph, RenderContext const& context)
     }
 }
 
+ConvolverRenderNode::ConvolverRenderNode(NodeID node_id, size_t quantum_size)
+    : RenderNode(node_id, 1, 1, quantum_size)
+{
+    set_channel_count_mode(Bindings::ChannelCountMode::ClampedMax);
+    m_cross_path_output.resize(quantum_size);
+}
+
+void ConvolverRenderNode::handle_message(NodeMessage const& message)
+{
+    message.visit(
+        [&](SetConvolverResponse const& set_response) { m_response = set_response.response; },
+        [](auto const&) {});
+}
+
+// https://webaudio.github.io/web-audio-api/#Convolution-channel-configurations
+void ConvolverRenderNode::process(RenderGraph& graph, RenderContext const& context)
+{
+    auto const& input = pull_input(graph, context, 0);
+    auto& convolver_output = output(0);
+
+    if (!m_response) {
+        convolver_output.set_channel_count(1);
+        convolver_output.zero();
+        return;
+    }
+
+    auto& convolvers = m_response->convolvers;
+    auto input_left = input.channel(0);
+    auto input_right = input.channel_count() > 1 ? input.channel(1) : input.channel(0);
+
+    // A mono input convolved with a mono response stays mono; every other configuration produces stereo output.
+    if (input.channel_count() == 1 && m_response->impulse_response_channel_count == 1) {
+        convolver_output.set_channel_count(1);
+        convolvers[0]->process(input_left, convolver_output.channel(0));
+        return;
+    }
+
+    convolver_output.set_channel_count(2);
+    auto output_left = convolver_output.channel(0);
+    auto output_right = convolver_output.channel(1);
+
+    // With a mono or stereo response, each input channel is only convolved into the output channel on its own side. A
+    // mono input is used as both the left and the right input.
+    if (m_response->impulse_response_channel_count != 4) {
+        convolvers[0]->process(input_left, output_left);
+        convolvers[1]->process(input_right, output_right);
+        return;
+    }
+
+    // A four-channel "true stereo" response holds the left-to-left, left-to-right, right-to-left and right-to-right
+    // paths, in that order.
+    convolvers[0]->process(input_left, output_left);
+    convolvers[2]->process(input_right, m_cross_path_output);
+    for (size_t frame = 0; frame < context.quantum_size; ++frame)
+        output_left[frame] += m_cross_path_output[frame];
+
+    convolvers[1]->process(input_left, output_right);
+    convolvers[3]->process(input_right, m_cross_path_output);
+    for (size_t frame = 0; frame < context.quantum_size; ++frame)
+        output_right[frame] += m_cross_path_output[frame];
+}
+
 PassthroughRenderNode::PassthroughRenderNode(NodeID node_id, size_t quantum_size)
     : RenderNode(node_id, 1, 1, quantum_size)
 {
@@ -13,6 +13,7 @@
 #include <AK/Vector.h>
 #include <LibWeb/WebAudio/Rendering/AudioData.h>
 #include <LibWeb/WebAudio/Rendering/BiquadCoefficients.h>
+#include <LibWeb/WebAudio/Rendering/Convolver.h>
 #include <LibWeb/WebAudio/Rendering/RenderNode.h>
 
 namespace Web::WebAudio::Rendering {
@@ -270,6 +271,19 @@ private:
     Vector<Vector<float>> m_param_values;
 };
 
+// https://webaudio.github.io/web-audio-api/#ConvolverNode
+class ConvolverRenderNode final : public RenderNode {
+public:
+    ConvolverRenderNode(NodeID, size_t quantum_size);
+
+    virtual void process(RenderGraph&, RenderContext const&) override;
+    virtual void handle_message(NodeMessage const&) override;
+
+private:
+    RefPtr<ConvolverResponse> m_response;
+    Vector<float> m_cross_path_output;
+};
+
 // Passes the input through unchanged; used for nodes whose processing is not implemented yet but which should not
 // silence the signal path, like AnalyserNode.
 class PassthroughRenderNode final : public RenderNode {
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibGC/Heap.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibWeb/WebCodecs/AudioData.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::WebCodecs {
+
+GC_DEFINE_ALLOCATOR(AudioData);
+
+static bool is_interleaved(AudioSampleFormat format)
+{
+    switch (format) {
+    case AudioSampleFormat::U8:
+    case AudioSampleFormat::S16:
+    case AudioSampleFormat::S32:
+    case AudioSampleFormat::F32:
+        return true;
+    case AudioSampleFormat::U8Planar:
+    case AudioSampleFormat::S16Planar:
+    case AudioSampleFormat::S32Planar:
+    case AudioSampleFormat::F32Planar:
+        return false;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+GC::Ref<AudioData> AudioData::create(NonnullOwnPtr<Media::AudioBlock> block)
+{
+    return GC::Heap::the().allocate<AudioData>(make_ref_counted<Resource>(move(block)));
+}
+
+AudioData::AudioData(NonnullRefPtr<Resource> resource)
+    : m_resource_reference(resource)
+    // NB: Decoders always output planar floating point samples.
+    , m_format(AudioSampleFormat::F32Planar)
+    , m_sample_rate(resource->block().sample_rate())
+    , m_number_of_frames(resource->block().frame_count())
+    , m_number_of_channels(resource->block().channel_count())
+    , m_timestamp(resource->block().media_time_start().to_microseconds())
+{
+}
+
+AudioData::~AudioData() = default;
+
+// https://w3c.github.io/webcodecs/#dom-audiodata-duration
+WebIDL::UnsignedLongLong AudioData::duration() const
+{
+    // 1. Let microsecondsPerSecond be 1,000,000.
+    // 2. Let durationInSeconds be the result of dividing [[number of frames]] by [[sample rate]].
+    // 3. Return the product of durationInSeconds and microsecondsPerSecond.
+    if (m_sample_rate == 0)
+        return 0;
+    return static_cast<WebIDL::UnsignedLongLong>(m_number_of_frames * 1'000'000.0 / m_sample_rate);
+}
+
+// https://w3c.github.io/webcodecs/#compute-copy-element-count
+WebIDL::ExceptionOr<WebIDL::UnsignedLong> AudioData::compute_copy_element_count(AudioDataCopyToOptions const& options) const
+{
+    // 1. Let destFormat be the value of [[format]].
+    // 2. If options.format exists, assign options.format to destFormat.
+    auto destination_format = options.format.value_or(*m_format);
+
+    // 3. If destFormat describes an interleaved AudioSampleFormat and options.planeIndex is greater than 0, throw a
+    //    RangeError.
+    if (is_interleaved(destination_format) && options.plane_index > 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Interleaved formats only have a single plane"_utf16 };
+
+    // 4. Otherwise, if destFormat describes a planar AudioSampleFormat and if options.planeIndex is greater or equal
+    //    to [[number of channels]], throw a RangeError.
+    if (!is_interleaved(destination_format) && options.plane_index >= m_number_of_channels)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Plane index is out of range"_utf16 };
+
+    // 5. If [[format]] does not equal destFormat and the User Agent does not support the requested AudioSampleFormat
+    //    conversion, throw a NotSupportedError DOMException. Conversion to f32-planar MUST always be supported.
+    if (destination_format != AudioSampleFormat::F32Planar && destination_format != AudioSampleFormat::F32)
+        return WebIDL::NotSupportedError::create("Only f32 and f32-planar sample formats are supported"_utf16);
+
+    // 6. Let frameCount be the number of frames in the plane identified by options.planeIndex.
+    auto frame_count = m_number_of_frames;
+
+    // 7. If options.frameOffset is greater than or equal to frameCount, throw a RangeError.
+    if (options.frame_offset >= frame_count)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Frame offset is out of range"_utf16 };
+
+    // 8. Let copyFrameCount be the difference of subtracting options.frameOffset from frameCount.
+    auto copy_frame_count = frame_count - options.frame_offset;
+
+    // 9. If options.frameCount exists:
+    if (options.frame_count.has_value()) {
+        // 1. If options.frameCount is greater than copyFrameCount, throw a RangeError.
+        if (*options.frame_count > copy_frame_count)
+            return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Frame count is out of range"_utf16 };
+
+        // 2. Otherwise, assign options.frameCount to copyFrameCount.
+        copy_frame_count = *options.frame_count;
+    }
+
+    // 10. Let elementCount be copyFrameCount.
+    auto element_count = copy_frame_count;
+
+    // 11. If destFormat describes an interleaved AudioSampleFormat, multiply elementCount by [[number of channels]]
+    if (is_interleaved(destination_format))
+        element_count *= m_number_of_channels;
+
+    // 12. return elementCount.
+    return element_count;
+}
+
+// https://w3c.github.io/webcodecs/#dom-audiodata-allocationsize
+WebIDL::ExceptionOr<WebIDL::UnsignedLong> AudioData::allocation_size(AudioDataCopyToOptions const& options) const
+{
+    // 1. If [[Detached]] is true, throw an InvalidStateError DOMException.
+    if (m_detached)
+        return WebIDL::InvalidStateError::create("AudioData is closed"_utf16);
+
+    // 2. Let copyElementCount be the result of running the Compute Copy Element Count algorithm with options.
+    auto copy_element_count = TRY(compute_copy_element_count(options));
+
+    // 3. Let destFormat be the value of [[format]].
+    // 4. If options.format exists, assign options.format to destFormat.
+    // 5. Let bytesPerSample be the number of bytes per sample, as defined by the destFormat.
+    auto bytes_per_sample = sizeof(float);
+
+    // 6. Return the product of multiplying bytesPerSample by copyElementCount.
+    return copy_element_count * bytes_per_sample;
+}
+
+// https://w3c.github.io/webcodecs/#dom-audiodata-copyto
+WebIDL::ExceptionOr<void> AudioData::copy_to(WebIDL::BufferSourceVariant const& destination, AudioDataCopyToOptions const& options) const
+{
+    // 1. If [[Detached]] is true, throw an InvalidStateError DOMException.
+    if (m_detached)
+        return WebIDL::InvalidStateError::create("AudioData is closed"_utf16);
+
+    // 2. Let copyElementCount be the result of running the Compute Copy Element Count algorithm with options.
+    auto copy_element_count = TRY(compute_copy_element_count(options));
+
+    // 3. Let destFormat be the value of [[format]].
+    // 4. If options.format exists, assign options.format to destFormat.
+    auto destination_format = options.format.value_or(*m_format);
+
+    // 5. Let bytesPerSample be the number of bytes per sample, as defined by the destFormat.
+    auto bytes_per_sample = sizeof(float);
+
+    // 6. If the product of multiplying bytesPerSample by copyElementCount is greater than destination.byteLength,
+    //    throw a RangeError.
+    WebIDL::BufferSource buffer_source { destination };
+    auto buffer = buffer_source.viewed_array_buffer();
+    if (!buffer || buffer->is_detached())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Destination buffer is detached"_utf16 };
+    auto byte_count = copy_element_count * bytes_per_sample;
+    if (byte_count > buffer_source.byte_length())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Destination buffer is too small"_utf16 };
+
+    // 7. Let resource be the media resource referenced by [[resource reference]].
+    auto const& block = m_resource_reference->block();
+
+    // 8. Let planeFrames be the region of resource corresponding to options.planeIndex.
+    // 9. Copy elements of planeFrames into destination, starting with the frame positioned at options.frameOffset and
+    //    stopping after copyElementCount samples have been copied. If destFormat does not equal [[format]], convert
+    //    elements to the destFormat AudioSampleFormat while making the copy.
+    if (is_interleaved(destination_format)) {
+        Vector<float> interleaved_samples;
+        interleaved_samples.resize(copy_element_count);
+        block.copy_to_interleaved(interleaved_samples.span(), options.frame_offset);
+        buffer->overwrite(buffer_source.byte_offset(), interleaved_samples.data(), byte_count);
+    } else {
+        auto plane_samples = block.channel_data(options.plane_index).slice(options.frame_offset, copy_element_count);
+        buffer->overwrite(buffer_source.byte_offset(), plane_samples.data(), byte_count);
+    }
+    return {};
+}
+
+// https://w3c.github.io/webcodecs/#dom-audiodata-clone
+WebIDL::ExceptionOr<GC::Ref<AudioData>> AudioData::clone() const
+{
+    // 1. If [[Detached]] is true, throw an InvalidStateError DOMException.
+    if (m_detached)
+        return WebIDL::InvalidStateError::create("AudioData is closed"_utf16);
+
+    // 2. Return the result of running the Clone AudioData algorithm with this.
+    return GC::Heap::the().allocate<AudioData>(*m_resource_reference);
+}
+
+// https://w3c.github.io/webcodecs/#dom-audiodata-close
+void AudioData::close()
+{
+    // 1. Run the Close AudioData algorithm with this.
+    // https://w3c.github.io/webcodecs/#close-audiodata
+    // 1. Assign true to the data’s [[Detached]] internal slot.
+    m_detached = true;
+
+    // 2. Assign null to data’s [[resource reference]].
+    m_resource_reference = nullptr;
+
+    // 3. Assign 0 to data’s [[sample rate]].
+    m_sample_rate = 0;
+
+    // 4. Assign 0 to data’s [[number of frames]].
+    m_number_of_frames = 0;
+
+    // 5. Assign 0 to data’s [[number of channels]].
+    m_number_of_channels = 0;
+
+    // 6. Assign null to data’s [[format]].
+    m_format = {};
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
+#include <LibMedia/AudioBlock.h>
+#include <LibWeb/Bindings/AudioData.h>
+#include <LibWeb/Bindings/Wrappable.h>
+#include <LibWeb/WebIDL/Buffers.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::WebCodecs {
+
+using AudioDataCopyToOptions = Bindings::AudioDataCopyToOptions;
+using AudioSampleFormat = Bindings::AudioSampleFormat;
+
+// https://w3c.github.io/webcodecs/#audiodata-interface
+class AudioData final : public Bindings::GCAllocatedWrappable {
+    WEB_WRAPPABLE(AudioData, Bindings::GCAllocatedWrappable);
+    GC_DECLARE_ALLOCATOR(AudioData);
+
+public:
+    static GC::Ref<AudioData> create(NonnullOwnPtr<Media::AudioBlock>);
+    virtual ~AudioData() override;
+
+    Optional<AudioSampleFormat> format() const { return m_format; }
+    float sample_rate() const { return m_sample_rate; }
+    WebIDL::UnsignedLong number_of_frames() const { return m_number_of_frames; }
+    WebIDL::UnsignedLong number_of_channels() const { return m_number_of_channels; }
+    WebIDL::UnsignedLongLong duration() const;
+    WebIDL::LongLong timestamp() const { return m_timestamp; }
+
+    WebIDL::ExceptionOr<WebIDL::UnsignedLong> allocation_size(AudioDataCopyToOptions const&) const;
+    WebIDL::ExceptionOr<void> copy_to(WebIDL::BufferSourceVariant const& destination, AudioDataCopyToOptions const&) const;
+    WebIDL::ExceptionOr<GC::Ref<AudioData>> clone() const;
+    void close();
+
+private:
+    // The decoded samples, shared between an AudioData and its clones.
+    class Resource final : public RefCounted<Resource> {
+    public:
+        explicit Resource(NonnullOwnPtr<Media::AudioBlock> block)
+            : m_block(move(block))
+        {
+        }
+
+        Media::AudioBlock const& block() const { return *m_block; }
+
+    private:
+        NonnullOwnPtr<Media::AudioBlock> m_block;
+    };
+
+    explicit AudioData(NonnullRefPtr<Resource>);
+
+    WebIDL::ExceptionOr<WebIDL::UnsignedLong> compute_copy_element_count(AudioDataCopyToOptions const&) const;
+
+    // https://w3c.github.io/webcodecs/#dom-audiodata-resource-reference-slot
+    RefPtr<Resource> m_resource_reference;
+
+    // https://w3c.github.io/webcodecs/#dom-audiodata-detached-slot
+    bool m_detached { false };
+
+    Optional<AudioSampleFormat> m_format;
+    float m_sample_rate { 0 };
+    WebIDL::UnsignedLong m_number_of_frames { 0 };
+    WebIDL::UnsignedLong m_number_of_channels { 0 };
+    WebIDL::LongLong m_timestamp { 0 };
+};
+
+}
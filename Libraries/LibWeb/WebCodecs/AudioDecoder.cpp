@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibCore/EventLoop.h>
+#include <LibGC/Heap.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibMedia/AudioDecodeWorker.h>
+#include <LibMedia/CodecParameters.h>
+#include <LibMedia/DecoderRegistry.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/WebCodecs/AudioData.h>
+#include <LibWeb/WebCodecs/AudioDecoder.h>
+#include <LibWeb/WebCodecs/EncodedAudioChunk.h>
+#include <LibWeb/WebIDL/Buffers.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::WebCodecs {
+
+GC_DEFINE_ALLOCATOR(AudioDecoder);
+
+static bool is_detached(Optional<WebIDL::BufferSourceVariant> const& buffer_source)
+{
+    if (!buffer_source.has_value())
+        return false;
+    auto buffer = WebIDL::BufferSource { *buffer_source }.viewed_array_buffer();
+    return !buffer || buffer->is_detached();
+}
+
+// https://w3c.github.io/webcodecs/#valid-audiodecoderconfig
+bool is_valid_audio_decoder_config(AudioDecoderConfig const& config)
+{
+    // 1. If config.codec is empty after stripping leading and trailing ASCII whitespace, return false.
+    if (config.codec.utf16_view().trim_ascii_whitespace().is_empty())
+        return false;
+
+    // 2. If config.description is [detached], return false.
+    if (is_detached(config.description))
+        return false;
+
+    // 3. Return true.
+    return true;
+}
+
+// https://w3c.github.io/webcodecs/#check-configuration-support
+static Optional<Media::CodecID> supported_codec_id(AudioDecoderConfig const& config)
+{
+    // 1. If config.codec is not a valid codec string, return false.
+    // NB: Codec strings from the WebCodecs registry must be fully specified, with no surrounding whitespace.
+    auto codec = Media::parse_codec_parameters_string(config.codec.to_utf8_but_should_be_ported_to_utf16());
+    if (!codec.has_value() || !codec->is_fully_specified())
+        return {};
+    if (Media::track_type_from_codec_id(codec->codec_id()) != Media::TrackType::Audio)
+        return {};
+
+    // 2. If the User Agent can provide a codec to support all entries of the config, including applicable default
+    //    values for keys that are not included, return true.
+    if (!Media::decoder_capabilities(*codec).has_value())
+        return {};
+    return codec->codec_id();
+}
+
+static Media::Audio::ChannelMap channel_map_for_channel_count(WebIDL::UnsignedLong channel_count)
+{
+    switch (channel_count) {
+    case 1:
+        return Media::Audio::ChannelMap::mono();
+    case 2:
+        return Media::Audio::ChannelMap::stereo();
+    case 4:
+        return Media::Audio::ChannelMap::quadrophonic();
+    case 6:
+        return Media::Audio::ChannelMap::surround_5_1();
+    case 8:
+        return Media::Audio::ChannelMap::surround_7_1();
+    default:
+        break;
+    }
+    // NB: Other layouts are left for the codec implementation to determine from the description.
+    if (channel_count == 0 || channel_count > Media::Audio::ChannelMap::capacity())
+        return Media::Audio::ChannelMap::invalid();
+    Vector<Media::Audio::Channel, Media::Audio::ChannelMap::capacity()> channels;
+    channels.resize(channel_count);
+    channels.fill(Media::Audio::Channel::Unknown);
+    return channels;
+}
+
+static ByteBuffer copy_description(Optional<WebIDL::BufferSourceVariant> const& description)
+{
+    if (!description.has_value())
+        return {};
+    auto bytes = WebIDL::get_buffer_source_copy(WebIDL::BufferSource { *description });
+    if (bytes.is_error())
+        return {};
+    return bytes.release_value();
+}
+
+// https://w3c.github.io/webcodecs/#clone-configuration
+static AudioDecoderConfig clone_configuration(JS::Realm& realm, AudioDecoderConfig const& config)
+{
+    // 1. Let dictType be the type of dictionary config.
+    // 2. Let clone be a new empty instance of dictType
+    // 3. For each dictionary member m defined on dictType:
+    //    1. If m does not exist in config, then continue.
+    //    2. If config[m] is a nested dictionary, set clone[m] to the result of recursively running the Clone
+    //       Configuration algorithm with config[m].
+    //    3. Otherwise, assign a copy of config[m] to clone[m].
+    auto clone = config;
+    if (config.description.has_value())
+        clone.description = JS::ArrayBuffer::create(realm, copy_description(config.description));
+    return clone;
+}
+
+// https://w3c.github.io/webcodecs/#dom-audiodecoder-audiodecoder
+WebIDL::ExceptionOr<GC::Ref<AudioDecoder>> AudioDecoder::create_for_constructor(JS::Object& relevant_global_object, AudioDecoderInit const& init)
+{
+    // 1. Let d be a new AudioDecoder object.
+    // 2. Assign a new queue to [[control message queue]].
+    // 3. Assign false to [[message queue blocked]].
+    // 4. Assign null to [[codec implementation]].
+    // 5. Assign the result of starting a new parallel queue to [[codec work queue]].
+    // 6. Assign false to [[codec saturated]].
+    // 7. Assign init.output to [[output callback]].
+    // 8. Assign init.error to [[error callback]].
+    // 9. Assign null to [[active decoder config]].
+    // 10. Assign true to [[key chunk required]].
+    // 11. Assign "unconfigured" to [[state]]
+    // 12. Assign 0 to [[decodeQueueSize]].
+    // 13. Assign a new list to [[pending flush promises]].
+    // 14. Assign false to [[dequeue event scheduled]].
+    // 15. Return d.
+    auto& global_scope = HTML::relevant_window_or_worker_global_scope(relevant_global_object);
+    return GC::Heap::the().allocate<AudioDecoder>(global_scope.this_impl(), init);
+}
+
+AudioDecoder::AudioDecoder(GC::Ref<DOM::EventTarget> relevant_global_object, AudioDecoderInit const& init)
+    : DecoderBase(relevant_global_object, "AudioDecoder"sv, init.output, init.error)
+{
+}
+
+AudioDecoder::~AudioDecoder() = default;
+
+// https://w3c.github.io/webcodecs/#dom-audiodecoder-isconfigsupported
+WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioDecoder::is_config_supported(JS::VM& vm, AudioDecoderConfig const& config)
+{
+    auto& realm = *vm.current_realm();
+
+    // 1. If config is not a valid AudioDecoderConfig, return a new promise rejected with a TypeError.
+    if (!is_valid_audio_decoder_config(config))
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Invalid AudioDecoderConfig"_utf16 };
+
+    // 2. Let p be a new Promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 3. Let checkSupportQueue be the result of starting a new parallel queue.
+    // 4. Enqueue the following steps to checkSupportQueue:
+    //    1. Let supported be the result of running the Check Configuration Support algorithm with config.
+    // NB: Checking support only consults the decoder registry, so there is no need to leave the event loop for it.
+    auto supported = supported_codec_id(config).has_value();
+
+    //    2. Queue a task to run the following steps:
+    HTML::queue_global_task(HTML::Task::Source::Codec, realm.global_object(), GC::create_function(realm.heap(), [promise, config, supported] {
+        auto& realm = WebIDL::promise_realm(promise);
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+        // 1. Let decoderSupport be a newly constructed AudioDecoderSupport, initialized as follows:
+        //    1. Set config to the result of running the Clone Configuration algorithm with config.
+        //    2. Set supported to supported.
+        AudioDecoderSupport decoder_support;
+        decoder_support.config = clone_configuration(realm, config);
+        decoder_support.supported = supported;
+
+        // 2. Resolve p with decoderSupport.
+        WebIDL::resolve_promise(realm, promise, Bindings::audio_decoder_support_to_value(realm, decoder_support));
+    }));
+
+    // 5. Return p.
+    return promise;
+}
+
+// https://w3c.github.io/webcodecs/#dom-audiodecoder-configure
+WebIDL::ExceptionOr<void> AudioDecoder::configure(AudioDecoderConfig const& config)
+{
+    // 1. If config is not a valid AudioDecoderConfig, throw a TypeError.
+    if (!is_valid_audio_decoder_config(config))
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Invalid AudioDecoderConfig"_utf16 };
+
+    // 2. If [[state]] is “closed”, throw an InvalidStateError DOMException.
+    // 3. Set [[state]] to "configured".
+    // 4. Set [[key chunk required]] to true.
+    // 5. Queue a control message to configure the decoder with config.
+    // NB: The description is copied now, since the buffer it refers to may change before the message runs.
+    OwnPtr<ActiveDecoderConfig> decoder_config;
+    if (auto codec_id = supported_codec_id(config); codec_id.has_value()) {
+        decoder_config = make<ActiveDecoderConfig>();
+        decoder_config->codec_id = *codec_id;
+        decoder_config->description = copy_description(config.description);
+        decoder_config->sample_specification = { config.sample_rate, channel_map_for_channel_count(config.number_of_channels) };
+    }
+    return configure_decoder(move(decoder_config));
+}
+
+Media::DecoderErrorOr<NonnullRefPtr<Media::DecodeWorker>> AudioDecoder::create_codec_implementation(DecoderConfig const& config)
+{
+    auto const& audio_config = static_cast<ActiveDecoderConfig const&>(config);
+    auto worker = TRY(Media::AudioDecodeWorker::try_create(Core::EventLoop::current(), audio_config.codec_id, audio_config.sample_specification, audio_config.description));
+    worker->set_output_handler([this](NonnullOwnPtr<Media::AudioBlock> block) {
+        output_audio_data(move(block));
+    });
+    return NonnullRefPtr<Media::DecodeWorker> { move(worker) };
+}
+
+// https://w3c.github.io/webcodecs/#dom-audiodecoder-decode
+WebIDL::ExceptionOr<void> AudioDecoder::decode(GC::Ref<EncodedAudioChunk> chunk)
+{
+    return decode_chunk(chunk, chunk->type() == EncodedAudioChunkType::Key);
+}
+
+// https://w3c.github.io/webcodecs/#output-audiodata
+void AudioDecoder::output_audio_data(NonnullOwnPtr<Media::AudioBlock> output)
+{
+    queue_output([this, output = move(output)] mutable {
+        // 1. For each output in outputs:
+        //    1. Let data be an AudioData, initialized as follows:
+        //       1. Assign false to [[Detached]].
+        //       2. Let resource be the media resource described by output.
+        //       3. Let resourceReference be a reference to resource.
+        //       4. Assign resourceReference to [[resource reference]].
+        //       5. Let timestamp be the [[timestamp]] of the EncodedAudioChunk associated with output.
+        //       6. Assign timestamp to [[timestamp]].
+        //       7. If output uses a recognized AudioSampleFormat, assign that format to [[format]]. Otherwise, assign
+        //          null to [[format]].
+        //       8. Assign values to [[sample rate]], [[number of frames]], and [[number of channels]] as determined by
+        //          output.
+        auto data = AudioData::create(move(output));
+
+        //    2. Invoke [[output callback]] with data.
+        invoke_output_callback(data);
+    });
+}
+
+}
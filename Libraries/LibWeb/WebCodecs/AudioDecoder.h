@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <LibMedia/Audio/SampleSpecification.h>
+#include <LibWeb/Bindings/AudioDecoder.h>
+#include <LibWeb/WebCodecs/DecoderBase.h>
+
+namespace Web::WebCodecs {
+
+using AudioDecoderConfig = Bindings::AudioDecoderConfig;
+using AudioDecoderInit = Bindings::AudioDecoderInit;
+using AudioDecoderSupport = Bindings::AudioDecoderSupport;
+
+// https://w3c.github.io/webcodecs/#valid-audiodecoderconfig
+bool is_valid_audio_decoder_config(AudioDecoderConfig const&);
+
+// https://w3c.github.io/webcodecs/#audiodecoder-interface
+class AudioDecoder final : public DecoderBase {
+    WEB_WRAPPABLE(AudioDecoder, DecoderBase);
+    GC_DECLARE_ALLOCATOR(AudioDecoder);
+
+public:
+    static WebIDL::ExceptionOr<GC::Ref<AudioDecoder>> create_for_constructor(JS::Object& relevant_global_object, AudioDecoderInit const&);
+    static WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> is_config_supported(JS::VM&, AudioDecoderConfig const&);
+
+    virtual ~AudioDecoder() override;
+
+    WebIDL::ExceptionOr<void> configure(AudioDecoderConfig const&);
+    WebIDL::ExceptionOr<void> decode(GC::Ref<EncodedAudioChunk>);
+
+private:
+    // The parts of [[active decoder config]] that are needed to create the codec implementation.
+    struct ActiveDecoderConfig final : public DecoderConfig {
+        virtual bool can_share_codec_implementation_with(DecoderConfig const& other) const override
+        {
+            return DecoderConfig::can_share_codec_implementation_with(other)
+                && sample_specification == static_cast<ActiveDecoderConfig const&>(other).sample_specification;
+        }
+
+        Media::Audio::SampleSpecification sample_specification;
+    };
+
+    AudioDecoder(GC::Ref<DOM::EventTarget> relevant_global_object, AudioDecoderInit const&);
+
+    virtual Media::DecoderErrorOr<NonnullRefPtr<Media::DecodeWorker>> create_codec_implementation(DecoderConfig const&) override;
+
+    void output_audio_data(NonnullOwnPtr<Media::AudioBlock>);
+};
+
+}
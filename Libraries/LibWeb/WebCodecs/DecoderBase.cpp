@@ -0,0 +1,508 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/FixedArray.h>
+#include <AK/Utf16String.h>
+#include <LibGC/Heap.h>
+#include <LibMedia/CodedFrame.h>
+#include <LibMedia/DecodeWorker.h>
+#include <LibWeb/Bindings/WrapperWorld.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/WebCodecs/DecoderBase.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/DOMException.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::WebCodecs {
+
+DecoderBase::DecoderBase(GC::Ref<DOM::EventTarget> relevant_global_object, StringView interface_name, GC::Ref<WebIDL::CallbackType> output_callback, GC::Ref<WebIDL::CallbackType> error_callback)
+    : m_global_object(relevant_global_object)
+    , m_interface_name(interface_name)
+    , m_output_callback(output_callback)
+    , m_error_callback(error_callback)
+{
+}
+
+DecoderBase::~DecoderBase() = default;
+
+void DecoderBase::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_global_object);
+    visitor.visit(m_output_callback);
+    visitor.visit(m_error_callback);
+    visitor.visit(m_control_message_queue);
+    for (auto const& pending_flush : m_pending_flush_promises)
+        visitor.visit(pending_flush.promise);
+}
+
+void DecoderBase::finalize()
+{
+    Base::finalize();
+    stop_codec_implementation();
+}
+
+JS::Object& DecoderBase::relevant_global_object() const
+{
+    return HTML::relevant_global_object(HTML::relevant_window_or_worker_global_scope(*m_global_object));
+}
+
+void DecoderBase::queue_a_codec_task(Function<void()> steps)
+{
+    HTML::queue_global_task(HTML::Task::Source::Codec, relevant_global_object(), GC::create_function(GC::Heap::the(), move(steps)));
+}
+
+void DecoderBase::set_ondequeue(WebIDL::CallbackType* value)
+{
+    set_event_handler_attribute(HTML::EventNames::dequeue, value);
+}
+
+WebIDL::CallbackType* DecoderBase::ondequeue()
+{
+    return event_handler_attribute(HTML::EventNames::dequeue);
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-configure
+// https://w3c.github.io/webcodecs/#dom-audiodecoder-configure
+WebIDL::ExceptionOr<void> DecoderBase::configure_decoder(OwnPtr<DecoderConfig> decoder_config)
+{
+    // 2. If [[state]] is “closed”, throw an InvalidStateError DOMException.
+    if (m_state == CodecState::Closed)
+        return WebIDL::InvalidStateError::create(Utf16String::formatted("{} is closed", m_interface_name));
+
+    // 3. Set [[state]] to "configured".
+    m_state = CodecState::Configured;
+
+    // 4. Set [[key chunk required]] to true.
+    m_key_chunk_required = true;
+
+    // 5. Queue a control message to configure the decoder with config.
+    queue_a_control_message([this, decoder_config = move(decoder_config)] mutable {
+        // Running a control message to configure the decoder means running these steps:
+        // 1. Assign true to [[message queue blocked]].
+        m_message_queue_blocked = true;
+
+        // 2. Enqueue the following steps to [[codec work queue]]:
+        //    1. Let supported be the result of running the Check Configuration Support algorithm with config.
+        //    2. If supported is false, queue a task to run the Close decoder algorithm with NotSupportedError and
+        //       abort these steps.
+        if (!decoder_config) {
+            queue_a_codec_task([this] {
+                m_message_queue_blocked = false;
+                (void)close_decoder(WebIDL::NotSupportedError::create(Utf16String::formatted("Unsupported {}Config", m_interface_name)));
+            });
+            return;
+        }
+
+        //    3. If needed, assign [[codec implementation]] with an implementation supporting config.
+        //    4. Configure [[codec implementation]] with config.
+        configure_the_codec_implementation(decoder_config.release_nonnull());
+    });
+
+    // NB: The spec processes the control message queue as part of queueing a control message.
+    process_the_control_message_queue();
+    update_activity_root();
+    return {};
+}
+
+void DecoderBase::configure_the_codec_implementation(NonnullOwnPtr<DecoderConfig> config)
+{
+    // NB: A codec implementation can be reused when only the presentation of its output changes.
+    if (m_codec_implementation && m_active_decoder_config && m_active_decoder_config->can_share_codec_implementation_with(*config)) {
+        m_active_decoder_config = move(config);
+        finish_reconfiguration();
+        return;
+    }
+
+    if (m_codec_implementation) {
+        // Outputs of the chunks submitted to the previous implementation must be delivered before those of the
+        // chunks that follow this configuration, so drain it before replacing it.
+        m_pending_decoder_config = move(config);
+        m_reconfiguration_flush_id = m_next_flush_id++;
+        m_codec_implementation->flush(*m_reconfiguration_flush_id);
+        return;
+    }
+
+    auto worker_or_error = create_codec_implementation(*config);
+    if (worker_or_error.is_error()) {
+        queue_a_codec_task([this] {
+            m_message_queue_blocked = false;
+            (void)close_decoder(WebIDL::NotSupportedError::create(Utf16String::formatted("Failed to create a decoder for {}Config", m_interface_name)));
+        });
+        return;
+    }
+
+    m_codec_implementation = worker_or_error.release_value();
+    m_active_decoder_config = move(config);
+    m_codec_implementation->set_chunk_consumed_handler([this] {
+        // NB: [[decodeQueueSize]] is decremented once the codec implementation actually starts decoding a chunk
+        //     rather than when the chunk is handed to it. The implementation stops taking chunks while all of its
+        //     outputs are held, which takes the place of [[codec saturated]].
+        if (m_decode_queue_size == 0)
+            return;
+        m_decode_queue_size--;
+        schedule_dequeue_event();
+        update_activity_root();
+    });
+    m_codec_implementation->set_flush_completed_handler([this](u64 flush_id) {
+        on_flush_completed(flush_id);
+    });
+    m_codec_implementation->set_error_handler([this](Media::DecoderError&& error) {
+        // If decoding results in an error, queue a task to run the Close decoder algorithm with EncodingError.
+        queue_a_codec_task([this, message = Utf16String::formatted("Decoding failed: {}", error.description())] mutable {
+            if (m_state == CodecState::Closed)
+                return;
+            (void)close_decoder(WebIDL::EncodingError::create(move(message)));
+        });
+    });
+
+    finish_reconfiguration();
+}
+
+void DecoderBase::finish_reconfiguration()
+{
+    // 5. queue a task to run the following steps:
+    queue_a_codec_task([this] {
+        // 1. Assign false to [[message queue blocked]].
+        m_message_queue_blocked = false;
+
+        // 2. Queue a task to Process the control message queue.
+        // NB: This is already running in a task on the same task source, so process the queue directly.
+        process_the_control_message_queue();
+        update_activity_root();
+    });
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-decode
+// https://w3c.github.io/webcodecs/#dom-audiodecoder-decode
+WebIDL::ExceptionOr<void> DecoderBase::check_chunk_can_be_decoded(bool is_key_chunk)
+{
+    // 1. If [[state]] is not "configured", throw an InvalidStateError DOMException.
+    if (m_state != CodecState::Configured)
+        return WebIDL::InvalidStateError::create(Utf16String::formatted("{} is not configured", m_interface_name));
+
+    // 2. If [[key chunk required]] is true:
+    if (m_key_chunk_required) {
+        // 1. If chunk.type is not key, throw a DataError.
+        if (!is_key_chunk)
+            return WebIDL::DataError::create("A key chunk is required"_utf16);
+
+        // FIXME: 2. Implementers SHOULD inspect the chunk’s [[internal data]] to verify that it is truly a key chunk.
+        //           If a mismatch is detected, throw a DataError.
+
+        // 3. Otherwise, assign false to [[key chunk required]].
+        m_key_chunk_required = false;
+    }
+    return {};
+}
+
+void DecoderBase::queue_decode_control_message(Function<DecodeRequest()> request)
+{
+    // 3. Increment [[decodeQueueSize]].
+    m_decode_queue_size++;
+
+    // 4. Queue a control message to decode the chunk.
+    queue_a_control_message([this, request = move(request)] {
+        decode_the_chunk(request());
+    });
+
+    process_the_control_message_queue();
+    update_activity_root();
+}
+
+void DecoderBase::decode_the_chunk(DecodeRequest const& chunk)
+{
+    // Running a control message to decode the chunk means performing these steps:
+    // 1. If [[codec saturated]] equals true, return "not processed".
+    // 2. If decoding chunk will cause the [[codec implementation]] to become saturated, assign true to
+    //    [[codec saturated]].
+    // 3. Decrement [[decodeQueueSize]] and run the Schedule Dequeue Event algorithm.
+    // NB: The codec implementation applies backpressure on its own thread, and reports when it takes each chunk.
+    //     See the chunk consumed handler in configure_the_codec_implementation().
+    VERIFY(m_codec_implementation);
+
+    // 4. Enqueue the following steps to the [[codec work queue]]:
+    //    1. Attempt to use [[codec implementation]] to decode the chunk.
+    auto data = FixedArray<u8>::create(chunk.data);
+    if (data.is_error()) {
+        //    2. If decoding results in an error, queue a task to run the Close decoder algorithm with EncodingError
+        //       and return.
+        queue_a_codec_task([this] {
+            if (m_state == CodecState::Closed)
+                return;
+            (void)close_decoder(WebIDL::EncodingError::create("Failed to allocate the chunk's data"_utf16));
+        });
+        return;
+    }
+
+    auto timestamp = AK::Duration::from_microseconds(chunk.timestamp);
+    auto duration = AK::Duration::from_microseconds(static_cast<i64>(chunk.duration.value_or(0)));
+    auto flags = chunk.is_key_chunk ? Media::FrameFlags::Keyframe : Media::FrameFlags::None;
+    m_codec_implementation->decode(Media::CodedFrame(m_active_decoder_config->codec_id, timestamp, timestamp, duration, flags, data.release_value()));
+
+    //    3. If [[codec saturated]] equals true and [[codec implementation]] is no longer saturated, queue a task to
+    //       perform the following steps:
+    //       1. Assign false to [[codec saturated]].
+    //       2. Process the control message queue.
+    //    4. Let decoded outputs be a list of decoded outputs emitted by [[codec implementation]] in presentation
+    //       order.
+    //    5. If decoded outputs is not empty, queue a task to run the Output algorithm with decoded outputs.
+    // NB: Outputs are delivered through the output handler as the codec implementation produces them.
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-flush
+// https://w3c.github.io/webcodecs/#dom-audiodecoder-flush
+void DecoderBase::flush(GC::Ref<WebIDL::Promise> promise)
+{
+    // 1. If [[state]] is not "configured", return a promise rejected with InvalidStateError DOMException.
+    if (m_state != CodecState::Configured) {
+        WebIDL::reject_promise(promise, WebIDL::InvalidStateError::create(Utf16String::formatted("{} is not configured", m_interface_name)));
+        return;
+    }
+
+    // 2. Set [[key chunk required]] to true.
+    m_key_chunk_required = true;
+
+    // 3. Let promise be a new Promise.
+    // 4. Append promise to [[pending flush promises]].
+    auto flush_id = m_next_flush_id++;
+    m_pending_flush_promises.append({ flush_id, promise });
+
+    // 5. Queue a control message to flush the codec with promise.
+    queue_a_control_message([this, flush_id] {
+        flush_the_codec_implementation(flush_id);
+    });
+
+    // 6. Process the control message queue.
+    process_the_control_message_queue();
+    update_activity_root();
+
+    // 7. Return promise.
+}
+
+void DecoderBase::flush_the_codec_implementation(u64 flush_id)
+{
+    // Running a control message to flush the codec means performing these steps with promise:
+    // 1. Enqueue the following steps to the [[codec work queue]]:
+    //    1. Signal [[codec implementation]] to emit all internal pending outputs.
+    //    2. Let decoded outputs be a list of decoded outputs emitted by [[codec implementation]].
+    VERIFY(m_codec_implementation);
+    m_codec_implementation->flush(flush_id);
+}
+
+void DecoderBase::on_flush_completed(u64 flush_id)
+{
+    if (flush_id == m_reconfiguration_flush_id) {
+        // The previous codec implementation has output everything it was given, so it can now be replaced.
+        m_reconfiguration_flush_id.clear();
+        stop_codec_implementation();
+        configure_the_codec_implementation(m_pending_decoder_config.release_nonnull());
+        return;
+    }
+
+    //    3. Queue a task to run these steps:
+    queue_a_codec_task([this, flush_id, generation = m_output_generation] {
+        if (generation != m_output_generation)
+            return;
+
+        //       1. If decoded outputs is not empty, run the Output algorithm with decoded outputs.
+        // NB: Outputs were queued ahead of this task as they were produced.
+
+        //       2. Remove promise from [[pending flush promises]].
+        auto index = m_pending_flush_promises.find_first_index_if([&](auto const& pending_flush) { return pending_flush.id == flush_id; });
+        if (!index.has_value())
+            return;
+        auto promise = m_pending_flush_promises.take(*index).promise;
+        update_activity_root();
+
+        //       3. Resolve promise.
+        auto& realm = HTML::relevant_realm(relevant_global_object());
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        WebIDL::resolve_promise(realm, promise);
+    });
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-reset
+// https://w3c.github.io/webcodecs/#dom-audiodecoder-reset
+WebIDL::ExceptionOr<void> DecoderBase::reset()
+{
+    // 1. Run the Reset decoder algorithm with an AbortError DOMException.
+    return reset_decoder(WebIDL::AbortError::create(Utf16String::formatted("{} was reset", m_interface_name)));
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-close
+// https://w3c.github.io/webcodecs/#dom-audiodecoder-close
+WebIDL::ExceptionOr<void> DecoderBase::close()
+{
+    // 1. Run the Close decoder algorithm with an AbortError DOMException.
+    return close_decoder(WebIDL::AbortError::create(Utf16String::formatted("{} was closed", m_interface_name)));
+}
+
+// https://w3c.github.io/webcodecs/#enqueues-a-control-message
+void DecoderBase::queue_a_control_message(Function<void()> message)
+{
+    // To enqueue a control message:
+    // 1. Enqueue message to [[control message queue]].
+    m_control_message_queue.append(GC::create_function(GC::Heap::the(), move(message)));
+}
+
+// https://w3c.github.io/webcodecs/#process-the-control-message-queue
+void DecoderBase::process_the_control_message_queue()
+{
+    // 1. While [[message queue blocked]] is false and [[control message queue]] is not empty:
+    while (!m_message_queue_blocked && !m_control_message_queue.is_empty()) {
+        // 1. Let front message be the first message in [[control message queue]].
+        // 2. Let outcome be the result of running the control message steps described by front message.
+        // 3. If outcome equals "not processed", break.
+        // 4. Otherwise, dequeue front message from the [[control message queue]].
+        // NB: Control messages are never left unprocessed, so the message is dequeued before it runs.
+        auto front_message = m_control_message_queue.take_first();
+        front_message->function()();
+    }
+}
+
+// https://w3c.github.io/webcodecs/#videodecoder-schedule-dequeue-event
+// https://w3c.github.io/webcodecs/#audiodecoder-schedule-dequeue-event
+void DecoderBase::schedule_dequeue_event()
+{
+    // 1. If [[dequeue event scheduled]] equals true, return.
+    if (m_dequeue_event_scheduled)
+        return;
+
+    // 2. Assign true to [[dequeue event scheduled]].
+    m_dequeue_event_scheduled = true;
+
+    // 3. Queue a task to run the following steps:
+    queue_a_codec_task([this] {
+        // 1. Fire a simple event named dequeue at this.
+        dispatch_event(DOM::Event::create(HTML::EventNames::dequeue, HighResolutionTime::current_high_resolution_time(relevant_global_object())));
+
+        // 2. Assign false to [[dequeue event scheduled]].
+        m_dequeue_event_scheduled = false;
+    });
+}
+
+void DecoderBase::queue_output(Function<void()> steps)
+{
+    m_outputs_in_flight++;
+    queue_a_codec_task([this, steps = move(steps), generation = m_output_generation] {
+        m_outputs_in_flight--;
+        update_activity_root();
+        if (generation != m_output_generation)
+            return;
+        steps();
+    });
+}
+
+void DecoderBase::invoke_output_callback(GC::Ref<Bindings::Wrappable> output)
+{
+    auto& callback_realm = m_output_callback->callback->shape().realm();
+    (void)WebIDL::invoke_callback(m_output_callback, {}, WebIDL::ExceptionBehavior::Report,
+        { { Bindings::wrap(Bindings::host_defined_wrapper_world(callback_realm), callback_realm, output) } });
+}
+
+// https://w3c.github.io/webcodecs/#reset-videodecoder
+// https://w3c.github.io/webcodecs/#reset-audiodecoder
+WebIDL::ExceptionOr<void> DecoderBase::reset_decoder(GC::Ref<WebIDL::DOMException> exception)
+{
+    // 1. If [[state]] is "closed", throw an InvalidStateError.
+    if (m_state == CodecState::Closed)
+        return WebIDL::InvalidStateError::create(Utf16String::formatted("{} is closed", m_interface_name));
+
+    // 2. Set [[state]] to "unconfigured".
+    m_state = CodecState::Unconfigured;
+
+    // 3. Signal [[codec implementation]] to cease producing output for the previous configuration.
+    m_output_generation++;
+    if (m_reconfiguration_flush_id.has_value()) {
+        // A half-finished reconfiguration is abandoned along with the implementation it was draining.
+        m_reconfiguration_flush_id.clear();
+        m_pending_decoder_config.clear();
+        stop_codec_implementation();
+    } else if (m_codec_implementation) {
+        m_codec_implementation->reset();
+    }
+    m_message_queue_blocked = false;
+
+    // 4. Remove all control messages from the [[control message queue]].
+    m_control_message_queue.clear();
+
+    // 5. If [[decodeQueueSize]] is greater than zero:
+    if (m_decode_queue_size > 0) {
+        // 1. Set [[decodeQueueSize]] to zero.
+        m_decode_queue_size = 0;
+
+        // 2. Run the Schedule Dequeue Event algorithm.
+        schedule_dequeue_event();
+    }
+
+    // 6. For each promise in [[pending flush promises]]:
+    //    1. Reject promise with exception.
+    //    2. Remove promise from [[pending flush promises]].
+    auto pending_flush_promises = move(m_pending_flush_promises);
+    for (auto const& pending_flush : pending_flush_promises)
+        WebIDL::reject_promise(pending_flush.promise, exception);
+
+    update_activity_root();
+    return {};
+}
+
+// https://w3c.github.io/webcodecs/#close-videodecoder
+// https://w3c.github.io/webcodecs/#close-audiodecoder
+WebIDL::ExceptionOr<void> DecoderBase::close_decoder(GC::Ref<WebIDL::DOMException> exception)
+{
+    // 1. Run the Reset decoder algorithm with exception.
+    TRY(reset_decoder(exception));
+
+    // 2. Set [[state]] to "closed".
+    m_state = CodecState::Closed;
+
+    // 3. Clear [[codec implementation]] and release associated system resources.
+    stop_codec_implementation();
+    m_active_decoder_config.clear();
+
+    // 4. If exception is not an AbortError DOMException, invoke the [[error callback]] with exception.
+    if (exception->name() != "AbortError"_utf16_fly_string) {
+        auto& callback_realm = m_error_callback->callback->shape().realm();
+        (void)WebIDL::invoke_callback(m_error_callback, {}, WebIDL::ExceptionBehavior::Report,
+            { { Bindings::wrap(Bindings::host_defined_wrapper_world(callback_realm), callback_realm, exception) } });
+    }
+    return {};
+}
+
+void DecoderBase::stop_codec_implementation()
+{
+    if (!m_codec_implementation)
+        return;
+    m_codec_implementation->stop();
+    m_codec_implementation = nullptr;
+}
+
+bool DecoderBase::has_pending_activity() const
+{
+    // NB: A decoder must stay alive while it still has work that can result in callbacks or events.
+    return m_decode_queue_size > 0
+        || !m_pending_flush_promises.is_empty()
+        || !m_control_message_queue.is_empty()
+        || m_message_queue_blocked
+        || m_outputs_in_flight > 0;
+}
+
+void DecoderBase::update_activity_root()
+{
+    if (has_pending_activity())
+        m_activity_root.take(*this);
+    else
+        m_activity_root.release();
+}
+
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/OwnPtr.h>
+#include <AK/RefPtr.h>
+#include <AK/Vector.h>
+#include <LibGC/ActivityRoot.h>
+#include <LibGC/Function.h>
+#include <LibMedia/CodecID.h>
+#include <LibMedia/DecoderError.h>
+#include <LibMedia/Forward.h>
+#include <LibWeb/Bindings/VideoDecoder.h>
+#include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::WebCodecs {
+
+using CodecState = Bindings::CodecState;
+
+// The state and algorithms that VideoDecoder and AudioDecoder share. The spec defines them separately for each
+// interface, but apart from the type of their configuration, chunks and outputs they are identical.
+class DecoderBase : public DOM::EventTarget {
+    WEB_NON_IDL_WRAPPABLE(DecoderBase, DOM::EventTarget);
+
+public:
+    static constexpr bool OVERRIDES_FINALIZE = true;
+
+    virtual ~DecoderBase() override;
+
+    CodecState state() const { return m_state; }
+    WebIDL::UnsignedLong decode_queue_size() const { return m_decode_queue_size; }
+
+    void set_ondequeue(WebIDL::CallbackType*);
+    WebIDL::CallbackType* ondequeue();
+
+    void flush(GC::Ref<WebIDL::Promise>);
+    WebIDL::ExceptionOr<void> reset();
+    WebIDL::ExceptionOr<void> close();
+
+protected:
+    // The parts of [[active decoder config]] that are needed once the codec implementation has been created.
+    struct DecoderConfig {
+        virtual ~DecoderConfig() = default;
+
+        // Whether a codec implementation created for this configuration can go on to decode chunks for the other one.
+        virtual bool can_share_codec_implementation_with(DecoderConfig const& other) const
+        {
+            return codec_id == other.codec_id && description == other.description;
+        }
+
+        Media::CodecID codec_id;
+        ByteBuffer description;
+    };
+
+    DecoderBase(GC::Ref<DOM::EventTarget> relevant_global_object, StringView interface_name, GC::Ref<WebIDL::CallbackType> output_callback, GC::Ref<WebIDL::CallbackType> error_callback);
+
+    virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
+
+    // Creates a codec implementation for the given configuration, with its output handler hooked up to queue_output().
+    virtual Media::DecoderErrorOr<NonnullRefPtr<Media::DecodeWorker>> create_codec_implementation(DecoderConfig const&) = 0;
+
+    // Runs the configure() steps that follow validating the configuration. A missing configuration is not supported.
+    WebIDL::ExceptionOr<void> configure_decoder(OwnPtr<DecoderConfig>);
+
+    // Runs the decode() steps for a chunk. Its internal data is read once the control message to decode it runs.
+    template<typename EncodedChunk>
+    WebIDL::ExceptionOr<void> decode_chunk(GC::Ref<EncodedChunk> chunk, bool is_key_chunk)
+    {
+        TRY(check_chunk_can_be_decoded(is_key_chunk));
+        queue_decode_control_message([chunk, is_key_chunk] {
+            return DecodeRequest { chunk->internal_data(), chunk->timestamp(), chunk->duration(), is_key_chunk };
+        });
+        return {};
+    }
+
+    // Delivers an output on the codec task source, unless the decoder has been reset since it was produced.
+    void queue_output(Function<void()>);
+
+    void invoke_output_callback(GC::Ref<Bindings::Wrappable> output);
+
+    DecoderConfig const& active_decoder_config() const { return *m_active_decoder_config; }
+
+    JS::Object& relevant_global_object() const;
+
+private:
+    struct DecodeRequest {
+        ReadonlyBytes data;
+        WebIDL::LongLong timestamp { 0 };
+        Optional<WebIDL::UnsignedLongLong> duration;
+        bool is_key_chunk { false };
+    };
+
+    struct PendingFlush {
+        u64 id { 0 };
+        GC::Ref<WebIDL::Promise> promise;
+    };
+
+    void queue_a_codec_task(Function<void()>);
+
+    void queue_a_control_message(Function<void()>);
+    void process_the_control_message_queue();
+
+    WebIDL::ExceptionOr<void> check_chunk_can_be_decoded(bool is_key_chunk);
+    void queue_decode_control_message(Function<DecodeRequest()>);
+
+    void configure_the_codec_implementation(NonnullOwnPtr<DecoderConfig>);
+    void finish_reconfiguration();
+    void decode_the_chunk(DecodeRequest const&);
+    void flush_the_codec_implementation(u64 flush_id);
+
+    void schedule_dequeue_event();
+    void on_flush_completed(u64 flush_id);
+
+    WebIDL::ExceptionOr<void> reset_decoder(GC::Ref<WebIDL::DOMException>);
+    WebIDL::ExceptionOr<void> close_decoder(GC::Ref<WebIDL::DOMException>);
+
+    void stop_codec_implementation();
+    bool has_pending_activity() const;
+    void update_activity_root();
+
+    GC::Ref<DOM::EventTarget> m_global_object;
+    StringView m_interface_name;
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-output-callback-slot
+    // https://w3c.github.io/webcodecs/#dom-audiodecoder-output-callback-slot
+    GC::Ref<WebIDL::CallbackType> m_output_callback;
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-error-callback-slot
+    // https://w3c.github.io/webcodecs/#dom-audiodecoder-error-callback-slot
+    GC::Ref<WebIDL::CallbackType> m_error_callback;
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-state-slot
+    // https://w3c.github.io/webcodecs/#dom-audiodecoder-state-slot
+    CodecState m_state { CodecState::Unconfigured };
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-decodequeuesize-slot
+    // https://w3c.github.io/webcodecs/#dom-audiodecoder-decodequeuesize-slot
+    WebIDL::UnsignedLong m_decode_queue_size { 0 };
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-key-chunk-required-slot
+    // https://w3c.github.io/webcodecs/#dom-audiodecoder-key-chunk-required-slot
+    bool m_key_chunk_required { true };
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-dequeue-event-scheduled-slot
+    // https://w3c.github.io/webcodecs/#dom-audiodecoder-dequeue-event-scheduled-slot
+    bool m_dequeue_event_scheduled { false };
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-control-message-queue-slot
+    // https://w3c.github.io/webcodecs/#dom-audiodecoder-control-message-queue-slot
+    Vector<GC::Ref<GC::Function<void()>>> m_control_message_queue;
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-message-queue-blocked-slot
+    // https://w3c.github.io/webcodecs/#dom-audiodecoder-message-queue-blocked-slot
+    bool m_message_queue_blocked { false };
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-pending-flush-promises-slot
+    // https://w3c.github.io/webcodecs/#dom-audiodecoder-pending-flush-promises-slot
+    Vector<PendingFlush> m_pending_flush_promises;
+    u64 m_next_flush_id { 0 };
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-codec-implementation-slot
+    // https://w3c.github.io/webcodecs/#dom-audiodecoder-codec-implementation-slot
+    // NB: The codec implementation decodes on its own thread, which takes the place of the [[codec work queue]].
+    RefPtr<Media::DecodeWorker> m_codec_implementation;
+    OwnPtr<DecoderConfig> m_active_decoder_config;
+
+    // When a configuration needs a new codec implementation, the previous one is flushed first so that every chunk
+    // submitted before the configuration is output in order. The control message queue stays blocked until then.
+    Optional<u64> m_reconfiguration_flush_id;
+    OwnPtr<DecoderConfig> m_pending_decoder_config;
+
+    // Incremented whenever outputs of earlier work must no longer be delivered.
+    u64 m_output_generation { 0 };
+    u32 m_outputs_in_flight { 0 };
+
+    GC::ActivityRoot m_activity_root;
+};
+
+}
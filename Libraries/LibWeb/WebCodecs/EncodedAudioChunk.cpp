@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGC/Heap.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibWeb/WebCodecs/EncodedAudioChunk.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::WebCodecs {
+
+GC_DEFINE_ALLOCATOR(EncodedAudioChunk);
+
+// https://w3c.github.io/webcodecs/#dom-encodedaudiochunk-encodedaudiochunk
+WebIDL::ExceptionOr<GC::Ref<EncodedAudioChunk>> EncodedAudioChunk::create_for_constructor(EncodedAudioChunkInit const& init)
+{
+    // FIXME: 1. If init.transfer contains more than one reference to the same ArrayBuffer, then throw a DataCloneError DOMException.
+    // FIXME: 2. For each transferable in init.transfer:
+    //           1. If [[Detached]] internal slot is true, then throw a DataCloneError DOMException.
+
+    // 3. Let chunk be a new EncodedAudioChunk object, initialized as follows
+    //    1. Assign init.type to [[type]].
+    //    2. Assign init.timestamp to [[timestamp]].
+    //    3. If init.duration exists, assign it to [[duration]], or assign null otherwise.
+    //    4. Assign init.data.byteLength to [[byte length]];
+    //    5. If init.transfer contains an ArrayBuffer referenced by init.data the User Agent MAY choose to:
+    //       1. Let resource be a new media resource referencing sample data in init.data.
+    //    6. Otherwise:
+    //       1. Assign a copy of init.data to [[internal data]].
+    auto internal_data = WebIDL::get_buffer_source_copy(WebIDL::BufferSource { init.data });
+    if (internal_data.is_error())
+        return WebIDL::OperationError::create("Failed to copy bytes from ArrayBuffer"_utf16);
+
+    // FIXME: 4. For each transferable in init.transfer:
+    //           1. Perform DetachArrayBuffer on transferable
+
+    // 5. Return chunk.
+    return GC::Heap::the().allocate<EncodedAudioChunk>(init.type, init.timestamp, init.duration, internal_data.release_value());
+}
+
+EncodedAudioChunk::EncodedAudioChunk(EncodedAudioChunkType type, WebIDL::LongLong timestamp, Optional<WebIDL::UnsignedLongLong> duration, ByteBuffer internal_data)
+    : m_type(type)
+    , m_timestamp(timestamp)
+    , m_duration(duration)
+    , m_internal_data(move(internal_data))
+{
+}
+
+EncodedAudioChunk::~EncodedAudioChunk() = default;
+
+// https://w3c.github.io/webcodecs/#dom-encodedaudiochunk-copyto
+WebIDL::ExceptionOr<void> EncodedAudioChunk::copy_to(WebIDL::BufferSourceVariant const& destination) const
+{
+    WebIDL::BufferSource buffer_source { destination };
+    auto buffer = buffer_source.viewed_array_buffer();
+    if (!buffer || buffer->is_detached())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Destination buffer is detached"_utf16 };
+
+    // 1. If the [[byte length]] of this EncodedAudioChunk is greater than in destination, throw a TypeError.
+    if (m_internal_data.size() > buffer_source.byte_length())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Destination buffer is too small"_utf16 };
+
+    // 2. Copy the [[internal data]] into destination.
+    buffer->overwrite(buffer_source.byte_offset(), m_internal_data.data(), m_internal_data.size());
+    return {};
+}
+
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <LibWeb/Bindings/EncodedAudioChunk.h>
+#include <LibWeb/Bindings/Wrappable.h>
+#include <LibWeb/WebIDL/Buffers.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::WebCodecs {
+
+using EncodedAudioChunkInit = Bindings::EncodedAudioChunkInit;
+using EncodedAudioChunkType = Bindings::EncodedAudioChunkType;
+
+// https://w3c.github.io/webcodecs/#encodedaudiochunk-interface
+class EncodedAudioChunk final : public Bindings::GCAllocatedWrappable {
+    WEB_WRAPPABLE(EncodedAudioChunk, Bindings::GCAllocatedWrappable);
+    GC_DECLARE_ALLOCATOR(EncodedAudioChunk);
+
+public:
+    static WebIDL::ExceptionOr<GC::Ref<EncodedAudioChunk>> create_for_constructor(EncodedAudioChunkInit const&);
+    virtual ~EncodedAudioChunk() override;
+
+    EncodedAudioChunkType type() const { return m_type; }
+    WebIDL::LongLong timestamp() const { return m_timestamp; }
+    Optional<WebIDL::UnsignedLongLong> duration() const { return m_duration; }
+    WebIDL::UnsignedLong byte_length() const { return m_internal_data.size(); }
+
+    WebIDL::ExceptionOr<void> copy_to(WebIDL::BufferSourceVariant const& destination) const;
+
+    ReadonlyBytes internal_data() const { return m_internal_data.bytes(); }
+
+private:
+    EncodedAudioChunk(EncodedAudioChunkType, WebIDL::LongLong timestamp, Optional<WebIDL::UnsignedLongLong> duration, ByteBuffer internal_data);
+
+    // https://w3c.github.io/webcodecs/#dom-encodedaudiochunk-type-slot
+    EncodedAudioChunkType m_type;
+
+    // https://w3c.github.io/webcodecs/#dom-encodedaudiochunk-timestamp-slot
+    WebIDL::LongLong m_timestamp { 0 };
+
+    // https://w3c.github.io/webcodecs/#dom-encodedaudiochunk-duration-slot
+    Optional<WebIDL::UnsignedLongLong> m_duration;
+
+    // https://w3c.github.io/webcodecs/#dom-encodedaudiochunk-internal-data-slot
+    ByteBuffer m_internal_data;
+};
+
+}
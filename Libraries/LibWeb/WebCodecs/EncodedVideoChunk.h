@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <LibWeb/Bindings/EncodedVideoChunk.h>
+#include <LibWeb/Bindings/Wrappable.h>
+#include <LibWeb/WebIDL/Buffers.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::WebCodecs {
+
+using EncodedVideoChunkInit = Bindings::EncodedVideoChunkInit;
+using EncodedVideoChunkType = Bindings::EncodedVideoChunkType;
+
+// https://w3c.github.io/webcodecs/#encodedvideochunk-interface
+class EncodedVideoChunk final : public Bindings::GCAllocatedWrappable {
+    WEB_WRAPPABLE(EncodedVideoChunk, Bindings::GCAllocatedWrappable);
+    GC_DECLARE_ALLOCATOR(EncodedVideoChunk);
+
+public:
+    static WebIDL::ExceptionOr<GC::Ref<EncodedVideoChunk>> create_for_constructor(EncodedVideoChunkInit const&);
+    virtual ~EncodedVideoChunk() override;
+
+    EncodedVideoChunkType type() const { return m_type; }
+    WebIDL::LongLong timestamp() const { return m_timestamp; }
+    Optional<WebIDL::UnsignedLongLong> duration() const { return m_duration; }
+    WebIDL::UnsignedLong byte_length() const { return m_internal_data.size(); }
+
+    WebIDL::ExceptionOr<void> copy_to(WebIDL::BufferSourceVariant const& destination) const;
+
+    ReadonlyBytes internal_data() const { return m_internal_data.bytes(); }
+
+private:
+    EncodedVideoChunk(EncodedVideoChunkType, WebIDL::LongLong timestamp, Optional<WebIDL::UnsignedLongLong> duration, ByteBuffer internal_data);
+
+    // https://w3c.github.io/webcodecs/#dom-encodedvideochunk-type-slot
+    EncodedVideoChunkType m_type;
+
+    // https://w3c.github.io/webcodecs/#dom-encodedvideochunk-timestamp-slot
+    WebIDL::LongLong m_timestamp { 0 };
+
+    // https://w3c.github.io/webcodecs/#dom-encodedvideochunk-duration-slot
+    Optional<WebIDL::UnsignedLongLong> m_duration;
+
+    // https://w3c.github.io/webcodecs/#dom-encodedvideochunk-internal-data-slot
+    ByteBuffer m_internal_data;
+};
+
+}
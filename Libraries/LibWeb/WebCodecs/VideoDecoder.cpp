@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/EventLoop.h>
+#include <LibGC/Heap.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibMedia/CodecParameters.h>
+#include <LibMedia/DecoderRegistry.h>
+#include <LibMedia/VideoDecodeWorker.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/WebCodecs/EncodedVideoChunk.h>
+#include <LibWeb/WebCodecs/VideoDecoder.h>
+#include <LibWeb/WebCodecs/VideoFrame.h>
+#include <LibWeb/WebIDL/Buffers.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::WebCodecs {
+
+GC_DEFINE_ALLOCATOR(VideoDecoder);
+
+static bool is_detached(Optional<WebIDL::BufferSourceVariant> const& buffer_source)
+{
+    if (!buffer_source.has_value())
+        return false;
+    auto buffer = WebIDL::BufferSource { *buffer_source }.viewed_array_buffer();
+    return !buffer || buffer->is_detached();
+}
+
+// https://w3c.github.io/webcodecs/#valid-videodecoderconfig
+bool is_valid_video_decoder_config(VideoDecoderConfig const& config)
+{
+    // 1. If config.codec is empty after stripping leading and trailing ASCII whitespace, return false.
+    if (config.codec.utf16_view().trim_ascii_whitespace().is_empty())
+        return false;
+
+    // 2. If one of config.codedWidth or config.codedHeight is provided and the other isn’t, return false.
+    if (config.coded_width.has_value() != config.coded_height.has_value())
+        return false;
+
+    // 3. If config.codedWidth = 0 or config.codedHeight = 0, return false.
+    if (config.coded_width == 0u || config.coded_height == 0u)
+        return false;
+
+    // 4. If one of config.displayAspectWidth or config.displayAspectHeight is provided and the other isn’t, return
+    //    false.
+    if (config.display_aspect_width.has_value() != config.display_aspect_height.has_value())
+        return false;
+
+    // 5. If config.displayAspectWidth = 0 or config.displayAspectHeight = 0, return false.
+    if (config.display_aspect_width == 0u || config.display_aspect_height == 0u)
+        return false;
+
+    // 6. If config.description is [detached], return false.
+    if (is_detached(config.description))
+        return false;
+
+    // 7. Return true.
+    return true;
+}
+
+// https://w3c.github.io/webcodecs/#check-configuration-support
+static Optional<Media::CodecID> supported_codec_id(VideoDecoderConfig const& config)
+{
+    // 1. If config.codec is not a valid codec string, return false.
+    // NB: Codec strings from the WebCodecs registry must be fully specified, with no surrounding whitespace.
+    auto codec = Media::parse_codec_parameters_string(config.codec.to_utf8_but_should_be_ported_to_utf16());
+    if (!codec.has_value() || !codec->is_fully_specified())
+        return {};
+    if (Media::track_type_from_codec_id(codec->codec_id()) != Media::TrackType::Video)
+        return {};
+
+    // 2. If the User Agent can provide a codec to support all entries of the config, including applicable default
+    //    values for keys that are not included, return true.
+    if (!Media::decoder_capabilities(*codec).has_value())
+        return {};
+    return codec->codec_id();
+}
+
+static ByteBuffer copy_description(Optional<WebIDL::BufferSourceVariant> const& description)
+{
+    if (!description.has_value())
+        return {};
+    auto bytes = WebIDL::get_buffer_source_copy(WebIDL::BufferSource { *description });
+    if (bytes.is_error())
+        return {};
+    return bytes.release_value();
+}
+
+// https://w3c.github.io/webcodecs/#clone-configuration
+static VideoDecoderConfig clone_configuration(JS::Realm& realm, VideoDecoderConfig const& config)
+{
+    // 1. Let dictType be the type of dictionary config.
+    // 2. Let clone be a new empty instance of dictType
+    // 3. For each dictionary member m defined on dictType:
+    //    1. If m does not exist in config, then continue.
+    //    2. If config[m] is a nested dictionary, set clone[m] to the result of recursively running the Clone
+    //       Configuration algorithm with config[m].
+    //    3. Otherwise, assign a copy of config[m] to clone[m].
+    auto clone = config;
+    if (config.description.has_value())
+        clone.description = JS::ArrayBuffer::create(realm, copy_description(config.description));
+    return clone;
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-videodecoder
+WebIDL::ExceptionOr<GC::Ref<VideoDecoder>> VideoDecoder::create_for_constructor(JS::Object& relevant_global_object, VideoDecoderInit const& init)
+{
+    // 1. Let d be a new VideoDecoder object.
+    // 2. Assign a new queue to [[control message queue]].
+    // 3. Assign false to [[message queue blocked]].
+    // 4. Assign null to [[codec implementation]].
+    // 5. Assign the result of starting a new parallel queue to [[codec work queue]].
+    // 6. Assign false to [[codec saturated]].
+    // 7. Assign init.output to [[output callback]].
+    // 8. Assign init.error to [[error callback]].
+    // 9. Assign null to [[active decoder config]].
+    // 10. Assign true to [[key chunk required]].
+    // 11. Assign "unconfigured" to [[state]]
+    // 12. Assign 0 to [[decodeQueueSize]].
+    // 13. Assign a new list to [[pending flush promises]].
+    // 14. Assign false to [[dequeue event scheduled]].
+    // 15. Return d.
+    auto& global_scope = HTML::relevant_window_or_worker_global_scope(relevant_global_object);
+    return GC::Heap::the().allocate<VideoDecoder>(global_scope.this_impl(), init);
+}
+
+VideoDecoder::VideoDecoder(GC::Ref<DOM::EventTarget> relevant_global_object, VideoDecoderInit const& init)
+    : DecoderBase(relevant_global_object, "VideoDecoder"sv, init.output, init.error)
+{
+}
+
+VideoDecoder::~VideoDecoder() = default;
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-isconfigsupported
+WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> VideoDecoder::is_config_supported(JS::VM& vm, VideoDecoderConfig const& config)
+{
+    auto& realm = *vm.current_realm();
+
+    // 1. If config is not a valid VideoDecoderConfig, return a new promise rejected with a TypeError.
+    if (!is_valid_video_decoder_config(config))
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Invalid VideoDecoderConfig"_utf16 };
+
+    // 2. Let p be a new Promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 3. Let checkSupportQueue be the result of starting a new parallel queue.
+    // 4. Enqueue the following steps to checkSupportQueue:
+    //    1. Let supported be the result of running the Check Configuration Support algorithm with config.
+    // NB: Checking support only consults the decoder registry, so there is no need to leave the event loop for it.
+    auto supported = supported_codec_id(config).has_value();
+
+    //    2. Queue a task to run the following steps:
+    HTML::queue_global_task(HTML::Task::Source::Codec, realm.global_object(), GC::create_function(realm.heap(), [promise, config, supported] {
+        auto& realm = WebIDL::promise_realm(promise);
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+        // 1. Let decoderSupport be a newly constructed VideoDecoderSupport, initialized as follows:
+        //    1. Set config to the result of running the Clone Configuration algorithm with config.
+        //    2. Set supported to supported.
+        VideoDecoderSupport decoder_support;
+        decoder_support.config = clone_configuration(realm, config);
+        decoder_support.supported = supported;
+
+        // 2. Resolve p with decoderSupport.
+        WebIDL::resolve_promise(realm, promise, Bindings::video_decoder_support_to_value(realm, decoder_support));
+    }));
+
+    // 5. Return p.
+    return promise;
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-configure
+WebIDL::ExceptionOr<void> VideoDecoder::configure(VideoDecoderConfig const& config)
+{
+    // 1. If config is not a valid VideoDecoderConfig, throw a TypeError.
+    if (!is_valid_video_decoder_config(config))
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Invalid VideoDecoderConfig"_utf16 };
+
+    // 2. If [[state]] is “closed”, throw an InvalidStateError DOMException.
+    // 3. Set [[state]] to "configured".
+    // 4. Set [[key chunk required]] to true.
+    // 5. Queue a control message to configure the decoder with config.
+    // NB: The description is copied now, since the buffer it refers to may change before the message runs.
+    OwnPtr<ActiveDecoderConfig> decoder_config;
+    if (auto codec_id = supported_codec_id(config); codec_id.has_value()) {
+        decoder_config = make<ActiveDecoderConfig>();
+        decoder_config->codec_id = *codec_id;
+        decoder_config->description = copy_description(config.description);
+        decoder_config->display_aspect_width = config.display_aspect_width;
+        decoder_config->display_aspect_height = config.display_aspect_height;
+        decoder_config->rotation = config.rotation;
+        decoder_config->flip = config.flip;
+    }
+    return configure_decoder(move(decoder_config));
+}
+
+Media::DecoderErrorOr<NonnullRefPtr<Media::DecodeWorker>> VideoDecoder::create_codec_implementation(DecoderConfig const& config)
+{
+    auto worker = TRY(Media::VideoDecodeWorker::try_create(Core::EventLoop::current(), config.codec_id, config.description));
+    worker->set_output_handler([this](NonnullRefPtr<Media::VideoFrame> frame) {
+        output_video_frame(move(frame));
+    });
+    return NonnullRefPtr<Media::DecodeWorker> { move(worker) };
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-decode
+WebIDL::ExceptionOr<void> VideoDecoder::decode(GC::Ref<EncodedVideoChunk> chunk)
+{
+    return decode_chunk(chunk, chunk->type() == EncodedVideoChunkType::Key);
+}
+
+// https://w3c.github.io/webcodecs/#output-videoframes
+void VideoDecoder::output_video_frame(NonnullRefPtr<Media::VideoFrame> output)
+{
+    queue_output([this, output = move(output)] {
+        // 1. For each output in outputs:
+        //    1. Let timestamp and duration be the timestamp and duration from the EncodedVideoChunk associated with
+        //       output.
+        //    2. Let displayAspectWidth and displayAspectHeight be undefined.
+        //    3. If displayAspectWidth and displayAspectHeight exist in the [[active decoder config]], assign their
+        //       values to displayAspectWidth and displayAspectHeight respectively.
+        auto const& config = static_cast<ActiveDecoderConfig const&>(active_decoder_config());
+        Gfx::Size<u32> display_size = output->size();
+        if (config.display_aspect_width.has_value() && config.display_aspect_height.has_value()) {
+            auto aspect_width = static_cast<u64>(*config.display_aspect_width);
+            auto aspect_height = static_cast<u64>(*config.display_aspect_height);
+            // NB: The visible size is stretched along one axis to match the display aspect ratio.
+            if (aspect_width * display_size.height() > aspect_height * display_size.width())
+                display_size.set_width(static_cast<u32>((display_size.height() * aspect_width + aspect_height / 2) / aspect_height));
+            else
+                display_size.set_height(static_cast<u32>((display_size.width() * aspect_height + aspect_width / 2) / aspect_width));
+        }
+
+        //    4. Let colorSpace be the VideoColorSpace for output as detected by the codec implementation.
+        // FIXME: Expose the color space of the frame.
+
+        //    5. Let rotation and flip be the values from the [[active decoder config]].
+        //    6. Let frame be the result of running the Create a VideoFrame algorithm with output, timestamp,
+        //       duration, displayAspectWidth, displayAspectHeight, colorSpace, rotation, and flip.
+        if (config.rotation == 90 || config.rotation == 270)
+            display_size = { display_size.height(), display_size.width() };
+        auto frame = VideoFrame::create(output, { display_size, config.rotation, config.flip });
+
+        //    7. Invoke [[output callback]] with frame.
+        invoke_output_callback(frame);
+    });
+}
+
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <LibWeb/Bindings/VideoDecoder.h>
+#include <LibWeb/WebCodecs/DecoderBase.h>
+
+namespace Web::WebCodecs {
+
+using VideoDecoderConfig = Bindings::VideoDecoderConfig;
+using VideoDecoderInit = Bindings::VideoDecoderInit;
+using VideoDecoderSupport = Bindings::VideoDecoderSupport;
+
+// https://w3c.github.io/webcodecs/#valid-videodecoderconfig
+bool is_valid_video_decoder_config(VideoDecoderConfig const&);
+
+// https://w3c.github.io/webcodecs/#videodecoder-interface
+class VideoDecoder final : public DecoderBase {
+    WEB_WRAPPABLE(VideoDecoder, DecoderBase);
+    GC_DECLARE_ALLOCATOR(VideoDecoder);
+
+public:
+    static WebIDL::ExceptionOr<GC::Ref<VideoDecoder>> create_for_constructor(JS::Object& relevant_global_object, VideoDecoderInit const&);
+    static WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> is_config_supported(JS::VM&, VideoDecoderConfig const&);
+
+    virtual ~VideoDecoder() override;
+
+    WebIDL::ExceptionOr<void> configure(VideoDecoderConfig const&);
+    WebIDL::ExceptionOr<void> decode(GC::Ref<EncodedVideoChunk>);
+
+private:
+    // The parts of [[active decoder config]] that are needed once the codec implementation has been created.
+    struct ActiveDecoderConfig final : public DecoderConfig {
+        Optional<u32> display_aspect_width;
+        Optional<u32> display_aspect_height;
+        double rotation { 0 };
+        bool flip { false };
+    };
+
+    VideoDecoder(GC::Ref<DOM::EventTarget> relevant_global_object, VideoDecoderInit const&);
+
+    virtual Media::DecoderErrorOr<NonnullRefPtr<Media::DecodeWorker>> create_codec_implementation(DecoderConfig const&) override;
+
+    void output_video_frame(NonnullRefPtr<Media::VideoFrame>);
+};
+
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGC/Heap.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/ColorSpace.h>
+#include <LibWeb/WebCodecs/VideoFrame.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::WebCodecs {
+
+GC_DEFINE_ALLOCATOR(VideoFrame);
+
+static Optional<VideoPixelFormat> pixel_format_for_frame(Media::VideoFrame const& frame)
+{
+    auto const& yuv_data = frame.yuv_data();
+    auto subsampling = yuv_data.subsampling();
+
+    auto select_format = [&](VideoPixelFormat eight_bit, VideoPixelFormat ten_bit, VideoPixelFormat twelve_bit) -> Optional<VideoPixelFormat> {
+        switch (yuv_data.bit_depth()) {
+        case 8:
+            return eight_bit;
+        case 10:
+            return ten_bit;
+        case 12:
+            return twelve_bit;
+        default:
+            return {};
+        }
+    };
+
+    if (subsampling == Media::Subsampling::yuv420())
+        return select_format(VideoPixelFormat::I420, VideoPixelFormat::I420P10, VideoPixelFormat::I420P12);
+    if (subsampling == Media::Subsampling::yuv422())
+        return select_format(VideoPixelFormat::I422, VideoPixelFormat::I422P10, VideoPixelFormat::I422P12);
+    if (subsampling == Media::Subsampling::yuv444())
+        return select_format(VideoPixelFormat::I444, VideoPixelFormat::I444P10, VideoPixelFormat::I444P12);
+    return {};
+}
+
+GC::Ref<VideoFrame> VideoFrame::create(NonnullRefPtr<Media::VideoFrame> frame, DisplayProperties const& display_properties)
+{
+    return GC::Heap::the().allocate<VideoFrame>(move(frame), display_properties);
+}
+
+VideoFrame::VideoFrame(NonnullRefPtr<Media::VideoFrame> frame, DisplayProperties const& display_properties)
+    : m_resource_reference(frame)
+    , m_format(pixel_format_for_frame(*frame))
+    , m_coded_size(frame->size())
+    , m_display_size(display_properties.display_size)
+    , m_rotation(display_properties.rotation)
+    , m_flip(display_properties.flip)
+    , m_timestamp(frame->timestamp().to_microseconds())
+{
+    if (!frame->duration().is_zero())
+        m_duration = frame->duration().to_microseconds();
+}
+
+VideoFrame::~VideoFrame() = default;
+
+// https://w3c.github.io/webcodecs/#dom-videoframe-clone
+WebIDL::ExceptionOr<GC::Ref<VideoFrame>> VideoFrame::clone() const
+{
+    // 1. If the value of frame’s [[Detached]] internal slot is true, throw an InvalidStateError DOMException.
+    if (m_detached)
+        return WebIDL::InvalidStateError::create("VideoFrame is closed"_utf16);
+
+    // 2. Return the result of running the Clone VideoFrame algorithm with this.
+    auto clone = create(*m_resource_reference, { m_display_size, m_rotation, m_flip });
+    clone->m_format = m_format;
+    clone->m_duration = m_duration;
+    clone->m_timestamp = m_timestamp;
+    clone->m_decoded_image_frame = m_decoded_image_frame;
+    return clone;
+}
+
+// https://w3c.github.io/webcodecs/#dom-videoframe-close
+void VideoFrame::close()
+{
+    // 1. Run the Close VideoFrame algorithm with this.
+    // https://w3c.github.io/webcodecs/#close-videoframe
+    // 1. Assign null to frame’s [[resource reference]].
+    // NB: Releasing the reference hands the frame's buffer back to its decoder, which may be waiting for it.
+    m_resource_reference = nullptr;
+    m_decoded_image_frame.clear();
+
+    // 2. Assign true to frame’s [[Detached]].
+    m_detached = true;
+
+    // 3. Assign null to frame’s format.
+    m_format = {};
+
+    // 4. Assign 0 to frame’s [[coded width]], [[coded height]], [[display width]], and [[display height]].
+    m_coded_size = {};
+    m_display_size = {};
+}
+
+Optional<Gfx::DecodedImageFrame> VideoFrame::decoded_image_frame() const
+{
+    if (m_decoded_image_frame.has_value() || !m_resource_reference)
+        return m_decoded_image_frame;
+
+    auto const& yuv_data = m_resource_reference->yuv_data();
+    auto bitmap_or_error = yuv_data.to_bitmap();
+    if (bitmap_or_error.is_error()) {
+        dbgln("Could not convert video frame to bitmap: {}", bitmap_or_error.release_error());
+        return {};
+    }
+    auto color_space = Gfx::ColorSpace {};
+    if (auto color_space_result = Gfx::ColorSpace::from_cicp(yuv_data.cicp()); !color_space_result.is_error())
+        color_space = color_space_result.release_value();
+    m_decoded_image_frame = Gfx::DecodedImageFrame { NonnullRefPtr<Gfx::Bitmap const> { bitmap_or_error.release_value() }, move(color_space) };
+    return m_decoded_image_frame;
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/RefPtr.h>
+#include <LibGfx/DecodedImageFrame.h>
+#include <LibGfx/Size.h>
+#include <LibMedia/VideoFrame.h>
+#include <LibWeb/Bindings/VideoFrame.h>
+#include <LibWeb/Bindings/Wrappable.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::WebCodecs {
+
+using VideoPixelFormat = Bindings::VideoPixelFormat;
+
+// https://w3c.github.io/webcodecs/#videoframe-interface
+class VideoFrame final : public Bindings::GCAllocatedWrappable {
+    WEB_WRAPPABLE(VideoFrame, Bindings::GCAllocatedWrappable);
+    GC_DECLARE_ALLOCATOR(VideoFrame);
+
+public:
+    struct DisplayProperties {
+        Gfx::Size<u32> display_size;
+        double rotation { 0 };
+        bool flip { false };
+    };
+
+    static GC::Ref<VideoFrame> create(NonnullRefPtr<Media::VideoFrame>, DisplayProperties const&);
+    virtual ~VideoFrame() override;
+
+    Optional<VideoPixelFormat> format() const { return m_format; }
+    WebIDL::UnsignedLong coded_width() const { return m_coded_size.width(); }
+    WebIDL::UnsignedLong coded_height() const { return m_coded_size.height(); }
+    double rotation() const { return m_rotation; }
+    bool flip() const { return m_flip; }
+    WebIDL::UnsignedLong display_width() const { return m_display_size.width(); }
+    WebIDL::UnsignedLong display_height() const { return m_display_size.height(); }
+    Optional<WebIDL::UnsignedLongLong> duration() const { return m_duration; }
+    WebIDL::LongLong timestamp() const { return m_timestamp; }
+
+    WebIDL::ExceptionOr<GC::Ref<VideoFrame>> clone() const;
+    void close();
+
+    bool is_detached() const { return m_detached; }
+
+    // Converts the frame to a bitmap the first time it is drawn, so that drawing the same frame repeatedly does not
+    // repeat the conversion from YUV.
+    Optional<Gfx::DecodedImageFrame> decoded_image_frame() const;
+
+private:
+    VideoFrame(NonnullRefPtr<Media::VideoFrame>, DisplayProperties const&);
+
+    // https://w3c.github.io/webcodecs/#dom-videoframe-resource-reference
+    RefPtr<Media::VideoFrame> m_resource_reference;
+
+    // https://w3c.github.io/webcodecs/#dom-videoframe-detached-slot
+    bool m_detached { false };
+
+    Optional<VideoPixelFormat> m_format;
+    Gfx::Size<u32> m_coded_size;
+    Gfx::Size<u32> m_display_size;
+    double m_rotation { 0 };
+    bool m_flip { false };
+    Optional<WebIDL::UnsignedLongLong> m_duration;
+    WebIDL::LongLong m_timestamp { 0 };
+
+    mutable Optional<Gfx::DecodedImageFrame> m_decoded_image_frame;
+};
+
+}
@@ -349,7 +349,8 @@ WebIDL::ExceptionOr<void> WebSocket::send(WebSocketSendData const& data)
                 m_websocket->send(buffer, false);
             },
             [this](GC::Ref<FileAPI::Blob> blob) {
-                m_websocket->send(blob->raw_bytes(), false);
+                auto bytes = blob->raw_bytes().release_value_but_fixme_should_propagate_errors();
+                m_websocket->send(bytes.bytes(), false);
             });
         // TODO : If the data cannot be sent, e.g. because it would need to be buffered but the buffer is full, the user agent must flag the WebSocket as full and then close the WebSocket connection.
         // TODO : Any invocation of this method with a string argument that does not throw an exception must increase the bufferedAmount attribute by the number of bytes needed to express the argument as UTF-8.
@@ -410,6 +410,7 @@ libweb_js_bindings(MediaCapture/MediaStream)
 libweb_js_bindings(MediaCapture/MediaStreamConstraints)
 libweb_js_bindings(MediaCapture/MediaStreamTrack)
 libweb_js_bindings(MediaCapture/MediaStreamTrackEvent)
+libweb_js_bindings(MediaPlaybackQuality/VideoPlaybackQuality)
 libweb_js_bindings(MediaSourceExtensions/BufferedChangeEvent)
 libweb_js_bindings(MediaSourceExtensions/ManagedMediaSource)
 libweb_js_bindings(MediaSourceExtensions/ManagedSourceBuffer)
@@ -594,6 +595,7 @@ libweb_js_bindings(WebAudio/BiquadFilterNode)
 libweb_js_bindings(WebAudio/ChannelMergerNode)
 libweb_js_bindings(WebAudio/ChannelSplitterNode)
 libweb_js_bindings(WebAudio/ConstantSourceNode)
+libweb_js_bindings(WebAudio/ConvolverNode)
 libweb_js_bindings(WebAudio/DelayNode)
 libweb_js_bindings(WebAudio/DynamicsCompressorNode)
 libweb_js_bindings(WebAudio/GainNode)
@@ -605,6 +607,12 @@ libweb_js_bindings(WebAudio/PannerNode)
 libweb_js_bindings(WebAudio/PeriodicWave)
 libweb_js_bindings(WebAudio/ScriptProcessorNode)
 libweb_js_bindings(WebAudio/StereoPannerNode)
+libweb_js_bindings(WebCodecs/AudioData)
+libweb_js_bindings(WebCodecs/AudioDecoder)
+libweb_js_bindings(WebCodecs/EncodedAudioChunk)
+libweb_js_bindings(WebCodecs/EncodedVideoChunk)
+libweb_js_bindings(WebCodecs/VideoDecoder)
+libweb_js_bindings(WebCodecs/VideoFrame)
 libweb_js_bindings(WebGL/Extensions/ANGLEInstancedArrays)
 libweb_js_bindings(WebGL/Extensions/EXTBlendMinMax)
 libweb_js_bindings(WebGL/Extensions/EXTColorBufferFloat)
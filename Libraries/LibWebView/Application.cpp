@@ -9,6 +9,7 @@
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/Math.h>
+#include <AK/NumberFormat.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <AK/Time.h>
@@ -16,9 +17,11 @@
 #include <LibCore/ArgsParser.h>
 #include <LibCore/Environment.h>
 #include <LibCore/File.h>
+#include <LibCore/MemoryPressureMonitor.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibCore/TimeZoneWatcher.h>
+#include <LibCore/Tracing.h>
 #include <LibDatabase/Database.h>
 #include <LibDevTools/DevToolsServer.h>
 #include <LibDevTools/FirefoxClient.h>
@@ -44,6 +47,7 @@
 #include <LibWebView/ProcessType.h>
 #include <LibWebView/SessionStore.h>
 #include <LibWebView/SiteIsolation.h>
+#include <LibWebView/TraceCollector.h>
 #include <LibWebView/URL.h>
 #include <LibWebView/UserAgent.h>
 #include <LibWebView/Utilities.h>
@@ -239,6 +243,10 @@ Requests::RequestClient& Application::request_server_client(IsPrivate is_private
         request_server_client->transport().set_peer_pid(response->peer_pid());
 #endif
 
+        request_server_client->on_memory_released = [](auto level, auto bytes_released) {
+            the().did_release_memory_in_process(ProcessType::RequestServer, level, bytes_released);
+        };
+
         the().m_private_request_server_client = move(request_server_client);
     }
 
@@ -301,6 +309,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     bool disable_scrollbar_painting = false;
     bool disable_async_scrolling = false;
     bool file_scheme_urls_have_tuple_origins = false;
+    bool enable_tracing = false;
 
     Core::ArgsParser args_parser;
     args_parser.set_general_help("The Ladybird web browser :^)");
@@ -403,6 +412,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation", 'g');
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical scrollbars on the main viewport", "disable-scrollbar-painting");
     args_parser.add_option(disable_async_scrolling, "Disable async scrolling", "disable-async-scrolling");
+    args_parser.add_option(enable_tracing, "Record trace events in all processes from startup, until tracing is stopped from the Debug menu", "enable-tracing");
     args_parser.add_option(dns_server_address, "Set the DNS server address", "dns-server", 0, "host|address");
     args_parser.add_option(dns_server_port, "Set the DNS server port", "dns-port", 0, "port (default: 53 or 853 if --dot)");
     args_parser.add_option(use_dns_over_tls, "Use DNS over TLS", "dot");
@@ -438,6 +448,10 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     create_platform_arguments(args_parser);
     args_parser.parse(m_arguments);
 
+    // Helper processes are launched with tracing enabled as well.
+    if (enable_tracing)
+        Core::Tracing::set_enabled(true);
+
 #if !defined(AK_OS_ANDROID)
     ProfileSelection profile_selection;
     if (force_new_process) {
@@ -1062,6 +1076,65 @@ void Application::crash_compositor_process()
     m_compositor_client->async_crash();
 }
 
+void Application::release_memory(Core::MemoryPressure::Level level)
+{
+    WebContentClient::for_each_client([&](WebContentClient& client) {
+        client.async_release_memory(level);
+        return IterationDecision::Continue;
+    });
+    WorkerProcessManager::the().for_each_client([&](WebWorkerClient& client) {
+        client.async_release_memory(level);
+        return IterationDecision::Continue;
+    });
+
+    if (m_request_server_client)
+        m_request_server_client->async_release_memory(level);
+    if (m_private_request_server_client)
+        m_private_request_server_client->async_release_memory(level);
+    if (m_image_decoder_client)
+        m_image_decoder_client->async_release_memory(level);
+    if (can_send_compositor_process_ipc(m_compositor_client))
+        m_compositor_client->async_release_memory(level);
+
+    auto report = Core::MemoryPressure::release_memory(level);
+    did_release_memory_in_process(ProcessType::Browser, level, report.total_bytes_released());
+}
+
+void Application::did_release_memory_in_process(ProcessType type, Core::MemoryPressure::Level level, u64 bytes_released)
+{
+    dbgln_if(MEMORY_PRESSURE_DEBUG, "{} released {} under {} memory pressure", process_name_from_type(type), human_readable_size(bytes_released), Core::MemoryPressure::level_to_string(level));
+}
+
+void Application::set_tracing_enabled(bool enabled)
+{
+    Core::Tracing::set_enabled(enabled);
+
+    WebContentClient::for_each_client([&](WebContentClient& client) {
+        client.async_set_tracing_enabled(enabled);
+        return IterationDecision::Continue;
+    });
+
+    RefPtr<CompositorClient> compositor_client;
+    if (can_send_compositor_process_ipc(m_compositor_client)) {
+        compositor_client = m_compositor_client;
+        compositor_client->async_set_tracing_enabled(enabled);
+    }
+
+    if (enabled)
+        return;
+
+    // Each process has stopped recording by the time it receives our request, since it is sent over the same
+    // connection, so the trace ends at roughly the same time in every process.
+    auto collector = TraceCollector::create();
+    collector->on_complete = [](ErrorOr<LexicalPath> trace_path) {
+        if (trace_path.is_error())
+            warnln("\033[31;1mFailed to save trace: {}\033[0m", trace_path.error());
+        else
+            warnln("\033[33;1mSaved trace into {}, it can be opened with https://ui.perfetto.dev\033[0m", trace_path.value());
+    };
+    collector->collect(compositor_client.ptr());
+}
+
 ErrorOr<NonnullRefPtr<WebContentClient>> Application::launch_web_content_process(ViewImplementation& view, Optional<Web::HTML::CrossProcessId> root_navigable_id, Optional<Web::HTML::CrossProcessId> initial_document_state_id)
 {
     if (view.is_private() == IsPrivate::Yes)
@@ -1285,6 +1358,24 @@ ErrorOr<void> Application::launch_services()
         }
     }
 
+    for (auto* database : { m_database.ptr(), m_history_database.ptr(), m_session_database.ptr() }) {
+        if (!database)
+            continue;
+        Core::MemoryPressure::register_handler("Database page cache"sv, [database](auto) {
+            return database->release_memory();
+        });
+    }
+
+    if (auto memory_pressure_monitor = Core::MemoryPressureMonitor::create(); memory_pressure_monitor.is_error()) {
+        dbgln("Unable to monitor system memory pressure: {}", memory_pressure_monitor.error());
+    } else {
+        m_memory_pressure_monitor = memory_pressure_monitor.release_value();
+
+        m_memory_pressure_monitor->on_memory_pressure = [this](auto level) {
+            release_memory(level);
+        };
+    }
+
     TRY(launch_request_server());
     TRY(launch_image_decoder_server());
 #if defined(HAVE_WASM_COMPILER_SERVICE)
@@ -1310,6 +1401,9 @@ ErrorOr<void> Application::launch_compositor_process()
     m_compositor_client->on_death = [this]() {
         handle_compositor_process_death();
     };
+    m_compositor_client->on_memory_released = [this](auto level, auto bytes_released) {
+        did_release_memory_in_process(ProcessType::Compositor, level, bytes_released);
+    };
 
 #ifdef USE_DIRECTX
     m_reported_compositor_gpu_presentation_unavailable = false;
@@ -1410,6 +1504,10 @@ ErrorOr<void> Application::launch_request_server()
 {
     m_request_server_client = TRY(launch_request_server_process());
 
+    m_request_server_client->on_memory_released = [this](auto level, auto bytes_released) {
+        did_release_memory_in_process(ProcessType::RequestServer, level, bytes_released);
+    };
+
     m_request_server_client->on_retrieve_http_cookie = [](URL::URL const& url, RequestServer::IsPrivate is_private) -> String {
         auto& cookie_jar = Application::cookie_jar(is_private == RequestServer::IsPrivate::Yes ? IsPrivate::Yes : IsPrivate::No);
         if constexpr (!REQUESTSERVER_WIRE_DEBUG)
@@ -1481,6 +1579,10 @@ ErrorOr<void> Application::launch_image_decoder_server()
 {
     m_image_decoder_client = TRY(launch_image_decoder_process());
 
+    m_image_decoder_client->on_memory_released = [this](auto level, auto bytes_released) {
+        did_release_memory_in_process(ProcessType::ImageDecoder, level, bytes_released);
+    };
+
     m_image_decoder_client->on_death = [this]() {
         m_image_decoder_client = nullptr;
 
@@ -2247,6 +2349,13 @@ void Application::initialize_actions()
     m_debug_menu->add_action(Action::create("Crash Compositor Process"sv, ActionID::CrashCompositorProcess, [this]() { crash_compositor_process(); }));
     m_debug_menu->add_separator();
 
+    m_record_trace_action = Action::create_checkable("Record Trace"sv, ActionID::RecordTrace, [this]() {
+        set_tracing_enabled(m_record_trace_action->checked());
+    });
+    m_record_trace_action->set_checked(Core::Tracing::is_enabled());
+    m_debug_menu->add_action(*m_record_trace_action);
+    m_debug_menu->add_separator();
+
     auto spoof_user_agent_menu = Menu::create_group("Spoof User Agent"sv);
     m_user_agent_string = m_web_content_options.user_agent_preset.has_value()
         ? *WebView::user_agents.get(*m_web_content_options.user_agent_preset)
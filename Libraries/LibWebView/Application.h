@@ -15,6 +15,7 @@
 #include <LibCore/EventLoop.h>
 #include <LibCore/Forward.h>
 #include <LibCore/GeolocationProvider.h>
+#include <LibCore/MemoryPressure.h>
 #include <LibDatabase/Forward.h>
 #include <LibDevTools/DevToolsDelegate.h>
 #include <LibDevTools/Forward.h>
@@ -157,6 +158,9 @@ public:
     void maybe_close_private_browsing_session();
     void reset_private_browsing_session();
 
+    // Each helper process reports how much memory it released after it was asked to release memory.
+    void did_release_memory_in_process(ProcessType, Core::MemoryPressure::Level, u64 bytes_released);
+
     void notify_webdriver_window_created(String const& handle);
     void notify_webdriver_window_closed(String const& handle);
     void webdriver_browser_connection_died(Badge<WebDriverBrowserConnection>);
@@ -338,6 +342,8 @@ private:
     void handle_compositor_process_death();
     void recover_compositor_process();
     void crash_compositor_process();
+    void set_tracing_enabled(bool);
+    void release_memory(Core::MemoryPressure::Level);
     ErrorOr<void> launch_request_server();
     ErrorOr<void> launch_image_decoder_server();
 #if defined(HAVE_WASM_COMPILER_SERVICE)
@@ -494,6 +500,7 @@ private:
 
     OwnPtr<Core::GeolocationProvider> m_geolocation_provider;
     OwnPtr<Core::TimeZoneWatcher> m_time_zone_watcher;
+    OwnPtr<Core::MemoryPressureMonitor> m_memory_pressure_monitor;
 
     Core::EventLoop* m_event_loop { nullptr };
     OwnPtr<ProcessManager> m_process_manager;
@@ -539,6 +546,7 @@ private:
 
     RefPtr<Menu> m_debug_menu;
     RefPtr<Action> m_show_line_box_borders_action;
+    RefPtr<Action> m_record_trace_action;
     RefPtr<Action> m_show_caret_hit_test_debug_overlay_action;
     RefPtr<Action> m_enable_scripting_action;
     RefPtr<Action> m_enable_content_blocking_action;
@@ -18,6 +18,10 @@ CompositorClient::CompositorClient(NonnullOwnPtr<IPC::Transport> transport)
 
 void CompositorClient::die()
 {
+    auto pending_trace_requests = move(m_pending_trace_requests);
+    for (auto& it : pending_trace_requests)
+        it.value.promise->reject(Error::from_string_literal("Compositor process exited"));
+
     if (auto callback = move(on_death)) {
         Core::deferred_invoke([callback = move(callback)]() mutable {
             callback();
@@ -37,17 +41,40 @@ void CompositorClient::did_allocate_backing_stores(Web::Compositor::CompositorCo
     web_content_client->did_present_backing_stores(*page_id, move(bitmap_ids), move(backing_stores));
 }
 
-void CompositorClient::did_present_frame(Web::Compositor::CompositorContextId context_id, Gfx::IntRect content_rect, Gfx::IntRect damage_rect, i32 bitmap_id)
+void CompositorClient::did_present_frame(Web::Compositor::CompositorContextId context_id, Gfx::IntRect content_rect, Gfx::IntRect damage_rect, i32 bitmap_id, Web::Compositor::PresentTimings timings)
 {
     auto web_content_client = WebContentClient::client_for_compositor_context_id(context_id);
     if (web_content_client.has_value()) {
         auto page_id = web_content_client->page_id_for_compositor_context_id(context_id);
         VERIFY(page_id.has_value());
-        web_content_client->did_present_bitmap(*page_id, content_rect, damage_rect, bitmap_id);
+        web_content_client->did_present_bitmap(*page_id, content_rect, damage_rect, bitmap_id, timings);
         return;
     }
 
     async_presented_bitmap_ready_to_paint(context_id, bitmap_id);
 }
 
+NonnullRefPtr<Core::Promise<ProcessTrace>> CompositorClient::collect_trace()
+{
+    auto promise = Core::Promise<ProcessTrace>::construct();
+    auto request_id = m_next_trace_request_id++;
+
+    m_pending_trace_requests.set(request_id, { promise, MonotonicTime::now() });
+    async_collect_trace(request_id);
+
+    return promise;
+}
+
+void CompositorClient::did_collect_trace(u64 request_id, Core::AnonymousBuffer events, i64 monotonic_time_in_nanoseconds)
+{
+    if (auto request = m_pending_trace_requests.take(request_id); request.has_value())
+        request->promise->resolve(request->resolve(events, monotonic_time_in_nanoseconds));
+}
+
+void CompositorClient::did_release_memory(Core::MemoryPressure::Level level, u64 bytes_released)
+{
+    if (on_memory_released)
+        on_memory_released(level, bytes_released);
+}
+
 }
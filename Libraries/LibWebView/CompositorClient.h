@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <Compositor/CompositorControlClientEndpoint.h>
 #include <Compositor/CompositorControlServerEndpoint.h>
 #include <LibGfx/Rect.h>
@@ -14,6 +15,7 @@
 #include <LibIPC/ConnectionToServer.h>
 #include <LibWeb/Compositor/Types.h>
 #include <LibWebView/Forward.h>
+#include <LibWebView/TraceCollector.h>
 
 namespace WebView {
 
@@ -28,12 +30,21 @@ public:
     explicit CompositorClient(NonnullOwnPtr<IPC::Transport>);
 
     Function<void()> on_death;
+    Function<void(Core::MemoryPressure::Level, u64 bytes_released)> on_memory_released;
+
+    // Resolves to the trace events that the Compositor process recorded since they were last collected.
+    NonnullRefPtr<Core::Promise<ProcessTrace>> collect_trace();
 
 private:
     virtual void die() override;
 
     virtual void did_allocate_backing_stores(Web::Compositor::CompositorContextId, Vector<i32> bitmap_ids, Vector<Gfx::SharedImage> backing_stores) override;
-    virtual void did_present_frame(Web::Compositor::CompositorContextId, Gfx::IntRect content_rect, Gfx::IntRect damage_rect, i32 bitmap_id) override;
+    virtual void did_present_frame(Web::Compositor::CompositorContextId, Gfx::IntRect content_rect, Gfx::IntRect damage_rect, i32 bitmap_id, Web::Compositor::PresentTimings) override;
+    virtual void did_collect_trace(u64 request_id, Core::AnonymousBuffer events, i64 monotonic_time_in_nanoseconds) override;
+    virtual void did_release_memory(Core::MemoryPressure::Level, u64 bytes_released) override;
+
+    HashMap<u64, PendingTraceRequest> m_pending_trace_requests;
+    u64 m_next_trace_request_id { 0 };
 };
 
 }
@@ -289,10 +289,10 @@ void CompositorHostBase::viewport_size_updated(Web::Compositor::CompositorContex
         connection->viewport_size_updated(context_id, viewport_size, window_resize_in_progress);
 }
 
-void CompositorHostBase::present_frame(Web::Compositor::CompositorContextId context_id, Gfx::IntRect viewport_rect, Gfx::IntRect damage_rect)
+void CompositorHostBase::present_frame(Web::Compositor::CompositorContextId context_id, Gfx::IntRect viewport_rect, Gfx::IntRect damage_rect, u64 frame_id)
 {
     if (auto* connection = compositor_connection())
-        connection->present_frame(context_id, viewport_rect, damage_rect);
+        connection->present_frame(context_id, viewport_rect, damage_rect, frame_id);
 }
 
 void CompositorHostBase::request_screenshot(Web::Compositor::CompositorContextId context_id, NonnullRefPtr<Gfx::PaintingSurface> target_surface, Function<void()>&& callback)
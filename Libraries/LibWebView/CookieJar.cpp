@@ -28,6 +28,9 @@ static constexpr auto DATABASE_SYNCHRONIZATION_TIMER = AK::Duration::from_second
 
 static constexpr u32 COOKIES_SCHEMA_BASELINE_VERSION = 1u;
 
+// Bounds the number of cached cookie strings, for long sessions that do not change any cookies.
+static constexpr size_t COOKIE_STRING_CACHE_CAPACITY = 1024;
+
 static CookieStorageKey storage_key_for_cookie(HTTP::Cookie::Cookie const& cookie)
 {
     return { cookie.name, cookie.domain, cookie.path };
@@ -118,6 +121,30 @@ String CookieJar::get_cookie(URL::URL const& url, HTTP::Cookie::Source source)
 {
     m_transient_storage.purge_expired_cookies();
 
+    auto retrieval_host_canonical = HTTP::Cookie::canonicalize_domain(url);
+    if (!retrieval_host_canonical.has_value())
+        return {};
+
+    if (m_cookie_string_cache_generation != m_transient_storage.generation()) {
+        m_cookie_string_cache.clear();
+        m_cookie_string_cache_generation = m_transient_storage.generation();
+    }
+
+    // The cookie-string only depends on the parts of the URL that cookies are matched against, so it can be reused
+    // until a cookie changes.
+    CookieStringCacheKey cache_key {
+        .host = retrieval_host_canonical.release_value(),
+        .path = url.serialize_path(),
+        .is_secure = url.scheme() == "https"sv || url.scheme() == "wss"sv,
+        .source = source,
+    };
+
+    if (auto cached = m_cookie_string_cache.get(cache_key); cached.has_value()) {
+        // 5. Update the last-access-time of each cookie in the cookie-list to the current date and time.
+        m_transient_storage.update_last_access_time(cached->cookie_keys, UnixDateTime::now());
+        return cached->cookie_string;
+    }
+
     auto cookie_list = get_matching_cookies(url, source);
 
     // 6. Serialize the cookie-list into a cookie-string by processing each cookie in the cookie-list in order:
@@ -138,7 +165,18 @@ String CookieJar::get_cookie(URL::URL const& url, HTTP::Cookie::Source source)
         // 3. If the cookie was not the last cookie in the cookie-list, output the characters %x3B and %x20 ("; ").
     }
 
-    return MUST(builder.to_string());
+    auto cookie_string = MUST(builder.to_string());
+
+    if (m_cookie_string_cache.size() >= COOKIE_STRING_CACHE_CAPACITY)
+        m_cookie_string_cache.clear();
+
+    CachedCookieString cached { .cookie_string = cookie_string, .cookie_keys = {} };
+    cached.cookie_keys.ensure_capacity(cookie_list.size());
+    for (auto const& cookie : cookie_list)
+        cached.cookie_keys.unchecked_append(storage_key_for_cookie(cookie));
+    m_cookie_string_cache.set(move(cache_key), move(cached));
+
+    return cookie_string;
 }
 
 // https://datatracker.ietf.org/doc/html/draft-ietf-httpbis-rfc6265bis-22#section-5.7
@@ -563,7 +601,7 @@ Vector<HTTP::Cookie::Cookie> CookieJar::get_matching_cookies(URL::URL const& url
     // 3. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<HTTP::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](HTTP::Cookie::Cookie& cookie) {
+    m_transient_storage.for_each_cookie_with_domain_of_host(*retrieval_host_canonical, [&](HTTP::Cookie::Cookie& cookie) {
         if (!HTTP::Cookie::cookie_matches_url(cookie, url, *retrieval_host_canonical, source))
             return;
 
@@ -612,9 +650,23 @@ CookieJar::TransientStorage::TransientStorage(IsPrivate is_private)
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
     m_cookies = move(cookies);
+    rebuild_indices();
     purge_expired_cookies();
 }
 
+void CookieJar::TransientStorage::rebuild_indices()
+{
+    m_cookie_keys_by_domain.clear();
+    m_expiry_queue.clear();
+
+    for (auto const& [key, cookie] : m_cookies) {
+        m_cookie_keys_by_domain.ensure(key.domain).set(key);
+        m_expiry_queue.insert(cookie.expiry_time, key);
+    }
+
+    ++m_generation;
+}
+
 void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, HTTP::Cookie::Cookie cookie)
 {
     auto now = UnixDateTime::now();
@@ -632,7 +684,11 @@ void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, HTTP::Cookie:
     }
 
     auto cookie_for_notification = cookie;
-    m_cookies.set(key, cookie);
+    if (m_cookies.set(key, cookie) == HashSetResult::InsertedNewEntry)
+        m_cookie_keys_by_domain.ensure(key.domain).set(key);
+    m_expiry_queue.insert(cookie.expiry_time, key);
+    ++m_generation;
+
     m_dirty_cookies.set(move(key), move(cookie));
 
     // We skip notifying about updating expired cookies, as they will be notified as being
@@ -656,14 +712,51 @@ UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Dur
             cookie.value.expiry_time -= *offset;
     }
 
-    auto is_expired = [&](auto const&, auto const& cookie) { return cookie.expiry_time < now; };
+    Vector<CookieEntry> removed_entries;
+
+    while (!m_expiry_queue.is_empty() && m_expiry_queue.peek_min_key() < now) {
+        auto key = m_expiry_queue.pop_min();
+
+        // The cookie may have been removed or given a later expiry time since this entry was queued.
+        auto it = m_cookies.find(key);
+        if (it == m_cookies.end() || it->value.expiry_time >= now)
+            continue;
+
+        auto cookie = move(it->value);
+        m_cookies.remove(it);
+
+        if (auto keys = m_cookie_keys_by_domain.find(key.domain); keys != m_cookie_keys_by_domain.end()) {
+            keys->value.remove(key);
+            if (keys->value.is_empty())
+                m_cookie_keys_by_domain.remove(keys);
+        }
+
+        removed_entries.append({ move(key), move(cookie) });
+    }
+
+    // Don't let entries of cookies that are updated over and over again pile up.
+    if (m_expiry_queue.size() > (m_cookies.size() * 2) + 64) {
+        m_expiry_queue.clear();
+        for (auto const& [key, cookie] : m_cookies)
+            m_expiry_queue.insert(cookie.expiry_time, key);
+    }
 
-    if (auto removed_entries = m_cookies.take_all_matching(is_expired); !removed_entries.is_empty())
+    if (!removed_entries.is_empty()) {
+        ++m_generation;
         send_cookie_changed_notifications(removed_entries);
+    }
 
     return now;
 }
 
+void CookieJar::TransientStorage::update_last_access_time(ReadonlySpan<CookieStorageKey> keys, UnixDateTime last_access_time)
+{
+    for (auto const& key : keys) {
+        if (auto it = m_cookies.find(key); it != m_cookies.end())
+            it->value.last_access_time = last_access_time;
+    }
+}
+
 void CookieJar::TransientStorage::expire_and_purge_cookies_accessed_since(UnixDateTime since)
 {
     for (auto& [key, value] : m_cookies) {
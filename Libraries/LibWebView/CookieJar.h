@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <AK/BinaryHeap.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
@@ -31,6 +33,15 @@ struct CookieStorageKey {
     String path;
 };
 
+struct CookieStringCacheKey {
+    bool operator==(CookieStringCacheKey const&) const = default;
+
+    String host;
+    String path;
+    bool is_secure { false };
+    HTTP::Cookie::Source source { HTTP::Cookie::Source::NonHttp };
+};
+
 class WEBVIEW_API CookieJar {
 public:
     static ErrorOr<Database::MigrationOutcome> migrate_schema(Database::Database&, Database::MigrationMode = Database::MigrationMode::Apply);
@@ -74,6 +85,9 @@ private:
 
         size_t size() const { return m_cookies.size(); }
 
+        // Incremented whenever a cookie is added, changed, or removed.
+        u64 generation() const { return m_generation; }
+
         UnixDateTime purge_expired_cookies(Optional<AK::Duration> offset = {});
         void expire_and_purge_cookies_accessed_since(UnixDateTime since);
 
@@ -97,13 +111,45 @@ private:
             }
         }
 
+        // Invokes the callback for every cookie whose domain is the given host or one of its parent domains, which are
+        // the only cookies that can match a URL with that host.
+        template<typename Callback>
+        void for_each_cookie_with_domain_of_host(StringView host, Callback callback)
+        {
+            auto domain = host;
+
+            while (true) {
+                if (auto keys = m_cookie_keys_by_domain.get(domain); keys.has_value()) {
+                    for (auto const& key : *keys)
+                        callback(m_cookies.find(key)->value);
+                }
+
+                auto separator = domain.find('.');
+                if (!separator.has_value())
+                    break;
+                domain = domain.substring_view(*separator + 1);
+            }
+        }
+
+        void update_last_access_time(ReadonlySpan<CookieStorageKey>, UnixDateTime);
+
     private:
         using CookieEntry = decltype(declval<Cookies>().take_all_matching(nullptr))::ValueType;
         void send_cookie_changed_notifications(ReadonlySpan<CookieEntry>, bool inform_web_view_about_changed_domains = true);
 
+        void rebuild_indices();
+
         IsPrivate m_is_private { IsPrivate::No };
         Cookies m_cookies;
         Cookies m_dirty_cookies;
+
+        HashMap<String, HashTable<CookieStorageKey>> m_cookie_keys_by_domain;
+
+        // Every cookie has an entry for its current expiry time. Entries left behind by cookies that have since been
+        // changed or removed are skipped once they reach the top.
+        BinaryHeap<UnixDateTime, CookieStorageKey, 0> m_expiry_queue;
+
+        u64 m_generation { 0 };
     };
 
     struct WEBVIEW_API PersistedStorage {
@@ -127,8 +173,17 @@ private:
 
     Vector<HTTP::Cookie::Cookie> get_matching_cookies(URL::URL const& url, HTTP::Cookie::Source source, MatchingCookiesSpecMode mode = MatchingCookiesSpecMode::RFC6265);
 
+    struct CachedCookieString {
+        String cookie_string;
+        Vector<CookieStorageKey> cookie_keys;
+    };
+
     Optional<PersistedStorage> m_persisted_storage;
     TransientStorage m_transient_storage;
+
+    // Serialized cookie strings for recently retrieved URLs, valid for the storage generation they were created in.
+    HashMap<CookieStringCacheKey, CachedCookieString> m_cookie_string_cache;
+    u64 m_cookie_string_cache_generation { 0 };
 };
 
 }
@@ -144,3 +199,16 @@ struct AK::Traits<WebView::CookieStorageKey> : public AK::DefaultTraits<WebView:
         return hash;
     }
 };
+
+template<>
+struct AK::Traits<WebView::CookieStringCacheKey> : public AK::DefaultTraits<WebView::CookieStringCacheKey> {
+    static unsigned hash(WebView::CookieStringCacheKey const& key)
+    {
+        unsigned hash = 0;
+        hash = pair_int_hash(hash, key.host.hash());
+        hash = pair_int_hash(hash, key.path.hash());
+        hash = pair_int_hash(hash, key.is_secure);
+        hash = pair_int_hash(hash, to_underlying(key.source));
+        return hash;
+    }
+};
@@ -35,6 +35,7 @@ class SessionStore;
 class Settings;
 class SiteIsolationManager;
 class StorageJar;
+class TraceCollector;
 class TraversableSessionHistory;
 class ViewImplementation;
 class WebContentClient;
@@ -55,6 +56,7 @@ struct DOMNodeProperties;
 struct HistoryEntry;
 struct Mutation;
 struct ProcessHandle;
+struct ProcessTrace;
 struct SearchEngine;
 struct WebContentOptions;
 
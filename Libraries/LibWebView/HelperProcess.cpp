@@ -7,6 +7,7 @@
 #include <AK/Enumerate.h>
 #include <LibCore/Process.h>
 #include <LibCore/System.h>
+#include <LibCore/Tracing.h>
 #include <LibWebView/Application.h>
 #include <LibWebView/CompositorClient.h>
 #include <LibWebView/HelperProcess.h>
@@ -123,6 +124,8 @@ ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(IsP
         arguments.append("--tuple-file-origins"sv);
     if (browser_options.disable_sandbox == DisableSandbox::Yes)
         arguments.append("--disable-sandbox"sv);
+    if (Core::Tracing::is_enabled())
+        arguments.append("--enable-tracing"sv);
 
     if (auto const maybe_echo_server_port = web_content_options.echo_server_port; maybe_echo_server_port.has_value()) {
         arguments.append("--echo-server-port"sv);
@@ -197,6 +200,8 @@ ErrorOr<NonnullRefPtr<WebView::CompositorClient>> launch_compositor_process()
         arguments.append("--force-fontconfig"sv);
     if (web_content_options.enable_async_scrolling == EnableAsyncScrolling::No)
         arguments.append("--disable-async-scrolling"sv);
+    if (Core::Tracing::is_enabled())
+        arguments.append("--enable-tracing"sv);
     if (auto server = mach_server_name(); server.has_value()) {
         arguments.append("--mach-server-name"sv);
         arguments.append(server.value());
@@ -288,6 +293,14 @@ ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process()
 
     if (request_server_options.resource_substitution_map_path.has_value())
         arguments.append(ByteString::formatted("--resource-map={}", *request_server_options.resource_substitution_map_path));
+    if (request_server_options.record_archive_path.has_value())
+        arguments.append(ByteString::formatted("--record-archive={}", *request_server_options.record_archive_path));
+    if (request_server_options.replay_archive_path.has_value())
+        arguments.append(ByteString::formatted("--replay-archive={}", *request_server_options.replay_archive_path));
+    if (request_server_options.replay_latency_ms.has_value())
+        arguments.append(ByteString::formatted("--replay-latency={}", *request_server_options.replay_latency_ms));
+    if (request_server_options.replay_bandwidth.has_value())
+        arguments.append(ByteString::formatted("--replay-bandwidth={}", *request_server_options.replay_bandwidth));
 
     auto client = TRY(launch_server_process<Requests::RequestClient>("RequestServer"sv, move(arguments)));
 
@@ -9,6 +9,7 @@
 #include <AK/Math.h>
 #include <AK/NumericLimits.h>
 #include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
 #include <AK/Utf8View.h>
 #include <LibDatabase/Database.h>
 #include <LibURL/Parser.h>
@@ -20,12 +21,14 @@ namespace WebView {
 
 static constexpr auto DEFAULT_AUTOCOMPLETE_SUGGESTION_LIMIT = 8uz;
 static constexpr size_t MINIMUM_TITLE_AUTOCOMPLETE_QUERY_LENGTH = 3;
+static constexpr size_t MINIMUM_INDEXED_SUBSTRING_QUERY_LENGTH = 3;
 static constexpr i32 HISTORY_DATABASE_BUSY_TIMEOUT_MS = 250;
 
 static constexpr u32 HISTORY_SCHEMA_BASELINE_VERSION = 1u;
 static constexpr u32 HISTORY_SCHEMA_RANKING_SIGNALS_VERSION = 2u;
 static constexpr u32 HISTORY_SCHEMA_OMNIBOX_ENGAGEMENTS_VERSION = 3u;
 static constexpr u32 HISTORY_SCHEMA_FAVICON_STORE_VERSION = 4u;
+static constexpr u32 HISTORY_SCHEMA_SEARCH_INDEX_VERSION = 5u;
 
 static Optional<StringView> url_without_scheme(StringView url)
 {
@@ -72,6 +75,56 @@ static StringView autocomplete_url_contains_query(StringView query)
     return query;
 }
 
+// The trigram tokenizer of the search index cannot look up substrings that are shorter than three code points.
+static bool can_use_search_index(StringView substring_query)
+{
+    return substring_query.is_empty() || Utf8View { substring_query }.length() >= MINIMUM_INDEXED_SUBSTRING_QUERY_LENGTH;
+}
+
+// A LIKE pattern that only matches strings which start with the query. Wildcards in the query are escaped, which also
+// allows SQLite to turn the pattern into a range lookup on an index.
+static String like_prefix_pattern(StringView query)
+{
+    if (query.is_empty())
+        return {};
+
+    StringBuilder builder;
+    for (auto character : query) {
+        if (character == '%' || character == '_' || character == '\\')
+            builder.append('\\');
+        builder.append(character);
+    }
+    builder.append('%');
+
+    return MUST(builder.to_string());
+}
+
+// A full-text query for the search index that matches rows whose searchable URL or title contains the given substring.
+static String search_index_query(StringView url_query, StringView title_query)
+{
+    StringBuilder builder;
+
+    auto append_substring = [&](StringView column, StringView query) {
+        if (query.is_empty())
+            return;
+        if (!builder.is_empty())
+            builder.append(" OR "sv);
+
+        builder.appendff("{} : \"", column);
+        for (auto character : query) {
+            if (character == '"')
+                builder.append('"');
+            builder.append(character);
+        }
+        builder.append('"');
+    };
+
+    append_substring("searchable_url"sv, url_query);
+    append_substring("title"sv, title_query);
+
+    return MUST(builder.to_string());
+}
+
 static bool matches_query(HistoryEntry const& entry, StringView title_query, StringView url_query)
 {
     auto searchable_url = autocomplete_searchable_url(entry.url.bytes_as_string_view());
@@ -199,6 +252,62 @@ ErrorOr<Database::MigrationOutcome> HistoryStore::migrate_schema(Database::Datab
                 ALTER TABLE History ADD COLUMN favicon_hash TEXT;
             )#"sv,
         },
+        {
+            .version = HISTORY_SCHEMA_SEARCH_INDEX_VERSION,
+            .sql = R"#(
+                ALTER TABLE History ADD COLUMN searchable_url TEXT GENERATED ALWAYS AS (
+                    CASE
+                        WHEN LOWER(SUBSTR(CASE
+                            WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
+                            ELSE url
+                        END, 1, 4)) = 'www.'
+                        THEN SUBSTR(CASE
+                            WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
+                            ELSE url
+                        END, 5)
+                        ELSE CASE
+                            WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
+                            ELSE url
+                        END
+                    END
+                ) VIRTUAL;
+
+                CREATE INDEX HistorySearchableUrlIndex
+                ON History(searchable_url COLLATE NOCASE);
+
+                -- The search index refers to History rows by their rowid, which VACUUM may renumber. It has to be
+                -- rebuilt if the table is ever vacuumed.
+                CREATE VIRTUAL TABLE HistorySearch USING fts5(
+                    searchable_url,
+                    title,
+                    content = 'History',
+                    tokenize = 'trigram'
+                );
+
+                CREATE TRIGGER HistorySearchAfterInsert AFTER INSERT ON History
+                BEGIN
+                    INSERT INTO HistorySearch (rowid, searchable_url, title)
+                    VALUES (new.rowid, new.searchable_url, new.title);
+                END;
+
+                CREATE TRIGGER HistorySearchAfterDelete AFTER DELETE ON History
+                BEGIN
+                    INSERT INTO HistorySearch (HistorySearch, rowid, searchable_url, title)
+                    VALUES ('delete', old.rowid, old.searchable_url, old.title);
+                END;
+
+                CREATE TRIGGER HistorySearchAfterUpdate AFTER UPDATE OF url, title ON History
+                WHEN old.url != new.url OR old.title != new.title
+                BEGIN
+                    INSERT INTO HistorySearch (HistorySearch, rowid, searchable_url, title)
+                    VALUES ('delete', old.rowid, old.searchable_url, old.title);
+                    INSERT INTO HistorySearch (rowid, searchable_url, title)
+                    VALUES (new.rowid, new.searchable_url, new.title);
+                END;
+
+                INSERT INTO HistorySearch (HistorySearch) VALUES ('rebuild');
+            )#"sv,
+        },
     });
 
     return database.migrate("History"sv, migrations, mode);
@@ -269,6 +378,9 @@ ErrorOr<NonnullOwnPtr<HistoryStore>> HistoryStore::create(Database::Database& da
         LEFT JOIN Favicons AS f ON f.hash = h.favicon_hash
         WHERE h.url = ?;
     )#"sv));
+    // Candidates are looked up through the searchable URL index and the full-text search index, so that neither query
+    // has to scan the whole table. The candidates are then filtered with the same case-insensitive comparisons that
+    // TransientStorage uses.
     statements.search_entries = TRY(database.prepare_statement(R"#(
         SELECT
             h.url,
@@ -297,42 +409,22 @@ ErrorOr<NonnullOwnPtr<HistoryStore>> HistoryStore::create(Database::Database& da
                 score_updated_at,
                 CASE
                     WHEN ?1 != '' AND LOWER(searchable_url) = LOWER(?1) THEN 0
-                    WHEN ?1 != '' AND LOWER(searchable_url) LIKE LOWER(?1) || '%' THEN 1
-                    WHEN ?3 != '' AND LOWER(title) LIKE LOWER(?3) || '%' THEN 2
+                    WHEN ?5 != '' AND searchable_url LIKE ?5 ESCAPE '\' THEN 1
+                    WHEN ?3 != '' AND SUBSTR(LOWER(title), 1, LENGTH(?3)) = LOWER(?3) THEN 2
                     ELSE 3
                 END AS match_rank
-            FROM (
-                SELECT
-                    url,
-                    title,
-                    visit_count,
-                    last_visited_time,
-                    favicon_hash,
-                    direct_visit_count,
-                    last_qualifying_visit_time,
-                    last_direct_visit_time,
-                    decayed_visit_score,
-                    decayed_direct_score,
-                    score_updated_at,
-                    CASE
-                        WHEN LOWER(CASE
-                            WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
-                            ELSE url
-                        END) LIKE 'www.%'
-                        THEN SUBSTR(CASE
-                            WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
-                            ELSE url
-                        END, 5)
-                        ELSE CASE
-                            WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
-                            ELSE url
-                        END
-                    END AS searchable_url
-                FROM History
-            )
-            WHERE ((?1 != '' AND LOWER(searchable_url) LIKE LOWER(?1) || '%')
-                OR (?2 != '' AND INSTR(LOWER(searchable_url), LOWER(?2)) > 0)
-                OR (?3 != '' AND INSTR(LOWER(title), LOWER(?3)) > 0))
+            FROM History
+            WHERE rowid IN (
+                    SELECT rowid
+                    FROM History
+                    WHERE ?5 != '' AND searchable_url LIKE ?5 ESCAPE '\'
+                    UNION
+                    SELECT rowid
+                    FROM HistorySearch
+                    WHERE ?6 != '' AND HistorySearch MATCH ?6)
+                AND ((?5 != '' AND searchable_url LIKE ?5 ESCAPE '\')
+                    OR (?2 != '' AND INSTR(LOWER(searchable_url), LOWER(?2)) > 0)
+                    OR (?3 != '' AND INSTR(LOWER(title), LOWER(?3)) > 0))
             ORDER BY
                 match_rank,
                 direct_visit_count DESC,
@@ -379,35 +471,7 @@ ErrorOr<NonnullOwnPtr<HistoryStore>> HistoryStore::create(Database::Database& da
                 decayed_visit_score,
                 decayed_direct_score,
                 score_updated_at
-            FROM (
-                SELECT
-                    url,
-                    title,
-                    visit_count,
-                    last_visited_time,
-                    favicon_hash,
-                    direct_visit_count,
-                    last_qualifying_visit_time,
-                    last_direct_visit_time,
-                    decayed_visit_score,
-                    decayed_direct_score,
-                    score_updated_at,
-                    CASE
-                        WHEN LOWER(CASE
-                            WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
-                            ELSE url
-                        END) LIKE 'www.%'
-                        THEN SUBSTR(CASE
-                            WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
-                            ELSE url
-                        END, 5)
-                        ELSE CASE
-                            WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
-                            ELSE url
-                        END
-                    END AS searchable_url
-                FROM History
-            )
+            FROM History
             WHERE ((?1 = '' AND ?2 = '')
                 OR (?1 != '' AND INSTR(LOWER(title), LOWER(?1)) > 0)
                 OR (?2 != '' AND INSTR(LOWER(searchable_url), LOWER(?2)) > 0))
@@ -417,6 +481,45 @@ ErrorOr<NonnullOwnPtr<HistoryStore>> HistoryStore::create(Database::Database& da
         LEFT JOIN Favicons AS f ON f.hash = h.favicon_hash
         ORDER BY h.last_visited_time DESC, h.url ASC;
     )#"sv));
+    statements.search_list_entries = TRY(database.prepare_statement(R"#(
+        SELECT
+            h.url,
+            h.title,
+            h.visit_count,
+            h.last_visited_time,
+            f.png_data,
+            h.direct_visit_count,
+            h.last_qualifying_visit_time,
+            h.last_direct_visit_time,
+            h.decayed_visit_score,
+            h.decayed_direct_score,
+            h.score_updated_at
+        FROM (
+            SELECT
+                url,
+                title,
+                visit_count,
+                last_visited_time,
+                favicon_hash,
+                direct_visit_count,
+                last_qualifying_visit_time,
+                last_direct_visit_time,
+                decayed_visit_score,
+                decayed_direct_score,
+                score_updated_at
+            FROM History
+            WHERE rowid IN (
+                    SELECT rowid
+                    FROM HistorySearch
+                    WHERE HistorySearch MATCH ?5)
+                AND ((?1 != '' AND INSTR(LOWER(title), LOWER(?1)) > 0)
+                    OR (?2 != '' AND INSTR(LOWER(searchable_url), LOWER(?2)) > 0))
+            ORDER BY last_visited_time DESC, url ASC
+            LIMIT ?3 OFFSET ?4
+        ) AS h
+        LEFT JOIN Favicons AS f ON f.hash = h.favicon_hash
+        ORDER BY h.last_visited_time DESC, h.url ASC;
+    )#"sv));
     statements.referenced_favicon_hashes = TRY(database.prepare_statement(R"#(
         SELECT DISTINCT favicon_hash
         FROM History
@@ -1079,7 +1182,8 @@ Vector<HistoryEntry> HistoryStore::PersistedStorage::autocomplete_entries(String
     entries.ensure_capacity(min(limit, DEFAULT_AUTOCOMPLETE_SUGGESTION_LIMIT));
     auto url_query_string = MUST(String::from_utf8(url_query));
     auto title_query_string = MUST(String::from_utf8(title_query));
-    auto url_contains_query_string = MUST(String::from_utf8(autocomplete_url_contains_query(url_query)));
+    auto url_contains_query = autocomplete_url_contains_query(url_query);
+    auto url_contains_query_string = MUST(String::from_utf8(url_contains_query));
 
     auto outcome = m_database.execute_interruptible_statement(
         m_statements.search_entries,
@@ -1109,7 +1213,9 @@ Vector<HistoryEntry> HistoryStore::PersistedStorage::autocomplete_entries(String
         url_query_string,
         url_contains_query_string,
         title_query_string,
-        static_cast<i64>(limit));
+        static_cast<i64>(limit),
+        like_prefix_pattern(url_query),
+        search_index_query(url_contains_query, title_query));
 
     if (outcome == Database::Database::StatementExecutionOutcome::Interrupted)
         entries.clear();
@@ -1124,35 +1230,48 @@ Vector<HistoryEntry> HistoryStore::PersistedStorage::list_entries(StringView tit
     auto title_query_string = MUST(String::from_utf8(title_query));
     auto url_query_string = MUST(String::from_utf8(url_query));
 
-    m_database.execute_statement(
-        m_statements.list_entries,
-        [&](auto statement_id) -> ErrorOr<void> {
-            auto title = m_database.result_column<String>(statement_id, 1);
-            auto visit_count = m_database.result_column<i64>(statement_id, 2);
-            auto favicon_png = m_database.result_column<ByteBuffer>(statement_id, 4);
-            auto direct_visit_count = m_database.result_column<i64>(statement_id, 5);
-            if (visit_count < 0 || direct_visit_count < 0)
-                return {};
-
-            entries.append(HistoryEntry {
-                .url = m_database.result_column<String>(statement_id, 0),
-                .title = title.is_empty() ? Optional<String> {} : Optional<String> { move(title) },
-                .favicon_png = favicon_png.is_empty() ? OptionalNone {} : Optional<ByteBuffer> { move(favicon_png) },
-                .visit_count = visit_count,
-                .direct_visit_count = direct_visit_count,
-                .last_visited_time = m_database.result_column<UnixDateTime>(statement_id, 3),
-                .last_qualifying_visit_time = m_database.result_column<UnixDateTime>(statement_id, 6),
-                .last_direct_visit_time = m_database.result_column<UnixDateTime>(statement_id, 7),
-                .decayed_visit_score = m_database.result_column<double>(statement_id, 8),
-                .decayed_direct_score = m_database.result_column<double>(statement_id, 9),
-                .score_updated_at = m_database.result_column<UnixDateTime>(statement_id, 10),
-            });
+    auto on_result = [&](auto statement_id) -> ErrorOr<void> {
+        auto title = m_database.result_column<String>(statement_id, 1);
+        auto visit_count = m_database.result_column<i64>(statement_id, 2);
+        auto favicon_png = m_database.result_column<ByteBuffer>(statement_id, 4);
+        auto direct_visit_count = m_database.result_column<i64>(statement_id, 5);
+        if (visit_count < 0 || direct_visit_count < 0)
             return {};
-        },
-        title_query_string,
-        url_query_string,
-        static_cast<i64>(limit),
-        static_cast<i64>(offset));
+
+        entries.append(HistoryEntry {
+            .url = m_database.result_column<String>(statement_id, 0),
+            .title = title.is_empty() ? Optional<String> {} : Optional<String> { move(title) },
+            .favicon_png = favicon_png.is_empty() ? OptionalNone {} : Optional<ByteBuffer> { move(favicon_png) },
+            .visit_count = visit_count,
+            .direct_visit_count = direct_visit_count,
+            .last_visited_time = m_database.result_column<UnixDateTime>(statement_id, 3),
+            .last_qualifying_visit_time = m_database.result_column<UnixDateTime>(statement_id, 6),
+            .last_direct_visit_time = m_database.result_column<UnixDateTime>(statement_id, 7),
+            .decayed_visit_score = m_database.result_column<double>(statement_id, 8),
+            .decayed_direct_score = m_database.result_column<double>(statement_id, 9),
+            .score_updated_at = m_database.result_column<UnixDateTime>(statement_id, 10),
+        });
+        return {};
+    };
+
+    if (can_use_search_index(title_query) && can_use_search_index(url_query) && (!title_query.is_empty() || !url_query.is_empty())) {
+        m_database.execute_statement(
+            m_statements.search_list_entries,
+            on_result,
+            title_query_string,
+            url_query_string,
+            static_cast<i64>(limit),
+            static_cast<i64>(offset),
+            search_index_query(url_query, title_query));
+    } else {
+        m_database.execute_statement(
+            m_statements.list_entries,
+            on_result,
+            title_query_string,
+            url_query_string,
+            static_cast<i64>(limit),
+            static_cast<i64>(offset));
+    }
 
     return entries;
 }
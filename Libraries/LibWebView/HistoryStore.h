@@ -79,6 +79,7 @@ private:
         Database::StatementID get_entry { 0 };
         Database::StatementID search_entries { 0 };
         Database::StatementID list_entries { 0 };
+        Database::StatementID search_list_entries { 0 };
         Database::StatementID referenced_favicon_hashes { 0 };
         Database::StatementID delete_entry { 0 };
         Database::StatementID delete_entries_accessed_since { 0 };
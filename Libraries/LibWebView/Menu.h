@@ -122,6 +122,7 @@ enum class ActionID {
     CollectGarbage,
     CrashCurrentPage,
     CrashCompositorProcess,
+    RecordTrace,
     SpoofUserAgent,
     NavigatorCompatibilityMode,
     EnableScripting,
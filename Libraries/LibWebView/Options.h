@@ -108,6 +108,10 @@ struct RequestServerOptions {
     ByteString cache_path;
     HTTPDiskCacheMode http_disk_cache_mode { HTTPDiskCacheMode::Disabled };
     Optional<ByteString> resource_substitution_map_path;
+    Optional<ByteString> record_archive_path;
+    Optional<ByteString> replay_archive_path;
+    Optional<u64> replay_latency_ms;
+    Optional<u64> replay_bandwidth;
 };
 
 enum class IsTestMode {
@@ -6,6 +6,7 @@
  */
 
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibImageDecoderClient/Client.h>
 #include <LibWebView/Plugins/ImageCodecPlugin.h>
 #include <LibWebView/Utilities.h>
@@ -28,6 +29,11 @@ void ImageCodecPlugin::setup_client_callbacks()
 {
     m_client->on_death = [this] {
         m_client = nullptr;
+        m_partial_image_callbacks.clear();
+    };
+    m_client->on_progressive_frame_decoded = [this](i64 request_id, Gfx::IntSize natural_size, NonnullRefPtr<Gfx::Bitmap> bitmap) {
+        if (auto it = m_partial_image_callbacks.find(request_id); it != m_partial_image_callbacks.end())
+            it->value(natural_size, move(bitmap));
     };
     m_client->on_animation_frames_decoded = [this](i64 session_id, Vector<NonnullRefPtr<Gfx::Bitmap>> bitmaps) {
         if (on_animation_frames_decoded)
@@ -41,7 +47,24 @@ void ImageCodecPlugin::setup_client_callbacks()
 
 ImageCodecPlugin::~ImageCodecPlugin() = default;
 
-NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+static Web::Platform::DecodedImage to_platform_decoded_image(ImageDecoderClient::DecodedImage& result)
+{
+    // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
+    Web::Platform::DecodedImage decoded_image;
+    decoded_image.is_animated = result.is_animated;
+    decoded_image.natural_size = result.natural_size;
+    decoded_image.loop_count = result.loop_count;
+    decoded_image.frame_count = result.frame_count;
+    decoded_image.session_id = result.session_id;
+    decoded_image.all_durations = move(result.all_durations);
+    for (auto& frame : result.frames) {
+        decoded_image.frames.empend(move(frame.bitmap), frame.duration);
+    }
+    decoded_image.color_space = move(result.color_space);
+    return decoded_image;
+}
+
+NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size)
 {
     auto promise = Core::Promise<Web::Platform::DecodedImage>::construct();
     if (on_resolved)
@@ -57,18 +80,63 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
     auto image_decoder_promise = m_client->decode_image(
         bytes,
         [promise](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
-            // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
-            Web::Platform::DecodedImage decoded_image;
-            decoded_image.is_animated = result.is_animated;
-            decoded_image.loop_count = result.loop_count;
-            decoded_image.frame_count = result.frame_count;
-            decoded_image.session_id = result.session_id;
-            decoded_image.all_durations = move(result.all_durations);
-            for (auto& frame : result.frames) {
-                decoded_image.frames.empend(move(frame.bitmap), frame.duration);
-            }
-            decoded_image.color_space = move(result.color_space);
-            promise->resolve(move(decoded_image));
+            promise->resolve(to_platform_decoded_image(result));
+            return {};
+        },
+        [promise](auto& error) {
+            promise->reject(Error::copy(error));
+        },
+        ideal_size);
+
+    return promise;
+}
+
+Optional<Web::Platform::DecodedImage> ImageCodecPlugin::decode_first_frame_synchronously(ReadonlyBytes bytes)
+{
+    if (!m_client)
+        return {};
+
+    auto result = m_client->decode_first_frame_synchronously(bytes);
+    if (!result.has_value())
+        return {};
+    return to_platform_decoded_image(*result);
+}
+
+Optional<i64> ImageCodecPlugin::begin_progressive_decode(StringView mime_type, Optional<Gfx::IntSize> ideal_size, Function<void(Gfx::IntSize, NonnullRefPtr<Gfx::Bitmap>)> on_partial_image)
+{
+    if (!m_client || !Gfx::ProgressiveImageDecoder::can_decode_mime_type(mime_type))
+        return {};
+
+    auto request_id = m_client->begin_progressive_decode(ideal_size, ByteString { mime_type });
+    m_partial_image_callbacks.set(request_id, move(on_partial_image));
+    return request_id;
+}
+
+void ImageCodecPlugin::append_progressive_decode_data(i64 id, ReadonlyBytes bytes)
+{
+    if (m_client)
+        m_client->append_progressive_decode_data(id, bytes);
+}
+
+NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::finish_progressive_decode(i64 id, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+{
+    m_partial_image_callbacks.remove(id);
+
+    auto promise = Core::Promise<Web::Platform::DecodedImage>::construct();
+    if (on_resolved)
+        promise->on_resolution = move(on_resolved);
+    if (on_rejected)
+        promise->on_rejection = move(on_rejected);
+
+    if (!m_client) {
+        promise->reject(Error::from_string_literal("ImageDecoderClient is disconnected"));
+        return promise;
+    }
+
+    (void)m_client->finish_progressive_decode(
+        id,
+        [promise](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
+            promise->resolve(to_platform_decoded_image(result));
             return {};
         },
         [promise](auto& error) {
@@ -78,6 +146,13 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
     return promise;
 }
 
+void ImageCodecPlugin::cancel_progressive_decode(i64 id)
+{
+    m_partial_image_callbacks.remove(id);
+    if (m_client)
+        m_client->cancel_progressive_decode(id);
+}
+
 void ImageCodecPlugin::request_animation_frames(i64 session_id, u32 start_frame_index, u32 count)
 {
     if (m_client)
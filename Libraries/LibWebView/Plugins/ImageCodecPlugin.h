@@ -18,7 +18,14 @@ public:
     explicit ImageCodecPlugin(NonnullRefPtr<ImageDecoderClient::Client>);
     virtual ~ImageCodecPlugin() override;
 
-    virtual NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected) override;
+    virtual NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size) override;
+
+    virtual Optional<Web::Platform::DecodedImage> decode_first_frame_synchronously(ReadonlyBytes) override;
+
+    virtual Optional<i64> begin_progressive_decode(StringView mime_type, Optional<Gfx::IntSize> ideal_size, Function<void(Gfx::IntSize natural_size, NonnullRefPtr<Gfx::Bitmap>)> on_partial_image) override;
+    virtual void append_progressive_decode_data(i64 id, ReadonlyBytes) override;
+    virtual NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> finish_progressive_decode(i64 id, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected) override;
+    virtual void cancel_progressive_decode(i64 id) override;
 
     virtual void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count) override;
     virtual void stop_animation_decode(i64 session_id) override;
@@ -29,6 +36,7 @@ private:
     void setup_client_callbacks();
 
     RefPtr<ImageDecoderClient::Client> m_client;
+    HashMap<i64, Function<void(Gfx::IntSize, NonnullRefPtr<Gfx::Bitmap>)>> m_partial_image_callbacks;
 };
 
 }
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/Tracing.h>
+#include <LibWebView/CompositorClient.h>
+#include <LibWebView/TraceCollector.h>
+#include <LibWebView/WebContentClient.h>
+
+namespace WebView {
+
+ProcessTrace PendingTraceRequest::resolve(Core::AnonymousBuffer const& events, i64 monotonic_time_in_nanoseconds) const
+{
+    auto round_trip_time = MonotonicTime::now() - requested_at;
+    auto estimated_time = requested_at + AK::Duration::from_nanoseconds(round_trip_time.to_nanoseconds() / 2);
+    auto clock_offset = AK::Duration::from_nanoseconds(estimated_time.nanoseconds() - monotonic_time_in_nanoseconds);
+
+    ProcessTrace trace { .clock_offset = clock_offset };
+    if (events.is_valid())
+        trace.events = MUST(ByteBuffer::copy(events.bytes()));
+    return trace;
+}
+
+NonnullRefPtr<TraceCollector> TraceCollector::create()
+{
+    return adopt_ref(*new TraceCollector);
+}
+
+void TraceCollector::collect(CompositorClient* compositor_client)
+{
+    auto self = NonnullRefPtr { *this };
+
+    // Count every request before sending any of them, so that a process answering right away cannot complete the
+    // trace early.
+    Vector<NonnullRefPtr<Core::Promise<ProcessTrace>>> promises;
+    WebContentClient::for_each_client([&](WebContentClient& client) {
+        promises.append(client.collect_trace());
+        return IterationDecision::Continue;
+    });
+    if (compositor_client)
+        promises.append(compositor_client->collect_trace());
+
+    m_pending_requests = promises.size() + 1;
+
+    for (auto& promise : promises) {
+        promise->when_resolved([self](ProcessTrace const& trace) {
+            self->did_receive_trace(trace);
+            self->did_finish_request();
+        });
+        promise->when_rejected([self](auto const&) {
+            self->did_finish_request();
+        });
+    }
+
+    auto events = MUST(Core::Tracing::take_serialized_events("Browser"sv));
+    did_receive_trace({ .events = move(events), .clock_offset = {} });
+    did_finish_request();
+}
+
+void TraceCollector::did_receive_trace(ProcessTrace const& trace)
+{
+    auto events = JsonValue::from_string(trace.events);
+    if (events.is_error() || !events.value().is_array()) {
+        warnln("Unable to parse trace events of a process");
+        return;
+    }
+
+    auto clock_offset_in_microseconds = static_cast<double>(trace.clock_offset.to_nanoseconds()) / 1000.0;
+
+    for (auto& event : events.value().as_array().values()) {
+        if (!event.is_object())
+            continue;
+
+        auto& object = event.as_object();
+        if (auto timestamp = object.get_double_with_precision_loss("ts"sv); timestamp.has_value())
+            object.set("ts"sv, *timestamp + clock_offset_in_microseconds);
+
+        m_trace_events.must_append(move(event));
+    }
+}
+
+void TraceCollector::did_finish_request()
+{
+    VERIFY(m_pending_requests > 0);
+    if (--m_pending_requests > 0)
+        return;
+
+    auto result = write_trace_file();
+    m_trace_events = {};
+
+    if (on_complete)
+        on_complete(move(result));
+}
+
+ErrorOr<LexicalPath> TraceCollector::write_trace_file() const
+{
+    LexicalPath path { Core::StandardPaths::tempfile_directory() };
+    path = path.append(TRY(AK::UnixDateTime::now().to_string("trace-%Y-%m-%d-%H-%M-%S.json"sv)));
+
+    JsonObject trace;
+    trace.set("traceEvents"sv, m_trace_events);
+    trace.set("displayTimeUnit"sv, "ms"sv);
+
+    auto trace_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+    TRY(trace_file->write_until_depleted(trace.serialized().bytes()));
+
+    return path;
+}
+
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Function.h>
+#include <AK/JsonArray.h>
+#include <AK/LexicalPath.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/Time.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibCore/Promise.h>
+#include <LibWebView/Forward.h>
+
+namespace WebView {
+
+// The trace events that another process recorded, and the offset that converts its monotonic clock to ours.
+struct ProcessTrace {
+    ByteBuffer events;
+    AK::Duration clock_offset;
+};
+
+struct PendingTraceRequest {
+    // The process's clock is assumed to have been read halfway between sending the request and receiving the reply.
+    ProcessTrace resolve(Core::AnonymousBuffer const& events, i64 monotonic_time_in_nanoseconds) const;
+
+    NonnullRefPtr<Core::Promise<ProcessTrace>> promise;
+    MonotonicTime requested_at;
+};
+
+// Collects the trace events of every process, and writes them to a single file that chrome://tracing and Perfetto can
+// load.
+class WEBVIEW_API TraceCollector : public RefCounted<TraceCollector> {
+public:
+    static NonnullRefPtr<TraceCollector> create();
+
+    void collect(CompositorClient*);
+
+    Function<void(ErrorOr<LexicalPath>)> on_complete;
+
+private:
+    TraceCollector() = default;
+
+    void did_receive_trace(ProcessTrace const&);
+    void did_finish_request();
+
+    ErrorOr<LexicalPath> write_trace_file() const;
+
+    JsonArray m_trace_events;
+    size_t m_pending_requests { 0 };
+};
+
+}
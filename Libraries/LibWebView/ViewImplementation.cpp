@@ -272,7 +272,7 @@ void ViewImplementation::replace_web_content_process_for_history_traversal(Web::
     fail_webdriver_content_commands_after_process_replacement(pending_webdriver_crash_command_ids);
 }
 
-void ViewImplementation::server_did_paint(Badge<WebContentClient>, i32 bitmap_id, Gfx::IntSize size, Gfx::IntRect damage_rect)
+void ViewImplementation::server_did_paint(Badge<WebContentClient>, i32 bitmap_id, Gfx::IntSize size, Gfx::IntRect damage_rect, Web::Compositor::PresentTimings timings)
 {
     bool did_swap_bitmap = false;
     auto previous_front_bitmap_id = m_client_state.front_bitmap.id;
@@ -294,6 +294,8 @@ void ViewImplementation::server_did_paint(Badge<WebContentClient>, i32 bitmap_id
 
     if (did_swap_bitmap)
         did_accept_presented_backing_store(bitmap_id, damage_rect);
+    if (did_swap_bitmap && on_present_frame)
+        on_present_frame(timings);
     if (did_swap_bitmap && on_ready_to_paint)
         on_ready_to_paint();
 }
@@ -2955,6 +2957,32 @@ void ViewImplementation::did_receive_internal_page_info(Badge<WebContentClient>,
     m_pending_info_request = nullptr;
 }
 
+NonnullRefPtr<Core::Promise<Web::PageLoadTimings>> ViewImplementation::request_page_load_timings()
+{
+    auto promise = Core::Promise<Web::PageLoadTimings>::construct();
+
+    if (m_pending_page_load_timings_request) {
+        promise->reject(Error::from_string_literal("A page load timings request is already in progress"));
+        return promise;
+    }
+
+    m_pending_page_load_timings_request = promise;
+    client().async_request_page_load_timings(page_id());
+
+    return promise;
+}
+
+void ViewImplementation::did_receive_page_load_timings(Badge<WebContentClient>, Optional<Web::PageLoadTimings> timings)
+{
+    VERIFY(m_pending_page_load_timings_request);
+
+    if (timings.has_value())
+        m_pending_page_load_timings_request->resolve(timings.release_value());
+    else
+        m_pending_page_load_timings_request->reject(Error::from_string_literal("The page no longer exists"));
+    m_pending_page_load_timings_request = nullptr;
+}
+
 ErrorOr<LexicalPath> ViewImplementation::dump_gc_graph()
 {
     auto promise = request_internal_page_info(PageInfoType::GCGraph);
@@ -82,6 +82,9 @@ WebContentClient::WebContentClient(NonnullOwnPtr<IPC::Transport> transport, IsPr
 {
     VERIFY(m_initial_page_id > 0);
     clients().set(this);
+
+    // Input events and other page controls are small, but arrive in bursts.
+    enable_shared_memory_ring(256 * KiB);
 }
 
 WebContentClient::~WebContentClient()
@@ -108,6 +111,14 @@ Optional<WebContentClient&> WebContentClient::client_for_compositor_context_id(W
 void WebContentClient::die()
 {
     fail_renderer_owned_downloads();
+
+    auto pending_ipc_statistics_requests = move(m_pending_ipc_statistics_requests);
+    for (auto& it : pending_ipc_statistics_requests)
+        it.value->reject(Error::from_string_literal("WebContent process exited"));
+
+    auto pending_trace_requests = move(m_pending_trace_requests);
+    for (auto& it : pending_trace_requests)
+        it.value.promise->reject(Error::from_string_literal("WebContent process exited"));
 }
 
 Web::Compositor::CompositorContextId WebContentClient::compositor_context_id_for_page(u64 page_id)
@@ -475,12 +486,12 @@ void WebContentClient::notify_presented_bitmap_ready_to_paint(u64 page_id, i32 b
     Application::the().notify_compositor_presented_bitmap_ready_to_paint(context_id, bitmap_id);
 }
 
-void WebContentClient::did_present_bitmap(u64 page_id, Gfx::IntRect rect, Gfx::IntRect damage_rect, i32 bitmap_id)
+void WebContentClient::did_present_bitmap(u64 page_id, Gfx::IntRect rect, Gfx::IntRect damage_rect, i32 bitmap_id, Web::Compositor::PresentTimings timings)
 {
     dbgln_if(COMPOSITOR_DEBUG, "[Compositor] UI compositor IPC did_paint for page {} bitmap {} rect={}x{} at {},{}",
         page_id, bitmap_id, rect.width(), rect.height(), rect.x(), rect.y());
     if (auto view = view_for_page_id(page_id); view.has_value()) {
-        view->server_did_paint({}, bitmap_id, rect.size(), damage_rect);
+        view->server_did_paint({}, bitmap_id, rect.size(), damage_rect, timings);
     } else {
         dbgln_if(COMPOSITOR_DEBUG, "[Compositor] UI dropping did_paint for page {} bitmap {}: no view",
             page_id, bitmap_id);
@@ -1176,6 +1187,51 @@ void WebContentClient::did_get_internal_page_info(u64 page_id, WebView::PageInfo
         view->did_receive_internal_page_info({}, type, info);
 }
 
+void WebContentClient::did_get_page_load_timings(u64 page_id, Optional<Web::PageLoadTimings> timings)
+{
+    if (auto view = view_for_page_id(page_id); view.has_value())
+        view->did_receive_page_load_timings({}, move(timings));
+}
+
+NonnullRefPtr<Core::Promise<String>> WebContentClient::request_ipc_statistics()
+{
+    auto promise = Core::Promise<String>::construct();
+    auto request_id = m_next_ipc_statistics_request_id++;
+
+    m_pending_ipc_statistics_requests.set(request_id, promise);
+    async_request_ipc_statistics(request_id);
+
+    return promise;
+}
+
+void WebContentClient::did_get_ipc_statistics(u64 request_id, String statistics)
+{
+    if (auto promise = m_pending_ipc_statistics_requests.take(request_id); promise.has_value())
+        (*promise)->resolve(move(statistics));
+}
+
+NonnullRefPtr<Core::Promise<ProcessTrace>> WebContentClient::collect_trace()
+{
+    auto promise = Core::Promise<ProcessTrace>::construct();
+    auto request_id = m_next_trace_request_id++;
+
+    m_pending_trace_requests.set(request_id, { promise, MonotonicTime::now() });
+    async_collect_trace(request_id);
+
+    return promise;
+}
+
+void WebContentClient::did_collect_trace(u64 request_id, Core::AnonymousBuffer events, i64 monotonic_time_in_nanoseconds)
+{
+    if (auto request = m_pending_trace_requests.take(request_id); request.has_value())
+        request->promise->resolve(request->resolve(events, monotonic_time_in_nanoseconds));
+}
+
+void WebContentClient::did_release_memory(Core::MemoryPressure::Level level, u64 bytes_released)
+{
+    Application::the().did_release_memory_in_process(ProcessType::WebContent, level, bytes_released);
+}
+
 void WebContentClient::did_execute_js_console_input(u64 page_id, JsonValue result)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
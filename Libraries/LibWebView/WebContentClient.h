@@ -15,6 +15,7 @@
 #include <AK/StringView.h>
 #include <AK/WeakPtr.h>
 #include <LibCore/Forward.h>
+#include <LibCore/Promise.h>
 #include <LibGfx/Point.h>
 #include <LibGfx/SharedImage.h>
 #include <LibHTTP/Header.h>
@@ -50,6 +51,7 @@
 #include <LibWeb/StorageAPI/StorageEndpoint.h>
 #include <LibWebView/Forward.h>
 #include <LibWebView/PrivateBrowsing.h>
+#include <LibWebView/TraceCollector.h>
 #include <WebContent/WebContentClientEndpoint.h>
 #include <WebContent/WebContentServerEndpoint.h>
 
@@ -111,11 +113,17 @@ public:
     void dispatch_mouse_event_to_web_content(u64 page_id, Web::MouseEvent const&);
     void notify_presented_bitmap_ready_to_paint(u64 page_id, i32 bitmap_id);
     void did_present_backing_stores(u64 page_id, Vector<i32> bitmap_ids, Vector<Gfx::SharedImage> backing_stores);
-    void did_present_bitmap(u64 page_id, Gfx::IntRect content_rect, Gfx::IntRect damage_rect, i32 bitmap_id);
+    void did_present_bitmap(u64 page_id, Gfx::IntRect content_rect, Gfx::IntRect damage_rect, i32 bitmap_id, Web::Compositor::PresentTimings);
 
     pid_t pid() const { return m_process_handle.pid; }
     void set_pid(pid_t pid) { m_process_handle.pid = pid; }
 
+    // Resolves to the serialized IPC::MessageStatistics snapshot of the WebContent process.
+    NonnullRefPtr<Core::Promise<String>> request_ipc_statistics();
+
+    // Resolves to the trace events that the WebContent process recorded since they were last collected.
+    NonnullRefPtr<Core::Promise<ProcessTrace>> collect_trace();
+
 private:
     friend class SiteIsolationManager;
 
@@ -182,6 +190,10 @@ private:
     virtual void did_resolve_dom_node_url(u64 page_id, u64 request_id, String resolved_url) override;
     virtual void did_take_screenshot(u64 page_id, Gfx::ShareableBitmap screenshot) override;
     virtual void did_get_internal_page_info(u64 page_id, PageInfoType, Optional<Core::AnonymousBuffer>) override;
+    virtual void did_get_page_load_timings(u64 page_id, Optional<Web::PageLoadTimings>) override;
+    virtual void did_get_ipc_statistics(u64 request_id, String statistics) override;
+    virtual void did_collect_trace(u64 request_id, Core::AnonymousBuffer events, i64 monotonic_time_in_nanoseconds) override;
+    virtual void did_release_memory(Core::MemoryPressure::Level, u64 bytes_released) override;
     virtual void did_execute_js_console_input(u64 page_id, JsonValue) override;
     virtual void did_output_js_console_message(u64 page_id, ConsoleOutput) override;
     virtual void did_start_network_request(u64 page_id, u64 request_id, URL::URL, ByteString method, Vector<HTTP::Header>, ByteBuffer request_body, Optional<String> initiator_type, String referrer_policy, bool is_navigation_request, Web::Fetch::Infrastructure::Request::Priority) override;
@@ -291,6 +303,10 @@ private:
     HashMap<Web::Compositor::CompositorContextId, Optional<u64>> m_compositor_contexts;
     HashMap<u64, u64> m_renderer_owned_downloads;
     HashMap<u64, String> m_history_recorded_urls_for_current_load;
+    HashMap<u64, NonnullRefPtr<Core::Promise<String>>> m_pending_ipc_statistics_requests;
+    u64 m_next_ipc_statistics_request_id { 0 };
+    HashMap<u64, PendingTraceRequest> m_pending_trace_requests;
+    u64 m_next_trace_request_id { 0 };
     Optional<i32> m_compositor_connection_id;
     u64 m_initial_page_id { 0 };
     Web::HTML::CrossProcessId m_root_navigable_id;
@@ -4,9 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/System.h>
+#include <LibIPC/MessageStatistics.h>
 #include <LibWebView/Application.h>
 #include <LibWebView/ProcessManager.h>
 #include <LibWebView/SiteIsolationManager.h>
+#include <LibWebView/WebContentClient.h>
 #include <LibWebView/WebUI/ProcessesUI.h>
 
 #include <AK/JsonArray.h>
@@ -20,6 +23,19 @@ void ProcessesUI::register_interfaces()
     register_interface("updateProcessStatistics"sv, [this](auto const&) {
         update_process_statistics();
     });
+    register_interface("updateIPCStatistics"sv, [this](auto const&) {
+        update_ipc_statistics();
+    });
+}
+
+static String display_name_for_process(Process const& process)
+{
+    auto type = process_name_from_type(process.type());
+    auto const& title = process.title();
+
+    return title.has_value()
+        ? MUST(String::formatted("{} - {}", type, *title))
+        : MUST(String::from_utf8(type.bytes()));
 }
 
 void ProcessesUI::update_process_statistics()
@@ -32,15 +48,8 @@ void ProcessesUI::update_process_statistics()
         JsonArray serialized;
 
         process_manager.for_each_process_statistics([&](auto& process, auto const& statistics) {
-            auto type = process_name_from_type(process.type());
-            auto const& title = process.title();
-
-            auto process_name = title.has_value()
-                ? MUST(String::formatted("{} - {}", type, *title))
-                : MUST(String::from_utf8(type.bytes()));
-
             JsonObject object;
-            object.set("name"sv, move(process_name));
+            object.set("name"sv, display_name_for_process(process));
             object.set("pid"sv, statistics.pid);
             object.set("cpu"sv, statistics.cpu_percent);
             object.set("memory"sv, statistics.memory_usage_bytes);
@@ -55,4 +64,93 @@ void ProcessesUI::update_process_statistics()
     async_send_message("loadProcessStatistics"sv, serialize_process_statistics());
 }
 
+// A process that is stuck or has gone away never answers, so a snapshot is sent without it after this long.
+static constexpr int IPC_STATISTICS_TIMEOUT_MS = 1000;
+
+void ProcessesUI::update_ipc_statistics()
+{
+    // A snapshot is still being collected, it will be sent once every process has answered or it has timed out.
+    if (m_pending_ipc_statistics_requests > 0)
+        return;
+
+    auto snapshot_id = ++m_ipc_statistics_snapshot_id;
+    m_ipc_statistics = {};
+    did_receive_ipc_statistics(Core::System::getpid(), "Browser"_string, IPC::MessageStatistics::snapshot());
+
+    // Count every request before sending any of them, so that a process answering right away cannot complete the
+    // snapshot early.
+    Vector<NonnullRefPtr<WebContentClient>> clients;
+    WebContentClient::for_each_client([&](WebContentClient& client) {
+        clients.append(client);
+        return IterationDecision::Continue;
+    });
+    m_pending_ipc_statistics_requests = clients.size() + 1;
+
+    if (!m_ipc_statistics_timeout) {
+        m_ipc_statistics_timeout = Core::Timer::create_single_shot(IPC_STATISTICS_TIMEOUT_MS, [weak_this = make_weak_ptr<ProcessesUI>()] {
+            if (weak_this)
+                weak_this->send_ipc_statistics();
+        });
+    }
+    m_ipc_statistics_timeout->restart();
+
+    for (auto& client : clients) {
+        auto pid = client->pid();
+        auto name = "WebContent"_string;
+        if (auto process = Application::process_manager().find_process(pid); process.has_value())
+            name = display_name_for_process(*process);
+
+        auto promise = client->request_ipc_statistics();
+        promise->when_resolved([weak_this = make_weak_ptr<ProcessesUI>(), snapshot_id, pid, name](String const& statistics) {
+            if (!weak_this || weak_this->m_ipc_statistics_snapshot_id != snapshot_id)
+                return;
+            if (auto endpoints = JsonValue::from_string(statistics); !endpoints.is_error())
+                weak_this->did_receive_ipc_statistics(pid, name, endpoints.release_value());
+            weak_this->did_finish_ipc_statistics_request(snapshot_id);
+        });
+        promise->when_rejected([weak_this = make_weak_ptr<ProcessesUI>(), snapshot_id](auto const&) {
+            if (weak_this)
+                weak_this->did_finish_ipc_statistics_request(snapshot_id);
+        });
+    }
+
+    did_finish_ipc_statistics_request(snapshot_id);
+}
+
+void ProcessesUI::did_receive_ipc_statistics(pid_t pid, String name, JsonValue endpoints)
+{
+    if (!endpoints.is_array())
+        return;
+
+    JsonObject object;
+    object.set("pid"sv, pid);
+    object.set("name"sv, move(name));
+    object.set("endpoints"sv, move(endpoints));
+    m_ipc_statistics.must_append(move(object));
+}
+
+void ProcessesUI::did_finish_ipc_statistics_request(u64 snapshot_id)
+{
+    // NB: Answers to a snapshot that has already been sent are dropped.
+    if (snapshot_id != m_ipc_statistics_snapshot_id || m_pending_ipc_statistics_requests == 0)
+        return;
+    if (--m_pending_ipc_statistics_requests > 0)
+        return;
+
+    send_ipc_statistics();
+}
+
+void ProcessesUI::send_ipc_statistics()
+{
+    if (m_ipc_statistics_timeout)
+        m_ipc_statistics_timeout->stop();
+
+    // NB: Invalidates the answers still outstanding, so that they can't be counted towards the next snapshot.
+    ++m_ipc_statistics_snapshot_id;
+    m_pending_ipc_statistics_requests = 0;
+
+    async_send_message("loadIPCStatistics"sv, move(m_ipc_statistics));
+    m_ipc_statistics = {};
+}
+
 }
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/JsonArray.h>
+#include <LibCore/Timer.h>
 #include <LibWebView/Forward.h>
 #include <LibWebView/WebUI.h>
 
@@ -18,6 +20,16 @@ private:
     virtual void register_interfaces() override;
 
     void update_process_statistics();
+
+    void update_ipc_statistics();
+    void did_receive_ipc_statistics(pid_t, String name, JsonValue endpoints);
+    void did_finish_ipc_statistics_request(u64 snapshot_id);
+    void send_ipc_statistics();
+
+    JsonArray m_ipc_statistics;
+    size_t m_pending_ipc_statistics_requests { 0 };
+    u64 m_ipc_statistics_snapshot_id { 0 };
+    RefPtr<Core::Timer> m_ipc_statistics_timeout;
 };
 
 }
@@ -76,6 +76,11 @@ void WebWorkerClient::did_post_broadcast_channel_message(Web::HTML::BroadcastCha
     WorkerProcessManager::the().worker_did_post_broadcast_channel_message(m_agent_id, move(message));
 }
 
+void WebWorkerClient::did_release_memory(Core::MemoryPressure::Level level, u64 bytes_released)
+{
+    Application::the().did_release_memory_in_process(ProcessType::WebWorker, level, bytes_released);
+}
+
 Messages::WebWorkerClient::StartWorkerAgentResponse WebWorkerClient::start_worker_agent(Web::HTML::WorkerAgentStartRequest request)
 {
     return WorkerProcessManager::the().start_worker_agent(*this, move(request));
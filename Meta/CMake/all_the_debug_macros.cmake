@@ -44,6 +44,7 @@ set(LZW_DEBUG ON)
 set(MACH_PORT_DEBUG ON)
 set(MATROSKA_DEBUG ON)
 set(MATROSKA_TRACE_DEBUG ON)
+set(MEMORY_PRESSURE_DEBUG ON)
 set(HTML_PARSER_DEBUG ON)
 set(PATH_DEBUG ON)
 set(PLAYBACK_MANAGER_DEBUG ON)
@@ -89,6 +89,20 @@ else()
     set(BROTLI_TARGETS PkgConfig::BROTLI)
 endif()
 
+find_package(zstd CONFIG)
+if(zstd_FOUND)
+    if(TARGET zstd::libzstd)
+        set(ZSTD_TARGETS zstd::libzstd)
+    elseif(TARGET zstd::libzstd_shared)
+        set(ZSTD_TARGETS zstd::libzstd_shared)
+    else()
+        set(ZSTD_TARGETS zstd::libzstd_static)
+    endif()
+else()
+    pkg_check_modules(ZSTD REQUIRED IMPORTED_TARGET libzstd)
+    set(ZSTD_TARGETS PkgConfig::ZSTD)
+endif()
+
 pkg_check_modules(LIBPSL REQUIRED IMPORTED_TARGET libpsl)
 pkg_check_modules(libtommath REQUIRED IMPORTED_TARGET libtommath)
 
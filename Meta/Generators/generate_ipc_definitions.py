@@ -564,6 +564,13 @@ private:
 
 
 def write_endpoint_class(out: TextIO, endpoint: Endpoint) -> None:
+    # Indexed by message ID - 1, see write_message_ids_enum().
+    message_names: List[str] = []
+    for message in endpoint.messages:
+        message_names.append(message.name)
+        if message.is_synchronous:
+            message_names.append(f"{message.name}_response")
+
     out.write(f"""
 template<typename LocalEndpoint, typename PeerEndpoint>
 class {endpoint.name}Proxy;
@@ -577,6 +584,13 @@ public:
 
     static u32 static_magic() {{ return {endpoint.magic}; }}
 
+    static IPC::MessageStatistics& statistics()
+    {{
+        static constexpr Array<StringView, {len(message_names)}> message_names {{ {", ".join(f'"{name}"sv' for name in message_names)} }};
+        static auto& statistics = IPC::MessageStatistics::for_endpoint(static_magic(), "{endpoint.name}"sv, message_names);
+        return statistics;
+    }}
+
     static ErrorOr<NonnullOwnPtr<IPC::Message>> decode_message(ReadonlyBytes buffer, [[maybe_unused]] Queue<IPC::Attachment>& attachments)
     {{
         FixedMemoryStream stream {{ buffer }};
@@ -720,6 +734,7 @@ def build(out: TextIO, endpoints: List[Endpoint]) -> None:
             out.write(f"{include}\n")
 
     out.write("""\
+#include <AK/Array.h>
 #include <AK/Error.h>
 #include <AK/MemoryStream.h>
 #include <AK/OwnPtr.h>
@@ -732,6 +747,7 @@ def build(out: TextIO, endpoints: List[Endpoint]) -> None:
 #include <LibIPC/Encoder.h>
 #include <LibIPC/File.h>
 #include <LibIPC/Message.h>
+#include <LibIPC/MessageStatistics.h>
 #include <LibIPC/Stub.h>
 
 #if defined(AK_COMPILER_CLANG)
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026-present, the Ladybird developers.
+# SPDX-License-Identifier: BSD-2-Clause
+
+"""Compare two IPC statistics snapshots saved from about:processes."""
+
+import argparse
+import json
+
+from collections import defaultdict
+
+COUNTERS = ("sentCount", "sentBytes", "sentAttachments", "receivedCount", "receivedBytes", "receivedAttachments")
+HISTOGRAMS = ("queueingDelay", "handlerTime", "roundTripTime")
+
+
+def _process_key(process, by_pid):
+    if by_pid:
+        return f"{process['name']} ({process['pid']})"
+    # Titles and PIDs change from run to run, so processes of the same type are merged by default.
+    return process["name"].split(" - ", 1)[0]
+
+
+def load_snapshot(path, by_pid):
+    """Return {(process, endpoint, message): {counter: value}}, summing processes that share a key."""
+
+    with open(path, "r", encoding="utf-8") as file:
+        snapshot = json.load(file)
+
+    messages = defaultdict(lambda: defaultdict(int))
+    for process in snapshot["processes"]:
+        process_key = _process_key(process, by_pid)
+        for endpoint in process["endpoints"]:
+            for message in endpoint["messages"]:
+                totals = messages[(process_key, endpoint["endpoint"], message["name"])]
+                for counter in COUNTERS:
+                    totals[counter] += message.get(counter, 0)
+                for histogram_name in HISTOGRAMS:
+                    histogram = message.get(histogram_name)
+                    if histogram is None:
+                        continue
+                    totals[f"{histogram_name}Count"] += histogram["count"]
+                    totals[f"{histogram_name}Microseconds"] += histogram["totalMicroseconds"]
+    return messages
+
+
+def _mean_microseconds(totals, histogram_name):
+    count = totals.get(f"{histogram_name}Count", 0)
+    if count == 0:
+        return None
+    return totals[f"{histogram_name}Microseconds"] / count
+
+
+def diff(before, after):
+    rows = []
+    for key in set(before) | set(after):
+        old = before.get(key, {})
+        new = after.get(key, {})
+        row = {
+            "process": key[0],
+            "endpoint": key[1],
+            "message": key[2],
+        }
+        for counter in COUNTERS:
+            row[counter] = new.get(counter, 0) - old.get(counter, 0)
+        for histogram_name in HISTOGRAMS:
+            row[f"{histogram_name}Before"] = _mean_microseconds(old, histogram_name)
+            row[f"{histogram_name}After"] = _mean_microseconds(new, histogram_name)
+        rows.append(row)
+    return rows
+
+
+def _format_mean_change(before, after):
+    if before is None and after is None:
+        return ""
+    if before is None:
+        return f"{after:.1f}"
+    if after is None:
+        return f"{before:.1f} -> -"
+    return f"{before:.1f} -> {after:.1f}"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("before", help="snapshot to compare against")
+    parser.add_argument("after", help="snapshot to compare")
+    parser.add_argument(
+        "--sort",
+        choices=("count", "bytes", "handler", "round-trip"),
+        default="count",
+        help="order messages by this delta (default: count)",
+    )
+    parser.add_argument("--by-pid", action="store_true", help="compare individual processes instead of process types")
+    parser.add_argument("--limit", type=int, default=40, help="maximum messages to print (default: 40)")
+    parser.add_argument("--json", action="store_true", help="write machine-readable JSON")
+    args = parser.parse_args()
+
+    rows = diff(load_snapshot(args.before, args.by_pid), load_snapshot(args.after, args.by_pid))
+
+    def mean_delta(row, histogram_name):
+        before = row[f"{histogram_name}Before"] or 0
+        after = row[f"{histogram_name}After"] or 0
+        return after - before
+
+    sort_keys = {
+        "count": lambda row: abs(row["sentCount"] + row["receivedCount"]),
+        "bytes": lambda row: abs(row["sentBytes"] + row["receivedBytes"]),
+        "handler": lambda row: abs(mean_delta(row, "handlerTime")),
+        "round-trip": lambda row: abs(mean_delta(row, "roundTripTime")),
+    }
+    rows.sort(key=lambda row: (-sort_keys[args.sort](row), row["process"], row["endpoint"], row["message"]))
+    rows = rows[: args.limit]
+
+    if args.json:
+        print(json.dumps(rows, indent=2))
+        return
+
+    print("   Count Δ    Bytes Δ  Handler µs          Round trip µs       Message")
+    for row in rows:
+        count = row["sentCount"] + row["receivedCount"]
+        byte_count = row["sentBytes"] + row["receivedBytes"]
+        handler = _format_mean_change(row["handlerTimeBefore"], row["handlerTimeAfter"])
+        round_trip = _format_mean_change(row["roundTripTimeBefore"], row["roundTripTimeAfter"])
+        name = f"{row['process']} {row['endpoint']}::{row['message']}"
+        print(f"{count:+10d} {byte_count:+10d}  {handler:<18}  {round_trip:<18}  {name}")
+
+
+if __name__ == "__main__":
+    main()
@@ -9,6 +9,7 @@
 #include <Compositor/CompositorState.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Timer.h>
+#include <LibCore/Tracing.h>
 #include <LibMedia/Sinks/DisplayingVideoSink.h>
 
 namespace Compositor {
@@ -502,31 +503,37 @@ void CompositorState::set_display_metadata(Web::Compositor::CompositorContextId
     }
 }
 
-void CompositorState::present_frame(Web::Compositor::CompositorContextId context_id, Gfx::IntRect viewport_rect, Gfx::IntRect damage_rect)
+void CompositorState::present_frame(Web::Compositor::CompositorContextId context_id, Gfx::IntRect viewport_rect, Gfx::IntRect damage_rect, u64 frame_id)
 {
+    Core::Tracing::Scope trace_scope { "compositor", "QueuePresentFrame" };
+
     auto* context = context_if_present(context_id);
     VERIFY(context);
+    auto requested_at = MonotonicTime::now();
     if (context->should_defer_main_thread_present_for_async_scroll()) {
         dbgln_if(COMPOSITOR_DEBUG, "[Compositor] Main thread deferred present while async scroll is pending");
         // NB: The in-flight compositor frame may have been rasterized before the
         //     main thread installed its new display list. Preserve the present as
         //     a full repaint so that it uses both the new list and the latest
         //     compositor scroll state once presentation is unblocked.
-        schedule_present_frame(context_id, *context, viewport_rect);
+        schedule_present_frame(context_id, *context, ContextState::PendingFrame { viewport_rect, { {}, viewport_rect.size() }, requested_at, frame_id });
         return;
     }
     damage_rect.intersect({ {}, viewport_rect.size() });
-    schedule_present_frame(context_id, *context, ContextState::PendingFrame { viewport_rect, damage_rect });
+    schedule_present_frame(context_id, *context, ContextState::PendingFrame { viewport_rect, damage_rect, requested_at, frame_id });
 }
 
 void CompositorState::present_frame(Web::Compositor::CompositorContextId context_id, ContextState& context, ContextState::PendingFrame pending_frame)
 {
+    Core::Tracing::Scope trace_scope { "compositor", "PrepareFrame" };
+
+    auto raster_started_at = MonotonicTime::now();
     auto composited_context_resolver = resolver_for(context_id);
     auto prepared_frame = context.prepare_frame(*m_display_list_player, pending_frame, &composited_context_resolver);
     if (!prepared_frame.has_value())
         return;
 
-    m_pending_async_presents.append(context_id, pending_frame.viewport_rect, pending_frame.damage_rect, prepared_frame->bitmap_id);
+    m_pending_async_presents.append(context_id, pending_frame.viewport_rect, pending_frame.damage_rect, prepared_frame->bitmap_id, raster_started_at, pending_frame.requested_at, pending_frame.frame_id);
     auto* pending_present = &m_pending_async_presents.last();
 
     auto& event_loop = Core::EventLoop::current();
@@ -675,6 +682,18 @@ void CompositorState::did_finish_async_present(PendingAsyncPresent& pending_pres
     auto damage_rect = pending_present.damage_rect;
     auto bitmap_id = pending_present.bitmap_id;
     auto was_cancelled = pending_present.was_cancelled;
+
+    // Frames that the compositor presents on its own, e.g. for async scrolling, have no request from the main thread
+    // to measure from.
+    auto now = MonotonicTime::now();
+    Web::Compositor::PresentTimings timings {
+        .raster_time = now - pending_present.raster_started_at,
+        .present_latency = now - pending_present.requested_at.value_or(pending_present.raster_started_at),
+    };
+
+    Core::Tracing::complete("compositor", "RasterFrame", pending_present.raster_started_at, timings.raster_time, pending_present.frame_id);
+    Core::Tracing::Scope trace_scope { "compositor", "DidFinishPresent" };
+    Core::Tracing::flow_end("frame", "Frame", pending_present.frame_id);
     (void)m_pending_async_presents.remove(pending_present_iterator);
     if (m_pending_async_presents.is_empty() && m_gpu_completion_timer)
         m_gpu_completion_timer->stop();
@@ -688,7 +707,7 @@ void CompositorState::did_finish_async_present(PendingAsyncPresent& pending_pres
     context->did_finish_gpu_present(bitmap_id);
     if (context->presents_to_client()) {
         VERIFY(m_client);
-        m_client->did_present_frame(context_id, viewport_rect, damage_rect, bitmap_id);
+        m_client->did_present_frame(context_id, viewport_rect, damage_rect, bitmap_id, timings);
     }
     resize_backing_stores_if_needed(context_id, *context);
     if (auto parent_context_id = context->parent_context_id(); parent_context_id.has_value()) {
@@ -829,6 +848,14 @@ void CompositorState::set_client_gpu_presentation_capability(bool supported, u64
     }
 }
 
+size_t CompositorState::purge_cached_rasters()
+{
+    size_t released_bytes = 0;
+    for (auto& context_entry : m_contexts)
+        released_bytes += context_entry.value->purge_cached_rasters();
+    return released_bytes;
+}
+
 void CompositorState::schedule_backing_store_shrink(Web::Compositor::CompositorContextId context_id, ContextState& context)
 {
     context.schedule_backing_store_shrink([this, context_id] {
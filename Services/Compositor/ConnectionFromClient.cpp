@@ -7,8 +7,10 @@
 #include <AK/IDAllocator.h>
 #include <Compositor/ConnectionFromClient.h>
 #include <Compositor/ConnectionFromWebContent.h>
+#include <LibCore/MemoryPressure.h>
 #include <LibCore/Process.h>
 #include <LibCore/System.h>
+#include <LibCore/Tracing.h>
 #include <LibIPC/Transport.h>
 
 namespace Compositor {
@@ -20,6 +22,10 @@ ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transpo
     , m_compositor_state(CompositorState::create(move(skia_backend_context), async_scrolling_enabled))
 {
     m_compositor_state->set_client(*this);
+
+    Core::MemoryPressure::register_handler("Display list rasters"sv, [compositor_state = m_compositor_state](auto) {
+        return compositor_state->purge_cached_rasters();
+    });
 }
 
 void ConnectionFromClient::die()
@@ -34,9 +40,9 @@ void ConnectionFromClient::did_allocate_backing_stores(Web::Compositor::Composit
     async_did_allocate_backing_stores(context_id, move(bitmap_ids), move(backing_stores));
 }
 
-void ConnectionFromClient::did_present_frame(Web::Compositor::CompositorContextId context_id, Gfx::IntRect content_rect, Gfx::IntRect damage_rect, i32 bitmap_id)
+void ConnectionFromClient::did_present_frame(Web::Compositor::CompositorContextId context_id, Gfx::IntRect content_rect, Gfx::IntRect damage_rect, i32 bitmap_id, Web::Compositor::PresentTimings timings)
 {
-    async_did_present_frame(context_id, content_rect, damage_rect, bitmap_id);
+    async_did_present_frame(context_id, content_rect, damage_rect, bitmap_id, timings);
 }
 
 Messages::CompositorControlServer::InitTransportResponse ConnectionFromClient::init_transport([[maybe_unused]] int peer_pid)
@@ -109,6 +115,26 @@ void ConnectionFromClient::set_client_gpu_presentation_capability(bool supported
     m_compositor_state->set_client_gpu_presentation_capability(supported, adapter_luid);
 }
 
+void ConnectionFromClient::set_tracing_enabled(bool enabled)
+{
+    Core::Tracing::set_enabled(enabled);
+}
+
+void ConnectionFromClient::collect_trace(u64 request_id)
+{
+    auto events = MUST(Core::Tracing::take_serialized_events("Compositor"sv));
+    auto buffer = MUST(Core::AnonymousBuffer::create_with_size(events.size()));
+    events.bytes().copy_to(buffer.bytes());
+
+    async_did_collect_trace(request_id, move(buffer), MonotonicTime::now().nanoseconds());
+}
+
+void ConnectionFromClient::release_memory(Core::MemoryPressure::Level level)
+{
+    auto report = Core::MemoryPressure::release_memory(level);
+    async_did_release_memory(level, report.total_bytes_released());
+}
+
 void ConnectionFromClient::crash()
 {
     warnln("Crashing Compositor process by request from Browser");
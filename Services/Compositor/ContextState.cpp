@@ -9,6 +9,7 @@
 #include <Compositor/CompositorState.h>
 #include <Compositor/ContextState.h>
 #include <LibCore/Timer.h>
+#include <LibCore/Tracing.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/PaintingSurface.h>
 #include <LibGfx/SkiaUtils.h>
@@ -642,15 +643,30 @@ void ContextState::queue_present_frame(PendingFrame pending_frame)
         return;
     }
 
+    auto requested_at = m_pending_present_frame->requested_at;
+    if (!requested_at.has_value() || (pending_frame.requested_at.has_value() && *pending_frame.requested_at < *requested_at))
+        requested_at = pending_frame.requested_at;
+
+    // The frames are presented together, so the flow of the one that is merged away ends here.
+    auto frame_id = m_pending_present_frame->frame_id;
+    if (pending_frame.frame_id != 0) {
+        Core::Tracing::flow_end("frame", "Frame", frame_id);
+        frame_id = pending_frame.frame_id;
+    }
+
     if (m_pending_present_frame->viewport_rect != pending_frame.viewport_rect) {
         m_pending_present_frame = PendingFrame {
             .viewport_rect = pending_frame.viewport_rect,
             .damage_rect = { {}, pending_frame.viewport_rect.size() },
+            .requested_at = requested_at,
+            .frame_id = frame_id,
         };
         return;
     }
 
     m_pending_present_frame->damage_rect.unite(pending_frame.damage_rect);
+    m_pending_present_frame->requested_at = requested_at;
+    m_pending_present_frame->frame_id = frame_id;
 }
 
 void ContextState::mark_pending_present_frame_scheduled()
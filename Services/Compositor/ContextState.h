@@ -78,6 +78,12 @@ public:
     struct PendingFrame {
         Gfx::IntRect viewport_rect;
         Gfx::IntRect damage_rect;
+
+        // When the main thread first asked for this frame, if it did.
+        Optional<MonotonicTime> requested_at {};
+
+        // Identifies the main thread's frame in traces, or 0 if it is not being traced.
+        u64 frame_id { 0 };
     };
 
     ContextState(Optional<u64> page_id, CompositorStateWebContentClient&, Web::Painting::CanvasSurfaceRegistry const&, bool async_scrolling_enabled);
@@ -106,6 +112,7 @@ public:
     void update_scroll_state(Web::Painting::ScrollStateSnapshot&&);
     void set_video_sink(Web::Painting::VideoSinkResourceId, RefPtr<Media::VideoSink>);
     HashMap<u64, Media::VideoSinkHandle> const& video_sink_handles() const { return m_display_list_resource_storage.video_sink_handles(); }
+    size_t purge_cached_rasters() { return m_display_list_resource_storage.purge_cached_rasters(); }
 
     void invalidate_wheel_event_listener_state(u64 generation);
     ContextUpdateResult handle_mouse_event(Web::MouseEvent const&);
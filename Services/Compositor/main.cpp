@@ -8,7 +8,9 @@
 #include <Compositor/Sandbox.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/MemoryPressure.h>
 #include <LibCore/Process.h>
+#include <LibCore/Tracing.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/PathFontProvider.h>
@@ -29,6 +31,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool force_fontconfig = false;
     bool disable_async_scrolling = false;
     bool disable_sandbox = false;
+    bool enable_tracing = false;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
@@ -39,8 +42,12 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(disable_async_scrolling, "Disable async scrolling", "disable-async-scrolling");
     args_parser.add_option(disable_sandbox, "Disable process sandboxing", "disable-sandbox");
+    args_parser.add_option(enable_tracing, "Record trace events from startup", "enable-tracing");
     args_parser.parse(arguments);
 
+    if (enable_tracing)
+        Core::Tracing::set_enabled(true);
+
     if (wait_for_debugger)
         Core::Process::wait_for_debugger_and_break();
 
@@ -67,7 +74,15 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
         TRY(Compositor::apply_sandbox(cache_path));
 
     auto client = TRY(IPC::take_over_accepted_client_from_system_server<Compositor::ConnectionFromClient>(
-        mach_server_name, move(skia_backend_context), !disable_async_scrolling));
+        mach_server_name, skia_backend_context, !disable_async_scrolling));
+
+    // NB: This runs after the client's handlers, so that the rasters they drop are purged from the GPU as well.
+    if (skia_backend_context) {
+        Core::MemoryPressure::register_handler("GPU resource cache"sv, [skia_backend_context](auto level) {
+            auto resources = level == Core::MemoryPressure::Level::Critical ? Gfx::SkiaBackendContext::PurgeResources::All : Gfx::SkiaBackendContext::PurgeResources::ScratchOnly;
+            return skia_backend_context->purge_resources(resources);
+        });
+    }
 
     return event_loop.exec();
 }
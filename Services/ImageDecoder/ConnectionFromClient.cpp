@@ -10,6 +10,7 @@
 #include <ImageDecoder/ConnectionFromClient.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/MemoryPressure.h>
 #include <LibCore/Process.h>
 #include <LibCore/System.h>
 #include <LibGfx/Bitmap.h>
@@ -41,6 +42,11 @@ void ConnectionFromClient::die()
     m_pending_frame_jobs.clear();
     m_animation_sessions.clear();
 
+    for (auto& [_, session] : m_progressive_decode_sessions)
+        session->cancel();
+    m_progressive_decode_sessions.clear();
+    m_progressive_snapshot_timers.clear();
+
     auto client_id = this->client_id();
     s_connections.remove(client_id);
     s_client_ids.deallocate(client_id);
@@ -85,6 +91,14 @@ Messages::ImageDecoderServer::ConnectNewClientsResponse ConnectionFromClient::co
     return handles;
 }
 
+void ConnectionFromClient::release_memory(Core::MemoryPressure::Level level)
+{
+    // NB: Decoded images are handed to the client right away, so there are no caches to drop here. Releasing memory
+    //     still returns the allocator's free pages to the system under critical pressure.
+    auto report = Core::MemoryPressure::release_memory(level);
+    async_did_release_memory(level, report.total_bytes_released());
+}
+
 static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
 {
     bitmaps.ensure_capacity(decoder.frame_count());
@@ -105,9 +119,10 @@ static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder
 
 static constexpr u32 STREAMING_BATCH_SIZE = 4;
 
-static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
+static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer encoded_buffer, size_t encoded_data_size, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
 {
-    auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, known_mime_type));
+    VERIFY(encoded_data_size <= encoded_buffer.size());
+    auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_data_size }, known_mime_type));
 
     if (!decoder)
         return Error::from_string_literal("Could not find suitable image decoder plugin for data");
@@ -119,6 +134,7 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     result.is_animated = decoder->is_animated();
     result.loop_count = decoder->loop_count();
     result.frame_count = decoder->frame_count();
+    result.natural_size = decoder->size();
 
     if (auto maybe_icc_data = decoder->color_space(); !maybe_icc_data.is_error())
         result.color_profile = maybe_icc_data.value();
@@ -177,13 +193,13 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     return result;
 }
 
-NonnullRefPtr<ConnectionFromClient::PendingJob> ConnectionFromClient::start_decode_image_job(i64 request_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+NonnullRefPtr<ConnectionFromClient::PendingJob> ConnectionFromClient::start_decode_image_job(i64 request_id, Core::AnonymousBuffer encoded_buffer, size_t encoded_data_size, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
 {
     auto job = make_ref_counted<PendingJob>();
     auto& main_thread_event_loop = Core::EventLoop::current();
     Threading::ThreadPool::the().submit(
-        [strong_this = NonnullRefPtr(*this), job, &main_thread_event_loop, request_id, encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type)]() mutable {
-            auto result = decode_image_to_details(move(encoded_buffer), ideal_size, mime_type);
+        [strong_this = NonnullRefPtr(*this), job, &main_thread_event_loop, request_id, encoded_buffer = move(encoded_buffer), encoded_data_size, ideal_size = move(ideal_size), mime_type = move(mime_type)]() mutable {
+            auto result = decode_image_to_details(move(encoded_buffer), encoded_data_size, ideal_size, mime_type);
 
             main_thread_event_loop.deferred_invoke([strong_this = move(strong_this), job = move(job), request_id, result = move(result)] mutable {
                 auto current_job = strong_this->m_pending_jobs.get(request_id);
@@ -215,7 +231,7 @@ NonnullRefPtr<ConnectionFromClient::PendingJob> ConnectionFromClient::start_deco
                     strong_this->m_animation_sessions.set(session_id, move(session));
                 }
 
-                strong_this->async_did_decode_image(request_id, result_value.is_animated, result_value.loop_count, move(result_value.bitmaps), move(result_value.durations), result_value.scale, move(result_value.color_profile), session_id);
+                strong_this->async_did_decode_image(request_id, result_value.is_animated, result_value.loop_count, move(result_value.bitmaps), move(result_value.durations), result_value.natural_size, result_value.scale, move(result_value.color_profile), session_id);
                 strong_this->m_pending_jobs.remove(request_id);
             });
         });
@@ -237,7 +253,8 @@ void ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Op
         return;
     }
 
-    m_pending_jobs.set(request_id, start_decode_image_job(request_id, move(encoded_buffer), ideal_size, move(mime_type)));
+    auto encoded_data_size = encoded_buffer.size();
+    m_pending_jobs.set(request_id, start_decode_image_job(request_id, move(encoded_buffer), encoded_data_size, ideal_size, move(mime_type)));
 }
 
 void ConnectionFromClient::cancel_decoding(i64 request_id)
@@ -245,6 +262,233 @@ void ConnectionFromClient::cancel_decoding(i64 request_id)
     if (auto job = m_pending_jobs.take(request_id); job.has_value()) {
         job.value()->cancel();
     }
+    remove_progressive_decode_session(request_id);
+}
+
+Messages::ImageDecoderServer::DecodeFirstFrameSynchronouslyResponse ConnectionFromClient::decode_first_frame_synchronously(Core::AnonymousBuffer encoded_buffer, Optional<ByteString> mime_type)
+{
+    if (!encoded_buffer.is_valid())
+        return { {}, {} };
+
+    auto decoder_or_error = Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, mime_type);
+    if (decoder_or_error.is_error() || !decoder_or_error.value() || !decoder_or_error.value()->frame_count())
+        return { {}, {} };
+    auto decoder = decoder_or_error.release_value();
+
+    auto frame_or_error = decoder->frame(0);
+    if (frame_or_error.is_error()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "Decoding failed: {}", frame_or_error.error());
+        return { {}, {} };
+    }
+    auto frame = frame_or_error.release_value();
+    frame.image->set_alpha_type_destructive(Gfx::AlphaType::Premultiplied);
+
+    Gfx::ColorSpace color_profile;
+    if (auto maybe_icc_data = decoder->color_space(); !maybe_icc_data.is_error())
+        color_profile = maybe_icc_data.release_value();
+
+    Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+    bitmaps.append(move(frame.image));
+    return { Gfx::BitmapSequence { move(bitmaps) }, move(color_profile) };
+}
+
+void ConnectionFromClient::begin_progressive_decode(Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, i64 request_id)
+{
+    if (m_pending_jobs.contains(request_id) || m_progressive_decode_sessions.contains(request_id)) {
+        did_misbehave("Duplicate decode request id");
+        return;
+    }
+
+    auto session = make_ref_counted<ProgressiveDecodeSession>();
+    session->ideal_size = ideal_size;
+    session->mime_type = move(mime_type);
+    m_progressive_decode_sessions.set(request_id, move(session));
+}
+
+void ConnectionFromClient::append_progressive_decode_data(i64 request_id, Optional<Core::AnonymousBuffer> data, u64 data_size)
+{
+    auto it = m_progressive_decode_sessions.find(request_id);
+    if (it == m_progressive_decode_sessions.end())
+        return;
+
+    // NB: The buffer stays shared with the client, so it must not be able to shrink it underneath us.
+    if (data.has_value() && (!data->is_valid() || data->validate_sealed_size().is_error())) {
+        did_misbehave("Invalid progressive decode buffer");
+        return;
+    }
+
+    auto session = it->value;
+    bool has_valid_size = true;
+    {
+        Sync::MutexLocker locker { session->mutex };
+        if (data.has_value())
+            session->encoded_data = data.release_value();
+
+        has_valid_size = data_size >= session->encoded_data_size && data_size <= session->encoded_data.size();
+        if (has_valid_size) {
+            session->encoded_data_size = data_size;
+            if (session->has_scheduled_job)
+                return;
+            session->has_scheduled_job = true;
+        }
+    }
+
+    if (!has_valid_size) {
+        did_misbehave("Invalid progressive decode data size");
+        return;
+    }
+
+    start_progressive_decode_job(request_id, move(session));
+}
+
+// Sending every decoded row would flood the client with bitmaps, so partial images are sent at most this often.
+static constexpr auto PROGRESSIVE_SNAPSHOT_INTERVAL = AK::Duration::from_milliseconds(100);
+
+// Passes the data that arrived since the last call to the decoder, given all of the data received so far.
+static void feed_progressive_decoder(ConnectionFromClient::ProgressiveDecodeSession& session, ReadonlyBytes data)
+{
+    auto new_data = data.slice(session.processed_data_size);
+    session.processed_data_size = data.size();
+    if (session.has_given_up)
+        return;
+
+    if (!session.decoder) {
+        if (data.size() < Gfx::ProgressiveImageDecoder::minimum_bytes_for_sniffing)
+            return;
+
+        auto decoder_or_error = Gfx::ProgressiveImageDecoder::try_create(data, session.ideal_size);
+        if (decoder_or_error.is_error() || !decoder_or_error.value()) {
+            // Formats without an incremental decoder are only decoded once all of their data has arrived.
+            session.has_given_up = true;
+            return;
+        }
+        session.decoder = decoder_or_error.release_value();
+
+        // NB: Creating the decoder only sniffed the data, so it still needs all of it.
+        new_data = data;
+    }
+
+    if (auto result = session.decoder->append(new_data); result.is_error()) {
+        // The final decode reports the error, if there really is one.
+        dbgln_if(IMAGE_DECODER_DEBUG, "Progressive decode failed: {}", result.error());
+        session.has_given_up = true;
+    }
+}
+
+void ConnectionFromClient::start_progressive_decode_job(i64 request_id, NonnullRefPtr<ProgressiveDecodeSession> session)
+{
+    auto& main_thread_event_loop = Core::EventLoop::current();
+    Threading::ThreadPool::the().submit(
+        [strong_this = NonnullRefPtr(*this), session = move(session), &main_thread_event_loop, request_id]() mutable {
+            while (!session->is_canceled()) {
+                Core::AnonymousBuffer encoded_data;
+                size_t encoded_data_size = 0;
+                {
+                    Sync::MutexLocker locker { session->mutex };
+                    if (session->encoded_data_size == session->processed_data_size && !session->wants_snapshot) {
+                        session->has_scheduled_job = false;
+                        return;
+                    }
+                    encoded_data = session->encoded_data;
+                    encoded_data_size = session->encoded_data_size;
+                    session->wants_snapshot = false;
+                }
+
+                feed_progressive_decoder(*session, ReadonlyBytes { encoded_data.data<u8>(), encoded_data_size });
+
+                if (session->has_given_up || !session->decoder || !session->decoder->has_new_pixels())
+                    continue;
+
+                // NB: The first partial image is sent right away. Pixels decoded within the interval after a snapshot
+                //     are sent once it has passed, even if no more data arrives by then.
+                auto now = MonotonicTime::now_coarse();
+                if (session->last_snapshot_time.has_value() && now - *session->last_snapshot_time < PROGRESSIVE_SNAPSHOT_INTERVAL) {
+                    main_thread_event_loop.deferred_invoke([strong_this, request_id] {
+                        strong_this->schedule_progressive_snapshot(request_id);
+                    });
+                    continue;
+                }
+
+                auto snapshot_or_error = session->decoder->take_snapshot();
+                if (snapshot_or_error.is_error())
+                    continue;
+                session->last_snapshot_time = now;
+
+                main_thread_event_loop.deferred_invoke([strong_this, session, request_id, natural_size = session->decoder->natural_size(), snapshot = snapshot_or_error.release_value()] mutable {
+                    auto current_session = strong_this->m_progressive_decode_sessions.get(request_id);
+                    if (!current_session.has_value() || current_session.value() != session.ptr())
+                        return;
+                    if (!strong_this->is_open())
+                        return;
+
+                    Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+                    bitmaps.append(move(snapshot));
+                    strong_this->async_did_decode_progressive_frame(request_id, natural_size, Gfx::BitmapSequence { move(bitmaps) });
+                });
+            }
+
+            Sync::MutexLocker locker { session->mutex };
+            session->has_scheduled_job = false;
+        });
+}
+
+void ConnectionFromClient::schedule_progressive_snapshot(i64 request_id)
+{
+    if (!m_progressive_decode_sessions.contains(request_id))
+        return;
+
+    auto& timer = m_progressive_snapshot_timers.ensure(request_id, [&] {
+        return Core::Timer::create_single_shot(PROGRESSIVE_SNAPSHOT_INTERVAL.to_milliseconds(), [this, request_id] {
+            auto session = m_progressive_decode_sessions.get(request_id);
+            if (!session.has_value())
+                return;
+
+            {
+                Sync::MutexLocker locker { session.value()->mutex };
+                session.value()->wants_snapshot = true;
+                if (session.value()->has_scheduled_job)
+                    return;
+                session.value()->has_scheduled_job = true;
+            }
+            start_progressive_decode_job(request_id, NonnullRefPtr { *session.value() });
+        });
+    });
+    if (!timer->is_active())
+        timer->start();
+}
+
+void ConnectionFromClient::remove_progressive_decode_session(i64 request_id)
+{
+    if (auto session = m_progressive_decode_sessions.take(request_id); session.has_value())
+        session.value()->cancel();
+    m_progressive_snapshot_timers.remove(request_id);
+}
+
+void ConnectionFromClient::finish_progressive_decode(i64 request_id)
+{
+    auto session = m_progressive_decode_sessions.take(request_id);
+    if (!session.has_value())
+        return;
+
+    // Any partial decode still in flight is now stale; the complete data is decoded from scratch like any other image.
+    session.value()->cancel();
+    m_progressive_snapshot_timers.remove(request_id);
+
+    Core::AnonymousBuffer encoded_data;
+    size_t encoded_data_size = 0;
+    {
+        Sync::MutexLocker locker { session.value()->mutex };
+        encoded_data = move(session.value()->encoded_data);
+        encoded_data_size = session.value()->encoded_data_size;
+    }
+
+    if (encoded_data_size == 0) {
+        async_did_fail_to_decode_image(request_id, "Encoded data is invalid"_string);
+        return;
+    }
+
+    // NB: The shared buffer is decoded as is. The client no longer writes to it once it has finished the decode.
+    m_pending_jobs.set(request_id, start_decode_image_job(request_id, move(encoded_data), encoded_data_size, session.value()->ideal_size, move(session.value()->mime_type)));
 }
 
 void ConnectionFromClient::request_animation_frames(i64 session_id, u32 start_frame_index, u32 count)
@@ -9,10 +9,12 @@
 #include <AK/Atomic.h>
 #include <AK/AtomicRefCounted.h>
 #include <AK/HashMap.h>
+#include <AK/Time.h>
 #include <ImageDecoder/Forward.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
 #include <LibCore/AnonymousBuffer.h>
+#include <LibCore/Timer.h>
 #include <LibGfx/BitmapSequence.h>
 #include <LibGfx/ColorSpace.h>
 #include <LibGfx/ImageFormats/ImageDecoder.h>
@@ -34,6 +36,7 @@ public:
         bool is_animated = false;
         u32 loop_count = 0;
         u32 frame_count = 0;
+        Gfx::IntSize natural_size;
         Gfx::FloatPoint scale { 1, 1 };
         Gfx::BitmapSequence bitmaps;
         Vector<u32> durations;
@@ -51,6 +54,33 @@ public:
         Sync::Mutex decoder_mutex;
     };
 
+    // A still image whose encoded data is still arriving. Snapshots of what has been decoded so far are sent to the
+    // client as they become available, and the final image is decoded normally once all the data is in.
+    struct ProgressiveDecodeSession : public AtomicRefCounted<ProgressiveDecodeSession> {
+        void cancel() { m_canceled.store(true, AK::MemoryOrder::memory_order_relaxed); }
+        bool is_canceled() const { return m_canceled.load(AK::MemoryOrder::memory_order_relaxed); }
+
+        Optional<Gfx::IntSize> ideal_size;
+        Optional<ByteString> mime_type;
+
+        // The data received so far is the first encoded_data_size bytes of a buffer shared with the client. The client
+        // only ever writes past that, and replaces the buffer with a larger one when it runs out of space.
+        Sync::Mutex mutex;
+        Core::AnonymousBuffer encoded_data;
+        size_t encoded_data_size { 0 };
+        bool has_scheduled_job { false };
+        bool wants_snapshot { false };
+
+        // Only accessed by the decode job, of which there is at most one at a time.
+        OwnPtr<Gfx::ProgressiveImageDecoder> decoder;
+        size_t processed_data_size { 0 };
+        bool has_given_up { false };
+        Optional<MonotonicTime> last_snapshot_time;
+
+    private:
+        Atomic<bool> m_canceled { false };
+    };
+
 private:
     struct PendingJob : public AtomicRefCounted<PendingJob> {
         void cancel() { m_canceled.store(true, AK::MemoryOrder::memory_order_relaxed); }
@@ -66,20 +96,30 @@ private:
 
     virtual void decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, i64 request_id) override;
     virtual void cancel_decoding(i64 request_id) override;
+    virtual Messages::ImageDecoderServer::DecodeFirstFrameSynchronouslyResponse decode_first_frame_synchronously(Core::AnonymousBuffer, Optional<ByteString> mime_type) override;
+    virtual void begin_progressive_decode(Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, i64 request_id) override;
+    virtual void append_progressive_decode_data(i64 request_id, Optional<Core::AnonymousBuffer>, u64 data_size) override;
+    virtual void finish_progressive_decode(i64 request_id) override;
     virtual void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count) override;
     virtual void stop_animation_decode(i64 session_id) override;
     virtual Messages::ImageDecoderServer::ConnectNewClientsResponse connect_new_clients(size_t count) override;
+    virtual void release_memory(Core::MemoryPressure::Level) override;
     virtual Messages::ImageDecoderServer::InitTransportResponse init_transport(int peer_pid) override;
 
     ErrorOr<IPC::TransportHandle> connect_new_client();
 
-    NonnullRefPtr<PendingJob> start_decode_image_job(i64 request_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type);
+    NonnullRefPtr<PendingJob> start_decode_image_job(i64 request_id, Core::AnonymousBuffer, size_t encoded_data_size, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type);
+    void start_progressive_decode_job(i64 request_id, NonnullRefPtr<ProgressiveDecodeSession>);
+    void schedule_progressive_snapshot(i64 request_id);
+    void remove_progressive_decode_session(i64 request_id);
     NonnullRefPtr<PendingJob> start_frame_decode_job(i64 session_id, NonnullRefPtr<AnimationSession>, u32 start_frame_index, u32 end_index);
 
     i64 m_next_session_id { 1 };
     HashMap<i64, NonnullRefPtr<PendingJob>> m_pending_jobs;
     HashMap<i64, NonnullRefPtr<AnimationSession>> m_animation_sessions;
     HashMap<i64, NonnullRefPtr<PendingJob>> m_pending_frame_jobs;
+    HashMap<i64, NonnullRefPtr<ProgressiveDecodeSession>> m_progressive_decode_sessions;
+    HashMap<i64, NonnullRefPtr<Core::Timer>> m_progressive_snapshot_timers;
 };
 
 }
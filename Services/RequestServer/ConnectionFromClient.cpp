@@ -4,11 +4,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Debug.h>
 #include <AK/IDAllocator.h>
 #include <AK/Math.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/WeakPtr.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/MemoryPressure.h>
 #include <LibCore/Proxy.h>
 #include <LibCore/Socket.h>
 #include <LibCore/System.h>
@@ -22,6 +24,7 @@
 #include <RequestServer/ConnectionFromClient.h>
 #include <RequestServer/Request.h>
 #include <RequestServer/Resolver.h>
+#include <RequestServer/SharedAssociatedDataCache.h>
 #include <RequestServer/WebSocketImplCurl.h>
 
 namespace RequestServer {
@@ -567,7 +570,26 @@ Messages::RequestServer::RetrieveCacheAssociatedDataResponse ConnectionFromClien
     if (!m_disk_cache.has_value())
         return Optional<Core::AnonymousBuffer> {};
 
-    auto data = m_disk_cache->retrieve_associated_data(url, method, *HTTP::HeaderList::create(move(request_headers)), vary_key, associated_data);
+    auto request_header_list = HTTP::HeaderList::create(move(request_headers));
+
+    // Decoded fonts are used straight from the buffer for as long as a page renders with them, so every process that
+    // renders the same font shares one read-only copy of it.
+    if (associated_data == HTTP::CacheEntryAssociatedData::DecodedFont) {
+        auto file = m_disk_cache->retrieve_associated_data_file(url, method, *request_header_list, vary_key, associated_data);
+        if (file.is_error()) {
+            dbgln("Failed to retrieve cache associated data for {}: {}", url, file.error());
+            return Optional<Core::AnonymousBuffer> {};
+        }
+        if (!file.value().has_value())
+            return Optional<Core::AnonymousBuffer> {};
+
+        auto buffer = SharedAssociatedDataCache::the().buffer_for_file(file.release_value().release_value());
+        if (!buffer.is_error())
+            return Optional<Core::AnonymousBuffer> { buffer.release_value() };
+        dbgln_if(HTTP_DISK_CACHE_DEBUG, "Unable to share cache associated data for {}: {}", url, buffer.error());
+    }
+
+    auto data = m_disk_cache->retrieve_associated_data(url, method, *request_header_list, vary_key, associated_data);
     if (data.is_error()) {
         dbgln("Failed to retrieve cache associated data for {}: {}", url, data.error());
         return Optional<Core::AnonymousBuffer> {};
@@ -598,6 +620,12 @@ Messages::RequestServer::CreateSyntheticCacheEntryResponse ConnectionFromClient:
     return result.value();
 }
 
+void ConnectionFromClient::release_memory(Core::MemoryPressure::Level level)
+{
+    auto report = Core::MemoryPressure::release_memory(level);
+    async_did_release_memory(level, report.total_bytes_released());
+}
+
 void ConnectionFromClient::websocket_connect(u64 websocket_id, URL::URL url, ByteString origin, Vector<ByteString> protocols, Vector<ByteString> extensions, Vector<HTTP::Header> additional_request_headers)
 {
     auto host = url.serialized_host().to_byte_string();
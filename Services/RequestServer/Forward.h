@@ -9,9 +9,11 @@
 namespace RequestServer {
 
 class ConnectionFromClient;
+class PageLoadArchive;
 class Request;
 class RequestPipe;
 
+struct ArchivedResponse;
 struct DNSInfo;
 struct Resolver;
 
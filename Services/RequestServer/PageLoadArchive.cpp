@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Base64.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibURL/Parser.h>
+#include <RequestServer/PageLoadArchive.h>
+
+namespace RequestServer {
+
+ErrorOr<NonnullOwnPtr<PageLoadArchive>> PageLoadArchive::create_for_recording(StringView path)
+{
+    auto archive = adopt_own(*new PageLoadArchive);
+    archive->m_recording_file = TRY(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    return archive;
+}
+
+ErrorOr<NonnullOwnPtr<PageLoadArchive>> PageLoadArchive::load_for_replay(StringView path, ReplayOptions replay_options)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto content = TRY(file->read_until_eof());
+
+    auto archive = adopt_own(*new PageLoadArchive);
+    archive->m_replay_options = replay_options;
+
+    for (auto line : StringView { content }.lines()) {
+        if (line.is_whitespace())
+            continue;
+
+        auto json = TRY(JsonValue::from_string(line));
+        if (!json.is_object())
+            return Error::from_string_literal("Page load archive entries must be JSON objects");
+
+        auto const& entry = json.as_object();
+
+        auto method = entry.get_string("method"sv);
+        auto url_string = entry.get_string("url"sv);
+        auto status_code = entry.get_integer<u32>("status_code"sv);
+        auto headers = entry.get_array("headers"sv);
+        auto body = entry.get_string("body"sv);
+        if (!method.has_value() || !url_string.has_value() || !status_code.has_value() || !headers.has_value() || !body.has_value())
+            return Error::from_string_literal("Page load archive entry is missing a required field");
+
+        auto url = URL::Parser::basic_parse(*url_string);
+        if (!url.has_value()) {
+            warnln("Skipping page load archive entry with invalid URL '{}'", *url_string);
+            continue;
+        }
+
+        ArchivedResponse response;
+        response.status_code = *status_code;
+        if (auto reason_phrase = entry.get_string("reason_phrase"sv); reason_phrase.has_value())
+            response.reason_phrase = *reason_phrase;
+
+        for (auto const& header : headers->values()) {
+            if (!header.is_array() || header.as_array().size() != 2)
+                return Error::from_string_literal("Page load archive headers must be [name, value] pairs");
+
+            auto const& name = header.as_array().at(0);
+            auto const& value = header.as_array().at(1);
+            if (!name.is_string() || !value.is_string())
+                return Error::from_string_literal("Page load archive headers must be [name, value] pairs");
+
+            response.headers.append({ name.as_string().to_byte_string(), value.as_string().to_byte_string() });
+        }
+
+        response.body = TRY(decode_base64(*body));
+
+        // A page may fetch the same resource more than once. Only its first response is replayed.
+        archive->m_responses.ensure(key_for(*method, *url), [&] { return move(response); });
+    }
+
+    return archive;
+}
+
+ByteString PageLoadArchive::key_for(StringView method, URL::URL const& url)
+{
+    auto normalized = url;
+    normalized.set_fragment({});
+    return ByteString::formatted("{} {}", method, normalized.serialize());
+}
+
+Optional<ArchivedResponse const&> PageLoadArchive::lookup(StringView method, URL::URL const& url) const
+{
+    return m_responses.get(key_for(method, url));
+}
+
+Optional<size_t> PageLoadArchive::replay_chunk_size() const
+{
+    if (!m_replay_options.bandwidth.has_value() || *m_replay_options.bandwidth == 0)
+        return {};
+
+    auto bytes_per_interval = static_cast<double>(*m_replay_options.bandwidth) * replay_chunk_interval.to_milliseconds() / 1000;
+    if (bytes_per_interval >= static_cast<double>(NumericLimits<size_t>::max()))
+        return {};
+    return max<size_t>(static_cast<size_t>(bytes_per_interval), 1);
+}
+
+ErrorOr<void> PageLoadArchive::record(StringView method, URL::URL const& url, ArchivedResponse const& response)
+{
+    VERIFY(m_recording_file);
+
+    JsonArray headers;
+    for (auto const& header : response.headers) {
+        auto name = String::from_byte_string(header.name);
+        auto value = String::from_byte_string(header.value);
+        if (name.is_error() || value.is_error()) {
+            warnln("Not recording header of '{}' that is not valid UTF-8", url.serialize());
+            continue;
+        }
+
+        JsonArray pair;
+        pair.must_append(name.release_value());
+        pair.must_append(value.release_value());
+        headers.must_append(move(pair));
+    }
+
+    JsonObject entry;
+    entry.set("method"sv, TRY(String::from_utf8(method)));
+    entry.set("url"sv, url.serialize());
+    entry.set("status_code"sv, response.status_code);
+    if (response.reason_phrase.has_value())
+        entry.set("reason_phrase"sv, *response.reason_phrase);
+    entry.set("headers"sv, move(headers));
+    entry.set("body"sv, TRY(encode_base64(response.body)));
+
+    TRY(m_recording_file->write_until_depleted(entry.serialized().bytes()));
+    TRY(m_recording_file->write_until_depleted("\n"sv.bytes()));
+    return {};
+}
+
+}
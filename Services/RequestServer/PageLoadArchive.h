@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/OwnPtr.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibCore/File.h>
+#include <LibHTTP/Header.h>
+#include <LibURL/URL.h>
+
+namespace RequestServer {
+
+struct ArchivedResponse {
+    u32 status_code { 200 };
+    Optional<String> reason_phrase;
+    Vector<HTTP::Header> headers;
+    ByteBuffer body;
+};
+
+// A file of HTTP responses, so that a set of pages can be loaded again and again without depending on the network.
+// While recording, every completed response is appended to the file as a line of JSON. While replaying, requests are
+// answered from the file only, at a simulated network latency and bandwidth.
+class PageLoadArchive {
+public:
+    struct ReplayOptions {
+        // Added to every response before its first byte is delivered.
+        AK::Duration latency;
+
+        // Bytes per second at which response bodies arrive, or unlimited if not set.
+        Optional<u64> bandwidth;
+    };
+
+    static ErrorOr<NonnullOwnPtr<PageLoadArchive>> create_for_recording(StringView path);
+    static ErrorOr<NonnullOwnPtr<PageLoadArchive>> load_for_replay(StringView path, ReplayOptions);
+
+    bool is_replaying() const { return !m_recording_file; }
+
+    // Response bodies are replayed in chunks, one per interval, so that they arrive at the configured bandwidth.
+    static constexpr AK::Duration replay_chunk_interval = AK::Duration::from_milliseconds(10);
+
+    Optional<ArchivedResponse const&> lookup(StringView method, URL::URL const&) const;
+
+    AK::Duration replay_latency() const { return m_replay_options.latency; }
+
+    // The number of body bytes to deliver per replay_chunk_interval, or empty if bodies are delivered all at once.
+    Optional<size_t> replay_chunk_size() const;
+
+    ErrorOr<void> record(StringView method, URL::URL const&, ArchivedResponse const&);
+
+private:
+    PageLoadArchive() = default;
+
+    static ByteString key_for(StringView method, URL::URL const&);
+
+    OwnPtr<Core::File> m_recording_file;
+
+    HashMap<ByteString, ArchivedResponse> m_responses;
+    ReplayOptions m_replay_options;
+};
+
+extern OwnPtr<PageLoadArchive> g_page_load_archive;
+
+}
@@ -5,21 +5,25 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Debug.h>
 #include <AK/GenericShorthands.h>
 #include <AK/HashMap.h>
 #include <LibCore/File.h>
 #include <LibCore/MimeData.h>
 #include <LibCore/Notifier.h>
 #include <LibCore/System.h>
+#include <LibCore/Timer.h>
 #include <LibHTTP/Cache/DiskCache.h>
 #include <LibHTTP/Cache/Utilities.h>
 #include <LibHTTP/Status.h>
 #include <LibTextCodec/Decoder.h>
 #include <RequestServer/CURL.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/PageLoadArchive.h>
 #include <RequestServer/Request.h>
 #include <RequestServer/Resolver.h>
 #include <RequestServer/ResourceSubstitutionMap.h>
+#include <RequestServer/SharedAssociatedDataCache.h>
 
 namespace RequestServer {
 
@@ -65,6 +69,28 @@ static bool response_has_unsupported_content_encoding(HTTP::HeaderList const& he
     return false;
 }
 
+// Only one kind of data that WebContent stored next to a response in the disk cache is sent along with the response: the
+// rules of a style sheet, a decoded font, or else the bytecode of a script. Fonts are often served without a font type,
+// so responses of an unknown type get whichever of a decoded font or bytecode was stored for them.
+static Vector<HTTP::CacheEntryAssociatedData, 2> associated_data_to_send_with_response(HTTP::HeaderList const& headers)
+{
+    auto content_type = headers.get("Content-Type"sv);
+    if (!content_type.has_value())
+        return { HTTP::CacheEntryAssociatedData::DecodedFont, HTTP::CacheEntryAssociatedData::JavaScriptBytecode };
+
+    auto essence = HTTP::normalize_header_value(content_type->view().find_first_split_view(';'));
+    if (essence.equals_ignoring_ascii_case("text/css"sv))
+        return { HTTP::CacheEntryAssociatedData::CSSParsedRules };
+    if (essence.starts_with("font/"sv, CaseSensitivity::CaseInsensitive)
+        || essence.starts_with("application/font-"sv, CaseSensitivity::CaseInsensitive)
+        || essence.starts_with("application/x-font-"sv, CaseSensitivity::CaseInsensitive))
+        return { HTTP::CacheEntryAssociatedData::DecodedFont };
+    if (essence.is_empty() || essence.equals_ignoring_ascii_case("application/octet-stream"sv))
+        return { HTTP::CacheEntryAssociatedData::DecodedFont, HTTP::CacheEntryAssociatedData::JavaScriptBytecode };
+
+    return { HTTP::CacheEntryAssociatedData::JavaScriptBytecode };
+}
+
 Request::TransferredBodyFile::~TransferredBodyFile()
 {
     if (fd != -1)
@@ -583,6 +609,7 @@ void Request::notify_fetch_complete(Badge<ConnectionFromClient>, int result_code
         m_response_headers->clear();
         m_reason_phrase.clear();
         m_status_code.clear();
+        m_archived_response_body.clear();
         m_content_decoding_disabled = true;
 
         if constexpr (REQUESTSERVER_WIRE_DEBUG) {
@@ -646,6 +673,9 @@ void Request::process()
     case State::ServeSubstitution:
         handle_serve_substitution_state();
         break;
+    case State::ServeArchive:
+        handle_serve_archive_state();
+        break;
     case State::DNSLookup:
         handle_dns_lookup_state();
         break;
@@ -677,6 +707,12 @@ void Request::handle_initial_state()
         }
     }
 
+    // A replayed page load must not depend on the network, nor on what a previous run left in the disk cache.
+    if (g_page_load_archive && g_page_load_archive->is_replaying() && m_type == RequestType::Fetch) {
+        transition_to_state(State::ServeArchive);
+        return;
+    }
+
     if (m_cache_mode == HTTP::CacheMode::NoStore) {
         m_cache_status = HTTP::CacheRequest::CacheStatus::NotCached;
     } else if (m_disk_cache.has_value()) {
@@ -879,6 +915,88 @@ void Request::handle_serve_substitution_state()
         transition_to_state(State::Error);
 }
 
+void Request::handle_serve_archive_state()
+{
+    auto response = g_page_load_archive->lookup(m_method, m_url);
+    if (!response.has_value()) {
+        dbgln_if(REQUESTSERVER_DEBUG, "Request: '{} {}' is not in the page load archive", m_method, m_url.serialize());
+        m_network_error = Requests::NetworkError::UnableToResolveHost;
+        transition_to_state(State::Error);
+        return;
+    }
+
+    auto latency = g_page_load_archive->replay_latency();
+    if (latency <= AK::Duration::zero()) {
+        serve_archived_response(*response);
+        return;
+    }
+
+    // NB: The archive outlives every request, so the response may be referenced until the timer fires.
+    m_archive_replay_timer = Core::Timer::create_single_shot(static_cast<int>(min<i64>(latency.to_milliseconds(), NumericLimits<int>::max())), [this, &response = *response] {
+        serve_archived_response(response);
+    });
+    m_archive_replay_timer->start();
+}
+
+void Request::serve_archived_response(ArchivedResponse const& response)
+{
+    m_status_code = response.status_code;
+    m_reason_phrase = response.reason_phrase.value_or_lazy_evaluated([&] {
+        return MUST(String::from_utf8(HTTP::reason_phrase_for_code(response.status_code)));
+    });
+
+    for (auto const& header : response.headers)
+        m_response_headers->append(header);
+
+    if (inform_client_request_started().is_error())
+        return;
+    transfer_headers_to_client_if_needed();
+
+    auto chunk_size = g_page_load_archive->replay_chunk_size().value_or(response.body.size());
+    m_archive_replay_offset = 0;
+
+    if (!serve_next_archived_response_chunk(response, chunk_size))
+        return;
+
+    // The rest of the body trickles in at the replay bandwidth.
+    m_archive_replay_body_timer = Core::Timer::create_repeating(static_cast<int>(PageLoadArchive::replay_chunk_interval.to_milliseconds()), [this, &response, chunk_size] {
+        (void)serve_next_archived_response_chunk(response, chunk_size);
+    });
+    m_archive_replay_body_timer->start();
+}
+
+bool Request::serve_next_archived_response_chunk(ArchivedResponse const& response, size_t chunk_size)
+{
+    auto remaining_body = response.body.bytes().slice(m_archive_replay_offset);
+    auto chunk = remaining_body.trim(chunk_size);
+    m_archive_replay_offset += chunk.size();
+
+    auto has_more_chunks = m_archive_replay_offset < response.body.size();
+    if (!has_more_chunks) {
+        if (m_archive_replay_body_timer)
+            m_archive_replay_body_timer->stop();
+        m_curl_result_code = CURLE_OK;
+    }
+
+    if (auto result = m_response_buffer.write_some(chunk); result.is_error()) {
+        dbgln("Request::serve_next_archived_response_chunk: Failed to write content to response buffer: {}", result.error());
+        if (m_archive_replay_body_timer)
+            m_archive_replay_body_timer->stop();
+        m_network_error = Requests::NetworkError::Unknown;
+        transition_to_state(State::Error);
+        return false;
+    }
+
+    if (write_queued_bytes_without_blocking().is_error()) {
+        if (m_archive_replay_body_timer)
+            m_archive_replay_body_timer->stop();
+        transition_to_state(State::Error);
+        return false;
+    }
+
+    return has_more_chunks;
+}
+
 void Request::handle_dns_lookup_state()
 {
     auto host = m_url.serialized_host().to_byte_string();
@@ -1140,6 +1258,10 @@ void Request::handle_complete_state()
         auto timing_info = acquire_timing_info();
         transfer_headers_to_client_if_needed();
 
+        // Only responses that came from the network have their body in m_archived_response_body.
+        if (g_page_load_archive && !g_page_load_archive->is_replaying() && m_curl_easy_handle)
+            record_response_in_archive();
+
         // Finalize the disk cache entry before notifying WebContent that the request is complete: WebContent may
         // immediately fire off a JavaScript bytecode cache store against this entry, and that store needs the cache
         // index row to already exist. If we notified first the store would race the index write and be rejected.
@@ -1169,6 +1291,28 @@ void Request::handle_complete_state()
     m_client->request_complete({}, *this);
 }
 
+void Request::record_response_in_archive()
+{
+    ArchivedResponse response;
+    response.status_code = acquire_status_code();
+    response.reason_phrase = m_reason_phrase;
+    response.body = move(m_archived_response_body);
+
+    // libcurl hands us the decoded body, so the headers must no longer claim it is encoded.
+    for (auto const& header : *m_response_headers) {
+        if (!m_content_decoding_disabled && header.name.is_one_of_ignoring_ascii_case("Content-Encoding"sv, "Content-Length"sv))
+            continue;
+        if (header.name.equals_ignoring_ascii_case("Transfer-Encoding"sv))
+            continue;
+        response.headers.append(header);
+    }
+    if (!m_content_decoding_disabled)
+        response.headers.append({ "Content-Length"sv, ByteString::number(response.body.size()) });
+
+    if (auto result = g_page_load_archive->record(m_method, m_url, response); result.is_error())
+        dbgln("Request: Unable to record '{}' in the page load archive: {}", m_url.serialize(), result.error());
+}
+
 void Request::handle_error_state()
 {
     if (m_type == RequestType::Fetch) {
@@ -1242,6 +1386,9 @@ size_t Request::on_data_received(void* buffer, size_t size, size_t nmemb, void*
     auto total_size = size * nmemb;
     ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
 
+    if (g_page_load_archive && !g_page_load_archive->is_replaying())
+        request.m_archived_response_body.append(bytes);
+
     auto result = [&] -> ErrorOr<void> {
         TRY(request.m_response_buffer.write_some(bytes));
         return request.write_queued_bytes_without_blocking();
@@ -1402,30 +1549,54 @@ void Request::transfer_headers_to_client_if_needed()
         }
     }
 
-    Optional<IPC::File> javascript_bytecode;
-    u64 javascript_bytecode_size { 0 };
-    Optional<u64> javascript_bytecode_cache_vary_key;
+    Optional<IPC::File> associated_data;
+    u64 associated_data_size { 0 };
+    auto associated_data_types = associated_data_to_send_with_response(*m_response_headers);
+    auto associated_data_type = associated_data_types.last();
+    Optional<u64> disk_cache_vary_key;
     if (m_cache_status == CacheStatus::ReadFromCache && m_disk_cache.has_value()) {
         VERIFY(m_cache_entry_reader.has_value());
-        javascript_bytecode_cache_vary_key = m_cache_entry_reader->vary_key();
-        auto data = m_disk_cache->retrieve_associated_data_file(m_url, m_method, *m_request_headers, javascript_bytecode_cache_vary_key, HTTP::CacheEntryAssociatedData::JavaScriptBytecode);
-        if (!data.is_error() && data.value().has_value()) {
-            javascript_bytecode_size = data.value()->size;
-            javascript_bytecode = IPC::File::adopt_fd(data.value()->fd);
+        disk_cache_vary_key = m_cache_entry_reader->vary_key();
+        for (auto type : associated_data_types) {
+            auto data = m_disk_cache->retrieve_associated_data_file(m_url, m_method, *m_request_headers, disk_cache_vary_key, type);
+            if (data.is_error() || !data.value().has_value())
+                continue;
+            associated_data_type = type;
+
+            // NB: Decoded fonts are shared with every process that renders them, just like when they are retrieved on
+            //     their own. A decoded font that can't be shared isn't sent at all, since WebContent needs it as a
+            //     sealed buffer.
+            if (type == HTTP::CacheEntryAssociatedData::DecodedFont) {
+                auto buffer = SharedAssociatedDataCache::the().buffer_for_file(data.release_value().release_value());
+                if (buffer.is_error()) {
+                    dbgln_if(HTTP_DISK_CACHE_DEBUG, "Unable to share cache associated data for {}: {}", m_url, buffer.error());
+                    break;
+                }
+                auto file = IPC::File::clone_fd(buffer.value().fd());
+                if (file.is_error())
+                    break;
+                associated_data_size = buffer.value().size();
+                associated_data = file.release_value();
+                break;
+            }
+
+            associated_data_size = data.value()->size;
+            associated_data = IPC::File::adopt_fd(data.value()->fd);
+            break;
         }
     } else if (m_cache_status == CacheStatus::WrittenToCache && m_cache_entry_writer.has_value()) {
-        javascript_bytecode_cache_vary_key = m_cache_entry_writer->vary_key();
+        disk_cache_vary_key = m_cache_entry_writer->vary_key();
     }
 
-    send_headers_to_client(move(javascript_bytecode), javascript_bytecode_size, javascript_bytecode_cache_vary_key);
+    send_headers_to_client(move(associated_data), associated_data_size, associated_data_type, disk_cache_vary_key);
 }
 
-void Request::send_headers_to_client(Optional<IPC::File> javascript_bytecode, u64 javascript_bytecode_size, Optional<u64> javascript_bytecode_cache_vary_key)
+void Request::send_headers_to_client(Optional<IPC::File> associated_data, u64 associated_data_size, HTTP::CacheEntryAssociatedData associated_data_type, Optional<u64> disk_cache_vary_key)
 {
     auto came_from_cache = m_cache_status == CacheStatus::ReadFromCache
         ? Requests::CameFromCache::Yes
         : Requests::CameFromCache::No;
-    m_client->async_headers_became_available(m_request_id, m_response_headers->headers(), m_status_code, m_reason_phrase, move(javascript_bytecode), javascript_bytecode_size, javascript_bytecode_cache_vary_key, came_from_cache);
+    m_client->async_headers_became_available(m_request_id, m_response_headers->headers(), m_status_code, m_reason_phrase, move(associated_data), associated_data_size, associated_data_type, disk_cache_vary_key, came_from_cache);
 }
 
 ErrorOr<void> Request::write_queued_bytes_without_blocking()
@@ -16,6 +16,7 @@
 #include <LibDNS/Resolver.h>
 #include <LibHTTP/Cache/CacheMode.h>
 #include <LibHTTP/Cache/CacheRequest.h>
+#include <LibHTTP/Cache/Utilities.h>
 #include <LibHTTP/Cookie/IncludeCredentials.h>
 #include <LibHTTP/HeaderList.h>
 #include <LibIPC/File.h>
@@ -106,6 +107,7 @@ private:
         WaitForCache,      // Wait for an existing cache entry to complete before proceeding.
         FailedCacheOnly,   // An only-if-cached request failed to find a cache entry.
         ServeSubstitution, // Serve content from a local file substitution.
+        ServeArchive,      // Serve content from a replayed page load archive.
         DNSLookup,         // Resolve the URL's host.
         RetrieveCookie,    // Retrieve cookies from the UI process.
         Connect,           // Issue a network request to connect to the URL.
@@ -127,6 +129,8 @@ private:
             return "FailedCacheOnly"sv;
         case State::ServeSubstitution:
             return "ServeSubstitution"sv;
+        case State::ServeArchive:
+            return "ServeArchive"sv;
         case State::DNSLookup:
             return "DNSLookup"sv;
         case State::RetrieveCookie:
@@ -174,6 +178,10 @@ private:
     void handle_read_cache_state();
     void handle_failed_cache_only_state();
     void handle_serve_substitution_state();
+    void handle_serve_archive_state();
+    void serve_archived_response(ArchivedResponse const&);
+    bool serve_next_archived_response_chunk(ArchivedResponse const&, size_t chunk_size);
+    void record_response_in_archive();
     void handle_dns_lookup_state();
     void handle_retrieve_cookie_state();
     void handle_connect_state();
@@ -190,7 +198,7 @@ private:
     ErrorOr<void> send_request_pipe_to_client();
     ErrorOr<void> send_transferred_body_file_to_client();
     void transfer_headers_to_client_if_needed();
-    void send_headers_to_client(Optional<IPC::File> javascript_bytecode = {}, u64 javascript_bytecode_size = 0, Optional<u64> javascript_bytecode_cache_vary_key = {});
+    void send_headers_to_client(Optional<IPC::File> associated_data = {}, u64 associated_data_size = 0, HTTP::CacheEntryAssociatedData associated_data_type = HTTP::CacheEntryAssociatedData::JavaScriptBytecode, Optional<u64> disk_cache_vary_key = {});
     ErrorOr<void> write_queued_bytes_without_blocking();
 
     virtual bool is_revalidation_request() const override;
@@ -246,6 +254,12 @@ private:
     Optional<Requests::NetworkError> m_network_error;
     bool m_content_decoding_disabled { false };
 
+    // The response body as it is received, while recording a page load archive.
+    ByteBuffer m_archived_response_body;
+    RefPtr<Core::Timer> m_archive_replay_timer;
+    RefPtr<Core::Timer> m_archive_replay_body_timer;
+    size_t m_archive_replay_offset { 0 };
+
     Optional<u32> m_address_selection_hint;
 
     bool m_keep_alive_for_transfer { false };
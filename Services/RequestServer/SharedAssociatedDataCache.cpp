@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumericLimits.h>
+#include <AK/ScopeGuard.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <RequestServer/SharedAssociatedDataCache.h>
+
+namespace RequestServer {
+
+// Buffers stay alive for as long as any client maps them, so this only bounds what is kept around for clients that
+// have yet to ask for them.
+static constexpr u64 MAXIMUM_TOTAL_SIZE = 64 * MiB;
+static constexpr u64 MAXIMUM_ENTRY_SIZE = MAXIMUM_TOTAL_SIZE / 4;
+
+SharedAssociatedDataCache& SharedAssociatedDataCache::the()
+{
+    static SharedAssociatedDataCache cache;
+    return cache;
+}
+
+ErrorOr<Core::AnonymousBuffer> SharedAssociatedDataCache::buffer_for_file(HTTP::CacheEntryBodyFile file)
+{
+    ScopeGuard close_file = [&] { (void)Core::System::close(file.fd); };
+
+    auto file_status = TRY(Core::System::fstat(file.fd));
+    FileIdentity identity { .device = static_cast<u64>(file_status.st_dev), .inode = static_cast<u64>(file_status.st_ino) };
+    auto modification_time = static_cast<i64>(file_status.st_mtime);
+
+    if (auto entry = m_entries.take(identity); entry.has_value()) {
+        // The disk cache replaces associated data by renaming a new file over the old one, which may reuse the inode.
+        if (entry->modification_time == modification_time && entry->size == file.size) {
+            auto buffer = entry->buffer;
+            m_entries.set(identity, entry.release_value());
+            return buffer;
+        }
+        m_total_size -= entry->size;
+    }
+
+    if (file.size > NumericLimits<size_t>::max())
+        return Error::from_errno(EOVERFLOW);
+
+    // Our own mapping of the buffer stays writable after its contents are sealed, so seal them before reading the file,
+    // which fails early where sealing isn't supported.
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(file.size, Core::AnonymousBuffer::Sealability::Sealable));
+    TRY(buffer.seal_contents());
+
+    if (file.size > 0) {
+        auto stream = TRY(Core::File::adopt_fd(file.fd, Core::File::OpenMode::Read, Core::File::ShouldCloseFileDescriptor::No));
+        TRY(stream->seek(static_cast<i64>(file.offset), SeekMode::SetPosition));
+        TRY(stream->read_until_filled({ buffer.data<u8>(), buffer.size() }));
+    }
+
+    if (file.size <= MAXIMUM_ENTRY_SIZE) {
+        m_entries.set(identity, { .modification_time = modification_time, .size = file.size, .buffer = buffer });
+        m_total_size += file.size;
+        evict_entries_exceeding_limit();
+    }
+
+    return buffer;
+}
+
+void SharedAssociatedDataCache::evict_entries_exceeding_limit()
+{
+    while (m_total_size > MAXIMUM_TOTAL_SIZE && !m_entries.is_empty()) {
+        auto least_recently_used = m_entries.begin();
+        m_total_size -= least_recently_used->value.size;
+        m_entries.remove(least_recently_used);
+    }
+}
+
+size_t SharedAssociatedDataCache::release_memory()
+{
+    auto released = m_total_size;
+    m_entries.clear();
+    m_total_size = 0;
+    return released;
+}
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/Traits.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibHTTP/Cache/CacheEntry.h>
+
+namespace RequestServer {
+
+// Hands out the associated data of disk cache entries as one buffer per file, whose contents are sealed, so that every
+// client process that asks for the same data maps the same memory read-only instead of receiving a private copy of it.
+// This is meant for data that clients use directly from the buffer for as long as they need it, such as decoded fonts.
+class SharedAssociatedDataCache {
+    AK_MAKE_NONCOPYABLE(SharedAssociatedDataCache);
+    AK_MAKE_NONMOVABLE(SharedAssociatedDataCache);
+
+public:
+    static SharedAssociatedDataCache& the();
+
+    // Takes ownership of the file's fd. Fails if the buffer can't be shared read-only on this platform.
+    ErrorOr<Core::AnonymousBuffer> buffer_for_file(HTTP::CacheEntryBodyFile);
+
+    // Returns the number of bytes that are no longer kept alive by this cache. Clients that still map a buffer keep it
+    // alive until they are done with it.
+    size_t release_memory();
+
+private:
+    SharedAssociatedDataCache() = default;
+
+    struct FileIdentity {
+        u64 device { 0 };
+        u64 inode { 0 };
+
+        bool operator==(FileIdentity const&) const = default;
+    };
+
+    struct FileIdentityTraits : public DefaultTraits<FileIdentity> {
+        static unsigned hash(FileIdentity const& identity) { return pair_int_hash(u64_hash(identity.device), u64_hash(identity.inode)); }
+    };
+
+    struct Entry {
+        i64 modification_time { 0 };
+        u64 size { 0 };
+        Core::AnonymousBuffer buffer;
+    };
+
+    void evict_entries_exceeding_limit();
+
+    // Ordered from least to most recently used.
+    OrderedHashMap<FileIdentity, Entry, FileIdentityTraits> m_entries;
+    u64 m_total_size { 0 };
+};
+
+}
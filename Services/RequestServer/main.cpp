@@ -11,6 +11,7 @@
 #include <AK/Vector.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/MemoryPressure.h>
 #include <LibCore/Process.h>
 #include <LibCore/System.h>
 #include <LibHTTP/Cache/DiskCache.h>
@@ -18,13 +19,16 @@
 #include <LibMain/Main.h>
 #include <RequestServer/CURL.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/PageLoadArchive.h>
 #include <RequestServer/Resolver.h>
 #include <RequestServer/ResourceSubstitutionMap.h>
 #include <RequestServer/Sandbox.h>
+#include <RequestServer/SharedAssociatedDataCache.h>
 
 namespace RequestServer {
 
 OwnPtr<ResourceSubstitutionMap> g_resource_substitution_map;
+OwnPtr<PageLoadArchive> g_page_load_archive;
 
 }
 
@@ -44,6 +48,10 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     StringView mach_server_name;
     StringView http_disk_cache_mode;
     StringView resource_map_path;
+    StringView record_archive_path;
+    StringView replay_archive_path;
+    u64 replay_latency_ms = 0;
+    Optional<u64> replay_bandwidth;
     StringView cache_path;
     bool wait_for_debugger = false;
     bool disable_sandbox = false;
@@ -53,6 +61,10 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(http_disk_cache_mode, "HTTP disk cache mode", "http-disk-cache-mode", 0, "mode");
     args_parser.add_option(resource_map_path, "Path to JSON file mapping URLs to local files", "resource-map", 0, "path");
+    args_parser.add_option(record_archive_path, "Record all network responses to a page load archive", "record-archive", 0, "path");
+    args_parser.add_option(replay_archive_path, "Serve all responses from a page load archive", "replay-archive", 0, "path");
+    args_parser.add_option(replay_latency_ms, "Latency added to every replayed response", "replay-latency", 0, "ms");
+    args_parser.add_option(replay_bandwidth, "Rate at which replayed response bodies arrive", "replay-bandwidth", 0, "bytes-per-second");
     args_parser.add_option(cache_path, "Path to the profile cache", "cache-path", 0, "path");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
     args_parser.add_option(disable_sandbox, "Disable process sandboxing", "disable-sandbox");
@@ -73,6 +85,19 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             RequestServer::g_resource_substitution_map = map.release_value();
     }
 
+    if (!replay_archive_path.is_empty()) {
+        RequestServer::PageLoadArchive::ReplayOptions replay_options {
+            .latency = AK::Duration::from_milliseconds(static_cast<i64>(replay_latency_ms)),
+            .bandwidth = replay_bandwidth,
+        };
+        RequestServer::g_page_load_archive = TRY(RequestServer::PageLoadArchive::load_for_replay(replay_archive_path, replay_options));
+    } else if (!record_archive_path.is_empty()) {
+        RequestServer::g_page_load_archive = TRY(RequestServer::PageLoadArchive::create_for_recording(record_archive_path));
+
+        // Responses served from the disk cache do not pass through the network, and would be missing from the archive.
+        http_disk_cache_mode = "disabled"sv;
+    }
+
 #if !defined(AK_OS_WINDOWS)
     MUST(Core::System::signal(SIGPIPE, SIG_IGN));
 #endif
@@ -101,6 +126,15 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             disk_cache = cache.release_value();
     }
 
+    if (disk_cache.has_value()) {
+        Core::MemoryPressure::register_handler("HTTP disk cache index"sv, [&](auto) {
+            return disk_cache->release_memory();
+        });
+        Core::MemoryPressure::register_handler("Shared cache associated data"sv, [](auto) {
+            return RequestServer::SharedAssociatedDataCache::the().release_memory();
+        });
+    }
+
     TRY(RequestServer::initialize_libcurl());
 
     if (!disable_sandbox)
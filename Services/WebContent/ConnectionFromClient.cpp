@@ -17,14 +17,17 @@
 #include <AK/QuickSort.h>
 #include <AK/Utf16FlyString.h>
 #include <AK/Utf16String.h>
+#include <LibCore/MemoryPressure.h>
 #include <LibCore/Process.h>
 #include <LibCore/System.h>
+#include <LibCore/Tracing.h>
 #include <LibDevTools/IndexedDBSerialization.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Color.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
+#include <LibIPC/MessageStatistics.h>
 #include <LibIPC/Transport.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
@@ -97,6 +100,8 @@ ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transpo
     : IPC::ConnectionFromClient<WebContentClientEndpoint, WebContentServerEndpoint>(*this, move(transport), 1)
     , m_page_host(PageHost::create(*this))
 {
+    // Frame notifications, hover and scroll updates and the like are sent back to the UI every frame.
+    enable_shared_memory_ring(1 * MiB);
 }
 
 ConnectionFromClient::~ConnectionFromClient() = default;
@@ -1895,6 +1900,42 @@ void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::Page
     async_did_get_internal_page_info(page_id, type, buffer);
 }
 
+void ConnectionFromClient::request_page_load_timings(u64 page_id)
+{
+    auto page = this->page(page_id);
+    if (!page.has_value()) {
+        async_did_get_page_load_timings(page_id, {});
+        return;
+    }
+
+    async_did_get_page_load_timings(page_id, page->page().page_load_timings());
+}
+
+void ConnectionFromClient::request_ipc_statistics(u64 request_id)
+{
+    async_did_get_ipc_statistics(request_id, IPC::MessageStatistics::snapshot().serialized());
+}
+
+void ConnectionFromClient::set_tracing_enabled(bool enabled)
+{
+    Core::Tracing::set_enabled(enabled);
+}
+
+void ConnectionFromClient::collect_trace(u64 request_id)
+{
+    auto events = MUST(Core::Tracing::take_serialized_events("WebContent"sv));
+    auto buffer = MUST(Core::AnonymousBuffer::create_with_size(events.size()));
+    events.bytes().copy_to(buffer.bytes());
+
+    async_did_collect_trace(request_id, move(buffer), MonotonicTime::now().nanoseconds());
+}
+
+void ConnectionFromClient::release_memory(Core::MemoryPressure::Level level)
+{
+    auto report = Core::MemoryPressure::release_memory(level);
+    async_did_release_memory(level, report.total_bytes_released());
+}
+
 Messages::WebContentServer::GetSelectedTextResponse ConnectionFromClient::get_selected_text(u64 page_id)
 {
     if (auto page = this->page(page_id); page.has_value())
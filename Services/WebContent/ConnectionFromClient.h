@@ -212,6 +212,12 @@ private:
     virtual void take_dom_node_screenshot(u64 page_id, Web::UniqueNodeID node_id) override;
 
     virtual void request_internal_page_info(u64 page_id, WebView::PageInfoType) override;
+    virtual void request_page_load_timings(u64 page_id) override;
+    virtual void request_ipc_statistics(u64 request_id) override;
+
+    virtual void set_tracing_enabled(bool) override;
+    virtual void collect_trace(u64 request_id) override;
+    virtual void release_memory(Core::MemoryPressure::Level) override;
 
     virtual Messages::WebContentServer::GetSelectedTextResponse get_selected_text(u64 page_id) override;
     virtual Messages::WebContentServer::GetSelectedTextForLookupResponse get_selected_text_for_lookup(u64 page_id) override;
@@ -12,6 +12,7 @@
 #include <LibCore/Resource.h>
 #include <LibCore/System.h>
 #include <LibCore/TimeZone.h>
+#include <LibCore/Tracing.h>
 #include <LibCrypto/OpenSSLForward.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/PathFontProvider.h>
@@ -31,6 +32,7 @@
 #include <LibWeb/Painting/BoxViews.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/FontPlugin.h>
+#include <LibWeb/Platform/MemoryPressure.h>
 #include <LibWebView/Plugins/ImageCodecPlugin.h>
 #include <LibWebView/SiteIsolation.h>
 #include <LibWebView/Utilities.h>
@@ -153,6 +155,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     StringView echo_server_port_string_view {};
     StringView default_time_zone {};
     bool file_origins_are_tuple_origins = false;
+    bool enable_tracing = false;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(config_path, "Ladybird configuration path", "config-path", 0, "config_path");
@@ -188,9 +191,13 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(is_headless, "Report that the browser is running in headless mode", "headless");
     args_parser.add_option(default_time_zone, "Default time zone", "default-time-zone", 0, "time-zone-id");
     args_parser.add_option(file_origins_are_tuple_origins, "Treat file:// URLs as having tuple origins", "tuple-file-origins");
+    args_parser.add_option(enable_tracing, "Record trace events from startup", "enable-tracing");
 
     args_parser.parse(arguments);
 
+    if (enable_tracing)
+        Core::Tracing::set_enabled(true);
+
     if (wait_for_debugger) {
         Core::Process::wait_for_debugger_and_break();
     }
@@ -236,6 +243,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     Web::Platform::FontPlugin::install(*new Web::Platform::FontPlugin(enable_test_mode, &font_provider));
 
     Web::Bindings::initialize_main_thread_vm(Web::HTML::AgentType::SimilarOriginWindow);
+    Web::Platform::register_memory_pressure_handlers();
 
     if (collect_garbage_on_every_allocation)
         Web::Bindings::main_thread_vm().heap().set_should_collect_on_every_allocation(true);
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/MemoryPressure.h>
 #include <LibCore/Process.h>
 #include <LibCore/System.h>
 #include <LibWeb/HTML/BroadcastChannel.h>
@@ -160,6 +161,12 @@ void ConnectionFromClient::handle_file_return(i32 error, Optional<IPC::File> fil
     file_request.value().on_file_request_finish(error != 0 ? Error::from_errno(error) : ErrorOr<i32> { file->take_fd() });
 }
 
+void ConnectionFromClient::release_memory(Core::MemoryPressure::Level level)
+{
+    auto report = Core::MemoryPressure::release_memory(level);
+    async_did_release_memory(level, report.total_bytes_released());
+}
+
 void ConnectionFromClient::did_worker_agent_finish_loading_script(Web::HTML::WorkerAgentOwnerToken owner_token)
 {
     Web::HTML::WorkerAgentParent::did_finish_loading_worker_script(owner_token);
@@ -18,6 +18,7 @@
 #include <LibWeb/HTML/DedicatedWorkerGlobalScope.h>
 #include <LibWeb/HTML/MessageEvent.h>
 #include <LibWeb/HTML/MessagePort.h>
+#include <LibWeb/HTML/Scripting/Agent.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/Scripting/EnvironmentSettingsSnapshot.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
@@ -66,6 +67,12 @@ void WorkerHost::run(GC::Ref<Web::Page> page, Web::HTML::TransferDataEncoder mes
     // 3. Let unsafeWorkerCreationTime be the unsafe shared current time.
     auto unsafe_worker_creation_time = Web::HighResolutionTime::unsafe_shared_current_time();
 
+    // 4. Let agent be the result of obtaining a dedicated/shared worker agent given outside settings and is shared.
+    // NB: This process already has its agent. A dedicated worker's agent joins the agent cluster of outside settings's
+    //     agent, while a shared worker's agent keeps the new agent cluster it was created with.
+    if (!is_shared)
+        static_cast<Web::HTML::Agent&>(*Web::Bindings::main_thread_vm().agent()).agent_cluster_id = outside_settings_snapshot.agent_cluster_id;
+
     // 5. Let realm execution context be the result of creating a new realm given agent and the following customizations:
     auto realm_execution_context = Web::Bindings::create_a_new_javascript_realm(
         Web::Bindings::main_thread_vm(),
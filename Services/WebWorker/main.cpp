@@ -23,6 +23,7 @@
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/FontPlugin.h>
+#include <LibWeb/Platform/MemoryPressure.h>
 #include <LibWebView/Plugins/ImageCodecPlugin.h>
 #include <LibWebView/Utilities.h>
 #include <Services/RendererSandbox.h>
@@ -102,6 +103,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     Web::Platform::FontPlugin::install(*new Web::Platform::FontPlugin(false));
 
     Web::Bindings::initialize_main_thread_vm(worker_type);
+    Web::Platform::register_memory_pressure_handlers();
 
     if (!disable_sandbox)
         TRY(RendererSandbox::apply_sandbox({}, cache_path));
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <AK/Random.h>
+#include <LibCompress/Zstd.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(zstd_decompress_simple)
+{
+    Array<u8, 24> const compressed {
+        0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x0f, 0x79, 0x00, 0x00, 0x65, 0x78, 0x70,
+        0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74
+    };
+
+    u8 const uncompressed[] = "expected output";
+
+    auto const decompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed));
+    EXPECT(decompressed.bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
+}
+
+TEST_CASE(zstd_decompress_empty)
+{
+    Array<u8, 9> const compressed { 0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x00, 0x01, 0x00, 0x00 };
+
+    auto const decompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed));
+    EXPECT(decompressed.is_empty());
+}
+
+TEST_CASE(zstd_round_trip)
+{
+    auto original = ByteBuffer::create_uninitialized(1024).release_value();
+    fill_with_random(original);
+
+    auto compressed = TRY_OR_FAIL(Compress::ZstdCompressor::compress_all(original));
+    auto uncompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed));
+    EXPECT(uncompressed == original);
+}
+
+TEST_CASE(zstd_round_trip_larger_than_buffers)
+{
+    auto original = ByteBuffer::create_zeroed(1 * MiB).release_value();
+    for (size_t i = 0; i < original.size(); i += 4096)
+        original[i] = static_cast<u8>(i / 4096);
+
+    auto compressed = TRY_OR_FAIL(Compress::ZstdCompressor::compress_all(original));
+    EXPECT(compressed.size() < original.size());
+
+    auto uncompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed));
+    EXPECT(uncompressed == original);
+}
+
+TEST_CASE(zstd_compression_levels)
+{
+    Array compression_levels {
+        Compress::ZstdCompressionLevel::Fastest,
+        Compress::ZstdCompressionLevel::Default,
+        Compress::ZstdCompressionLevel::Best,
+    };
+
+    auto original = "Ladybird zstd compression level test data"sv.bytes();
+    for (auto compression_level : compression_levels) {
+        auto compressed = TRY_OR_FAIL(Compress::ZstdCompressor::compress_all(original, compression_level));
+        auto uncompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed));
+        EXPECT(uncompressed == original);
+    }
+}
+
+TEST_CASE(zstd_truncated_input)
+{
+    Array<u8, 20> const compressed {
+        0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x0f, 0x79, 0x00, 0x00, 0x65,
+        0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6f, 0x75
+    };
+
+    auto const decompressed = Compress::ZstdDecompressor::decompress_all(compressed);
+    EXPECT(decompressed.is_error());
+}
+
+TEST_CASE(zstd_trailing_data)
+{
+    Array<u8, 25> const compressed {
+        0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x0f, 0x79, 0x00, 0x00, 0x65, 0x78, 0x70,
+        0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+        0x00
+    };
+
+    auto const decompressed = Compress::ZstdDecompressor::decompress_all(compressed);
+    EXPECT(decompressed.is_error());
+}
+
+TEST_CASE(zstd_streamed_input)
+{
+    auto original = ByteBuffer::create_uninitialized(64 * KiB).release_value();
+    fill_with_random(original);
+    auto compressed = TRY_OR_FAIL(Compress::ZstdCompressor::compress_all(original));
+
+    auto input_stream = make<AllocatingMemoryStream>();
+    auto decompressor = TRY_OR_FAIL(Compress::ZstdDecompressor::create(MaybeOwned<Stream> { *input_stream }));
+
+    ByteBuffer output;
+    Array<u8, 4096> buffer;
+    for (size_t offset = 0; offset < compressed.size(); offset += 1000) {
+        TRY_OR_FAIL(input_stream->write_until_depleted(compressed.bytes().slice(offset, min<size_t>(1000, compressed.size() - offset))));
+        while (!input_stream->is_eof()) {
+            auto decompressed = TRY_OR_FAIL(decompressor->read_some(buffer));
+            output.append(decompressed);
+        }
+    }
+
+    while (!decompressor->is_eof()) {
+        auto decompressed = TRY_OR_FAIL(decompressor->read_some(buffer));
+        output.append(decompressed);
+    }
+
+    EXPECT(output == original);
+}
@@ -15,6 +15,7 @@
 #    include <AK/Windows.h>
 #else
 #    include <fcntl.h>
+#    include <sys/mman.h>
 #endif
 
 TEST_CASE(create_with_size)
@@ -132,6 +133,36 @@ TEST_CASE(snapshot_rejects_a_buffer_larger_than_its_backing_store)
 }
 #endif
 
+#if defined(AK_OS_LINUX) && defined(F_SEAL_FUTURE_WRITE)
+TEST_CASE(buffers_with_sealed_contents_are_mapped_read_only)
+{
+    auto original = MUST(Core::AnonymousBuffer::create_with_size(128, Core::AnonymousBuffer::Sealability::Sealable));
+
+    auto const payload = "shared read-only"sv;
+    memcpy(original.data<void>(), payload.characters_without_null_termination(), payload.length());
+    MUST(original.seal_contents());
+    MUST(original.validate_sealed_size());
+
+    auto fd = MUST(Core::System::dup(original.fd()));
+    auto mirror = MUST(Core::AnonymousBuffer::create_from_anon_fd(fd, original.size()));
+    EXPECT_EQ(StringView(mirror.data<char const>(), payload.length()), payload);
+
+    // The new mapping can't be made writable, and the fd can't be mapped writable either.
+    EXPECT_EQ(mprotect(mirror.data<void>(), PAGE_SIZE, PROT_READ | PROT_WRITE), -1);
+    EXPECT_EQ(mmap(nullptr, PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, mirror.fd(), 0), MAP_FAILED);
+
+    // The mapping that existed before the contents were sealed stays writable.
+    original.data<char>()[0] = 'S';
+    EXPECT_EQ(mirror.data<char const>()[0], 'S');
+}
+
+TEST_CASE(sealing_the_contents_requires_a_sealable_buffer)
+{
+    auto buffer = MUST(Core::AnonymousBuffer::create_with_size(128));
+    EXPECT(buffer.seal_contents().is_error());
+}
+#endif
+
 #ifndef AK_OS_WINDOWS
 TEST_CASE(failed_creation_from_an_fd_closes_the_fd)
 {
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/MemoryPressure.h>
+#include <LibCore/MemoryPressureMonitor.h>
+#include <LibTest/TestCase.h>
+
+using Level = Core::MemoryPressure::Level;
+
+TEST_CASE(handlers_run_in_registration_order)
+{
+    Vector<Level> first_levels;
+    size_t second_call_count = 0;
+
+    Core::MemoryPressure::register_handler("First"sv, [&](Level level) -> size_t {
+        first_levels.append(level);
+        return 100;
+    });
+    Core::MemoryPressure::register_handler("Second"sv, [&](Level) -> size_t {
+        ++second_call_count;
+        return 23;
+    });
+
+    // There is nothing to do without any pressure.
+    auto report = Core::MemoryPressure::release_memory(Level::None);
+    EXPECT(report.results.is_empty());
+
+    report = Core::MemoryPressure::release_memory(Level::Critical);
+    EXPECT_EQ(report.level, Level::Critical);
+    EXPECT_EQ(report.results.size(), 2u);
+    EXPECT_EQ(report.results[0].name, "First"sv);
+    EXPECT_EQ(report.results[1].name, "Second"sv);
+    EXPECT_EQ(report.total_bytes_released(), 123u);
+
+    EXPECT_EQ(first_levels, (Vector<Level> { Level::Critical }));
+    EXPECT_EQ(second_call_count, 1u);
+}
+
+TEST_CASE(parse_pressure_stall_information)
+{
+    auto information = Core::MemoryPressure::parse_pressure_stall_information(
+        "some avg10=12.50 avg60=3.00 avg300=1.00 total=123456\n"
+        "full avg10=1.25 avg60=0.50 avg300=0.10 total=6543\n"sv);
+    EXPECT(information.has_value());
+    EXPECT_APPROXIMATE(information->some_average_10_seconds, 12.5);
+    EXPECT_APPROXIMATE(information->full_average_10_seconds, 1.25);
+
+    // Older kernels do not report full stalls for the whole system.
+    information = Core::MemoryPressure::parse_pressure_stall_information("some avg10=0.00 avg60=0.00 avg300=0.00 total=0\n"sv);
+    EXPECT(information.has_value());
+    EXPECT_APPROXIMATE(information->full_average_10_seconds, 0.0);
+
+    EXPECT(!Core::MemoryPressure::parse_pressure_stall_information(""sv).has_value());
+    EXPECT(!Core::MemoryPressure::parse_pressure_stall_information("some avg10=garbage\n"sv).has_value());
+}
+
+TEST_CASE(parse_cgroup_files)
+{
+    EXPECT_EQ(Core::MemoryPressure::parse_cgroup_path("0::/user.slice/kiosk.service\n"sv), "/user.slice/kiosk.service"sv);
+    EXPECT_EQ(Core::MemoryPressure::parse_cgroup_path("12:memory:/legacy\n0::/\n"sv), "/"sv);
+    EXPECT(!Core::MemoryPressure::parse_cgroup_path("12:memory:/legacy\n"sv).has_value());
+
+    auto memory_stat = "anon 1000\nfile 5000\nactive_file 2000\ninactive_file 3000\n"sv;
+    EXPECT_EQ(Core::MemoryPressure::parse_cgroup_memory_stat_field(memory_stat, "inactive_file"sv), 3000u);
+    EXPECT_EQ(Core::MemoryPressure::parse_cgroup_memory_stat_field(memory_stat, "file"sv), 5000u);
+    EXPECT(!Core::MemoryPressure::parse_cgroup_memory_stat_field(memory_stat, "shmem"sv).has_value());
+}
+
+TEST_CASE(level_from_pressure_stall_information)
+{
+    using Core::MemoryPressure::level_for;
+    using Core::MemoryPressure::PressureStallInformation;
+
+    EXPECT_EQ(level_for({}, {}), Level::None);
+    EXPECT_EQ(level_for(PressureStallInformation { .some_average_10_seconds = 2, .full_average_10_seconds = 0 }, {}), Level::None);
+    EXPECT_EQ(level_for(PressureStallInformation { .some_average_10_seconds = 15, .full_average_10_seconds = 2 }, {}), Level::Moderate);
+    EXPECT_EQ(level_for(PressureStallInformation { .some_average_10_seconds = 40, .full_average_10_seconds = 20 }, {}), Level::Critical);
+}
+
+TEST_CASE(level_from_cgroup_usage)
+{
+    using Core::MemoryPressure::CgroupMemoryUsage;
+    using Core::MemoryPressure::level_for;
+
+    static constexpr u64 limit = 4 * GiB;
+
+    EXPECT_EQ(level_for({}, CgroupMemoryUsage { .current_bytes = 2 * GiB, .limit_bytes = limit, .inactive_file_bytes = 0 }), Level::None);
+    EXPECT_EQ(level_for({}, CgroupMemoryUsage { .current_bytes = limit * 9 / 10, .limit_bytes = limit, .inactive_file_bytes = 0 }), Level::Moderate);
+    EXPECT_EQ(level_for({}, CgroupMemoryUsage { .current_bytes = limit, .limit_bytes = limit, .inactive_file_bytes = 0 }), Level::Critical);
+
+    // Page cache that can be dropped for free does not count.
+    EXPECT_EQ(level_for({}, CgroupMemoryUsage { .current_bytes = limit, .limit_bytes = limit, .inactive_file_bytes = 1 * GiB }), Level::None);
+}
+
+class TestMemoryPressureMonitor final : public Core::MemoryPressureMonitor {
+public:
+    using MemoryPressureMonitor::did_sample_level;
+};
+
+TEST_CASE(monitor_notifies_when_pressure_rises_and_periodically_while_it_lasts)
+{
+    TestMemoryPressureMonitor monitor;
+
+    Vector<Level> notifications;
+    monitor.on_memory_pressure = [&](Level level) { notifications.append(level); };
+
+    auto start = MonotonicTime::now();
+    auto at = [&](i64 seconds) { return start + AK::Duration::from_seconds(seconds); };
+
+    monitor.did_sample_level(Level::None, at(0));
+    EXPECT(notifications.is_empty());
+
+    monitor.did_sample_level(Level::Moderate, at(2));
+    monitor.did_sample_level(Level::Moderate, at(4));
+    EXPECT_EQ(notifications, (Vector<Level> { Level::Moderate }));
+
+    // Rising pressure is reported right away, falling pressure is not.
+    monitor.did_sample_level(Level::Critical, at(6));
+    monitor.did_sample_level(Level::Moderate, at(8));
+    EXPECT_EQ(notifications, (Vector<Level> { Level::Moderate, Level::Critical }));
+    EXPECT_EQ(monitor.level(), Level::Moderate);
+
+    // Caches fill up again while the pressure lasts.
+    monitor.did_sample_level(Level::Moderate, at(40));
+    EXPECT_EQ(notifications, (Vector<Level> { Level::Moderate, Level::Critical, Level::Moderate }));
+
+    monitor.did_sample_level(Level::None, at(42));
+    monitor.did_sample_level(Level::Moderate, at(44));
+    EXPECT_EQ(notifications.size(), 4u);
+}
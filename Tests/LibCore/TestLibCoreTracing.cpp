@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibCore/Tracing.h>
+#include <LibTest/TestCase.h>
+
+static JsonArray take_events()
+{
+    auto serialized = MUST(Core::Tracing::take_serialized_events("Test"sv));
+    auto json = MUST(JsonValue::from_string(serialized));
+    VERIFY(json.is_array());
+    return json.as_array();
+}
+
+static Vector<JsonObject> events_with_phase(JsonArray const& events, StringView phase)
+{
+    Vector<JsonObject> result;
+    for (auto const& event : events.values()) {
+        if (event.as_object().get_string("ph"sv) == phase)
+            result.append(event.as_object());
+    }
+    return result;
+}
+
+TEST_CASE(nothing_is_recorded_while_disabled)
+{
+    Core::Tracing::set_enabled(false);
+    (void)take_events();
+
+    {
+        Core::Tracing::Scope scope { "test", "Disabled" };
+        Core::Tracing::counter("test", "Counter", 1);
+        Core::Tracing::flow_start("test", "Flow", Core::Tracing::generate_flow_id());
+    }
+
+    auto events = take_events();
+    EXPECT(events_with_phase(events, "M"sv).size() >= 1);
+    EXPECT(events_with_phase(events, "B"sv).is_empty());
+    EXPECT(events_with_phase(events, "C"sv).is_empty());
+    EXPECT(events_with_phase(events, "s"sv).is_empty());
+}
+
+TEST_CASE(scopes_and_counters)
+{
+    Core::Tracing::set_enabled(true);
+    (void)take_events();
+
+    {
+        Core::Tracing::Scope scope { "test", "Outer" };
+        Core::Tracing::counter("test", "Counter", 42);
+    }
+
+    auto events = take_events();
+    Core::Tracing::set_enabled(false);
+
+    auto begin_events = events_with_phase(events, "B"sv);
+    auto end_events = events_with_phase(events, "E"sv);
+    auto counter_events = events_with_phase(events, "C"sv);
+
+    EXPECT_EQ(begin_events.size(), 1u);
+    EXPECT_EQ(end_events.size(), 1u);
+    EXPECT_EQ(begin_events[0].get_string("name"sv).value(), "Outer"sv);
+    EXPECT(begin_events[0].get_double_with_precision_loss("ts"sv).value() <= end_events[0].get_double_with_precision_loss("ts"sv).value());
+
+    EXPECT_EQ(counter_events.size(), 1u);
+    EXPECT_EQ(counter_events[0].get_object("args"sv)->get_integer<i64>("value"sv).value(), 42);
+
+    // Collecting the events clears them.
+    EXPECT(events_with_phase(take_events(), "B"sv).is_empty());
+}
+
+TEST_CASE(scope_entered_while_disabled_is_not_recorded)
+{
+    Core::Tracing::set_enabled(false);
+    (void)take_events();
+
+    {
+        Core::Tracing::Scope scope { "test", "StartedWhileDisabled" };
+        Core::Tracing::set_enabled(true);
+    }
+
+    auto events = take_events();
+    Core::Tracing::set_enabled(false);
+
+    EXPECT(events_with_phase(events, "B"sv).is_empty());
+    EXPECT(events_with_phase(events, "E"sv).is_empty());
+}
+
+TEST_CASE(flow_events)
+{
+    auto first_id = Core::Tracing::generate_flow_id();
+    auto second_id = Core::Tracing::generate_flow_id();
+    EXPECT_NE(first_id, 0u);
+    EXPECT_NE(first_id, second_id);
+
+    Core::Tracing::set_enabled(true);
+    (void)take_events();
+
+    Core::Tracing::flow_start("test", "Frame", first_id);
+    Core::Tracing::flow_end("test", "Frame", first_id);
+    Core::Tracing::flow_end("test", "Frame", 0);
+
+    auto events = take_events();
+    Core::Tracing::set_enabled(false);
+
+    auto flow_starts = events_with_phase(events, "s"sv);
+    auto flow_ends = events_with_phase(events, "f"sv);
+    EXPECT_EQ(flow_starts.size(), 1u);
+    EXPECT_EQ(flow_ends.size(), 1u);
+    EXPECT_EQ(flow_starts[0].get_string("id"sv).value(), MUST(String::formatted("{:#x}", first_id)));
+    EXPECT_EQ(flow_ends[0].get_string("id"sv).value(), MUST(String::formatted("{:#x}", first_id)));
+    EXPECT_EQ(flow_ends[0].get_string("bp"sv).value(), "e"sv);
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/NeverDestroyed.h>
+#include <LibGC/Cell.h>
+#include <LibGC/CellAllocator.h>
+#include <LibGC/Heap.h>
+#include <LibTest/TestCase.h>
+
+class TestCell : public GC::Cell {
+    GC_CELL(TestCell, GC::Cell);
+    GC_DECLARE_ALLOCATOR(TestCell);
+
+    // Padding to satisfy minimum cell size (must be >= sizeof(FreelistEntry)).
+    u8 m_padding[16] {};
+};
+
+GC_DEFINE_ALLOCATOR(TestCell);
+
+static GC::Heap& test_heap()
+{
+    static AK::NeverDestroyed<GC::Heap> heap([](auto&) { });
+    return *heap;
+}
+
+TEST_SETUP
+{
+    GC::Heap::set_default_heap_for_testing(test_heap());
+}
+
+// Enables sampling on a clean profile, and disables it again even if the test fails part-way through.
+class ScopedAllocationSampling {
+public:
+    explicit ScopedAllocationSampling(size_t sample_interval, Function<String()> site_provider = {})
+    {
+        auto& profiler = test_heap().allocation_profiler();
+        profiler.set_sample_interval(0);
+        profiler.reset();
+        profiler.set_site_provider(move(site_provider));
+        profiler.set_sample_interval(sample_interval);
+    }
+
+    ~ScopedAllocationSampling()
+    {
+        auto& profiler = test_heap().allocation_profiler();
+        profiler.set_sample_interval(0);
+        profiler.set_site_provider({});
+        profiler.reset();
+    }
+};
+
+static Optional<JsonObject const&> find_test_cell_site(JsonArray const& sites, bool is_native, Optional<StringView> stack = {})
+{
+    for (auto const& entry : sites.values()) {
+        auto const& site = entry.as_object();
+        if (site.get_string("class_name"sv) != "TestCell"sv || site.get_bool("is_native"sv) != is_native)
+            continue;
+        if (stack.has_value() && site.get_string("stack"sv) != *stack)
+            continue;
+        return site;
+    }
+    return {};
+}
+
+static Optional<JsonObject const&> find_test_cell_allocator(JsonArray const& allocators)
+{
+    for (auto const& entry : allocators.values()) {
+        if (entry.as_object().get_string("class_name"sv) == "TestCell"sv)
+            return entry.as_object();
+    }
+    return {};
+}
+
+static void allocate_test_cells(size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        (void)test_heap().allocate<TestCell>();
+}
+
+TEST_CASE(nothing_is_sampled_while_disabled)
+{
+    ScopedAllocationSampling sampling { 0 };
+    EXPECT(!test_heap().allocation_profiler().is_enabled());
+
+    allocate_test_cells(1000);
+
+    auto profile = test_heap().dump_allocation_profile();
+    EXPECT(profile.get_array("sites"sv)->is_empty());
+    EXPECT(profile.get_array("timeline"sv)->is_empty());
+}
+
+TEST_CASE(samples_are_attributed_to_the_site_provider)
+{
+    ScopedAllocationSampling sampling { sizeof(TestCell) * 10, [] { return "allocate_test_cells (test.js:1:1)"_string; } };
+
+    allocate_test_cells(1000);
+
+    auto profile = test_heap().dump_allocation_profile();
+    auto site = find_test_cell_site(*profile.get_array("sites"sv), false, "allocate_test_cells (test.js:1:1)"sv);
+    EXPECT(site.has_value());
+    EXPECT_EQ(site->get_u64("samples"sv).value(), 100u);
+    EXPECT_EQ(site->get_u64("estimated_bytes"sv).value(), 100 * sizeof(TestCell) * 10);
+    EXPECT(!profile.get_array("timeline"sv)->is_empty());
+}
+
+TEST_CASE(samples_without_a_site_provider_are_native)
+{
+    ScopedAllocationSampling sampling { sizeof(TestCell) };
+
+    allocate_test_cells(10);
+
+    auto profile = test_heap().dump_allocation_profile();
+    EXPECT(!find_test_cell_site(*profile.get_array("sites"sv), false).has_value());
+
+    auto site = find_test_cell_site(*profile.get_array("sites"sv), true);
+    EXPECT(site.has_value());
+    EXPECT(!site->get_string("stack"sv)->is_empty());
+}
+
+TEST_CASE(block_occupancy_is_reported_per_allocator)
+{
+    allocate_test_cells(100);
+
+    auto profile = test_heap().dump_allocation_profile();
+    auto allocator = find_test_cell_allocator(*profile.get_array("allocators"sv));
+    EXPECT(allocator.has_value());
+
+    auto block_count = allocator->get_u64("block_count"sv).value();
+    EXPECT(block_count > 0);
+    EXPECT(allocator->get_u64("live_cells"sv).value() <= allocator->get_u64("total_cells"sv).value());
+
+    auto const& histogram = *allocator->get_array("occupancy_histogram"sv);
+    EXPECT_EQ(histogram.size(), 11u);
+    u64 histogram_block_count = 0;
+    for (auto const& bucket : histogram.values())
+        histogram_block_count += bucket.get_u64().value();
+    EXPECT_EQ(histogram_block_count, block_count);
+}
@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ScopeGuard.h>
 #include <LibCore/MappedFile.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/PathFontProvider.h>
+#include <LibGfx/Font/ShapingCache.h>
 #include <LibGfx/Font/Typeface.h>
 #include <LibGfx/TextLayout.h>
 #include <LibTest/TestCase.h>
@@ -151,3 +153,67 @@ TEST_CASE(glyph_run_intercepts)
     // A degenerate scale produces nothing.
     EXPECT(run->get_glyph_intercepts(0, mid_x_height - 1, mid_x_height + 1).is_empty());
 }
+
+// Runs that share words reuse the shapes of those words, and the result matches shaping each word on its own.
+TEST_CASE(shaping_cache_reuses_words_across_runs)
+{
+    // NB: Runs are only split into words for fonts whose space glyph takes no part in ligatures or kerning.
+    auto font = load_text_font(16);
+    if (font->has_space_in_ligatures_or_kerning()) {
+        FAIL("The space glyph of the test font takes part in ligatures or kerning");
+        return;
+    }
+
+    auto& shaping_cache = Gfx::GlobalShapingCache::the();
+    shaping_cache.purge();
+
+    // NB: Purging keeps the statistics, which earlier tests may have added to.
+    auto statistics_before_first_run = shaping_cache.statistics();
+    auto first_run = shape(font, "the quick brown fox jumps "sv);
+    auto statistics_after_first_run = shaping_cache.statistics();
+    EXPECT_EQ(statistics_after_first_run.segment_misses - statistics_before_first_run.segment_misses, 5u);
+
+    auto second_run = shape(font, "the lazy brown dog jumps "sv);
+    auto statistics_after_second_run = shaping_cache.statistics();
+    EXPECT_EQ(statistics_after_second_run.segment_hits - statistics_after_first_run.segment_hits, 3u);
+    EXPECT_EQ(statistics_after_second_run.segment_misses - statistics_after_first_run.segment_misses, 2u);
+
+    auto word = shape(font, "brown "sv);
+    auto const& first_glyphs = first_run->glyphs();
+    EXPECT_EQ(first_glyphs.size(), 26u);
+    for (size_t i = 0; i < word->glyphs().size(); ++i) {
+        EXPECT_EQ(first_glyphs[10 + i].glyph_id, word->glyphs()[i].glyph_id);
+        EXPECT_APPROXIMATE(first_glyphs[10 + i].position.x() - first_glyphs[10].position.x(), word->glyphs()[i].position.x());
+    }
+
+    Gfx::TrailingWhitespace trailing_whitespace;
+    auto text = Utf16String::from_utf8("the quick brown fox   "sv);
+    auto run = Gfx::shape_text({}, 0, 0, text.utf16_view(), font, Gfx::GlyphRun::TextType::Common, &trailing_whitespace);
+    EXPECT_EQ(trailing_whitespace.length_in_code_units, 3u);
+    auto const& glyphs = run->glyphs();
+    EXPECT_APPROXIMATE(trailing_whitespace.advance, glyphs[glyphs.size() - 1].glyph_width * 3);
+}
+
+// The cache evicts the least recently used shapes once it grows past its byte budget.
+TEST_CASE(shaping_cache_respects_byte_budget)
+{
+    auto font = load_text_font(16);
+
+    auto& shaping_cache = Gfx::GlobalShapingCache::the();
+    shaping_cache.purge();
+    shaping_cache.set_byte_budget(4 * KiB);
+    ScopeGuard restore_byte_budget = [&] {
+        shaping_cache.set_byte_budget(Gfx::GlobalShapingCache::default_byte_budget);
+    };
+
+    for (size_t i = 0; i < 256; ++i)
+        (void)shape(font, ByteString::formatted("{}", i * 7919));
+
+    auto statistics = shaping_cache.statistics();
+    EXPECT(statistics.byte_size <= 4 * KiB);
+    EXPECT(statistics.evictions > 0);
+    EXPECT(statistics.entry_count > 0);
+
+    EXPECT(shaping_cache.purge() > 0);
+    EXPECT_EQ(shaping_cache.statistics().entry_count, 0u);
+}
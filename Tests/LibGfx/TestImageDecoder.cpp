@@ -1065,3 +1065,127 @@ TEST_CASE(test_avif_missing_pixi_property)
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("avif/missing-pixi-property.avif"sv)));
     EXPECT(Gfx::AVIFImageDecoderPlugin::sniff(file->bytes()));
 }
+
+TEST_CASE(test_scaled_size_covering)
+{
+    EXPECT_EQ(Gfx::scaled_size_covering({ 592, 800 }, {}), Gfx::IntSize(592, 800));
+    EXPECT_EQ(Gfx::scaled_size_covering({ 592, 800 }, Gfx::IntSize { 1000, 1000 }), Gfx::IntSize(592, 800));
+    EXPECT_EQ(Gfx::scaled_size_covering({ 592, 800 }, Gfx::IntSize { 148, 100 }), Gfx::IntSize(148, 200));
+    EXPECT_EQ(Gfx::scaled_size_covering({ 592, 800 }, Gfx::IntSize { 10, 200 }), Gfx::IntSize(148, 200));
+    EXPECT_EQ(Gfx::scaled_size_covering({ 64, 138 }, Gfx::IntSize { 32, 32 }), Gfx::IntSize(32, 69));
+    EXPECT_EQ(Gfx::scaled_size_covering({ 65535, 1 }, Gfx::IntSize { 100, 1 }), Gfx::IntSize(65535, 1));
+}
+
+TEST_CASE(test_jpeg_decode_to_ideal_size)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/several_scans.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes()));
+
+    // libjpeg scales in eighths, so the smallest covering size for 100x100 is 2/8 of 592x800.
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 100, 100 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(148, 200));
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(592, 800));
+}
+
+TEST_CASE(test_png_decode_to_ideal_size)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/buggie.png"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(file->bytes()));
+    EXPECT_EQ(plugin_decoder->frame_count(), 1u);
+
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 32, 32 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(32, 69));
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(64, 138));
+}
+
+TEST_CASE(test_webp_decode_to_ideal_size)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("webp/simple-vp8.webp"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::WebPImageDecoderPlugin::create(file->bytes()));
+
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 60, 60 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(60, 60));
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(240, 240));
+}
+
+static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> decode_progressively(ReadonlyBytes data, size_t chunk_size, Optional<Gfx::IntSize> ideal_size = {})
+{
+    auto decoder = TRY(Gfx::ProgressiveImageDecoder::try_create(data.trim(Gfx::ProgressiveImageDecoder::minimum_bytes_for_sniffing), ideal_size));
+    EXPECT(decoder);
+
+    size_t snapshot_count = 0;
+    for (size_t offset = 0; offset < data.size(); offset += chunk_size) {
+        TRY(decoder->append(data.slice(offset, min(chunk_size, data.size() - offset))));
+        if (decoder->has_new_pixels()) {
+            (void)TRY(decoder->take_snapshot());
+            EXPECT(!decoder->has_new_pixels());
+            ++snapshot_count;
+        }
+    }
+
+    // A partially received image should have been shown more than once.
+    EXPECT(snapshot_count > 1);
+    return decoder->take_snapshot();
+}
+
+TEST_CASE(test_jpeg_progressive_decode)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/several_scans.jpg"sv)));
+    auto bitmap = TRY_OR_FAIL(decode_progressively(file->bytes(), 1024));
+    EXPECT_EQ(bitmap->size(), Gfx::IntSize(592, 800));
+
+    auto scaled_bitmap = TRY_OR_FAIL(decode_progressively(file->bytes(), 1024, Gfx::IntSize { 100, 100 }));
+    EXPECT_EQ(scaled_bitmap->size(), Gfx::IntSize(148, 200));
+}
+
+TEST_CASE(test_png_progressive_decode)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/buggie.png"sv)));
+    auto bitmap = TRY_OR_FAIL(decode_progressively(file->bytes(), 256));
+    EXPECT_EQ(bitmap->size(), Gfx::IntSize(64, 138));
+
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(file->bytes()));
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0));
+    frame.image->set_alpha_type_destructive(Gfx::AlphaType::Premultiplied);
+    EXPECT_EQ(bitmap->get_pixel(32, 69), frame.image->get_pixel(32, 69));
+
+    // Partial images have the same size as the final image decoded to the same ideal size.
+    auto scaled_bitmap = TRY_OR_FAIL(decode_progressively(file->bytes(), 256, Gfx::IntSize { 32, 32 }));
+    auto scaled_plugin_decoder = TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(file->bytes()));
+    auto scaled_frame = TRY_OR_FAIL(scaled_plugin_decoder->frame(0, Gfx::IntSize { 32, 32 }));
+    scaled_frame.image->set_alpha_type_destructive(Gfx::AlphaType::Premultiplied);
+    EXPECT_EQ(scaled_bitmap->size(), scaled_frame.image->size());
+    EXPECT(scaled_bitmap->size() != Gfx::IntSize(64, 138));
+    EXPECT_EQ(scaled_bitmap->get_pixel(16, 34), scaled_frame.image->get_pixel(16, 34));
+}
+
+TEST_CASE(test_webp_progressive_decode)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("webp/simple-vp8.webp"sv)));
+    auto bitmap = TRY_OR_FAIL(decode_progressively(file->bytes(), 64));
+    EXPECT_EQ(bitmap->size(), Gfx::IntSize(240, 240));
+}
+
+TEST_CASE(test_progressive_decode_natural_size)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/several_scans.jpg"sv)));
+    auto decoder = TRY_OR_FAIL(Gfx::ProgressiveImageDecoder::try_create(file->bytes(), Gfx::IntSize { 100, 100 }));
+    EXPECT(decoder);
+    EXPECT(decoder->natural_size().is_empty());
+
+    TRY_OR_FAIL(decoder->append(file->bytes()));
+    auto bitmap = TRY_OR_FAIL(decoder->take_snapshot());
+    EXPECT_EQ(bitmap->size(), Gfx::IntSize(148, 200));
+    EXPECT_EQ(decoder->natural_size(), Gfx::IntSize(592, 800));
+}
+
+TEST_CASE(test_progressive_decode_unsupported_format)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("gif/download-animation.gif"sv)));
+    auto decoder = TRY_OR_FAIL(Gfx::ProgressiveImageDecoder::try_create(file->bytes()));
+    EXPECT(!decoder);
+
+    EXPECT(!Gfx::ProgressiveImageDecoder::can_decode_mime_type("image/gif"sv));
+    EXPECT(!Gfx::ProgressiveImageDecoder::can_decode_mime_type("image/avif"sv));
+    EXPECT(Gfx::ProgressiveImageDecoder::can_decode_mime_type("image/png"sv));
+}
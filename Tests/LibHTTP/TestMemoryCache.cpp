@@ -51,14 +51,34 @@ TEST_CASE(javascript_bytecode_cache_round_trips_with_memory_cache_entry)
     auto response_headers = create_cacheable_response_headers();
     auto bytecode = immutable_bytes("cached bytecode"sv);
 
-    cache->create_entry(url, "GET"sv, *request_headers, UnixDateTime::now(), 200, "OK"sv, *response_headers, bytecode, 0);
+    cache->create_entry(url, "GET"sv, *request_headers, UnixDateTime::now(), 200, "OK"sv, *response_headers, bytecode, {}, 0);
     cache->finalize_entry(url, "GET"sv, *request_headers, 200, *response_headers, immutable_bytes("console.log('hello');"sv));
 
     auto entry = cache->open_entry(url, "GET"sv, *request_headers, HTTP::CacheMode::Default);
     VERIFY(entry.has_value());
     VERIFY(entry->javascript_bytecode_cache.has_value());
     EXPECT_EQ(entry->javascript_bytecode_cache->bytes(), bytecode.bytes());
-    EXPECT_EQ(entry->javascript_bytecode_cache_vary_key, Optional<u64> { 0 });
+    EXPECT_EQ(entry->disk_cache_vary_key, Optional<u64> { 0 });
+}
+
+TEST_CASE(css_parsed_rules_cache_round_trips_with_memory_cache_entry)
+{
+    auto cache = HTTP::MemoryCache::create();
+    auto url = parse_url("https://example.com/style.css"sv);
+    auto request_headers = create_cacheable_request_headers();
+    auto response_headers = create_cacheable_response_headers();
+    auto rules = immutable_bytes("cached rules"sv);
+    auto body = immutable_bytes("body { color: green; }"sv);
+
+    cache->create_entry(url, "GET"sv, *request_headers, UnixDateTime::now(), 200, "OK"sv, *response_headers, {}, rules, 0);
+    cache->finalize_entry(url, "GET"sv, *request_headers, 200, *response_headers, body);
+
+    auto entry = cache->open_entry(url, "GET"sv, *request_headers, HTTP::CacheMode::Default);
+    VERIFY(entry.has_value());
+    EXPECT(!entry->javascript_bytecode_cache.has_value());
+    VERIFY(entry->css_parsed_rules_cache.has_value());
+    EXPECT_EQ(entry->css_parsed_rules_cache->bytes(), rules.bytes());
+    EXPECT_EQ(cache->size_in_bytes(), body.size() + rules.size());
 }
 
 TEST_CASE(javascript_bytecode_cache_update_matches_memory_cache_vary_headers)
@@ -82,7 +102,7 @@ TEST_CASE(javascript_bytecode_cache_update_matches_memory_cache_vary_headers)
     auto entry = cache->open_entry(url, "GET"sv, *cache_request_headers, HTTP::CacheMode::Default);
     VERIFY(entry.has_value());
     EXPECT(!entry->javascript_bytecode_cache.has_value());
-    EXPECT(!entry->javascript_bytecode_cache_vary_key.has_value());
+    EXPECT(!entry->disk_cache_vary_key.has_value());
 
     cache->update_javascript_bytecode_cache(url, "GET"sv, *cache_request_headers, vary_key, bytecode);
 
@@ -90,7 +110,7 @@ TEST_CASE(javascript_bytecode_cache_update_matches_memory_cache_vary_headers)
     VERIFY(entry.has_value());
     VERIFY(entry->javascript_bytecode_cache.has_value());
     EXPECT_EQ(entry->javascript_bytecode_cache->bytes(), bytecode.bytes());
-    EXPECT_EQ(entry->javascript_bytecode_cache_vary_key, Optional<u64> { vary_key });
+    EXPECT_EQ(entry->disk_cache_vary_key, Optional<u64> { vary_key });
 }
 
 TEST_CASE(javascript_bytecode_cache_can_be_added_after_memory_cache_entry_is_complete)
@@ -107,7 +127,7 @@ TEST_CASE(javascript_bytecode_cache_can_be_added_after_memory_cache_entry_is_com
     auto entry = cache->open_entry(url, "GET"sv, *request_headers, HTTP::CacheMode::Default);
     VERIFY(entry.has_value());
     EXPECT(!entry->javascript_bytecode_cache.has_value());
-    EXPECT(!entry->javascript_bytecode_cache_vary_key.has_value());
+    EXPECT(!entry->disk_cache_vary_key.has_value());
 
     cache->update_javascript_bytecode_cache(url, "GET"sv, *request_headers, 0, bytecode);
 
@@ -115,5 +135,28 @@ TEST_CASE(javascript_bytecode_cache_can_be_added_after_memory_cache_entry_is_com
     VERIFY(entry.has_value());
     VERIFY(entry->javascript_bytecode_cache.has_value());
     EXPECT_EQ(entry->javascript_bytecode_cache->bytes(), bytecode.bytes());
-    EXPECT_EQ(entry->javascript_bytecode_cache_vary_key, Optional<u64> { 0 });
+    EXPECT_EQ(entry->disk_cache_vary_key, Optional<u64> { 0 });
+}
+
+TEST_CASE(removing_stale_entries_keeps_fresh_entries)
+{
+    auto cache = HTTP::MemoryCache::create();
+    auto fresh_url = parse_url("https://example.com/fresh.js"sv);
+    auto stale_url = parse_url("https://example.com/stale.js"sv);
+    auto request_headers = create_cacheable_request_headers();
+    auto fresh_response_headers = create_cacheable_response_headers();
+    auto stale_response_headers = HTTP::HeaderList::create({
+        { "Cache-Control"sv, "max-age=0"sv },
+    });
+
+    cache->create_entry(fresh_url, "GET"sv, *request_headers, UnixDateTime::now(), 200, "OK"sv, *fresh_response_headers);
+    cache->finalize_entry(fresh_url, "GET"sv, *request_headers, 200, *fresh_response_headers, immutable_bytes("fresh"sv));
+    cache->create_entry(stale_url, "GET"sv, *request_headers, UnixDateTime::now(), 200, "OK"sv, *stale_response_headers);
+    cache->finalize_entry(stale_url, "GET"sv, *request_headers, 200, *stale_response_headers, immutable_bytes("stale!"sv));
+
+    EXPECT_EQ(cache->size_in_bytes(), 11u);
+    EXPECT_EQ(cache->remove_stale_entries(), 6u);
+    EXPECT_EQ(cache->size_in_bytes(), 5u);
+    EXPECT(cache->open_entry(fresh_url, "GET"sv, *request_headers, HTTP::CacheMode::Default).has_value());
+    EXPECT(!cache->open_entry(stale_url, "GET"sv, *request_headers, HTTP::CacheMode::Default).has_value());
 }
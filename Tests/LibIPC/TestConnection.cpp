@@ -8,6 +8,8 @@
 #include <AK/ByteReader.h>
 #include <AK/ByteString.h>
 #include <AK/Function.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
 #include <AK/MemoryStream.h>
 #include <AK/Queue.h>
 #include <AK/RefPtr.h>
@@ -19,6 +21,7 @@
 #include <LibIPC/Decoder.h>
 #include <LibIPC/Encoder.h>
 #include <LibIPC/Message.h>
+#include <LibIPC/MessageStatistics.h>
 #include <LibIPC/Stub.h>
 #include <LibIPC/Transport.h>
 #include <LibIPC/TransportHandle.h>
@@ -244,3 +247,54 @@ TEST_CASE(async_posts_racing_close_are_safe)
     while (loop.pump(Core::EventLoop::WaitMode::PollForEvents) != 0)
         ;
 }
+
+TEST_CASE(latency_histogram_buckets_are_powers_of_two)
+{
+    IPC::LatencyHistogram histogram;
+    histogram.record(AK::Duration::from_nanoseconds(500));
+    histogram.record(AK::Duration::from_microseconds(1));
+    histogram.record(AK::Duration::from_microseconds(3));
+    histogram.record(AK::Duration::from_microseconds(3));
+    histogram.record(AK::Duration::from_seconds(3600));
+
+    EXPECT_EQ(histogram.count(), 5u);
+
+    auto json = histogram.to_json();
+    EXPECT_EQ(json.get_u64("totalMicroseconds"sv), 3600u * 1'000'000u + 7u);
+
+    auto const& buckets = json.get_array("buckets"sv).value();
+    EXPECT_EQ(buckets.size(), IPC::LatencyHistogram::BUCKET_COUNT);
+    EXPECT_EQ(buckets[0].get_u64(), 1u);
+    EXPECT_EQ(buckets[1].get_u64(), 1u);
+    EXPECT_EQ(buckets[2].get_u64(), 2u);
+    EXPECT_EQ(buckets[IPC::LatencyHistogram::BUCKET_COUNT - 1].get_u64(), 1u);
+}
+
+TEST_CASE(message_statistics_count_messages_per_type)
+{
+    static constexpr Array message_names { "target"sv, "other"sv };
+    auto& statistics = IPC::MessageStatistics::for_endpoint(TEST_MAGIC, "Test"sv, message_names);
+    EXPECT_EQ(&IPC::MessageStatistics::for_endpoint(TEST_MAGIC, "Test"sv, message_names), &statistics);
+
+    statistics.record_sent(TARGET_MESSAGE_ID, 16, 1);
+    statistics.record_sent(TARGET_MESSAGE_ID, 8, 0);
+    statistics.record_received(OTHER_MESSAGE_ID, 32, 2);
+
+    // Message IDs the endpoint does not know about are ignored.
+    statistics.record_sent(0, 8, 0);
+    statistics.record_sent(3, 8, 0);
+
+    auto const* target = statistics.for_message(TARGET_MESSAGE_ID);
+    EXPECT_EQ(target->sent_count.load(), 2u);
+    EXPECT_EQ(target->sent_bytes.load(), 24u);
+    EXPECT_EQ(target->sent_attachment_count.load(), 1u);
+
+    auto const* other = statistics.for_message(OTHER_MESSAGE_ID);
+    EXPECT_EQ(other->received_count.load(), 1u);
+    EXPECT_EQ(other->received_bytes.load(), 32u);
+    EXPECT_EQ(other->received_attachment_count.load(), 2u);
+
+    auto json = statistics.to_json();
+    EXPECT_EQ(json.get_string("endpoint"sv), "Test"_string);
+    EXPECT_EQ(json.get_array("messages"sv)->size(), 2u);
+}
@@ -13,8 +13,10 @@
 #include <LibCore/System.h>
 #include <LibIPC/Attachment.h>
 #include <LibIPC/Forward.h>
+#include <LibIPC/SharedMemoryRing.h>
 #include <LibIPC/TransportSocket.h>
 #include <LibTest/TestCase.h>
+#include <LibThreading/Thread.h>
 
 using namespace AK::TimeLiterals;
 
@@ -243,3 +245,243 @@ TEST_CASE(buffered_message_is_drained_when_io_thread_stops_without_reading_it)
 
     EXPECT_EQ(delivered.load(AK::MemoryOrder::memory_order_relaxed), 1u);
 }
+
+struct TransportPair {
+    NonnullOwnPtr<IPC::TransportSocket> sender;
+    NonnullOwnPtr<IPC::TransportSocket> receiver;
+};
+
+static TransportPair make_transport_pair()
+{
+    int fds[2] = {};
+    MUST(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, fds));
+
+    auto sender_socket = MUST(Core::LocalSocket::adopt_fd(fds[0]));
+    auto receiver_socket = MUST(Core::LocalSocket::adopt_fd(fds[1]));
+    MUST(sender_socket->set_blocking(false));
+    MUST(receiver_socket->set_blocking(false));
+
+    return { make<IPC::TransportSocket>(move(sender_socket)), make<IPC::TransportSocket>(move(receiver_socket)) };
+}
+
+static IPC::MessageDataType make_numbered_payload(u32 number, size_t size)
+{
+    IPC::MessageDataType payload;
+    payload.resize(max(size, sizeof(number)));
+    for (size_t i = 0; i < payload.size(); ++i)
+        payload[i] = static_cast<u8>(number + i);
+    memcpy(payload.data(), &number, sizeof(number));
+    return payload;
+}
+
+static u32 number_of_payload(ReadonlyBytes bytes)
+{
+    u32 number = 0;
+    VERIFY(bytes.size() >= sizeof(number));
+    memcpy(&number, bytes.data(), sizeof(number));
+    return number;
+}
+
+TEST_CASE(shared_memory_ring_round_trips_messages_across_wrap_around)
+{
+    auto writer = MUST(IPC::SharedMemoryRingWriter::create(IPC::SharedMemoryRingWriter::MIN_CAPACITY));
+    auto attachments = MUST(writer->attachments_for_reader());
+    auto buffer_fd = attachments[0].to_fd();
+    auto doorbell_fd = attachments[1].to_fd();
+    auto reader = MUST(IPC::SharedMemoryRingReader::adopt(buffer_fd, doorbell_fd, writer->capacity()));
+
+    EXPECT(!reader->has_data());
+
+    // Odd sizes make records straddle the end of the ring on most laps.
+    u32 next_to_write = 0;
+    u32 next_to_read = 0;
+    for (size_t lap = 0; lap < 64; ++lap) {
+        while (writer->try_write(next_to_write, make_numbered_payload(next_to_write, 100 + next_to_write % 37)))
+            ++next_to_write;
+
+        EXPECT(reader->has_data());
+        MUST(reader->read_available(NumericLimits<size_t>::max(), [&](u32 sequence, Vector<u8>&& bytes) {
+            EXPECT_EQ(sequence, next_to_read);
+            EXPECT_EQ(number_of_payload(bytes), next_to_read);
+            EXPECT_EQ(bytes.size(), 100 + next_to_read % 37);
+            EXPECT_EQ(bytes.last(), static_cast<u8>(next_to_read + bytes.size() - 1));
+            ++next_to_read;
+        }));
+        EXPECT(!reader->has_data());
+    }
+    EXPECT_EQ(next_to_read, next_to_write);
+
+    // A message larger than the ring can never be written.
+    EXPECT(!writer->try_write(0, make_numbered_payload(0, IPC::SharedMemoryRingWriter::MIN_CAPACITY)));
+}
+
+TEST_CASE(shared_memory_ring_only_rings_the_doorbell_for_a_waiting_reader)
+{
+    auto writer = MUST(IPC::SharedMemoryRingWriter::create(IPC::SharedMemoryRingWriter::MIN_CAPACITY));
+    auto attachments = MUST(writer->attachments_for_reader());
+    auto buffer_fd = attachments[0].to_fd();
+    auto doorbell_fd = attachments[1].to_fd();
+    auto reader = MUST(IPC::SharedMemoryRingReader::adopt(buffer_fd, doorbell_fd, writer->capacity()));
+
+    auto doorbell_is_ringing = [&] {
+        struct pollfd poll_fd { .fd = reader->doorbell_fd(), .events = POLLIN, .revents = 0 };
+        return MUST(Core::System::poll({ &poll_fd, 1 }, 0)) > 0;
+    };
+
+    EXPECT(writer->try_write(0, make_numbered_payload(0, 16)));
+    EXPECT(!doorbell_is_ringing());
+
+    // There is something to read already, so the reader must not sleep.
+    EXPECT(!reader->prepare_to_wait());
+    MUST(reader->read_available(NumericLimits<size_t>::max(), [](u32, Vector<u8>&&) { }));
+
+    EXPECT(reader->prepare_to_wait());
+    EXPECT(writer->try_write(1, make_numbered_payload(1, 16)));
+    EXPECT(writer->try_write(2, make_numbered_payload(2, 16)));
+    EXPECT(doorbell_is_ringing());
+
+    reader->finish_wait();
+    reader->clear_doorbell();
+    EXPECT(!doorbell_is_ringing());
+
+    size_t count = 0;
+    MUST(reader->read_available(NumericLimits<size_t>::max(), [&](u32, Vector<u8>&&) { ++count; }));
+    EXPECT_EQ(count, 2u);
+}
+
+// Messages without attachments take the shared memory ring while it has room, and everything else takes the socket.
+// The receiver must still deliver them in the order they were posted.
+TEST_CASE(messages_keep_their_order_across_shared_memory_ring_and_socket)
+{
+    Core::EventLoop loop;
+    auto transports = make_transport_pair();
+    auto& sender = transports.sender;
+    auto& receiver = transports.receiver;
+
+    MUST(sender->enable_shared_memory_ring(IPC::SharedMemoryRingWriter::MIN_CAPACITY));
+
+    static constexpr u32 message_count = 2000;
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Vector<u32> received_numbers;
+    IGNORE_USE_IN_ESCAPING_LAMBDA size_t received_attachment_count = 0;
+    receiver->set_up_read_hook([&] {
+        (void)receiver->read_as_many_messages_as_possible_without_blocking([&](IPC::TransportSocket::Message&& message) {
+            received_numbers.append(number_of_payload(message.bytes.bytes()));
+            received_attachment_count += message.attachments.size();
+        });
+    });
+
+    size_t sent_attachment_count = 0;
+    for (u32 number = 0; number < message_count; ++number) {
+        Vector<IPC::Attachment> attachments;
+        size_t size = 16 + number % 64;
+        if (number % 97 == 0) {
+            // Too large for the ring.
+            size = IPC::SharedMemoryRingWriter::MIN_CAPACITY * 2;
+        } else if (number % 89 == 0) {
+            auto fds = MUST(Core::System::pipe2(O_CLOEXEC));
+            MUST(Core::System::close(fds[1]));
+            attachments.append(IPC::Attachment::from_fd(fds[0]));
+            ++sent_attachment_count;
+        }
+        MUST(sender->post_message(make_numbered_payload(number, size), attachments));
+    }
+
+    spin_until(loop, [&] { return received_numbers.size() == message_count; });
+
+    EXPECT_EQ(received_attachment_count, sent_attachment_count);
+    for (u32 number = 0; number < received_numbers.size(); ++number)
+        EXPECT_EQ(received_numbers[number], number);
+}
+
+// Messages left in the shared memory ring when the peer hangs up must be delivered before the EOF.
+TEST_CASE(shared_memory_ring_is_drained_on_peer_hangup)
+{
+    Core::EventLoop loop;
+    auto transports = make_transport_pair();
+    auto& sender = transports.sender;
+    auto& receiver = transports.receiver;
+
+    MUST(sender->enable_shared_memory_ring(IPC::SharedMemoryRingWriter::MIN_CAPACITY));
+    for (u32 number = 0; number < 10; ++number) {
+        Vector<IPC::Attachment> no_attachments;
+        MUST(sender->post_message(make_numbered_payload(number, 32), no_attachments));
+    }
+    sender->close_after_sending_all_pending_messages();
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Vector<u32> received_numbers;
+    IGNORE_USE_IN_ESCAPING_LAMBDA bool observed_shutdown = false;
+    receiver->set_up_read_hook([&] {
+        if (observed_shutdown)
+            return;
+        auto should_shutdown = receiver->read_as_many_messages_as_possible_without_blocking([&](IPC::TransportSocket::Message&& message) {
+            received_numbers.append(number_of_payload(message.bytes.bytes()));
+        });
+        if (should_shutdown == IPC::TransportSocket::ShouldShutdown::Yes)
+            observed_shutdown = true;
+    });
+
+    spin_until(loop, [&] { return observed_shutdown; });
+
+    EXPECT_EQ(received_numbers.size(), 10u);
+    for (u32 number = 0; number < received_numbers.size(); ++number)
+        EXPECT_EQ(received_numbers[number], number);
+}
+
+// Sends small messages back and forth between two threads, one at a time, which is dominated by the per-message cost
+// of the transport: syscalls, IO thread hops and wakeups.
+static void bounce_small_messages(bool use_shared_memory_ring)
+{
+    static constexpr u32 round_trip_count = 20000;
+    static constexpr size_t message_size = 64;
+
+    auto transports = make_transport_pair();
+    auto& sender = transports.sender;
+    auto& receiver = transports.receiver;
+    if (use_shared_memory_ring) {
+        MUST(sender->enable_shared_memory_ring(64 * KiB));
+        MUST(receiver->enable_shared_memory_ring(64 * KiB));
+    }
+
+    auto& echo_transport = *receiver;
+    auto echo_thread = Threading::Thread::construct("Echo"sv, [&echo_transport]() -> intptr_t {
+        for (u32 echoed = 0; echoed < round_trip_count;) {
+            echo_transport.wait_until_readable();
+            (void)echo_transport.read_as_many_messages_as_possible_without_blocking([&](IPC::TransportSocket::Message&& message) {
+                Vector<IPC::Attachment> no_attachments;
+                IPC::MessageDataType payload;
+                payload.append(message.bytes.bytes().data(), message.bytes.bytes().size());
+                MUST(echo_transport.post_message(move(payload), no_attachments));
+                ++echoed;
+            });
+        }
+        return 0;
+    });
+    echo_thread->start();
+
+    for (u32 number = 0; number < round_trip_count; ++number) {
+        Vector<IPC::Attachment> no_attachments;
+        MUST(sender->post_message(make_numbered_payload(number, message_size), no_attachments));
+
+        bool received = false;
+        while (!received) {
+            sender->wait_until_readable();
+            (void)sender->read_as_many_messages_as_possible_without_blocking([&](IPC::TransportSocket::Message&& message) {
+                EXPECT_EQ(number_of_payload(message.bytes.bytes()), number);
+                received = true;
+            });
+        }
+    }
+
+    (void)echo_thread->join();
+}
+
+BENCHMARK_CASE(round_trip_small_messages_over_socket)
+{
+    bounce_small_messages(false);
+}
+
+BENCHMARK_CASE(round_trip_small_messages_over_shared_memory_ring)
+{
+    bounce_small_messages(true);
+}
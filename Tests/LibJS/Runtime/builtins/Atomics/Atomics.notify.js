@@ -53,4 +53,13 @@ test("basic functionality", () => {
         const waiters = Atomics.notify(typedArray, 0, 0);
         expect(waiters).toBe(0);
     });
+
+    test("shared ArrayBuffer without waiters", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        expect(Atomics.notify(typedArray, 0)).toBe(0);
+
+        expect(Atomics.wait(typedArray, 0, 0, 0)).toBe("timed-out");
+        expect(Atomics.notify(typedArray, 0)).toBe(0);
+        expect(Atomics.notify(typedArray, 0, 1)).toBe(0);
+    });
 });
@@ -66,8 +66,51 @@ describe("errors", () => {
     });
 });
 
-test("basic functionality", () => {
+describe("basic functionality", () => {
     test("invariants", () => {
         expect(Atomics.wait).toHaveLength(4);
     });
+
+    test("value is not the expected value", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        typedArray[1] = 42;
+        expect(Atomics.wait(typedArray, 1, 0, 0)).toBe("not-equal");
+
+        const bigTypedArray = new BigInt64Array(new SharedArrayBuffer(4 * BigInt64Array.BYTES_PER_ELEMENT));
+        bigTypedArray[1] = 42n;
+        expect(Atomics.wait(bigTypedArray, 1, 0n, 0)).toBe("not-equal");
+    });
+
+    test("timing out", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        expect(Atomics.wait(typedArray, 0, 0, 0)).toBe("timed-out");
+        expect(Atomics.wait(typedArray, 0, 0, 5)).toBe("timed-out");
+
+        const bigTypedArray = new BigInt64Array(new SharedArrayBuffer(4 * BigInt64Array.BYTES_PER_ELEMENT));
+        expect(Atomics.wait(bigTypedArray, 0, 0n, 0)).toBe("timed-out");
+    });
+
+    test("contents are kept when the buffer starts being waited on", () => {
+        const buffer = new SharedArrayBuffer(8, { maxByteLength: 16 });
+        const typedArray = new Int32Array(buffer);
+        typedArray[0] = 1;
+        typedArray[1] = 2;
+
+        expect(Atomics.wait(typedArray, 1, 0, 0)).toBe("not-equal");
+        expect(Array.from(typedArray)).toEqual([1, 2]);
+
+        buffer.grow(16);
+        expect(buffer.byteLength).toBe(16);
+        expect(Array.from(typedArray)).toEqual([1, 2, 0, 0]);
+
+        Atomics.store(typedArray, 3, 4);
+        expect(Atomics.add(typedArray, 3, 1)).toBe(4);
+        expect(Atomics.compareExchange(typedArray, 3, 5, 6)).toBe(5);
+        expect(Atomics.compareExchange(typedArray, 3, 5, 7)).toBe(6);
+        expect(Atomics.load(typedArray, 3)).toBe(6);
+
+        expect(() => {
+            buffer.grow(8);
+        }).toThrowWithMessage(RangeError, "SharedArrayBuffer byte length of 8 is less than the previous byte length of 16");
+    });
 });
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Time.h>
+#include <LibMedia/VideoDecodeQuality.h>
+#include <LibTest/TestCase.h>
+
+using namespace Media;
+
+static constexpr auto frame_duration = AK::Duration::from_milliseconds(40);
+
+static AK::Duration ms(i64 milliseconds)
+{
+    return AK::Duration::from_milliseconds(milliseconds);
+}
+
+TEST_CASE(late_frames_escalate_one_level_at_a_time)
+{
+    VideoDecodeQualityController controller;
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::None);
+
+    for (u32 i = 0; i < VideoDecodeQualityController::LATE_FRAMES_BEFORE_ESCALATING - 1; i++)
+        controller.record_decoded_frame(ms(1000), frame_duration, ms(1010));
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::None);
+
+    controller.record_decoded_frame(ms(1000), frame_duration, ms(1010));
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::NonReferenceFrames);
+
+    for (u32 i = 0; i < VideoDecodeQualityController::LATE_FRAMES_BEFORE_ESCALATING * 10; i++)
+        controller.record_decoded_frame(ms(1000), frame_duration, ms(1010));
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::NonKeyFrames);
+}
+
+TEST_CASE(an_on_time_frame_interrupts_escalation)
+{
+    VideoDecodeQualityController controller;
+    for (u32 i = 0; i < VideoDecodeQualityController::LATE_FRAMES_BEFORE_ESCALATING - 1; i++)
+        controller.record_decoded_frame(ms(1000), frame_duration, ms(1010));
+    controller.record_decoded_frame(ms(1000), frame_duration, ms(990));
+    controller.record_decoded_frame(ms(1000), frame_duration, ms(1010));
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::None);
+}
+
+TEST_CASE(frames_past_their_presentation_are_dropped)
+{
+    VideoDecodeQualityController controller;
+    // Slightly late frames are still presented.
+    EXPECT_EQ(controller.record_decoded_frame(ms(1000), frame_duration, ms(1050)), VideoDecodeQualityController::Presentation::Present);
+    EXPECT_EQ(controller.record_decoded_frame(ms(1000), frame_duration, ms(1070)), VideoDecodeQualityController::Presentation::Drop);
+    // Frames without a known duration are never dropped.
+    EXPECT_EQ(controller.record_decoded_frame(ms(1000), AK::Duration::zero(), ms(2000)), VideoDecodeQualityController::Presentation::Present);
+}
+
+TEST_CASE(a_frame_is_presented_after_too_many_consecutive_drops)
+{
+    VideoDecodeQualityController controller;
+    for (u32 i = 0; i < VideoDecodeQualityController::MAX_CONSECUTIVE_DROPPED_FRAMES; i++)
+        EXPECT_EQ(controller.record_decoded_frame(ms(1000), frame_duration, ms(2000)), VideoDecodeQualityController::Presentation::Drop);
+    EXPECT_EQ(controller.record_decoded_frame(ms(1000), frame_duration, ms(2000)), VideoDecodeQualityController::Presentation::Present);
+    EXPECT_EQ(controller.record_decoded_frame(ms(1000), frame_duration, ms(2000)), VideoDecodeQualityController::Presentation::Drop);
+}
+
+TEST_CASE(frames_well_ahead_of_the_clock_lower_the_level)
+{
+    VideoDecodeQualityController controller;
+    for (u32 i = 0; i < VideoDecodeQualityController::LATE_FRAMES_BEFORE_ESCALATING * 2; i++)
+        controller.record_decoded_frame(ms(1000), frame_duration, ms(1010));
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::NonReferenceFramesAndLoopFilter);
+
+    auto recovery_period = VideoDecodeQualityController::RECOVERY_PERIOD.to_milliseconds();
+    i64 timestamp = 1000;
+    for (; timestamp < 1000 + recovery_period; timestamp += frame_duration.to_milliseconds())
+        controller.record_decoded_frame(ms(timestamp), frame_duration, ms(timestamp - 100));
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::NonReferenceFramesAndLoopFilter);
+
+    controller.record_decoded_frame(ms(timestamp), frame_duration, ms(timestamp - 100));
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::NonReferenceFrames);
+}
+
+TEST_CASE(recovery_does_not_depend_on_the_number_of_frames)
+{
+    VideoDecodeQualityController controller;
+    for (u32 i = 0; i < VideoDecodeQualityController::LATE_FRAMES_BEFORE_ESCALATING * 3; i++)
+        controller.record_decoded_frame(ms(1000), frame_duration, ms(1010));
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::NonKeyFrames);
+
+    // Only key frames come out of the decoder at this level, so a few of them should cover the whole period.
+    auto recovery_period = VideoDecodeQualityController::RECOVERY_PERIOD.to_milliseconds();
+    controller.record_decoded_frame(ms(10000), frame_duration, ms(9900));
+    controller.record_decoded_frame(ms(10000 + recovery_period / 2), frame_duration, ms(10000 + recovery_period / 2 - 100));
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::NonKeyFrames);
+    controller.record_decoded_frame(ms(10000 + recovery_period), frame_duration, ms(10000 + recovery_period - 100));
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::NonReferenceFramesAndLoopFilter);
+}
+
+TEST_CASE(frames_without_headroom_do_not_count_towards_recovery)
+{
+    VideoDecodeQualityController controller;
+    for (u32 i = 0; i < VideoDecodeQualityController::LATE_FRAMES_BEFORE_ESCALATING; i++)
+        controller.record_decoded_frame(ms(1000), frame_duration, ms(1010));
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::NonReferenceFrames);
+
+    auto recovery_period = VideoDecodeQualityController::RECOVERY_PERIOD.to_milliseconds();
+    auto step = frame_duration.to_milliseconds();
+    for (i64 timestamp = 1000; timestamp < 1000 + recovery_period * 2; timestamp += step) {
+        auto is_on_time_without_headroom = (timestamp - 1000) % (recovery_period - step) == 0;
+        controller.record_decoded_frame(ms(timestamp), frame_duration, is_on_time_without_headroom ? ms(timestamp - 10) : ms(timestamp - 100));
+    }
+    EXPECT_EQ(controller.frame_skip_level(), FrameSkipLevel::NonReferenceFrames);
+}
@@ -739,3 +739,58 @@ TEST_CASE(restored_long_fork_chain_coverage)
 
     EXPECT_EQ(regex.test(utf16_subject, 0), regex::MatchResult::Match);
 }
+
+TEST_CASE(catastrophic_backtracking_falls_back_to_linear_matching)
+{
+    auto regex = compile_regex("(a+)+b"sv);
+    auto subject = MUST(String::repeated('a', 5000));
+    auto utf16_subject = Utf16String::from_utf8(subject.bytes_as_string_view());
+
+    EXPECT_EQ(regex.test(utf16_subject, 0), regex::MatchResult::NoMatch);
+    EXPECT_EQ(regex.exec(utf16_subject, 0), regex::MatchResult::NoMatch);
+
+    StringBuilder builder;
+    builder.append(subject);
+    builder.append('c');
+    builder.append_repeated("a"sv, 30);
+    builder.append('b');
+    auto matching_subject = Utf16String::from_utf8(MUST(builder.to_string()).bytes_as_string_view());
+
+    EXPECT_EQ(regex.exec(matching_subject, 0), regex::MatchResult::Match);
+    EXPECT_EQ(regex.capture_slot(0), 5001);
+    EXPECT_EQ(regex.capture_slot(1), 5032);
+    EXPECT_EQ(regex.capture_slot(2), 5001);
+    EXPECT_EQ(regex.capture_slot(3), 5031);
+
+    auto global_regex = compile_regex("(a+)+b"sv, { .global = true });
+    EXPECT_EQ(global_regex.find_all(utf16_subject, 0), 0);
+}
+
+TEST_CASE(linear_fallback_finds_leftmost_match_after_step_limit)
+{
+    auto regex = compile_regex("(?:a|a)*(?:a|a)*(?:a|a)*c"sv);
+
+    StringBuilder builder;
+    builder.append_repeated("a"sv, 60);
+    builder.append('c');
+    auto subject = Utf16String::from_utf8(MUST(builder.to_string()).bytes_as_string_view());
+
+    EXPECT_EQ(regex.exec(subject, 0), regex::MatchResult::Match);
+    EXPECT_EQ(regex.capture_slot(0), 0);
+    EXPECT_EQ(regex.capture_slot(1), 61);
+}
+
+TEST_CASE(multi_literal_start_hints_preserve_behavior)
+{
+    auto regex = compile_regex("(?:foo|bar|baz)=(\\d+)"sv, { .global = true });
+    auto subject = Utf16String::from_utf8("x=1 bar=22 qux=3 foo=4"sv);
+
+    EXPECT_EQ(regex.find_all(subject, 0), 2);
+    EXPECT_EQ(regex.find_all_match(0).start, 4);
+    EXPECT_EQ(regex.find_all_match(0).end, 10);
+    EXPECT_EQ(regex.find_all_match(1).start, 17);
+    EXPECT_EQ(regex.find_all_match(1).end, 22);
+
+    EXPECT(matches("[xy]z|wz"sv, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaawz"sv));
+    EXPECT(!matches("[xy]z|wz"sv, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaazw"sv));
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <LibWeb/FileAPI/BlobData.h>
+
+using Web::FileAPI::BlobData;
+
+static BlobData blob_data_from(StringView string)
+{
+    return BlobData::create(MUST(ByteBuffer::copy(string.bytes())));
+}
+
+TEST_CASE(append_shares_chunks)
+{
+    auto first = blob_data_from("Hello, "sv);
+    auto second = blob_data_from("friends!"sv);
+
+    BlobData combined;
+    TRY_OR_FAIL(combined.append(first));
+    TRY_OR_FAIL(combined.append(second));
+    EXPECT_EQ(combined.size(), 15u);
+    EXPECT_EQ(combined.chunk_count(), 2u);
+
+    // The leading bytes come straight from the first chunk, or are copied if they span several.
+    EXPECT_EQ(StringView(TRY_OR_FAIL(combined.leading_bytes(5)).bytes()), "Hello"sv);
+    EXPECT_EQ(StringView(TRY_OR_FAIL(combined.leading_bytes(9)).bytes()), "Hello, fr"sv);
+    EXPECT_EQ(combined.chunk_count(), 2u);
+
+    EXPECT_EQ(StringView(TRY_OR_FAIL(combined.copy_to_byte_buffer()).bytes()), "Hello, friends!"sv);
+
+    // Asking for contiguous bytes copies the chunks, but does not affect the blobs they came from.
+    EXPECT_EQ(StringView(TRY_OR_FAIL(combined.contiguous_bytes()).bytes()), "Hello, friends!"sv);
+    EXPECT_EQ(combined.chunk_count(), 2u);
+    EXPECT_EQ(StringView(TRY_OR_FAIL(first.contiguous_bytes()).bytes()), "Hello, "sv);
+}
+
+TEST_CASE(chunk_views_stay_valid)
+{
+    BlobData data;
+    TRY_OR_FAIL(data.append(blob_data_from("one"sv)));
+    TRY_OR_FAIL(data.append(blob_data_from("two"sv)));
+
+    auto chunks = TRY_OR_FAIL(data.chunk_bytes());
+    EXPECT_EQ(chunks.size(), 2u);
+
+    // Neither asking for contiguous bytes nor for leading bytes may move the chunks out from under existing views.
+    auto contiguous = TRY_OR_FAIL(data.contiguous_bytes());
+    auto leading = TRY_OR_FAIL(data.leading_bytes(4));
+    EXPECT_EQ(StringView(chunks[0]), "one"sv);
+    EXPECT_EQ(StringView(chunks[1]), "two"sv);
+    EXPECT_EQ(StringView(leading.bytes()), "onet"sv);
+
+    // The contiguous bytes outlive the blob they were taken from.
+    data = {};
+    EXPECT_EQ(StringView(contiguous.bytes()), "onetwo"sv);
+}
+
+TEST_CASE(slice_across_chunks)
+{
+    BlobData data;
+    TRY_OR_FAIL(data.append(blob_data_from("abc"sv)));
+    TRY_OR_FAIL(data.append(blob_data_from("defg"sv)));
+    TRY_OR_FAIL(data.append(blob_data_from("hi"sv)));
+
+    auto slice = TRY_OR_FAIL(data.slice(2, 6));
+    EXPECT_EQ(slice.size(), 6u);
+    EXPECT_EQ(slice.chunk_count(), 3u);
+    EXPECT_EQ(StringView(TRY_OR_FAIL(slice.copy_to_byte_buffer()).bytes()), "cdefgh"sv);
+
+    auto inner_slice = TRY_OR_FAIL(slice.slice(1, 3));
+    EXPECT_EQ(inner_slice.chunk_count(), 1u);
+    EXPECT_EQ(StringView(TRY_OR_FAIL(inner_slice.contiguous_bytes()).bytes()), "def"sv);
+
+    auto empty_slice = TRY_OR_FAIL(data.slice(9, 0));
+    EXPECT(empty_slice.is_empty());
+    EXPECT_EQ(empty_slice.chunk_count(), 0u);
+}
+
+TEST_CASE(for_each_chunk)
+{
+    BlobData data;
+    TRY_OR_FAIL(data.append(blob_data_from("one"sv)));
+    TRY_OR_FAIL(data.append(blob_data_from(""sv)));
+    TRY_OR_FAIL(data.append(blob_data_from("two"sv)));
+
+    Vector<ByteString> chunks;
+    data.for_each_chunk([&](ReadonlyBytes chunk) {
+        chunks.append(ByteString { chunk });
+        return IterationDecision::Continue;
+    });
+    EXPECT_EQ(chunks.size(), 2u);
+    EXPECT_EQ(chunks[0], "one"sv);
+    EXPECT_EQ(chunks[1], "two"sv);
+}
+
+TEST_CASE(large_chunk)
+{
+    auto bytes = MUST(ByteBuffer::create_zeroed(BlobData::readonly_mapping_threshold));
+    bytes[1234] = 42;
+
+    auto data = BlobData::create(move(bytes));
+    EXPECT_EQ(data.size(), BlobData::readonly_mapping_threshold);
+    EXPECT_EQ(TRY_OR_FAIL(data.contiguous_bytes()).bytes()[1234], 42);
+
+    auto slice = TRY_OR_FAIL(data.slice(1234, 1));
+    EXPECT_EQ(TRY_OR_FAIL(slice.contiguous_bytes()).bytes()[0], 42);
+}
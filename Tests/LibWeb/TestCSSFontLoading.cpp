@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibWeb/CSS/FontLoading.h>
+
+namespace Web::CSS {
+
+static constexpr auto compressed_font = "wOF2 compressed font data"sv;
+static constexpr auto sfnt_data = "\x00\x01\x00\x00 decoded font data"sv;
+
+TEST_CASE(decoded_font_round_trip)
+{
+    auto source_hash = hash_vector_font_source(compressed_font.bytes());
+    auto encoded = TRY_OR_FAIL(encode_decoded_vector_font_for_disk_cache(sfnt_data.bytes(), source_hash));
+
+    // The sfnt data comes first, so that the encoding can be loaded as a typeface without copying it.
+    EXPECT(encoded.bytes().trim(sfnt_data.length()) == sfnt_data.bytes());
+    EXPECT(!validate_decoded_vector_font_from_disk_cache(encoded, source_hash).is_error());
+}
+
+TEST_CASE(decoded_font_rejects_a_different_source)
+{
+    auto encoded = TRY_OR_FAIL(encode_decoded_vector_font_for_disk_cache(sfnt_data.bytes(), hash_vector_font_source(compressed_font.bytes())));
+    EXPECT(validate_decoded_vector_font_from_disk_cache(encoded, hash_vector_font_source("wOF2 another font"sv.bytes())).is_error());
+}
+
+TEST_CASE(decoded_font_rejects_malformed_encodings)
+{
+    auto source_hash = hash_vector_font_source(compressed_font.bytes());
+    auto encoded = TRY_OR_FAIL(encode_decoded_vector_font_for_disk_cache(sfnt_data.bytes(), source_hash));
+
+    for (size_t length = 0; length < encoded.size(); ++length)
+        EXPECT(validate_decoded_vector_font_from_disk_cache(encoded.bytes().trim(length), source_hash).is_error());
+
+    auto with_leading_data = MUST(ByteBuffer::create_zeroed(1));
+    with_leading_data.append(encoded.bytes());
+    EXPECT(validate_decoded_vector_font_from_disk_cache(with_leading_data, source_hash).is_error());
+
+    for (size_t i = sfnt_data.length(); i < encoded.size(); ++i) {
+        auto corrupted = MUST(ByteBuffer::copy(encoded));
+        corrupted[i] ^= 0xff;
+        EXPECT(validate_decoded_vector_font_from_disk_cache(corrupted, source_hash).is_error());
+    }
+}
+
+TEST_CASE(compressed_fonts_are_recognized)
+{
+    EXPECT(is_compressed_vector_font(MUST(ByteBuffer::copy("wOFF"sv.bytes()))));
+    EXPECT(is_compressed_vector_font(MUST(ByteBuffer::copy("wOF2"sv.bytes()))));
+    EXPECT(!is_compressed_vector_font(MUST(ByteBuffer::copy(sfnt_data.bytes()))));
+    EXPECT(is_compressed_vector_font(MUST(ByteBuffer::copy(sfnt_data.bytes())), ByteString { "font/woff"sv }));
+    EXPECT(!is_compressed_vector_font(MUST(ByteBuffer::copy("wOF2"sv.bytes())), ByteString { "font/ttf"sv }));
+}
+
+}
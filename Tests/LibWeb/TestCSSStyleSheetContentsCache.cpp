@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/CSS/Parser/StyleSheetContentsCache.h>
+
+namespace Web::CSS::Parser {
+
+// A style sheet text that takes up a quarter of the space the cache has for unshared entries.
+static Utf16String quarter_of_unshared_space(char first_character)
+{
+    auto length = StyleSheetContentsCache::maximum_unshared_size_in_bytes / 4 / sizeof(char16_t) - 1024;
+    return Utf16String::from_utf8(ByteString::formatted("{}{}", first_character, ByteString::repeated(' ', length - 1)));
+}
+
+TEST_CASE(unshared_entries_are_evicted_first)
+{
+    auto& cache = StyleSheetContentsCache::the();
+    cache.purge();
+
+    auto shared = quarter_of_unshared_space('a');
+    cache.set(shared, StyleSheetContents::create({}));
+    EXPECT(cache.get(shared));
+
+    Vector<Utf16String> unshared;
+    for (char c = 'b'; c <= 'g'; ++c) {
+        unshared.append(quarter_of_unshared_space(c));
+        cache.set(unshared.last(), StyleSheetContents::create({}));
+    }
+
+    // Only four unshared entries fit, so the two least recently used ones are gone, but the shared one isn't.
+    EXPECT(cache.get(shared));
+    EXPECT(!cache.get(unshared[0]));
+    EXPECT(!cache.get(unshared[1]));
+    for (size_t i = 2; i < unshared.size(); ++i)
+        EXPECT(cache.get(unshared[i]));
+
+    cache.purge();
+}
+
+TEST_CASE(entries_larger_than_the_unshared_space_are_not_kept)
+{
+    auto& cache = StyleSheetContentsCache::the();
+    cache.purge();
+
+    auto source_text = Utf16String::from_utf8(ByteString::repeated(' ', StyleSheetContentsCache::maximum_unshared_size_in_bytes / sizeof(char16_t) + 1));
+
+    cache.set(source_text, StyleSheetContents::create({}));
+    EXPECT(!cache.get(source_text));
+}
+
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/StringBuilder.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/CSS/Parser/Parser.h>
+#include <LibWeb/CSS/Parser/StyleSheetContentsEncoding.h>
+
+namespace Web::CSS::Parser {
+
+static constexpr auto style_sheet = R"~~~(
+@charset "utf-8";
+@import url("print.css") print;
+@media (min-width: 600px) and (max-width: 1200.5px) {
+    #main > .item:not(.hidden)::before { content: "\2014  "; margin: -1.5em 10% 0 auto !important; }
+}
+@font-face { font-family: "Test Font"; src: url(font.woff2) format("woff2"); unicode-range: U+0025-00FF; }
+.parent {
+    color: rgb(0 128 0 / 50%);
+    & > .child { width: calc(100% - 2 * var(--gap, 4px)); }
+    --custom: { a: b };
+}
+a[href^="https" i]:hover { transition: color .2s ease-in-out; }
+)~~~"sv;
+
+static NonnullRefPtr<StyleSheetContents const> parse_contents(StringView css)
+{
+    return Parser::create(ParsingParams {}, Utf16String::from_utf8(css).utf16_view()).parse_as_shareable_style_sheet_rules();
+}
+
+static ByteBuffer source_hash(u8 seed)
+{
+    auto hash = MUST(ByteBuffer::create_zeroed(32));
+    hash[0] = seed;
+    return hash;
+}
+
+TEST_CASE(round_trip_preserves_rules)
+{
+    auto contents = parse_contents(style_sheet);
+    auto hash = source_hash(1);
+
+    auto encoded = TRY_OR_FAIL(StyleSheetContentsEncoder::encode(*contents, hash));
+    auto decoded = TRY_OR_FAIL(StyleSheetContentsDecoder::decode(encoded, hash));
+    EXPECT_EQ(decoded->rules().size(), contents->rules().size());
+
+    // Rules don't compare, but encoding the decoded rules again must produce exactly the same bytes.
+    auto reencoded = TRY_OR_FAIL(StyleSheetContentsEncoder::encode(*decoded, hash));
+    EXPECT(reencoded == encoded);
+
+    auto const& at_rule = decoded->rules()[2].get<AtRule>();
+    EXPECT_EQ(at_rule.name, "media"_utf16_fly_string);
+    EXPECT(at_rule.is_block_rule);
+
+    auto const& qualified_rule = decoded->rules()[4].get<QualifiedRule>();
+    EXPECT(!qualified_rule.declarations.is_empty());
+    EXPECT_EQ(qualified_rule.declarations[0].name, "color"_utf16_fly_string);
+    EXPECT(!qualified_rule.child_rules.is_empty());
+    EXPECT(qualified_rule.prelude == contents->rules()[4].get<QualifiedRule>().prelude);
+}
+
+TEST_CASE(decoding_rejects_a_different_source)
+{
+    auto contents = parse_contents(style_sheet);
+    auto encoded = TRY_OR_FAIL(StyleSheetContentsEncoder::encode(*contents, source_hash(1)));
+    EXPECT(StyleSheetContentsDecoder::decode(encoded, source_hash(2)).is_error());
+}
+
+TEST_CASE(decoding_rejects_a_different_version)
+{
+    auto contents = parse_contents(style_sheet);
+    auto hash = source_hash(1);
+    auto encoded = TRY_OR_FAIL(StyleSheetContentsEncoder::encode(*contents, hash));
+
+    // The version follows the four bytes of magic.
+    encoded[4] ^= 0xff;
+    EXPECT(StyleSheetContentsDecoder::decode(encoded, hash).is_error());
+}
+
+TEST_CASE(decoding_rejects_malformed_encodings)
+{
+    auto contents = parse_contents(style_sheet);
+    auto hash = source_hash(1);
+    auto encoded = TRY_OR_FAIL(StyleSheetContentsEncoder::encode(*contents, hash));
+
+    for (size_t length = 0; length < encoded.size(); length += 7)
+        EXPECT(StyleSheetContentsDecoder::decode(encoded.bytes().trim(length), hash).is_error());
+
+    auto with_trailing_data = MUST(ByteBuffer::copy(encoded));
+    with_trailing_data.append(0);
+    EXPECT(StyleSheetContentsDecoder::decode(with_trailing_data, hash).is_error());
+}
+
+TEST_CASE(decoded_contents_have_the_same_estimated_size)
+{
+    auto contents = parse_contents(style_sheet);
+    EXPECT(contents->estimated_size_in_bytes() > style_sheet.length());
+
+    auto hash = source_hash(1);
+    auto encoded = TRY_OR_FAIL(StyleSheetContentsEncoder::encode(*contents, hash));
+    auto decoded = TRY_OR_FAIL(StyleSheetContentsDecoder::decode(encoded, hash));
+    EXPECT_EQ(decoded->estimated_size_in_bytes(), contents->estimated_size_in_bytes());
+}
+
+static StringView large_style_sheet()
+{
+    static ByteString const css = [] {
+        StringBuilder builder;
+        for (size_t i = 0; i < 500; ++i)
+            builder.append(style_sheet);
+        return builder.to_byte_string();
+    }();
+    return css;
+}
+
+// Loading a style sheet whose rules are in the disk cache decodes those rules instead of tokenizing and parsing it again,
+// which is only worth it while decoding is the faster of the two.
+BENCHMARK_CASE(tokenize_and_parse_large_style_sheet)
+{
+    auto source = Utf16String::from_utf8(large_style_sheet());
+    for (size_t i = 0; i < 20; ++i)
+        EXPECT(!Parser::create(ParsingParams {}, source.utf16_view()).parse_as_shareable_style_sheet_rules()->rules().is_empty());
+}
+
+BENCHMARK_CASE(decode_large_style_sheet)
+{
+    auto hash = source_hash(1);
+    auto encoded = TRY_OR_FAIL(StyleSheetContentsEncoder::encode(*parse_contents(large_style_sheet()), hash));
+    for (size_t i = 0; i < 20; ++i) {
+        auto decoded = TRY_OR_FAIL(StyleSheetContentsDecoder::decode(encoded, hash));
+        EXPECT(!decoded->rules().is_empty());
+    }
+}
+
+}
@@ -107,4 +107,26 @@ TEST_CASE(tokenizer_filters_decoded_surrogate_code_points_as_single_replacements
     expect_first_token_is_ident_for_both_tokenizers("foo\xed\xa0\x80"sv, "utf-8"sv, "foo�"sv, "foo�"sv, TokenizerInput::DecodedText);
 }
 
+TEST_CASE(detached_tokens_match_tokens_of_both_tokenizers)
+{
+    char16_t const input[] = u"@media screen {\r\n  #id.\xE9l\u00E8ve > a[href^=\"x\"]::after { width: calc(50% - 2.5em); content: '\xFF\xD800'; }\f}\0 url(foo.png) <!-- -->";
+    Utf16View input_view { input, array_size(input) - 1 };
+
+    auto detached_tokens = RustTokenizer::tokenize_detached(input_view);
+    auto size = detached_tokens.size();
+    auto tokens = RustTokenizer::attach(move(detached_tokens));
+    auto expected_tokens = Tokenizer::tokenize(input_view);
+
+    EXPECT_EQ(tokens.size(), size);
+    EXPECT_EQ(tokens.size(), expected_tokens.size());
+    for (size_t i = 0; i < min(tokens.size(), expected_tokens.size()); ++i) {
+        EXPECT_EQ(tokens[i], expected_tokens[i]);
+        EXPECT_EQ(tokens[i].original_source_text(), expected_tokens[i].original_source_text());
+        EXPECT_EQ(tokens[i].start_position().line, expected_tokens[i].start_position().line);
+        EXPECT_EQ(tokens[i].start_position().column, expected_tokens[i].start_position().column);
+        EXPECT_EQ(tokens[i].end_position().line, expected_tokens[i].end_position().line);
+        EXPECT_EQ(tokens[i].end_position().column, expected_tokens[i].end_position().column);
+    }
+}
+
 }
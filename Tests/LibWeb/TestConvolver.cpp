@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/WebAudio/Rendering/Convolver.h>
+#include <LibWeb/WebAudio/Rendering/FFT.h>
+
+using namespace Web::WebAudio::Rendering;
+
+static constexpr size_t quantum_size = 128;
+
+static Vector<float> make_signal(size_t length, u32 seed, float decay = 0)
+{
+    Vector<float> signal;
+    signal.resize(length);
+    for (size_t i = 0; i < length; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        auto sample = static_cast<float>(seed >> 8) / static_cast<float>(1u << 24) * 2.f - 1.f;
+        signal[i] = sample * AK::exp(-decay * static_cast<float>(i));
+    }
+    return signal;
+}
+
+static Vector<float> convolve_directly(ReadonlySpan<float> input, ReadonlySpan<float> impulse_response)
+{
+    Vector<float> output;
+    output.resize(input.size());
+    for (size_t frame = 0; frame < input.size(); ++frame) {
+        double sum = 0;
+        for (size_t tap = 0; tap < min(frame + 1, impulse_response.size()); ++tap)
+            sum += static_cast<double>(input[frame - tap]) * impulse_response[tap];
+        output[frame] = static_cast<float>(sum);
+    }
+    return output;
+}
+
+static Vector<float> convolve_in_quanta(ReadonlySpan<float> input, ReadonlySpan<float> impulse_response)
+{
+    Convolver convolver(ConvolverKernel::create(impulse_response, 1.f, quantum_size));
+
+    Vector<float> output;
+    output.resize(input.size());
+    for (size_t offset = 0; offset < input.size(); offset += quantum_size)
+        convolver.process(input.slice(offset, quantum_size), output.span().slice(offset, quantum_size));
+    return output;
+}
+
+TEST_CASE(fft_round_trip)
+{
+    FFT fft(256);
+    auto signal = make_signal(256, 1);
+
+    Vector<float> real = signal;
+    Vector<float> imaginary;
+    imaginary.resize(256);
+
+    fft.transform(real, imaginary);
+    fft.inverse_transform(real, imaginary);
+
+    for (size_t i = 0; i < signal.size(); ++i) {
+        EXPECT_APPROXIMATE_WITH_ERROR(real[i] / fft.size(), signal[i], 1e-5);
+        EXPECT_APPROXIMATE_WITH_ERROR(imaginary[i] / fft.size(), 0.f, 1e-5);
+    }
+}
+
+TEST_CASE(unit_impulse_passes_input_through)
+{
+    Vector<float> impulse_response { 1.f };
+    auto input = make_signal(quantum_size * 4, 2);
+    auto output = convolve_in_quanta(input, impulse_response);
+
+    for (size_t i = 0; i < input.size(); ++i)
+        EXPECT_APPROXIMATE_WITH_ERROR(output[i], input[i], 1e-5);
+}
+
+TEST_CASE(head_partitions_match_direct_convolution)
+{
+    auto impulse_response = make_signal(quantum_size * 5 + 37, 3, 0.002f);
+    auto input = make_signal(quantum_size * 24, 4);
+
+    auto expected = convolve_directly(input, impulse_response);
+    auto output = convolve_in_quanta(input, impulse_response);
+
+    for (size_t i = 0; i < input.size(); ++i)
+        EXPECT_APPROXIMATE_WITH_ERROR(output[i], expected[i], 1e-4);
+}
+
+TEST_CASE(tail_partitions_match_direct_convolution)
+{
+    // Long enough to need three tail partitions, so the background stage runs and its results are picked up several
+    // times.
+    auto tail_block_size = quantum_size * ConvolverKernel::tail_block_size_in_quanta;
+    auto impulse_response = make_signal(tail_block_size * 5 + 61, 5, 0.0002f);
+    auto input = make_signal(tail_block_size * 7, 6);
+
+    auto kernel = ConvolverKernel::create(impulse_response, 1.f, quantum_size);
+    EXPECT(kernel->tail().has_value());
+    EXPECT_EQ(kernel->tail()->count, 4u);
+
+    auto expected = convolve_directly(input, impulse_response);
+    auto output = convolve_in_quanta(input, impulse_response);
+
+    for (size_t i = 0; i < input.size(); ++i)
+        EXPECT_APPROXIMATE_WITH_ERROR(output[i], expected[i], 2e-3);
+}
+
+TEST_CASE(normalization_scale)
+{
+    // A unit impulse at 44.1 kHz has an RMS power of 1, so only the gain calibration applies.
+    AudioBufferContents contents({ Vector<float> { 1.f } }, 44100);
+    EXPECT_APPROXIMATE(calculate_convolver_normalization_scale(contents), 0.00125f);
+
+    auto response = ConvolverResponse::create(contents, true, quantum_size);
+    EXPECT_EQ(response->impulse_response_channel_count, 1u);
+    EXPECT_EQ(response->convolvers.size(), 2u);
+}
+
+// Measures the cost of rendering with a typical three-second stereo reverb at 48 kHz, one render quantum at a time.
+BENCHMARK_CASE(three_second_stereo_response)
+{
+    static constexpr size_t sample_rate = 48000;
+
+    Vector<Vector<float>> channels;
+    channels.append(make_signal(sample_rate * 3, 7, 0.0001f));
+    channels.append(make_signal(sample_rate * 3, 8, 0.0001f));
+    auto response = ConvolverResponse::create(AudioBufferContents(move(channels), sample_rate), true, quantum_size);
+
+    auto input = make_signal(quantum_size, 9);
+    Vector<float> output;
+    output.resize(quantum_size);
+
+    // Ten seconds of audio.
+    for (size_t quantum = 0; quantum < sample_rate * 10 / quantum_size; ++quantum) {
+        for (auto& convolver : response->convolvers)
+            convolver->process(input, output);
+    }
+}
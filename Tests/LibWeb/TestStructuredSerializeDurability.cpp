@@ -62,7 +62,7 @@ TEST_CASE(serializable_objects_round_trip_through_storage)
         auto value = MUST(storage_deserialize(storage_serialize(blob)));
         auto& decoded = unwrap_wrappable<Web::FileAPI::Blob>(value);
         EXPECT_EQ(decoded.type(), "text/plain"_utf16);
-        EXPECT_EQ(decoded.raw_bytes(), "hello"sv.bytes());
+        EXPECT_EQ(MUST(decoded.raw_bytes()).bytes(), "hello"sv.bytes());
     }
 }
 
@@ -463,7 +463,7 @@ TEST_CASE(file_api_serializables_round_trip)
         append_storage_bytes(body, "hello"sv.bytes()); // ByteBuffer body
         auto& blob = unwrap_wrappable<Web::FileAPI::Blob>(MUST(storage_deserialize(serializable_storage_record("Blob"sv, 1, body))));
         EXPECT_EQ(blob.type(), "text/plain"_string);
-        EXPECT_EQ(blob.raw_bytes(), "hello"sv.bytes());
+        EXPECT_EQ(MUST(blob.raw_bytes()).bytes(), "hello"sv.bytes());
     }
 
     Vector<u8> file_body;
@@ -477,7 +477,7 @@ TEST_CASE(file_api_serializables_round_trip)
         EXPECT_EQ(file.name(), "f.txt"_string);
         EXPECT_EQ(file.last_modified(), 1234);
         EXPECT_EQ(file.type(), "text/plain"_string);
-        EXPECT_EQ(file.raw_bytes(), "data"sv.bytes());
+        EXPECT_EQ(MUST(file.raw_bytes()).bytes(), "data"sv.bytes());
     }
 
     {
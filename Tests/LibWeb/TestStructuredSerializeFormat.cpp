@@ -276,6 +276,34 @@ TEST_CASE(all_public_writer_reader_types_round_trip_through_ipc_and_storage)
     EXPECT_EQ(structured_storage_buffer_round_trip(byte_buffer).span(), raw_bytes);
 }
 
+TEST_CASE(gathered_bytes_decode_as_one_buffer)
+{
+    Array<ReadonlyBytes, 3> parts { "ab"sv.bytes(), ""sv.bytes(), "cde"sv.bytes() };
+
+    {
+        auto writer = Web::HTML::StructuredSerializeWriter::create_ipc();
+        writer.encode_gathered_bytes(parts);
+        writer.encode(u32 { 7 });
+
+        auto record = writer.take_ipc_record();
+        Web::HTML::StructuredSerializeReader reader { record };
+        EXPECT_EQ(StringView(MUST(reader.decode<ByteBuffer>()).bytes()), "abcde"sv);
+        EXPECT_EQ(MUST(reader.decode<u32>()), 7u);
+    }
+
+    {
+        auto writer = Web::HTML::StructuredSerializeWriter::create_storage();
+        writer.encode_gathered_bytes(parts);
+        writer.encode(u32 { 7 });
+
+        auto record = writer.take_storage_record();
+        Web::HTML::StructuredSerializeReader reader { record };
+        EXPECT_EQ(StringView(MUST(reader.decode<ByteBuffer>()).bytes()), "abcde"sv);
+        EXPECT_EQ(MUST(reader.decode<u32>()), 7u);
+        EXPECT(reader.is_at_end());
+    }
+}
+
 TEST_CASE(storage_writer_encodes_js_strings_as_utf16_code_units)
 {
     Array<char16_t, 3> code_units {
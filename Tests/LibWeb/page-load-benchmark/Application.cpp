@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "Application.h"
+
+#include <LibCore/ArgsParser.h>
+
+namespace PageLoadBenchmark {
+
+Application::Application(Optional<ByteString> ladybird_binary_path)
+    : WebView::Application(move(ladybird_binary_path))
+{
+}
+
+Application::~Application() = default;
+
+void Application::create_platform_arguments(Core::ArgsParser& args_parser)
+{
+    args_parser.add_option(run_count, "Number of times to load each URL (default: 5)", "runs", 0, "n");
+    args_parser.add_option(settle_time_in_milliseconds, "Time to keep measuring after the load event (default: 1000)", "settle-time", 0, "ms");
+    args_parser.add_option(load_timeout_in_seconds, "Time to wait for the load event (default: 30)", "load-timeout", 0, "seconds");
+
+    args_parser.add_option(Core::ArgsParser::Option {
+        .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
+        .help_string = "Record every response to a page load archive",
+        .long_name = "record-archive",
+        .value_name = "path",
+        .accept_value = [&](StringView value) -> ErrorOr<bool> {
+            record_archive_path = value;
+            return true;
+        },
+    });
+    args_parser.add_option(Core::ArgsParser::Option {
+        .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
+        .help_string = "Serve every response from a page load archive",
+        .long_name = "replay-archive",
+        .value_name = "path",
+        .accept_value = [&](StringView value) -> ErrorOr<bool> {
+            replay_archive_path = value;
+            return true;
+        },
+    });
+    args_parser.add_option(replay_latency_in_milliseconds, "Latency added to every replayed response", "replay-latency", 0, "ms");
+    args_parser.add_option(replay_bandwidth, "Rate at which replayed response bodies arrive", "replay-bandwidth", 0, "bytes-per-second");
+}
+
+void Application::create_platform_options(WebView::BrowserOptions& browser_options, WebView::RequestServerOptions& request_server_options, WebView::WebContentOptions& web_content_options)
+{
+    browser_options.headless_mode = WebView::HeadlessMode::Test;
+    browser_options.disable_sql_database = WebView::DisableSQLDatabase::Yes;
+
+    // Every run should start out cold, rather than with whatever the previous run left in the disk cache.
+    request_server_options.http_disk_cache_mode = WebView::HTTPDiskCacheMode::Disabled;
+    request_server_options.record_archive_path = record_archive_path;
+    request_server_options.replay_archive_path = replay_archive_path;
+    request_server_options.replay_latency_ms = replay_latency_in_milliseconds;
+    request_server_options.replay_bandwidth = replay_bandwidth;
+
+    // Ensure consistent font rendering and time zone operations between machines.
+    web_content_options.force_fontconfig = WebView::ForceFontconfig::Yes;
+    web_content_options.default_time_zone = "UTC"sv;
+}
+
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/Error.h>
+#include <AK/LexicalPath.h>
+#include <AK/Optional.h>
+#include <LibWebView/Application.h>
+#include <errno.h>
+
+namespace PageLoadBenchmark {
+
+class Application : public WebView::Application {
+    WEB_VIEW_APPLICATION(Application)
+
+public:
+    explicit Application(Optional<ByteString> ladybird_binary_path);
+    ~Application();
+
+    virtual void create_platform_arguments(Core::ArgsParser&) override;
+    virtual void create_platform_options(WebView::BrowserOptions&, WebView::RequestServerOptions&, WebView::WebContentOptions&) override;
+    virtual bool should_coordinate_browser_process() const override { return false; }
+
+    virtual ErrorOr<LexicalPath> default_path_for_downloaded_file(ByteString const&) const override { return Error::from_errno(ECANCELED); }
+
+    size_t run_count { 5 };
+    int settle_time_in_milliseconds { 1000 };
+    int load_timeout_in_seconds { 30 };
+
+    Optional<ByteString> record_archive_path;
+    Optional<ByteString> replay_archive_path;
+    Optional<u64> replay_latency_in_milliseconds;
+    Optional<u64> replay_bandwidth;
+};
+
+}
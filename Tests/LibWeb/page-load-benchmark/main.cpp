@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "Application.h"
+
+#include <AK/LexicalPath.h>
+#include <AK/QuickSort.h>
+#include <AK/Vector.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Promise.h>
+#include <LibCore/Timer.h>
+#include <LibGfx/SystemTheme.h>
+#include <LibMain/Main.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Compositor/Types.h>
+#include <LibWeb/Page/PageLoadTimings.h>
+#include <LibWebView/HeadlessWebView.h>
+#include <LibWebView/Utilities.h>
+
+namespace PageLoadBenchmark {
+
+struct RunResult {
+    Web::PageLoadTimings timings;
+
+    // Summed over all frames that were presented until the page settled.
+    AK::Duration raster_time;
+    AK::Duration present_latency;
+    size_t presented_frame_count { 0 };
+};
+
+static double to_milliseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_microseconds()) / 1000.0;
+}
+
+static ErrorOr<RunResult> load_once(Core::AnonymousBuffer const& theme, Web::DevicePixelSize window_size, URL::URL const& url)
+{
+    auto& app = Application::the();
+
+    // Each run gets its own WebContent process, so that nothing cached by the previous run can speed it up.
+    auto view = WebView::HeadlessWebView::create(theme, window_size);
+
+    RunResult result;
+    view->on_present_frame = [&](Web::Compositor::PresentTimings timings) {
+        result.raster_time += timings.raster_time;
+        result.present_latency += timings.present_latency;
+        ++result.presented_frame_count;
+    };
+
+    auto load_finished = Core::Promise<Empty>::construct();
+    view->on_load_finish = [&](URL::URL const& loaded_url) {
+        if (url.equals(loaded_url, URL::ExcludeFragment::Yes) && !load_finished->is_resolved())
+            load_finished->resolve({});
+    };
+    view->on_web_content_crashed = [&] {
+        if (!load_finished->is_resolved())
+            load_finished->reject(Error::from_string_literal("WebContent crashed"));
+    };
+
+    auto load_timeout = Core::Timer::create_single_shot(app.load_timeout_in_seconds * 1000, [&] {
+        if (!load_finished->is_resolved())
+            load_finished->reject(Error::from_string_literal("Timed out waiting for the load event"));
+    });
+    load_timeout->start();
+
+    view->load(url);
+    TRY(load_finished->await());
+    load_timeout->stop();
+
+    // Rendering keeps going after the load event, e.g. for web fonts and images that were loaded lazily.
+    auto settled = Core::Promise<Empty>::construct();
+    auto settle_timer = Core::Timer::create_single_shot(app.settle_time_in_milliseconds, [&] {
+        settled->resolve({});
+    });
+    settle_timer->start();
+    TRY(settled->await());
+
+    result.timings = TRY(view->request_page_load_timings()->await());
+
+    view->on_present_frame = nullptr;
+    view->on_web_content_crashed = nullptr;
+    return result;
+}
+
+static void print_run(size_t run, RunResult const& result)
+{
+    auto const& timings = result.timings;
+
+    auto first_contentful_paint = timings.first_contentful_paint.has_value()
+        ? ByteString::formatted("{:>9.2}", to_milliseconds(*timings.first_contentful_paint))
+        : ByteString { "        -"sv };
+
+    auto average_present_latency = result.presented_frame_count > 0
+        ? to_milliseconds(result.present_latency) / static_cast<double>(result.presented_frame_count)
+        : 0.0;
+
+    outln("{:>5} {:>9.2} {:>9.2} {:>9.2} {:>9.2} {:>9.2} {:>9.2} {} {:>7}",
+        run,
+        to_milliseconds(timings.parse),
+        to_milliseconds(timings.style),
+        to_milliseconds(timings.layout),
+        to_milliseconds(timings.paint),
+        to_milliseconds(result.raster_time),
+        average_present_latency,
+        first_contentful_paint,
+        result.presented_frame_count);
+}
+
+static void print_medians(Vector<RunResult> const& results)
+{
+    if (results.is_empty())
+        return;
+
+    auto median = [&](auto get_value) {
+        Vector<double> values;
+        for (auto const& result : results) {
+            if (auto value = get_value(result); value.has_value())
+                values.append(*value);
+        }
+        if (values.is_empty())
+            return ByteString { "        -"sv };
+
+        quick_sort(values);
+        auto middle = values.size() / 2;
+        auto value = values.size() % 2 == 0 ? (values[middle - 1] + values[middle]) / 2.0 : values[middle];
+        return ByteString::formatted("{:>9.2}", value);
+    };
+
+    outln("{:>5} {} {} {} {} {} {} {}",
+        "med",
+        median([](auto const& result) -> Optional<double> { return to_milliseconds(result.timings.parse); }),
+        median([](auto const& result) -> Optional<double> { return to_milliseconds(result.timings.style); }),
+        median([](auto const& result) -> Optional<double> { return to_milliseconds(result.timings.layout); }),
+        median([](auto const& result) -> Optional<double> { return to_milliseconds(result.timings.paint); }),
+        median([](auto const& result) -> Optional<double> { return to_milliseconds(result.raster_time); }),
+        median([](auto const& result) -> Optional<double> {
+            if (result.presented_frame_count == 0)
+                return {};
+            return to_milliseconds(result.present_latency) / static_cast<double>(result.presented_frame_count);
+        }),
+        median([](auto const& result) -> Optional<double> {
+            return result.timings.first_contentful_paint.map([](auto duration) { return to_milliseconds(duration); });
+        }));
+}
+
+static ErrorOr<int> run_benchmark(Core::AnonymousBuffer const& theme, Web::DevicePixelSize window_size)
+{
+    auto& app = Application::the();
+    auto had_failure = false;
+
+    for (auto const& url : Application::browser_options().urls) {
+        outln("{}", url);
+        outln("{:>5} {:>9} {:>9} {:>9} {:>9} {:>9} {:>9} {:>9} {:>7}", "run", "parse", "style", "layout", "paint", "raster", "present", "fcp", "frames");
+
+        Vector<RunResult> results;
+        for (size_t run = 1; run <= app.run_count; ++run) {
+            auto result = load_once(theme, window_size, url);
+            if (result.is_error()) {
+                warnln("{:>5} {}", run, result.error());
+                had_failure = true;
+                continue;
+            }
+
+            print_run(run, result.value());
+            results.append(result.release_value());
+        }
+
+        print_medians(results);
+        outln();
+    }
+
+    return had_failure ? 1 : 0;
+}
+
+}
+
+ErrorOr<int> ladybird_main(Main::Arguments arguments)
+{
+#if defined(LADYBIRD_BINARY_PATH)
+    auto app = TRY(PageLoadBenchmark::Application::create(arguments, LADYBIRD_BINARY_PATH));
+#else
+    auto app = TRY(PageLoadBenchmark::Application::create(arguments, OptionalNone {}));
+#endif
+
+    if (PageLoadBenchmark::Application::browser_options().raw_urls.is_empty()) {
+        warnln("Error: At least one URL must be passed to benchmark.");
+        return 1;
+    }
+
+    if (app->record_archive_path.has_value() && app->replay_archive_path.has_value()) {
+        warnln("Error: --record-archive cannot be used together with --replay-archive.");
+        return 1;
+    }
+
+    auto theme_path = LexicalPath::join(WebView::s_ladybird_resource_root, "themes"sv, "Default.ini"sv);
+    auto theme = TRY(Gfx::load_system_theme(theme_path.string()));
+
+    auto const& browser_options = PageLoadBenchmark::Application::browser_options();
+    Web::DevicePixelSize window_size { browser_options.window_width, browser_options.window_height };
+
+    return PageLoadBenchmark::run_benchmark(theme, window_size);
+}
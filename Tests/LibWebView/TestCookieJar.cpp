@@ -5,6 +5,7 @@
  */
 
 #include <AK/NonnullOwnPtr.h>
+#include <AK/QuickSort.h>
 #include <LibDatabase/Database.h>
 #include <LibHTTP/Cookie/ParsedCookie.h>
 #include <LibTest/TestCase.h>
@@ -94,3 +95,78 @@ TEST_CASE(newer_cookie_schema_reports_database_too_new)
     EXPECT_EQ(TRY_OR_FAIL(WebView::CookieJar::migrate_schema(*database)), Database::MigrationOutcome::DatabaseTooNew);
     EXPECT_EQ(TRY_OR_FAIL(WebView::CookieJar::migrate_schema(*database, Database::MigrationMode::CheckOnly)), Database::MigrationOutcome::DatabaseTooNew);
 }
+
+static void set_cookie(WebView::CookieJar& jar, StringView url, StringView name, StringView value, Optional<String> domain = {}, Optional<UnixDateTime> expiry_time = {})
+{
+    HTTP::Cookie::ParsedCookie cookie {
+        .name = MUST(String::from_utf8(name)),
+        .value = MUST(String::from_utf8(value)),
+        .expiry_time_from_expires_attribute = expiry_time,
+        .domain = move(domain),
+    };
+    jar.set_cookie(parse_url(url), cookie, HTTP::Cookie::Source::Http);
+}
+
+// Cookies created within the same clock tick may be listed in any order, so compare them sorted.
+static String sorted_cookie_string(WebView::CookieJar& jar, StringView url)
+{
+    auto cookie_string = jar.get_cookie(parse_url(url), HTTP::Cookie::Source::Http);
+
+    auto cookies = cookie_string.bytes_as_string_view().split_view("; "sv);
+    quick_sort(cookies);
+    return MUST(String::join("; "sv, cookies));
+}
+
+TEST_CASE(cookies_are_matched_by_host_and_parent_domains)
+{
+    auto jar = WebView::CookieJar::create();
+
+    set_cookie(*jar, "https://www.example.com/"sv, "host"sv, "1"sv);
+    set_cookie(*jar, "https://www.example.com/"sv, "parent"sv, "2"sv, "example.com"_string);
+    set_cookie(*jar, "https://example.com/"sv, "other-host"sv, "3"sv);
+    set_cookie(*jar, "https://example.org/"sv, "other-site"sv, "4"sv);
+
+    EXPECT_EQ(sorted_cookie_string(*jar, "https://www.example.com/"sv), "host=1; parent=2"sv);
+    EXPECT_EQ(sorted_cookie_string(*jar, "https://a.www.example.com/"sv), "parent=2"sv);
+    EXPECT_EQ(sorted_cookie_string(*jar, "https://example.com/"sv), "other-host=3; parent=2"sv);
+    EXPECT_EQ(sorted_cookie_string(*jar, "https://example.org/"sv), "other-site=4"sv);
+    EXPECT_EQ(sorted_cookie_string(*jar, "https://notexample.com/"sv), ""sv);
+}
+
+TEST_CASE(cookie_string_reflects_changes_after_being_retrieved)
+{
+    auto jar = WebView::CookieJar::create();
+    auto url = parse_url("https://example.com/"sv);
+
+    set_cookie(*jar, "https://example.com/"sv, "foo"sv, "1"sv);
+    EXPECT_EQ(jar->get_cookie(url, HTTP::Cookie::Source::Http), "foo=1"sv);
+    EXPECT_EQ(jar->get_cookie(url, HTTP::Cookie::Source::Http), "foo=1"sv);
+
+    set_cookie(*jar, "https://example.com/"sv, "foo"sv, "2"sv);
+    EXPECT_EQ(jar->get_cookie(url, HTTP::Cookie::Source::Http), "foo=2"sv);
+
+    set_cookie(*jar, "https://example.com/"sv, "bar"sv, "3"sv);
+    EXPECT_EQ(sorted_cookie_string(*jar, "https://example.com/"sv), "bar=3; foo=2"sv);
+
+    EXPECT(jar->delete_cookie({ "foo"_string, "example.com"_string, "/"_string }));
+    EXPECT_EQ(jar->get_cookie(url, HTTP::Cookie::Source::Http), "bar=3"sv);
+}
+
+TEST_CASE(expired_cookies_are_purged)
+{
+    auto jar = WebView::CookieJar::create();
+
+    set_cookie(*jar, "https://example.com/"sv, "short"sv, "1"sv, {}, UnixDateTime::now() + AK::Duration::from_seconds(60));
+    set_cookie(*jar, "https://example.com/"sv, "long"sv, "2"sv, {}, UnixDateTime::now() + AK::Duration::from_seconds(3600));
+    EXPECT_EQ(sorted_cookie_string(*jar, "https://example.com/"sv), "long=2; short=1"sv);
+
+    // Extending a cookie's expiry time must not let its earlier expiry time purge it.
+    set_cookie(*jar, "https://example.com/"sv, "short"sv, "3"sv, {}, UnixDateTime::now() + AK::Duration::from_seconds(7200));
+    jar->expire_cookies_with_time_offset(AK::Duration::from_seconds(120));
+    EXPECT_EQ(jar->get_all_cookies().size(), 2uz);
+
+    jar->expire_cookies_with_time_offset(AK::Duration::from_seconds(5400));
+    auto cookies = jar->get_all_cookies();
+    EXPECT_EQ(cookies.size(), 1uz);
+    EXPECT_EQ(cookies[0].name, "short"_string);
+}
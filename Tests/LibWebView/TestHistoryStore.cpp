@@ -193,6 +193,43 @@ static void expect_history_page_entries_are_paginated_and_searchable(WebView::Hi
     EXPECT_EQ(title_search_entries[1].url, "https://www.alpha.example.com/path"_string);
 }
 
+static void expect_history_search_tracks_title_updates_and_removals(WebView::HistoryStore& store)
+{
+    auto news_url = parse_url("https://ladybird.dev/news"sv);
+    store.record_visit(news_url, "Weekly update"_string, UnixDateTime::from_seconds_since_epoch(10));
+    store.record_visit(parse_url("https://example.com/"sv), "Example"_string, UnixDateTime::from_seconds_since_epoch(20));
+
+    auto title_entries = store.autocomplete_entries("weekly"sv, 8);
+    VERIFY(title_entries.size() == 1);
+    EXPECT_EQ(title_entries[0].url, "https://ladybird.dev/news"_string);
+
+    // Wildcards in the query are matched literally.
+    EXPECT(store.autocomplete_entries("ladybird.dev/new_"sv, 8).is_empty());
+    EXPECT(store.autocomplete_entries("%news"sv, 8).is_empty());
+
+    store.update_title(news_url, "Monthly recap"_string);
+    EXPECT(store.autocomplete_entries("weekly"sv, 8).is_empty());
+    EXPECT(store.list_entries("weekly"sv, 0, 10).is_empty());
+
+    auto updated_entries = store.autocomplete_entries("recap"sv, 8);
+    VERIFY(updated_entries.size() == 1);
+    EXPECT_EQ(updated_entries[0].url, "https://ladybird.dev/news"_string);
+
+    auto listed_entries = store.list_entries("RECAP"sv, 0, 10);
+    VERIFY(listed_entries.size() == 1);
+    EXPECT_EQ(listed_entries[0].url, "https://ladybird.dev/news"_string);
+
+    // Queries that are too short for the search index still match.
+    auto short_query_entries = store.list_entries("ne"sv, 0, 10);
+    VERIFY(short_query_entries.size() == 1);
+    EXPECT_EQ(short_query_entries[0].url, "https://ladybird.dev/news"_string);
+
+    store.remove_entry_for_url(news_url);
+    EXPECT(store.autocomplete_entries("recap"sv, 8).is_empty());
+    EXPECT(store.list_entries("recap"sv, 0, 10).is_empty());
+    EXPECT_EQ(store.autocomplete_entries("xample"sv, 8).size(), 1u);
+}
+
 static void expect_history_entries_can_be_removed(WebView::HistoryStore& store)
 {
     auto example_url = parse_url("https://example.com/"sv);
@@ -398,6 +435,12 @@ TEST_CASE(history_page_entries_are_paginated_and_searchable)
     expect_history_page_entries_are_paginated_and_searchable(*store);
 }
 
+TEST_CASE(history_search_tracks_title_updates_and_removals)
+{
+    auto store = WebView::HistoryStore::create();
+    expect_history_search_tracks_title_updates_and_removals(*store);
+}
+
 TEST_CASE(non_browsable_urls_are_not_recorded)
 {
     auto store = WebView::HistoryStore::create();
@@ -728,6 +771,14 @@ TEST_CASE(persisted_history_page_entries_are_paginated_and_searchable)
     expect_history_page_entries_are_paginated_and_searchable(*store);
 }
 
+TEST_CASE(persisted_history_search_tracks_title_updates_and_removals)
+{
+    auto database = TRY_OR_FAIL(Database::Database::create_memory_backed());
+    auto store = create_persisted_store(*database);
+
+    expect_history_search_tracks_title_updates_and_removals(*store);
+}
+
 TEST_CASE(persisted_history_entries_can_be_removed)
 {
     auto database_directory = ByteString::formatted(
@@ -902,3 +953,37 @@ TEST_CASE(history_ranking_signal_migration_preserves_existing_entries)
     EXPECT_EQ(entry->score_updated_at, UnixDateTime::from_seconds_since_epoch(123));
     EXPECT_APPROXIMATE(entry->decayed_visit_score, 8.0);
 }
+
+TEST_CASE(history_search_index_migration_indexes_existing_entries)
+{
+    auto database = TRY_OR_FAIL(Database::Database::create_memory_backed());
+    TRY_OR_FAIL(database->execute_raw(R"#(
+        CREATE TABLE SchemaVersions (store TEXT PRIMARY KEY, version INTEGER NOT NULL);
+        INSERT INTO SchemaVersions (store, version) VALUES ('History', 1);
+        CREATE TABLE History (
+            url TEXT PRIMARY KEY,
+            title TEXT NOT NULL,
+            favicon TEXT,
+            visit_count INTEGER NOT NULL,
+            last_visited_time INTEGER NOT NULL
+        );
+        INSERT INTO History (url, title, visit_count, last_visited_time)
+        VALUES ('https://www.example.com/guide', 'Example guide', 1, 123000);
+    )#"sv));
+
+    EXPECT_EQ(TRY_OR_FAIL(WebView::FaviconStore::migrate_schema(*database)), Database::MigrationOutcome::Success);
+    EXPECT_EQ(TRY_OR_FAIL(WebView::HistoryStore::migrate_schema(*database)), Database::MigrationOutcome::Success);
+    auto store = TRY_OR_FAIL(WebView::HistoryStore::create(*database));
+
+    auto prefix_entries = store->autocomplete_entries("exa"sv, 8);
+    VERIFY(prefix_entries.size() == 1);
+    EXPECT_EQ(prefix_entries[0].url, "https://www.example.com/guide"_string);
+
+    auto substring_entries = store->autocomplete_entries("guide"sv, 8);
+    VERIFY(substring_entries.size() == 1);
+    EXPECT_EQ(substring_entries[0].url, "https://www.example.com/guide"_string);
+
+    auto listed_entries = store->list_entries("example guide"sv, 0, 10);
+    VERIFY(listed_entries.size() == 1);
+    EXPECT_EQ(listed_entries[0].url, "https://www.example.com/guide"_string);
+}